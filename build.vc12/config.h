@@ -307,6 +307,9 @@ MA 02111-1307, USA. */
 /* ./configure --enable-assert option, to enable some ASSERT()s */
 #undef WANT_ASSERT
 
+/* ./configure --enable-stats option, to record algorithm statistics */
+#undef WANT_STATS
+
 /* Define if your processor stores words with the most significant byte first
    (like Motorola and SPARC, unlike Intel and VAX). */
 #undef WORDS_BIGENDIAN
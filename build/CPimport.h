@@ -0,0 +1,35357 @@
+2,1,1,1,
+2,2,1,1,1,
+2,3,1,1,0,1,
+2,4,1,1,0,0,1,
+2,5,1,0,1,0,0,1,
+2,6,1,1,0,1,1,0,1,
+2,7,1,1,0,0,0,0,0,1,
+2,8,1,0,1,1,1,0,0,0,1,
+2,9,1,0,0,0,1,0,0,0,0,1,
+2,10,1,1,1,1,0,1,1,0,0,0,1,
+2,11,1,0,1,0,0,0,0,0,0,0,0,1,
+2,12,1,1,0,1,0,1,1,1,0,0,0,0,1,
+2,13,1,1,0,1,1,0,0,0,0,0,0,0,0,1,
+2,14,1,0,0,1,0,1,0,1,0,0,0,0,0,0,1,
+2,15,1,0,1,0,1,1,0,0,0,0,0,0,0,0,0,1,
+2,16,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,1,
+2,17,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,18,1,1,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,1,
+2,19,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,20,1,1,0,0,1,1,1,1,0,1,1,0,0,0,0,0,0,0,0,0,1,
+2,21,1,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,22,1,0,0,0,0,1,1,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,
+2,23,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,24,1,0,0,1,0,1,0,1,0,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,1,
+2,25,1,0,1,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,26,1,1,0,0,1,0,1,1,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,
+2,27,1,0,1,1,0,1,0,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,28,1,0,1,0,0,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,29,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,30,1,1,1,1,0,1,0,1,0,0,0,1,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,31,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,32,1,0,0,1,1,0,0,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,33,1,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,34,1,1,1,0,1,1,1,1,1,0,0,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,35,1,0,1,0,0,1,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,36,1,1,0,0,0,1,1,0,1,0,0,0,0,1,1,0,0,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,37,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,38,1,1,1,0,0,1,0,0,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,39,1,0,1,0,0,1,1,1,0,1,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,40,1,1,0,1,0,1,0,0,1,0,0,0,1,1,0,1,1,0,1,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,41,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,42,1,1,1,0,0,1,1,0,0,1,0,1,1,0,0,0,0,0,1,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,
+2,43,1,0,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,44,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,45,1,0,0,0,0,0,1,0,0,0,0,1,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,46,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,47,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,48,1,0,0,1,0,0,0,1,1,0,1,1,1,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,49,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,50,1,0,1,0,1,0,1,0,1,1,1,0,1,1,1,0,1,1,0,1,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,51,1,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,52,1,1,0,0,1,0,0,1,0,0,1,0,0,0,1,1,0,1,0,0,0,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,53,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,54,1,1,1,0,1,0,0,1,0,0,0,0,0,1,0,1,1,1,1,0,0,1,0,0,0,1,0,1,0,1,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,55,1,0,0,0,1,0,0,1,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,56,1,0,1,1,1,0,0,0,1,1,0,1,0,1,1,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,57,1,1,1,1,1,1,1,0,1,0,1,1,0,1,0,0,1,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,58,1,1,0,1,0,1,1,1,1,0,1,1,1,0,0,0,1,0,1,0,0,0,1,0,1,1,1,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,59,1,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,60,1,0,1,1,1,1,0,0,1,0,0,0,1,0,0,0,0,1,0,1,0,0,1,0,0,1,1,0,0,0,1,0,1,1,1,0,1,0,0,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,61,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,62,1,1,0,0,0,0,1,0,0,0,0,0,1,1,1,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,63,1,1,1,1,1,0,0,0,1,1,0,1,0,0,0,1,1,1,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,64,1,1,1,0,1,1,0,1,0,0,1,1,1,1,0,0,0,0,1,0,1,1,1,1,1,1,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,65,1,1,0,0,0,1,0,1,0,1,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,66,1,0,1,0,1,1,1,1,0,0,0,1,0,1,0,0,1,0,0,1,0,1,1,1,1,0,0,1,0,1,1,1,1,1,1,0,0,0,1,0,1,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,67,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,68,1,1,0,0,1,1,0,0,1,1,0,0,0,1,1,1,0,0,0,0,1,0,1,0,0,0,1,0,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,69,1,0,0,0,1,1,0,0,1,1,1,0,0,0,1,0,0,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,70,1,0,1,1,0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,0,0,1,0,1,0,0,1,1,0,1,1,1,1,1,1,0,1,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,71,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,72,1,0,0,0,1,0,0,0,1,0,0,0,1,0,0,1,0,0,1,0,0,1,1,1,0,1,0,1,0,1,1,1,1,0,0,1,0,0,1,0,0,0,0,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,73,1,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,74,1,0,0,1,0,0,0,0,1,0,0,1,1,1,0,0,1,1,0,0,0,1,0,0,1,0,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,75,1,1,0,0,1,1,0,0,0,1,0,0,1,0,1,0,0,0,0,0,0,0,1,1,0,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,76,1,1,1,0,0,1,0,0,0,0,0,0,0,0,1,1,0,0,0,1,1,0,0,1,1,1,0,1,0,1,0,1,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,77,1,0,1,0,1,0,0,0,0,0,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,78,1,1,0,0,1,0,1,1,1,1,0,1,0,1,1,1,0,1,1,1,0,1,1,0,1,1,0,1,1,0,0,0,1,1,1,1,0,1,0,1,0,0,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,79,1,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,80,1,0,1,0,1,1,1,0,1,1,0,1,0,1,0,1,0,1,0,0,1,1,1,0,1,1,1,0,0,1,0,1,1,1,0,0,0,0,1,0,0,1,1,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,81,1,0,0,1,1,0,1,1,0,1,1,1,0,0,0,1,1,1,0,0,0,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,82,1,1,1,1,1,0,1,1,0,1,0,1,1,1,0,1,1,1,0,0,0,1,1,0,1,0,0,0,1,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,83,1,0,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,84,1,0,1,0,1,1,0,1,1,1,0,1,1,1,0,0,1,1,0,0,1,1,0,0,1,1,1,0,1,0,0,1,1,0,0,0,0,1,0,1,0,1,0,0,0,0,1,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,85,1,0,1,0,0,0,1,1,0,0,0,0,0,0,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,86,1,1,1,0,0,1,1,1,1,1,1,0,1,0,1,0,1,0,0,0,0,1,1,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,87,1,1,0,1,0,1,0,1,1,0,1,1,1,1,1,0,1,0,0,0,1,0,0,0,0,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,88,1,1,0,1,1,1,0,1,1,1,0,1,1,1,1,1,0,0,1,1,0,1,0,0,1,0,0,1,1,0,1,1,0,1,0,0,1,0,1,0,0,1,0,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,89,1,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,90,1,0,1,0,1,0,0,1,0,0,1,1,1,0,1,0,1,0,1,0,0,0,0,0,1,1,1,0,1,0,1,0,1,0,1,0,1,1,1,1,1,0,1,0,1,1,1,1,1,0,1,1,0,1,0,1,1,1,1,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,91,1,1,0,0,1,0,0,0,0,1,1,0,1,1,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,92,1,0,1,0,1,1,0,0,0,1,0,0,1,0,1,1,1,1,1,0,0,1,1,1,1,0,0,0,0,0,1,0,1,1,0,0,0,1,1,0,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,95,1,1,0,1,0,0,1,0,1,1,0,0,1,1,1,0,1,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,96,1,0,1,1,1,0,1,1,1,1,0,1,0,1,1,1,1,0,1,1,1,1,0,1,1,0,0,0,1,0,0,0,1,1,0,0,0,1,0,0,1,0,0,0,1,0,1,0,0,0,1,0,0,0,1,0,0,0,0,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,97,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,98,1,1,0,1,0,0,1,0,1,0,1,1,0,0,1,1,0,0,1,0,0,0,1,0,0,0,1,1,1,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,1,0,1,0,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,100,1,0,0,1,0,1,1,0,1,1,0,1,0,0,0,1,1,0,0,1,1,0,1,0,1,1,0,1,0,0,1,1,0,0,1,1,1,1,0,0,0,1,0,1,1,1,1,1,1,0,0,0,1,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,101,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,102,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1,1,1,0,1,1,0,1,0,0,0,0,0,0,1,0,1,0,1,0,0,1,1,0,1,0,1,0,1,1,0,1,1,1,1,1,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,103,1,0,1,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,107,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,108,1,0,1,1,0,0,0,1,1,1,1,1,0,0,0,1,0,0,1,0,1,0,0,1,1,0,1,0,0,1,1,1,1,1,1,1,0,1,1,0,0,0,1,1,1,1,1,1,0,0,1,0,0,0,1,0,0,1,0,1,0,1,1,1,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,109,1,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,110,1,1,1,0,0,0,1,0,0,0,1,1,0,1,1,0,0,1,0,0,1,0,0,0,0,1,1,0,1,1,0,0,0,1,0,1,1,1,0,1,0,0,1,1,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,0,1,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,113,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,114,1,0,0,1,0,0,0,1,0,1,0,1,0,1,0,1,1,0,1,0,1,1,0,0,0,1,1,1,1,0,1,1,0,0,1,1,1,1,0,0,1,0,1,0,0,0,0,1,0,0,1,0,1,0,1,1,1,1,0,0,1,0,1,1,1,1,0,0,1,1,1,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,115,1,1,0,0,1,0,1,1,0,1,1,1,1,1,1,1,0,1,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,119,1,1,1,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,120,1,0,1,1,1,1,0,1,0,0,0,0,1,1,1,0,1,1,0,0,0,0,0,0,0,1,0,0,1,1,1,1,0,0,1,0,1,0,1,0,1,1,1,0,1,1,1,1,1,0,1,1,1,0,0,0,1,0,1,0,1,0,0,0,0,1,0,1,1,0,0,1,0,1,0,1,0,0,0,1,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,121,1,0,1,0,0,0,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,125,1,0,0,1,0,1,1,0,0,1,1,1,1,1,0,1,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,126,1,1,0,0,0,1,1,0,1,0,1,1,0,1,0,1,1,1,0,1,1,0,1,0,1,1,0,0,1,0,0,0,0,0,0,0,1,1,0,1,1,1,1,1,1,1,0,1,0,0,0,1,1,0,0,0,1,1,0,1,1,0,1,0,1,0,0,0,1,0,1,1,0,0,1,0,0,1,0,1,0,1,0,0,0,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,127,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,131,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,132,1,0,0,0,1,1,0,1,0,1,1,0,0,0,0,0,1,0,1,0,1,0,0,1,1,0,1,1,0,0,1,0,0,0,0,1,0,1,1,1,0,1,0,1,1,0,0,0,0,0,1,1,1,0,0,0,0,1,0,0,1,0,0,1,0,1,0,0,0,1,1,1,0,0,0,0,0,1,0,0,1,0,0,0,1,1,0,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,133,1,0,0,0,0,1,1,0,1,0,0,1,0,1,0,1,1,1,0,1,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,137,1,0,1,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,139,1,1,1,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,143,1,1,1,0,1,0,0,1,0,0,0,1,1,0,1,0,1,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,149,1,1,0,1,1,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,150,1,1,0,1,0,1,1,0,1,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,0,1,1,1,1,0,0,1,0,0,1,1,1,0,0,0,0,1,0,0,0,1,0,1,0,0,1,1,1,1,1,1,0,1,1,1,1,0,1,0,1,1,1,1,0,0,0,0,0,1,0,1,1,0,0,1,1,1,1,0,0,1,0,1,1,0,1,1,1,1,0,0,0,0,1,1,1,1,0,1,0,1,1,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,151,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,157,1,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,163,1,0,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,167,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,169,1,0,0,1,0,1,1,0,1,1,0,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,173,1,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,179,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,181,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,191,1,1,0,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,193,1,1,1,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,197,1,1,1,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,199,1,0,1,1,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,211,1,1,0,1,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,223,1,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,227,1,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,229,1,1,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,233,1,0,1,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,239,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,241,1,0,0,1,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,251,1,0,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,257,1,0,1,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,263,1,1,1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,269,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,271,1,1,1,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,277,1,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,281,1,1,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,283,1,1,1,0,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,289,1,1,1,1,0,0,1,1,1,0,1,0,1,1,1,0,1,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,293,1,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,307,1,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,311,1,0,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,313,1,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,317,1,0,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,331,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,337,1,1,1,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,347,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,349,1,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,353,1,0,0,0,1,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,359,1,1,1,0,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,361,1,1,0,0,1,0,1,0,1,0,1,1,1,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,367,1,1,0,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,373,1,0,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,379,1,1,0,1,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,383,1,1,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,389,1,1,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,397,1,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,401,1,1,0,1,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+2,409,1,0,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,1,1,1,
+3,2,2,2,1,
+3,3,1,2,0,1,
+3,4,2,0,0,2,1,
+3,5,1,2,0,0,0,1,
+3,6,2,2,1,0,2,0,1,
+3,7,1,0,2,0,0,0,0,1,
+3,8,2,2,2,0,1,2,0,0,1,
+3,9,1,1,2,2,0,0,0,0,0,1,
+3,10,2,1,0,0,2,2,2,0,0,0,1,
+3,11,1,0,2,0,0,0,0,0,0,0,0,1,
+3,12,2,0,1,0,1,1,1,0,0,0,0,0,1,
+3,13,1,2,0,0,0,0,0,0,0,0,0,0,0,1,
+3,14,2,0,1,2,0,1,2,1,1,2,0,0,0,0,1,
+3,15,1,1,2,0,0,1,0,0,2,0,0,0,0,0,0,1,
+3,16,2,1,2,2,2,0,2,2,0,0,0,0,0,0,0,0,1,
+3,17,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,18,2,0,2,0,2,1,2,0,2,0,1,0,0,0,0,0,0,0,1,
+3,19,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,20,2,1,0,2,2,2,0,0,1,1,1,1,0,2,0,0,0,0,0,0,1,
+3,21,1,2,0,2,0,1,2,0,2,0,2,0,0,0,0,0,0,0,0,0,0,1,
+3,22,2,2,0,1,0,1,1,1,2,2,1,2,0,0,0,0,0,0,0,0,0,0,1,
+3,23,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,24,2,2,0,2,2,0,2,0,2,0,0,2,0,0,1,0,0,0,0,0,0,0,0,0,1,
+3,25,1,2,1,1,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,26,2,1,2,1,0,0,2,2,2,2,2,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,27,1,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,28,2,0,0,1,2,0,2,0,1,1,1,2,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,29,1,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,30,2,2,2,1,2,2,1,2,0,2,2,2,0,2,1,0,2,2,2,0,2,0,0,0,0,0,0,0,0,0,1,
+3,31,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,32,2,1,0,1,2,1,2,0,0,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,33,1,0,2,1,2,2,1,0,0,1,0,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,34,2,0,0,0,2,0,2,1,0,2,0,1,2,0,2,0,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,35,1,1,2,0,2,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,36,2,1,1,1,0,2,2,0,2,1,2,2,0,2,2,0,1,1,0,0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,37,1,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,38,2,2,0,1,2,2,2,0,2,2,1,0,2,2,2,2,1,0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,39,1,0,2,0,1,0,1,2,0,1,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,40,2,0,1,2,1,1,2,2,1,0,1,2,0,2,0,1,1,2,0,1,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,41,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,42,2,2,0,2,0,1,0,0,2,1,0,2,1,1,2,1,2,1,1,1,0,0,2,1,0,2,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,43,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,44,2,0,1,1,2,2,1,1,0,0,1,0,1,0,2,2,0,1,1,0,2,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,45,1,0,0,1,1,2,0,1,2,2,0,1,2,0,1,1,2,2,2,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,46,2,0,1,2,2,1,0,1,0,2,1,0,0,1,2,2,0,2,0,1,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,47,1,2,2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,48,2,0,1,2,1,0,2,0,2,0,2,2,0,2,1,0,0,1,1,1,1,2,1,0,2,0,2,2,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,49,1,1,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,50,2,2,1,0,0,1,0,1,0,1,1,2,2,1,0,2,0,1,1,0,0,1,1,2,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,51,1,2,2,2,1,0,2,2,2,0,2,0,1,0,0,0,2,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,52,2,0,1,1,1,2,0,1,2,0,0,0,1,0,2,0,2,2,2,1,2,0,2,1,0,0,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,53,1,0,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,54,2,1,1,1,2,0,1,2,0,1,0,1,1,0,0,0,0,1,1,2,1,0,2,2,2,2,0,2,1,1,1,0,2,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,55,1,0,0,1,1,2,1,0,1,0,1,2,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,56,2,2,0,0,0,1,0,2,0,0,0,0,2,1,1,0,0,1,2,2,2,2,0,2,2,1,2,2,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,57,1,1,2,2,2,2,1,0,1,1,0,2,1,0,2,2,2,1,0,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,59,1,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,60,2,0,2,2,2,1,2,0,2,0,1,2,0,0,1,2,2,0,0,0,1,1,2,0,2,0,2,2,2,0,1,0,1,2,1,1,2,0,2,2,1,2,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,61,1,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,65,1,1,0,2,2,0,0,2,2,1,1,2,2,0,2,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,66,2,2,2,1,0,2,0,2,1,2,0,2,0,0,2,0,2,2,1,0,0,0,1,0,1,0,1,2,0,1,1,2,1,0,0,1,2,0,1,2,1,2,0,2,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,67,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,71,1,2,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,72,2,2,0,2,1,1,1,2,1,0,2,1,2,1,0,1,0,2,1,1,0,2,1,2,1,2,0,2,0,1,1,1,2,2,1,0,2,2,1,1,0,0,1,2,0,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,73,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,77,1,2,1,1,0,1,2,2,2,0,0,2,2,0,0,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,79,1,2,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,83,1,2,2,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,85,1,0,1,1,0,1,2,1,1,0,0,0,0,1,2,2,2,2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,89,1,0,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,91,1,1,2,1,2,1,1,0,1,2,2,0,0,2,2,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,97,1,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,101,1,0,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,103,1,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,107,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,109,1,0,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,113,1,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,121,1,2,1,2,2,1,1,0,2,2,0,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,127,1,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,131,1,0,1,2,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,137,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,139,1,1,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,149,1,2,2,1,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,151,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,157,1,2,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,163,1,0,1,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,167,1,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,169,1,2,0,0,2,1,0,0,0,2,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,173,1,1,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,179,1,2,0,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,181,1,1,2,0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,191,1,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,193,1,2,0,2,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,197,1,1,1,2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,199,1,0,0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,211,1,2,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,223,1,2,2,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,227,1,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,229,1,0,2,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,233,1,2,2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,239,1,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,241,1,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,251,1,2,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,257,1,0,2,1,0,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+3,263,1,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,1,3,1,
+5,2,2,4,1,
+5,3,3,3,0,1,
+5,4,2,4,4,0,1,
+5,5,3,4,0,0,0,1,
+5,6,2,0,1,4,1,0,1,
+5,7,3,3,0,0,0,0,0,1,
+5,8,2,4,3,0,1,0,0,0,1,
+5,9,3,1,0,2,0,0,0,0,0,1,
+5,10,2,1,4,2,3,3,0,0,0,0,1,
+5,11,3,3,0,0,0,0,0,0,0,0,0,1,
+5,12,2,2,3,4,4,0,1,1,0,0,0,0,1,
+5,13,3,3,4,0,0,0,0,0,0,0,0,0,0,1,
+5,14,2,1,0,3,2,4,4,0,1,0,0,0,0,0,1,
+5,15,3,4,3,3,0,2,0,0,0,0,0,0,0,0,0,1,
+5,16,2,1,4,4,2,4,4,4,1,0,0,0,0,0,0,0,1,
+5,17,3,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,18,2,0,2,2,0,1,2,0,2,1,1,1,1,0,0,0,0,0,1,
+5,19,3,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,20,2,1,0,4,0,0,3,0,2,3,4,0,3,0,0,0,0,0,0,0,1,
+5,21,3,2,2,1,2,2,2,4,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,22,2,3,3,4,0,2,2,0,3,4,0,3,1,0,0,0,0,0,0,0,0,0,1,
+5,23,3,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,24,2,1,3,3,2,0,4,2,4,0,3,1,2,4,0,4,2,0,0,0,0,0,0,0,1,
+5,25,3,4,2,4,0,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,26,2,3,4,3,1,1,3,3,2,1,4,0,2,2,0,4,0,0,0,0,0,0,0,0,0,0,1,
+5,27,3,3,0,4,3,2,0,3,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,28,2,4,2,3,0,2,0,2,3,2,4,2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,29,3,1,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,30,2,1,1,0,1,4,3,4,2,2,0,2,3,4,4,0,4,4,0,3,0,4,0,0,0,0,0,0,0,0,1,
+5,31,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,33,3,0,1,3,3,0,3,2,4,1,3,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,35,3,2,0,2,1,3,2,0,0,4,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,36,2,1,3,1,0,4,0,2,2,0,3,0,4,1,2,3,3,1,0,2,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,1,
+5,37,3,3,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,39,3,2,1,0,2,3,0,4,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,41,3,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,42,2,1,2,0,2,3,3,0,1,4,2,4,2,4,2,3,3,0,0,3,0,1,0,3,3,4,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,43,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,47,3,0,4,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,49,3,2,2,4,0,1,0,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,53,3,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,55,3,0,4,0,0,2,1,2,2,3,1,3,4,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,59,3,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,61,3,4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,67,3,1,0,3,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,71,3,3,3,3,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,73,3,2,4,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,79,3,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,83,3,1,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,89,3,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,97,3,2,4,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,101,3,4,4,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,103,3,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,107,3,1,3,4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,109,3,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,113,3,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,121,3,2,2,2,3,1,4,3,2,3,1,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,127,3,1,3,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,131,3,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,137,3,2,2,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,139,3,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,149,3,4,1,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,151,3,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,157,3,3,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,163,3,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,167,3,3,2,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,173,3,3,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,179,3,2,4,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,181,3,3,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,191,3,4,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,193,3,4,2,4,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,197,3,4,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,199,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,211,3,0,3,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,223,3,4,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,227,3,1,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,229,3,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,233,3,4,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,239,3,1,4,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,241,3,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+5,251,3,1,4,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,1,4,1,
+7,2,3,6,1,
+7,3,4,0,6,1,
+7,4,3,4,5,0,1,
+7,5,4,1,0,0,0,1,
+7,6,3,6,4,5,1,0,1,
+7,7,4,6,0,0,0,0,0,1,
+7,8,3,2,6,4,0,0,0,0,1,
+7,9,4,6,0,1,6,0,0,0,0,1,
+7,10,3,3,2,1,4,1,1,0,0,0,1,
+7,11,4,1,0,0,0,0,0,0,0,0,0,1,
+7,12,3,0,5,0,4,2,3,5,2,0,0,0,1,
+7,13,4,0,6,0,0,0,0,0,0,0,0,0,0,1,
+7,14,3,6,3,0,2,6,0,5,0,0,0,0,0,0,1,
+7,15,4,2,1,4,6,6,5,0,0,0,0,0,0,0,0,1,
+7,16,3,4,2,6,1,4,3,5,4,0,0,0,0,0,0,0,1,
+7,17,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,18,3,2,6,0,0,3,1,5,6,1,6,2,1,0,0,0,0,0,1,
+7,19,4,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,20,3,1,0,3,0,3,1,3,2,5,2,6,1,0,0,0,0,0,0,0,1,
+7,21,4,4,0,6,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,22,3,4,5,5,6,4,3,2,5,3,5,6,1,0,0,0,0,0,0,0,0,0,1,
+7,23,4,4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,24,3,3,4,6,2,2,5,4,3,0,1,2,1,5,5,6,0,0,0,0,0,0,0,0,1,
+7,25,4,2,1,0,5,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,26,3,5,5,0,2,0,1,4,6,1,6,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,27,4,0,5,5,4,2,6,4,5,1,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,28,3,1,0,5,1,3,6,4,2,2,6,2,6,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,29,4,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,30,3,2,5,1,0,3,2,4,2,3,3,2,5,6,3,2,1,0,4,1,4,4,1,0,0,0,0,0,0,0,1,
+7,31,4,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,35,4,4,0,3,1,3,5,5,6,5,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,36,3,1,1,3,3,6,0,6,3,3,6,2,3,3,0,4,1,6,6,2,2,5,4,3,1,0,0,0,0,0,0,0,0,0,0,0,1,
+7,37,4,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,41,4,1,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,42,3,5,2,3,0,1,0,3,1,6,0,5,1,0,2,5,2,4,3,2,6,6,2,4,1,5,0,6,1,3,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,43,4,2,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,47,4,3,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,49,4,1,2,1,5,4,3,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,53,4,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,59,4,3,6,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,61,4,5,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,67,4,4,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,71,4,1,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,73,4,2,6,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,79,4,2,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,83,4,6,6,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,89,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,97,4,5,6,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,101,4,4,1,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,103,4,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,107,4,4,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,109,4,1,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,113,4,5,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,127,4,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,131,4,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,137,4,2,3,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,139,4,4,6,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,149,4,1,6,2,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,151,4,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,157,4,0,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,163,4,2,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,167,4,1,5,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,173,4,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,179,4,3,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,181,4,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,191,4,2,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,193,4,4,6,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,197,4,4,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,199,4,4,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,223,4,4,5,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,227,4,6,5,3,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,229,4,3,1,4,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,241,4,3,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+7,251,4,3,4,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,1,9,1,
+11,2,2,7,1,
+11,3,9,2,0,1,
+11,4,2,10,8,0,1,
+11,5,9,0,10,0,0,1,
+11,6,2,7,6,4,3,0,1,
+11,7,9,4,0,0,0,0,0,1,
+11,8,2,7,1,7,7,0,0,0,1,
+11,9,9,8,9,0,0,0,0,0,0,1,
+11,10,2,6,6,10,8,7,0,0,0,0,1,
+11,11,9,10,0,0,0,0,0,0,0,0,0,1,
+11,12,2,5,6,5,5,2,4,1,1,0,0,0,1,
+11,13,9,7,0,0,0,0,0,0,0,0,0,0,0,1,
+11,14,2,10,6,8,4,6,9,2,0,0,0,0,0,0,1,
+11,15,9,0,0,5,0,7,10,0,0,0,0,0,0,0,0,1,
+11,16,2,9,10,3,5,3,1,10,1,0,0,0,0,0,0,0,1,
+11,17,9,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,18,2,2,8,9,3,0,1,9,3,8,10,8,3,0,0,0,0,0,1,
+11,19,9,2,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,20,2,5,6,5,5,4,2,7,5,1,9,10,1,0,0,0,0,0,0,0,1,
+11,21,9,2,10,7,10,1,7,6,9,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,22,2,4,3,6,10,10,8,4,10,4,1,10,1,0,0,0,0,0,0,0,0,0,1,
+11,23,9,1,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,24,2,9,6,5,5,1,4,7,2,5,1,9,9,3,0,9,0,0,0,0,0,0,0,0,1,
+11,25,9,4,10,0,4,9,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,27,9,5,8,3,5,7,8,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,29,9,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,30,2,3,3,0,8,10,2,1,6,0,6,9,1,10,5,0,7,8,8,2,0,10,0,0,0,0,0,0,0,0,1,
+11,31,9,6,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,35,9,3,9,8,6,9,3,2,4,4,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,37,9,4,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,41,9,6,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,43,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,47,9,7,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,49,9,0,8,5,7,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,53,9,1,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,59,9,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,61,9,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,67,9,10,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,71,9,10,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,73,9,7,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,79,9,9,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,83,9,1,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,89,9,1,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,97,9,3,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,101,9,5,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,103,9,1,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,107,9,10,6,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,109,9,4,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,113,9,5,10,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,127,9,7,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,131,9,8,10,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,137,9,2,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,139,9,4,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,149,9,6,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,151,9,10,10,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,157,9,0,8,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,163,9,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,167,9,10,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,173,9,8,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,179,9,2,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,181,9,3,9,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,191,9,0,8,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,193,9,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,197,9,0,10,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,211,9,5,4,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+11,223,9,3,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,1,11,1,
+13,2,2,12,1,
+13,3,11,2,0,1,
+13,4,2,12,3,0,1,
+13,5,11,4,0,0,0,1,
+13,6,2,11,11,10,0,0,1,
+13,7,11,3,0,0,0,0,0,1,
+13,8,2,3,2,12,8,0,0,0,1,
+13,9,11,12,12,8,12,0,0,0,0,1,
+13,10,2,1,1,8,5,7,0,0,0,0,1,
+13,11,11,3,0,0,0,0,0,0,0,0,0,1,
+13,12,2,4,1,1,3,11,8,5,1,0,0,0,1,
+13,13,11,12,0,0,0,0,0,0,0,0,0,0,0,1,
+13,14,2,10,10,7,11,6,0,4,0,0,0,0,0,0,1,
+13,15,11,8,11,10,11,2,12,2,0,0,0,0,0,0,0,1,
+13,16,2,6,12,9,12,2,8,12,3,0,0,0,0,0,0,0,1,
+13,17,11,6,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,18,2,9,0,6,5,3,5,9,11,11,4,10,0,0,0,0,0,0,1,
+13,19,11,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,20,2,11,8,4,0,4,7,8,7,0,9,12,1,0,0,0,0,0,0,0,1,
+13,21,11,7,12,11,0,4,0,2,9,1,0,0,0,0,0,0,0,0,0,0,0,1,
+13,23,11,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,24,2,1,10,0,3,0,9,1,1,0,9,0,5,0,0,4,0,0,0,0,0,0,0,0,1,
+13,25,11,1,0,5,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,27,11,8,7,9,6,7,5,3,5,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,29,11,4,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,30,2,0,2,4,4,4,5,4,12,4,9,5,4,6,7,11,3,11,10,1,0,0,2,0,0,0,0,0,0,0,1,
+13,31,11,2,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,37,11,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,41,11,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,43,11,8,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,47,11,6,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,49,11,7,3,5,3,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,53,11,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,59,11,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,61,11,8,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,67,11,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,71,11,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,73,11,7,8,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,79,11,9,10,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,83,11,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,89,11,7,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,97,11,4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,101,11,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,103,11,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,107,11,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,109,11,3,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,113,11,12,10,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,127,11,7,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,131,11,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,137,11,11,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,139,11,10,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,149,11,11,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,151,11,12,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,157,11,6,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,163,11,12,8,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,173,11,2,6,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,179,11,6,4,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+13,191,11,7,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,1,14,1,
+17,2,3,16,1,
+17,3,14,1,0,1,
+17,4,3,10,7,0,1,
+17,5,14,1,0,0,0,1,
+17,6,3,3,10,0,2,0,1,
+17,7,14,12,0,0,0,0,0,1,
+17,8,3,6,0,12,11,0,0,0,1,
+17,9,14,8,7,0,0,0,0,0,0,1,
+17,10,3,12,9,5,6,13,0,0,0,0,1,
+17,11,14,5,0,0,0,0,0,0,0,0,0,1,
+17,12,3,9,14,6,13,14,14,4,1,0,0,0,1,
+17,13,14,15,0,0,0,0,0,0,0,0,0,0,0,1,
+17,14,3,3,9,13,16,8,1,11,1,0,0,0,0,0,1,
+17,15,14,14,14,6,16,4,4,0,0,0,0,0,0,0,0,1,
+17,16,3,1,12,13,12,2,5,13,1,0,0,0,0,0,0,0,1,
+17,17,14,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,18,3,9,13,13,11,9,0,1,7,16,9,0,1,0,0,0,0,0,1,
+17,19,14,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,20,3,5,2,13,1,9,14,3,13,14,16,5,1,0,0,0,0,0,0,0,1,
+17,21,14,3,6,6,0,16,12,9,10,1,0,0,0,0,0,0,0,0,0,0,0,1,
+17,23,14,16,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,24,3,14,14,6,6,14,7,15,8,2,3,2,2,6,6,3,1,0,0,0,0,0,0,0,1,
+17,25,14,9,6,13,15,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,27,14,4,6,7,6,10,7,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,29,14,11,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,30,3,14,8,0,6,12,5,12,15,1,8,16,15,14,8,13,13,3,12,0,9,14,0,0,0,0,0,0,0,0,1,
+17,31,14,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,37,14,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,41,14,1,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,43,14,11,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,47,14,8,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,49,14,13,14,15,1,7,9,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,53,14,2,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,59,14,1,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,61,14,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,67,14,11,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,71,14,15,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,73,14,14,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,79,14,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,83,14,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,89,14,3,11,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,97,14,10,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,101,14,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,103,14,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,107,14,8,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,113,14,15,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,127,14,9,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,131,14,9,13,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,157,14,16,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,163,14,3,11,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,179,14,5,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+17,191,14,7,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,1,17,1,
+19,2,2,18,1,
+19,3,17,4,0,1,
+19,4,2,11,2,0,1,
+19,5,17,5,0,0,0,1,
+19,6,2,6,17,17,0,0,1,
+19,7,17,6,0,0,0,0,0,1,
+19,8,2,3,10,12,1,0,0,0,1,
+19,9,17,16,14,11,0,0,0,0,0,1,
+19,10,2,4,3,17,13,18,0,0,0,0,1,
+19,11,17,8,0,0,0,0,0,0,0,0,0,1,
+19,12,2,7,16,9,2,18,2,3,0,0,0,0,1,
+19,13,17,11,0,0,0,0,0,0,0,0,0,0,0,1,
+19,14,2,7,16,5,1,11,11,11,0,0,0,0,0,0,1,
+19,15,17,0,14,15,13,11,10,1,0,0,0,0,0,0,0,1,
+19,16,2,14,6,9,15,0,13,12,0,0,0,0,0,0,0,0,1,
+19,17,17,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,18,2,14,3,7,5,16,0,5,17,7,9,10,0,0,0,0,0,0,1,
+19,19,17,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,20,2,11,6,3,0,6,8,7,4,0,13,16,0,0,0,0,0,0,0,0,1,
+19,21,17,16,12,7,10,1,12,15,12,1,0,0,0,0,0,0,0,0,0,0,0,1,
+19,23,17,13,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,24,2,8,17,8,5,12,6,0,9,15,15,6,14,0,4,6,0,0,0,0,0,0,0,0,1,
+19,25,17,12,1,14,8,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,29,17,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,30,2,14,14,16,6,16,14,14,13,2,9,5,4,13,0,18,0,16,11,10,15,13,1,0,0,0,0,0,0,0,1,
+19,31,17,5,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,37,17,1,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,41,17,1,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,43,17,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,47,17,6,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,49,17,11,0,15,7,11,10,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,53,17,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,59,17,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,61,17,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,67,17,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,71,17,14,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,73,17,2,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,79,17,7,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,83,17,11,14,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,89,17,4,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,97,17,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,101,17,2,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,103,17,3,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,107,17,8,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,109,17,6,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,113,17,18,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,127,17,7,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,131,17,1,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,137,17,3,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,139,17,11,18,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,149,17,4,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,151,17,4,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,157,17,14,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,167,17,14,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,181,17,1,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+19,199,17,9,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,1,18,1,
+23,2,5,21,1,
+23,3,18,2,0,1,
+23,4,5,19,3,0,1,
+23,5,18,3,0,0,0,1,
+23,6,5,1,9,9,1,0,1,
+23,7,18,21,0,0,0,0,0,1,
+23,8,5,3,5,20,3,0,0,0,1,
+23,9,18,9,8,3,0,0,0,0,0,1,
+23,10,5,1,6,15,5,17,0,0,0,0,1,
+23,11,18,7,22,0,0,0,0,0,0,0,0,1,
+23,12,5,12,18,12,14,15,21,21,0,0,0,0,1,
+23,13,18,9,0,0,0,0,0,0,0,0,0,0,0,1,
+23,14,5,22,1,19,18,1,16,5,1,0,0,0,0,0,1,
+23,15,18,18,7,9,15,8,2,0,0,0,0,0,0,0,0,1,
+23,16,5,17,14,1,13,16,19,19,0,0,0,0,0,0,0,0,1,
+23,17,18,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,18,5,19,3,11,0,21,16,3,18,1,2,18,1,0,0,0,0,0,1,
+23,19,18,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,23,18,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,25,18,4,13,5,11,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,29,18,5,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,31,18,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,37,18,3,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,41,18,7,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,43,18,6,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,47,18,2,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,53,18,6,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,59,18,1,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,61,18,17,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,67,18,7,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,71,18,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,73,18,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,79,18,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,83,18,17,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,89,18,3,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,97,18,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,103,18,18,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,107,18,7,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,127,18,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,137,18,10,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,151,18,3,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,163,18,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+23,179,18,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,1,27,1,
+29,2,2,24,1,
+29,3,27,2,0,1,
+29,4,2,15,2,0,1,
+29,5,27,3,0,0,0,1,
+29,6,2,13,17,25,1,0,1,
+29,7,27,2,0,0,0,0,0,1,
+29,8,2,23,26,24,3,0,0,0,1,
+29,9,27,22,22,4,0,0,0,0,0,1,
+29,10,2,22,2,17,8,25,1,0,0,0,1,
+29,11,27,8,28,0,0,0,0,0,0,0,0,1,
+29,12,2,1,1,25,16,9,28,19,3,0,0,0,1,
+29,13,27,7,0,0,0,0,0,0,0,0,0,0,0,1,
+29,14,2,5,27,18,21,10,14,3,1,0,0,0,0,0,1,
+29,15,27,26,12,1,8,14,13,0,0,0,0,0,0,0,0,1,
+29,16,2,10,27,1,23,18,2,27,6,0,0,0,0,0,0,0,1,
+29,17,27,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,18,2,14,19,16,8,10,2,26,6,1,1,24,0,0,0,0,0,0,1,
+29,19,27,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,23,27,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,25,27,0,21,9,28,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,29,27,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,31,27,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,37,27,21,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,41,27,5,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,43,27,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,47,27,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,53,27,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,59,27,6,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,61,27,23,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,67,27,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,71,27,19,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,73,27,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,79,27,23,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,83,27,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,89,27,28,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,97,27,20,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,103,27,21,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,107,27,14,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,109,27,24,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,131,27,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,137,27,24,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,139,27,22,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,151,27,13,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+29,157,27,4,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,1,28,1,
+31,2,3,29,1,
+31,3,28,1,0,1,
+31,4,3,16,3,0,1,
+31,5,28,7,0,0,0,1,
+31,6,3,8,16,19,0,0,1,
+31,7,28,1,0,0,0,0,0,1,
+31,8,3,24,12,25,0,0,0,0,1,
+31,9,28,29,20,4,0,0,0,0,0,1,
+31,10,3,13,13,13,26,30,0,0,0,0,1,
+31,11,28,20,0,0,0,0,0,0,0,0,0,1,
+31,12,3,12,25,9,2,28,14,4,0,0,0,0,1,
+31,13,28,6,0,0,0,0,0,0,0,0,0,0,0,1,
+31,14,3,6,18,18,1,1,5,10,0,0,0,0,0,0,1,
+31,15,28,25,23,13,12,29,30,0,0,0,0,0,0,0,0,1,
+31,16,3,27,19,11,28,26,24,28,0,0,0,0,0,0,0,0,1,
+31,17,28,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,18,3,6,10,25,25,11,12,7,2,24,5,27,1,0,0,0,0,0,1,
+31,19,28,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,23,28,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,25,28,15,0,17,18,3,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,29,28,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,31,28,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,37,28,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,41,28,1,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,43,28,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,47,28,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,53,28,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,59,28,26,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,61,28,6,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,67,28,13,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,71,28,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,73,28,26,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,79,28,15,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,83,28,11,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,89,28,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,101,28,30,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,103,28,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,107,28,15,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,109,28,16,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,113,28,25,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,137,28,17,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+31,139,28,1,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,1,35,1,
+37,2,2,33,1,
+37,3,35,6,0,1,
+37,4,2,24,6,0,1,
+37,5,35,10,0,0,0,1,
+37,6,2,30,4,35,0,0,1,
+37,7,35,7,0,0,0,0,0,1,
+37,8,2,1,27,20,7,0,0,0,1,
+37,9,35,32,20,6,0,0,0,0,0,1,
+37,10,2,4,11,18,29,8,0,0,0,0,1,
+37,11,35,2,0,0,0,0,0,0,0,0,0,1,
+37,12,2,33,18,23,23,10,31,4,0,0,0,0,1,
+37,13,35,6,0,0,0,0,0,0,0,0,0,0,0,1,
+37,14,2,9,1,16,32,1,35,35,4,0,0,0,0,0,1,
+37,15,35,33,34,13,27,28,31,1,0,0,0,0,0,0,0,1,
+37,17,35,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,18,2,20,27,14,32,12,20,22,1,15,19,8,1,0,0,0,0,0,1,
+37,19,35,23,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,23,35,22,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,25,35,10,24,33,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,29,35,13,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,31,35,33,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,37,35,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,41,35,22,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,43,35,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,47,35,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,49,35,25,0,35,23,11,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,53,35,27,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,59,35,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,61,35,29,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,67,35,16,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,71,35,2,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,73,35,7,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,79,35,23,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,83,35,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,97,35,29,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,107,35,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,151,35,17,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+37,157,35,1,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,1,35,1,
+41,2,6,38,1,
+41,3,35,1,0,1,
+41,4,6,23,0,0,1,
+41,5,35,14,40,0,0,1,
+41,6,6,6,39,33,4,0,1,
+41,7,35,6,0,0,0,0,0,1,
+41,8,6,6,20,32,5,0,0,0,1,
+41,9,35,5,31,4,0,0,0,0,0,1,
+41,10,6,30,20,8,31,3,0,0,0,0,1,
+41,11,35,20,0,0,0,0,0,0,0,0,0,1,
+41,12,6,27,21,24,34,13,26,0,0,0,0,0,1,
+41,13,35,13,0,0,0,0,0,0,0,0,0,0,0,1,
+41,14,6,10,39,11,27,4,15,12,0,0,0,0,0,0,1,
+41,15,35,21,10,35,2,16,29,0,0,0,0,0,0,0,0,1,
+41,17,35,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,18,6,6,10,29,12,24,38,35,23,20,7,1,0,0,0,0,0,0,1,
+41,19,35,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,23,35,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,25,35,38,21,27,40,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,29,35,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,31,35,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,37,35,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,41,35,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,43,35,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,47,35,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,53,35,21,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,59,35,12,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,61,35,11,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,67,35,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,71,35,2,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,73,35,12,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,79,35,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,83,35,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,89,35,4,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,97,35,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,113,35,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,149,35,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,151,35,25,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+41,157,35,8,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,1,40,1,
+43,2,3,42,1,
+43,3,40,1,0,1,
+43,4,3,42,5,0,1,
+43,5,40,8,0,0,0,1,
+43,6,3,21,28,19,0,0,1,
+43,7,40,7,42,0,0,0,0,1,
+43,8,3,24,20,39,1,0,0,0,1,
+43,9,40,1,39,12,0,0,0,0,0,1,
+43,10,3,24,27,5,36,26,3,0,0,0,1,
+43,11,40,7,0,0,0,0,0,0,0,0,0,1,
+43,12,3,38,23,6,17,16,27,34,0,0,0,0,1,
+43,13,40,4,0,0,0,0,0,0,0,0,0,0,0,1,
+43,14,3,19,4,18,37,24,22,38,0,0,0,0,0,0,1,
+43,15,40,37,15,4,42,22,37,2,0,0,0,0,0,0,0,1,
+43,17,40,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,18,3,18,37,34,16,29,24,7,24,41,28,3,1,0,0,0,0,0,1,
+43,19,40,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,23,40,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,25,40,2,25,19,13,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,29,40,8,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,31,40,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,37,40,13,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,41,40,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,43,40,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,47,40,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,53,40,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,59,40,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,61,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,67,40,27,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,71,40,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,73,40,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,79,40,14,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,83,40,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,89,40,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,97,40,24,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,107,40,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,109,40,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+43,131,40,18,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,1,42,1,
+47,2,5,45,1,
+47,3,42,3,0,1,
+47,4,5,40,8,0,1,
+47,5,42,1,0,0,0,1,
+47,6,5,41,9,35,2,0,1,
+47,7,42,12,0,0,0,0,0,1,
+47,8,5,3,19,29,1,0,0,0,1,
+47,9,42,1,19,1,0,0,0,0,0,1,
+47,10,5,45,45,18,14,42,1,0,0,0,1,
+47,11,42,6,0,0,0,0,0,0,0,0,0,1,
+47,12,5,9,14,46,12,35,40,46,0,0,0,0,1,
+47,13,42,5,0,0,0,0,0,0,0,0,0,0,0,1,
+47,14,5,32,9,24,17,30,20,36,0,0,0,0,0,0,1,
+47,15,42,17,13,42,14,31,43,0,0,0,0,0,0,0,0,1,
+47,17,42,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,18,5,33,45,5,11,22,24,44,26,42,41,6,0,0,0,0,0,0,1,
+47,19,42,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,23,42,14,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,25,42,27,43,12,46,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,29,42,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,31,42,10,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,37,42,34,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,41,42,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,43,42,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,47,42,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,53,42,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,59,42,18,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,61,42,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,67,42,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,71,42,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,73,42,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,79,42,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,83,42,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,97,42,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,101,42,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,107,42,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+47,127,42,41,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,1,51,1,
+53,2,2,49,1,
+53,3,51,3,0,1,
+53,4,2,38,9,0,1,
+53,5,51,3,0,0,0,1,
+53,6,2,45,4,7,1,0,1,
+53,7,51,9,0,0,0,0,0,1,
+53,8,2,1,18,29,8,0,0,0,1,
+53,9,51,5,13,0,0,0,0,0,0,1,
+53,10,2,29,15,27,1,0,1,0,0,0,1,
+53,11,51,15,0,0,0,0,0,0,0,0,0,1,
+53,12,2,41,34,42,10,13,4,34,2,0,0,0,1,
+53,13,51,28,52,0,0,0,0,0,0,0,0,0,0,1,
+53,14,2,23,12,37,0,52,23,45,1,0,0,0,0,0,1,
+53,15,51,4,20,11,15,31,22,0,0,0,0,0,0,0,0,1,
+53,17,51,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,18,2,11,16,8,6,44,39,0,27,51,31,52,0,0,0,0,0,0,1,
+53,19,51,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,23,51,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,25,51,11,27,21,12,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,29,51,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,31,51,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,37,51,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,41,51,50,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,43,51,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,47,51,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,53,51,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,59,51,23,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,61,51,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,67,51,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,71,51,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,73,51,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,79,51,26,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,83,51,38,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,97,51,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,101,51,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,107,51,49,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,113,51,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+53,127,51,25,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,1,57,1,
+59,2,2,58,1,
+59,3,57,5,0,1,
+59,4,2,40,2,0,1,
+59,5,57,8,0,0,0,1,
+59,6,2,0,38,18,2,0,1,
+59,7,57,10,0,0,0,0,0,1,
+59,8,2,50,2,32,16,0,0,0,1,
+59,9,57,47,32,1,0,0,0,0,0,1,
+59,10,2,15,39,4,25,28,1,0,0,0,1,
+59,11,57,6,0,0,0,0,0,0,0,0,0,1,
+59,12,2,1,8,38,21,51,25,39,0,0,0,0,1,
+59,13,57,3,0,0,0,0,0,0,0,0,0,0,0,1,
+59,14,2,26,32,25,13,11,51,33,1,0,0,0,0,0,1,
+59,15,57,58,39,13,23,24,57,0,0,0,0,0,0,0,0,1,
+59,17,57,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,18,2,32,34,47,16,44,7,14,11,27,38,37,1,0,0,0,0,0,1,
+59,19,57,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,23,57,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,25,57,6,45,56,33,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,29,57,9,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,31,57,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,37,57,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,41,57,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,43,57,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,47,57,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,53,57,14,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,59,57,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,61,57,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,67,57,49,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,71,57,22,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,73,57,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,79,57,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,83,57,47,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,89,57,15,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+59,107,57,34,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,1,59,1,
+61,2,2,60,1,
+61,3,59,7,0,1,
+61,4,2,40,3,0,1,
+61,5,59,12,0,0,0,1,
+61,6,2,29,3,49,0,0,1,
+61,7,59,2,0,0,0,0,0,1,
+61,8,2,56,1,57,0,0,0,0,1,
+61,9,59,18,50,9,0,0,0,0,0,1,
+61,10,2,6,16,44,15,28,0,0,0,0,1,
+61,11,59,18,0,0,0,0,0,0,0,0,0,1,
+61,12,2,15,1,14,38,8,33,42,2,0,0,0,1,
+61,13,59,3,0,0,0,0,0,0,0,0,0,0,0,1,
+61,14,2,48,54,30,8,11,26,48,1,0,0,0,0,0,1,
+61,15,59,51,23,25,44,35,39,0,0,0,0,0,0,0,0,1,
+61,17,59,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,18,2,52,25,25,42,57,32,4,36,13,36,35,3,0,0,0,0,0,1,
+61,19,59,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,23,59,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,25,59,28,25,43,58,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,29,59,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,31,59,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,37,59,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,41,59,35,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,43,59,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,47,59,20,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,53,59,39,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,59,59,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,61,59,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,67,59,44,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,71,59,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,73,59,51,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,89,59,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,101,59,31,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,107,59,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,109,59,52,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+61,139,59,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,1,65,1,
+67,2,2,63,1,
+67,3,65,6,0,1,
+67,4,2,54,8,0,1,
+67,5,65,2,0,0,0,1,
+67,6,2,55,49,63,0,0,1,
+67,7,65,7,0,0,0,0,0,1,
+67,8,2,64,17,46,3,0,0,0,1,
+67,9,65,55,49,25,0,0,0,0,0,1,
+67,10,2,23,7,16,0,21,2,0,0,0,1,
+67,11,65,9,66,0,0,0,0,0,0,0,0,1,
+67,12,2,27,21,64,55,4,27,57,3,0,0,0,1,
+67,13,65,22,0,0,0,0,0,0,0,0,0,0,0,1,
+67,14,2,37,1,0,56,5,22,17,0,0,0,0,0,0,1,
+67,15,65,46,21,20,41,52,1,1,0,0,0,0,0,0,0,1,
+67,17,65,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,18,2,13,59,6,51,29,28,55,33,18,52,63,1,0,0,0,0,0,1,
+67,19,65,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,23,65,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,25,65,3,11,51,21,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,29,65,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,31,65,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,37,65,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,41,65,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,43,65,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,47,65,26,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,53,65,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,59,65,42,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,61,65,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,67,65,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,71,65,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,73,65,23,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,79,65,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,89,65,47,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+67,103,65,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,1,64,1,
+71,2,7,69,1,
+71,3,64,4,0,1,
+71,4,7,41,4,0,1,
+71,5,64,18,0,0,0,1,
+71,6,7,29,13,10,1,0,1,
+71,7,64,2,0,0,0,0,0,1,
+71,8,7,19,22,53,0,0,0,0,1,
+71,9,64,62,43,4,0,0,0,0,0,1,
+71,10,7,40,1,26,17,53,0,0,0,0,1,
+71,11,64,48,0,0,0,0,0,0,0,0,0,1,
+71,12,7,23,58,21,55,29,28,12,0,0,0,0,1,
+71,13,64,27,0,0,0,0,0,0,0,0,0,0,0,1,
+71,15,64,49,67,52,18,32,28,0,0,0,0,0,0,0,0,1,
+71,17,64,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,19,64,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,23,64,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,25,64,7,30,65,69,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,29,64,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,31,64,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,37,64,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,41,64,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,43,64,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,47,64,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,53,64,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,59,64,50,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,61,64,24,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,67,64,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,71,64,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,73,64,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,79,64,33,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,83,64,26,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,97,64,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,107,64,48,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,109,64,6,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+71,131,64,8,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,1,68,1,
+73,2,5,70,1,
+73,3,68,2,0,1,
+73,4,5,56,16,0,1,
+73,5,68,9,0,0,0,1,
+73,6,5,48,23,45,0,0,1,
+73,7,68,10,0,0,0,0,0,1,
+73,8,5,18,39,53,3,0,0,0,1,
+73,9,68,15,72,0,0,0,0,0,0,1,
+73,10,5,69,32,33,23,15,2,0,0,0,1,
+73,11,68,5,0,0,0,0,0,0,0,0,0,1,
+73,12,5,25,29,46,20,26,52,69,1,0,0,0,1,
+73,13,68,7,0,0,0,0,0,0,0,0,0,0,0,1,
+73,15,68,62,57,57,33,10,0,0,0,0,0,0,0,0,0,1,
+73,17,68,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,19,68,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,23,68,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,25,68,46,20,21,27,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,29,68,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,31,68,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,37,68,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,41,68,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,43,68,22,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,47,68,1,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,53,68,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,59,68,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,61,68,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,67,68,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,71,68,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,73,68,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,89,68,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,101,68,40,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+73,107,68,64,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,1,76,1,
+79,2,3,78,1,
+79,3,76,9,0,1,
+79,4,3,66,2,0,1,
+79,5,76,5,0,0,0,1,
+79,6,3,68,28,19,0,0,1,
+79,7,76,4,0,0,0,0,0,1,
+79,8,3,48,59,60,0,0,0,0,1,
+79,9,76,19,57,0,0,0,0,0,0,1,
+79,10,3,42,30,1,51,44,4,0,0,0,1,
+79,11,76,3,0,0,0,0,0,0,0,0,0,1,
+79,12,3,62,59,40,7,52,45,29,1,0,0,0,1,
+79,13,76,4,78,0,0,0,0,0,0,0,0,0,0,1,
+79,17,76,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,19,76,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,23,76,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,25,76,68,67,7,42,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,29,76,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,31,76,52,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,37,76,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,41,76,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,43,76,13,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,47,76,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,53,76,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,59,76,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,61,76,48,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,67,76,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,71,76,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,73,76,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,79,76,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,83,76,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,89,76,10,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+79,109,76,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,1,81,1,
+83,2,2,82,1,
+83,3,81,3,0,1,
+83,4,2,42,4,0,1,
+83,5,81,9,0,0,0,1,
+83,6,2,17,32,76,1,0,1,
+83,7,81,3,0,0,0,0,0,1,
+83,8,2,42,23,65,1,0,0,0,1,
+83,9,81,18,24,1,0,0,0,0,0,1,
+83,10,2,53,0,73,0,7,0,0,0,0,1,
+83,11,81,17,0,0,0,0,0,0,0,0,0,1,
+83,12,2,75,55,65,19,31,12,35,0,0,0,0,1,
+83,13,81,15,0,0,0,0,0,0,0,0,0,0,0,1,
+83,17,81,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,19,81,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,23,81,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,25,81,74,17,3,11,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,29,81,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,31,81,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,37,81,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,41,81,18,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,43,81,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,47,81,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,53,81,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,59,81,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,61,81,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,67,81,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,71,81,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,73,81,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,83,81,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,89,81,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,97,81,80,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,103,81,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+83,113,81,21,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,1,86,1,
+89,2,3,82,1,
+89,3,86,3,0,1,
+89,4,3,72,4,0,1,
+89,5,86,1,0,0,0,1,
+89,6,3,15,80,82,1,0,1,
+89,7,86,7,0,0,0,0,0,1,
+89,8,3,79,40,65,0,0,0,0,1,
+89,9,86,6,12,5,0,0,0,0,0,1,
+89,10,3,4,52,82,33,16,1,0,0,0,1,
+89,11,86,26,88,0,0,0,0,0,0,0,0,1,
+89,12,3,52,70,8,51,44,15,85,2,0,0,0,1,
+89,13,86,17,0,0,0,0,0,0,0,0,0,0,0,1,
+89,17,86,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,19,86,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,23,86,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,25,86,18,44,40,84,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,29,86,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,31,86,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,37,86,7,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,41,86,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,43,86,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,47,86,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,53,86,14,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,59,86,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,61,86,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,67,86,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,71,86,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,73,86,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,79,86,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,89,86,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,101,86,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,107,86,79,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,109,86,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+89,113,86,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,1,92,1,
+97,2,5,96,1,
+97,3,92,9,0,1,
+97,4,5,80,6,0,1,
+97,5,92,3,0,0,0,1,
+97,6,5,88,58,92,0,0,1,
+97,7,92,5,0,0,0,0,0,1,
+97,8,5,32,1,65,0,0,0,0,1,
+97,9,92,7,59,12,0,0,0,0,0,1,
+97,10,5,20,34,34,66,22,0,0,0,0,1,
+97,11,92,5,0,0,0,0,0,0,0,0,0,1,
+97,12,5,94,78,86,0,81,59,30,0,0,0,0,1,
+97,13,92,3,0,0,0,0,0,0,0,0,0,0,0,1,
+97,17,92,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,19,92,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,23,92,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,25,92,10,73,85,11,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,29,92,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,31,92,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,37,92,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,41,92,94,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,43,92,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,47,92,66,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,53,92,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,59,92,14,95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,61,92,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,67,92,7,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,71,92,7,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,73,92,79,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,79,92,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,97,92,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,113,92,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+97,127,92,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+101,1,99,1,
+101,2,2,97,1,
+101,3,99,3,0,1,
+101,4,2,78,1,0,1,
+101,5,99,2,0,0,0,1,
+101,6,2,67,20,90,2,0,1,
+101,7,99,6,0,0,0,0,0,1,
+101,8,2,24,29,76,4,0,0,0,1,
+101,9,99,47,64,0,0,0,0,0,0,1,
+101,10,2,52,100,100,49,67,1,0,0,0,1,
+101,11,99,31,0,0,0,0,0,0,0,0,0,1,
+101,12,2,21,84,48,78,39,64,79,1,0,0,0,1,
+101,13,99,7,0,0,0,0,0,0,0,0,0,0,0,1,
+101,17,99,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+101,19,99,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+101,23,99,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+101,25,99,55,72,95,79,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+101,29,99,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+101,31,99,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+101,37,99,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+101,41,99,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+101,43,99,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+101,47,99,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+103,1,98,1,
+103,2,5,102,1,
+103,3,98,2,0,1,
+103,4,5,88,2,0,1,
+103,5,98,11,0,0,0,1,
+103,6,5,30,9,96,0,0,1,
+103,7,98,5,0,0,0,0,0,1,
+103,8,5,49,71,70,1,0,0,0,1,
+103,9,98,51,97,0,0,0,0,0,0,1,
+103,10,5,11,94,101,86,101,1,0,0,0,1,
+103,11,98,5,0,0,0,0,0,0,0,0,0,1,
+103,12,5,88,29,81,20,94,23,74,1,0,0,0,1,
+103,13,98,5,0,0,0,0,0,0,0,0,0,0,0,1,
+103,17,98,8,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+103,19,98,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+103,23,98,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+103,25,98,58,7,39,21,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+103,29,98,101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+103,31,98,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+103,37,98,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+103,41,98,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+103,43,98,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+103,47,98,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+107,1,105,1,
+107,2,2,103,1,
+107,3,105,5,0,1,
+107,4,2,79,13,0,1,
+107,5,105,8,0,0,0,1,
+107,6,2,79,22,52,1,0,1,
+107,7,105,16,0,0,0,0,0,1,
+107,8,2,95,24,105,2,0,0,0,1,
+107,9,105,66,3,3,0,0,0,0,0,1,
+107,10,2,95,83,83,61,94,2,0,0,0,1,
+107,11,105,8,0,0,0,0,0,0,0,0,0,1,
+107,12,2,57,42,61,0,6,48,37,0,0,0,0,1,
+107,13,105,4,0,0,0,0,0,0,0,0,0,0,0,1,
+107,17,105,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+107,19,105,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+107,23,105,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+107,25,105,15,101,8,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+107,29,105,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+107,31,105,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+107,37,105,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+107,41,105,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+107,43,105,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+107,47,105,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+109,1,103,1,
+109,2,6,108,1,
+109,3,103,1,0,1,
+109,4,6,98,11,0,1,
+109,5,103,4,0,0,0,1,
+109,6,6,66,102,107,0,0,1,
+109,7,103,14,0,0,0,0,0,1,
+109,8,6,86,34,102,1,0,0,0,1,
+109,9,103,87,93,0,0,0,0,0,0,1,
+109,10,6,69,75,16,55,71,1,0,0,0,1,
+109,11,103,11,0,0,0,0,0,0,0,0,0,1,
+109,12,6,28,103,65,8,37,53,50,1,0,0,0,1,
+109,13,103,1,0,0,0,0,0,0,0,0,0,0,0,1,
+109,17,103,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+109,19,103,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+109,23,103,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+109,25,103,9,94,61,83,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+109,29,103,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+109,31,103,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+109,37,103,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+109,41,103,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+109,43,103,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+109,47,103,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+113,1,110,1,
+113,2,3,101,1,
+113,3,110,8,0,1,
+113,4,3,62,0,0,1,
+113,5,110,7,0,0,0,1,
+113,6,3,71,30,59,1,0,1,
+113,7,110,5,0,0,0,0,0,1,
+113,8,3,28,38,98,3,0,0,0,1,
+113,9,110,71,87,0,0,0,0,0,0,1,
+113,10,3,56,83,45,57,108,0,0,0,0,1,
+113,11,110,3,0,0,0,0,0,0,0,0,0,1,
+113,12,3,27,10,56,98,4,62,23,1,0,0,0,1,
+113,13,110,4,0,0,0,0,0,0,0,0,0,0,0,1,
+113,17,110,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+113,19,110,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+113,23,110,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+113,25,110,73,76,59,53,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+113,29,110,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+113,31,110,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+113,37,110,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+113,41,110,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+113,43,110,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+113,47,110,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+127,1,124,1,
+127,2,3,126,1,
+127,3,124,3,0,1,
+127,4,3,97,2,0,1,
+127,5,124,7,0,0,0,1,
+127,6,3,82,115,84,0,0,1,
+127,7,124,15,0,0,0,0,0,1,
+127,8,3,8,55,104,3,0,0,0,1,
+127,9,124,126,119,14,0,0,0,0,0,1,
+127,10,3,4,60,95,64,107,0,0,0,0,1,
+127,11,124,11,0,0,0,0,0,0,0,0,0,1,
+127,12,3,8,99,15,97,33,25,119,0,0,0,0,1,
+127,13,124,8,0,0,0,0,0,0,0,0,0,0,0,1,
+127,17,124,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+127,19,124,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+127,23,124,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+127,25,124,82,71,50,33,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+127,29,124,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+127,31,124,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+127,37,124,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+127,41,124,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+127,43,124,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+127,47,124,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+131,1,129,1,
+131,2,2,127,1,
+131,3,129,3,0,1,
+131,4,2,109,9,0,1,
+131,5,129,19,0,0,0,1,
+131,6,2,22,4,66,2,0,1,
+131,7,129,10,0,0,0,0,0,1,
+131,8,2,104,116,72,3,0,0,0,1,
+131,9,129,19,6,6,0,0,0,0,0,1,
+131,10,2,44,126,9,97,124,0,0,0,0,1,
+131,11,129,6,0,0,0,0,0,0,0,0,0,1,
+131,12,2,103,28,125,83,40,122,50,0,0,0,0,1,
+131,13,129,9,0,0,0,0,0,0,0,0,0,0,0,1,
+131,17,129,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+131,19,129,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+131,23,129,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+131,25,129,109,130,96,129,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+131,29,129,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+131,31,129,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+131,37,129,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+131,41,129,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+131,43,129,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+131,47,129,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+137,1,134,1,
+137,2,3,131,1,
+137,3,134,6,0,1,
+137,4,3,95,1,0,1,
+137,5,134,7,0,0,0,1,
+137,6,3,3,102,116,1,0,1,
+137,7,134,1,0,0,0,0,0,1,
+137,8,3,34,21,105,4,0,0,0,1,
+137,9,134,122,80,1,0,0,0,0,0,1,
+137,10,3,119,93,67,20,0,2,0,0,0,1,
+137,11,134,1,0,0,0,0,0,0,0,0,0,1,
+137,12,3,61,135,36,12,40,40,61,1,0,0,0,1,
+137,13,134,14,0,0,0,0,0,0,0,0,0,0,0,1,
+137,17,134,4,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+137,19,134,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+137,23,134,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+137,25,134,130,29,88,129,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+137,29,134,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+137,31,134,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+137,37,134,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+137,41,134,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+137,43,134,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+137,47,134,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+139,1,137,1,
+139,2,2,138,1,
+139,3,137,6,0,1,
+139,4,2,96,7,0,1,
+139,5,137,10,0,0,0,1,
+139,6,2,118,10,46,4,0,1,
+139,7,137,9,0,0,0,0,0,1,
+139,8,2,21,36,103,4,0,0,0,1,
+139,9,137,87,70,3,0,0,0,0,0,1,
+139,10,2,106,66,130,48,110,0,0,0,0,1,
+139,11,137,7,0,0,0,0,0,0,0,0,0,1,
+139,12,2,10,8,106,77,41,75,120,0,0,0,0,1,
+139,13,137,22,0,0,0,0,0,0,0,0,0,0,0,1,
+139,17,137,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+139,19,137,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+139,23,137,12,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+139,25,137,70,100,35,105,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+139,29,137,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+139,31,137,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+139,37,137,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+139,41,137,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+139,43,137,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+139,47,137,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+149,1,147,1,
+149,2,2,145,1,
+149,3,147,3,0,1,
+149,4,2,107,7,0,1,
+149,5,147,2,0,0,0,1,
+149,6,2,55,33,105,1,0,1,
+149,7,147,19,0,0,0,0,0,1,
+149,8,2,123,25,140,2,0,0,0,1,
+149,9,147,20,146,0,0,0,0,0,0,1,
+149,10,2,51,143,148,42,74,0,0,0,0,1,
+149,11,147,33,0,0,0,0,0,0,0,0,0,1,
+149,12,2,110,104,9,52,91,121,0,0,0,0,0,1,
+149,13,147,4,0,0,0,0,0,0,0,0,0,0,0,1,
+149,17,147,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+149,19,147,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+149,23,147,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+149,25,147,85,5,80,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+149,29,147,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+149,31,147,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+149,37,147,13,148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+149,41,147,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+149,43,147,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+149,47,147,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+151,1,145,1,
+151,2,6,149,1,
+151,3,145,1,0,1,
+151,4,6,89,13,0,1,
+151,5,145,11,0,0,0,1,
+151,6,6,15,18,125,0,0,1,
+151,7,145,9,0,0,0,0,0,1,
+151,8,6,43,122,140,9,0,0,0,1,
+151,9,145,96,126,6,0,0,0,0,0,1,
+151,10,6,142,20,49,104,21,1,0,0,0,1,
+151,11,145,1,0,0,0,0,0,0,0,0,0,1,
+151,12,6,147,107,77,6,101,121,109,1,0,0,0,1,
+151,13,145,12,0,0,0,0,0,0,0,0,0,0,0,1,
+151,17,145,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+151,19,145,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+151,23,145,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+151,29,145,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+151,31,145,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+151,37,145,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+151,41,145,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+151,43,145,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+151,47,145,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+157,1,152,1,
+157,2,5,152,1,
+157,3,152,1,0,1,
+157,4,5,136,11,0,1,
+157,5,152,7,0,0,0,1,
+157,6,5,144,43,130,3,0,1,
+157,7,152,14,0,0,0,0,0,1,
+157,8,5,153,40,97,3,0,0,0,1,
+157,9,152,52,114,2,0,0,0,0,0,1,
+157,10,5,93,61,124,22,61,0,0,0,0,1,
+157,11,152,29,0,0,0,0,0,0,0,0,0,1,
+157,12,5,57,152,43,137,72,110,77,0,0,0,0,1,
+157,13,152,9,156,0,0,0,0,0,0,0,0,0,0,1,
+157,17,152,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+157,19,152,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+157,23,152,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+157,25,152,42,56,112,15,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+157,29,152,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+157,31,152,116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+157,37,152,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+157,41,152,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+157,43,152,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+157,47,152,145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+163,1,161,1,
+163,2,2,159,1,
+163,3,161,7,0,1,
+163,4,2,91,8,0,1,
+163,5,161,3,0,0,0,1,
+163,6,2,156,25,83,0,0,1,
+163,7,161,9,0,0,0,0,0,1,
+163,8,2,6,83,132,1,0,0,0,1,
+163,9,161,127,162,15,0,0,0,0,0,1,
+163,10,2,0,15,125,120,111,3,0,0,0,1,
+163,11,161,11,0,0,0,0,0,0,0,0,0,1,
+163,12,2,69,10,103,38,31,112,39,0,0,0,0,1,
+163,13,161,24,0,0,0,0,0,0,0,0,0,0,0,1,
+163,17,161,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+163,19,161,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+163,23,161,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+163,25,161,95,71,120,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+163,29,161,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+163,31,161,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+163,37,161,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+163,41,161,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+163,43,161,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+163,47,161,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+167,1,162,1,
+167,2,5,166,1,
+167,3,162,7,0,1,
+167,4,5,120,3,0,1,
+167,5,162,3,0,0,0,1,
+167,6,5,2,38,75,2,0,1,
+167,7,162,10,0,0,0,0,0,1,
+167,8,5,113,56,149,2,0,0,0,1,
+167,9,162,122,165,0,0,0,0,0,0,1,
+167,10,5,148,143,109,68,85,0,0,0,0,1,
+167,11,162,24,0,0,0,0,0,0,0,0,0,1,
+167,12,5,57,41,140,131,142,10,142,0,0,0,0,1,
+167,13,162,10,0,0,0,0,0,0,0,0,0,0,0,1,
+167,17,162,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+167,19,162,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+167,23,162,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+167,29,162,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+167,31,162,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+167,37,162,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+167,41,162,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+167,43,162,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+167,47,162,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+173,1,171,1,
+173,2,2,169,1,
+173,3,171,2,0,1,
+173,4,2,102,1,0,1,
+173,5,171,6,0,0,0,1,
+173,6,2,107,134,27,1,0,1,
+173,7,171,5,0,0,0,0,0,1,
+173,8,2,27,158,125,2,0,0,0,1,
+173,9,171,104,56,0,0,0,0,0,0,1,
+173,10,2,58,106,48,164,156,1,0,0,0,1,
+173,11,171,12,0,0,0,0,0,0,0,0,0,1,
+173,12,2,22,159,0,166,46,64,29,1,0,0,0,1,
+173,13,171,6,0,0,0,0,0,0,0,0,0,0,0,1,
+173,17,171,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+173,19,171,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+173,23,171,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+173,29,171,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+173,31,171,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+173,37,171,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+173,41,171,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+173,43,171,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+173,47,171,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+179,1,177,1,
+179,2,2,172,1,
+179,3,177,4,0,1,
+179,4,2,109,1,0,1,
+179,5,177,2,0,0,0,1,
+179,6,2,109,55,91,7,0,1,
+179,7,177,6,0,0,0,0,0,1,
+179,8,2,73,144,163,0,0,0,0,1,
+179,9,177,64,40,0,0,0,0,0,0,1,
+179,10,2,87,49,150,71,115,0,0,0,0,1,
+179,11,177,28,0,0,0,0,0,0,0,0,0,1,
+179,12,2,1,177,8,76,43,83,103,2,0,0,0,1,
+179,13,177,18,0,0,0,0,0,0,0,0,0,0,0,1,
+179,17,177,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+179,19,177,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+179,23,177,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+179,25,177,143,85,31,8,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+179,29,177,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+179,31,177,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+179,37,177,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+179,41,177,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+179,43,177,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+179,47,177,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+181,1,179,1,
+181,2,2,177,1,
+181,3,179,6,0,1,
+181,4,2,105,6,0,1,
+181,5,179,21,0,0,0,1,
+181,6,2,169,163,177,0,0,1,
+181,7,179,4,0,0,0,0,0,1,
+181,8,2,149,22,108,2,0,0,0,1,
+181,9,179,168,107,11,0,0,0,0,0,1,
+181,10,2,88,57,94,104,154,0,0,0,0,1,
+181,11,179,24,0,0,0,0,0,0,0,0,0,1,
+181,12,2,10,12,175,122,45,141,171,0,0,0,0,1,
+181,13,179,8,0,0,0,0,0,0,0,0,0,0,0,1,
+181,17,179,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+181,19,179,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+181,23,179,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+181,29,179,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+181,31,179,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+181,37,179,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+181,41,179,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+181,43,179,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+181,47,179,122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+191,1,172,1,
+191,2,19,190,1,
+191,3,172,4,0,1,
+191,4,19,100,7,0,1,
+191,5,172,1,0,0,0,1,
+191,6,19,10,10,110,1,0,1,
+191,7,172,14,0,0,0,0,0,1,
+191,8,19,171,139,164,2,0,0,0,1,
+191,9,172,124,62,0,0,0,0,0,0,1,
+191,10,19,156,74,173,47,113,0,0,0,0,1,
+191,11,172,6,0,0,0,0,0,0,0,0,0,1,
+191,12,19,151,7,90,49,25,168,79,0,0,0,0,1,
+191,13,172,12,0,0,0,0,0,0,0,0,0,0,0,1,
+191,17,172,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+191,19,172,2,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+191,23,172,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+191,29,172,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+191,31,172,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+191,37,172,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+191,41,172,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+191,43,172,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+191,47,172,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+193,1,188,1,
+193,2,5,192,1,
+193,3,188,1,0,1,
+193,4,5,148,6,0,1,
+193,5,188,7,0,0,0,1,
+193,6,5,172,8,149,0,0,1,
+193,7,188,8,0,0,0,0,0,1,
+193,8,5,154,34,145,10,0,0,0,1,
+193,9,188,27,168,8,0,0,0,0,0,1,
+193,10,5,89,0,77,51,20,0,0,0,0,1,
+193,11,188,1,0,0,0,0,0,0,0,0,0,1,
+193,12,5,28,46,90,152,135,52,155,0,0,0,0,1,
+193,13,188,39,0,0,0,0,0,0,0,0,0,0,0,1,
+193,17,188,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+193,19,188,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+193,23,188,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+193,29,188,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+193,31,188,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+193,37,188,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+193,41,188,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+193,43,188,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+193,47,188,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+197,1,195,1,
+197,2,2,192,1,
+197,3,195,3,0,1,
+197,4,2,124,16,0,1,
+197,5,195,4,0,0,0,1,
+197,6,2,173,79,124,1,0,1,
+197,7,195,6,0,0,0,0,0,1,
+197,8,2,29,96,176,0,0,0,0,1,
+197,9,195,8,127,13,0,0,0,0,0,1,
+197,10,2,42,73,8,137,121,0,0,0,0,1,
+197,11,195,14,0,0,0,0,0,0,0,0,0,1,
+197,12,2,163,90,9,141,130,15,168,0,0,0,0,1,
+197,13,195,39,0,0,0,0,0,0,0,0,0,0,0,1,
+197,17,195,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+197,19,195,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+197,23,195,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+197,29,195,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+197,31,195,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+197,37,195,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+197,41,195,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+197,43,195,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+197,47,195,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+199,1,196,1,
+199,2,3,193,1,
+199,3,196,1,0,1,
+199,4,3,162,7,0,1,
+199,5,196,3,0,0,0,1,
+199,6,3,79,58,90,0,0,1,
+199,7,196,3,0,0,0,0,0,1,
+199,8,3,159,23,160,1,0,0,0,1,
+199,9,196,141,177,8,0,0,0,0,0,1,
+199,10,3,9,54,31,158,171,0,0,0,0,1,
+199,11,196,1,0,0,0,0,0,0,0,0,0,1,
+199,12,3,151,57,69,138,197,192,33,0,0,0,0,1,
+199,13,196,10,0,0,0,0,0,0,0,0,0,0,0,1,
+199,17,196,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+199,19,196,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+199,23,196,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+199,29,196,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+199,31,196,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+199,37,196,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+199,41,196,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+199,43,196,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+199,47,196,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+211,1,209,1,
+211,2,2,207,1,
+211,3,209,2,0,1,
+211,4,2,161,8,0,1,
+211,5,209,13,0,0,0,1,
+211,6,2,133,194,81,0,0,1,
+211,7,209,3,0,0,0,0,0,1,
+211,8,2,29,87,200,2,0,0,0,1,
+211,9,209,26,139,19,0,0,0,0,0,1,
+211,10,2,125,87,148,61,30,1,0,0,0,1,
+211,11,209,7,0,0,0,0,0,0,0,0,0,1,
+211,12,2,27,84,184,126,145,50,8,0,0,0,0,1,
+211,13,209,12,0,0,0,0,0,0,0,0,0,0,0,1,
+211,17,209,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+211,19,209,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+211,23,209,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+211,29,209,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+211,31,209,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+211,37,209,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+211,41,209,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+211,43,209,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+211,47,209,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+223,1,220,1,
+223,2,3,221,1,
+223,3,220,6,0,1,
+223,4,3,163,6,0,1,
+223,5,220,1,0,0,0,1,
+223,6,3,196,24,68,2,0,1,
+223,7,220,6,0,0,0,0,0,1,
+223,8,3,138,98,139,2,0,0,0,1,
+223,9,220,64,164,1,0,0,0,0,0,1,
+223,10,3,62,99,87,177,118,1,0,0,0,1,
+223,11,220,8,0,0,0,0,0,0,0,0,0,1,
+223,12,3,213,151,64,105,11,94,64,1,0,0,0,1,
+223,13,220,23,0,0,0,0,0,0,0,0,0,0,0,1,
+223,17,220,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+223,19,220,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+223,23,220,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+223,29,220,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+223,31,220,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+223,37,220,22,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+223,41,220,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+223,43,220,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+223,47,220,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+227,1,225,1,
+227,2,2,220,1,
+227,3,225,2,0,1,
+227,4,2,143,1,0,1,
+227,5,225,5,0,0,0,1,
+227,6,2,135,24,174,1,0,1,
+227,7,225,18,0,0,0,0,0,1,
+227,8,2,106,176,151,2,0,0,0,1,
+227,9,225,183,24,3,0,0,0,0,0,1,
+227,10,2,77,93,12,199,22,0,0,0,0,1,
+227,11,225,2,0,0,0,0,0,0,0,0,0,1,
+227,12,2,94,142,127,96,160,99,123,0,0,0,0,1,
+227,13,225,2,0,0,0,0,0,0,0,0,0,0,0,1,
+227,17,225,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+227,19,225,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+227,23,225,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+227,29,225,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+227,31,225,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+227,37,225,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+227,41,225,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+227,43,225,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+227,47,225,142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+229,1,223,1,
+229,2,6,228,1,
+229,3,223,1,0,1,
+229,4,6,162,7,0,1,
+229,5,223,8,0,0,0,1,
+229,6,6,186,160,24,0,0,1,
+229,7,223,7,0,0,0,0,0,1,
+229,8,6,205,62,193,8,0,0,0,1,
+229,9,223,50,117,15,0,0,0,0,0,1,
+229,10,6,98,167,158,135,185,1,0,0,0,1,
+229,11,223,2,0,0,0,0,0,0,0,0,0,1,
+229,12,6,145,9,172,6,25,140,131,0,0,0,0,1,
+229,13,223,47,0,0,0,0,0,0,0,0,0,0,0,1,
+229,17,223,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+229,19,223,15,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+229,23,223,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+229,29,223,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+229,31,223,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+229,37,223,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+229,41,223,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+229,43,223,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+229,47,223,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+233,1,230,1,
+233,2,3,232,1,
+233,3,230,1,0,1,
+233,4,3,158,4,0,1,
+233,5,230,17,0,0,0,1,
+233,6,3,32,215,122,3,0,1,
+233,7,230,4,0,0,0,0,0,1,
+233,8,3,181,135,202,12,0,0,0,1,
+233,9,230,146,56,7,0,0,0,0,0,1,
+233,10,3,48,3,102,71,28,3,0,0,0,1,
+233,11,230,5,0,0,0,0,0,0,0,0,0,1,
+233,12,3,20,216,19,31,114,21,96,0,0,0,0,1,
+233,13,230,14,0,0,0,0,0,0,0,0,0,0,0,1,
+233,17,230,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+233,19,230,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+233,23,230,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+233,29,230,5,232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+233,31,230,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+233,37,230,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+233,41,230,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+233,43,230,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+233,47,230,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+239,1,232,1,
+239,2,7,237,1,
+239,3,232,11,0,1,
+239,4,7,132,11,0,1,
+239,5,232,2,0,0,0,1,
+239,6,7,200,60,237,1,0,1,
+239,7,232,17,0,0,0,0,0,1,
+239,8,7,54,202,201,1,0,0,0,1,
+239,9,232,88,2,3,0,0,0,0,0,1,
+239,10,7,108,127,226,68,57,0,0,0,0,1,
+239,11,232,8,0,0,0,0,0,0,0,0,0,1,
+239,12,7,216,81,101,182,113,14,235,1,0,0,0,1,
+239,13,232,2,0,0,0,0,0,0,0,0,0,0,0,1,
+239,17,232,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+239,19,232,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+239,23,232,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+239,29,232,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+239,31,232,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+239,37,232,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+239,41,232,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+239,43,232,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+239,47,232,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+241,1,234,1,
+241,2,7,238,1,
+241,3,234,1,0,1,
+241,4,7,152,14,0,1,
+241,5,234,7,0,0,0,1,
+241,6,7,5,6,83,0,0,1,
+241,7,234,2,0,0,0,0,0,1,
+241,8,7,153,212,173,1,0,0,0,1,
+241,9,234,125,236,0,0,0,0,0,0,1,
+241,10,7,55,208,145,27,29,1,0,0,0,1,
+241,11,234,3,0,0,0,0,0,0,0,0,0,1,
+241,12,7,17,197,22,168,109,10,42,0,0,0,0,1,
+241,13,234,11,0,0,0,0,0,0,0,0,0,0,0,1,
+241,17,234,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+241,19,234,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+241,23,234,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+241,29,234,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+241,31,234,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+241,37,234,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+241,41,234,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+241,43,234,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+241,47,234,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+251,1,245,1,
+251,2,6,242,1,
+251,3,245,3,0,1,
+251,4,6,200,3,0,1,
+251,5,245,3,0,0,0,1,
+251,6,6,179,151,247,1,0,1,
+251,7,245,8,0,0,0,0,0,1,
+251,8,6,173,215,142,7,0,0,0,1,
+251,9,245,106,187,4,0,0,0,0,0,1,
+251,10,6,149,34,45,110,138,1,0,0,0,1,
+251,11,245,26,0,0,0,0,0,0,0,0,0,1,
+251,12,6,232,201,15,20,20,53,192,1,0,0,0,1,
+251,13,245,15,0,0,0,0,0,0,0,0,0,0,0,1,
+251,17,245,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+251,19,245,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+251,23,245,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+251,29,245,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+251,31,245,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+251,37,245,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+251,41,245,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+251,43,245,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+251,47,245,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+257,1,254,1,
+257,2,3,251,1,
+257,3,254,6,0,1,
+257,4,3,187,16,0,1,
+257,5,254,4,0,0,0,1,
+257,6,3,138,18,62,3,0,1,
+257,7,254,31,0,0,0,0,0,1,
+257,8,3,162,140,179,0,0,0,0,1,
+257,9,254,50,201,1,0,0,0,0,0,1,
+257,10,3,20,180,225,12,97,0,0,0,0,1,
+257,11,254,40,0,0,0,0,0,0,0,0,0,1,
+257,12,3,20,148,249,173,215,225,13,2,0,0,0,1,
+257,13,254,5,0,0,0,0,0,0,0,0,0,0,0,1,
+257,17,254,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+257,19,254,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+257,23,254,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+257,29,254,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+257,31,254,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+257,37,254,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+257,41,254,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+257,43,254,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+257,47,254,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+263,1,258,1,
+263,2,5,261,1,
+263,3,258,14,0,1,
+263,4,5,171,5,0,1,
+263,5,258,13,0,0,0,1,
+263,6,5,225,250,222,1,0,1,
+263,7,258,1,0,0,0,0,0,1,
+263,8,5,7,170,227,3,0,0,0,1,
+263,9,258,29,261,6,0,0,0,0,0,1,
+263,10,5,119,145,198,231,245,0,0,0,0,1,
+263,11,258,2,0,0,0,0,0,0,0,0,0,1,
+263,12,5,180,45,47,252,162,174,172,0,0,0,0,1,
+269,1,267,1,
+269,2,2,268,1,
+269,3,267,9,0,1,
+269,4,2,262,8,0,1,
+269,5,267,12,0,0,0,1,
+269,6,2,206,101,120,1,0,1,
+269,7,267,6,0,0,0,0,0,1,
+269,8,2,232,131,220,4,0,0,0,1,
+269,9,267,267,214,2,0,0,0,0,0,1,
+269,10,2,10,61,186,243,264,2,0,0,0,1,
+269,11,267,20,0,0,0,0,0,0,0,0,0,1,
+269,12,2,150,180,132,215,63,165,126,0,0,0,0,1,
+271,1,265,1,
+271,2,6,269,1,
+271,3,265,2,0,1,
+271,4,6,205,3,0,1,
+271,5,265,2,0,0,0,1,
+271,6,6,81,207,207,0,0,1,
+271,7,265,22,0,0,0,0,0,1,
+271,8,6,69,114,199,1,0,0,0,1,
+271,9,265,186,266,10,0,0,0,0,0,1,
+271,10,6,126,74,256,10,133,1,0,0,0,1,
+271,11,265,10,0,0,0,0,0,0,0,0,0,1,
+271,12,6,130,256,237,205,116,210,162,0,0,0,0,1,
+277,1,272,1,
+277,2,5,274,1,
+277,3,272,3,0,1,
+277,4,5,222,1,0,1,
+277,5,272,1,0,0,0,1,
+277,6,5,118,9,33,1,0,1,
+277,7,272,9,0,0,0,0,0,1,
+277,8,5,176,159,187,4,0,0,0,1,
+277,9,272,110,177,4,0,0,0,0,0,1,
+277,10,5,260,241,237,253,206,0,0,0,0,1,
+277,11,272,5,0,0,0,0,0,0,0,0,0,1,
+277,12,5,202,115,180,40,240,218,183,4,0,0,0,1,
+281,1,278,1,
+281,2,3,280,1,
+281,3,278,1,0,1,
+281,4,3,176,7,0,1,
+281,5,278,5,0,0,0,1,
+281,6,3,27,13,151,1,0,1,
+281,7,278,19,0,0,0,0,0,1,
+281,8,3,140,279,195,4,0,0,0,1,
+281,9,278,70,148,6,0,0,0,0,0,1,
+281,10,3,191,138,13,145,258,2,0,0,0,1,
+281,11,278,36,0,0,0,0,0,0,0,0,0,1,
+281,12,3,191,28,58,116,103,68,202,0,0,0,0,1,
+283,1,280,1,
+283,2,3,282,1,
+283,3,280,3,0,1,
+283,4,3,238,5,0,1,
+283,5,280,3,0,0,0,1,
+283,6,3,73,68,199,0,0,1,
+283,7,280,8,0,0,0,0,0,1,
+283,8,3,232,32,179,11,0,0,0,1,
+283,9,280,65,136,0,0,0,0,0,0,1,
+283,10,3,219,100,68,185,271,3,0,0,0,1,
+283,11,280,4,0,0,0,0,0,0,0,0,0,1,
+283,12,3,56,14,49,229,96,8,20,0,0,0,0,1,
+293,1,291,1,
+293,2,2,292,1,
+293,3,291,2,0,1,
+293,4,2,166,3,0,1,
+293,5,291,2,0,0,0,1,
+293,6,2,260,210,128,1,0,1,
+293,7,291,8,0,0,0,0,0,1,
+293,8,2,239,195,175,29,0,0,0,1,
+293,9,291,190,208,0,0,0,0,0,0,1,
+293,10,2,24,184,46,28,186,0,0,0,0,1,
+293,11,291,3,0,0,0,0,0,0,0,0,0,1,
+293,12,2,157,144,167,212,125,210,159,0,0,0,0,1,
+307,1,302,1,
+307,2,5,306,1,
+307,3,302,7,0,1,
+307,4,5,239,2,0,1,
+307,5,302,5,0,0,0,1,
+307,6,5,61,172,213,0,0,1,
+307,7,302,6,0,0,0,0,0,1,
+307,8,5,131,232,283,0,0,0,0,1,
+307,9,302,70,165,1,0,0,0,0,0,1,
+311,1,294,1,
+311,2,17,310,1,
+311,3,294,3,0,1,
+311,4,17,163,3,0,1,
+311,5,294,1,0,0,0,1,
+311,6,17,152,167,27,1,0,1,
+311,7,294,10,0,0,0,0,0,1,
+311,8,17,2,118,162,19,0,0,0,1,
+311,9,294,74,287,1,0,0,0,0,0,1,
+313,1,303,1,
+313,2,10,310,1,
+313,3,303,2,0,1,
+313,4,10,239,8,0,1,
+313,5,303,7,0,0,0,1,
+313,6,10,253,213,196,0,0,1,
+313,7,303,4,0,0,0,0,0,1,
+313,8,10,106,99,306,8,0,0,0,1,
+313,9,303,300,267,8,0,0,0,0,0,1,
+317,1,315,1,
+317,2,2,313,1,
+317,3,315,7,0,1,
+317,4,2,178,6,0,1,
+317,5,315,2,0,0,0,1,
+317,6,2,4,156,195,2,0,1,
+317,7,315,7,0,0,0,0,0,1,
+317,8,2,31,85,207,1,0,0,0,1,
+317,9,315,296,284,0,0,0,0,0,0,1,
+331,1,328,1,
+331,2,3,326,1,
+331,3,328,1,0,1,
+331,4,3,290,3,0,1,
+331,5,328,4,0,0,0,1,
+331,6,3,159,205,283,1,0,1,
+331,7,328,5,0,0,0,0,0,1,
+331,8,3,78,308,249,1,0,0,0,1,
+331,9,328,210,194,0,0,0,0,0,0,1,
+337,1,327,1,
+337,2,10,332,1,
+337,3,327,2,0,1,
+337,4,10,224,25,0,1,
+337,5,327,2,0,0,0,1,
+337,6,10,109,127,216,0,0,1,
+337,7,327,5,0,0,0,0,0,1,
+337,8,10,251,246,331,0,0,0,0,1,
+337,9,327,98,148,12,0,0,0,0,0,1,
+347,1,345,1,
+347,2,2,343,1,
+347,3,345,9,0,1,
+347,4,2,295,13,0,1,
+347,5,345,3,0,0,0,1,
+347,6,2,56,26,343,3,0,1,
+347,7,345,4,0,0,0,0,0,1,
+347,8,2,117,213,187,1,0,0,0,1,
+347,9,345,252,235,2,0,0,0,0,0,1,
+349,1,347,1,
+349,2,2,348,1,
+349,3,347,4,0,1,
+349,4,2,279,3,0,1,
+349,5,347,2,0,0,0,1,
+349,6,2,316,177,135,0,0,1,
+349,7,347,10,0,0,0,0,0,1,
+349,8,2,268,328,308,0,0,0,0,1,
+349,9,347,130,290,36,0,0,0,0,0,1,
+353,1,350,1,
+353,2,3,348,1,
+353,3,350,3,0,1,
+353,4,3,199,0,0,1,
+353,5,350,1,0,0,0,1,
+353,6,3,295,226,215,1,0,1,
+353,7,350,16,0,0,0,0,0,1,
+353,8,3,37,26,182,1,0,0,0,1,
+353,9,350,49,319,2,0,0,0,0,0,1,
+359,1,352,1,
+359,2,7,358,1,
+359,3,352,3,0,1,
+359,4,7,229,2,0,1,
+359,5,352,1,0,0,0,1,
+359,6,7,327,327,309,4,0,1,
+359,7,352,1,0,0,0,0,0,1,
+359,8,7,271,143,301,0,0,0,0,1,
+359,9,352,165,356,0,0,0,0,0,0,1,
+367,1,361,1,
+367,2,6,366,1,
+367,3,361,10,0,1,
+367,4,6,295,3,0,1,
+367,5,361,3,0,0,0,1,
+367,6,6,324,321,222,0,0,1,
+367,7,361,13,0,0,0,0,0,1,
+367,8,6,50,282,335,2,0,0,0,1,
+367,9,361,268,213,15,0,0,0,0,0,1,
+373,1,371,1,
+373,2,2,369,1,
+373,3,371,5,0,1,
+373,4,2,304,15,0,1,
+373,5,371,2,0,0,0,1,
+373,6,2,108,83,126,0,0,1,
+373,7,371,7,0,0,0,0,0,1,
+373,8,2,66,219,203,0,0,0,0,1,
+373,9,371,370,238,14,0,0,0,0,0,1,
+379,1,377,1,
+379,2,2,374,1,
+379,3,377,5,0,1,
+379,4,2,327,2,0,1,
+379,5,377,4,0,0,0,1,
+379,6,2,246,364,374,0,0,1,
+379,7,377,14,0,0,0,0,0,1,
+379,8,2,173,194,210,13,0,0,0,1,
+379,9,377,369,362,11,0,0,0,0,0,1,
+383,1,378,1,
+383,2,5,382,1,
+383,3,378,1,0,1,
+383,4,5,309,7,0,1,
+383,5,378,1,0,0,0,1,
+383,6,5,158,8,69,1,0,1,
+383,7,378,6,0,0,0,0,0,1,
+383,8,5,296,332,281,10,0,0,0,1,
+383,9,378,76,137,2,0,0,0,0,0,1,
+389,1,387,1,
+389,2,2,379,1,
+389,3,387,2,0,1,
+389,4,2,266,2,0,1,
+389,5,387,4,0,0,0,1,
+389,6,2,255,339,218,1,0,1,
+389,7,387,24,0,0,0,0,0,1,
+389,8,2,290,19,351,0,0,0,0,1,
+389,9,387,308,258,2,0,0,0,0,0,1,
+397,1,392,1,
+397,2,5,392,1,
+397,3,392,2,0,1,
+397,4,5,363,12,0,1,
+397,5,392,7,0,0,0,1,
+397,6,5,287,274,382,0,0,1,
+397,7,392,12,0,0,0,0,0,1,
+397,8,5,203,255,375,1,0,0,0,1,
+397,9,392,252,166,6,0,0,0,0,0,1,
+401,1,398,1,
+401,2,3,396,1,
+401,3,398,3,0,1,
+401,4,3,372,2,0,1,
+401,5,398,4,0,0,0,1,
+401,6,3,51,81,115,4,0,1,
+401,7,398,5,0,0,0,0,0,1,
+401,8,3,164,113,380,0,0,0,0,1,
+401,9,398,158,199,1,0,0,0,0,0,1,
+409,1,388,1,
+409,2,21,404,1,
+409,3,388,3,0,1,
+409,4,21,407,12,0,1,
+409,5,388,5,0,0,0,1,
+409,6,21,364,53,372,0,0,1,
+409,7,388,7,0,0,0,0,0,1,
+409,8,21,396,69,256,3,0,0,0,1,
+409,9,388,211,318,8,0,0,0,0,0,1,
+419,1,417,1,
+419,2,2,418,1,
+419,3,417,11,0,1,
+419,4,2,373,4,0,1,
+419,5,417,4,0,0,0,1,
+419,6,2,257,33,411,2,0,1,
+419,7,417,4,0,0,0,0,0,1,
+419,8,2,151,388,234,8,0,0,0,1,
+419,9,417,386,93,0,0,0,0,0,0,1,
+421,1,419,1,
+421,2,2,417,1,
+421,3,419,2,0,1,
+421,4,2,257,10,0,1,
+421,5,419,15,0,0,0,1,
+421,6,2,41,342,111,0,0,1,
+421,7,419,21,0,0,0,0,0,1,
+421,8,2,77,32,389,5,0,0,0,1,
+421,9,419,145,394,18,0,0,0,0,0,1,
+431,1,424,1,
+431,2,7,430,1,
+431,3,424,2,0,1,
+431,4,7,323,2,0,1,
+431,5,424,7,0,0,0,1,
+431,6,7,182,202,161,4,0,1,
+431,7,424,1,0,0,0,0,0,1,
+431,8,7,115,286,243,5,0,0,0,1,
+431,9,424,329,71,2,0,0,0,0,0,1,
+433,1,428,1,
+433,2,5,432,1,
+433,3,428,1,0,1,
+433,4,5,402,6,0,1,
+433,5,428,5,0,0,0,1,
+433,6,5,360,353,244,0,0,1,
+433,7,428,6,0,0,0,0,0,1,
+433,8,5,39,32,347,10,0,0,0,1,
+433,9,428,45,232,27,0,0,0,0,0,1,
+439,1,424,1,
+439,2,15,436,1,
+439,3,424,3,0,1,
+439,4,15,323,0,0,1,
+439,5,424,1,0,0,0,1,
+439,6,15,190,324,1,0,0,1,
+439,7,424,1,0,0,0,0,0,1,
+439,8,15,266,296,359,0,0,0,0,1,
+439,9,424,254,342,16,0,0,0,0,0,1,
+443,1,441,1,
+443,2,2,437,1,
+443,3,441,4,0,1,
+443,4,2,383,4,0,1,
+443,5,441,4,0,0,0,1,
+443,6,2,41,218,298,1,0,1,
+443,7,441,6,0,0,0,0,0,1,
+443,8,2,290,217,437,2,0,0,0,1,
+443,9,441,109,125,3,0,0,0,0,0,1,
+449,1,446,1,
+449,2,3,444,1,
+449,3,446,1,0,1,
+449,4,3,249,2,0,1,
+449,5,446,9,0,0,0,1,
+449,6,3,69,293,437,2,0,1,
+449,7,446,28,0,0,0,0,0,1,
+449,8,3,124,348,361,0,0,0,0,1,
+449,9,446,9,226,6,0,0,0,0,0,1,
+457,1,444,1,
+457,2,13,454,1,
+457,3,444,1,0,1,
+457,4,13,407,8,0,1,
+457,5,444,4,0,0,0,1,
+457,6,13,266,389,205,0,0,1,
+457,7,444,14,0,0,0,0,0,1,
+457,8,13,412,296,365,9,0,0,0,1,
+457,9,444,84,354,9,0,0,0,0,0,1,
+461,1,459,1,
+461,2,2,460,1,
+461,3,459,3,0,1,
+461,4,2,393,3,0,1,
+461,5,459,14,0,0,0,1,
+461,6,2,329,432,439,1,0,1,
+461,7,459,5,0,0,0,0,0,1,
+461,8,2,321,449,388,15,0,0,0,1,
+461,9,459,276,210,5,0,0,0,0,0,1,
+463,1,460,1,
+463,2,3,461,1,
+463,3,460,10,0,1,
+463,4,3,262,17,0,1,
+463,5,460,3,0,0,0,1,
+463,6,3,110,51,462,0,0,1,
+463,7,460,13,0,0,0,0,0,1,
+463,8,3,396,414,234,0,0,0,0,1,
+463,9,460,227,433,3,0,0,0,0,0,1,
+467,1,465,1,
+467,2,2,463,1,
+467,3,465,2,0,1,
+467,4,2,353,14,0,1,
+467,5,465,2,0,0,0,1,
+467,6,2,237,62,123,1,0,1,
+467,7,465,7,0,0,0,0,0,1,
+467,8,2,289,413,318,5,0,0,0,1,
+467,9,465,447,397,0,0,0,0,0,0,1,
+479,1,466,1,
+479,2,13,474,1,
+479,3,466,4,0,1,
+479,4,13,386,6,0,1,
+479,5,466,2,0,0,0,1,
+479,6,13,334,287,243,1,0,1,
+479,7,466,4,0,0,0,0,0,1,
+479,8,13,17,440,247,7,0,0,0,1,
+479,9,466,185,3,2,0,0,0,0,0,1,
+487,1,484,1,
+487,2,3,485,1,
+487,3,484,4,0,1,
+487,4,3,483,4,0,1,
+487,5,484,1,0,0,0,1,
+487,6,3,185,427,450,0,0,1,
+487,7,484,7,0,0,0,0,0,1,
+487,8,3,137,249,283,1,0,0,0,1,
+487,9,484,447,271,10,0,0,0,0,0,1,
+491,1,489,1,
+491,2,2,487,1,
+491,3,489,2,0,1,
+491,4,2,360,7,0,1,
+491,5,489,5,0,0,0,1,
+491,6,2,125,402,369,1,0,1,
+491,7,489,5,0,0,0,0,0,1,
+491,8,2,216,372,378,1,0,0,0,1,
+491,9,489,453,149,0,0,0,0,0,0,1,
+499,1,492,1,
+499,2,7,493,1,
+499,3,492,2,0,1,
+499,4,7,495,4,0,1,
+499,5,492,17,0,0,0,1,
+499,6,7,78,191,407,0,0,1,
+499,7,492,8,0,0,0,0,0,1,
+499,8,7,200,309,288,1,0,0,0,1,
+499,9,492,222,491,5,0,0,0,0,0,1,
+503,1,498,1,
+503,2,5,498,1,
+503,3,498,2,0,1,
+503,4,5,325,6,0,1,
+503,5,498,15,0,0,0,1,
+503,6,5,255,292,380,1,0,1,
+503,7,498,11,0,0,0,0,0,1,
+503,8,5,316,203,441,8,0,0,0,1,
+503,9,498,337,158,3,0,0,0,0,0,1,
+509,1,507,1,
+509,2,2,508,1,
+509,3,507,3,0,1,
+509,4,2,408,4,0,1,
+509,5,507,3,0,0,0,1,
+509,6,2,41,232,350,1,0,1,
+509,7,507,6,0,0,0,0,0,1,
+509,8,2,382,473,420,2,0,0,0,1,
+509,9,507,28,314,0,0,0,0,0,0,1,
+521,1,518,1,
+521,2,3,515,1,
+521,3,518,4,0,1,
+521,4,3,509,0,0,1,
+521,5,518,3,0,0,0,1,
+521,6,3,280,153,315,1,0,1,
+521,7,518,1,0,0,0,0,0,1,
+521,8,3,312,407,462,6,0,0,0,1,
+521,9,518,483,181,5,0,0,0,0,0,1,
+523,1,521,1,
+523,2,2,522,1,
+523,3,521,5,0,1,
+523,4,2,382,2,0,1,
+523,5,521,4,0,0,0,1,
+523,6,2,371,475,475,0,0,1,
+523,7,521,13,0,0,0,0,0,1,
+523,8,2,380,184,518,4,0,0,0,1,
+523,9,521,145,342,19,0,0,0,0,0,1,
+541,1,539,1,
+541,2,2,537,1,
+541,3,539,2,0,1,
+541,4,2,333,6,0,1,
+541,5,539,3,0,0,0,1,
+541,6,2,69,320,239,0,0,1,
+541,7,539,2,0,0,0,0,0,1,
+541,8,2,113,108,376,3,0,0,0,1,
+541,9,539,318,340,16,0,0,0,0,0,1,
+547,1,545,1,
+547,2,2,543,1,
+547,3,545,4,0,1,
+547,4,2,334,8,0,1,
+547,5,545,2,0,0,0,1,
+547,6,2,423,153,334,0,0,1,
+547,7,545,11,0,0,0,0,0,1,
+547,8,2,180,20,368,10,0,0,0,1,
+547,9,545,263,238,11,0,0,0,0,0,1,
+557,1,555,1,
+557,2,2,553,1,
+557,3,555,3,0,1,
+557,4,2,430,7,0,1,
+557,5,555,9,0,0,0,1,
+557,6,2,253,192,202,1,0,1,
+557,7,555,6,0,0,0,0,0,1,
+557,8,2,113,384,480,0,0,0,0,1,
+557,9,555,434,456,1,0,0,0,0,0,1,
+563,1,561,1,
+563,2,2,559,1,
+563,3,561,3,0,1,
+563,4,2,399,20,0,1,
+563,5,561,6,0,0,0,1,
+563,6,2,246,303,122,1,0,1,
+563,7,561,5,0,0,0,0,0,1,
+563,8,2,509,176,503,2,0,0,0,1,
+563,9,561,19,15,3,0,0,0,0,0,1,
+569,1,566,1,
+569,2,3,568,1,
+569,3,566,4,0,1,
+569,4,3,381,7,0,1,
+569,5,566,4,0,0,0,1,
+569,6,3,480,263,50,2,0,1,
+569,7,566,5,0,0,0,0,0,1,
+569,8,3,241,173,527,1,0,0,0,1,
+569,9,566,566,478,1,0,0,0,0,0,1,
+571,1,568,1,
+571,2,3,570,1,
+571,3,568,8,0,1,
+571,4,3,402,2,0,1,
+571,5,568,4,0,0,0,1,
+571,6,3,33,295,221,0,0,1,
+571,7,568,7,0,0,0,0,0,1,
+571,8,3,371,119,363,4,0,0,0,1,
+571,9,568,179,545,34,0,0,0,0,0,1,
+577,1,572,1,
+577,2,5,572,1,
+577,3,572,2,0,1,
+577,4,5,494,12,0,1,
+577,5,572,3,0,0,0,1,
+577,6,5,283,25,450,1,0,1,
+577,7,572,8,0,0,0,0,0,1,
+577,8,5,321,545,450,12,0,0,0,1,
+577,9,572,449,576,17,0,0,0,0,0,1,
+587,1,585,1,
+587,2,2,583,1,
+587,3,585,3,0,1,
+587,4,2,444,16,0,1,
+587,5,585,2,0,0,0,1,
+587,6,2,226,121,204,1,0,1,
+587,7,585,3,0,0,0,0,0,1,
+587,8,2,91,44,492,5,0,0,0,1,
+587,9,585,55,333,0,0,0,0,0,0,1,
+593,1,590,1,
+593,2,3,592,1,
+593,3,590,6,0,1,
+593,4,3,419,4,0,1,
+593,5,590,3,0,0,0,1,
+593,6,3,478,65,345,2,0,1,
+593,7,590,15,0,0,0,0,0,1,
+593,8,3,495,291,350,9,0,0,0,1,
+593,9,590,523,223,8,0,0,0,0,0,1,
+599,1,592,1,
+599,2,7,598,1,
+599,3,592,2,0,1,
+599,4,7,419,3,0,1,
+599,5,592,8,0,0,0,1,
+599,6,7,586,274,515,1,0,1,
+599,7,592,2,0,0,0,0,0,1,
+599,8,7,124,37,440,3,0,0,0,1,
+599,9,592,98,114,3,0,0,0,0,0,1,
+601,1,594,1,
+601,2,7,598,1,
+601,3,594,1,0,1,
+601,4,7,347,14,0,1,
+601,5,594,13,0,0,0,1,
+601,6,7,49,440,128,1,0,1,
+601,7,594,5,0,0,0,0,0,1,
+601,8,7,490,241,550,0,0,0,0,1,
+601,9,594,590,487,7,0,0,0,0,0,1,
+607,1,604,1,
+607,2,3,606,1,
+607,3,604,5,0,1,
+607,4,3,449,8,0,1,
+607,5,604,4,0,0,0,1,
+607,6,3,478,45,10,0,0,1,
+607,7,604,9,0,0,0,0,0,1,
+607,8,3,449,35,468,4,0,0,0,1,
+607,9,604,129,444,1,0,0,0,0,0,1,
+613,1,611,1,
+613,2,2,609,1,
+613,3,611,6,0,1,
+613,4,2,333,12,0,1,
+613,5,611,32,0,0,0,1,
+613,6,2,601,595,609,0,0,1,
+613,7,611,6,0,0,0,0,0,1,
+613,8,2,539,57,489,6,0,0,0,1,
+613,9,611,536,513,8,0,0,0,0,0,1,
+617,1,614,1,
+617,2,3,612,1,
+617,3,614,3,0,1,
+617,4,3,503,2,0,1,
+617,5,614,4,0,0,0,1,
+617,6,3,310,595,318,1,0,1,
+617,7,614,7,0,0,0,0,0,1,
+617,8,3,155,501,519,0,0,0,0,1,
+617,9,614,543,388,15,0,0,0,0,0,1,
+619,1,617,1,
+619,2,2,618,1,
+619,3,617,6,0,1,
+619,4,2,492,6,0,1,
+619,5,617,8,0,0,0,1,
+619,6,2,347,468,238,0,0,1,
+619,7,617,7,0,0,0,0,0,1,
+619,8,2,225,383,416,10,0,0,0,1,
+619,9,617,310,579,0,0,0,0,0,0,1,
+631,1,628,1,
+631,2,3,629,1,
+631,3,628,5,0,1,
+631,4,3,376,6,0,1,
+631,5,628,5,0,0,0,1,
+631,6,3,106,541,516,0,0,1,
+631,7,628,5,0,0,0,0,0,1,
+631,8,3,187,516,379,2,0,0,0,1,
+631,9,628,413,296,3,0,0,0,0,0,1,
+641,1,638,1,
+641,2,3,635,1,
+641,3,638,4,0,1,
+641,4,3,629,0,0,1,
+641,5,638,1,0,0,0,1,
+641,6,3,294,557,105,2,0,1,
+641,7,638,3,0,0,0,0,0,1,
+641,8,3,332,392,356,3,0,0,0,1,
+641,9,638,141,66,0,0,0,0,0,0,1,
+643,1,632,1,
+643,2,11,641,1,
+643,3,632,1,0,1,
+643,4,11,600,0,0,1,
+643,5,632,2,0,0,0,1,
+643,6,11,293,412,345,0,0,1,
+643,7,632,5,0,0,0,0,0,1,
+643,8,11,569,573,631,1,0,0,0,1,
+643,9,632,475,591,3,0,0,0,0,0,1,
+647,1,642,1,
+647,2,5,645,1,
+647,3,642,6,0,1,
+647,4,5,643,3,0,1,
+647,5,642,11,0,0,0,1,
+647,6,5,642,385,308,5,0,1,
+647,7,642,1,0,0,0,0,0,1,
+647,8,5,271,259,603,9,0,0,0,1,
+647,9,642,123,561,13,0,0,0,0,0,1,
+653,1,651,1,
+653,2,2,649,1,
+653,3,651,3,0,1,
+653,4,2,596,6,0,1,
+653,5,651,5,0,0,0,1,
+653,6,2,242,220,45,2,0,1,
+653,7,651,15,0,0,0,0,0,1,
+653,8,2,296,18,385,0,0,0,0,1,
+653,9,651,60,365,0,0,0,0,0,0,1,
+659,1,657,1,
+659,2,2,655,1,
+659,3,657,2,0,1,
+659,4,2,351,8,0,1,
+659,5,657,4,0,0,0,1,
+659,6,2,223,105,371,6,0,1,
+659,7,657,5,0,0,0,0,0,1,
+659,8,2,90,246,358,6,0,0,0,1,
+659,9,657,46,592,2,0,0,0,0,0,1,
+661,1,659,1,
+661,2,2,660,1,
+661,3,659,4,0,1,
+661,4,2,616,7,0,1,
+661,5,659,19,0,0,0,1,
+661,6,2,382,456,551,0,0,1,
+661,7,659,2,0,0,0,0,0,1,
+661,8,2,72,285,612,0,0,0,0,1,
+661,9,659,220,389,18,0,0,0,0,0,1,
+673,1,668,1,
+673,2,5,672,1,
+673,3,668,1,0,1,
+673,4,5,416,6,0,1,
+673,5,668,15,0,0,0,1,
+673,6,5,35,248,524,0,0,1,
+673,7,668,6,0,0,0,0,0,1,
+673,8,5,302,587,669,6,0,0,0,1,
+673,9,668,553,347,11,0,0,0,0,0,1,
+677,1,675,1,
+677,2,2,672,1,
+677,3,675,2,0,1,
+677,4,2,631,0,0,1,
+677,5,675,5,0,0,0,1,
+677,6,2,50,632,446,1,0,1,
+677,7,675,10,0,0,0,0,0,1,
+677,8,2,152,619,363,0,0,0,0,1,
+677,9,675,404,504,0,0,0,0,0,0,1,
+683,1,678,1,
+683,2,5,682,1,
+683,3,678,5,0,1,
+683,4,5,455,5,0,1,
+683,5,678,7,0,0,0,1,
+683,6,5,434,109,644,2,0,1,
+683,7,678,30,0,0,0,0,0,1,
+683,8,5,65,184,383,0,0,0,0,1,
+683,9,678,444,85,0,0,0,0,0,0,1,
+691,1,688,1,
+691,2,3,686,1,
+691,3,688,14,0,1,
+691,4,3,632,3,0,1,
+691,5,688,4,0,0,0,1,
+691,6,3,262,408,579,0,0,1,
+691,7,688,4,0,0,0,0,0,1,
+691,8,3,321,425,356,7,0,0,0,1,
+691,9,688,443,556,5,0,0,0,0,0,1,
+701,1,699,1,
+701,2,2,697,1,
+701,3,699,2,0,1,
+701,4,2,379,12,0,1,
+701,5,699,5,0,0,0,1,
+701,6,2,285,327,571,1,0,1,
+701,7,699,10,0,0,0,0,0,1,
+701,8,2,593,206,619,1,0,0,0,1,
+701,9,699,373,459,1,0,0,0,0,0,1,
+709,1,707,1,
+709,2,2,705,1,
+709,3,707,2,0,1,
+709,4,2,384,6,0,1,
+709,5,707,10,0,0,0,1,
+709,6,2,295,514,669,0,0,1,
+709,7,707,4,0,0,0,0,0,1,
+709,8,2,79,233,689,2,0,0,0,1,
+709,9,707,171,257,3,0,0,0,0,0,1,
+719,1,708,1,
+719,2,11,715,1,
+719,3,708,1,0,1,
+719,4,11,602,5,0,1,
+719,5,708,1,0,0,0,1,
+719,6,11,182,591,533,1,0,1,
+719,7,708,11,0,0,0,0,0,1,
+719,8,11,244,362,714,5,0,0,0,1,
+719,9,708,560,288,3,0,0,0,0,0,1,
+727,1,722,1,
+727,2,5,725,1,
+727,3,722,7,0,1,
+727,4,5,723,3,0,1,
+727,5,722,5,0,0,0,1,
+727,6,5,672,397,86,0,0,1,
+727,7,722,17,0,0,0,0,0,1,
+727,8,5,368,671,639,0,0,0,0,1,
+727,9,722,502,573,6,0,0,0,0,0,1,
+733,1,727,1,
+733,2,6,732,1,
+733,3,727,4,0,1,
+733,4,6,539,12,0,1,
+733,5,727,8,0,0,0,1,
+733,6,6,151,549,174,1,0,1,
+733,7,727,3,0,0,0,0,0,1,
+733,8,6,142,610,532,1,0,0,0,1,
+733,9,727,6,337,2,0,0,0,0,0,1,
+739,1,736,1,
+739,2,3,734,1,
+739,3,736,11,0,1,
+739,4,3,678,3,0,1,
+739,5,736,9,0,0,0,1,
+739,6,3,625,447,422,0,0,1,
+739,7,736,44,0,0,0,0,0,1,
+739,8,3,25,169,401,2,0,0,0,1,
+739,9,736,81,616,1,0,0,0,0,0,1,
+743,1,738,1,
+743,2,5,742,1,
+743,3,738,3,0,1,
+743,4,5,425,5,0,1,
+743,5,738,6,0,0,0,1,
+743,6,5,88,471,236,1,0,1,
+743,7,738,6,0,0,0,0,0,1,
+743,8,5,588,279,551,0,0,0,0,1,
+743,9,738,676,327,3,0,0,0,0,0,1,
+751,1,748,1,
+751,2,3,749,1,
+751,3,748,5,0,1,
+751,4,3,525,3,0,1,
+751,5,748,7,0,0,0,1,
+751,6,3,539,633,298,2,0,1,
+751,7,748,7,0,0,0,0,0,1,
+751,8,3,672,243,741,3,0,0,0,1,
+751,9,748,489,703,10,0,0,0,0,0,1,
+757,1,755,1,
+757,2,2,753,1,
+757,3,755,6,0,1,
+757,4,2,537,10,0,1,
+757,5,755,13,0,0,0,1,
+757,6,2,745,739,753,0,0,1,
+757,7,755,4,0,0,0,0,0,1,
+757,8,2,509,110,494,12,0,0,0,1,
+757,9,755,702,688,8,0,0,0,0,0,1,
+761,1,755,1,
+761,2,6,758,1,
+761,3,755,12,0,1,
+761,4,6,658,0,0,1,
+761,5,755,6,0,0,0,1,
+761,6,6,155,597,634,2,0,1,
+761,7,755,6,0,0,0,0,0,1,
+761,8,6,540,144,603,11,0,0,0,1,
+761,9,755,571,317,4,0,0,0,0,0,1,
+769,1,758,1,
+769,2,11,765,1,
+769,3,758,2,0,1,
+769,4,11,741,32,0,1,
+769,5,758,1,0,0,0,1,
+769,6,11,650,326,43,0,0,1,
+769,7,758,8,0,0,0,0,0,1,
+769,8,11,632,574,560,1,0,0,0,1,
+769,9,758,751,623,0,0,0,0,0,0,1,
+773,1,771,1,
+773,2,2,772,1,
+773,3,771,2,0,1,
+773,4,2,444,4,0,1,
+773,5,771,8,0,0,0,1,
+773,6,2,581,3,91,1,0,1,
+773,7,771,9,0,0,0,0,0,1,
+773,8,2,693,94,484,0,0,0,0,1,
+773,9,771,574,216,4,0,0,0,0,0,1,
+787,1,785,1,
+787,2,2,786,1,
+787,3,785,2,0,1,
+787,4,2,605,11,0,1,
+787,5,785,9,0,0,0,1,
+787,6,2,606,512,98,0,0,1,
+787,7,785,3,0,0,0,0,0,1,
+787,8,2,715,26,612,5,0,0,0,1,
+787,9,785,573,480,5,0,0,0,0,0,1,
+797,1,795,1,
+797,2,2,793,1,
+797,3,795,2,0,1,
+797,4,2,717,1,0,1,
+797,5,795,3,0,0,0,1,
+797,6,2,71,396,657,1,0,1,
+797,7,795,11,0,0,0,0,0,1,
+797,8,2,389,747,596,1,0,0,0,1,
+797,9,795,599,240,2,0,0,0,0,0,1,
+809,1,806,1,
+809,2,3,799,1,
+809,3,806,1,0,1,
+809,4,3,644,4,0,1,
+809,5,806,3,0,0,0,1,
+809,6,3,43,75,562,1,0,1,
+809,7,806,3,0,0,0,0,0,1,
+809,8,3,673,745,593,1,0,0,0,1,
+809,9,806,727,341,1,0,0,0,0,0,1,
+811,1,808,1,
+811,2,3,806,1,
+811,3,808,1,0,1,
+811,4,3,453,3,0,1,
+811,5,808,3,0,0,0,1,
+811,6,3,307,755,780,0,0,1,
+811,7,808,1,0,0,0,0,0,1,
+811,8,3,525,806,663,3,0,0,0,1,
+811,9,808,200,382,10,0,0,0,0,0,1,
+821,1,819,1,
+821,2,2,816,1,
+821,3,819,2,0,1,
+821,4,2,662,15,0,1,
+821,5,819,9,0,0,0,1,
+821,6,2,803,130,160,2,0,1,
+821,7,819,10,0,0,0,0,0,1,
+821,8,2,589,556,626,5,0,0,0,1,
+821,9,819,557,650,1,0,0,0,0,0,1,
+823,1,820,1,
+823,2,3,821,1,
+823,3,820,3,0,1,
+823,4,3,819,4,0,1,
+823,5,820,3,0,0,0,1,
+823,6,3,744,616,822,0,0,1,
+823,7,820,10,0,0,0,0,0,1,
+823,8,3,31,437,451,0,0,0,0,1,
+823,9,820,609,740,6,0,0,0,0,0,1,
+827,1,825,1,
+827,2,2,821,1,
+827,3,825,5,0,1,
+827,4,2,605,18,0,1,
+827,5,825,3,0,0,0,1,
+827,6,2,691,601,685,9,0,1,
+827,7,825,5,0,0,0,0,0,1,
+827,8,2,32,79,812,2,0,0,0,1,
+827,9,825,372,177,0,0,0,0,0,0,1,
+829,1,827,1,
+829,2,2,828,1,
+829,3,827,5,0,1,
+829,4,2,604,9,0,1,
+829,5,827,7,0,0,0,1,
+829,6,2,817,476,341,1,0,1,
+829,7,827,5,0,0,0,0,0,1,
+829,8,2,138,241,468,1,0,0,0,1,
+829,9,827,552,621,3,0,0,0,0,0,1,
+839,1,828,1,
+839,2,11,838,1,
+839,3,828,4,0,1,
+839,4,11,609,2,0,1,
+839,5,828,2,0,0,0,1,
+839,6,11,23,537,370,1,0,1,
+839,7,828,7,0,0,0,0,0,1,
+839,8,11,329,779,553,16,0,0,0,1,
+839,9,828,206,349,0,0,0,0,0,0,1,
+853,1,851,1,
+853,2,2,852,1,
+853,3,851,4,0,1,
+853,4,2,623,3,0,1,
+853,5,851,2,0,0,0,1,
+853,6,2,512,194,276,0,0,1,
+853,7,851,4,0,0,0,0,0,1,
+853,8,2,118,846,544,8,0,0,0,1,
+853,9,851,821,677,11,0,0,0,0,0,1,
+857,1,854,1,
+857,2,3,850,1,
+857,3,854,4,0,1,
+857,4,3,528,0,0,1,
+857,5,854,3,0,0,0,1,
+857,6,3,65,824,32,1,0,1,
+857,7,854,7,0,0,0,0,0,1,
+857,8,3,494,552,611,3,0,0,0,1,
+857,9,854,719,308,0,0,0,0,0,0,1,
+859,1,857,1,
+859,2,2,858,1,
+859,3,857,6,0,1,
+859,4,2,530,2,0,1,
+859,5,857,12,0,0,0,1,
+859,6,2,566,646,419,0,0,1,
+859,7,857,2,0,0,0,0,0,1,
+859,8,2,672,446,522,0,0,0,0,1,
+859,9,857,845,648,7,0,0,0,0,0,1,
+863,1,858,1,
+863,2,5,862,1,
+863,3,858,5,0,1,
+863,4,5,770,2,0,1,
+863,5,858,10,0,0,0,1,
+863,6,5,300,62,330,1,0,1,
+863,7,858,1,0,0,0,0,0,1,
+863,8,5,849,576,765,9,0,0,0,1,
+863,9,858,1,381,1,0,0,0,0,0,1,
+877,1,875,1,
+877,2,2,873,1,
+877,3,875,5,0,1,
+877,4,2,604,6,0,1,
+877,5,875,6,0,0,0,1,
+877,6,2,855,400,629,0,0,1,
+877,7,875,3,0,0,0,0,0,1,
+877,8,2,347,319,767,4,0,0,0,1,
+877,9,875,278,770,9,0,0,0,0,0,1,
+881,1,878,1,
+881,2,3,869,1,
+881,3,878,1,0,1,
+881,4,3,447,0,0,1,
+881,5,878,8,0,0,0,1,
+881,6,3,231,419,218,1,0,1,
+881,7,878,6,0,0,0,0,0,1,
+881,8,3,561,490,635,21,0,0,0,1,
+881,9,878,510,587,2,0,0,0,0,0,1,
+883,1,881,1,
+883,2,2,879,1,
+883,3,881,6,0,1,
+883,4,2,715,8,0,1,
+883,5,881,14,0,0,0,1,
+883,6,2,871,865,879,0,0,1,
+883,7,881,6,0,0,0,0,0,1,
+883,8,2,768,762,740,7,0,0,0,1,
+883,9,881,557,360,5,0,0,0,0,0,1,
+887,1,882,1,
+887,2,5,885,1,
+887,3,882,1,0,1,
+887,4,5,883,3,0,1,
+887,5,882,5,0,0,0,1,
+887,6,5,28,341,775,1,0,1,
+887,7,882,8,0,0,0,0,0,1,
+887,8,5,706,381,781,0,0,0,0,1,
+887,9,882,345,727,4,0,0,0,0,0,1,
+907,1,905,1,
+907,2,2,903,1,
+907,3,905,4,0,1,
+907,4,2,478,14,0,1,
+907,5,905,2,0,0,0,1,
+907,6,2,266,752,626,0,0,1,
+907,7,905,2,0,0,0,0,0,1,
+907,8,2,811,518,584,4,0,0,0,1,
+907,9,905,57,783,1,0,0,0,0,0,1,
+911,1,894,1,
+911,2,17,909,1,
+911,3,894,1,0,1,
+911,4,17,887,11,0,1,
+911,5,894,2,0,0,0,1,
+911,6,17,19,683,172,1,0,1,
+911,7,894,4,0,0,0,0,0,1,
+911,8,17,168,590,708,6,0,0,0,1,
+911,9,894,116,679,0,0,0,0,0,0,1,
+919,1,912,1,
+919,2,7,910,1,
+919,3,912,2,0,1,
+919,4,7,602,3,0,1,
+919,5,912,11,0,0,0,1,
+919,6,7,113,817,312,0,0,1,
+919,7,912,9,0,0,0,0,0,1,
+919,8,7,504,202,708,6,0,0,0,1,
+919,9,912,623,410,7,0,0,0,0,0,1,
+929,1,926,1,
+929,2,3,917,1,
+929,3,926,5,0,1,
+929,4,3,787,0,0,1,
+929,5,926,3,0,0,0,1,
+929,6,3,86,92,805,2,0,1,
+929,7,926,7,0,0,0,0,0,1,
+929,8,3,586,292,699,5,0,0,0,1,
+929,9,926,199,481,0,0,0,0,0,0,1,
+937,1,932,1,
+937,2,5,934,1,
+937,3,932,3,0,1,
+937,4,5,585,23,0,1,
+937,5,932,5,0,0,0,1,
+937,6,5,934,727,794,0,0,1,
+937,7,932,24,0,0,0,0,0,1,
+937,8,5,53,26,658,0,0,0,0,1,
+937,9,932,483,533,28,0,0,0,0,0,1,
+941,1,939,1,
+941,2,2,940,1,
+941,3,939,3,0,1,
+941,4,2,505,3,0,1,
+941,5,939,2,0,0,0,1,
+941,6,2,538,694,459,2,0,1,
+941,7,939,4,0,0,0,0,0,1,
+941,8,2,590,675,805,0,0,0,0,1,
+941,9,939,197,708,1,0,0,0,0,0,1,
+947,1,945,1,
+947,2,2,943,1,
+947,3,945,3,0,1,
+947,4,2,894,8,0,1,
+947,5,945,15,0,0,0,1,
+947,6,2,95,787,880,2,0,1,
+947,7,945,6,0,0,0,0,0,1,
+947,8,2,581,597,845,1,0,0,0,1,
+947,9,945,808,269,1,0,0,0,0,0,1,
+953,1,950,1,
+953,2,3,947,1,
+953,3,950,7,0,1,
+953,4,3,865,1,0,1,
+953,5,950,1,0,0,0,1,
+953,6,3,730,829,507,1,0,1,
+953,7,950,5,0,0,0,0,0,1,
+953,8,3,108,658,579,6,0,0,0,1,
+953,9,950,316,819,1,0,0,0,0,0,1,
+967,1,962,1,
+967,2,5,965,1,
+967,3,962,1,0,1,
+967,4,5,963,3,0,1,
+967,5,962,2,0,0,0,1,
+967,6,5,831,948,805,0,0,1,
+967,7,962,9,0,0,0,0,0,1,
+967,8,5,136,502,840,15,0,0,0,1,
+967,9,962,783,512,3,0,0,0,0,0,1,
+971,1,965,1,
+971,2,6,970,1,
+971,3,965,3,0,1,
+971,4,6,527,2,0,1,
+971,5,965,14,0,0,0,1,
+971,6,6,718,729,970,1,0,1,
+971,7,965,13,0,0,0,0,0,1,
+971,8,6,206,281,725,0,0,0,0,1,
+971,9,965,473,805,0,0,0,0,0,0,1,
+977,1,974,1,
+977,2,3,972,1,
+977,3,974,1,0,1,
+977,4,3,800,0,0,1,
+977,5,974,11,0,0,0,1,
+977,6,3,753,830,729,2,0,1,
+977,7,974,7,0,0,0,0,0,1,
+977,8,3,77,807,855,0,0,0,0,1,
+977,9,974,740,450,0,0,0,0,0,0,1,
+983,1,978,1,
+983,2,5,981,1,
+983,3,978,1,0,1,
+983,4,5,567,5,0,1,
+983,5,978,8,0,0,0,1,
+983,6,5,228,296,849,2,0,1,
+983,7,978,3,0,0,0,0,0,1,
+983,8,5,530,276,738,7,0,0,0,1,
+983,9,978,87,858,0,0,0,0,0,0,1,
+991,1,985,1,
+991,2,6,989,1,
+991,3,985,4,0,1,
+991,4,6,794,10,0,1,
+991,5,985,3,0,0,0,1,
+991,6,6,278,855,637,0,0,1,
+991,7,985,7,0,0,0,0,0,1,
+991,8,6,234,786,941,15,0,0,0,1,
+991,9,985,222,466,9,0,0,0,0,0,1,
+997,1,990,1,
+997,2,7,995,1,
+997,3,990,2,0,1,
+997,4,7,622,4,0,1,
+997,5,990,10,0,0,0,1,
+997,6,7,260,58,981,0,0,1,
+997,7,990,1,0,0,0,0,0,1,
+997,8,7,241,473,934,0,0,0,0,1,
+997,9,990,616,732,39,0,0,0,0,0,1,
+1009,1,998,1,
+1009,2,11,1008,1,
+1009,3,998,3,0,1,
+1009,4,11,825,14,0,1,
+1009,5,998,6,0,0,0,1,
+1009,6,11,509,515,850,0,0,1,
+1009,7,998,1,0,0,0,0,0,1,
+1009,9,998,627,634,2,0,0,0,0,0,1,
+1013,1,1010,1,
+1013,2,3,1006,1,
+1013,3,1010,7,0,1,
+1013,4,3,728,2,0,1,
+1013,5,1010,12,0,0,0,1,
+1013,6,3,319,230,17,2,0,1,
+1013,7,1010,7,0,0,0,0,0,1,
+1013,9,1010,451,396,9,0,0,0,0,0,1,
+1019,1,1017,1,
+1019,2,2,1015,1,
+1019,3,1017,3,0,1,
+1019,4,2,964,8,0,1,
+1019,5,1017,3,0,0,0,1,
+1019,6,2,384,359,996,1,0,1,
+1019,7,1017,9,0,0,0,0,0,1,
+1019,9,1017,549,971,0,0,0,0,0,0,1,
+1021,1,1011,1,
+1021,2,10,1020,1,
+1021,3,1011,3,0,1,
+1021,4,10,936,3,0,1,
+1021,5,1011,2,0,0,0,1,
+1021,6,10,862,66,684,0,0,1,
+1021,7,1011,1,0,0,0,0,0,1,
+1021,9,1011,628,395,2,0,0,0,0,0,1,
+1031,1,1017,1,
+1031,2,14,1029,1,
+1031,3,1017,4,0,1,
+1031,4,14,864,3,0,1,
+1031,5,1017,7,0,0,0,1,
+1031,6,14,327,378,721,4,0,1,
+1031,7,1017,1,0,0,0,0,0,1,
+1031,9,1017,158,823,5,0,0,0,0,0,1,
+1033,1,1028,1,
+1033,2,5,1030,1,
+1033,3,1028,2,0,1,
+1033,4,5,986,16,0,1,
+1033,5,1028,9,0,0,0,1,
+1033,6,5,204,680,697,0,0,1,
+1033,7,1028,13,0,0,0,0,0,1,
+1033,9,1028,331,447,11,0,0,0,0,0,1,
+1039,1,1036,1,
+1039,2,3,1033,1,
+1039,3,1036,3,0,1,
+1039,4,3,800,7,0,1,
+1039,5,1036,1,0,0,0,1,
+1039,6,3,703,447,1025,0,0,1,
+1039,7,1036,1,0,0,0,0,0,1,
+1039,9,1036,17,930,5,0,0,0,0,0,1,
+1049,1,1046,1,
+1049,2,3,1038,1,
+1049,3,1046,1,0,1,
+1049,4,3,929,4,0,1,
+1049,5,1046,1,0,0,0,1,
+1049,6,3,616,685,338,3,0,1,
+1049,7,1046,13,0,0,0,0,0,1,
+1049,9,1046,330,422,5,0,0,0,0,0,1,
+1051,1,1044,1,
+1051,2,7,1049,1,
+1051,3,1044,2,0,1,
+1051,4,7,994,6,0,1,
+1051,5,1044,8,0,0,0,1,
+1051,6,7,335,627,680,0,0,1,
+1051,7,1044,3,0,0,0,0,0,1,
+1051,9,1044,736,789,13,0,0,0,0,0,1,
+1061,1,1059,1,
+1061,2,2,1057,1,
+1061,3,1059,2,0,1,
+1061,4,2,649,6,0,1,
+1061,5,1059,11,0,0,0,1,
+1061,6,2,95,552,875,1,0,1,
+1061,7,1059,5,0,0,0,0,0,1,
+1061,9,1059,180,187,10,0,0,0,0,0,1,
+1063,1,1060,1,
+1063,2,3,1062,1,
+1063,3,1060,3,0,1,
+1063,4,3,628,2,0,1,
+1063,5,1060,3,0,0,0,1,
+1063,6,3,379,917,483,0,0,1,
+1063,7,1060,8,0,0,0,0,0,1,
+1063,9,1060,429,979,3,0,0,0,0,0,1,
+1069,1,1063,1,
+1069,2,6,1065,1,
+1069,3,1063,2,0,1,
+1069,4,6,1065,6,0,1,
+1069,5,1063,2,0,0,0,1,
+1069,6,6,497,137,686,0,0,1,
+1069,7,1063,4,0,0,0,0,0,1,
+1069,9,1063,452,896,4,0,0,0,0,0,1,
+1087,1,1084,1,
+1087,2,3,1085,1,
+1087,3,1084,6,0,1,
+1087,4,3,1079,10,0,1,
+1087,5,1084,23,0,0,0,1,
+1087,6,3,795,168,171,4,0,1,
+1087,7,1084,1,0,0,0,0,0,1,
+1087,9,1084,58,941,5,0,0,0,0,0,1,
+1091,1,1089,1,
+1091,2,2,1090,1,
+1091,3,1089,3,0,1,
+1091,4,2,947,2,0,1,
+1091,5,1089,2,0,0,0,1,
+1091,6,2,93,72,774,2,0,1,
+1091,7,1089,2,0,0,0,0,0,1,
+1091,9,1089,1053,784,0,0,0,0,0,0,1,
+1093,1,1088,1,
+1093,2,5,1092,1,
+1093,3,1088,3,0,1,
+1093,4,5,988,6,0,1,
+1093,5,1088,7,0,0,0,1,
+1093,6,5,199,119,720,0,0,1,
+1093,7,1088,5,0,0,0,0,0,1,
+1093,9,1088,635,840,39,0,0,0,0,0,1,
+1097,1,1094,1,
+1097,2,3,1096,1,
+1097,3,1094,1,0,1,
+1097,4,3,987,4,0,1,
+1097,5,1094,13,0,0,0,1,
+1097,6,3,74,641,91,1,0,1,
+1097,7,1094,1,0,0,0,0,0,1,
+1097,9,1094,625,17,0,0,0,0,0,0,1,
+1103,1,1098,1,
+1103,2,5,1091,1,
+1103,3,1098,6,0,1,
+1103,4,5,819,2,0,1,
+1103,5,1098,6,0,0,0,1,
+1103,6,5,698,931,796,1,0,1,
+1103,7,1098,23,0,0,0,0,0,1,
+1103,9,1098,789,448,2,0,0,0,0,0,1,
+1109,1,1107,1,
+1109,2,2,1108,1,
+1109,3,1107,3,0,1,
+1109,4,2,1102,8,0,1,
+1109,5,1107,2,0,0,0,1,
+1109,6,2,86,1031,1004,1,0,1,
+1109,7,1107,3,0,0,0,0,0,1,
+1109,9,1107,684,1050,3,0,0,0,0,0,1,
+1117,1,1115,1,
+1117,2,2,1113,1,
+1117,3,1115,4,0,1,
+1117,4,2,856,6,0,1,
+1117,5,1115,2,0,0,0,1,
+1117,6,2,12,1014,996,0,0,1,
+1117,7,1115,9,0,0,0,0,0,1,
+1117,9,1115,14,815,2,0,0,0,0,0,1,
+1123,1,1121,1,
+1123,2,2,1122,1,
+1123,3,1121,2,0,1,
+1123,4,2,1116,8,0,1,
+1123,5,1121,2,0,0,0,1,
+1123,6,2,536,187,918,0,0,1,
+1123,7,1121,3,0,0,0,0,0,1,
+1123,9,1121,964,522,1,0,0,0,0,0,1,
+1129,1,1118,1,
+1129,2,11,1124,1,
+1129,3,1118,3,0,1,
+1129,4,11,916,16,0,1,
+1129,5,1118,8,0,0,0,1,
+1129,6,11,366,139,1122,2,0,1,
+1129,7,1118,3,0,0,0,0,0,1,
+1129,9,1118,885,669,14,0,0,0,0,0,1,
+1151,1,1134,1,
+1151,2,17,1148,1,
+1151,3,1134,1,0,1,
+1151,4,17,687,4,0,1,
+1151,5,1134,1,0,0,0,1,
+1151,6,17,490,331,594,1,0,1,
+1151,7,1134,4,0,0,0,0,0,1,
+1151,9,1134,789,953,1,0,0,0,0,0,1,
+1153,1,1148,1,
+1153,2,5,1152,1,
+1153,3,1148,3,0,1,
+1153,4,5,870,29,0,1,
+1153,5,1148,1,0,0,0,1,
+1153,6,5,656,903,254,0,0,1,
+1153,7,1148,24,0,0,0,0,0,1,
+1153,9,1148,473,991,3,0,0,0,0,0,1,
+1163,1,1158,1,
+1163,2,5,1161,1,
+1163,3,1158,2,0,1,
+1163,4,5,1159,3,0,1,
+1163,5,1158,9,0,0,0,1,
+1163,6,5,919,503,226,2,0,1,
+1163,7,1158,1,0,0,0,0,0,1,
+1163,9,1158,238,281,2,0,0,0,0,0,1,
+1171,1,1169,1,
+1171,2,2,1167,1,
+1171,3,1169,2,0,1,
+1171,4,2,1112,8,0,1,
+1171,5,1169,2,0,0,0,1,
+1171,6,2,1049,594,1042,0,0,1,
+1171,7,1169,4,0,0,0,0,0,1,
+1171,9,1169,1092,580,0,0,0,0,0,0,1,
+1181,1,1174,1,
+1181,2,7,1180,1,
+1181,3,1174,1,0,1,
+1181,4,7,706,3,0,1,
+1181,5,1174,2,0,0,0,1,
+1181,6,7,903,1129,989,2,0,1,
+1181,7,1174,2,0,0,0,0,0,1,
+1181,9,1174,628,75,6,0,0,0,0,0,1,
+1187,1,1185,1,
+1187,2,2,1181,1,
+1187,3,1185,4,0,1,
+1187,4,2,758,4,0,1,
+1187,5,1185,5,0,0,0,1,
+1187,6,2,324,472,882,2,0,1,
+1187,7,1185,7,0,0,0,0,0,1,
+1187,9,1185,699,213,4,0,0,0,0,0,1,
+1193,1,1190,1,
+1193,2,3,1187,1,
+1193,3,1190,4,0,1,
+1193,4,3,826,11,0,1,
+1193,5,1190,11,0,0,0,1,
+1193,6,3,148,475,1120,2,0,1,
+1193,7,1190,15,0,0,0,0,0,1,
+1193,9,1190,12,1185,3,0,0,0,0,0,1,
+1201,1,1190,1,
+1201,2,11,1192,1,
+1201,3,1190,2,0,1,
+1201,4,11,1006,20,0,1,
+1201,5,1190,17,0,0,0,1,
+1201,6,11,985,428,917,0,0,1,
+1201,7,1190,6,0,0,0,0,0,1,
+1201,9,1190,575,1090,0,0,0,0,0,0,1,
+1213,1,1211,1,
+1213,2,2,1209,1,
+1213,3,1211,4,0,1,
+1213,4,2,879,9,0,1,
+1213,5,1211,6,0,0,0,1,
+1213,6,2,72,125,608,0,0,1,
+1213,7,1211,9,0,0,0,0,0,1,
+1213,9,1211,1169,1122,5,0,0,0,0,0,1,
+1217,1,1214,1,
+1217,2,3,1211,1,
+1217,3,1214,3,0,1,
+1217,4,3,888,9,0,1,
+1217,5,1214,3,0,0,0,1,
+1217,6,3,1080,782,304,2,0,1,
+1217,7,1214,1,0,0,0,0,0,1,
+1217,9,1214,143,1200,0,0,0,0,0,0,1,
+1223,1,1218,1,
+1223,2,5,1220,1,
+1223,3,1218,2,0,1,
+1223,4,5,715,4,0,1,
+1223,5,1218,2,0,0,0,1,
+1223,6,5,761,50,1041,2,0,1,
+1223,7,1218,8,0,0,0,0,0,1,
+1223,9,1218,675,154,4,0,0,0,0,0,1,
+1229,1,1227,1,
+1229,2,2,1225,1,
+1229,3,1227,3,0,1,
+1229,4,2,1159,6,0,1,
+1229,5,1227,7,0,0,0,1,
+1229,6,2,400,1219,1216,1,0,1,
+1229,7,1227,19,0,0,0,0,0,1,
+1229,9,1227,953,983,0,0,0,0,0,0,1,
+1231,1,1228,1,
+1231,2,3,1229,1,
+1231,3,1228,3,0,1,
+1231,4,3,662,3,0,1,
+1231,5,1228,5,0,0,0,1,
+1231,6,3,1162,399,1152,0,0,1,
+1231,7,1228,1,0,0,0,0,0,1,
+1231,9,1228,85,1121,24,0,0,0,0,0,1,
+1237,1,1235,1,
+1237,2,2,1236,1,
+1237,3,1235,4,0,1,
+1237,4,2,960,6,0,1,
+1237,5,1235,4,0,0,0,1,
+1237,6,2,346,117,849,0,0,1,
+1237,7,1235,22,0,0,0,0,0,1,
+1237,9,1235,46,1163,10,0,0,0,0,0,1,
+1249,1,1242,1,
+1249,2,7,1246,1,
+1249,3,1242,5,0,1,
+1249,4,7,792,17,0,1,
+1249,5,1242,1,0,0,0,1,
+1249,6,7,439,679,474,0,0,1,
+1249,7,1242,2,0,0,0,0,0,1,
+1249,9,1242,240,1149,0,0,0,0,0,0,1,
+1259,1,1257,1,
+1259,2,2,1258,1,
+1259,3,1257,3,0,1,
+1259,4,2,1049,6,0,1,
+1259,5,1257,5,0,0,0,1,
+1259,6,2,1187,1008,1191,1,0,1,
+1259,7,1257,5,0,0,0,0,0,1,
+1259,9,1257,864,794,2,0,0,0,0,0,1,
+1277,1,1275,1,
+1277,2,2,1276,1,
+1277,3,1275,2,0,1,
+1277,4,2,753,4,0,1,
+1277,5,1275,9,0,0,0,1,
+1277,6,2,500,456,996,2,0,1,
+1277,7,1275,20,0,0,0,0,0,1,
+1277,9,1275,1270,428,0,0,0,0,0,0,1,
+1279,1,1276,1,
+1279,2,3,1277,1,
+1279,3,1276,6,0,1,
+1279,4,3,916,6,0,1,
+1279,5,1276,4,0,0,0,1,
+1279,6,3,871,896,159,0,0,1,
+1279,7,1276,7,0,0,0,0,0,1,
+1279,9,1276,336,1118,0,0,0,0,0,0,1,
+1283,1,1281,1,
+1283,2,2,1279,1,
+1283,3,1281,3,0,1,
+1283,4,2,672,8,0,1,
+1283,5,1281,3,0,0,0,1,
+1283,6,2,386,536,842,1,0,1,
+1283,7,1281,2,0,0,0,0,0,1,
+1283,9,1281,1259,1145,1,0,0,0,0,0,1,
+1289,1,1283,1,
+1289,2,6,1280,1,
+1289,3,1283,6,0,1,
+1289,4,6,1105,3,0,1,
+1289,5,1283,16,0,0,0,1,
+1289,6,6,314,308,1117,1,0,1,
+1289,7,1283,4,0,0,0,0,0,1,
+1289,9,1283,179,659,3,0,0,0,0,0,1,
+1291,1,1289,1,
+1291,2,2,1290,1,
+1291,3,1289,5,0,1,
+1291,4,2,899,6,0,1,
+1291,5,1289,5,0,0,0,1,
+1291,6,2,183,1164,1044,0,0,1,
+1291,7,1289,4,0,0,0,0,0,1,
+1291,9,1289,607,646,4,0,0,0,0,0,1,
+1297,1,1287,1,
+1297,2,10,1294,1,
+1297,3,1287,2,0,1,
+1297,4,10,807,8,0,1,
+1297,5,1287,1,0,0,0,1,
+1297,6,10,531,428,797,0,0,1,
+1297,7,1287,2,0,0,0,0,0,1,
+1297,9,1287,709,1093,6,0,0,0,0,0,1,
+1301,1,1299,1,
+1301,2,2,1295,1,
+1301,3,1299,7,0,1,
+1301,4,2,1152,3,0,1,
+1301,5,1299,3,0,0,0,1,
+1301,6,2,160,635,1068,1,0,1,
+1301,7,1299,8,0,0,0,0,0,1,
+1301,9,1299,1293,1108,10,0,0,0,0,0,1,
+1303,1,1297,1,
+1303,2,6,1302,1,
+1303,3,1297,2,0,1,
+1303,4,6,816,2,0,1,
+1303,5,1297,2,0,0,0,1,
+1303,6,6,1092,1278,1228,0,0,1,
+1303,7,1297,4,0,0,0,0,0,1,
+1303,9,1297,300,865,0,0,0,0,0,0,1,
+1307,1,1305,1,
+1307,2,2,1306,1,
+1307,3,1305,2,0,1,
+1307,4,2,844,4,0,1,
+1307,5,1305,4,0,0,0,1,
+1307,6,2,65,788,130,3,0,1,
+1307,7,1305,6,0,0,0,0,0,1,
+1307,9,1305,958,743,0,0,0,0,0,0,1,
+1319,1,1306,1,
+1319,2,13,1316,1,
+1319,3,1306,1,0,1,
+1319,4,13,1015,5,0,1,
+1319,5,1306,2,0,0,0,1,
+1319,6,13,576,1005,957,1,0,1,
+1319,7,1306,6,0,0,0,0,0,1,
+1319,9,1306,408,1211,0,0,0,0,0,0,1,
+1321,1,1308,1,
+1321,2,13,1320,1,
+1321,3,1308,5,0,1,
+1321,4,13,1223,8,0,1,
+1321,5,1308,1,0,0,0,1,
+1321,6,13,683,1020,1055,0,0,1,
+1321,7,1308,6,0,0,0,0,0,1,
+1321,9,1308,1130,1162,7,0,0,0,0,0,1,
+1327,1,1324,1,
+1327,2,3,1326,1,
+1327,3,1324,1,0,1,
+1327,4,3,724,2,0,1,
+1327,5,1324,9,0,0,0,1,
+1327,6,3,665,911,1208,0,0,1,
+1327,7,1324,4,0,0,0,0,0,1,
+1327,9,1324,1153,605,12,0,0,0,0,0,1,
+1361,1,1358,1,
+1361,2,3,1355,1,
+1361,3,1358,13,0,1,
+1361,4,3,1349,0,0,1,
+1361,5,1358,29,0,0,0,1,
+1361,6,3,124,977,824,1,0,1,
+1361,7,1358,22,0,0,0,0,0,1,
+1361,9,1358,164,34,3,0,0,0,0,0,1,
+1367,1,1362,1,
+1367,2,5,1365,1,
+1367,3,1362,1,0,1,
+1367,4,5,1022,8,0,1,
+1367,5,1362,2,0,0,0,1,
+1367,6,5,1108,514,507,2,0,1,
+1367,7,1362,8,0,0,0,0,0,1,
+1367,9,1362,407,1250,3,0,0,0,0,0,1,
+1373,1,1371,1,
+1373,2,2,1365,1,
+1373,3,1371,7,0,1,
+1373,4,2,1269,11,0,1,
+1373,5,1371,2,0,0,0,1,
+1373,6,2,1177,567,874,2,0,1,
+1373,7,1371,9,0,0,0,0,0,1,
+1373,9,1371,104,1202,3,0,0,0,0,0,1,
+1381,1,1379,1,
+1381,2,2,1377,1,
+1381,3,1379,4,0,1,
+1381,4,2,1307,10,0,1,
+1381,5,1379,2,0,0,0,1,
+1381,6,2,746,1373,168,1,0,1,
+1381,7,1379,12,0,0,0,0,0,1,
+1381,9,1379,723,970,15,0,0,0,0,0,1,
+1399,1,1386,1,
+1399,2,13,1395,1,
+1399,3,1386,3,0,1,
+1399,4,13,964,14,0,1,
+1399,5,1386,28,0,0,0,1,
+1399,6,13,1222,533,1164,0,0,1,
+1399,7,1386,5,0,0,0,0,0,1,
+1399,9,1386,111,696,8,0,0,0,0,0,1,
+1409,1,1406,1,
+1409,2,3,1404,1,
+1409,3,1406,1,0,1,
+1409,4,3,968,2,0,1,
+1409,5,1406,10,0,0,0,1,
+1409,6,3,156,1165,624,1,0,1,
+1409,7,1406,40,0,0,0,0,0,1,
+1409,9,1406,55,778,1,0,0,0,0,0,1,
+1423,1,1420,1,
+1423,2,3,1421,1,
+1423,3,1420,7,0,1,
+1423,4,3,1419,4,0,1,
+1423,5,1420,10,0,0,0,1,
+1423,6,3,169,1041,1357,2,0,1,
+1423,7,1420,4,0,0,0,0,0,1,
+1423,9,1420,730,830,21,0,0,0,0,0,1,
+1427,1,1425,1,
+1427,2,2,1426,1,
+1427,3,1425,2,0,1,
+1427,4,2,1089,13,0,1,
+1427,5,1425,21,0,0,0,1,
+1427,6,2,770,1252,250,5,0,1,
+1427,7,1425,10,0,0,0,0,0,1,
+1427,9,1425,1056,747,1,0,0,0,0,0,1,
+1429,1,1423,1,
+1429,2,6,1425,1,
+1429,3,1423,2,0,1,
+1429,4,6,1425,6,0,1,
+1429,5,1423,12,0,0,0,1,
+1429,6,6,1301,716,1226,1,0,1,
+1429,7,1423,2,0,0,0,0,0,1,
+1429,9,1423,469,1214,1,0,0,0,0,0,1,
+1433,1,1430,1,
+1433,2,3,1420,1,
+1433,3,1430,19,0,1,
+1433,4,3,883,3,0,1,
+1433,5,1430,12,0,0,0,1,
+1433,6,3,74,937,1421,1,0,1,
+1433,7,1430,28,0,0,0,0,0,1,
+1433,9,1430,283,456,0,0,0,0,0,0,1,
+1439,1,1432,1,
+1439,2,7,1438,1,
+1439,3,1432,7,0,1,
+1439,4,7,1430,4,0,1,
+1439,5,1432,2,0,0,0,1,
+1439,6,7,1336,31,1267,1,0,1,
+1439,7,1432,9,0,0,0,0,0,1,
+1439,9,1432,451,1118,0,0,0,0,0,0,1,
+1447,1,1444,1,
+1447,2,3,1446,1,
+1447,3,1444,3,0,1,
+1447,4,3,909,5,0,1,
+1447,5,1444,6,0,0,0,1,
+1447,6,3,1246,33,430,0,0,1,
+1447,7,1444,1,0,0,0,0,0,1,
+1447,9,1444,750,1300,10,0,0,0,0,0,1,
+1451,1,1449,1,
+1451,2,2,1446,1,
+1451,3,1449,9,0,1,
+1451,4,2,759,3,0,1,
+1451,5,1449,20,0,0,0,1,
+1451,6,2,1094,208,615,6,0,1,
+1451,7,1449,5,0,0,0,0,0,1,
+1451,9,1449,15,193,2,0,0,0,0,0,1,
+1453,1,1451,1,
+1453,2,2,1449,1,
+1453,3,1451,6,0,1,
+1453,4,2,1368,9,0,1,
+1453,5,1451,4,0,0,0,1,
+1453,6,2,1441,1435,1449,0,0,1,
+1453,7,1451,15,0,0,0,0,0,1,
+1453,9,1451,23,1381,6,0,0,0,0,0,1,
+1459,1,1456,1,
+1459,2,3,1458,1,
+1459,3,1456,3,0,1,
+1459,4,3,855,7,0,1,
+1459,5,1456,21,0,0,0,1,
+1459,6,3,406,1309,629,0,0,1,
+1459,7,1456,10,0,0,0,0,0,1,
+1459,9,1456,73,1115,2,0,0,0,0,0,1,
+1471,1,1465,1,
+1471,2,6,1470,1,
+1471,3,1465,1,0,1,
+1471,4,6,1287,2,0,1,
+1471,5,1465,3,0,0,0,1,
+1471,6,6,1228,728,969,0,0,1,
+1471,7,1465,2,0,0,0,0,0,1,
+1471,9,1465,1362,599,34,0,0,0,0,0,1,
+1481,1,1478,1,
+1481,2,3,1480,1,
+1481,3,1478,5,0,1,
+1481,4,3,1372,4,0,1,
+1481,5,1478,17,0,0,0,1,
+1481,6,3,1021,855,1436,1,0,1,
+1481,7,1478,12,0,0,0,0,0,1,
+1481,9,1478,968,651,4,0,0,0,0,0,1,
+1483,1,1481,1,
+1483,2,2,1482,1,
+1483,3,1481,2,0,1,
+1483,4,2,1170,14,0,1,
+1483,5,1481,3,0,0,0,1,
+1483,6,2,541,996,1168,0,0,1,
+1483,7,1481,11,0,0,0,0,0,1,
+1483,9,1481,1452,1464,7,0,0,0,0,0,1,
+1487,1,1482,1,
+1487,2,5,1485,1,
+1487,3,1482,2,0,1,
+1487,4,5,1483,3,0,1,
+1487,5,1482,11,0,0,0,1,
+1487,6,5,1289,808,1194,1,0,1,
+1487,7,1482,11,0,0,0,0,0,1,
+1487,9,1482,866,1283,9,0,0,0,0,0,1,
+1489,1,1475,1,
+1489,2,14,1487,1,
+1489,3,1475,2,0,1,
+1489,4,14,1299,9,0,1,
+1489,5,1475,2,0,0,0,1,
+1489,6,14,1485,269,254,0,0,1,
+1489,7,1475,1,0,0,0,0,0,1,
+1489,9,1475,61,1192,7,0,0,0,0,0,1,
+1493,1,1491,1,
+1493,2,2,1485,1,
+1493,3,1491,11,0,1,
+1493,4,2,1120,3,0,1,
+1493,5,1491,5,0,0,0,1,
+1493,6,2,102,499,465,1,0,1,
+1493,7,1491,3,0,0,0,0,0,1,
+1493,9,1491,701,1377,0,0,0,0,0,0,1,
+1499,1,1497,1,
+1499,2,2,1495,1,
+1499,3,1497,2,0,1,
+1499,4,2,1270,7,0,1,
+1499,5,1497,6,0,0,0,1,
+1499,6,2,844,588,698,1,0,1,
+1499,7,1497,2,0,0,0,0,0,1,
+1499,9,1497,1196,1357,7,0,0,0,0,0,1,
+1511,1,1500,1,
+1511,2,11,1509,1,
+1511,3,1500,2,0,1,
+1511,4,11,1433,3,0,1,
+1511,5,1500,5,0,0,0,1,
+1511,6,11,1032,1278,106,1,0,1,
+1511,7,1500,16,0,0,0,0,0,1,
+1511,9,1500,403,142,7,0,0,0,0,0,1,
+1523,1,1521,1,
+1523,2,2,1518,1,
+1523,3,1521,7,0,1,
+1523,4,2,1123,0,0,1,
+1523,5,1521,4,0,0,0,1,
+1523,6,2,1226,1518,67,1,0,1,
+1523,7,1521,28,0,0,0,0,0,1,
+1523,9,1521,1286,573,1,0,0,0,0,0,1,
+1531,1,1529,1,
+1531,2,2,1530,1,
+1531,3,1529,6,0,1,
+1531,4,2,948,2,0,1,
+1531,5,1529,3,0,0,0,1,
+1531,6,2,827,122,1129,3,0,1,
+1531,7,1529,2,0,0,0,0,0,1,
+1531,9,1529,314,1400,7,0,0,0,0,0,1,
+1543,1,1538,1,
+1543,2,5,1541,1,
+1543,3,1538,2,0,1,
+1543,4,5,1539,3,0,1,
+1543,5,1538,15,0,0,0,1,
+1543,6,5,796,1363,1391,0,0,1,
+1543,7,1538,5,0,0,0,0,0,1,
+1543,9,1538,132,1157,7,0,0,0,0,0,1,
+1549,1,1547,1,
+1549,2,2,1541,1,
+1549,3,1547,5,0,1,
+1549,4,2,1336,0,0,1,
+1549,5,1547,5,0,0,0,1,
+1549,6,2,1191,987,1422,0,0,1,
+1549,7,1547,3,0,0,0,0,0,1,
+1549,9,1547,311,1322,9,0,0,0,0,0,1,
+1553,1,1550,1,
+1553,2,3,1552,1,
+1553,3,1550,1,0,1,
+1553,4,3,1330,4,0,1,
+1553,5,1550,9,0,0,0,1,
+1553,6,3,804,1242,904,2,0,1,
+1553,7,1550,8,0,0,0,0,0,1,
+1553,9,1550,1399,643,0,0,0,0,0,0,1,
+1559,1,1540,1,
+1559,2,19,1558,1,
+1559,3,1540,3,0,1,
+1559,4,19,1107,2,0,1,
+1559,5,1540,1,0,0,0,1,
+1559,6,19,1236,514,1237,1,0,1,
+1559,7,1540,2,0,0,0,0,0,1,
+1559,9,1540,1473,514,3,0,0,0,0,0,1,
+1567,1,1564,1,
+1567,2,3,1565,1,
+1567,3,1564,4,0,1,
+1567,4,3,1563,4,0,1,
+1567,5,1564,6,0,0,0,1,
+1567,6,3,988,1370,855,0,0,1,
+1567,7,1564,18,0,0,0,0,0,1,
+1567,9,1564,278,1384,5,0,0,0,0,0,1,
+1571,1,1569,1,
+1571,2,2,1570,1,
+1571,3,1569,3,0,1,
+1571,4,2,838,2,0,1,
+1571,5,1569,17,0,0,0,1,
+1571,6,2,1460,986,1541,1,0,1,
+1571,7,1569,7,0,0,0,0,0,1,
+1571,9,1569,113,601,6,0,0,0,0,0,1,
+1579,1,1576,1,
+1579,2,3,1578,1,
+1579,3,1576,11,0,1,
+1579,4,3,1447,6,0,1,
+1579,5,1576,8,0,0,0,1,
+1579,6,3,234,358,1245,0,0,1,
+1579,7,1576,1,0,0,0,0,0,1,
+1579,9,1576,666,1226,0,0,0,0,0,0,1,
+1583,1,1578,1,
+1583,2,5,1581,1,
+1583,3,1578,1,0,1,
+1583,4,5,1579,3,0,1,
+1583,5,1578,2,0,0,0,1,
+1583,6,5,466,898,271,1,0,1,
+1583,7,1578,7,0,0,0,0,0,1,
+1583,9,1578,719,1438,1,0,0,0,0,0,1,
+1597,1,1586,1,
+1597,2,11,1594,1,
+1597,3,1586,5,0,1,
+1597,4,11,1270,1,0,1,
+1597,5,1586,2,0,0,0,1,
+1597,6,11,567,200,793,0,0,1,
+1597,7,1586,11,0,0,0,0,0,1,
+1597,9,1586,611,1205,9,0,0,0,0,0,1,
+1601,1,1598,1,
+1601,2,3,1600,1,
+1601,3,1598,15,0,1,
+1601,4,3,962,7,0,1,
+1601,5,1598,5,0,0,0,1,
+1601,6,3,830,956,296,2,0,1,
+1601,7,1598,1,0,0,0,0,0,1,
+1601,9,1598,1120,603,5,0,0,0,0,0,1,
+1607,1,1602,1,
+1607,2,5,1605,1,
+1607,3,1602,3,0,1,
+1607,4,5,1595,11,0,1,
+1607,5,1602,26,0,0,0,1,
+1607,6,5,1182,923,203,1,0,1,
+1607,7,1602,2,0,0,0,0,0,1,
+1607,9,1602,508,1279,1,0,0,0,0,0,1,
+1609,1,1602,1,
+1609,2,7,1597,1,
+1609,3,1602,4,0,1,
+1609,4,7,1277,5,0,1,
+1609,5,1602,8,0,0,0,1,
+1609,6,7,490,1348,872,0,0,1,
+1609,7,1602,2,0,0,0,0,0,1,
+1609,9,1602,518,1578,7,0,0,0,0,0,1,
+1613,1,1610,1,
+1613,2,3,1606,1,
+1613,3,1610,4,0,1,
+1613,4,3,1279,0,0,1,
+1613,5,1610,14,0,0,0,1,
+1613,6,3,812,1085,1532,2,0,1,
+1613,7,1610,10,0,0,0,0,0,1,
+1613,9,1610,734,563,5,0,0,0,0,0,1,
+1619,1,1617,1,
+1619,2,2,1615,1,
+1619,3,1617,2,0,1,
+1619,4,2,1410,8,0,1,
+1619,5,1617,3,0,0,0,1,
+1619,6,2,20,1190,330,1,0,1,
+1619,7,1617,6,0,0,0,0,0,1,
+1619,9,1617,277,281,9,0,0,0,0,0,1,
+1621,1,1619,1,
+1621,2,2,1617,1,
+1621,3,1619,4,0,1,
+1621,4,2,957,6,0,1,
+1621,5,1619,3,0,0,0,1,
+1621,6,2,1208,679,1337,0,0,1,
+1621,7,1619,13,0,0,0,0,0,1,
+1621,9,1619,3,1605,5,0,0,0,0,0,1,
+1627,1,1624,1,
+1627,2,3,1622,1,
+1627,3,1624,1,0,1,
+1627,4,3,1176,3,0,1,
+1627,5,1624,5,0,0,0,1,
+1627,6,3,1257,265,1071,0,0,1,
+1627,7,1624,11,0,0,0,0,0,1,
+1627,9,1624,398,1354,0,0,0,0,0,0,1,
+1637,1,1635,1,
+1637,2,2,1633,1,
+1637,3,1635,2,0,1,
+1637,4,2,864,1,0,1,
+1637,5,1635,4,0,0,0,1,
+1637,6,2,1387,1455,1448,1,0,1,
+1637,7,1635,7,0,0,0,0,0,1,
+1637,9,1635,1263,1123,5,0,0,0,0,0,1,
+1657,1,1646,1,
+1657,2,11,1655,1,
+1657,3,1646,1,0,1,
+1657,4,11,915,13,0,1,
+1657,5,1646,8,0,0,0,1,
+1657,6,11,692,904,988,2,0,1,
+1657,7,1646,7,0,0,0,0,0,1,
+1657,9,1646,1018,956,7,0,0,0,0,0,1,
+1663,1,1660,1,
+1663,2,3,1662,1,
+1663,3,1660,3,0,1,
+1663,4,3,1534,2,0,1,
+1663,5,1660,4,0,0,0,1,
+1663,6,3,1371,1128,1471,0,0,1,
+1663,7,1660,10,0,0,0,0,0,1,
+1663,9,1660,559,1500,19,0,0,0,0,0,1,
+1667,1,1665,1,
+1667,2,2,1663,1,
+1667,3,1665,3,0,1,
+1667,4,2,1267,8,0,1,
+1667,5,1665,9,0,0,0,1,
+1667,6,2,255,1656,1508,1,0,1,
+1667,7,1665,3,0,0,0,0,0,1,
+1667,9,1665,1126,602,1,0,0,0,0,0,1,
+1669,1,1667,1,
+1669,2,2,1665,1,
+1669,3,1667,4,0,1,
+1669,4,2,880,6,0,1,
+1669,5,1667,8,0,0,0,1,
+1669,6,2,163,99,1328,0,0,1,
+1669,7,1667,4,0,0,0,0,0,1,
+1669,9,1667,852,689,6,0,0,0,0,0,1,
+1693,1,1691,1,
+1693,2,2,1692,1,
+1693,3,1691,2,0,1,
+1693,4,2,1539,3,0,1,
+1693,5,1691,3,0,0,0,1,
+1693,6,2,422,793,1299,0,0,1,
+1693,7,1691,11,0,0,0,0,0,1,
+1693,9,1691,242,1558,10,0,0,0,0,0,1,
+1697,1,1694,1,
+1697,2,3,1692,1,
+1697,3,1694,3,0,1,
+1697,4,3,1208,17,0,1,
+1697,5,1694,15,0,0,0,1,
+1697,6,3,22,42,1228,1,0,1,
+1697,7,1694,3,0,0,0,0,0,1,
+1697,9,1694,806,255,3,0,0,0,0,0,1,
+1699,1,1696,1,
+1699,2,3,1686,1,
+1699,3,1696,3,0,1,
+1699,4,3,1506,3,0,1,
+1699,5,1696,13,0,0,0,1,
+1699,6,3,99,299,590,0,0,1,
+1699,7,1696,1,0,0,0,0,0,1,
+1699,9,1696,855,1498,22,0,0,0,0,0,1,
+1709,1,1706,1,
+1709,2,3,1696,1,
+1709,3,1706,1,0,1,
+1709,4,3,1199,0,0,1,
+1709,5,1706,5,0,0,0,1,
+1709,6,3,176,1012,1460,1,0,1,
+1709,7,1706,6,0,0,0,0,0,1,
+1709,9,1706,188,658,3,0,0,0,0,0,1,
+1721,1,1718,1,
+1721,2,3,1716,1,
+1721,3,1718,3,0,1,
+1721,4,3,1662,2,0,1,
+1721,5,1718,5,0,0,0,1,
+1721,6,3,1363,1406,424,1,0,1,
+1721,7,1718,11,0,0,0,0,0,1,
+1721,9,1718,182,1597,6,0,0,0,0,0,1,
+1723,1,1720,1,
+1723,2,3,1722,1,
+1723,3,1720,1,0,1,
+1723,4,3,1046,2,0,1,
+1723,5,1720,1,0,0,0,1,
+1723,6,3,79,102,1250,2,0,1,
+1723,7,1720,13,0,0,0,0,0,1,
+1723,9,1720,331,1513,1,0,0,0,0,0,1,
+1733,1,1731,1,
+1733,2,2,1726,1,
+1733,3,1731,16,0,1,
+1733,4,2,1072,2,0,1,
+1733,5,1731,9,0,0,0,1,
+1733,6,2,1679,69,1638,1,0,1,
+1733,7,1731,7,0,0,0,0,0,1,
+1733,9,1731,1640,728,1,0,0,0,0,0,1,
+1741,1,1739,1,
+1741,2,2,1740,1,
+1741,3,1739,5,0,1,
+1741,4,2,1477,9,0,1,
+1741,5,1739,17,0,0,0,1,
+1741,6,2,1515,1720,1643,0,0,1,
+1741,7,1739,25,0,0,0,0,0,1,
+1741,9,1739,169,868,4,0,0,0,0,0,1,
+1747,1,1745,1,
+1747,2,2,1743,1,
+1747,3,1745,5,0,1,
+1747,4,2,1426,8,0,1,
+1747,5,1745,6,0,0,0,1,
+1747,6,2,1284,142,545,1,0,1,
+1747,7,1745,4,0,0,0,0,0,1,
+1747,9,1745,1407,1329,2,0,0,0,0,0,1,
+1753,1,1746,1,
+1753,2,7,1746,1,
+1753,3,1746,1,0,1,
+1753,4,7,951,14,0,1,
+1753,5,1746,1,0,0,0,1,
+1753,6,7,1199,1699,1534,0,0,1,
+1753,7,1746,2,0,0,0,0,0,1,
+1753,9,1746,639,1196,25,0,0,0,0,0,1,
+1759,1,1753,1,
+1759,2,6,1757,1,
+1759,3,1753,3,0,1,
+1759,4,6,1144,4,0,1,
+1759,5,1753,6,0,0,0,1,
+1759,6,6,1665,1526,1332,0,0,1,
+1759,7,1753,16,0,0,0,0,0,1,
+1759,9,1753,212,1720,0,0,0,0,0,0,1,
+1777,1,1772,1,
+1777,2,5,1774,1,
+1777,3,1772,2,0,1,
+1777,4,5,1224,18,0,1,
+1777,5,1772,1,0,0,0,1,
+1777,6,5,74,792,1744,0,0,1,
+1777,7,1772,19,0,0,0,0,0,1,
+1777,9,1772,731,1365,11,0,0,0,0,0,1,
+1783,1,1773,1,
+1783,2,10,1782,1,
+1783,3,1773,6,0,1,
+1783,4,10,1380,5,0,1,
+1783,5,1773,8,0,0,0,1,
+1783,6,10,1263,639,1202,1,0,1,
+1783,7,1773,4,0,0,0,0,0,1,
+1783,9,1773,920,1652,17,0,0,0,0,0,1,
+1787,1,1785,1,
+1787,2,2,1783,1,
+1787,3,1785,8,0,1,
+1787,4,2,1086,7,0,1,
+1787,5,1785,13,0,0,0,1,
+1787,6,2,911,1515,794,1,0,1,
+1787,7,1785,7,0,0,0,0,0,1,
+1787,9,1785,1703,1616,1,0,0,0,0,0,1,
+1789,1,1783,1,
+1789,2,6,1781,1,
+1789,3,1783,1,0,1,
+1789,4,6,1599,0,0,1,
+1789,5,1783,3,0,0,0,1,
+1789,6,6,1091,771,688,0,0,1,
+1789,7,1783,33,0,0,0,0,0,1,
+1789,9,1783,212,734,11,0,0,0,0,0,1,
+1801,1,1790,1,
+1801,2,11,1796,1,
+1801,3,1790,1,0,1,
+1801,4,11,1782,24,0,1,
+1801,5,1790,1,0,0,0,1,
+1801,6,11,1504,636,1791,0,0,1,
+1801,7,1790,6,0,0,0,0,0,1,
+1801,9,1790,787,1424,9,0,0,0,0,0,1,
+1811,1,1805,1,
+1811,2,6,1809,1,
+1811,3,1805,3,0,1,
+1811,4,6,1396,11,0,1,
+1811,5,1805,3,0,0,0,1,
+1811,6,6,1516,1210,364,1,0,1,
+1811,7,1805,12,0,0,0,0,0,1,
+1811,9,1805,1098,1569,4,0,0,0,0,0,1,
+1823,1,1818,1,
+1823,2,5,1822,1,
+1823,3,1818,1,0,1,
+1823,4,5,1574,2,0,1,
+1823,5,1818,9,0,0,0,1,
+1823,6,5,555,751,1442,1,0,1,
+1823,7,1818,31,0,0,0,0,0,1,
+1823,9,1818,1245,1010,1,0,0,0,0,0,1,
+1831,1,1828,1,
+1831,2,3,1829,1,
+1831,3,1828,10,0,1,
+1831,4,3,1827,4,0,1,
+1831,5,1828,1,0,0,0,1,
+1831,6,3,534,187,1679,0,0,1,
+1831,7,1828,9,0,0,0,0,0,1,
+1831,9,1828,1123,818,1,0,0,0,0,0,1,
+1847,1,1842,1,
+1847,2,5,1845,1,
+1847,3,1842,2,0,1,
+1847,4,5,1150,5,0,1,
+1847,5,1842,2,0,0,0,1,
+1847,6,5,844,477,1225,1,0,1,
+1847,7,1842,2,0,0,0,0,0,1,
+1847,9,1842,846,815,0,0,0,0,0,0,1,
+1861,1,1859,1,
+1861,2,2,1860,1,
+1861,3,1859,4,0,1,
+1861,4,2,1641,3,0,1,
+1861,5,1859,15,0,0,0,1,
+1861,6,2,515,862,1352,1,0,1,
+1861,7,1859,12,0,0,0,0,0,1,
+1861,9,1859,64,776,4,0,0,0,0,0,1,
+1867,1,1865,1,
+1867,2,2,1866,1,
+1867,3,1865,2,0,1,
+1867,4,2,1297,7,0,1,
+1867,5,1865,5,0,0,0,1,
+1867,6,2,323,1719,924,0,0,1,
+1867,7,1865,6,0,0,0,0,0,1,
+1867,9,1865,1336,1826,3,0,0,0,0,0,1,
+1871,1,1857,1,
+1871,2,14,1869,1,
+1871,3,1857,1,0,1,
+1871,4,14,1486,10,0,1,
+1871,5,1857,7,0,0,0,1,
+1871,6,14,1351,593,903,1,0,1,
+1871,7,1857,12,0,0,0,0,0,1,
+1871,9,1857,1116,1627,4,0,0,0,0,0,1,
+1873,1,1863,1,
+1873,2,10,1870,1,
+1873,3,1863,4,0,1,
+1873,4,10,1796,13,0,1,
+1873,5,1863,7,0,0,0,1,
+1873,6,10,708,47,487,0,0,1,
+1873,7,1863,2,0,0,0,0,0,1,
+1873,9,1863,1667,1056,10,0,0,0,0,0,1,
+1877,1,1875,1,
+1877,2,2,1873,1,
+1877,3,1875,3,0,1,
+1877,4,2,1329,6,0,1,
+1877,5,1875,6,0,0,0,1,
+1877,6,2,877,362,1792,1,0,1,
+1877,7,1875,6,0,0,0,0,0,1,
+1877,9,1875,1677,1840,3,0,0,0,0,0,1,
+1879,1,1873,1,
+1879,2,6,1877,1,
+1879,3,1873,3,0,1,
+1879,4,6,1690,3,0,1,
+1879,5,1873,9,0,0,0,1,
+1879,6,6,1098,870,1781,0,0,1,
+1879,7,1873,9,0,0,0,0,0,1,
+1879,9,1873,850,1570,25,0,0,0,0,0,1,
+1889,1,1886,1,
+1889,2,3,1883,1,
+1889,3,1886,6,0,1,
+1889,4,3,1877,0,0,1,
+1889,5,1886,18,0,0,0,1,
+1889,6,3,822,364,26,1,0,1,
+1889,7,1886,15,0,0,0,0,0,1,
+1889,9,1886,1877,991,6,0,0,0,0,0,1,
+1901,1,1899,1,
+1901,2,2,1896,1,
+1901,3,1899,2,0,1,
+1901,4,2,1198,8,0,1,
+1901,5,1899,4,0,0,0,1,
+1901,6,2,467,1830,952,1,0,1,
+1901,7,1899,13,0,0,0,0,0,1,
+1901,9,1899,157,1755,1,0,0,0,0,0,1,
+1907,1,1905,1,
+1907,2,2,1906,1,
+1907,3,1905,2,0,1,
+1907,4,2,1800,2,0,1,
+1907,5,1905,3,0,0,0,1,
+1907,6,2,1237,383,1019,4,0,1,
+1907,7,1905,2,0,0,0,0,0,1,
+1907,9,1905,1122,572,0,0,0,0,0,0,1,
+1913,1,1910,1,
+1913,2,3,1908,1,
+1913,3,1910,4,0,1,
+1913,4,3,1815,2,0,1,
+1913,5,1910,3,0,0,0,1,
+1913,6,3,1407,956,1266,1,0,1,
+1913,7,1910,14,0,0,0,0,0,1,
+1913,9,1910,1499,1049,4,0,0,0,0,0,1,
+1931,1,1929,1,
+1931,2,2,1927,1,
+1931,3,1929,3,0,1,
+1931,4,2,1239,7,0,1,
+1931,5,1929,9,0,0,0,1,
+1931,6,2,786,504,729,1,0,1,
+1931,7,1929,9,0,0,0,0,0,1,
+1931,9,1929,939,1464,4,0,0,0,0,0,1,
+1933,1,1928,1,
+1933,2,5,1932,1,
+1933,3,1928,5,0,1,
+1933,4,5,1144,6,0,1,
+1933,5,1928,6,0,0,0,1,
+1933,6,5,86,834,950,3,0,1,
+1933,7,1928,14,0,0,0,0,0,1,
+1933,9,1928,816,1400,0,0,0,0,0,0,1,
+1949,1,1947,1,
+1949,2,2,1948,1,
+1949,3,1947,9,0,1,
+1949,4,2,1024,3,0,1,
+1949,5,1947,4,0,0,0,1,
+1949,6,2,454,100,1846,1,0,1,
+1949,7,1947,2,0,0,0,0,0,1,
+1949,9,1947,0,1216,2,0,0,0,0,0,1,
+1951,1,1948,1,
+1951,2,3,1949,1,
+1951,3,1948,9,0,1,
+1951,4,3,1034,3,0,1,
+1951,5,1948,10,0,0,0,1,
+1951,6,3,598,1950,1542,0,0,1,
+1951,7,1948,11,0,0,0,0,0,1,
+1951,9,1948,1119,702,4,0,0,0,0,0,1,
+1973,1,1971,1,
+1973,2,2,1972,1,
+1973,3,1971,2,0,1,
+1973,4,2,1505,4,0,1,
+1973,5,1971,6,0,0,0,1,
+1973,6,2,1421,1641,85,4,0,1,
+1973,7,1971,3,0,0,0,0,0,1,
+1973,9,1971,818,1438,0,0,0,0,0,0,1,
+1979,1,1977,1,
+1979,2,2,1975,1,
+1979,3,1977,3,0,1,
+1979,4,2,1748,13,0,1,
+1979,5,1977,2,0,0,0,1,
+1979,6,2,315,1590,1945,1,0,1,
+1979,7,1977,11,0,0,0,0,0,1,
+1979,9,1977,416,823,3,0,0,0,0,0,1,
+1987,1,1985,1,
+1987,2,2,1986,1,
+1987,3,1985,2,0,1,
+1987,4,2,1727,7,0,1,
+1987,5,1985,2,0,0,0,1,
+1987,6,2,478,208,981,0,0,1,
+1987,7,1985,6,0,0,0,0,0,1,
+1987,9,1985,1084,1883,2,0,0,0,0,0,1,
+1993,1,1988,1,
+1993,2,5,1990,1,
+1993,3,1988,2,0,1,
+1993,4,5,1078,18,0,1,
+1993,5,1988,12,0,0,0,1,
+1993,6,5,1873,75,1750,0,0,1,
+1993,7,1988,5,0,0,0,0,0,1,
+1993,9,1988,1102,1671,40,0,0,0,0,0,1,
+1997,1,1995,1,
+1997,2,2,1993,1,
+1997,3,1995,3,0,1,
+1997,4,2,1836,9,0,1,
+1997,5,1995,3,0,0,0,1,
+1997,6,2,1168,326,1724,1,0,1,
+1997,7,1995,4,0,0,0,0,0,1,
+1997,9,1995,1081,1712,3,0,0,0,0,0,1,
+1999,1,1996,1,
+1999,2,3,1998,1,
+1999,3,1996,1,0,1,
+1999,4,3,1177,3,0,1,
+1999,5,1996,1,0,0,0,1,
+1999,6,3,1171,423,1114,0,0,1,
+1999,7,1996,1,0,0,0,0,0,1,
+1999,9,1996,651,1798,7,0,0,0,0,0,1,
+2003,1,1998,1,
+2003,2,5,2002,1,
+2003,3,1998,7,0,1,
+2003,4,5,1333,13,0,1,
+2003,5,1998,3,0,0,0,1,
+2003,6,5,350,1856,1981,2,0,1,
+2003,7,1998,6,0,0,0,0,0,1,
+2003,9,1998,1532,353,3,0,0,0,0,0,1,
+2011,1,2008,1,
+2011,2,3,2004,1,
+2011,3,2008,3,0,1,
+2011,4,3,1947,5,0,1,
+2011,5,2008,6,0,0,0,1,
+2011,6,3,1530,1650,1233,0,0,1,
+2011,7,2008,3,0,0,0,0,0,1,
+2011,9,2008,1256,1168,28,0,0,0,0,0,1,
+2017,1,2012,1,
+2017,2,5,2016,1,
+2017,3,2012,14,0,1,
+2017,4,5,1393,6,0,1,
+2017,5,2012,35,0,0,0,1,
+2017,6,5,943,129,1843,0,0,1,
+2017,7,2012,2,0,0,0,0,0,1,
+2017,9,2012,10,1133,9,0,0,0,0,0,1,
+2027,1,2025,1,
+2027,2,2,2021,1,
+2027,3,2025,5,0,1,
+2027,4,2,1899,0,0,1,
+2027,5,2025,2,0,0,0,1,
+2027,6,2,1083,1623,2006,1,0,1,
+2027,7,2025,3,0,0,0,0,0,1,
+2027,9,2025,1995,87,6,0,0,0,0,0,1,
+2029,1,2027,1,
+2029,2,2,2028,1,
+2029,3,2027,5,0,1,
+2029,4,2,1663,7,0,1,
+2029,5,2027,12,0,0,0,1,
+2029,6,2,317,1791,1492,0,0,1,
+2029,7,2027,6,0,0,0,0,0,1,
+2029,9,2027,1332,1730,20,0,0,0,0,0,1,
+2039,1,2032,1,
+2039,2,7,2026,1,
+2039,3,2032,7,0,1,
+2039,4,7,1377,14,0,1,
+2039,5,2032,4,0,0,0,1,
+2039,6,7,755,1630,1937,2,0,1,
+2039,7,2032,4,0,0,0,0,0,1,
+2039,9,2032,1023,1657,0,0,0,0,0,0,1,
+2053,1,2051,1,
+2053,2,2,2049,1,
+2053,3,2051,6,0,1,
+2053,4,2,1580,10,0,1,
+2053,5,2051,31,0,0,0,1,
+2053,6,2,2041,2035,2049,0,0,1,
+2053,7,2051,6,0,0,0,0,0,1,
+2053,9,2051,1432,837,1,0,0,0,0,0,1,
+2063,1,2058,1,
+2063,2,5,2058,1,
+2063,3,2058,1,0,1,
+2063,4,5,1625,8,0,1,
+2063,5,2058,1,0,0,0,1,
+2063,6,5,1137,949,608,1,0,1,
+2063,7,2058,1,0,0,0,0,0,1,
+2063,9,2058,1964,829,7,0,0,0,0,0,1,
+2069,1,2067,1,
+2069,2,2,2065,1,
+2069,3,2067,2,0,1,
+2069,4,2,1413,6,0,1,
+2069,5,2067,8,0,0,0,1,
+2069,6,2,1268,1157,1365,4,0,1,
+2069,7,2067,4,0,0,0,0,0,1,
+2069,9,2067,1924,1763,0,0,0,0,0,0,1,
+2081,1,2078,1,
+2081,2,3,2080,1,
+2081,3,2078,10,0,1,
+2081,4,3,1796,7,0,1,
+2081,5,2078,4,0,0,0,1,
+2081,6,3,873,2034,1765,1,0,1,
+2081,7,2078,10,0,0,0,0,0,1,
+2081,9,2078,646,1414,5,0,0,0,0,0,1,
+2083,1,2081,1,
+2083,2,2,2079,1,
+2083,3,2081,4,0,1,
+2083,4,2,1925,8,0,1,
+2083,5,2081,3,0,0,0,1,
+2083,6,2,830,2053,790,0,0,1,
+2083,7,2081,6,0,0,0,0,0,1,
+2083,9,2081,1011,1762,8,0,0,0,0,0,1,
+2087,1,2082,1,
+2087,2,5,2084,1,
+2087,3,2082,1,0,1,
+2087,4,5,1305,6,0,1,
+2087,5,2082,3,0,0,0,1,
+2087,6,5,1567,114,517,1,0,1,
+2087,7,2082,2,0,0,0,0,0,1,
+2087,9,2082,1970,1931,1,0,0,0,0,0,1,
+2089,1,2082,1,
+2089,2,7,2080,1,
+2089,3,2082,4,0,1,
+2089,4,7,1985,2,0,1,
+2089,5,2082,5,0,0,0,1,
+2089,6,7,1492,977,1737,0,0,1,
+2089,7,2082,1,0,0,0,0,0,1,
+2089,9,2082,570,2054,2,0,0,0,0,0,1,
+2099,1,2097,1,
+2099,2,2,2095,1,
+2099,3,2097,3,0,1,
+2099,4,2,1828,7,0,1,
+2099,5,2097,6,0,0,0,1,
+2099,6,2,1169,1728,1204,2,0,1,
+2099,7,2097,9,0,0,0,0,0,1,
+2099,9,2097,747,1559,5,0,0,0,0,0,1,
+2111,1,2104,1,
+2111,2,7,2110,1,
+2111,3,2104,9,0,1,
+2111,4,7,1916,2,0,1,
+2111,5,2104,1,0,0,0,1,
+2111,6,7,117,1071,1472,6,0,1,
+2111,7,2104,8,0,0,0,0,0,1,
+2111,9,2104,2097,615,0,0,0,0,0,0,1,
+2113,1,2108,1,
+2113,2,5,2108,1,
+2113,3,2108,1,0,1,
+2113,4,5,1278,18,0,1,
+2113,5,2108,5,0,0,0,1,
+2113,6,5,456,1649,1853,0,0,1,
+2113,7,2108,10,0,0,0,0,0,1,
+2113,9,2108,1636,1520,1,0,0,0,0,0,1,
+2129,1,2126,1,
+2129,2,3,2120,1,
+2129,3,2126,1,0,1,
+2129,4,3,1672,6,0,1,
+2129,5,2126,3,0,0,0,1,
+2129,6,3,700,1338,1245,3,0,1,
+2129,7,2126,3,0,0,0,0,0,1,
+2129,9,2126,844,115,6,0,0,0,0,0,1,
+2131,1,2129,1,
+2131,2,2,2130,1,
+2131,3,2129,5,0,1,
+2131,4,2,2051,2,0,1,
+2131,5,2129,17,0,0,0,1,
+2131,6,2,1622,1717,1000,0,0,1,
+2131,7,2129,3,0,0,0,0,0,1,
+2131,9,2129,431,2105,5,0,0,0,0,0,1,
+2137,1,2127,1,
+2137,2,10,2136,1,
+2137,3,2127,6,0,1,
+2137,4,10,1153,6,0,1,
+2137,5,2127,5,0,0,0,1,
+2137,6,10,970,84,734,0,0,1,
+2137,7,2127,15,0,0,0,0,0,1,
+2137,9,2127,965,2084,27,0,0,0,0,0,1,
+2141,1,2139,1,
+2141,2,2,2140,1,
+2141,3,2139,3,0,1,
+2141,4,2,1154,3,0,1,
+2141,5,2139,2,0,0,0,1,
+2141,6,2,1939,860,1732,1,0,1,
+2141,7,2139,7,0,0,0,0,0,1,
+2141,9,2139,829,278,0,0,0,0,0,0,1,
+2143,1,2140,1,
+2143,2,3,2141,1,
+2143,3,2140,1,0,1,
+2143,4,3,1638,3,0,1,
+2143,5,2140,3,0,0,0,1,
+2143,6,3,802,1443,1616,0,0,1,
+2143,7,2140,7,0,0,0,0,0,1,
+2143,9,2140,1518,2089,6,0,0,0,0,0,1,
+2153,1,2150,1,
+2153,2,3,2145,1,
+2153,3,2150,3,0,1,
+2153,4,3,1925,2,0,1,
+2153,5,2150,3,0,0,0,1,
+2153,6,3,1732,2007,1833,1,0,1,
+2153,7,2150,8,0,0,0,0,0,1,
+2153,9,2150,1865,2027,1,0,0,0,0,0,1,
+2161,1,2138,1,
+2161,2,23,2160,1,
+2161,3,2138,2,0,1,
+2161,4,23,1561,15,0,1,
+2161,5,2138,2,0,0,0,1,
+2161,6,23,699,821,1898,1,0,1,
+2161,7,2138,6,0,0,0,0,0,1,
+2161,9,2138,439,967,6,0,0,0,0,0,1,
+2179,1,2172,1,
+2179,2,7,2177,1,
+2179,3,2172,1,0,1,
+2179,4,7,2017,6,0,1,
+2179,5,2172,3,0,0,0,1,
+2179,6,7,1709,2022,2038,0,0,1,
+2179,7,2172,15,0,0,0,0,0,1,
+2179,9,2172,2079,981,3,0,0,0,0,0,1,
+2203,1,2198,1,
+2203,2,5,2202,1,
+2203,3,2198,1,0,1,
+2203,4,5,1600,7,0,1,
+2203,5,2198,1,0,0,0,1,
+2203,6,5,731,1727,742,0,0,1,
+2203,7,2198,5,0,0,0,0,0,1,
+2203,9,2198,581,2028,8,0,0,0,0,0,1,
+2207,1,2202,1,
+2207,2,5,2205,1,
+2207,3,2202,3,0,1,
+2207,4,5,1195,8,0,1,
+2207,5,2202,2,0,0,0,1,
+2207,6,5,2074,865,508,1,0,1,
+2207,7,2202,10,0,0,0,0,0,1,
+2207,9,2202,1132,1570,0,0,0,0,0,0,1,
+2213,1,2211,1,
+2213,2,2,2209,1,
+2213,3,2211,3,0,1,
+2213,4,2,2119,6,0,1,
+2213,5,2211,5,0,0,0,1,
+2213,6,2,1438,1211,1450,1,0,1,
+2213,7,2211,6,0,0,0,0,0,1,
+2213,9,2211,0,2017,2,0,0,0,0,0,1,
+2221,1,2219,1,
+2221,2,2,2217,1,
+2221,3,2219,6,0,1,
+2221,4,2,1282,6,0,1,
+2221,5,2219,8,0,0,0,1,
+2221,6,2,2209,2203,2217,0,0,1,
+2221,7,2219,2,0,0,0,0,0,1,
+2221,9,2219,1126,2012,5,0,0,0,0,0,1,
+2237,1,2235,1,
+2237,2,2,2232,1,
+2237,3,2235,4,0,1,
+2237,4,2,1387,8,0,1,
+2237,5,2235,7,0,0,0,1,
+2237,6,2,1978,160,839,1,0,1,
+2237,7,2235,11,0,0,0,0,0,1,
+2237,9,2235,1056,797,5,0,0,0,0,0,1,
+2239,1,2236,1,
+2239,2,3,2233,1,
+2239,3,2236,6,0,1,
+2239,4,3,2145,11,0,1,
+2239,5,2236,8,0,0,0,1,
+2239,6,3,1910,490,1124,0,0,1,
+2239,7,2236,1,0,0,0,0,0,1,
+2239,9,2236,947,1594,31,0,0,0,0,0,1,
+2243,1,2241,1,
+2243,2,2,2234,1,
+2243,3,2241,2,0,1,
+2243,4,2,1553,1,0,1,
+2243,5,2241,2,0,0,0,1,
+2243,6,2,2141,92,1983,2,0,1,
+2243,7,2241,5,0,0,0,0,0,1,
+2243,9,2241,957,1339,0,0,0,0,0,0,1,
+2251,1,2244,1,
+2251,2,7,2249,1,
+2251,3,2244,1,0,1,
+2251,4,7,1840,6,0,1,
+2251,5,2244,3,0,0,0,1,
+2251,6,7,1081,1578,2067,0,0,1,
+2251,7,2244,7,0,0,0,0,0,1,
+2251,9,2244,1455,1129,2,0,0,0,0,0,1,
+2267,1,2265,1,
+2267,2,2,2266,1,
+2267,3,2265,2,0,1,
+2267,4,2,1889,10,0,1,
+2267,5,2265,9,0,0,0,1,
+2267,6,2,1447,170,1050,4,0,1,
+2267,7,2265,12,0,0,0,0,0,1,
+2267,9,2265,2206,1865,1,0,0,0,0,0,1,
+2269,1,2267,1,
+2269,2,2,2265,1,
+2269,3,2267,2,0,1,
+2269,4,2,1609,10,0,1,
+2269,5,2267,3,0,0,0,1,
+2269,6,2,2181,867,2260,0,0,1,
+2269,7,2267,4,0,0,0,0,0,1,
+2269,9,2267,172,2153,9,0,0,0,0,0,1,
+2273,1,2270,1,
+2273,2,3,2268,1,
+2273,3,2270,3,0,1,
+2273,4,3,1913,2,0,1,
+2273,5,2270,7,0,0,0,1,
+2273,6,3,1673,1140,2220,1,0,1,
+2273,7,2270,20,0,0,0,0,0,1,
+2273,9,2270,1769,1846,1,0,0,0,0,0,1,
+2281,1,2274,1,
+2281,2,7,2274,1,
+2281,3,2274,5,0,1,
+2281,4,7,1462,0,0,1,
+2281,5,2274,3,0,0,0,1,
+2281,6,7,1814,946,1240,0,0,1,
+2281,7,2274,1,0,0,0,0,0,1,
+2281,9,2274,1458,1648,10,0,0,0,0,0,1,
+2287,1,2268,1,
+2287,2,19,2283,1,
+2287,3,2268,1,0,1,
+2287,4,19,2160,6,0,1,
+2287,5,2268,4,0,0,0,1,
+2287,6,19,233,630,1812,0,0,1,
+2287,7,2268,4,0,0,0,0,0,1,
+2287,9,2268,386,1670,1,0,0,0,0,0,1,
+2293,1,2291,1,
+2293,2,2,2289,1,
+2293,3,2291,5,0,1,
+2293,4,2,1256,10,0,1,
+2293,5,2291,2,0,0,0,1,
+2293,6,2,435,1415,1935,0,0,1,
+2293,7,2291,10,0,0,0,0,0,1,
+2293,9,2291,2124,1905,7,0,0,0,0,0,1,
+2297,1,2292,1,
+2297,2,5,2292,1,
+2297,3,2292,1,0,1,
+2297,4,5,1772,8,0,1,
+2297,5,2292,2,0,0,0,1,
+2297,6,5,607,1036,2147,1,0,1,
+2297,7,2292,1,0,0,0,0,0,1,
+2297,9,2292,1213,2134,0,0,0,0,0,0,1,
+2309,1,2307,1,
+2309,2,2,2305,1,
+2309,3,2307,3,0,1,
+2309,4,2,2173,1,0,1,
+2309,5,2307,6,0,0,0,1,
+2309,6,2,94,164,1911,1,0,1,
+2309,7,2307,14,0,0,0,0,0,1,
+2309,9,2307,1532,1441,6,0,0,0,0,0,1,
+2311,1,2308,1,
+2311,2,3,2309,1,
+2311,3,2308,3,0,1,
+2311,4,3,2175,3,0,1,
+2311,5,2308,11,0,0,0,1,
+2311,6,3,1099,1270,424,3,0,1,
+2311,7,2308,7,0,0,0,0,0,1,
+2311,9,2308,309,1796,1,0,0,0,0,0,1,
+2333,1,2331,1,
+2333,2,2,2329,1,
+2333,3,2331,3,0,1,
+2333,4,2,1591,7,0,1,
+2333,5,2331,9,0,0,0,1,
+2333,6,2,966,990,1899,1,0,1,
+2333,7,2331,8,0,0,0,0,0,1,
+2333,9,2331,1892,204,0,0,0,0,0,0,1,
+2339,1,2337,1,
+2339,2,2,2329,1,
+2339,3,2337,20,0,1,
+2339,4,2,1768,0,0,1,
+2339,5,2337,6,0,0,0,1,
+2339,6,2,1112,764,2243,2,0,1,
+2339,7,2337,17,0,0,0,0,0,1,
+2339,9,2337,900,1724,0,0,0,0,0,0,1,
+2341,1,2334,1,
+2341,2,7,2339,1,
+2341,3,2334,3,0,1,
+2341,4,7,1919,9,0,1,
+2341,5,2334,3,0,0,0,1,
+2341,6,7,1291,342,1220,0,0,1,
+2341,7,2334,9,0,0,0,0,0,1,
+2341,9,2334,328,2061,33,0,0,0,0,0,1,
+2347,1,2344,1,
+2347,2,3,2342,1,
+2347,3,2344,4,0,1,
+2347,4,3,1254,3,0,1,
+2347,5,2344,3,0,0,0,1,
+2347,6,3,889,177,2337,0,0,1,
+2347,7,2344,6,0,0,0,0,0,1,
+2347,9,2344,743,2277,5,0,0,0,0,0,1,
+2351,1,2338,1,
+2351,2,13,2347,1,
+2351,3,2338,1,0,1,
+2351,4,13,1822,6,0,1,
+2351,5,2338,2,0,0,0,1,
+2351,6,13,773,1036,1247,1,0,1,
+2351,7,2338,1,0,0,0,0,0,1,
+2351,9,2338,1452,1725,3,0,0,0,0,0,1,
+2357,1,2355,1,
+2357,2,2,2352,1,
+2357,3,2355,2,0,1,
+2357,4,2,2140,8,0,1,
+2357,5,2355,5,0,0,0,1,
+2357,6,2,280,2291,1782,1,0,1,
+2357,7,2355,7,0,0,0,0,0,1,
+2357,9,2355,2317,1931,0,0,0,0,0,0,1,
+2371,1,2369,1,
+2371,2,2,2370,1,
+2371,3,2369,4,0,1,
+2371,4,2,2087,7,0,1,
+2371,5,2369,2,0,0,0,1,
+2371,6,2,860,370,1269,2,0,1,
+2371,7,2369,4,0,0,0,0,0,1,
+2371,9,2369,1314,1457,23,0,0,0,0,0,1,
+2377,1,2372,1,
+2377,2,5,2376,1,
+2377,3,2372,1,0,1,
+2377,4,5,1684,6,0,1,
+2377,5,2372,10,0,0,0,1,
+2377,6,5,299,83,975,0,0,1,
+2377,7,2372,2,0,0,0,0,0,1,
+2377,9,2372,1827,2178,28,0,0,0,0,0,1,
+2381,1,2378,1,
+2381,2,3,2379,1,
+2381,3,2378,7,0,1,
+2381,4,3,2283,12,0,1,
+2381,5,2378,20,0,0,0,1,
+2381,6,3,1568,1764,432,1,0,1,
+2381,7,2378,12,0,0,0,0,0,1,
+2381,9,2378,2290,74,4,0,0,0,0,0,1,
+2383,1,2378,1,
+2383,2,5,2382,1,
+2383,3,2378,2,0,1,
+2383,4,5,2159,8,0,1,
+2383,5,2378,1,0,0,0,1,
+2383,6,5,767,2110,372,3,0,1,
+2383,7,2378,34,0,0,0,0,0,1,
+2383,9,2378,1599,2180,11,0,0,0,0,0,1,
+2389,1,2387,1,
+2389,2,2,2385,1,
+2389,3,2387,2,0,1,
+2389,4,2,1651,10,0,1,
+2389,5,2387,5,0,0,0,1,
+2389,6,2,953,405,1962,0,0,1,
+2389,7,2387,3,0,0,0,0,0,1,
+2389,9,2387,1273,1724,4,0,0,0,0,0,1,
+2393,1,2390,1,
+2393,2,3,2392,1,
+2393,3,2390,4,0,1,
+2393,4,3,2047,7,0,1,
+2393,5,2390,7,0,0,0,1,
+2393,6,3,606,861,1633,2,0,1,
+2393,7,2390,9,0,0,0,0,0,1,
+2393,9,2390,678,757,1,0,0,0,0,0,1,
+2399,1,2388,1,
+2399,2,11,2398,1,
+2399,3,2388,4,0,1,
+2399,4,11,1637,3,0,1,
+2399,5,2388,3,0,0,0,1,
+2399,6,11,1344,89,1838,2,0,1,
+2399,7,2388,3,0,0,0,0,0,1,
+2399,9,2388,1220,30,5,0,0,0,0,0,1,
+2411,1,2405,1,
+2411,2,6,2410,1,
+2411,3,2405,3,0,1,
+2411,4,6,1681,4,0,1,
+2411,5,2405,12,0,0,0,1,
+2411,6,6,1092,1304,2016,1,0,1,
+2411,7,2405,1,0,0,0,0,0,1,
+2411,9,2405,813,1670,1,0,0,0,0,0,1,
+2417,1,2414,1,
+2417,2,3,2408,1,
+2417,3,2414,1,0,1,
+2417,4,3,2350,14,0,1,
+2417,5,2414,3,0,0,0,1,
+2417,6,3,167,2026,893,1,0,1,
+2417,7,2414,4,0,0,0,0,0,1,
+2417,9,2414,742,1272,0,0,0,0,0,0,1,
+2423,1,2418,1,
+2423,2,5,2421,1,
+2423,3,2418,1,0,1,
+2423,4,5,1349,10,0,1,
+2423,5,2418,6,0,0,0,1,
+2423,6,5,2166,1751,2050,1,0,1,
+2423,7,2418,7,0,0,0,0,0,1,
+2423,9,2418,2267,915,5,0,0,0,0,0,1,
+2437,1,2435,1,
+2437,2,2,2433,1,
+2437,3,2435,6,0,1,
+2437,4,2,1592,6,0,1,
+2437,5,2435,2,0,0,0,1,
+2437,6,2,2425,2419,2433,0,0,1,
+2437,7,2435,14,0,0,0,0,0,1,
+2437,9,2435,444,2275,5,0,0,0,0,0,1,
+2441,1,2435,1,
+2441,2,6,2438,1,
+2441,3,2435,1,0,1,
+2441,4,6,2078,0,0,1,
+2441,5,2435,7,0,0,0,1,
+2441,6,6,1678,1880,1270,1,0,1,
+2441,7,2435,4,0,0,0,0,0,1,
+2441,9,2435,1272,787,0,0,0,0,0,0,1,
+2447,1,2442,1,
+2447,2,5,2446,1,
+2447,3,2442,1,0,1,
+2447,4,5,1426,2,0,1,
+2447,5,2442,3,0,0,0,1,
+2447,6,5,1496,2409,2123,1,0,1,
+2447,7,2442,9,0,0,0,0,0,1,
+2447,9,2442,1269,1060,4,0,0,0,0,0,1,
+2459,1,2457,1,
+2459,2,2,2455,1,
+2459,3,2457,3,0,1,
+2459,4,2,1737,7,0,1,
+2459,5,2457,2,0,0,0,1,
+2459,6,2,885,1850,2138,1,0,1,
+2459,7,2457,4,0,0,0,0,0,1,
+2459,9,2457,114,849,7,0,0,0,0,0,1,
+2467,1,2465,1,
+2467,2,2,2466,1,
+2467,3,2465,6,0,1,
+2467,4,2,1277,7,0,1,
+2467,5,2465,6,0,0,0,1,
+2467,6,2,1060,1538,1507,0,0,1,
+2467,7,2465,6,0,0,0,0,0,1,
+2467,9,2465,1683,1543,9,0,0,0,0,0,1,
+2473,1,2468,1,
+2473,2,5,2472,1,
+2473,3,2468,1,0,1,
+2473,4,5,1380,11,0,1,
+2473,5,2468,10,0,0,0,1,
+2473,6,5,1517,348,2137,1,0,1,
+2473,7,2468,26,0,0,0,0,0,1,
+2473,9,2468,1146,1002,4,0,0,0,0,0,1,
+2477,1,2475,1,
+2477,2,2,2476,1,
+2477,3,2475,2,0,1,
+2477,4,2,1955,3,0,1,
+2477,5,2475,5,0,0,0,1,
+2477,6,2,80,1343,959,2,0,1,
+2477,7,2475,9,0,0,0,0,0,1,
+2477,9,2475,223,1104,9,0,0,0,0,0,1,
+2503,1,2500,1,
+2503,2,3,2502,1,
+2503,3,2500,14,0,1,
+2503,4,3,2207,2,0,1,
+2503,5,2500,9,0,0,0,1,
+2503,6,3,2195,972,1282,0,0,1,
+2503,7,2500,5,0,0,0,0,0,1,
+2503,9,2500,1979,1152,7,0,0,0,0,0,1,
+2521,1,2504,1,
+2521,2,17,2520,1,
+2521,3,2504,1,0,1,
+2521,4,17,1993,23,0,1,
+2521,5,2504,6,0,0,0,1,
+2521,6,17,277,659,1946,1,0,1,
+2521,7,2504,4,0,0,0,0,0,1,
+2521,9,2504,822,2454,12,0,0,0,0,0,1,
+2531,1,2529,1,
+2531,2,2,2527,1,
+2531,3,2529,2,0,1,
+2531,4,2,1375,8,0,1,
+2531,5,2529,5,0,0,0,1,
+2531,6,2,1051,184,2346,2,0,1,
+2531,7,2529,3,0,0,0,0,0,1,
+2531,9,2529,2207,1381,0,0,0,0,0,0,1,
+2539,1,2537,1,
+2539,2,2,2538,1,
+2539,3,2537,5,0,1,
+2539,4,2,2069,2,0,1,
+2539,5,2537,3,0,0,0,1,
+2539,6,2,1802,1911,1332,0,0,1,
+2539,7,2537,5,0,0,0,0,0,1,
+2539,9,2537,822,2293,7,0,0,0,0,0,1,
+2543,1,2538,1,
+2543,2,5,2541,1,
+2543,3,2538,6,0,1,
+2543,4,5,2539,3,0,1,
+2543,5,2538,3,0,0,0,1,
+2543,6,5,860,1428,1634,2,0,1,
+2543,7,2538,21,0,0,0,0,0,1,
+2543,9,2538,1813,1024,0,0,0,0,0,0,1,
+2549,1,2547,1,
+2549,2,2,2545,1,
+2549,3,2547,2,0,1,
+2549,4,2,2242,12,0,1,
+2549,5,2547,3,0,0,0,1,
+2549,6,2,2264,1711,1391,1,0,1,
+2549,7,2547,2,0,0,0,0,0,1,
+2549,9,2547,1819,2,0,0,0,0,0,0,1,
+2551,1,2545,1,
+2551,2,6,2549,1,
+2551,3,2545,2,0,1,
+2551,4,6,2007,3,0,1,
+2551,5,2545,7,0,0,0,1,
+2551,6,6,1355,1591,1888,0,0,1,
+2551,7,2545,23,0,0,0,0,0,1,
+2551,9,2545,1151,2487,4,0,0,0,0,0,1,
+2557,1,2555,1,
+2557,2,2,2553,1,
+2557,3,2555,6,0,1,
+2557,4,2,2444,6,0,1,
+2557,5,2555,4,0,0,0,1,
+2557,6,2,2545,2539,2553,0,0,1,
+2557,7,2555,2,0,0,0,0,0,1,
+2557,9,2555,2359,1177,6,0,0,0,0,0,1,
+2579,1,2577,1,
+2579,2,2,2560,1,
+2579,3,2577,5,0,1,
+2579,4,2,1954,1,0,1,
+2579,5,2577,12,0,0,0,1,
+2579,6,2,73,471,1709,1,0,1,
+2579,7,2577,4,0,0,0,0,0,1,
+2579,9,2577,1770,866,7,0,0,0,0,0,1,
+2591,1,2584,1,
+2591,2,7,2589,1,
+2591,3,2584,1,0,1,
+2591,4,7,2159,5,0,1,
+2591,5,2584,5,0,0,0,1,
+2591,6,7,1936,607,1663,1,0,1,
+2591,7,2584,14,0,0,0,0,0,1,
+2591,9,2584,2384,310,1,0,0,0,0,0,1,
+2593,1,2586,1,
+2593,2,7,2586,1,
+2593,3,2586,3,0,1,
+2593,4,7,2226,14,0,1,
+2593,5,2586,12,0,0,0,1,
+2593,6,7,946,1268,1392,0,0,1,
+2593,7,2586,3,0,0,0,0,0,1,
+2593,9,2586,371,1458,11,0,0,0,0,0,1,
+2609,1,2606,1,
+2609,2,3,2603,1,
+2609,3,2606,1,0,1,
+2609,4,3,2597,0,0,1,
+2609,5,2606,1,0,0,0,1,
+2609,6,3,1184,2345,1105,1,0,1,
+2609,7,2606,6,0,0,0,0,0,1,
+2609,9,2606,1030,2447,3,0,0,0,0,0,1,
+2617,1,2612,1,
+2617,2,5,2614,1,
+2617,3,2612,5,0,1,
+2617,4,5,2248,10,0,1,
+2617,5,2612,2,0,0,0,1,
+2617,6,5,644,2355,1514,0,0,1,
+2617,7,2612,3,0,0,0,0,0,1,
+2617,9,2612,1014,2367,16,0,0,0,0,0,1,
+2621,1,2619,1,
+2621,2,2,2620,1,
+2621,3,2619,3,0,1,
+2621,4,2,1919,9,0,1,
+2621,5,2619,10,0,0,0,1,
+2621,6,2,1136,283,2390,1,0,1,
+2621,7,2619,6,0,0,0,0,0,1,
+2621,9,2619,1379,1858,1,0,0,0,0,0,1,
+2633,1,2630,1,
+2633,2,3,2627,1,
+2633,3,2630,3,0,1,
+2633,4,3,1393,9,0,1,
+2633,5,2630,4,0,0,0,1,
+2633,6,3,773,318,1332,1,0,1,
+2633,7,2630,3,0,0,0,0,0,1,
+2633,9,2630,1843,111,0,0,0,0,0,0,1,
+2647,1,2644,1,
+2647,2,3,2646,1,
+2647,3,2644,4,0,1,
+2647,4,3,1656,5,0,1,
+2647,5,2644,3,0,0,0,1,
+2647,6,3,234,1628,1100,0,0,1,
+2647,7,2644,10,0,0,0,0,0,1,
+2647,9,2644,561,1736,2,0,0,0,0,0,1,
+2657,1,2654,1,
+2657,2,3,2652,1,
+2657,3,2654,3,0,1,
+2657,4,3,1910,2,0,1,
+2657,5,2654,8,0,0,0,1,
+2657,6,3,1392,1071,1723,1,0,1,
+2657,7,2654,13,0,0,0,0,0,1,
+2657,9,2654,370,538,1,0,0,0,0,0,1,
+2659,1,2657,1,
+2659,2,2,2658,1,
+2659,3,2657,4,0,1,
+2659,4,2,1570,2,0,1,
+2659,5,2657,13,0,0,0,1,
+2659,6,2,35,998,1901,0,0,1,
+2659,7,2657,28,0,0,0,0,0,1,
+2659,9,2657,629,1806,10,0,0,0,0,0,1,
+2663,1,2658,1,
+2663,2,5,2655,1,
+2663,3,2658,12,0,1,
+2663,4,5,2263,3,0,1,
+2663,5,2658,3,0,0,0,1,
+2663,6,5,2428,772,1799,1,0,1,
+2663,7,2658,1,0,0,0,0,0,1,
+2663,9,2658,556,349,4,0,0,0,0,0,1,
+2671,1,2664,1,
+2671,2,7,2662,1,
+2671,3,2664,7,0,1,
+2671,4,7,2226,2,0,1,
+2671,5,2664,1,0,0,0,1,
+2671,6,7,2007,1802,2472,0,0,1,
+2671,7,2664,2,0,0,0,0,0,1,
+2671,9,2664,338,2358,16,0,0,0,0,0,1,
+2677,1,2675,1,
+2677,2,2,2676,1,
+2677,3,2675,2,0,1,
+2677,4,2,2358,6,0,1,
+2677,5,2675,8,0,0,0,1,
+2677,6,2,271,1113,723,0,0,1,
+2677,7,2675,14,0,0,0,0,0,1,
+2677,9,2675,1934,1971,11,0,0,0,0,0,1,
+2683,1,2681,1,
+2683,2,2,2679,1,
+2683,3,2681,13,0,1,
+2683,4,2,1386,8,0,1,
+2683,5,2681,7,0,0,0,1,
+2683,6,2,170,125,1906,0,0,1,
+2683,7,2681,2,0,0,0,0,0,1,
+2683,9,2681,259,997,8,0,0,0,0,0,1,
+2687,1,2682,1,
+2687,2,5,2686,1,
+2687,3,2682,1,0,1,
+2687,4,5,1568,2,0,1,
+2687,5,2682,7,0,0,0,1,
+2687,6,5,772,1402,1390,1,0,1,
+2687,7,2682,7,0,0,0,0,0,1,
+2687,9,2682,726,2286,3,0,0,0,0,0,1,
+2689,1,2670,1,
+2689,2,19,2684,1,
+2689,3,2670,2,0,1,
+2689,4,19,1679,24,0,1,
+2689,5,2670,4,0,0,0,1,
+2689,6,19,1942,2441,2393,0,0,1,
+2693,1,2691,1,
+2693,2,2,2688,1,
+2693,3,2691,2,0,1,
+2693,4,2,2281,0,0,1,
+2693,5,2691,7,0,0,0,1,
+2693,6,2,1940,68,2650,1,0,1,
+2693,7,2691,21,0,0,0,0,0,1,
+2693,9,2691,205,1843,3,0,0,0,0,0,1,
+2699,1,2697,1,
+2699,2,2,2693,1,
+2699,3,2697,2,0,1,
+2699,4,2,1520,4,0,1,
+2699,5,2697,8,0,0,0,1,
+2699,6,2,2046,773,2361,1,0,1,
+2699,7,2697,2,0,0,0,0,0,1,
+2699,9,2697,440,1133,5,0,0,0,0,0,1,
+2707,1,2705,1,
+2707,2,2,2706,1,
+2707,3,2705,7,0,1,
+2707,4,2,1560,2,0,1,
+2707,5,2705,2,0,0,0,1,
+2707,6,2,1133,2011,2594,0,0,1,
+2707,7,2705,13,0,0,0,0,0,1,
+2707,9,2705,466,2339,19,0,0,0,0,0,1,
+2711,1,2704,1,
+2711,2,7,2710,1,
+2711,3,2704,1,0,1,
+2711,4,7,1442,2,0,1,
+2711,5,2704,1,0,0,0,1,
+2711,6,7,2519,102,1774,1,0,1,
+2711,7,2704,5,0,0,0,0,0,1,
+2711,9,2704,2424,2482,0,0,0,0,0,0,1,
+2713,1,2708,1,
+2713,2,5,2712,1,
+2713,3,2708,1,0,1,
+2713,4,5,2548,6,0,1,
+2713,5,2708,1,0,0,0,1,
+2713,6,5,2518,1036,1920,0,0,1,
+2713,7,2708,11,0,0,0,0,0,1,
+2713,9,2708,1291,2050,3,0,0,0,0,0,1,
+2719,1,2716,1,
+2719,2,3,2718,1,
+2719,3,2716,4,0,1,
+2719,4,3,2480,3,0,1,
+2719,5,2716,19,0,0,0,1,
+2719,6,3,1769,441,689,1,0,1,
+2719,7,2716,8,0,0,0,0,0,1,
+2719,9,2716,1481,2154,2,0,0,0,0,0,1,
+2729,1,2726,1,
+2729,2,3,2723,1,
+2729,3,2726,4,0,1,
+2729,4,3,2717,0,0,1,
+2729,5,2726,1,0,0,0,1,
+2729,6,3,1424,213,2547,1,0,1,
+2729,7,2726,1,0,0,0,0,0,1,
+2729,9,2726,1869,1348,0,0,0,0,0,0,1,
+2731,1,2728,1,
+2731,2,3,2722,1,
+2731,3,2728,3,0,1,
+2731,4,3,2591,2,0,1,
+2731,5,2728,10,0,0,0,1,
+2731,6,3,1404,1520,512,0,0,1,
+2731,7,2728,7,0,0,0,0,0,1,
+2731,9,2728,2672,1637,1,0,0,0,0,0,1,
+2741,1,2739,1,
+2741,2,2,2737,1,
+2741,3,2739,3,0,1,
+2741,4,2,2507,12,0,1,
+2741,5,2739,8,0,0,0,1,
+2741,6,2,1311,1967,1856,1,0,1,
+2741,7,2739,5,0,0,0,0,0,1,
+2741,9,2739,2251,1666,5,0,0,0,0,0,1,
+2749,1,2743,1,
+2749,2,6,2741,1,
+2749,3,2743,1,0,1,
+2749,4,6,1695,0,0,1,
+2749,5,2743,20,0,0,0,1,
+2749,6,6,465,1636,767,0,0,1,
+2749,7,2743,6,0,0,0,0,0,1,
+2749,9,2743,2573,2665,10,0,0,0,0,0,1,
+2753,1,2750,1,
+2753,2,3,2747,1,
+2753,3,2750,5,0,1,
+2753,4,3,1947,9,0,1,
+2753,5,2750,4,0,0,0,1,
+2753,6,3,1153,1520,1673,3,0,1,
+2753,7,2750,4,0,0,0,0,0,1,
+2753,9,2750,1096,788,4,0,0,0,0,0,1,
+2767,1,2764,1,
+2767,2,3,2766,1,
+2767,3,2764,15,0,1,
+2767,4,3,2422,5,0,1,
+2767,5,2764,3,0,0,0,1,
+2767,6,3,1940,1828,1310,0,0,1,
+2767,7,2764,1,0,0,0,0,0,1,
+2767,9,2764,2582,2742,5,0,0,0,0,0,1,
+2777,1,2774,1,
+2777,2,3,2772,1,
+2777,3,2774,1,0,1,
+2777,4,3,1801,0,0,1,
+2777,5,2774,1,0,0,0,1,
+2777,6,3,1761,1143,1344,4,0,1,
+2777,7,2774,17,0,0,0,0,0,1,
+2777,9,2774,2399,2419,2,0,0,0,0,0,1,
+2789,1,2787,1,
+2789,2,2,2783,1,
+2789,3,2787,3,0,1,
+2789,4,2,2423,3,0,1,
+2789,5,2787,4,0,0,0,1,
+2789,6,2,2433,781,1923,1,0,1,
+2789,7,2787,5,0,0,0,0,0,1,
+2789,9,2787,1610,1475,3,0,0,0,0,0,1,
+2791,1,2785,1,
+2791,2,6,2789,1,
+2791,3,2785,7,0,1,
+2791,4,6,1653,3,0,1,
+2791,5,2785,19,0,0,0,1,
+2791,6,6,1742,1391,1876,0,0,1,
+2791,7,2785,9,0,0,0,0,0,1,
+2791,9,2785,1355,2415,3,0,0,0,0,0,1,
+2797,1,2795,1,
+2797,2,2,2793,1,
+2797,3,2795,6,0,1,
+2797,4,2,2145,9,0,1,
+2797,5,2795,2,0,0,0,1,
+2797,6,2,2785,2779,2793,0,0,1,
+2801,1,2798,1,
+2801,2,3,2800,1,
+2801,3,2798,1,0,1,
+2801,4,3,1614,7,0,1,
+2801,5,2798,3,0,0,0,1,
+2801,6,3,964,2436,600,1,0,1,
+2801,7,2798,6,0,0,0,0,0,1,
+2801,9,2798,410,1893,2,0,0,0,0,0,1,
+2803,1,2801,1,
+2803,2,2,2802,1,
+2803,3,2801,4,0,1,
+2803,4,2,2468,16,0,1,
+2803,5,2801,9,0,0,0,1,
+2803,6,2,917,2197,1394,0,0,1,
+2803,7,2801,4,0,0,0,0,0,1,
+2803,9,2801,179,1929,0,0,0,0,0,0,1,
+2819,1,2817,1,
+2819,2,2,2814,1,
+2819,3,2817,3,0,1,
+2819,4,2,2651,3,0,1,
+2819,5,2817,9,0,0,0,1,
+2819,6,2,1428,1252,2713,2,0,1,
+2819,7,2817,8,0,0,0,0,0,1,
+2819,9,2817,2516,1075,1,0,0,0,0,0,1,
+2833,1,2828,1,
+2833,2,5,2830,1,
+2833,3,2828,3,0,1,
+2833,4,5,2233,22,0,1,
+2833,5,2828,1,0,0,0,1,
+2833,6,5,2264,954,685,0,0,1,
+2837,1,2835,1,
+2837,2,2,2833,1,
+2837,3,2835,3,0,1,
+2837,4,2,2731,18,0,1,
+2837,5,2835,3,0,0,0,1,
+2837,6,2,1415,2694,2430,3,0,1,
+2837,7,2835,5,0,0,0,0,0,1,
+2837,9,2835,2419,2410,6,0,0,0,0,0,1,
+2843,1,2841,1,
+2843,2,2,2839,1,
+2843,3,2841,3,0,1,
+2843,4,2,2566,8,0,1,
+2843,5,2841,12,0,0,0,1,
+2843,6,2,2629,920,1618,1,0,1,
+2843,7,2841,5,0,0,0,0,0,1,
+2843,9,2841,2363,1669,0,0,0,0,0,0,1,
+2851,1,2849,1,
+2851,2,2,2847,1,
+2851,3,2849,12,0,1,
+2851,4,2,2674,8,0,1,
+2851,5,2849,3,0,0,0,1,
+2851,6,2,1398,200,509,0,0,1,
+2851,7,2849,5,0,0,0,0,0,1,
+2851,9,2849,656,2167,9,0,0,0,0,0,1,
+2857,1,2846,1,
+2857,2,11,2856,1,
+2857,3,2846,2,0,1,
+2857,4,11,2703,21,0,1,
+2857,5,2846,1,0,0,0,1,
+2857,6,11,1166,2012,2854,0,0,1,
+2857,7,2846,2,0,0,0,0,0,1,
+2857,9,2846,1833,2188,1,0,0,0,0,0,1,
+2861,1,2859,1,
+2861,2,2,2857,1,
+2861,3,2859,3,0,1,
+2861,4,2,1958,1,0,1,
+2861,5,2859,17,0,0,0,1,
+2861,6,2,424,459,2461,1,0,1,
+2861,7,2859,15,0,0,0,0,0,1,
+2861,9,2859,396,22,0,0,0,0,0,0,1,
+2879,1,2872,1,
+2879,2,7,2878,1,
+2879,3,2872,2,0,1,
+2879,4,7,1579,2,0,1,
+2879,5,2872,1,0,0,0,1,
+2879,6,7,1566,1144,2755,1,0,1,
+2879,7,2872,18,0,0,0,0,0,1,
+2879,9,2872,324,2154,0,0,0,0,0,0,1,
+2887,1,2882,1,
+2887,2,5,2885,1,
+2887,3,2882,1,0,1,
+2887,4,5,1657,9,0,1,
+2887,5,2882,16,0,0,0,1,
+2887,6,5,2797,2682,1171,0,0,1,
+2887,7,2882,9,0,0,0,0,0,1,
+2887,9,2882,1265,1114,9,0,0,0,0,0,1,
+2897,1,2894,1,
+2897,2,3,2891,1,
+2897,3,2894,3,0,1,
+2897,4,3,1560,1,0,1,
+2897,5,2894,9,0,0,0,1,
+2897,6,3,964,2504,1785,3,0,1,
+2897,7,2894,18,0,0,0,0,0,1,
+2897,9,2894,1011,2818,1,0,0,0,0,0,1,
+2903,1,2898,1,
+2903,2,5,2902,1,
+2903,3,2898,1,0,1,
+2903,4,5,2291,4,0,1,
+2903,5,2898,11,0,0,0,1,
+2903,6,5,2600,757,324,3,0,1,
+2903,7,2898,9,0,0,0,0,0,1,
+2903,9,2898,2226,558,1,0,0,0,0,0,1,
+2909,1,2907,1,
+2909,2,2,2900,1,
+2909,3,2907,2,0,1,
+2909,4,2,2786,1,0,1,
+2909,5,2907,6,0,0,0,1,
+2909,6,2,1025,2659,683,1,0,1,
+2909,7,2907,5,0,0,0,0,0,1,
+2909,9,2907,2338,681,0,0,0,0,0,0,1,
+2917,1,2912,1,
+2917,2,5,2916,1,
+2917,3,2912,2,0,1,
+2917,4,5,1860,3,0,1,
+2917,5,2912,2,0,0,0,1,
+2917,6,5,2643,1589,2181,1,0,1,
+2917,7,2912,1,0,0,0,0,0,1,
+2917,9,2912,914,2767,0,0,0,0,0,0,1,
+2927,1,2922,1,
+2927,2,5,2925,1,
+2927,3,2922,7,0,1,
+2927,4,5,2446,10,0,1,
+2927,5,2922,3,0,0,0,1,
+2927,6,5,1521,1142,2191,1,0,1,
+2927,7,2922,10,0,0,0,0,0,1,
+2927,9,2922,1741,428,5,0,0,0,0,0,1,
+2939,1,2937,1,
+2939,2,2,2938,1,
+2939,3,2937,3,0,1,
+2939,4,2,1878,13,0,1,
+2939,5,2937,5,0,0,0,1,
+2939,6,2,875,2840,2808,1,0,1,
+2939,7,2937,20,0,0,0,0,0,1,
+2939,9,2937,514,1940,1,0,0,0,0,0,1,
+2953,1,2940,1,
+2953,2,13,2952,1,
+2953,3,2940,5,0,1,
+2953,4,13,2109,14,0,1,
+2953,5,2940,1,0,0,0,1,
+2953,6,13,1904,94,702,1,0,1,
+2953,7,2940,31,0,0,0,0,0,1,
+2953,9,2940,1830,2020,10,0,0,0,0,0,1,
+2957,1,2955,1,
+2957,2,2,2956,1,
+2957,3,2955,2,0,1,
+2957,4,2,2502,6,0,1,
+2957,5,2955,6,0,0,0,1,
+2957,6,2,2223,2582,2361,1,0,1,
+2957,7,2955,5,0,0,0,0,0,1,
+2957,9,2955,1274,2653,4,0,0,0,0,0,1,
+2963,1,2961,1,
+2963,2,2,2959,1,
+2963,3,2961,3,0,1,
+2963,4,2,1600,8,0,1,
+2963,5,2961,5,0,0,0,1,
+2963,6,2,2724,1929,1507,1,0,1,
+2963,7,2961,17,0,0,0,0,0,1,
+2963,9,2961,2845,2121,9,0,0,0,0,0,1,
+2969,1,2966,1,
+2969,2,3,2968,1,
+2969,3,2966,3,0,1,
+2969,4,3,2702,4,0,1,
+2969,5,2966,3,0,0,0,1,
+2969,6,3,212,181,1690,1,0,1,
+2969,7,2966,4,0,0,0,0,0,1,
+2969,9,2966,2846,1727,0,0,0,0,0,0,1,
+2971,1,2961,1,
+2971,2,10,2970,1,
+2971,3,2961,2,0,1,
+2971,4,10,1931,5,0,1,
+2971,5,2961,5,0,0,0,1,
+2971,6,10,905,1121,2893,0,0,1,
+2971,7,2961,8,0,0,0,0,0,1,
+2971,9,2961,1724,2610,15,0,0,0,0,0,1,
+2999,1,2982,1,
+2999,2,17,2995,1,
+2999,3,2982,4,0,1,
+2999,4,17,2779,12,0,1,
+2999,5,2982,8,0,0,0,1,
+2999,6,17,2843,164,1108,7,0,1,
+2999,7,2982,3,0,0,0,0,0,1,
+2999,9,2982,506,1970,7,0,0,0,0,0,1,
+3001,1,2987,1,
+3001,2,14,2999,1,
+3001,3,2987,2,0,1,
+3001,4,14,2975,15,0,1,
+3001,5,2987,1,0,0,0,1,
+3001,6,14,1887,1943,1408,2,0,1,
+3001,7,2987,1,0,0,0,0,0,1,
+3001,9,2987,639,1829,0,0,0,0,0,0,1,
+3011,1,3009,1,
+3011,2,2,3007,1,
+3011,3,3009,3,0,1,
+3011,4,2,2235,7,0,1,
+3011,5,3009,4,0,0,0,1,
+3011,6,2,452,208,2613,1,0,1,
+3011,7,3009,2,0,0,0,0,0,1,
+3011,9,3009,1678,2158,1,0,0,0,0,0,1,
+3019,1,3017,1,
+3019,2,2,3015,1,
+3019,3,3017,4,0,1,
+3019,4,2,2924,8,0,1,
+3019,5,3017,4,0,0,0,1,
+3019,6,2,2983,1076,2099,0,0,1,
+3023,1,3018,1,
+3023,2,5,3021,1,
+3023,3,3018,2,0,1,
+3023,4,5,3019,3,0,1,
+3023,5,3018,9,0,0,0,1,
+3023,6,5,731,1273,1407,1,0,1,
+3023,7,3018,8,0,0,0,0,0,1,
+3023,9,3018,104,971,0,0,0,0,0,0,1,
+3037,1,3035,1,
+3037,2,2,3036,1,
+3037,3,3035,2,0,1,
+3037,4,2,1881,9,0,1,
+3037,5,3035,5,0,0,0,1,
+3037,6,2,2415,1532,928,0,0,1,
+3037,7,3035,22,0,0,0,0,0,1,
+3037,9,3035,272,2593,4,0,0,0,0,0,1,
+3041,1,3038,1,
+3041,2,3,3030,1,
+3041,3,3038,1,0,1,
+3041,4,3,2059,8,0,1,
+3041,5,3038,1,0,0,0,1,
+3041,6,3,1279,1713,2942,4,0,1,
+3041,7,3038,6,0,0,0,0,0,1,
+3041,9,3038,2606,1279,0,0,0,0,0,0,1,
+3049,1,3038,1,
+3049,2,11,3048,1,
+3049,3,3038,3,0,1,
+3049,4,11,2806,27,0,1,
+3049,5,3038,5,0,0,0,1,
+3049,6,11,453,1501,2406,0,0,1,
+3049,7,3038,2,0,0,0,0,0,1,
+3049,9,3038,1727,1617,3,0,0,0,0,0,1,
+3061,1,3055,1,
+3061,2,6,3057,1,
+3061,3,3055,2,0,1,
+3061,4,6,2404,10,0,1,
+3061,5,3055,12,0,0,0,1,
+3061,6,6,2164,914,1417,1,0,1,
+3061,7,3055,1,0,0,0,0,0,1,
+3061,9,3055,704,1540,0,0,0,0,0,0,1,
+3067,1,3065,1,
+3067,2,2,3063,1,
+3067,3,3065,4,0,1,
+3067,4,2,2516,8,0,1,
+3067,5,3065,5,0,0,0,1,
+3067,6,2,2295,2309,2709,0,0,1,
+3067,7,3065,2,0,0,0,0,0,1,
+3067,9,3065,304,1495,12,0,0,0,0,0,1,
+3079,1,3073,1,
+3079,2,6,3078,1,
+3079,3,3073,1,0,1,
+3079,4,6,2775,3,0,1,
+3079,5,3073,2,0,0,0,1,
+3079,6,6,2589,1176,1907,0,0,1,
+3079,7,3073,4,0,0,0,0,0,1,
+3079,9,3073,513,1559,2,0,0,0,0,0,1,
+3083,1,3081,1,
+3083,2,2,3079,1,
+3083,3,3081,2,0,1,
+3083,4,2,1589,11,0,1,
+3083,5,3081,5,0,0,0,1,
+3083,6,2,1552,662,2261,5,0,1,
+3083,7,3081,20,0,0,0,0,0,1,
+3083,9,3081,124,2,6,0,0,0,0,0,1,
+3089,1,3086,1,
+3089,2,3,3082,1,
+3089,3,3086,3,0,1,
+3089,4,3,3009,1,0,1,
+3089,5,3086,5,0,0,0,1,
+3089,6,3,822,2198,2929,5,0,1,
+3089,7,3086,22,0,0,0,0,0,1,
+3089,9,3086,1304,2593,1,0,0,0,0,0,1,
+3109,1,3103,1,
+3109,2,6,3105,1,
+3109,3,3103,4,0,1,
+3109,4,6,3105,6,0,1,
+3109,5,3103,3,0,0,0,1,
+3109,6,6,174,2325,2041,0,0,1,
+3109,7,3103,8,0,0,0,0,0,1,
+3109,9,3103,2388,1654,18,0,0,0,0,0,1,
+3119,1,3112,1,
+3119,2,7,3118,1,
+3119,3,3112,8,0,1,
+3119,4,7,2052,3,0,1,
+3119,5,3112,1,0,0,0,1,
+3119,6,7,2363,2315,1459,1,0,1,
+3119,7,3112,1,0,0,0,0,0,1,
+3119,9,3112,1849,450,1,0,0,0,0,0,1,
+3121,1,3114,1,
+3121,2,7,3114,1,
+3121,3,3114,1,0,1,
+3121,4,7,1779,0,0,1,
+3121,5,3114,1,0,0,0,1,
+3121,6,7,1798,478,2851,0,0,1,
+3121,7,3114,5,0,0,0,0,0,1,
+3121,9,3114,2996,1972,11,0,0,0,0,0,1,
+3137,1,3134,1,
+3137,2,3,3131,1,
+3137,3,3134,4,0,1,
+3137,4,3,2714,1,0,1,
+3137,5,3134,15,0,0,0,1,
+3137,6,3,3061,2685,3099,1,0,1,
+3137,7,3134,23,0,0,0,0,0,1,
+3137,9,3134,610,703,8,0,0,0,0,0,1,
+3163,1,3160,1,
+3163,2,3,3162,1,
+3163,3,3160,4,0,1,
+3163,4,3,1675,5,0,1,
+3163,5,3160,6,0,0,0,1,
+3163,6,3,1181,2392,3096,0,0,1,
+3167,1,3162,1,
+3167,2,5,3164,1,
+3167,3,3162,1,0,1,
+3167,4,5,1750,4,0,1,
+3167,5,3162,5,0,0,0,1,
+3167,6,5,1333,321,2821,1,0,1,
+3167,7,3162,13,0,0,0,0,0,1,
+3167,9,3162,2779,2174,1,0,0,0,0,0,1,
+3169,1,3162,1,
+3169,2,7,3162,1,
+3169,3,3162,1,0,1,
+3169,4,7,2295,0,0,1,
+3169,5,3162,8,0,0,0,1,
+3169,6,7,2744,731,3147,0,0,1,
+3169,7,3162,10,0,0,0,0,0,1,
+3169,9,3162,2562,1570,9,0,0,0,0,0,1,
+3181,1,3174,1,
+3181,2,7,3179,1,
+3181,3,3174,4,0,1,
+3181,4,7,1885,4,0,1,
+3181,5,3174,1,0,0,0,1,
+3181,6,7,937,2559,801,0,0,1,
+3181,7,3174,1,0,0,0,0,0,1,
+3181,9,3174,2312,2637,4,0,0,0,0,0,1,
+3187,1,3185,1,
+3187,2,2,3183,1,
+3187,3,3185,5,0,1,
+3187,4,2,1795,8,0,1,
+3187,5,3185,3,0,0,0,1,
+3187,6,2,134,564,1147,0,0,1,
+3187,7,3185,7,0,0,0,0,0,1,
+3187,9,3185,2880,1947,5,0,0,0,0,0,1,
+3191,1,3180,1,
+3191,2,11,3189,1,
+3191,3,3180,6,0,1,
+3191,4,11,1986,5,0,1,
+3191,5,3180,4,0,0,0,1,
+3191,6,11,1308,2065,2741,2,0,1,
+3191,7,3180,1,0,0,0,0,0,1,
+3191,9,3180,1632,2601,7,0,0,0,0,0,1,
+3203,1,3201,1,
+3203,2,2,3199,1,
+3203,3,3201,3,0,1,
+3203,4,2,2883,16,0,1,
+3203,5,3201,18,0,0,0,1,
+3203,6,2,610,1778,248,1,0,1,
+3203,7,3201,4,0,0,0,0,0,1,
+3203,9,3201,2402,1490,1,0,0,0,0,0,1,
+3209,1,3206,1,
+3209,2,3,3204,1,
+3209,3,3206,3,0,1,
+3209,4,3,2273,2,0,1,
+3209,5,3206,12,0,0,0,1,
+3209,6,3,911,304,2745,1,0,1,
+3217,1,3212,1,
+3217,2,5,3212,1,
+3217,3,3212,1,0,1,
+3217,4,5,2588,15,0,1,
+3217,5,3212,1,0,0,0,1,
+3217,6,5,1673,2408,2630,0,0,1,
+3217,7,3212,5,0,0,0,0,0,1,
+3217,9,3212,1567,3004,6,0,0,0,0,0,1,
+3221,1,3211,1,
+3221,2,10,3211,1,
+3221,3,3211,2,0,1,
+3221,4,10,1741,8,0,1,
+3221,5,3211,4,0,0,0,1,
+3221,6,10,2289,3027,2712,1,0,1,
+3221,7,3211,5,0,0,0,0,0,1,
+3221,9,3211,1296,1226,5,0,0,0,0,0,1,
+3229,1,3223,1,
+3229,2,6,3221,1,
+3229,3,3223,1,0,1,
+3229,4,6,3001,0,0,1,
+3229,5,3223,6,0,0,0,1,
+3229,6,6,2758,3091,1986,2,0,1,
+3229,7,3223,2,0,0,0,0,0,1,
+3229,9,3223,586,2272,18,0,0,0,0,0,1,
+3251,1,3245,1,
+3251,2,6,3249,1,
+3251,3,3245,1,0,1,
+3251,4,6,3241,7,0,1,
+3251,5,3245,7,0,0,0,1,
+3251,6,6,1634,696,2665,2,0,1,
+3251,7,3245,2,0,0,0,0,0,1,
+3251,9,3245,1022,2372,11,0,0,0,0,0,1,
+3253,1,3251,1,
+3253,2,2,3252,1,
+3253,3,3251,2,0,1,
+3253,4,2,2830,3,0,1,
+3253,5,3251,3,0,0,0,1,
+3253,6,2,1160,736,2923,0,0,1,
+3253,7,3251,8,0,0,0,0,0,1,
+3253,9,3251,1654,2858,3,0,0,0,0,0,1,
+3257,1,3254,1,
+3257,2,3,3252,1,
+3257,3,3254,1,0,1,
+3257,4,3,2302,0,0,1,
+3257,5,3254,20,0,0,0,1,
+3257,6,3,1992,1026,2176,2,0,1,
+3257,7,3254,22,0,0,0,0,0,1,
+3257,9,3254,2081,1711,1,0,0,0,0,0,1,
+3259,1,3256,1,
+3259,2,3,3248,1,
+3259,3,3256,6,0,1,
+3259,4,3,2888,4,0,1,
+3259,5,3256,17,0,0,0,1,
+3259,6,3,2050,892,1791,0,0,1,
+3259,7,3256,1,0,0,0,0,0,1,
+3259,9,3256,2286,3016,3,0,0,0,0,0,1,
+3271,1,3268,1,
+3271,2,3,3269,1,
+3271,3,3268,1,0,1,
+3271,4,3,2843,3,0,1,
+3271,5,3268,1,0,0,0,1,
+3271,6,3,959,2172,3031,0,0,1,
+3271,7,3268,4,0,0,0,0,0,1,
+3271,9,3268,1765,3006,11,0,0,0,0,0,1,
+3299,1,3297,1,
+3299,2,2,3293,1,
+3299,3,3297,2,0,1,
+3299,4,2,1855,0,0,1,
+3299,5,3297,8,0,0,0,1,
+3299,6,2,1901,1806,965,1,0,1,
+3299,7,3297,7,0,0,0,0,0,1,
+3299,9,3297,2403,100,1,0,0,0,0,0,1,
+3301,1,3295,1,
+3301,2,6,3297,1,
+3301,3,3295,2,0,1,
+3301,4,6,1754,2,0,1,
+3301,5,3295,2,0,0,0,1,
+3301,6,6,893,732,2883,0,0,1,
+3301,7,3295,6,0,0,0,0,0,1,
+3301,9,3295,2830,3284,9,0,0,0,0,0,1,
+3307,1,3305,1,
+3307,2,2,3306,1,
+3307,3,3305,2,0,1,
+3307,4,2,2555,2,0,1,
+3307,5,3305,9,0,0,0,1,
+3307,6,2,1264,2264,1625,0,0,1,
+3307,7,3305,7,0,0,0,0,0,1,
+3307,9,3305,2128,2558,2,0,0,0,0,0,1,
+3313,1,3303,1,
+3313,2,10,3312,1,
+3313,3,3303,15,0,1,
+3313,4,10,3105,6,0,1,
+3313,5,3303,5,0,0,0,1,
+3313,6,10,2527,1900,3133,0,0,1,
+3313,7,3303,5,0,0,0,0,0,1,
+3313,9,3303,193,1954,8,0,0,0,0,0,1,
+3319,1,3313,1,
+3319,2,6,3317,1,
+3319,3,3313,3,0,1,
+3319,4,6,3309,7,0,1,
+3319,5,3313,12,0,0,0,1,
+3319,6,6,3276,833,1883,0,0,1,
+3319,7,3313,1,0,0,0,0,0,1,
+3319,9,3313,2553,2265,6,0,0,0,0,0,1,
+3323,1,3321,1,
+3323,2,2,3319,1,
+3323,3,3321,2,0,1,
+3323,4,2,2982,7,0,1,
+3323,5,3321,3,0,0,0,1,
+3323,6,2,1089,591,1836,1,0,1,
+3323,7,3321,4,0,0,0,0,0,1,
+3323,9,3321,987,1801,0,0,0,0,0,0,1,
+3329,1,3326,1,
+3329,2,3,3328,1,
+3329,3,3326,5,0,1,
+3329,4,3,3247,7,0,1,
+3329,5,3326,9,0,0,0,1,
+3329,6,3,631,1163,1915,1,0,1,
+3329,7,3326,7,0,0,0,0,0,1,
+3329,9,3326,982,204,3,0,0,0,0,0,1,
+3331,1,3328,1,
+3331,2,3,3322,1,
+3331,3,3328,1,0,1,
+3331,4,3,1902,7,0,1,
+3331,5,3328,5,0,0,0,1,
+3331,6,3,419,756,2615,0,0,1,
+3343,1,3338,1,
+3343,2,5,3342,1,
+3343,3,3338,10,0,1,
+3343,4,5,3261,3,0,1,
+3343,5,3338,15,0,0,0,1,
+3343,6,5,1284,436,3081,0,0,1,
+3343,7,3338,10,0,0,0,0,0,1,
+3343,9,3338,1109,2343,16,0,0,0,0,0,1,
+3347,1,3345,1,
+3347,2,2,3343,1,
+3347,3,3345,3,0,1,
+3347,4,2,2846,7,0,1,
+3347,5,3345,6,0,0,0,1,
+3347,6,2,1196,1277,1699,1,0,1,
+3347,7,3345,3,0,0,0,0,0,1,
+3347,9,3345,1310,551,4,0,0,0,0,0,1,
+3359,1,3348,1,
+3359,2,11,3357,1,
+3359,3,3348,2,0,1,
+3359,4,11,3075,3,0,1,
+3359,5,3348,2,0,0,0,1,
+3359,6,11,1811,2201,3024,1,0,1,
+3359,7,3348,5,0,0,0,0,0,1,
+3359,9,3348,3082,3330,6,0,0,0,0,0,1,
+3361,1,3339,1,
+3361,2,22,3360,1,
+3361,3,3339,4,0,1,
+3361,4,22,1909,12,0,1,
+3361,5,3339,5,0,0,0,1,
+3361,6,22,429,102,468,0,0,1,
+3361,7,3339,5,0,0,0,0,0,1,
+3361,9,3339,3147,1704,5,0,0,0,0,0,1,
+3371,1,3369,1,
+3371,2,2,3366,1,
+3371,3,3369,2,0,1,
+3371,4,2,2291,3,0,1,
+3371,5,3369,4,0,0,0,1,
+3371,6,2,2408,1283,2758,3,0,1,
+3373,1,3368,1,
+3373,2,5,3372,1,
+3373,3,3368,2,0,1,
+3373,4,5,3354,20,0,1,
+3373,5,3368,1,0,0,0,1,
+3373,6,5,1701,2205,2230,0,0,1,
+3389,1,3386,1,
+3389,2,3,3387,1,
+3389,3,3386,6,0,1,
+3389,4,3,3385,4,0,1,
+3389,5,3386,4,0,0,0,1,
+3389,6,3,2246,619,3370,3,0,1,
+3391,1,3388,1,
+3391,2,3,3389,1,
+3391,3,3388,7,0,1,
+3391,4,3,2209,6,0,1,
+3391,5,3388,5,0,0,0,1,
+3391,6,3,38,1728,3156,0,0,1,
+3407,1,3402,1,
+3407,2,5,3405,1,
+3407,3,3402,2,0,1,
+3407,4,5,2792,5,0,1,
+3407,5,3402,22,0,0,0,1,
+3407,6,5,1933,3127,1959,1,0,1,
+3413,1,3411,1,
+3413,2,2,3405,1,
+3413,3,3411,5,0,1,
+3413,4,2,2381,5,0,1,
+3413,5,3411,9,0,0,0,1,
+3413,6,2,1557,3367,2318,2,0,1,
+3433,1,3428,1,
+3433,2,5,3432,1,
+3433,3,3428,5,0,1,
+3433,4,5,1930,6,0,1,
+3433,5,3428,1,0,0,0,1,
+3433,6,5,2465,1603,1777,0,0,1,
+3449,1,3446,1,
+3449,2,3,3448,1,
+3449,3,3446,4,0,1,
+3449,4,3,2833,7,0,1,
+3449,5,3446,7,0,0,0,1,
+3449,6,3,1525,1591,526,1,0,1,
+3457,1,3450,1,
+3457,2,7,3454,1,
+3457,3,3450,8,0,1,
+3457,4,7,2376,8,0,1,
+3457,5,3450,8,0,0,0,1,
+3457,6,7,3136,2416,3421,0,0,1,
+3461,1,3459,1,
+3461,2,2,3460,1,
+3461,3,3459,3,0,1,
+3461,4,2,3161,3,0,1,
+3461,5,3459,9,0,0,0,1,
+3461,6,2,1077,1453,3380,1,0,1,
+3463,1,3460,1,
+3463,2,3,3461,1,
+3463,3,3460,5,0,1,
+3463,4,3,3459,4,0,1,
+3463,5,3460,1,0,0,0,1,
+3463,6,3,2512,2050,491,0,0,1,
+3467,1,3465,1,
+3467,2,2,3455,1,
+3467,3,3465,4,0,1,
+3467,4,2,2489,15,0,1,
+3467,5,3465,2,0,0,0,1,
+3467,6,2,1625,364,3455,1,0,1,
+3469,1,3467,1,
+3469,2,2,3465,1,
+3469,3,3467,6,0,1,
+3469,4,2,2383,12,0,1,
+3469,5,3467,3,0,0,0,1,
+3469,6,2,3457,3451,3465,0,0,1,
+3491,1,3489,1,
+3491,2,2,3490,1,
+3491,3,3489,3,0,1,
+3491,4,2,1980,2,0,1,
+3491,5,3489,6,0,0,0,1,
+3491,6,2,681,1056,2910,2,0,1,
+3499,1,3497,1,
+3499,2,2,3498,1,
+3499,3,3497,4,0,1,
+3499,4,2,3149,6,0,1,
+3499,5,3497,6,0,0,0,1,
+3499,6,2,1570,3394,2404,0,0,1,
+3511,1,3504,1,
+3511,2,7,3508,1,
+3511,3,3504,1,0,1,
+3511,4,7,2456,5,0,1,
+3511,5,3504,1,0,0,0,1,
+3511,6,7,1811,3091,2649,0,0,1,
+3517,1,3515,1,
+3517,2,2,3516,1,
+3517,3,3515,2,0,1,
+3517,4,2,2895,3,0,1,
+3517,5,3515,2,0,0,0,1,
+3517,6,2,646,1777,3426,0,0,1,
+3527,1,3522,1,
+3527,2,5,3526,1,
+3527,3,3522,2,0,1,
+3527,4,5,2323,2,0,1,
+3527,5,3522,2,0,0,0,1,
+3527,6,5,766,3357,2445,2,0,1,
+3529,1,3512,1,
+3529,2,17,3525,1,
+3529,3,3512,1,0,1,
+3529,4,17,1957,21,0,1,
+3529,5,3512,9,0,0,0,1,
+3529,6,17,559,3222,338,0,0,1,
+3533,1,3531,1,
+3533,2,2,3532,1,
+3533,3,3531,2,0,1,
+3533,4,2,3345,3,0,1,
+3533,5,3531,5,0,0,0,1,
+3533,6,2,746,1540,1167,2,0,1,
+3539,1,3537,1,
+3539,2,2,3525,1,
+3539,3,3537,2,0,1,
+3539,4,2,3080,4,0,1,
+3539,5,3537,8,0,0,0,1,
+3539,6,2,294,3273,2694,1,0,1,
+3541,1,3534,1,
+3541,2,7,3535,1,
+3541,3,3534,1,0,1,
+3541,4,7,3537,4,0,1,
+3541,5,3534,4,0,0,0,1,
+3541,6,7,1620,3281,2886,0,0,1,
+3547,1,3545,1,
+3547,2,2,3546,1,
+3547,3,3545,2,0,1,
+3547,4,2,3540,8,0,1,
+3547,5,3545,6,0,0,0,1,
+3547,6,2,3029,624,2127,0,0,1,
+3557,1,3555,1,
+3557,2,2,3553,1,
+3557,3,3555,3,0,1,
+3557,4,2,3127,12,0,1,
+3557,5,3555,4,0,0,0,1,
+3557,6,2,2418,1690,2780,1,0,1,
+3559,1,3556,1,
+3559,2,3,3558,1,
+3559,3,3556,1,0,1,
+3559,4,3,1956,2,0,1,
+3559,5,3556,3,0,0,0,1,
+3559,6,3,3488,412,1908,0,0,1,
+3571,1,3569,1,
+3571,2,2,3567,1,
+3571,3,3569,2,0,1,
+3571,4,2,2653,8,0,1,
+3571,5,3569,2,0,0,0,1,
+3571,6,2,1424,2222,3504,0,0,1,
+3581,1,3579,1,
+3581,2,2,3577,1,
+3581,3,3579,3,0,1,
+3581,4,2,2125,6,0,1,
+3581,5,3579,14,0,0,0,1,
+3581,6,2,1283,1744,316,2,0,1,
+3583,1,3580,1,
+3583,2,3,3582,1,
+3583,3,3580,11,0,1,
+3583,4,3,3572,12,0,1,
+3583,5,3580,1,0,0,0,1,
+3583,6,3,549,607,2464,0,0,1,
+3593,1,3590,1,
+3593,2,3,3585,1,
+3593,3,3590,1,0,1,
+3593,4,3,3195,2,0,1,
+3593,5,3590,6,0,0,0,1,
+3593,6,3,3077,1496,2356,1,0,1,
+3607,1,3602,1,
+3607,2,5,3605,1,
+3607,3,3602,1,0,1,
+3607,4,5,2930,17,0,1,
+3607,5,3602,10,0,0,0,1,
+3607,6,5,3486,3024,913,2,0,1,
+3613,1,3611,1,
+3613,2,2,3609,1,
+3613,3,3611,5,0,1,
+3613,4,2,3295,9,0,1,
+3613,5,3611,14,0,0,0,1,
+3613,6,2,1181,2771,2217,0,0,1,
+3617,1,3614,1,
+3617,2,3,3605,1,
+3617,3,3614,1,0,1,
+3617,4,3,2714,0,0,1,
+3617,5,3614,4,0,0,0,1,
+3617,6,3,825,2384,42,1,0,1,
+3623,1,3618,1,
+3623,2,5,3616,1,
+3623,3,3618,3,0,1,
+3623,4,5,1865,2,0,1,
+3623,5,3618,12,0,0,0,1,
+3623,6,5,3350,1960,2559,3,0,1,
+3631,1,3616,1,
+3631,2,15,3630,1,
+3631,3,3616,1,0,1,
+3631,4,15,3231,5,0,1,
+3631,5,3616,3,0,0,0,1,
+3631,6,15,2672,2089,3556,0,0,1,
+3637,1,3635,1,
+3637,2,2,3630,1,
+3637,3,3635,5,0,1,
+3637,4,2,1942,12,0,1,
+3637,5,3635,7,0,0,0,1,
+3637,6,2,3284,865,1745,0,0,1,
+3643,1,3641,1,
+3643,2,2,3642,1,
+3643,3,3641,5,0,1,
+3643,4,2,2103,2,0,1,
+3643,5,3641,3,0,0,0,1,
+3643,6,2,2646,2013,2118,0,0,1,
+3659,1,3657,1,
+3659,2,2,3658,1,
+3659,3,3657,4,0,1,
+3659,4,2,2273,4,0,1,
+3659,5,3657,2,0,0,0,1,
+3659,6,2,1806,2084,2998,2,0,1,
+3671,1,3658,1,
+3671,2,13,3667,1,
+3671,3,3658,4,0,1,
+3671,4,13,3010,6,0,1,
+3671,5,3658,9,0,0,0,1,
+3671,6,13,1907,728,579,4,0,1,
+3673,1,3668,1,
+3673,2,5,3670,1,
+3673,3,3668,5,0,1,
+3673,4,5,2625,10,0,1,
+3673,5,3668,2,0,0,0,1,
+3673,6,5,54,1117,3020,0,0,1,
+3677,1,3675,1,
+3677,2,2,3673,1,
+3677,3,3675,3,0,1,
+3677,4,2,2118,6,0,1,
+3677,5,3675,2,0,0,0,1,
+3677,6,2,3242,690,3160,2,0,1,
+3691,1,3689,1,
+3691,2,2,3685,1,
+3691,3,3689,2,0,1,
+3691,4,2,3456,11,0,1,
+3691,5,3689,9,0,0,0,1,
+3691,6,2,2293,2814,3611,0,0,1,
+3697,1,3692,1,
+3697,2,5,3692,1,
+3697,3,3692,1,0,1,
+3697,4,5,2023,15,0,1,
+3697,5,3692,1,0,0,0,1,
+3697,6,5,2968,780,3552,0,0,1,
+3701,1,3699,1,
+3701,2,2,3697,1,
+3701,3,3699,3,0,1,
+3701,4,2,2072,1,0,1,
+3701,5,3699,7,0,0,0,1,
+3701,6,2,2528,2741,2061,2,0,1,
+3709,1,3707,1,
+3709,2,2,3708,1,
+3709,3,3707,6,0,1,
+3709,4,2,2816,3,0,1,
+3709,5,3707,3,0,0,0,1,
+3709,6,2,2504,2011,181,0,0,1,
+3719,1,3712,1,
+3719,2,7,3716,1,
+3719,3,3712,5,0,1,
+3719,4,7,3402,7,0,1,
+3719,5,3712,9,0,0,0,1,
+3719,6,7,1864,1919,3182,3,0,1,
+3727,1,3724,1,
+3727,2,3,3725,1,
+3727,3,3724,3,0,1,
+3727,4,3,2722,3,0,1,
+3727,5,3724,11,0,0,0,1,
+3727,6,3,2653,1052,1194,0,0,1,
+3733,1,3731,1,
+3733,2,2,3729,1,
+3733,3,3731,6,0,1,
+3733,4,2,3404,6,0,1,
+3733,5,3731,11,0,0,0,1,
+3733,6,2,3721,3715,3729,0,0,1,
+3739,1,3732,1,
+3739,2,7,3736,1,
+3739,3,3732,11,0,1,
+3739,4,7,2830,1,0,1,
+3739,5,3732,1,0,0,0,1,
+3739,6,7,3724,475,2935,0,0,1,
+3761,1,3758,1,
+3761,2,3,3760,1,
+3761,3,3758,4,0,1,
+3761,4,3,3323,4,0,1,
+3761,5,3758,8,0,0,0,1,
+3761,6,3,2793,2314,272,3,0,1,
+3767,1,3762,1,
+3767,2,5,3765,1,
+3767,3,3762,1,0,1,
+3767,4,5,2094,5,0,1,
+3767,5,3762,2,0,0,0,1,
+3767,6,5,2774,504,2920,1,0,1,
+3769,1,3762,1,
+3769,2,7,3751,1,
+3769,3,3762,1,0,1,
+3769,4,7,3487,4,0,1,
+3769,5,3762,2,0,0,0,1,
+3769,6,7,371,1049,2185,0,0,1,
+3779,1,3777,1,
+3779,2,2,3774,1,
+3779,3,3777,14,0,1,
+3779,4,2,2807,3,0,1,
+3779,5,3777,11,0,0,0,1,
+3779,6,2,158,3225,191,1,0,1,
+3793,1,3788,1,
+3793,2,5,3788,1,
+3793,3,3788,1,0,1,
+3793,4,5,3571,10,0,1,
+3793,5,3788,7,0,0,0,1,
+3793,6,5,2860,3155,3660,0,0,1,
+3797,1,3795,1,
+3797,2,2,3796,1,
+3797,3,3795,2,0,1,
+3797,4,2,3340,3,0,1,
+3797,5,3795,5,0,0,0,1,
+3797,6,2,3487,2754,1721,1,0,1,
+3803,1,3801,1,
+3803,2,2,3799,1,
+3803,3,3801,3,0,1,
+3803,4,2,2826,7,0,1,
+3803,5,3801,3,0,0,0,1,
+3803,6,2,2899,2520,2493,1,0,1,
+3821,1,3818,1,
+3821,2,3,3819,1,
+3821,3,3818,5,0,1,
+3821,4,3,2640,14,0,1,
+3821,5,3818,4,0,0,0,1,
+3821,6,3,242,2236,2523,2,0,1,
+3823,1,3820,1,
+3823,2,3,3822,1,
+3823,3,3820,3,0,1,
+3823,4,3,2316,18,0,1,
+3823,5,3820,3,0,0,0,1,
+3823,6,3,3256,688,2440,0,0,1,
+3833,1,3830,1,
+3833,2,3,3827,1,
+3833,3,3830,7,0,1,
+3833,4,3,2810,1,0,1,
+3833,5,3830,3,0,0,0,1,
+3833,6,3,2090,3555,3536,1,0,1,
+3847,1,3842,1,
+3847,2,5,3845,1,
+3847,3,3842,1,0,1,
+3847,4,5,2007,17,0,1,
+3847,5,3842,2,0,0,0,1,
+3847,6,5,2960,2951,3576,0,0,1,
+3851,1,3849,1,
+3851,2,2,3847,1,
+3851,3,3849,2,0,1,
+3851,4,2,2109,7,0,1,
+3851,5,3849,2,0,0,0,1,
+3851,6,2,538,2883,1595,1,0,1,
+3853,1,3851,1,
+3853,2,2,3852,1,
+3853,3,3851,2,0,1,
+3853,4,2,3714,9,0,1,
+3853,5,3851,7,0,0,0,1,
+3853,6,2,1061,683,3379,0,0,1,
+3863,1,3858,1,
+3863,2,5,3858,1,
+3863,3,3858,1,0,1,
+3863,4,5,3343,7,0,1,
+3863,5,3858,6,0,0,0,1,
+3863,6,5,2842,3189,2955,1,0,1,
+3877,1,3875,1,
+3877,2,2,3876,1,
+3877,3,3875,2,0,1,
+3877,4,2,2067,6,0,1,
+3877,5,3875,4,0,0,0,1,
+3877,6,2,2388,1029,2690,0,0,1,
+3881,1,3868,1,
+3881,2,13,3879,1,
+3881,3,3868,18,0,1,
+3881,4,13,3449,9,0,1,
+3881,5,3868,6,0,0,0,1,
+3881,6,13,1214,1806,2289,2,0,1,
+3889,1,3878,1,
+3889,2,11,3888,1,
+3889,3,3878,4,0,1,
+3889,4,11,2189,12,0,1,
+3889,5,3878,3,0,0,0,1,
+3889,6,11,418,1211,2603,0,0,1,
+3907,1,3905,1,
+3907,2,2,3903,1,
+3907,3,3905,5,0,1,
+3907,4,2,2057,8,0,1,
+3907,5,3905,2,0,0,0,1,
+3907,6,2,2140,3244,3396,4,0,1,
+3911,1,3898,1,
+3911,2,13,3909,1,
+3911,3,3898,2,0,1,
+3911,4,13,3384,3,0,1,
+3911,5,3898,7,0,0,0,1,
+3911,6,13,509,2434,770,3,0,1,
+3917,1,3915,1,
+3917,2,2,3913,1,
+3917,3,3915,3,0,1,
+3917,4,2,3340,6,0,1,
+3917,5,3915,6,0,0,0,1,
+3917,6,2,2753,2025,635,2,0,1,
+3919,1,3916,1,
+3919,2,3,3914,1,
+3919,3,3916,20,0,1,
+3919,4,3,3459,7,0,1,
+3919,5,3916,1,0,0,0,1,
+3919,6,3,3364,1782,1393,0,0,1,
+3923,1,3921,1,
+3923,2,2,3922,1,
+3923,3,3921,2,0,1,
+3923,4,2,3517,11,0,1,
+3923,5,3921,2,0,0,0,1,
+3923,6,2,2908,1332,444,2,0,1,
+3929,1,3926,1,
+3929,2,3,3928,1,
+3929,3,3926,4,0,1,
+3929,4,3,3318,7,0,1,
+3929,5,3926,4,0,0,0,1,
+3929,6,3,3588,3864,2235,1,0,1,
+3931,1,3929,1,
+3931,2,2,3927,1,
+3931,3,3929,6,0,1,
+3931,4,2,2867,8,0,1,
+3931,5,3929,5,0,0,0,1,
+3931,6,2,3919,3913,3927,0,0,1,
+3943,1,3940,1,
+3943,2,3,3941,1,
+3943,3,3940,5,0,1,
+3943,4,3,3258,3,0,1,
+3943,5,3940,18,0,0,0,1,
+3943,6,3,344,3559,2762,0,0,1,
+3947,1,3945,1,
+3947,2,2,3946,1,
+3947,3,3945,3,0,1,
+3947,4,2,3940,8,0,1,
+3947,5,3945,29,0,0,0,1,
+3947,6,2,2244,2906,2996,1,0,1,
+3967,1,3961,1,
+3967,2,6,3966,1,
+3967,3,3961,1,0,1,
+3967,4,6,2458,2,0,1,
+3967,5,3961,4,0,0,0,1,
+3967,6,6,768,313,254,1,0,1,
+3989,1,3987,1,
+3989,2,2,3988,1,
+3989,3,3987,10,0,1,
+3989,4,2,3348,3,0,1,
+3989,5,3987,21,0,0,0,1,
+3989,6,2,1169,1437,2331,2,0,1,
+4001,1,3998,1,
+4001,2,3,4000,1,
+4001,3,3998,4,0,1,
+4001,4,3,2873,7,0,1,
+4001,5,3998,5,0,0,0,1,
+4001,6,3,1714,3347,624,3,0,1,
+4003,1,4001,1,
+4003,2,2,4002,1,
+4003,3,4001,2,0,1,
+4003,4,2,3996,8,0,1,
+4003,5,4001,28,0,0,0,1,
+4003,6,2,139,3070,2275,0,0,1,
+4007,1,4002,1,
+4007,2,5,4005,1,
+4007,3,4002,9,0,1,
+4007,4,5,2773,8,0,1,
+4007,5,4002,9,0,0,0,1,
+4007,6,5,738,297,3896,1,0,1,
+4013,1,4011,1,
+4013,2,2,4009,1,
+4013,3,4011,3,0,1,
+4013,4,2,2953,9,0,1,
+4013,5,4011,8,0,0,0,1,
+4013,6,2,312,1603,3671,1,0,1,
+4019,1,4017,1,
+4019,2,2,4015,1,
+4019,3,4017,3,0,1,
+4019,4,2,3470,7,0,1,
+4019,5,4017,7,0,0,0,1,
+4019,6,2,3869,2830,3408,1,0,1,
+4021,1,4019,1,
+4021,2,2,4020,1,
+4021,3,4019,5,0,1,
+4021,4,2,2365,3,0,1,
+4021,5,4019,5,0,0,0,1,
+4021,6,2,3492,2818,1504,0,0,1,
+4027,1,4024,1,
+4027,2,3,4020,1,
+4027,3,4024,3,0,1,
+4027,4,3,3765,2,0,1,
+4027,5,4024,1,0,0,0,1,
+4027,6,3,423,4007,3986,0,0,1,
+4049,1,4046,1,
+4049,2,3,4043,1,
+4049,3,4046,3,0,1,
+4049,4,3,4037,0,0,1,
+4049,5,4046,12,0,0,0,1,
+4049,6,3,1007,3235,653,2,0,1,
+4051,1,4041,1,
+4051,2,10,4050,1,
+4051,3,4041,2,0,1,
+4051,4,10,2367,5,0,1,
+4051,5,4041,1,0,0,0,1,
+4051,6,10,1767,3082,701,0,0,1,
+4057,1,4052,1,
+4057,2,5,4056,1,
+4057,3,4052,2,0,1,
+4057,4,5,2914,6,0,1,
+4057,5,4052,2,0,0,0,1,
+4057,6,5,1797,3212,2395,2,0,1,
+4073,1,4070,1,
+4073,2,3,4061,1,
+4073,3,4070,4,0,1,
+4073,4,3,3117,0,0,1,
+4073,5,4070,8,0,0,0,1,
+4073,6,3,2900,4001,3356,3,0,1,
+4079,1,4068,1,
+4079,2,11,4076,1,
+4079,3,4068,2,0,1,
+4079,4,11,3922,8,0,1,
+4079,5,4068,3,0,0,0,1,
+4079,6,11,265,679,1978,1,0,1,
+4091,1,4089,1,
+4091,2,2,4090,1,
+4091,3,4089,3,0,1,
+4091,4,2,4084,8,0,1,
+4091,5,4089,12,0,0,0,1,
+4091,6,2,155,771,4021,2,0,1,
+4093,1,4091,1,
+4093,2,2,4092,1,
+4093,3,4091,4,0,1,
+4093,4,2,3106,6,0,1,
+4093,5,4091,2,0,0,0,1,
+4093,6,2,1942,1514,2807,0,0,1,
+4099,1,4097,1,
+4099,2,2,4095,1,
+4099,3,4097,2,0,1,
+4099,4,2,3462,8,0,1,
+4099,5,4097,2,0,0,0,1,
+4099,6,2,2299,633,3078,0,0,1,
+4111,1,4099,1,
+4111,2,12,4110,1,
+4111,3,4099,4,0,1,
+4111,4,12,3586,5,0,1,
+4111,5,4099,4,0,0,0,1,
+4111,6,12,1053,973,3920,0,0,1,
+4127,1,4122,1,
+4127,2,5,4125,1,
+4127,3,4122,1,0,1,
+4127,4,5,2630,5,0,1,
+4127,5,4122,3,0,0,0,1,
+4127,6,5,1872,1197,3436,1,0,1,
+4129,1,4116,1,
+4129,2,13,4120,1,
+4129,3,4116,1,0,1,
+4129,4,13,3348,48,0,1,
+4129,5,4116,7,0,0,0,1,
+4129,6,13,64,3902,3622,0,0,1,
+4133,1,4131,1,
+4133,2,2,4132,1,
+4133,3,4131,3,0,1,
+4133,4,2,2646,3,0,1,
+4133,5,4131,12,0,0,0,1,
+4133,6,2,849,3596,3591,1,0,1,
+4139,1,4137,1,
+4139,2,2,4135,1,
+4139,3,4137,2,0,1,
+4139,4,2,3367,8,0,1,
+4139,5,4137,5,0,0,0,1,
+4139,6,2,3148,2490,3012,2,0,1,
+4153,1,4148,1,
+4153,2,5,4150,1,
+4153,3,4148,1,0,1,
+4153,4,5,2470,16,0,1,
+4153,5,4148,7,0,0,0,1,
+4153,6,5,1334,1363,1137,0,0,1,
+4157,1,4155,1,
+4157,2,2,4156,1,
+4157,3,4155,3,0,1,
+4157,4,2,3798,3,0,1,
+4157,5,4155,6,0,0,0,1,
+4157,6,2,1241,1691,2413,1,0,1,
+4159,1,4156,1,
+4159,2,3,4157,1,
+4159,3,4156,3,0,1,
+4159,4,3,4155,4,0,1,
+4159,5,4156,1,0,0,0,1,
+4159,6,3,524,318,2954,0,0,1,
+4177,1,4172,1,
+4177,2,5,4174,1,
+4177,3,4172,3,0,1,
+4177,4,5,2899,10,0,1,
+4177,5,4172,2,0,0,0,1,
+4177,6,5,2637,2547,2641,0,0,1,
+4201,1,4190,1,
+4201,2,11,4200,1,
+4201,3,4190,1,0,1,
+4201,4,11,2944,12,0,1,
+4201,5,4190,1,0,0,0,1,
+4201,6,11,4121,1043,4040,0,0,1,
+4211,1,4205,1,
+4211,2,6,4208,1,
+4211,3,4205,3,0,1,
+4211,4,6,4052,4,0,1,
+4211,5,4205,11,0,0,0,1,
+4211,6,6,2570,1635,4208,3,0,1,
+4217,1,4214,1,
+4217,2,3,4212,1,
+4217,3,4214,1,0,1,
+4217,4,3,4045,0,0,1,
+4217,5,4214,9,0,0,0,1,
+4217,6,3,2712,633,2499,1,0,1,
+4219,1,4217,1,
+4219,2,2,4218,1,
+4219,3,4217,6,0,1,
+4219,4,2,4212,8,0,1,
+4219,5,4217,6,0,0,0,1,
+4219,6,2,2522,1265,3909,0,0,1,
+4229,1,4227,1,
+4229,2,2,4225,1,
+4229,3,4227,3,0,1,
+4229,4,2,2478,7,0,1,
+4229,5,4227,3,0,0,0,1,
+4229,6,2,1927,83,427,1,0,1,
+4231,1,4228,1,
+4231,2,3,4230,1,
+4231,3,4228,4,0,1,
+4231,4,3,3325,3,0,1,
+4231,5,4228,10,0,0,0,1,
+4231,6,3,956,953,3565,0,0,1,
+4241,1,4238,1,
+4241,2,3,4235,1,
+4241,3,4238,5,0,1,
+4241,4,3,4229,0,0,1,
+4241,5,4238,19,0,0,0,1,
+4241,6,3,1001,170,2946,1,0,1,
+4243,1,4241,1,
+4243,2,2,4239,1,
+4243,3,4241,6,0,1,
+4243,4,2,2742,8,0,1,
+4243,5,4241,5,0,0,0,1,
+4243,6,2,4231,4225,4239,0,0,1,
+4253,1,4251,1,
+4253,2,2,4249,1,
+4253,3,4251,3,0,1,
+4253,4,2,2244,6,0,1,
+4253,5,4251,2,0,0,0,1,
+4253,6,2,3397,1152,2531,5,0,1,
+4259,1,4257,1,
+4259,2,2,4246,1,
+4259,3,4257,4,0,1,
+4259,4,2,3422,0,0,1,
+4259,5,4257,6,0,0,0,1,
+4259,6,2,3885,1573,4168,3,0,1,
+4261,1,4259,1,
+4261,2,2,4260,1,
+4261,3,4259,6,0,1,
+4261,4,2,4254,8,0,1,
+4261,5,4259,4,0,0,0,1,
+4261,6,2,3462,1719,2416,0,0,1,
+4271,1,4264,1,
+4271,2,7,4269,1,
+4271,3,4264,3,0,1,
+4271,4,7,2992,4,0,1,
+4271,5,4264,8,0,0,0,1,
+4271,6,7,2631,1442,2342,2,0,1,
+4273,1,4268,1,
+4273,2,5,4268,1,
+4273,3,4268,1,0,1,
+4273,4,5,2546,10,0,1,
+4273,5,4268,1,0,0,0,1,
+4273,6,5,1236,2690,1754,0,0,1,
+4283,1,4281,1,
+4283,2,2,4279,1,
+4283,3,4281,2,0,1,
+4283,4,2,3405,11,0,1,
+4283,5,4281,2,0,0,0,1,
+4283,6,2,187,3765,1768,3,0,1,
+4289,1,4286,1,
+4289,2,3,4283,1,
+4289,3,4286,4,0,1,
+4289,4,3,4277,0,0,1,
+4289,5,4286,1,0,0,0,1,
+4289,6,3,295,148,3642,1,0,1,
+4297,1,4292,1,
+4297,2,5,4296,1,
+4297,3,4292,3,0,1,
+4297,4,5,3648,6,0,1,
+4297,5,4292,1,0,0,0,1,
+4297,6,5,3561,3069,3822,0,0,1,
+4327,1,4324,1,
+4327,2,3,4325,1,
+4327,3,4324,4,0,1,
+4327,4,3,2389,3,0,1,
+4327,5,4324,1,0,0,0,1,
+4327,6,3,1155,3649,3566,0,0,1,
+4337,1,4334,1,
+4337,2,3,4330,1,
+4337,3,4334,3,0,1,
+4337,4,3,4175,1,0,1,
+4337,5,4334,1,0,0,0,1,
+4337,6,3,55,176,3754,1,0,1,
+4339,1,4329,1,
+4339,2,10,4337,1,
+4339,3,4329,11,0,1,
+4339,4,10,2523,8,0,1,
+4339,5,4329,1,0,0,0,1,
+4339,6,10,2434,2335,3625,0,0,1,
+4349,1,4347,1,
+4349,2,2,4345,1,
+4349,3,4347,2,0,1,
+4349,4,2,2432,6,0,1,
+4349,5,4347,8,0,0,0,1,
+4349,6,2,4221,3320,4068,2,0,1,
+4357,1,4355,1,
+4357,2,2,4356,1,
+4357,3,4355,2,0,1,
+4357,4,2,3793,6,0,1,
+4357,5,4355,6,0,0,0,1,
+4357,6,2,2229,1623,3187,0,0,1,
+4363,1,4361,1,
+4363,2,2,4359,1,
+4363,3,4361,6,0,1,
+4363,4,2,4144,8,0,1,
+4363,5,4361,14,0,0,0,1,
+4363,6,2,4351,4345,4359,0,0,1,
+4373,1,4371,1,
+4373,2,2,4367,1,
+4373,3,4371,2,0,1,
+4373,4,2,2568,1,0,1,
+4373,5,4371,7,0,0,0,1,
+4373,6,2,3528,4263,3992,4,0,1,
+4391,1,4377,1,
+4391,2,14,4388,1,
+4391,3,4377,1,0,1,
+4391,4,14,2791,4,0,1,
+4391,5,4377,2,0,0,0,1,
+4391,6,14,3177,2954,3175,1,0,1,
+4397,1,4395,1,
+4397,2,2,4393,1,
+4397,3,4395,3,0,1,
+4397,4,2,2377,6,0,1,
+4397,5,4395,5,0,0,0,1,
+4397,6,2,1409,3598,4101,1,0,1,
+4409,1,4406,1,
+4409,2,3,4403,1,
+4409,3,4406,3,0,1,
+4409,4,3,4397,0,0,1,
+4409,5,4406,11,0,0,0,1,
+4409,6,3,2342,2421,2996,2,0,1,
+4421,1,4418,1,
+4421,2,3,4420,1,
+4421,3,4418,6,0,1,
+4421,4,3,3830,3,0,1,
+4421,5,4418,18,0,0,0,1,
+4421,6,3,1494,1122,4112,2,0,1,
+4423,1,4420,1,
+4423,2,3,4417,1,
+4423,3,4420,3,0,1,
+4423,4,3,4411,0,0,1,
+4423,5,4420,3,0,0,0,1,
+4423,6,3,3440,4067,3428,0,0,1,
+4441,1,4420,1,
+4441,2,21,4440,1,
+4441,3,4420,2,0,1,
+4441,4,21,4142,8,0,1,
+4441,5,4420,5,0,0,0,1,
+4441,6,21,3103,3247,629,1,0,1,
+4447,1,4444,1,
+4447,2,3,4445,1,
+4447,3,4444,1,0,1,
+4447,4,3,2739,6,0,1,
+4447,5,4444,3,0,0,0,1,
+4447,6,3,775,3099,2489,0,0,1,
+4451,1,4449,1,
+4451,2,2,4447,1,
+4451,3,4449,3,0,1,
+4451,4,2,3166,16,0,1,
+4451,5,4449,3,0,0,0,1,
+4451,6,2,256,3346,1419,1,0,1,
+4457,1,4454,1,
+4457,2,3,4452,1,
+4457,3,4454,3,0,1,
+4457,4,3,4268,0,0,1,
+4457,5,4454,1,0,0,0,1,
+4457,6,3,2943,3671,2423,1,0,1,
+4463,1,4458,1,
+4463,2,5,4460,1,
+4463,3,4458,1,0,1,
+4463,4,5,2602,6,0,1,
+4463,5,4458,2,0,0,0,1,
+4463,6,5,280,3180,1205,2,0,1,
+4481,1,4478,1,
+4481,2,3,4468,1,
+4481,3,4478,4,0,1,
+4481,4,3,3892,1,0,1,
+4481,5,4478,1,0,0,0,1,
+4481,6,3,4213,3703,3999,1,0,1,
+4483,1,4481,1,
+4483,2,2,4482,1,
+4483,3,4481,2,0,1,
+4483,4,2,4367,2,0,1,
+4483,5,4481,6,0,0,0,1,
+4483,6,2,2616,1198,695,0,0,1,
+4493,1,4491,1,
+4493,2,2,4489,1,
+4493,3,4491,2,0,1,
+4493,4,2,4132,1,0,1,
+4493,5,4491,2,0,0,0,1,
+4493,6,2,3144,2017,1085,1,0,1,
+4507,1,4505,1,
+4507,2,2,4503,1,
+4507,3,4505,6,0,1,
+4507,4,2,2907,1,0,1,
+4507,5,4505,11,0,0,0,1,
+4507,6,2,4495,4489,4503,0,0,1,
+4513,1,4506,1,
+4513,2,7,4510,1,
+4513,3,4506,1,0,1,
+4513,4,7,2378,8,0,1,
+4513,5,4506,2,0,0,0,1,
+4513,6,7,3674,235,3867,0,0,1,
+4517,1,4515,1,
+4517,2,2,4512,1,
+4517,3,4515,11,0,1,
+4517,4,2,4284,0,0,1,
+4517,5,4515,3,0,0,0,1,
+4517,6,2,1108,3536,3489,2,0,1,
+4519,1,4516,1,
+4519,2,3,4517,1,
+4519,3,4516,6,0,1,
+4519,4,3,4515,4,0,1,
+4519,5,4516,1,0,0,0,1,
+4519,6,3,2478,149,3566,2,0,1,
+4523,1,4518,1,
+4523,2,5,4520,1,
+4523,3,4518,2,0,1,
+4523,4,5,3148,4,0,1,
+4523,5,4518,11,0,0,0,1,
+4523,6,5,1902,3411,3259,2,0,1,
+4547,1,4545,1,
+4547,2,2,4541,1,
+4547,3,4545,4,0,1,
+4547,4,2,4148,4,0,1,
+4547,5,4545,2,0,0,0,1,
+4547,6,2,1387,3790,2417,2,0,1,
+4549,1,4543,1,
+4549,2,6,4545,1,
+4549,3,4543,2,0,1,
+4549,4,6,4058,2,0,1,
+4549,5,4543,3,0,0,0,1,
+4549,6,6,46,4336,886,0,0,1,
+4561,1,4550,1,
+4561,2,11,4560,1,
+4561,3,4550,2,0,1,
+4561,4,11,4381,12,0,1,
+4561,5,4550,9,0,0,0,1,
+4561,6,11,1145,3578,2777,0,0,1,
+4567,1,4564,1,
+4567,2,3,4566,1,
+4567,3,4564,1,0,1,
+4567,4,3,2779,5,0,1,
+4567,5,4564,13,0,0,0,1,
+4567,6,3,3246,976,4123,3,0,1,
+4583,1,4578,1,
+4583,2,5,4581,1,
+4583,3,4578,2,0,1,
+4583,4,5,4571,11,0,1,
+4583,5,4578,1,0,0,0,1,
+4583,6,5,53,4496,4242,1,0,1,
+4591,1,4580,1,
+4591,2,11,4590,1,
+4591,3,4580,2,0,1,
+4591,4,11,2962,2,0,1,
+4591,5,4580,6,0,0,0,1,
+4591,6,11,957,2109,2806,0,0,1,
+4597,1,4592,1,
+4597,2,5,4596,1,
+4597,3,4592,1,0,1,
+4597,4,5,4179,3,0,1,
+4597,5,4592,6,0,0,0,1,
+4597,6,5,2664,3847,2401,0,0,1,
+4603,1,4601,1,
+4603,2,2,4599,1,
+4603,3,4601,6,0,1,
+4603,4,2,4153,8,0,1,
+4603,5,4601,3,0,0,0,1,
+4603,6,2,4591,4585,4599,0,0,1,
+4621,1,4619,1,
+4621,2,2,4617,1,
+4621,3,4619,2,0,1,
+4621,4,2,4013,6,0,1,
+4621,5,4619,7,0,0,0,1,
+4621,6,2,1100,2174,879,0,0,1,
+4637,1,4635,1,
+4637,2,2,4631,1,
+4637,3,4635,9,0,1,
+4637,4,2,2395,4,0,1,
+4637,5,4635,2,0,0,0,1,
+4637,6,2,305,4319,808,1,0,1,
+4639,1,4636,1,
+4639,2,3,4637,1,
+4639,3,4636,1,0,1,
+4639,4,3,3896,3,0,1,
+4639,5,4636,19,0,0,0,1,
+4639,6,3,1317,1809,1606,0,0,1,
+4643,1,4638,1,
+4643,2,5,4634,1,
+4643,3,4638,3,0,1,
+4643,4,5,2546,1,0,1,
+4643,5,4638,11,0,0,0,1,
+4643,6,5,3845,2560,4022,1,0,1,
+4649,1,4646,1,
+4649,2,3,4648,1,
+4649,3,4646,1,0,1,
+4649,4,3,4013,4,0,1,
+4649,5,4646,8,0,0,0,1,
+4649,6,3,2396,3040,479,2,0,1,
+4651,1,4648,1,
+4651,2,3,4642,1,
+4651,3,4648,6,0,1,
+4651,4,3,3318,6,0,1,
+4651,5,4648,8,0,0,0,1,
+4651,6,3,843,1576,4195,0,0,1,
+4657,1,4642,1,
+4657,2,15,4652,1,
+4657,3,4642,6,0,1,
+4657,4,15,3692,0,0,1,
+4657,5,4642,24,0,0,0,1,
+4657,6,15,2713,2474,4346,0,0,1,
+4663,1,4660,1,
+4663,2,3,4662,1,
+4663,3,4660,3,0,1,
+4663,4,3,3855,5,0,1,
+4663,5,4660,13,0,0,0,1,
+4663,6,3,4017,2517,4263,0,0,1,
+4673,1,4670,1,
+4673,2,3,4668,1,
+4673,3,4670,1,0,1,
+4673,4,3,2460,0,0,1,
+4673,5,4670,15,0,0,0,1,
+4673,6,3,865,3238,160,4,0,1,
+4679,1,4668,1,
+4679,2,11,4677,1,
+4679,3,4668,2,0,1,
+4679,4,11,4414,3,0,1,
+4679,5,4668,2,0,0,0,1,
+4679,6,11,184,2733,3552,1,0,1,
+4691,1,4689,1,
+4691,2,2,4684,1,
+4691,3,4689,2,0,1,
+4691,4,2,4509,0,0,1,
+4691,5,4689,9,0,0,0,1,
+4691,6,2,4288,4489,3051,1,0,1,
+4703,1,4698,1,
+4703,2,5,4702,1,
+4703,3,4698,5,0,1,
+4703,4,5,3012,4,0,1,
+4703,5,4698,1,0,0,0,1,
+4703,6,5,3972,487,3929,3,0,1,
+4721,1,4715,1,
+4721,2,6,4718,1,
+4721,3,4715,7,0,1,
+4721,4,6,4464,0,0,1,
+4721,5,4715,2,0,0,0,1,
+4721,6,6,693,182,858,1,0,1,
+4723,1,4721,1,
+4723,2,2,4722,1,
+4723,3,4721,2,0,1,
+4723,4,2,4408,7,0,1,
+4723,5,4721,5,0,0,0,1,
+4723,6,2,4018,2920,2673,2,0,1,
+4729,1,4712,1,
+4729,2,17,4718,1,
+4729,3,4712,1,0,1,
+4729,4,17,4536,22,0,1,
+4729,5,4712,4,0,0,0,1,
+4729,6,17,2614,4300,4551,0,0,1,
+4733,1,4728,1,
+4733,2,5,4721,1,
+4733,3,4728,7,0,1,
+4733,4,5,3462,0,0,1,
+4733,5,4728,10,0,0,0,1,
+4733,6,5,1,969,4094,5,0,1,
+4751,1,4732,1,
+4751,2,19,4747,1,
+4751,3,4732,4,0,1,
+4751,4,19,3565,9,0,1,
+4751,5,4732,1,0,0,0,1,
+4751,6,19,4544,1906,704,1,0,1,
+4759,1,4756,1,
+4759,2,3,4753,1,
+4759,3,4756,1,0,1,
+4759,4,3,2513,7,0,1,
+4759,5,4756,5,0,0,0,1,
+4759,6,3,3147,1700,1939,0,0,1,
+4783,1,4777,1,
+4783,2,6,4782,1,
+4783,3,4777,8,0,1,
+4783,4,6,4466,3,0,1,
+4783,5,4777,11,0,0,0,1,
+4783,6,6,4214,3223,2342,0,0,1,
+4787,1,4785,1,
+4787,2,2,4783,1,
+4787,3,4785,2,0,1,
+4787,4,2,3115,7,0,1,
+4787,5,4785,8,0,0,0,1,
+4787,6,2,4307,4559,3742,2,0,1,
+4789,1,4787,1,
+4789,2,2,4784,1,
+4789,3,4787,2,0,1,
+4789,4,2,3684,15,0,1,
+4789,5,4787,3,0,0,0,1,
+4789,6,2,1158,1476,1036,0,0,1,
+4793,1,4790,1,
+4793,2,3,4792,1,
+4793,3,4790,16,0,1,
+4793,4,3,2583,4,0,1,
+4793,5,4790,1,0,0,0,1,
+4793,6,3,4483,930,3,2,0,1,
+4799,1,4792,1,
+4799,2,7,4798,1,
+4799,3,4792,8,0,1,
+4799,4,7,4439,2,0,1,
+4799,5,4792,1,0,0,0,1,
+4799,6,7,4125,600,2053,1,0,1,
+4801,1,4794,1,
+4801,2,7,4798,1,
+4801,3,4794,1,0,1,
+4801,4,7,2998,31,0,1,
+4801,5,4794,1,0,0,0,1,
+4801,6,7,3631,2238,4495,0,0,1,
+4813,1,4811,1,
+4813,2,2,4809,1,
+4813,3,4811,4,0,1,
+4813,4,2,4308,12,0,1,
+4813,5,4811,4,0,0,0,1,
+4813,6,2,1051,1931,2681,0,0,1,
+4817,1,4814,1,
+4817,2,3,4816,1,
+4817,3,4814,1,0,1,
+4817,4,3,3744,7,0,1,
+4817,5,4814,3,0,0,0,1,
+4817,6,3,4496,2100,3364,1,0,1,
+4831,1,4828,1,
+4831,2,3,4830,1,
+4831,3,4828,5,0,1,
+4831,4,3,2775,2,0,1,
+4831,5,4828,3,0,0,0,1,
+4831,6,3,1713,4453,2779,0,0,1,
+4861,1,4850,1,
+4861,2,11,4859,1,
+4861,3,4850,5,0,1,
+4861,4,11,3500,9,0,1,
+4861,5,4850,4,0,0,0,1,
+4861,6,11,2959,2621,2014,0,0,1,
+4871,1,4860,1,
+4871,2,11,4870,1,
+4871,3,4860,7,0,1,
+4871,4,11,3209,10,0,1,
+4871,5,4860,1,0,0,0,1,
+4871,6,11,812,73,4465,2,0,1,
+4877,1,4875,1,
+4877,2,2,4876,1,
+4877,3,4875,3,0,1,
+4877,4,2,4589,6,0,1,
+4877,5,4875,2,0,0,0,1,
+4877,6,2,3454,4507,1653,2,0,1,
+4889,1,4886,1,
+4889,2,3,4883,1,
+4889,3,4886,1,0,1,
+4889,4,3,4877,0,0,1,
+4889,5,4886,7,0,0,0,1,
+4889,6,3,1718,2917,4840,2,0,1,
+4903,1,4900,1,
+4903,2,3,4902,1,
+4903,3,4900,4,0,1,
+4903,4,3,2979,2,0,1,
+4903,5,4900,8,0,0,0,1,
+4903,6,3,1702,1305,1797,0,0,1,
+4909,1,4903,1,
+4909,2,6,4908,1,
+4909,3,4903,6,0,1,
+4909,4,6,3865,7,0,1,
+4909,5,4903,6,0,0,0,1,
+4909,6,6,2599,3481,4769,0,0,1,
+4919,1,4906,1,
+4919,2,13,4915,1,
+4919,3,4906,1,0,1,
+4919,4,13,4686,9,0,1,
+4919,5,4906,6,0,0,0,1,
+4919,6,13,2943,4045,3643,2,0,1,
+4931,1,4925,1,
+4931,2,6,4928,1,
+4931,3,4925,3,0,1,
+4931,4,6,3112,7,0,1,
+4931,5,4925,7,0,0,0,1,
+4931,6,6,1657,4017,1703,1,0,1,
+4933,1,4931,1,
+4933,2,2,4932,1,
+4933,3,4931,2,0,1,
+4933,4,2,4500,6,0,1,
+4933,5,4931,2,0,0,0,1,
+4933,6,2,129,4255,3313,0,0,1,
+4937,1,4934,1,
+4937,2,3,4926,1,
+4937,3,4934,1,0,1,
+4937,4,3,4763,5,0,1,
+4937,5,4934,7,0,0,0,1,
+4937,6,3,3800,3340,3079,6,0,1,
+4943,1,4936,1,
+4943,2,7,4940,1,
+4943,3,4936,2,0,1,
+4943,4,7,4276,4,0,1,
+4943,5,4936,1,0,0,0,1,
+4943,6,7,4160,1268,4619,1,0,1,
+4951,1,4945,1,
+4951,2,6,4949,1,
+4951,3,4945,1,0,1,
+4951,4,6,3348,4,0,1,
+4951,5,4945,4,0,0,0,1,
+4951,6,6,3464,4044,4102,0,0,1,
+4957,1,4955,1,
+4957,2,2,4953,1,
+4957,3,4955,6,0,1,
+4957,4,2,3521,6,0,1,
+4957,5,4955,3,0,0,0,1,
+4957,6,2,4945,4939,4953,0,0,1,
+4967,1,4962,1,
+4967,2,5,4966,1,
+4967,3,4962,3,0,1,
+4967,4,5,3184,12,0,1,
+4967,5,4962,1,0,0,0,1,
+4967,6,5,950,3727,466,3,0,1,
+4969,1,4958,1,
+4969,2,11,4966,1,
+4969,3,4958,1,0,1,
+4969,4,11,4047,14,0,1,
+4969,5,4958,3,0,0,0,1,
+4969,6,11,639,155,4528,0,0,1,
+4973,1,4971,1,
+4973,2,2,4972,1,
+4973,3,4971,2,0,1,
+4973,4,2,2632,6,0,1,
+4973,5,4971,11,0,0,0,1,
+4973,6,2,4155,4621,2573,3,0,1,
+4987,1,4985,1,
+4987,2,2,4986,1,
+4987,3,4985,2,0,1,
+4987,4,2,4814,2,0,1,
+4987,5,4985,5,0,0,0,1,
+4987,6,2,3525,4440,4786,0,0,1,
+4993,1,4988,1,
+4993,2,5,4992,1,
+4993,3,4988,3,0,1,
+4993,4,5,4297,6,0,1,
+4993,5,4988,2,0,0,0,1,
+4993,6,5,1106,3867,2646,2,0,1,
+4999,1,4996,1,
+4999,2,3,4997,1,
+4999,3,4996,1,0,1,
+4999,4,3,4799,3,0,1,
+4999,5,4996,26,0,0,0,1,
+4999,6,3,2779,360,4996,0,0,1,
+5003,1,5001,1,
+5003,2,2,4999,1,
+5003,3,5001,2,0,1,
+5003,4,2,4493,11,0,1,
+5003,5,5001,6,0,0,0,1,
+5003,6,2,4980,1719,2697,1,0,1,
+5009,1,5006,1,
+5009,2,3,5003,1,
+5009,3,5006,6,0,1,
+5009,4,3,4997,0,0,1,
+5009,5,5006,7,0,0,0,1,
+5009,6,3,2797,3783,4178,2,0,1,
+5011,1,5009,1,
+5011,2,2,5010,1,
+5011,3,5009,4,0,1,
+5011,4,2,4242,10,0,1,
+5011,5,5009,3,0,0,0,1,
+5011,6,2,4952,3074,3137,0,0,1,
+5021,1,5018,1,
+5021,2,3,5000,1,
+5021,3,5018,1,0,1,
+5021,4,3,3369,3,0,1,
+5021,5,5018,4,0,0,0,1,
+5021,6,3,536,4470,3582,1,0,1,
+5023,1,5020,1,
+5023,2,3,5022,1,
+5023,3,5020,4,0,1,
+5023,4,3,2666,2,0,1,
+5023,5,5020,1,0,0,0,1,
+5023,6,3,4661,406,4842,0,0,1,
+5039,1,5028,1,
+5039,2,11,5035,1,
+5039,3,5028,1,0,1,
+5039,4,11,2763,7,0,1,
+5039,5,5028,2,0,0,0,1,
+5039,6,11,1402,3485,389,1,0,1,
+5051,1,5049,1,
+5051,2,2,5047,1,
+5051,3,5049,2,0,1,
+5051,4,2,3758,8,0,1,
+5051,5,5049,7,0,0,0,1,
+5051,6,2,2908,2629,3492,2,0,1,
+5059,1,5057,1,
+5059,2,2,5055,1,
+5059,3,5057,6,0,1,
+5059,4,2,3985,1,0,1,
+5059,5,5057,2,0,0,0,1,
+5059,6,2,5047,5041,5055,0,0,1,
+5077,1,5075,1,
+5077,2,2,5073,1,
+5077,3,5075,6,0,1,
+5077,4,2,3432,6,0,1,
+5077,5,5075,3,0,0,0,1,
+5077,6,2,5065,5059,5073,0,0,1,
+5081,1,5078,1,
+5081,2,3,5070,1,
+5081,3,5078,1,0,1,
+5081,4,3,3582,0,0,1,
+5081,5,5078,5,0,0,0,1,
+5081,6,3,1571,2217,3364,3,0,1,
+5087,1,5082,1,
+5087,2,5,5086,1,
+5087,3,5082,19,0,1,
+5087,4,5,3574,2,0,1,
+5087,5,5082,5,0,0,0,1,
+5087,6,5,1424,3477,3422,1,0,1,
+5099,1,5097,1,
+5099,2,2,5098,1,
+5099,3,5097,3,0,1,
+5099,4,2,5092,8,0,1,
+5099,5,5097,4,0,0,0,1,
+5099,6,2,4903,38,759,1,0,1,
+5101,1,5095,1,
+5101,2,6,5097,1,
+5101,3,5095,2,0,1,
+5101,4,6,5097,6,0,1,
+5101,5,5095,4,0,0,0,1,
+5101,6,6,3421,4320,4789,0,0,1,
+5107,1,5105,1,
+5107,2,2,5103,1,
+5107,3,5105,5,0,1,
+5107,4,2,4396,13,0,1,
+5107,5,5105,5,0,0,0,1,
+5107,6,2,2785,1583,3796,0,0,1,
+5113,1,5094,1,
+5113,2,19,5109,1,
+5113,3,5094,11,0,1,
+5113,4,19,3501,23,0,1,
+5113,5,5094,5,0,0,0,1,
+5113,6,19,1417,4051,4963,2,0,1,
+5119,1,5116,1,
+5119,2,3,5117,1,
+5119,3,5116,3,0,1,
+5119,4,3,4529,3,0,1,
+5119,5,5116,4,0,0,0,1,
+5119,6,3,4512,2247,5016,0,0,1,
+5147,1,5145,1,
+5147,2,2,5143,1,
+5147,3,5145,3,0,1,
+5147,4,2,3705,7,0,1,
+5147,5,5145,12,0,0,0,1,
+5147,6,2,890,4432,3125,2,0,1,
+5153,1,5148,1,
+5153,2,5,5148,1,
+5153,3,5148,1,0,1,
+5153,4,5,3288,15,0,1,
+5153,5,5148,9,0,0,0,1,
+5153,6,5,4040,3661,3222,2,0,1,
+5167,1,5161,1,
+5167,2,6,5166,1,
+5167,3,5161,2,0,1,
+5167,4,6,2756,3,0,1,
+5167,5,5161,28,0,0,0,1,
+5167,6,6,2012,4295,4940,0,0,1,
+5171,1,5169,1,
+5171,2,2,5170,1,
+5171,3,5169,3,0,1,
+5171,4,2,4578,4,0,1,
+5171,5,5169,2,0,0,0,1,
+5171,6,2,2532,605,2542,1,0,1,
+5179,1,5177,1,
+5179,2,2,5175,1,
+5179,3,5177,4,0,1,
+5179,4,2,4114,1,0,1,
+5179,5,5177,7,0,0,0,1,
+5179,6,2,3903,3978,4616,1,0,1,
+5189,1,5187,1,
+5189,2,2,5179,1,
+5189,3,5187,2,0,1,
+5189,4,2,3521,0,0,1,
+5189,5,5187,2,0,0,0,1,
+5189,6,2,4015,1142,1147,2,0,1,
+5197,1,5190,1,
+5197,2,7,5195,1,
+5197,3,5190,2,0,1,
+5197,4,7,3172,10,0,1,
+5197,5,5190,1,0,0,0,1,
+5197,6,7,3064,949,3188,0,0,1,
+5209,1,5192,1,
+5209,2,17,5208,1,
+5209,3,5192,2,0,1,
+5209,4,17,3547,23,0,1,
+5209,5,5192,1,0,0,0,1,
+5209,6,17,1317,1227,4296,0,0,1,
+5227,1,5225,1,
+5227,2,2,5226,1,
+5227,3,5225,2,0,1,
+5227,4,2,3673,7,0,1,
+5227,5,5225,18,0,0,0,1,
+5227,6,2,1338,3492,1839,0,0,1,
+5231,1,5224,1,
+5231,2,7,5230,1,
+5231,3,5224,1,0,1,
+5231,4,7,2945,2,0,1,
+5231,5,5224,4,0,0,0,1,
+5231,6,7,2064,124,829,3,0,1,
+5233,1,5223,1,
+5233,2,10,5232,1,
+5233,3,5223,12,0,1,
+5233,4,10,4917,12,0,1,
+5233,5,5223,13,0,0,0,1,
+5233,6,10,5172,4218,4161,0,0,1,
+5237,1,5234,1,
+5237,2,3,5235,1,
+5237,3,5234,1,0,1,
+5237,4,3,4976,7,0,1,
+5237,5,5234,15,0,0,0,1,
+5237,6,3,1244,3085,651,5,0,1,
+5261,1,5259,1,
+5261,2,2,5257,1,
+5261,3,5259,2,0,1,
+5261,4,2,3906,12,0,1,
+5261,5,5259,5,0,0,0,1,
+5261,6,2,237,2891,1780,1,0,1,
+5273,1,5270,1,
+5273,2,3,5268,1,
+5273,3,5270,1,0,1,
+5273,4,3,3736,0,0,1,
+5273,5,5270,3,0,0,0,1,
+5273,6,3,2525,568,4238,1,0,1,
+5279,1,5272,1,
+5279,2,7,5275,1,
+5279,3,5272,3,0,1,
+5279,4,7,3255,10,0,1,
+5279,5,5272,2,0,0,0,1,
+5279,6,7,812,3859,3442,1,0,1,
+5281,1,5274,1,
+5281,2,7,5278,1,
+5281,3,5274,1,0,1,
+5281,4,7,4529,26,0,1,
+5281,5,5274,3,0,0,0,1,
+5281,6,7,1574,4991,4876,0,0,1,
+5297,1,5294,1,
+5297,2,3,5296,1,
+5297,3,5294,3,0,1,
+5297,4,3,2780,8,0,1,
+5297,5,5294,1,0,0,0,1,
+5297,6,3,4813,693,1723,2,0,1,
+5303,1,5298,1,
+5303,2,5,5298,1,
+5303,3,5298,8,0,1,
+5303,4,5,4664,7,0,1,
+5303,5,5298,14,0,0,0,1,
+5303,6,5,2210,3779,1797,3,0,1,
+5309,1,5307,1,
+5309,2,2,5305,1,
+5309,3,5307,3,0,1,
+5309,4,2,3402,6,0,1,
+5309,5,5307,9,0,0,0,1,
+5309,6,2,1374,1244,3426,3,0,1,
+5323,1,5318,1,
+5323,2,5,5322,1,
+5323,3,5318,3,0,1,
+5323,4,5,4544,2,0,1,
+5323,5,5318,2,0,0,0,1,
+5323,6,5,4678,449,4833,0,0,1,
+5333,1,5331,1,
+5333,2,2,5332,1,
+5333,3,5331,2,0,1,
+5333,4,2,3011,4,0,1,
+5333,5,5331,7,0,0,0,1,
+5333,6,2,4173,4880,4665,1,0,1,
+5347,1,5344,1,
+5347,2,3,5340,1,
+5347,3,5344,3,0,1,
+5347,4,3,4300,5,0,1,
+5347,5,5344,1,0,0,0,1,
+5347,6,3,3872,3767,4767,0,0,1,
+5351,1,5340,1,
+5351,2,11,5349,1,
+5351,3,5340,2,0,1,
+5351,4,11,2904,3,0,1,
+5351,5,5340,3,0,0,0,1,
+5351,6,11,2813,3018,1365,1,0,1,
+5381,1,5378,1,
+5381,2,3,5379,1,
+5381,3,5378,1,0,1,
+5381,4,3,5373,10,0,1,
+5381,5,5378,4,0,0,0,1,
+5381,6,3,591,3442,2419,2,0,1,
+5387,1,5385,1,
+5387,2,2,5381,1,
+5387,3,5385,5,0,1,
+5387,4,2,5179,0,0,1,
+5387,5,5385,2,0,0,0,1,
+5387,6,2,294,2140,4831,1,0,1,
+5393,1,5390,1,
+5393,2,3,5388,1,
+5393,3,5390,5,0,1,
+5393,4,3,2779,0,0,1,
+5393,5,5390,9,0,0,0,1,
+5393,6,3,3959,3645,1417,2,0,1,
+5399,1,5392,1,
+5399,2,7,5398,1,
+5399,3,5392,2,0,1,
+5399,4,7,4859,3,0,1,
+5399,5,5392,5,0,0,0,1,
+5399,6,7,2407,4443,3793,1,0,1,
+5407,1,5404,1,
+5407,2,3,5406,1,
+5407,3,5404,1,0,1,
+5407,4,3,2801,5,0,1,
+5407,5,5404,5,0,0,0,1,
+5407,6,3,5256,3948,4841,0,0,1,
+5413,1,5408,1,
+5413,2,5,5408,1,
+5413,3,5408,5,0,1,
+5413,4,5,3179,11,0,1,
+5413,5,5408,5,0,0,0,1,
+5413,6,5,648,4784,5019,0,0,1,
+5417,1,5414,1,
+5417,2,3,5411,1,
+5417,3,5414,4,0,1,
+5417,4,3,3351,16,0,1,
+5417,5,5414,4,0,0,0,1,
+5417,6,3,5229,2844,2225,2,0,1,
+5419,1,5416,1,
+5419,2,3,5414,1,
+5419,3,5416,5,0,1,
+5419,4,3,4003,3,0,1,
+5419,5,5416,4,0,0,0,1,
+5419,6,3,3470,5375,4215,2,0,1,
+5431,1,5428,1,
+5431,2,3,5430,1,
+5431,3,5428,3,0,1,
+5431,4,3,4493,3,0,1,
+5431,5,5428,1,0,0,0,1,
+5431,6,3,5406,3798,5206,0,0,1,
+5437,1,5432,1,
+5437,2,5,5436,1,
+5437,3,5432,1,0,1,
+5437,4,5,3703,6,0,1,
+5437,5,5432,10,0,0,0,1,
+5437,6,5,16,180,4983,0,0,1,
+5441,1,5438,1,
+5441,2,3,5435,1,
+5441,3,5438,4,0,1,
+5441,4,3,5429,0,0,1,
+5441,5,5438,5,0,0,0,1,
+5441,6,3,2825,1966,2329,1,0,1,
+5443,1,5441,1,
+5443,2,2,5439,1,
+5443,3,5441,6,0,1,
+5443,4,2,3215,8,0,1,
+5443,5,5441,13,0,0,0,1,
+5443,6,2,5431,5425,5439,0,0,1,
+5449,1,5442,1,
+5449,2,7,5446,1,
+5449,3,5442,3,0,1,
+5449,4,7,5215,17,0,1,
+5449,5,5442,1,0,0,0,1,
+5449,6,7,3651,1577,918,0,0,1,
+5471,1,5464,1,
+5471,2,7,5470,1,
+5471,3,5464,1,0,1,
+5471,4,7,4654,2,0,1,
+5471,5,5464,3,0,0,0,1,
+5471,6,7,1611,5284,4877,1,0,1,
+5477,1,5475,1,
+5477,2,2,5476,1,
+5477,3,5475,9,0,1,
+5477,4,2,4592,3,0,1,
+5477,5,5475,5,0,0,0,1,
+5477,6,2,1630,2737,726,3,0,1,
+5479,1,5476,1,
+5479,2,3,5477,1,
+5479,3,5476,4,0,1,
+5479,4,3,5475,4,0,1,
+5479,5,5476,1,0,0,0,1,
+5479,6,3,4310,4043,3121,0,0,1,
+5483,1,5481,1,
+5483,2,2,5479,1,
+5483,3,5481,3,0,1,
+5483,4,2,4428,7,0,1,
+5483,5,5481,3,0,0,0,1,
+5483,6,2,15,761,4423,1,0,1,
+5501,1,5499,1,
+5501,2,2,5500,1,
+5501,3,5499,3,0,1,
+5501,4,2,5494,8,0,1,
+5501,5,5499,9,0,0,0,1,
+5501,6,2,3141,1376,2152,2,0,1,
+5503,1,5500,1,
+5503,2,3,5501,1,
+5503,3,5500,3,0,1,
+5503,4,3,4553,3,0,1,
+5503,5,5500,9,0,0,0,1,
+5503,6,3,807,3098,4862,1,0,1,
+5507,1,5505,1,
+5507,2,2,5506,1,
+5507,3,5505,3,0,1,
+5507,4,2,4674,2,0,1,
+5507,5,5505,7,0,0,0,1,
+5507,6,2,4320,3265,1486,1,0,1,
+5519,1,5506,1,
+5519,2,13,5517,1,
+5519,3,5506,3,0,1,
+5519,4,13,4514,3,0,1,
+5519,5,5506,8,0,0,0,1,
+5519,6,13,1728,77,3957,2,0,1,
+5521,1,5510,1,
+5521,2,11,5518,1,
+5521,3,5510,1,0,1,
+5521,4,11,5107,10,0,1,
+5521,5,5510,2,0,0,0,1,
+5521,6,11,1127,3611,4199,0,0,1,
+5527,1,5522,1,
+5527,2,5,5525,1,
+5527,3,5522,5,0,1,
+5527,4,5,3244,10,0,1,
+5527,5,5522,2,0,0,0,1,
+5527,6,5,1602,4694,291,3,0,1,
+5531,1,5521,1,
+5531,2,10,5523,1,
+5531,3,5521,5,0,1,
+5531,4,10,5284,1,0,1,
+5531,5,5521,13,0,0,0,1,
+5531,6,10,3780,522,2818,1,0,1,
+5557,1,5555,1,
+5557,2,2,5556,1,
+5557,3,5555,4,0,1,
+5557,4,2,5232,7,0,1,
+5557,5,5555,2,0,0,0,1,
+5557,6,2,4509,1414,5195,0,0,1,
+5563,1,5561,1,
+5563,2,2,5562,1,
+5563,3,5561,2,0,1,
+5563,4,2,4029,2,0,1,
+5563,5,5561,7,0,0,0,1,
+5563,6,2,824,2629,3660,0,0,1,
+5569,1,5556,1,
+5569,2,13,5568,1,
+5569,3,5556,1,0,1,
+5569,4,13,5005,14,0,1,
+5569,5,5556,3,0,0,0,1,
+5569,6,13,2058,4630,3619,0,0,1,
+5573,1,5571,1,
+5573,2,2,5569,1,
+5573,3,5571,3,0,1,
+5573,4,2,4990,12,0,1,
+5573,5,5571,9,0,0,0,1,
+5573,6,2,458,5276,1540,1,0,1,
+5581,1,5575,1,
+5581,2,6,5580,1,
+5581,3,5575,8,0,1,
+5581,4,6,2877,23,0,1,
+5581,5,5575,7,0,0,0,1,
+5581,6,6,5084,5293,4711,0,0,1,
+5591,1,5580,1,
+5591,2,11,5589,1,
+5591,3,5580,7,0,1,
+5591,4,11,4672,10,0,1,
+5591,5,5580,2,0,0,0,1,
+5591,6,11,1604,4049,1141,1,0,1,
+5623,1,5618,1,
+5623,2,5,5622,1,
+5623,3,5618,1,0,1,
+5623,4,5,4471,5,0,1,
+5623,5,5618,3,0,0,0,1,
+5623,6,5,2026,3434,2370,0,0,1,
+5639,1,5632,1,
+5639,2,7,5632,1,
+5639,3,5632,3,0,1,
+5639,4,7,5533,9,0,1,
+5639,5,5632,4,0,0,0,1,
+5639,6,7,3109,2719,1858,1,0,1,
+5641,1,5627,1,
+5641,2,14,5627,1,
+5641,3,5627,1,0,1,
+5641,4,14,3065,0,0,1,
+5641,5,5627,14,0,0,0,1,
+5641,6,14,2049,1341,2687,0,0,1,
+5647,1,5644,1,
+5647,2,3,5645,1,
+5647,3,5644,7,0,1,
+5647,4,3,5643,4,0,1,
+5647,5,5644,4,0,0,0,1,
+5647,6,3,469,92,4939,0,0,1,
+5651,1,5649,1,
+5651,2,2,5645,1,
+5651,3,5649,2,0,1,
+5651,4,2,5114,0,0,1,
+5651,5,5649,10,0,0,0,1,
+5651,6,2,4954,2981,3352,1,0,1,
+5653,1,5648,1,
+5653,2,5,5652,1,
+5653,3,5648,1,0,1,
+5653,4,5,5415,7,0,1,
+5653,5,5648,1,0,0,0,1,
+5653,6,5,2467,4995,4874,1,0,1,
+5657,1,5654,1,
+5657,2,3,5652,1,
+5657,3,5654,3,0,1,
+5657,4,3,4685,0,0,1,
+5657,5,5654,7,0,0,0,1,
+5657,6,3,2612,4118,5555,1,0,1,
+5659,1,5657,1,
+5659,2,2,5658,1,
+5659,3,5657,6,0,1,
+5659,4,2,3882,2,0,1,
+5659,5,5657,3,0,0,0,1,
+5659,6,2,2138,5546,3119,0,0,1,
+5669,1,5666,1,
+5669,2,3,5657,1,
+5669,3,5666,1,0,1,
+5669,4,3,2924,5,0,1,
+5669,5,5666,6,0,0,0,1,
+5669,6,3,2120,1592,657,1,0,1,
+5683,1,5681,1,
+5683,2,2,5682,1,
+5683,3,5681,4,0,1,
+5683,4,2,4164,10,0,1,
+5683,5,5681,2,0,0,0,1,
+5683,6,2,2285,1361,5120,0,0,1,
+5689,1,5678,1,
+5689,2,11,5686,1,
+5689,3,5678,2,0,1,
+5689,4,11,4145,10,0,1,
+5689,5,5678,8,0,0,0,1,
+5689,6,11,2179,909,5572,0,0,1,
+5693,1,5691,1,
+5693,2,2,5689,1,
+5693,3,5691,3,0,1,
+5693,4,2,4512,7,0,1,
+5693,5,5691,2,0,0,0,1,
+5693,6,2,4455,2355,3472,2,0,1,
+5701,1,5699,1,
+5701,2,2,5700,1,
+5701,3,5699,6,0,1,
+5701,4,2,4705,7,0,1,
+5701,5,5699,10,0,0,0,1,
+5701,6,2,1099,3264,3092,0,0,1,
+5711,1,5692,1,
+5711,2,19,5710,1,
+5711,3,5692,1,0,1,
+5711,4,19,3629,2,0,1,
+5711,5,5692,3,0,0,0,1,
+5711,6,19,5210,5696,2375,1,0,1,
+5717,1,5715,1,
+5717,2,2,5716,1,
+5717,3,5715,2,0,1,
+5717,4,2,4875,9,0,1,
+5717,5,5715,3,0,0,0,1,
+5717,6,2,5001,2337,4666,7,0,1,
+5737,1,5732,1,
+5737,2,5,5736,1,
+5737,3,5732,2,0,1,
+5737,4,5,3985,12,0,1,
+5737,5,5732,2,0,0,0,1,
+5737,6,5,5307,2532,5344,0,0,1,
+5741,1,5739,1,
+5741,2,2,5736,1,
+5741,3,5739,2,0,1,
+5741,4,2,4555,2,0,1,
+5741,5,5739,6,0,0,0,1,
+5741,6,2,1063,5658,2348,2,0,1,
+5743,1,5733,1,
+5743,2,10,5741,1,
+5743,3,5733,6,0,1,
+5743,4,10,4715,4,0,1,
+5743,5,5733,14,0,0,0,1,
+5743,6,10,169,4833,5621,0,0,1,
+5749,1,5747,1,
+5749,2,2,5745,1,
+5749,3,5747,4,0,1,
+5749,4,2,3224,6,0,1,
+5749,5,5747,9,0,0,0,1,
+5749,6,2,3786,1618,3265,0,0,1,
+5779,1,5777,1,
+5779,2,2,5775,1,
+5779,3,5777,2,0,1,
+5779,4,2,4989,8,0,1,
+5779,5,5777,5,0,0,0,1,
+5779,6,2,520,936,4860,0,0,1,
+5783,1,5776,1,
+5783,2,7,5779,1,
+5783,3,5776,2,0,1,
+5783,4,7,3417,5,0,1,
+5783,5,5776,7,0,0,0,1,
+5783,6,7,3792,2474,3363,1,0,1,
+5791,1,5785,1,
+5791,2,6,5789,1,
+5791,3,5785,10,0,1,
+5791,4,6,5496,10,0,1,
+5791,5,5785,12,0,0,0,1,
+5791,6,6,5626,3300,3847,0,0,1,
+5801,1,5798,1,
+5801,2,3,5795,1,
+5801,3,5798,5,0,1,
+5801,4,3,5789,0,0,1,
+5801,5,5798,9,0,0,0,1,
+5801,6,3,3402,1709,4616,2,0,1,
+5807,1,5802,1,
+5807,2,5,5806,1,
+5807,3,5802,12,0,1,
+5807,4,5,5319,4,0,1,
+5807,5,5802,2,0,0,0,1,
+5807,6,5,3822,3004,2936,1,0,1,
+5813,1,5811,1,
+5813,2,2,5812,1,
+5813,3,5811,5,0,1,
+5813,4,2,5538,9,0,1,
+5813,5,5811,8,0,0,0,1,
+5813,6,2,3366,3540,2594,1,0,1,
+5821,1,5815,1,
+5821,2,6,5817,1,
+5821,3,5815,2,0,1,
+5821,4,6,4968,2,0,1,
+5821,5,5815,6,0,0,0,1,
+5821,6,6,5593,3825,5161,4,0,1,
+5827,1,5825,1,
+5827,2,2,5826,1,
+5827,3,5825,2,0,1,
+5827,4,2,4800,7,0,1,
+5827,5,5825,3,0,0,0,1,
+5827,6,2,2659,4815,4660,0,0,1,
+5839,1,5833,1,
+5839,2,6,5837,1,
+5839,3,5833,2,0,1,
+5839,4,6,3944,4,0,1,
+5839,5,5833,4,0,0,0,1,
+5839,6,6,1721,5345,2750,0,0,1,
+5843,1,5841,1,
+5843,2,2,5839,1,
+5843,3,5841,3,0,1,
+5843,4,2,5271,7,0,1,
+5843,5,5841,8,0,0,0,1,
+5843,6,2,1733,1896,3818,1,0,1,
+5849,1,5846,1,
+5849,2,3,5848,1,
+5849,3,5846,1,0,1,
+5849,4,3,4466,7,0,1,
+5849,5,5846,9,0,0,0,1,
+5849,6,3,1028,1241,4207,3,0,1,
+5851,1,5849,1,
+5851,2,2,5847,1,
+5851,3,5849,6,0,1,
+5851,4,2,4062,1,0,1,
+5851,5,5849,2,0,0,0,1,
+5851,6,2,5839,5833,5847,0,0,1,
+5857,1,5850,1,
+5857,2,7,5850,1,
+5857,3,5850,9,0,1,
+5857,4,7,5725,14,0,1,
+5857,5,5850,4,0,0,0,1,
+5857,6,7,1880,4090,2563,1,0,1,
+5861,1,5858,1,
+5861,2,3,5859,1,
+5861,3,5858,7,0,1,
+5861,4,3,4246,12,0,1,
+5861,5,5858,8,0,0,0,1,
+5861,6,3,4521,1056,2999,2,0,1,
+5867,1,5862,1,
+5867,2,5,5865,1,
+5867,3,5862,2,0,1,
+5867,4,5,5859,6,0,1,
+5867,5,5862,1,0,0,0,1,
+5867,6,5,4508,3300,3178,1,0,1,
+5869,1,5867,1,
+5869,2,2,5868,1,
+5869,3,5867,4,0,1,
+5869,4,2,3845,3,0,1,
+5869,5,5867,10,0,0,0,1,
+5869,6,2,767,5450,4506,0,0,1,
+5879,1,5868,1,
+5879,2,11,5877,1,
+5879,3,5868,11,0,1,
+5879,4,11,5039,5,0,1,
+5879,5,5868,5,0,0,0,1,
+5879,6,11,5094,4222,4253,2,0,1,
+5881,1,5850,1,
+5881,2,31,5876,1,
+5881,3,5850,5,0,1,
+5881,4,31,5848,16,0,1,
+5881,5,5850,2,0,0,0,1,
+5881,6,31,4546,2592,4096,0,0,1,
+5897,1,5894,1,
+5897,2,3,5892,1,
+5897,3,5894,9,0,1,
+5897,4,3,4016,8,0,1,
+5897,5,5894,3,0,0,0,1,
+5897,6,3,1149,1348,716,1,0,1,
+5903,1,5898,1,
+5903,2,5,5901,1,
+5903,3,5898,2,0,1,
+5903,4,5,5899,3,0,1,
+5903,5,5898,2,0,0,0,1,
+5903,6,5,3098,1573,314,3,0,1,
+5923,1,5921,1,
+5923,2,2,5919,1,
+5923,3,5921,5,0,1,
+5923,4,2,3089,8,0,1,
+5923,5,5921,4,0,0,0,1,
+5923,6,2,4010,5787,3895,0,0,1,
+5927,1,5922,1,
+5927,2,5,5926,1,
+5927,3,5922,2,0,1,
+5927,4,5,3813,3,0,1,
+5927,5,5922,6,0,0,0,1,
+5927,6,5,4057,5756,5257,1,0,1,
+5939,1,5937,1,
+5939,2,2,5935,1,
+5939,3,5937,3,0,1,
+5939,4,2,5109,7,0,1,
+5939,5,5937,2,0,0,0,1,
+5939,6,2,1341,2001,5778,1,0,1,
+5953,1,5946,1,
+5953,2,7,5946,1,
+5953,3,5946,2,0,1,
+5953,4,7,5381,18,0,1,
+5953,5,5946,1,0,0,0,1,
+5953,6,7,834,2240,4791,0,0,1,
+5981,1,5978,1,
+5981,2,3,5980,1,
+5981,3,5978,5,0,1,
+5981,4,3,3130,3,0,1,
+5981,5,5978,5,0,0,0,1,
+5981,6,3,5402,5980,3703,2,0,1,
+5987,1,5985,1,
+5987,2,2,5983,1,
+5987,3,5985,3,0,1,
+5987,4,2,5641,7,0,1,
+5987,5,5985,16,0,0,0,1,
+5987,6,2,3661,3911,205,3,0,1,
+6007,1,6004,1,
+6007,2,3,6005,1,
+6007,3,6004,3,0,1,
+6007,4,3,5427,3,0,1,
+6007,5,6004,9,0,0,0,1,
+6007,6,3,1729,5799,285,0,0,1,
+6011,1,6009,1,
+6011,2,2,6007,1,
+6011,3,6009,3,0,1,
+6011,4,2,3814,7,0,1,
+6011,5,6009,18,0,0,0,1,
+6011,6,2,2903,5566,956,2,0,1,
+6029,1,6027,1,
+6029,2,2,6025,1,
+6029,3,6027,3,0,1,
+6029,4,2,4854,6,0,1,
+6029,5,6027,11,0,0,0,1,
+6029,6,2,3826,933,1263,1,0,1,
+6037,1,6032,1,
+6037,2,5,6036,1,
+6037,3,6032,3,0,1,
+6037,4,5,4169,3,0,1,
+6037,5,6032,2,0,0,0,1,
+6037,6,5,2142,5518,2213,1,0,1,
+6043,1,6038,1,
+6043,2,5,6041,1,
+6043,3,6038,2,0,1,
+6043,4,5,6035,6,0,1,
+6043,5,6038,5,0,0,0,1,
+6043,6,5,2565,3936,3603,1,0,1,
+6047,1,6042,1,
+6047,2,5,6044,1,
+6047,3,6042,8,0,1,
+6047,4,5,4284,4,0,1,
+6047,5,6042,3,0,0,0,1,
+6047,6,5,5019,3051,3663,2,0,1,
+6053,1,6051,1,
+6053,2,2,6052,1,
+6053,3,6051,2,0,1,
+6053,4,2,6046,8,0,1,
+6053,5,6051,3,0,0,0,1,
+6053,6,2,376,426,4554,1,0,1,
+6067,1,6065,1,
+6067,2,2,6066,1,
+6067,3,6065,6,0,1,
+6067,4,2,5710,7,0,1,
+6067,5,6065,2,0,0,0,1,
+6067,6,2,876,3284,3354,0,0,1,
+6073,1,6063,1,
+6073,2,10,6072,1,
+6073,3,6063,4,0,1,
+6073,4,10,3299,16,0,1,
+6073,5,6063,2,0,0,0,1,
+6073,6,10,5420,1253,6051,1,0,1,
+6079,1,6062,1,
+6079,2,17,6077,1,
+6079,3,6062,6,0,1,
+6079,4,17,6071,3,0,1,
+6079,5,6062,1,0,0,0,1,
+6079,6,17,1413,5393,513,0,0,1,
+6089,1,6086,1,
+6089,2,3,6088,1,
+6089,3,6086,3,0,1,
+6089,4,3,4969,7,0,1,
+6089,5,6086,7,0,0,0,1,
+6089,6,3,485,1448,2643,1,0,1,
+6091,1,6084,1,
+6091,2,7,6089,1,
+6091,3,6084,2,0,1,
+6091,4,7,4936,6,0,1,
+6091,5,6084,1,0,0,0,1,
+6091,6,7,2839,484,5594,2,0,1,
+6101,1,6099,1,
+6101,2,2,6097,1,
+6101,3,6099,3,0,1,
+6101,4,2,4125,12,0,1,
+6101,5,6099,3,0,0,0,1,
+6101,6,2,1347,940,4989,1,0,1,
+6113,1,6110,1,
+6113,2,3,6112,1,
+6113,3,6110,5,0,1,
+6113,4,3,4935,4,0,1,
+6113,5,6110,4,0,0,0,1,
+6113,6,3,3957,4751,4691,2,0,1,
+6121,1,6114,1,
+6121,2,7,6118,1,
+6121,3,6114,5,0,1,
+6121,4,7,4176,16,0,1,
+6121,5,6114,1,0,0,0,1,
+6121,6,7,4024,2225,4299,0,0,1,
+6131,1,6129,1,
+6131,2,2,6126,1,
+6131,3,6129,5,0,1,
+6131,4,2,4866,3,0,1,
+6131,5,6129,10,0,0,0,1,
+6131,6,2,840,3151,3592,1,0,1,
+6133,1,6128,1,
+6133,2,5,6132,1,
+6133,3,6128,12,0,1,
+6133,4,5,4719,3,0,1,
+6133,5,6128,3,0,0,0,1,
+6133,6,5,187,5292,2412,0,0,1,
+6143,1,6138,1,
+6143,2,5,6141,1,
+6143,3,6138,6,0,1,
+6143,4,5,5375,8,0,1,
+6143,5,6138,5,0,0,0,1,
+6143,6,5,2112,319,5720,3,0,1,
+6151,1,6148,1,
+6151,2,3,6150,1,
+6151,3,6148,1,0,1,
+6151,4,3,5687,2,0,1,
+6151,5,6148,3,0,0,0,1,
+6151,6,3,1739,781,4259,0,0,1,
+6163,1,6160,1,
+6163,2,3,6154,1,
+6163,3,6160,1,0,1,
+6163,4,3,4191,10,0,1,
+6163,5,6160,11,0,0,0,1,
+6163,6,3,3969,1252,6155,0,0,1,
+6173,1,6171,1,
+6173,2,2,6172,1,
+6173,3,6171,2,0,1,
+6173,4,2,5879,3,0,1,
+6173,5,6171,16,0,0,0,1,
+6173,6,2,1787,5731,2807,2,0,1,
+6197,1,6195,1,
+6197,2,2,6193,1,
+6197,3,6195,3,0,1,
+6197,4,2,4395,7,0,1,
+6197,5,6195,2,0,0,0,1,
+6197,6,2,4487,2745,5836,1,0,1,
+6199,1,6196,1,
+6199,2,3,6197,1,
+6199,3,6196,11,0,1,
+6199,4,3,6195,4,0,1,
+6199,5,6196,12,0,0,0,1,
+6199,6,3,5339,3145,1684,0,0,1,
+6203,1,6201,1,
+6203,2,2,6197,1,
+6203,3,6201,7,0,1,
+6203,4,2,4407,4,0,1,
+6203,5,6201,16,0,0,0,1,
+6203,6,2,3723,3336,317,2,0,1,
+6211,1,6209,1,
+6211,2,2,6207,1,
+6211,3,6209,2,0,1,
+6211,4,2,3831,8,0,1,
+6211,5,6209,6,0,0,0,1,
+6211,6,2,4401,3423,1452,0,0,1,
+6217,1,6212,1,
+6217,2,5,6214,1,
+6217,3,6212,1,0,1,
+6217,4,5,4005,18,0,1,
+6217,5,6212,6,0,0,0,1,
+6217,6,5,4686,324,3426,0,0,1,
+6221,1,6218,1,
+6221,2,3,6220,1,
+6221,3,6218,1,0,1,
+6221,4,3,4737,3,0,1,
+6221,5,6218,5,0,0,0,1,
+6221,6,3,767,4690,2283,4,0,1,
+6229,1,6227,1,
+6229,2,2,6225,1,
+6229,3,6227,6,0,1,
+6229,4,2,5804,6,0,1,
+6229,5,6227,3,0,0,0,1,
+6229,6,2,6217,6211,6225,0,0,1,
+6247,1,6242,1,
+6247,2,5,6246,1,
+6247,3,6242,1,0,1,
+6247,4,5,4249,10,0,1,
+6247,5,6242,2,0,0,0,1,
+6247,6,5,5013,3016,863,0,0,1,
+6257,1,6254,1,
+6257,2,3,6248,1,
+6257,3,6254,1,0,1,
+6257,4,3,5301,3,0,1,
+6257,5,6254,5,0,0,0,1,
+6257,6,3,3820,902,764,1,0,1,
+6263,1,6258,1,
+6263,2,5,6262,1,
+6263,3,6258,1,0,1,
+6263,4,5,3733,7,0,1,
+6263,5,6258,2,0,0,0,1,
+6263,6,5,2635,2176,743,4,0,1,
+6269,1,6267,1,
+6269,2,2,6265,1,
+6269,3,6267,2,0,1,
+6269,4,2,5915,12,0,1,
+6269,5,6267,19,0,0,0,1,
+6269,6,2,4080,614,5113,1,0,1,
+6271,1,6260,1,
+6271,2,11,6267,1,
+6271,3,6260,3,0,1,
+6271,4,11,3429,1,0,1,
+6271,5,6260,3,0,0,0,1,
+6271,6,11,4877,5120,2956,0,0,1,
+6277,1,6275,1,
+6277,2,2,6276,1,
+6277,3,6275,2,0,1,
+6277,4,2,5873,3,0,1,
+6277,5,6275,3,0,0,0,1,
+6277,6,2,2132,1671,4081,0,0,1,
+6287,1,6280,1,
+6287,2,7,6285,1,
+6287,3,6280,2,0,1,
+6287,4,7,5422,5,0,1,
+6287,5,6280,7,0,0,0,1,
+6287,6,7,4689,149,2056,1,0,1,
+6299,1,6297,1,
+6299,2,2,6288,1,
+6299,3,6297,5,0,1,
+6299,4,2,5835,1,0,1,
+6299,5,6297,5,0,0,0,1,
+6299,6,2,5417,5643,2902,1,0,1,
+6301,1,6291,1,
+6301,2,10,6297,1,
+6301,3,6291,6,0,1,
+6301,4,10,3648,12,0,1,
+6301,5,6291,1,0,0,0,1,
+6301,6,10,1594,3503,229,0,0,1,
+6311,1,6304,1,
+6311,2,7,6310,1,
+6311,3,6304,2,0,1,
+6311,4,7,5361,2,0,1,
+6311,5,6304,7,0,0,0,1,
+6311,6,7,3661,4292,3292,1,0,1,
+6317,1,6315,1,
+6317,2,2,6316,1,
+6317,3,6315,2,0,1,
+6317,4,2,5652,6,0,1,
+6317,5,6315,2,0,0,0,1,
+6317,6,2,4441,2796,4421,1,0,1,
+6323,1,6321,1,
+6323,2,2,6311,1,
+6323,3,6321,8,0,1,
+6323,4,2,5598,6,0,1,
+6323,5,6321,2,0,0,0,1,
+6323,6,2,5335,6243,547,1,0,1,
+6329,1,6326,1,
+6329,2,3,6324,1,
+6329,3,6326,1,0,1,
+6329,4,3,6151,2,0,1,
+6329,5,6326,4,0,0,0,1,
+6329,6,3,1099,3130,695,1,0,1,
+6337,1,6327,1,
+6337,2,10,6336,1,
+6337,3,6327,2,0,1,
+6337,4,10,5231,6,0,1,
+6337,5,6327,6,0,0,0,1,
+6337,6,10,6074,4620,4918,0,0,1,
+6343,1,6340,1,
+6343,2,3,6342,1,
+6343,3,6340,1,0,1,
+6343,4,3,3971,14,0,1,
+6343,5,6340,5,0,0,0,1,
+6343,6,3,5827,5075,5042,1,0,1,
+6353,1,6350,1,
+6353,2,3,6352,1,
+6353,3,6350,7,0,1,
+6353,4,3,5517,7,0,1,
+6353,5,6350,1,0,0,0,1,
+6353,6,3,1406,6344,1479,1,0,1,
+6359,1,6346,1,
+6359,2,13,6358,1,
+6359,3,6346,1,0,1,
+6359,4,13,6246,2,0,1,
+6359,5,6346,17,0,0,0,1,
+6359,6,13,852,4721,6094,1,0,1,
+6361,1,6342,1,
+6361,2,19,6358,1,
+6361,3,6342,5,0,1,
+6361,4,19,4383,10,0,1,
+6361,5,6342,13,0,0,0,1,
+6361,6,19,1181,629,5908,0,0,1,
+6367,1,6364,1,
+6367,2,3,6365,1,
+6367,3,6364,3,0,1,
+6367,4,3,5709,3,0,1,
+6367,5,6364,3,0,0,0,1,
+6367,6,3,1894,5862,4612,0,0,1,
+6373,1,6371,1,
+6373,2,2,6372,1,
+6373,3,6371,2,0,1,
+6373,4,2,6366,8,0,1,
+6373,5,6371,3,0,0,0,1,
+6373,6,2,5239,3274,6004,0,0,1,
+6379,1,6377,1,
+6379,2,2,6370,1,
+6379,3,6377,4,0,1,
+6379,4,2,3885,2,0,1,
+6379,5,6377,5,0,0,0,1,
+6379,6,2,5798,2466,757,3,0,1,
+6389,1,6387,1,
+6389,2,2,6388,1,
+6389,3,6387,3,0,1,
+6389,4,2,6382,8,0,1,
+6389,5,6387,2,0,0,0,1,
+6389,6,2,1872,576,4136,4,0,1,
+6397,1,6395,1,
+6397,2,2,6396,1,
+6397,3,6395,2,0,1,
+6397,4,2,6218,9,0,1,
+6397,5,6395,2,0,0,0,1,
+6397,6,2,2137,983,1992,0,0,1,
+6421,1,6415,1,
+6421,2,6,6417,1,
+6421,3,6415,9,0,1,
+6421,4,6,3300,2,0,1,
+6421,5,6415,6,0,0,0,1,
+6421,6,6,1652,805,3697,1,0,1,
+6427,1,6424,1,
+6427,2,3,6422,1,
+6427,3,6424,6,0,1,
+6427,4,3,5590,3,0,1,
+6427,5,6424,9,0,0,0,1,
+6427,6,3,1225,4193,4170,0,0,1,
+6449,1,6446,1,
+6449,2,3,6443,1,
+6449,3,6446,6,0,1,
+6449,4,3,6437,0,0,1,
+6449,5,6446,7,0,0,0,1,
+6449,6,3,3985,2704,1378,4,0,1,
+6451,1,6448,1,
+6451,2,3,6444,1,
+6451,3,6448,3,0,1,
+6451,4,3,5883,5,0,1,
+6451,5,6448,8,0,0,0,1,
+6451,6,3,4522,5757,4142,0,0,1,
+6469,1,6467,1,
+6469,2,2,6465,1,
+6469,3,6467,2,0,1,
+6469,4,2,4409,12,0,1,
+6469,5,6467,7,0,0,0,1,
+6469,6,2,5646,1235,1560,2,0,1,
+6473,1,6470,1,
+6473,2,3,6467,1,
+6473,3,6470,7,0,1,
+6473,4,3,3818,9,0,1,
+6473,5,6470,1,0,0,0,1,
+6473,6,3,524,1141,2150,3,0,1,
+6481,1,6474,1,
+6481,2,7,6478,1,
+6481,3,6474,1,0,1,
+6481,4,7,5873,16,0,1,
+6481,5,6474,8,0,0,0,1,
+6481,6,7,1488,3948,2363,0,0,1,
+6491,1,6489,1,
+6491,2,2,6487,1,
+6491,3,6489,3,0,1,
+6491,4,2,3747,7,0,1,
+6491,5,6489,4,0,0,0,1,
+6491,6,2,5503,6117,837,1,0,1,
+6521,1,6515,1,
+6521,2,6,6515,1,
+6521,3,6515,6,0,1,
+6521,4,6,3760,0,0,1,
+6521,5,6515,6,0,0,0,1,
+6521,6,6,2751,1750,6329,2,0,1,
+6529,1,6522,1,
+6529,2,7,6526,1,
+6529,3,6522,1,0,1,
+6529,4,7,5221,17,0,1,
+6529,5,6522,1,0,0,0,1,
+6529,6,7,2223,2089,1712,0,0,1,
+6547,1,6545,1,
+6547,2,2,6543,1,
+6547,3,6545,6,0,1,
+6547,4,2,3676,8,0,1,
+6547,5,6545,9,0,0,0,1,
+6547,6,2,6535,6529,6543,0,0,1,
+6551,1,6534,1,
+6551,2,17,6550,1,
+6551,3,6534,1,0,1,
+6551,4,17,3541,2,0,1,
+6551,5,6534,11,0,0,0,1,
+6551,6,17,757,3626,3950,1,0,1,
+6553,1,6543,1,
+6553,2,10,6550,1,
+6553,3,6543,3,0,1,
+6553,4,10,6219,8,0,1,
+6553,5,6543,24,0,0,0,1,
+6553,6,10,1417,2186,6188,0,0,1,
+6563,1,6558,1,
+6563,2,5,6561,1,
+6563,3,6558,1,0,1,
+6563,4,5,6555,6,0,1,
+6563,5,6558,9,0,0,0,1,
+6563,6,5,2323,4178,4246,1,0,1,
+6569,1,6566,1,
+6569,2,3,6568,1,
+6569,3,6566,4,0,1,
+6569,4,3,6125,7,0,1,
+6569,5,6566,16,0,0,0,1,
+6569,6,3,1853,3838,6126,1,0,1,
+6571,1,6568,1,
+6571,2,3,6566,1,
+6571,3,6568,4,0,1,
+6571,4,3,4564,3,0,1,
+6571,5,6568,1,0,0,0,1,
+6571,6,3,410,3112,3877,0,0,1,
+6577,1,6572,1,
+6577,2,5,6576,1,
+6577,3,6572,3,0,1,
+6577,4,5,4769,6,0,1,
+6577,5,6572,1,0,0,0,1,
+6577,6,5,1408,995,6264,0,0,1,
+6581,1,6567,1,
+6581,2,14,6577,1,
+6581,3,6567,2,0,1,
+6581,4,14,6043,1,0,1,
+6581,5,6567,3,0,0,0,1,
+6581,6,14,3255,2186,5790,1,0,1,
+6599,1,6586,1,
+6599,2,13,6586,1,
+6599,3,6586,2,0,1,
+6599,4,13,6418,15,0,1,
+6599,5,6586,5,0,0,0,1,
+6599,6,13,2581,5600,2426,2,0,1,
+6607,1,6604,1,
+6607,2,3,6606,1,
+6607,3,6604,3,0,1,
+6607,4,3,6492,2,0,1,
+6607,5,6604,3,0,0,0,1,
+6607,6,3,1568,6135,2932,0,0,1,
+6619,1,6617,1,
+6619,2,2,6614,1,
+6619,3,6617,6,0,1,
+6619,4,2,4540,3,0,1,
+6619,5,6617,3,0,0,0,1,
+6619,6,2,5406,784,1425,0,0,1,
+6637,1,6635,1,
+6637,2,2,6633,1,
+6637,3,6635,6,0,1,
+6637,4,2,4675,6,0,1,
+6637,5,6635,2,0,0,0,1,
+6637,6,2,6625,6619,6633,0,0,1,
+6653,1,6651,1,
+6653,2,2,6652,1,
+6653,3,6651,2,0,1,
+6653,4,2,3675,6,0,1,
+6653,5,6651,3,0,0,0,1,
+6653,6,2,6102,1495,3732,1,0,1,
+6659,1,6657,1,
+6659,2,2,6655,1,
+6659,3,6657,3,0,1,
+6659,4,2,5754,8,0,1,
+6659,5,6657,7,0,0,0,1,
+6659,6,2,4969,5657,6486,1,0,1,
+6661,1,6655,1,
+6661,2,6,6660,1,
+6661,3,6655,1,0,1,
+6661,4,6,3579,7,0,1,
+6661,5,6655,4,0,0,0,1,
+6661,6,6,198,5037,4210,1,0,1,
+6673,1,6668,1,
+6673,2,5,6670,1,
+6673,3,6668,7,0,1,
+6673,4,5,6662,14,0,1,
+6673,5,6668,2,0,0,0,1,
+6673,6,5,3662,844,4835,3,0,1,
+6679,1,6672,1,
+6679,2,7,6676,1,
+6679,3,6672,1,0,1,
+6679,4,7,6084,5,0,1,
+6679,5,6672,10,0,0,0,1,
+6679,6,7,3803,3644,2537,0,0,1,
+6689,1,6686,1,
+6689,2,3,6684,1,
+6689,3,6686,3,0,1,
+6689,4,3,3532,2,0,1,
+6689,5,6686,3,0,0,0,1,
+6689,6,3,5708,4934,6026,4,0,1,
+6691,1,6689,1,
+6691,2,2,6690,1,
+6691,3,6689,5,0,1,
+6691,4,2,5612,2,0,1,
+6691,5,6689,13,0,0,0,1,
+6691,6,2,4749,150,6099,0,0,1,
+6701,1,6699,1,
+6701,2,2,6697,1,
+6701,3,6699,3,0,1,
+6701,4,2,6518,6,0,1,
+6701,5,6699,2,0,0,0,1,
+6701,6,2,278,2145,3624,1,0,1,
+6703,1,6698,1,
+6703,2,5,6702,1,
+6703,3,6698,3,0,1,
+6703,4,5,5107,5,0,1,
+6703,5,6698,6,0,0,0,1,
+6703,6,5,4801,5837,6622,1,0,1,
+6709,1,6707,1,
+6709,2,2,6708,1,
+6709,3,6707,5,0,1,
+6709,4,2,4545,3,0,1,
+6709,5,6707,12,0,0,0,1,
+6709,6,2,2390,5583,1108,0,0,1,
+6719,1,6708,1,
+6719,2,11,6716,1,
+6719,3,6708,1,0,1,
+6719,4,11,5879,6,0,1,
+6719,5,6708,5,0,0,0,1,
+6719,6,11,5545,2901,2787,1,0,1,
+6733,1,6731,1,
+6733,2,2,6732,1,
+6733,3,6731,2,0,1,
+6733,4,2,5096,6,0,1,
+6733,5,6731,6,0,0,0,1,
+6733,6,2,5670,4209,5611,0,0,1,
+6737,1,6734,1,
+6737,2,3,6731,1,
+6737,3,6734,5,0,1,
+6737,4,3,4969,12,0,1,
+6737,5,6734,3,0,0,0,1,
+6737,6,3,4305,3010,3041,1,0,1,
+6761,1,6758,1,
+6761,2,3,6760,1,
+6761,3,6758,5,0,1,
+6761,4,3,3691,7,0,1,
+6761,5,6758,9,0,0,0,1,
+6761,6,3,5874,5625,5122,2,0,1,
+6763,1,6761,1,
+6763,2,2,6758,1,
+6763,3,6761,6,0,1,
+6763,4,2,3708,0,0,1,
+6763,5,6761,3,0,0,0,1,
+6763,6,2,2068,1859,6719,0,0,1,
+6779,1,6777,1,
+6779,2,2,6775,1,
+6779,3,6777,3,0,1,
+6779,4,2,3633,7,0,1,
+6779,5,6777,2,0,0,0,1,
+6779,6,2,762,1713,5811,1,0,1,
+6781,1,6779,1,
+6781,2,2,6780,1,
+6781,3,6779,4,0,1,
+6781,4,2,6422,7,0,1,
+6781,5,6779,4,0,0,0,1,
+6781,6,2,4279,2576,5639,0,0,1,
+6791,1,6784,1,
+6791,2,7,6789,1,
+6791,3,6784,2,0,1,
+6791,4,7,6226,4,0,1,
+6791,5,6784,14,0,0,0,1,
+6791,6,7,4446,4602,2743,2,0,1,
+6793,1,6783,1,
+6793,2,10,6792,1,
+6793,3,6783,2,0,1,
+6793,4,10,3546,8,0,1,
+6793,5,6783,6,0,0,0,1,
+6793,6,10,2987,917,4415,0,0,1,
+6803,1,6801,1,
+6803,2,2,6799,1,
+6803,3,6801,2,0,1,
+6803,4,2,5750,14,0,1,
+6803,5,6801,5,0,0,0,1,
+6803,6,2,612,2018,6190,1,0,1,
+6823,1,6820,1,
+6823,2,3,6821,1,
+6823,3,6820,8,0,1,
+6823,4,3,6819,4,0,1,
+6823,5,6820,1,0,0,0,1,
+6823,6,3,1630,3578,6433,0,0,1,
+6827,1,6825,1,
+6827,2,2,6823,1,
+6827,3,6825,3,0,1,
+6827,4,2,4068,7,0,1,
+6827,5,6825,5,0,0,0,1,
+6827,6,2,5263,3597,6226,1,0,1,
+6829,1,6827,1,
+6829,2,2,6825,1,
+6829,3,6827,2,0,1,
+6829,4,2,6384,6,0,1,
+6829,5,6827,2,0,0,0,1,
+6829,6,2,4259,4000,6425,0,0,1,
+6833,1,6830,1,
+6833,2,3,6832,1,
+6833,3,6830,1,0,1,
+6833,4,3,6428,4,0,1,
+6833,5,6830,3,0,0,0,1,
+6833,6,3,3213,4297,4331,2,0,1,
+6841,1,6819,1,
+6841,2,22,6840,1,
+6841,3,6819,1,0,1,
+6841,4,22,5338,18,0,1,
+6841,5,6819,2,0,0,0,1,
+6841,6,22,53,1004,6303,0,0,1,
+6857,1,6854,1,
+6857,2,3,6852,1,
+6857,3,6854,4,0,1,
+6857,4,3,3578,0,0,1,
+6857,5,6854,1,0,0,0,1,
+6857,6,3,4241,4549,6371,1,0,1,
+6863,1,6858,1,
+6863,2,5,6860,1,
+6863,3,6858,3,0,1,
+6863,4,5,3569,6,0,1,
+6863,5,6858,3,0,0,0,1,
+6863,6,5,1806,5646,3396,1,0,1,
+6869,1,6867,1,
+6869,2,2,6865,1,
+6869,3,6867,3,0,1,
+6869,4,2,5754,12,0,1,
+6869,5,6867,3,0,0,0,1,
+6869,6,2,1589,4498,1535,2,0,1,
+6871,1,6868,1,
+6871,2,3,6870,1,
+6871,3,6868,1,0,1,
+6871,4,3,3573,2,0,1,
+6871,5,6868,1,0,0,0,1,
+6871,6,3,2819,4821,4520,0,0,1,
+6883,1,6881,1,
+6883,2,2,6879,1,
+6883,3,6881,6,0,1,
+6883,4,2,4187,8,0,1,
+6883,5,6881,11,0,0,0,1,
+6883,6,2,6871,6865,6879,0,0,1,
+6899,1,6897,1,
+6899,2,2,6895,1,
+6899,3,6897,3,0,1,
+6899,4,2,5297,7,0,1,
+6899,5,6897,19,0,0,0,1,
+6899,6,2,3996,6687,5926,2,0,1,
+6907,1,6905,1,
+6907,2,2,6906,1,
+6907,3,6905,9,0,1,
+6907,4,2,6900,8,0,1,
+6907,5,6905,6,0,0,0,1,
+6907,6,2,226,1334,5841,0,0,1,
+6911,1,6904,1,
+6911,2,7,6910,1,
+6911,3,6904,3,0,1,
+6911,4,7,6479,2,0,1,
+6911,5,6904,25,0,0,0,1,
+6911,6,7,3787,3523,646,1,0,1,
+6917,1,6915,1,
+6917,2,2,6913,1,
+6917,3,6915,3,0,1,
+6917,4,2,4673,9,0,1,
+6917,5,6915,28,0,0,0,1,
+6917,6,2,2784,5776,3952,1,0,1,
+6947,1,6945,1,
+6947,2,2,6942,1,
+6947,3,6945,2,0,1,
+6947,4,2,6296,3,0,1,
+6947,5,6945,15,0,0,0,1,
+6947,6,2,5933,5914,5586,3,0,1,
+6949,1,6947,1,
+6949,2,2,6948,1,
+6949,3,6947,4,0,1,
+6949,4,2,5165,3,0,1,
+6949,5,6947,3,0,0,0,1,
+6949,6,2,6814,4446,4030,0,0,1,
+6959,1,6952,1,
+6959,2,7,6957,1,
+6959,3,6952,10,0,1,
+6959,4,7,5088,13,0,1,
+6959,5,6952,3,0,0,0,1,
+6959,6,7,395,5933,3213,1,0,1,
+6961,1,6948,1,
+6961,2,13,6950,1,
+6961,3,6948,3,0,1,
+6961,4,13,5425,18,0,1,
+6961,5,6948,1,0,0,0,1,
+6961,6,13,787,5199,2288,2,0,1,
+6967,1,6962,1,
+6967,2,5,6965,1,
+6967,3,6962,12,0,1,
+6967,4,5,3595,17,0,1,
+6967,5,6962,2,0,0,0,1,
+6967,6,5,6552,1246,6016,0,0,1,
+6971,1,6969,1,
+6971,2,2,6970,1,
+6971,3,6969,10,0,1,
+6971,4,2,5192,2,0,1,
+6971,5,6969,13,0,0,0,1,
+6971,6,2,6619,3007,3606,2,0,1,
+6977,1,6974,1,
+6977,2,3,6971,1,
+6977,3,6974,5,0,1,
+6977,4,3,6423,9,0,1,
+6977,5,6974,17,0,0,0,1,
+6977,6,3,3216,6689,1076,1,0,1,
+6983,1,6978,1,
+6983,2,5,6974,1,
+6983,3,6978,9,0,1,
+6983,4,5,6746,4,0,1,
+6983,5,6978,2,0,0,0,1,
+6983,6,5,704,6370,5285,4,0,1,
+6991,1,6985,1,
+6991,2,6,6990,1,
+6991,3,6985,1,0,1,
+6991,4,6,4491,3,0,1,
+6991,5,6985,2,0,0,0,1,
+6991,6,6,1313,1793,3115,0,0,1,
+6997,1,6992,1,
+6997,2,5,6992,1,
+6997,3,6992,9,0,1,
+6997,4,5,5900,20,0,1,
+6997,5,6992,10,0,0,0,1,
+6997,6,5,5945,458,2575,0,0,1,
+7001,1,6998,1,
+7001,2,3,6994,1,
+7001,3,6998,3,0,1,
+7001,4,3,4330,1,0,1,
+7001,5,6998,4,0,0,0,1,
+7001,6,3,4025,3151,2368,1,0,1,
+7013,1,7011,1,
+7013,2,2,7012,1,
+7013,3,7011,2,0,1,
+7013,4,2,5076,3,0,1,
+7013,5,7011,21,0,0,0,1,
+7013,6,2,6926,5439,4350,1,0,1,
+7019,1,7017,1,
+7019,2,2,7015,1,
+7019,3,7017,3,0,1,
+7019,4,2,4031,7,0,1,
+7019,5,7017,3,0,0,0,1,
+7019,6,2,461,5640,2328,2,0,1,
+7027,1,7025,1,
+7027,2,2,7026,1,
+7027,3,7025,4,0,1,
+7027,4,2,4903,7,0,1,
+7027,5,7025,8,0,0,0,1,
+7027,6,2,421,4131,6876,0,0,1,
+7039,1,7036,1,
+7039,2,3,7038,1,
+7039,3,7036,5,0,1,
+7039,4,3,4087,3,0,1,
+7039,5,7036,9,0,0,0,1,
+7039,6,3,6693,3074,3617,0,0,1,
+7043,1,7041,1,
+7043,2,2,7037,1,
+7043,3,7041,4,0,1,
+7043,4,2,6012,25,0,1,
+7043,5,7041,4,0,0,0,1,
+7043,6,2,1762,2987,3991,2,0,1,
+7057,1,7052,1,
+7057,2,5,7056,1,
+7057,3,7052,2,0,1,
+7057,4,5,4013,6,0,1,
+7057,5,7052,7,0,0,0,1,
+7057,6,5,326,1378,6981,0,0,1,
+7069,1,7067,1,
+7069,2,2,7065,1,
+7069,3,7067,6,0,1,
+7069,4,2,6317,6,0,1,
+7069,5,7067,2,0,0,0,1,
+7069,6,2,7057,7051,7065,0,0,1,
+7079,1,7072,1,
+7079,2,7,7077,1,
+7079,3,7072,1,0,1,
+7079,4,7,6370,5,0,1,
+7079,5,7072,8,0,0,0,1,
+7079,6,7,6760,944,5256,1,0,1,
+7103,1,7098,1,
+7103,2,5,7101,1,
+7103,3,7098,3,0,1,
+7103,4,5,6519,9,0,1,
+7103,5,7098,16,0,0,0,1,
+7103,6,5,6748,5159,5353,3,0,1,
+7109,1,7107,1,
+7109,2,2,7100,1,
+7109,3,7107,2,0,1,
+7109,4,2,5252,1,0,1,
+7109,5,7107,6,0,0,0,1,
+7109,6,2,4001,1752,258,1,0,1,
+7121,1,7118,1,
+7121,2,3,7115,1,
+7121,3,7118,6,0,1,
+7121,4,3,7109,0,0,1,
+7121,5,7118,1,0,0,0,1,
+7121,6,3,1471,4940,2839,1,0,1,
+7127,1,7122,1,
+7127,2,5,7126,1,
+7127,3,7122,8,0,1,
+7127,4,5,3637,4,0,1,
+7127,5,7122,1,0,0,0,1,
+7127,6,5,5469,402,644,3,0,1,
+7129,1,7122,1,
+7129,2,7,7120,1,
+7129,3,7122,2,0,1,
+7129,4,7,3757,16,0,1,
+7129,5,7122,1,0,0,0,1,
+7129,6,7,1515,6041,2103,0,0,1,
+7151,1,7144,1,
+7151,2,7,7150,1,
+7151,3,7144,5,0,1,
+7151,4,7,3932,7,0,1,
+7151,5,7144,3,0,0,0,1,
+7151,6,7,1854,1423,1105,1,0,1,
+7159,1,7156,1,
+7159,2,3,7157,1,
+7159,3,7156,3,0,1,
+7159,4,3,6236,3,0,1,
+7159,5,7156,3,0,0,0,1,
+7159,6,3,1474,193,3635,0,0,1,
+7177,1,7167,1,
+7177,2,10,7172,1,
+7177,3,7167,3,0,1,
+7177,4,10,4338,15,0,1,
+7177,5,7167,1,0,0,0,1,
+7177,6,10,3113,6174,3830,0,0,1,
+7187,1,7185,1,
+7187,2,2,7186,1,
+7187,3,7185,2,0,1,
+7187,4,2,6410,4,0,1,
+7187,5,7185,6,0,0,0,1,
+7187,6,2,4440,6639,5701,1,0,1,
+7193,1,7190,1,
+7193,2,3,7187,1,
+7193,3,7190,1,0,1,
+7193,4,3,3771,11,0,1,
+7193,5,7190,4,0,0,0,1,
+7193,6,3,2785,6600,3366,1,0,1,
+7207,1,7204,1,
+7207,2,3,7206,1,
+7207,3,7204,4,0,1,
+7207,4,3,3716,5,0,1,
+7207,5,7204,3,0,0,0,1,
+7207,6,3,5204,2384,180,0,0,1,
+7211,1,7209,1,
+7211,2,2,7207,1,
+7211,3,7209,3,0,1,
+7211,4,2,6379,8,0,1,
+7211,5,7209,8,0,0,0,1,
+7211,6,2,402,5798,1605,1,0,1,
+7213,1,7208,1,
+7213,2,5,7212,1,
+7213,3,7208,2,0,1,
+7213,4,5,4303,3,0,1,
+7213,5,7208,1,0,0,0,1,
+7213,6,5,5006,6932,3215,0,0,1,
+7219,1,7217,1,
+7219,2,2,7215,1,
+7219,3,7217,2,0,1,
+7219,4,2,4165,8,0,1,
+7219,5,7217,7,0,0,0,1,
+7219,6,2,1767,795,5732,4,0,1,
+7229,1,7227,1,
+7229,2,2,7228,1,
+7229,3,7227,3,0,1,
+7229,4,2,4625,3,0,1,
+7229,5,7227,11,0,0,0,1,
+7229,6,2,1002,52,6435,2,0,1,
+7237,1,7235,1,
+7237,2,2,7236,1,
+7237,3,7235,6,0,1,
+7237,4,2,3772,7,0,1,
+7237,5,7235,3,0,0,0,1,
+7237,6,2,6719,3532,4691,0,0,1,
+7243,1,7241,1,
+7243,2,2,7242,1,
+7243,3,7241,2,0,1,
+7243,4,2,4257,10,0,1,
+7243,5,7241,2,0,0,0,1,
+7243,6,2,1410,5830,2864,2,0,1,
+7247,1,7242,1,
+7247,2,5,7246,1,
+7247,3,7242,2,0,1,
+7247,4,5,6940,3,0,1,
+7247,5,7242,2,0,0,0,1,
+7247,6,5,5700,7009,4641,1,0,1,
+7253,1,7251,1,
+7253,2,2,7249,1,
+7253,3,7251,3,0,1,
+7253,4,2,5662,6,0,1,
+7253,5,7251,2,0,0,0,1,
+7253,6,2,21,6469,7159,1,0,1,
+7283,1,7281,1,
+7283,2,2,7282,1,
+7283,3,7281,3,0,1,
+7283,4,2,6911,2,0,1,
+7283,5,7281,2,0,0,0,1,
+7283,6,2,2502,1631,6658,1,0,1,
+7297,1,7292,1,
+7297,2,5,7292,1,
+7297,3,7292,5,0,1,
+7297,4,5,4126,10,0,1,
+7297,5,7292,5,0,0,0,1,
+7297,6,5,5735,2750,4830,0,0,1,
+7307,1,7305,1,
+7307,2,2,7306,1,
+7307,3,7305,2,0,1,
+7307,4,2,5047,2,0,1,
+7307,5,7305,9,0,0,0,1,
+7307,6,2,585,5601,130,1,0,1,
+7309,1,7303,1,
+7309,2,6,7305,1,
+7309,3,7303,4,0,1,
+7309,4,6,5705,10,0,1,
+7309,5,7303,7,0,0,0,1,
+7309,6,6,6166,5665,5038,1,0,1,
+7321,1,7314,1,
+7321,2,7,7314,1,
+7321,3,7314,2,0,1,
+7321,4,7,4513,0,0,1,
+7321,5,7314,1,0,0,0,1,
+7321,6,7,6092,2104,6562,0,0,1,
+7331,1,7329,1,
+7331,2,2,7327,1,
+7331,3,7329,2,0,1,
+7331,4,2,5535,7,0,1,
+7331,5,7329,5,0,0,0,1,
+7331,6,2,5844,3873,6972,1,0,1,
+7333,1,7327,1,
+7333,2,6,7332,1,
+7333,3,7327,1,0,1,
+7333,4,6,6200,19,0,1,
+7333,5,7327,13,0,0,0,1,
+7333,6,6,5415,5266,2398,0,0,1,
+7349,1,7347,1,
+7349,2,2,7348,1,
+7349,3,7347,3,0,1,
+7349,4,2,7052,4,0,1,
+7349,5,7347,2,0,0,0,1,
+7349,6,2,5790,252,6222,1,0,1,
+7351,1,7345,1,
+7351,2,6,7350,1,
+7351,3,7345,3,0,1,
+7351,4,6,4268,3,0,1,
+7351,5,7345,6,0,0,0,1,
+7351,6,6,5578,1302,7044,0,0,1,
+7369,1,7362,1,
+7369,2,7,7362,1,
+7369,3,7362,5,0,1,
+7369,4,7,4712,0,0,1,
+7369,5,7362,13,0,0,0,1,
+7369,6,7,2196,3185,6895,2,0,1,
+7393,1,7388,1,
+7393,2,5,7392,1,
+7393,3,7388,2,0,1,
+7393,4,5,4462,6,0,1,
+7393,5,7388,13,0,0,0,1,
+7393,6,5,259,1460,1063,0,0,1,
+7411,1,7409,1,
+7411,2,2,7410,1,
+7411,3,7409,6,0,1,
+7411,4,2,5186,12,0,1,
+7411,5,7409,14,0,0,0,1,
+7411,6,2,3431,5822,5540,0,0,1,
+7417,1,7412,1,
+7417,2,5,7412,1,
+7417,3,7412,7,0,1,
+7417,4,5,6268,10,0,1,
+7417,5,7412,2,0,0,0,1,
+7417,6,5,5540,4355,4108,0,0,1,
+7433,1,7430,1,
+7433,2,3,7432,1,
+7433,3,7430,4,0,1,
+7433,4,3,7147,4,0,1,
+7433,5,7430,4,0,0,0,1,
+7433,6,3,3233,2366,6076,1,0,1,
+7451,1,7449,1,
+7451,2,2,7444,1,
+7451,3,7449,4,0,1,
+7451,4,2,5087,1,0,1,
+7451,5,7449,10,0,0,0,1,
+7451,6,2,2909,3645,3008,1,0,1,
+7457,1,7454,1,
+7457,2,3,7456,1,
+7457,3,7454,3,0,1,
+7457,4,3,7446,12,0,1,
+7457,5,7454,24,0,0,0,1,
+7457,6,3,1190,2527,3235,1,0,1,
+7459,1,7457,1,
+7459,2,2,7455,1,
+7459,3,7457,6,0,1,
+7459,4,2,5760,8,0,1,
+7459,5,7457,10,0,0,0,1,
+7459,6,2,7447,7441,7455,0,0,1,
+7477,1,7475,1,
+7477,2,2,7473,1,
+7477,3,7475,5,0,1,
+7477,4,2,6608,6,0,1,
+7477,5,7475,7,0,0,0,1,
+7477,6,2,4847,3501,6488,0,0,1,
+7481,1,7475,1,
+7481,2,6,7478,1,
+7481,3,7475,4,0,1,
+7481,4,6,5095,0,0,1,
+7481,5,7475,4,0,0,0,1,
+7481,6,6,5246,6853,3117,1,0,1,
+7487,1,7482,1,
+7487,2,5,7485,1,
+7487,3,7482,1,0,1,
+7487,4,5,6913,5,0,1,
+7487,5,7482,7,0,0,0,1,
+7487,6,5,1146,949,6607,1,0,1,
+7489,1,7482,1,
+7489,2,7,7486,1,
+7489,3,7482,9,0,1,
+7489,4,7,4900,17,0,1,
+7489,5,7482,1,0,0,0,1,
+7489,6,7,3602,5586,3832,0,0,1,
+7499,1,7497,1,
+7499,2,2,7493,1,
+7499,3,7497,2,0,1,
+7499,4,2,5082,0,0,1,
+7499,5,7497,4,0,0,0,1,
+7499,6,2,796,3707,5190,1,0,1,
+7507,1,7505,1,
+7507,2,2,7506,1,
+7507,3,7505,4,0,1,
+7507,4,2,7500,8,0,1,
+7507,5,7505,2,0,0,0,1,
+7507,6,2,7435,2078,5967,0,0,1,
+7517,1,7515,1,
+7517,2,2,7516,1,
+7517,3,7515,2,0,1,
+7517,4,2,4573,6,0,1,
+7517,5,7515,11,0,0,0,1,
+7517,6,2,5797,5676,6158,1,0,1,
+7523,1,7521,1,
+7523,2,2,7522,1,
+7523,3,7521,3,0,1,
+7523,4,2,7329,4,0,1,
+7523,5,7521,4,0,0,0,1,
+7523,6,2,6910,7216,6368,1,0,1,
+7529,1,7526,1,
+7529,2,3,7524,1,
+7529,3,7526,5,0,1,
+7529,4,3,6670,2,0,1,
+7529,5,7526,1,0,0,0,1,
+7529,6,3,2780,3909,6608,2,0,1,
+7537,1,7530,1,
+7537,2,7,7534,1,
+7537,3,7530,7,0,1,
+7537,4,7,4898,10,0,1,
+7537,5,7530,2,0,0,0,1,
+7537,6,7,895,6822,2291,0,0,1,
+7541,1,7539,1,
+7541,2,2,7537,1,
+7541,3,7539,2,0,1,
+7541,4,2,3927,6,0,1,
+7541,5,7539,13,0,0,0,1,
+7541,6,2,4749,4047,3247,2,0,1,
+7547,1,7545,1,
+7547,2,2,7543,1,
+7547,3,7545,3,0,1,
+7547,4,2,4129,8,0,1,
+7547,5,7545,2,0,0,0,1,
+7547,6,2,5032,3183,3233,1,0,1,
+7549,1,7547,1,
+7549,2,2,7548,1,
+7549,3,7547,6,0,1,
+7549,4,2,5562,7,0,1,
+7549,5,7547,5,0,0,0,1,
+7549,6,2,5305,4439,6900,0,0,1,
+7559,1,7546,1,
+7559,2,13,7557,1,
+7559,3,7546,2,0,1,
+7559,4,13,5754,4,0,1,
+7559,5,7546,9,0,0,0,1,
+7559,6,13,1411,1583,5606,1,0,1,
+7561,1,7548,1,
+7561,2,13,7552,1,
+7561,3,7548,3,0,1,
+7561,4,13,5370,35,0,1,
+7561,5,7548,7,0,0,0,1,
+7561,6,13,3226,6576,6950,0,0,1,
+7573,1,7571,1,
+7573,2,2,7572,1,
+7573,3,7571,4,0,1,
+7573,4,2,3966,6,0,1,
+7573,5,7571,4,0,0,0,1,
+7573,6,2,3595,7410,1807,0,0,1,
+7577,1,7574,1,
+7577,2,3,7572,1,
+7577,3,7574,1,0,1,
+7577,4,3,4887,0,0,1,
+7577,5,7574,8,0,0,0,1,
+7577,6,3,1333,6254,189,1,0,1,
+7583,1,7578,1,
+7583,2,5,7578,1,
+7583,3,7578,3,0,1,
+7583,4,5,6405,6,0,1,
+7583,5,7578,15,0,0,0,1,
+7583,6,5,6021,6421,2469,1,0,1,
+7589,1,7587,1,
+7589,2,2,7585,1,
+7589,3,7587,3,0,1,
+7589,4,2,5491,6,0,1,
+7589,5,7587,3,0,0,0,1,
+7589,6,2,1436,3574,7495,2,0,1,
+7591,1,7585,1,
+7591,2,6,7589,1,
+7591,3,7585,4,0,1,
+7591,4,6,7302,3,0,1,
+7591,5,7585,6,0,0,0,1,
+7591,6,6,6269,6080,4565,0,0,1,
+7603,1,7601,1,
+7603,2,2,7599,1,
+7603,3,7601,5,0,1,
+7603,4,2,7301,8,0,1,
+7603,5,7601,8,0,0,0,1,
+7603,6,2,7353,3297,5880,1,0,1,
+7607,1,7602,1,
+7607,2,5,7605,1,
+7607,3,7602,1,0,1,
+7607,4,5,5918,8,0,1,
+7607,5,7602,6,0,0,0,1,
+7607,6,5,2945,5588,5572,1,0,1,
+7621,1,7619,1,
+7621,2,2,7620,1,
+7621,3,7619,5,0,1,
+7621,4,2,7159,9,0,1,
+7621,5,7619,2,0,0,0,1,
+7621,6,2,2265,1419,1558,0,0,1,
+7639,1,7632,1,
+7639,2,7,7628,1,
+7639,3,7632,1,0,1,
+7639,4,7,4871,12,0,1,
+7639,5,7632,1,0,0,0,1,
+7639,6,7,2491,5805,3494,0,0,1,
+7643,1,7641,1,
+7643,2,2,7642,1,
+7643,3,7641,8,0,1,
+7643,4,2,7636,8,0,1,
+7643,5,7641,5,0,0,0,1,
+7643,6,2,5555,2982,7211,1,0,1,
+7649,1,7646,1,
+7649,2,3,7644,1,
+7649,3,7646,3,0,1,
+7649,4,3,7359,8,0,1,
+7649,5,7646,12,0,0,0,1,
+7649,6,3,5418,6712,1749,3,0,1,
+7669,1,7667,1,
+7669,2,2,7665,1,
+7669,3,7667,2,0,1,
+7669,4,2,4671,12,0,1,
+7669,5,7667,2,0,0,0,1,
+7669,6,2,4020,5683,5971,0,0,1,
+7673,1,7670,1,
+7673,2,3,7667,1,
+7673,3,7670,5,0,1,
+7673,4,3,7312,11,0,1,
+7673,5,7670,4,0,0,0,1,
+7673,6,3,1329,930,6164,1,0,1,
+7681,1,7664,1,
+7681,2,17,7680,1,
+7681,3,7664,1,0,1,
+7681,4,17,7308,14,0,1,
+7681,5,7664,12,0,0,0,1,
+7681,6,17,7076,4925,6113,0,0,1,
+7687,1,7681,1,
+7687,2,6,7686,1,
+7687,3,7681,13,0,1,
+7687,4,6,5032,3,0,1,
+7687,5,7681,10,0,0,0,1,
+7687,6,6,4875,2718,4602,0,0,1,
+7691,1,7689,1,
+7691,2,2,7687,1,
+7691,3,7689,3,0,1,
+7691,4,2,7443,7,0,1,
+7691,5,7689,12,0,0,0,1,
+7691,6,2,6510,1487,1304,2,0,1,
+7699,1,7696,1,
+7699,2,3,7698,1,
+7699,3,7696,3,0,1,
+7699,4,3,6377,2,0,1,
+7699,5,7696,1,0,0,0,1,
+7699,6,3,1172,5156,5599,0,0,1,
+7703,1,7698,1,
+7703,2,5,7702,1,
+7703,3,7698,1,0,1,
+7703,4,5,6237,2,0,1,
+7703,5,7698,6,0,0,0,1,
+7703,6,5,826,6494,6471,1,0,1,
+7717,1,7715,1,
+7717,2,2,7716,1,
+7717,3,7715,4,0,1,
+7717,4,2,3957,9,0,1,
+7717,5,7715,7,0,0,0,1,
+7717,6,2,1202,2249,2931,0,0,1,
+7723,1,7720,1,
+7723,2,3,7708,1,
+7723,3,7720,1,0,1,
+7723,4,3,4643,3,0,1,
+7723,5,7720,3,0,0,0,1,
+7723,6,3,886,7164,3978,1,0,1,
+7727,1,7722,1,
+7727,2,5,7726,1,
+7727,3,7722,2,0,1,
+7727,4,5,3940,4,0,1,
+7727,5,7722,3,0,0,0,1,
+7727,6,5,3518,2100,7081,2,0,1,
+7741,1,7734,1,
+7741,2,7,7739,1,
+7741,3,7734,9,0,1,
+7741,4,7,7389,4,0,1,
+7741,5,7734,12,0,0,0,1,
+7741,6,7,6003,5031,2290,0,0,1,
+7753,1,7743,1,
+7753,2,10,7752,1,
+7753,3,7743,7,0,1,
+7753,4,10,5369,14,0,1,
+7753,5,7743,2,0,0,0,1,
+7753,6,10,6896,4162,6595,0,0,1,
+7757,1,7755,1,
+7757,2,2,7749,1,
+7757,3,7755,4,0,1,
+7757,4,2,6682,11,0,1,
+7757,5,7755,4,0,0,0,1,
+7757,6,2,6662,7212,1941,1,0,1,
+7759,1,7756,1,
+7759,2,3,7754,1,
+7759,3,7756,11,0,1,
+7759,4,3,4050,7,0,1,
+7759,5,7756,8,0,0,0,1,
+7759,6,3,3196,2762,2236,0,0,1,
+7789,1,7787,1,
+7789,2,2,7785,1,
+7789,3,7787,5,0,1,
+7789,4,2,5723,6,0,1,
+7789,5,7787,3,0,0,0,1,
+7789,6,2,1115,3539,3519,0,0,1,
+7793,1,7790,1,
+7793,2,3,7788,1,
+7793,3,7790,3,0,1,
+7793,4,3,7668,2,0,1,
+7793,5,7790,3,0,0,0,1,
+7793,6,3,3922,2501,7568,1,0,1,
+7817,1,7814,1,
+7817,2,3,7811,1,
+7817,3,7814,6,0,1,
+7817,4,3,6121,16,0,1,
+7817,5,7814,3,0,0,0,1,
+7817,6,3,6437,7096,7295,2,0,1,
+7823,1,7818,1,
+7823,2,5,7822,1,
+7823,3,7818,5,0,1,
+7823,4,5,4777,3,0,1,
+7823,5,7818,2,0,0,0,1,
+7823,6,5,2438,356,4599,3,0,1,
+7829,1,7827,1,
+7829,2,2,7828,1,
+7829,3,7827,3,0,1,
+7829,4,2,4796,3,0,1,
+7829,5,7827,8,0,0,0,1,
+7829,6,2,7155,5906,401,1,0,1,
+7841,1,7829,1,
+7841,2,12,7840,1,
+7841,3,7829,1,0,1,
+7841,4,12,6793,13,0,1,
+7841,5,7829,10,0,0,0,1,
+7841,6,12,6877,710,7133,1,0,1,
+7853,1,7851,1,
+7853,2,2,7852,1,
+7853,3,7851,7,0,1,
+7853,4,2,5386,3,0,1,
+7853,5,7851,10,0,0,0,1,
+7853,6,2,2079,5068,7765,1,0,1,
+7867,1,7864,1,
+7867,2,3,7862,1,
+7867,3,7864,4,0,1,
+7867,4,3,5804,11,0,1,
+7867,5,7864,1,0,0,0,1,
+7867,6,3,5298,6607,6744,0,0,1,
+7873,1,7868,1,
+7873,2,5,7870,1,
+7873,3,7868,6,0,1,
+7873,4,5,6445,10,0,1,
+7873,5,7868,3,0,0,0,1,
+7873,6,5,4367,1891,7380,0,0,1,
+7877,1,7875,1,
+7877,2,2,7873,1,
+7877,3,7875,3,0,1,
+7877,4,2,6597,6,0,1,
+7877,5,7875,5,0,0,0,1,
+7877,6,2,4653,1395,7625,5,0,1,
+7879,1,7876,1,
+7879,2,3,7873,1,
+7879,3,7876,3,0,1,
+7879,4,3,6527,7,0,1,
+7879,5,7876,1,0,0,0,1,
+7879,6,3,6111,1548,4084,0,0,1,
+7883,1,7881,1,
+7883,2,2,7879,1,
+7883,3,7881,3,0,1,
+7883,4,2,6618,7,0,1,
+7883,5,7881,6,0,0,0,1,
+7883,6,2,3598,6912,4848,1,0,1,
+7901,1,7899,1,
+7901,2,2,7895,1,
+7901,3,7899,8,0,1,
+7901,4,2,6435,3,0,1,
+7901,5,7899,2,0,0,0,1,
+7901,6,2,6704,7881,7263,1,0,1,
+7907,1,7905,1,
+7907,2,2,7903,1,
+7907,3,7905,3,0,1,
+7907,4,2,7224,7,0,1,
+7907,5,7905,15,0,0,0,1,
+7907,6,2,5736,6031,6389,4,0,1,
+7919,1,7912,1,
+7919,2,7,7918,1,
+7919,3,7912,3,0,1,
+7919,4,7,7322,3,0,1,
+7919,5,7912,8,0,0,0,1,
+7919,6,7,4922,5917,3472,4,0,1,
+7927,1,7924,1,
+7927,2,3,7926,1,
+7927,3,7924,1,0,1,
+7927,4,3,6367,2,0,1,
+7927,5,7924,4,0,0,0,1,
+7927,6,3,1272,6856,6150,0,0,1,
+7933,1,7931,1,
+7933,2,2,7929,1,
+7933,3,7931,5,0,1,
+7933,4,2,7734,12,0,1,
+7933,5,7931,5,0,0,0,1,
+7933,6,2,7866,3854,2022,0,0,1,
+7937,1,7934,1,
+7937,2,3,7936,1,
+7937,3,7934,1,0,1,
+7937,4,3,5414,6,0,1,
+7937,5,7934,14,0,0,0,1,
+7937,6,3,3961,509,6755,2,0,1,
+7949,1,7947,1,
+7949,2,2,7944,1,
+7949,3,7947,3,0,1,
+7949,4,2,7294,18,0,1,
+7949,5,7947,6,0,0,0,1,
+7949,6,2,6177,7753,243,5,0,1,
+7951,1,7945,1,
+7951,2,6,7949,1,
+7951,3,7945,1,0,1,
+7951,4,6,6758,3,0,1,
+7951,5,7945,10,0,0,0,1,
+7951,6,6,2016,735,7698,3,0,1,
+7963,1,7958,1,
+7963,2,5,7962,1,
+7963,3,7958,1,0,1,
+7963,4,5,4368,5,0,1,
+7963,5,7958,5,0,0,0,1,
+7963,6,5,5444,659,6806,1,0,1,
+7993,1,7988,1,
+7993,2,5,7992,1,
+7993,3,7988,7,0,1,
+7993,4,5,4905,6,0,1,
+7993,5,7988,11,0,0,0,1,
+7993,6,5,2935,2235,7864,0,0,1,
+8009,1,8006,1,
+8009,2,3,8003,1,
+8009,3,8006,6,0,1,
+8009,4,3,7997,0,0,1,
+8009,5,8006,5,0,0,0,1,
+8009,6,3,3251,5503,6841,1,0,1,
+8011,1,7997,1,
+8011,2,14,8009,1,
+8011,3,7997,1,0,1,
+8011,4,14,7273,0,0,1,
+8011,5,7997,31,0,0,0,1,
+8011,6,14,6704,4929,7473,0,0,1,
+8017,1,8012,1,
+8017,2,5,8016,1,
+8017,3,8012,3,0,1,
+8017,4,5,5204,11,0,1,
+8017,5,8012,7,0,0,0,1,
+8017,6,5,3710,7946,7470,0,0,1,
+8039,1,8028,1,
+8039,2,11,8035,1,
+8039,3,8028,1,0,1,
+8039,4,11,7648,9,0,1,
+8039,5,8028,1,0,0,0,1,
+8039,6,11,7158,7277,2220,3,0,1,
+8053,1,8051,1,
+8053,2,2,8052,1,
+8053,3,8051,4,0,1,
+8053,4,2,8046,8,0,1,
+8053,5,8051,2,0,0,0,1,
+8053,6,2,898,1783,6375,0,0,1,
+8059,1,8056,1,
+8059,2,3,8058,1,
+8059,3,8056,6,0,1,
+8059,4,3,7932,2,0,1,
+8059,5,8056,1,0,0,0,1,
+8059,6,3,6629,5055,6373,0,0,1,
+8069,1,8067,1,
+8069,2,2,8068,1,
+8069,3,8067,5,0,1,
+8069,4,2,4135,3,0,1,
+8069,5,8067,2,0,0,0,1,
+8069,6,2,6072,7997,7974,1,0,1,
+8081,1,8078,1,
+8081,2,3,8080,1,
+8081,3,8078,3,0,1,
+8081,4,3,7439,4,0,1,
+8081,5,8078,6,0,0,0,1,
+8081,6,3,5498,5491,6981,2,0,1,
+8087,1,8082,1,
+8087,2,5,8086,1,
+8087,3,8082,1,0,1,
+8087,4,5,7414,4,0,1,
+8087,5,8082,1,0,0,0,1,
+8087,6,5,472,5447,1925,1,0,1,
+8089,1,8072,1,
+8089,2,17,8078,1,
+8089,3,8072,2,0,1,
+8089,4,17,5877,28,0,1,
+8089,5,8072,14,0,0,0,1,
+8089,6,17,7517,7863,819,0,0,1,
+8093,1,8091,1,
+8093,2,2,8089,1,
+8093,3,8091,3,0,1,
+8093,4,2,6711,7,0,1,
+8093,5,8091,20,0,0,0,1,
+8093,6,2,7359,2707,7561,2,0,1,
+8101,1,8095,1,
+8101,2,6,8100,1,
+8101,3,8095,1,0,1,
+8101,4,6,5576,7,0,1,
+8101,5,8095,3,0,0,0,1,
+8101,6,6,4610,3231,3842,0,0,1,
+8111,1,8100,1,
+8111,2,11,8110,1,
+8111,3,8100,4,0,1,
+8111,4,11,4175,3,0,1,
+8111,5,8100,1,0,0,0,1,
+8111,6,11,3313,5943,1374,1,0,1,
+8117,1,8115,1,
+8117,2,2,8109,1,
+8117,3,8115,10,0,1,
+8117,4,2,4332,13,0,1,
+8117,5,8115,12,0,0,0,1,
+8117,6,2,1507,1015,7142,1,0,1,
+8123,1,8121,1,
+8123,2,2,8122,1,
+8123,3,8121,4,0,1,
+8123,4,2,5348,4,0,1,
+8123,5,8121,4,0,0,0,1,
+8123,6,2,3854,5556,3044,2,0,1,
+8147,1,8145,1,
+8147,2,2,8146,1,
+8147,3,8145,2,0,1,
+8147,4,2,7196,13,0,1,
+8147,5,8145,8,0,0,0,1,
+8147,6,2,5596,5401,7685,1,0,1,
+8161,1,8154,1,
+8161,2,7,8154,1,
+8161,3,8154,1,0,1,
+8161,4,7,7029,0,0,1,
+8161,5,8154,15,0,0,0,1,
+8161,6,7,2036,1414,7254,0,0,1,
+8167,1,8164,1,
+8167,2,3,8165,1,
+8167,3,8164,1,0,1,
+8167,4,3,6636,6,0,1,
+8167,5,8164,10,0,0,0,1,
+8167,6,3,2265,7153,7585,0,0,1,
+8171,1,8169,1,
+8171,2,2,8167,1,
+8171,3,8169,2,0,1,
+8171,4,2,4824,8,0,1,
+8171,5,8169,17,0,0,0,1,
+8171,6,2,3525,6436,5270,1,0,1,
+8179,1,8177,1,
+8179,2,2,8178,1,
+8179,3,8177,4,0,1,
+8179,4,2,6095,2,0,1,
+8179,5,8177,15,0,0,0,1,
+8179,6,2,6127,4044,2735,0,0,1,
+8191,1,8174,1,
+8191,2,17,8189,1,
+8191,3,8174,5,0,1,
+8191,4,17,8183,3,0,1,
+8191,5,8174,4,0,0,0,1,
+8191,6,17,5644,5964,7746,0,0,1,
+8209,1,8202,1,
+8209,2,7,8202,1,
+8209,3,8202,3,0,1,
+8209,4,7,4481,0,0,1,
+8209,5,8202,12,0,0,0,1,
+8209,6,7,62,2959,4046,0,0,1,
+8219,1,8217,1,
+8219,2,2,8213,1,
+8219,3,8217,9,0,1,
+8219,4,2,4992,4,0,1,
+8219,5,8217,8,0,0,0,1,
+8219,6,2,5939,3375,1851,1,0,1,
+8221,1,8219,1,
+8221,2,2,8220,1,
+8221,3,8219,5,0,1,
+8221,4,2,7152,7,0,1,
+8221,5,8219,3,0,0,0,1,
+8221,6,2,6791,7026,7234,1,0,1,
+8231,1,8220,1,
+8231,2,11,8230,1,
+8231,3,8220,2,0,1,
+8231,4,11,7131,2,0,1,
+8231,5,8220,2,0,0,0,1,
+8231,6,11,3070,2212,4203,1,0,1,
+8233,1,8223,1,
+8233,2,10,8228,1,
+8233,3,8223,3,0,1,
+8233,4,10,6061,10,0,1,
+8233,5,8223,6,0,0,0,1,
+8233,6,10,4744,7612,6108,0,0,1,
+8237,1,8235,1,
+8237,2,2,8225,1,
+8237,3,8235,5,0,1,
+8237,4,2,4806,4,0,1,
+8237,5,8235,11,0,0,0,1,
+8237,6,2,6543,4317,5886,1,0,1,
+8243,1,8241,1,
+8243,2,2,8239,1,
+8243,3,8241,3,0,1,
+8243,4,2,5696,8,0,1,
+8243,5,8241,4,0,0,0,1,
+8243,6,2,4507,2514,2990,1,0,1,
+8263,1,8260,1,
+8263,2,3,8262,1,
+8263,3,8260,11,0,1,
+8263,4,3,7377,2,0,1,
+8263,5,8260,4,0,0,0,1,
+8263,6,3,454,2810,8004,0,0,1,
+8269,1,8267,1,
+8269,2,2,8265,1,
+8269,3,8267,4,0,1,
+8269,4,2,5697,6,0,1,
+8269,5,8267,2,0,0,0,1,
+8269,6,2,4559,6757,4287,0,0,1,
+8273,1,8270,1,
+8273,2,3,8266,1,
+8273,3,8270,1,0,1,
+8273,4,3,4860,2,0,1,
+8273,5,8270,3,0,0,0,1,
+8273,6,3,2399,6059,806,1,0,1,
+8287,1,8284,1,
+8287,2,3,8282,1,
+8287,3,8284,1,0,1,
+8287,4,3,4792,6,0,1,
+8287,5,8284,5,0,0,0,1,
+8287,6,3,1330,3839,5431,0,0,1,
+8291,1,8289,1,
+8291,2,2,8287,1,
+8291,3,8289,3,0,1,
+8291,4,2,6693,7,0,1,
+8291,5,8289,6,0,0,0,1,
+8291,6,2,1582,4825,2325,1,0,1,
+8293,1,8291,1,
+8293,2,2,8292,1,
+8293,3,8291,6,0,1,
+8293,4,2,8005,3,0,1,
+8293,5,8291,2,0,0,0,1,
+8293,6,2,6472,7110,7311,0,0,1,
+8297,1,8294,1,
+8297,2,3,8286,1,
+8297,3,8294,6,0,1,
+8297,4,3,7646,5,0,1,
+8297,5,8294,4,0,0,0,1,
+8297,6,3,6022,1160,4149,1,0,1,
+8311,1,8308,1,
+8311,2,3,8310,1,
+8311,3,8308,3,0,1,
+8311,4,3,5431,3,0,1,
+8311,5,8308,8,0,0,0,1,
+8311,6,3,7511,2038,1522,0,0,1,
+8317,1,8311,1,
+8317,2,6,8316,1,
+8317,3,8311,3,0,1,
+8317,4,6,7793,6,0,1,
+8317,5,8311,3,0,0,0,1,
+8317,6,6,2429,2524,6808,0,0,1,
+8329,1,8322,1,
+8329,2,7,8322,1,
+8329,3,8322,8,0,1,
+8329,4,7,6997,0,0,1,
+8329,5,8322,2,0,0,0,1,
+8329,6,7,7712,2699,2870,0,0,1,
+8353,1,8348,1,
+8353,2,5,8352,1,
+8353,3,8348,1,0,1,
+8353,4,5,7054,6,0,1,
+8353,5,8348,8,0,0,0,1,
+8353,6,5,6800,8204,4239,0,0,1,
+8363,1,8361,1,
+8363,2,2,8362,1,
+8363,3,8361,2,0,1,
+8363,4,2,8356,8,0,1,
+8363,5,8361,4,0,0,0,1,
+8363,6,2,3927,7299,6690,1,0,1,
+8369,1,8366,1,
+8369,2,3,8363,1,
+8369,3,8366,1,0,1,
+8369,4,3,8357,0,0,1,
+8369,5,8366,9,0,0,0,1,
+8369,6,3,5099,1511,5994,1,0,1,
+8377,1,8372,1,
+8377,2,5,8374,1,
+8377,3,8372,6,0,1,
+8377,4,5,6188,10,0,1,
+8377,5,8372,5,0,0,0,1,
+8377,6,5,2821,1440,6678,0,0,1,
+8387,1,8385,1,
+8387,2,2,8382,1,
+8387,3,8385,9,0,1,
+8387,4,2,4315,0,0,1,
+8387,5,8385,8,0,0,0,1,
+8387,6,2,1580,511,3244,2,0,1,
+8389,1,8383,1,
+8389,2,6,8388,1,
+8389,3,8383,2,0,1,
+8389,4,6,5414,11,0,1,
+8389,5,8383,4,0,0,0,1,
+8389,6,6,6479,3184,5219,0,0,1,
+8419,1,8416,1,
+8419,2,3,8414,1,
+8419,3,8416,5,0,1,
+8419,4,3,6238,3,0,1,
+8419,5,8416,8,0,0,0,1,
+8419,6,3,6064,6754,5573,0,0,1,
+8423,1,8418,1,
+8423,2,5,8421,1,
+8423,3,8418,6,0,1,
+8423,4,5,8411,11,0,1,
+8423,5,8418,8,0,0,0,1,
+8423,6,5,5929,1937,64,1,0,1,
+8429,1,8427,1,
+8429,2,2,8425,1,
+8429,3,8427,2,0,1,
+8429,4,2,8111,7,0,1,
+8429,5,8427,2,0,0,0,1,
+8429,6,2,2003,5123,5355,2,0,1,
+8431,1,8428,1,
+8431,2,3,8429,1,
+8431,3,8428,4,0,1,
+8431,4,3,4337,3,0,1,
+8431,5,8428,1,0,0,0,1,
+8431,6,3,7241,2827,8415,1,0,1,
+8443,1,8441,1,
+8443,2,2,8439,1,
+8443,3,8441,6,0,1,
+8443,4,2,4731,8,0,1,
+8443,5,8441,7,0,0,0,1,
+8443,6,2,8431,8425,8439,0,0,1,
+8447,1,8442,1,
+8447,2,5,8445,1,
+8447,3,8442,6,0,1,
+8447,4,5,4690,9,0,1,
+8447,5,8442,3,0,0,0,1,
+8447,6,5,8257,6076,6828,1,0,1,
+8461,1,8455,1,
+8461,2,6,8460,1,
+8461,3,8455,8,0,1,
+8461,4,6,7804,7,0,1,
+8461,5,8455,2,0,0,0,1,
+8461,6,6,2963,2257,4200,1,0,1,
+8467,1,8465,1,
+8467,2,2,8463,1,
+8467,3,8465,4,0,1,
+8467,4,2,5912,8,0,1,
+8467,5,8465,2,0,0,0,1,
+8467,6,2,2283,7061,7008,0,0,1,
+8501,1,8494,1,
+8501,2,7,8500,1,
+8501,3,8494,1,0,1,
+8501,4,7,6003,11,0,1,
+8501,5,8494,10,0,0,0,1,
+8501,6,7,7679,7644,1322,3,0,1,
+8513,1,8508,1,
+8513,2,5,8502,1,
+8513,3,8508,6,0,1,
+8513,4,5,5492,6,0,1,
+8513,5,8508,1,0,0,0,1,
+8513,6,5,1458,7531,85,1,0,1,
+8521,1,8508,1,
+8521,2,13,8518,1,
+8521,3,8508,1,0,1,
+8521,4,13,5088,25,0,1,
+8521,5,8508,1,0,0,0,1,
+8521,6,13,3817,5411,7988,0,0,1,
+8527,1,8522,1,
+8527,2,5,8526,1,
+8527,3,8522,1,0,1,
+8527,4,5,8207,5,0,1,
+8527,5,8522,1,0,0,0,1,
+8527,6,5,1927,2709,2231,2,0,1,
+8537,1,8534,1,
+8537,2,3,8531,1,
+8537,3,8534,1,0,1,
+8537,4,3,7792,1,0,1,
+8537,5,8534,22,0,0,0,1,
+8537,6,3,5831,2444,2380,1,0,1,
+8539,1,8537,1,
+8539,2,2,8538,1,
+8539,3,8537,4,0,1,
+8539,4,2,7075,2,0,1,
+8539,5,8537,2,0,0,0,1,
+8539,6,2,6655,6418,7175,0,0,1,
+8543,1,8538,1,
+8543,2,5,8541,1,
+8543,3,8538,1,0,1,
+8543,4,5,5021,5,0,1,
+8543,5,8538,5,0,0,0,1,
+8543,6,5,2782,5208,1478,2,0,1,
+8563,1,8561,1,
+8563,2,2,8559,1,
+8563,3,8561,5,0,1,
+8563,4,2,5843,8,0,1,
+8563,5,8561,4,0,0,0,1,
+8563,6,2,8102,7430,8481,0,0,1,
+8573,1,8571,1,
+8573,2,2,8569,1,
+8573,3,8571,2,0,1,
+8573,4,2,6305,1,0,1,
+8573,5,8571,3,0,0,0,1,
+8573,6,2,7706,6841,3192,1,0,1,
+8581,1,8575,1,
+8581,2,6,8577,1,
+8581,3,8575,6,0,1,
+8581,4,6,7245,10,0,1,
+8581,5,8575,2,0,0,0,1,
+8581,6,6,5084,7059,1532,1,0,1,
+8597,1,8595,1,
+8597,2,2,8593,1,
+8597,3,8595,3,0,1,
+8597,4,2,7922,6,0,1,
+8597,5,8595,4,0,0,0,1,
+8597,6,2,6709,5455,4088,2,0,1,
+8599,1,8596,1,
+8599,2,3,8598,1,
+8599,3,8596,5,0,1,
+8599,4,3,7681,3,0,1,
+8599,5,8596,8,0,0,0,1,
+8599,6,3,4637,4756,4240,0,0,1,
+8609,1,8606,1,
+8609,2,3,8608,1,
+8609,3,8606,7,0,1,
+8609,4,3,6308,7,0,1,
+8609,5,8606,11,0,0,0,1,
+8609,6,3,4751,1907,1867,2,0,1,
+8623,1,8620,1,
+8623,2,3,8622,1,
+8623,3,8620,10,0,1,
+8623,4,3,8007,5,0,1,
+8623,5,8620,1,0,0,0,1,
+8623,6,3,2263,4793,8507,0,0,1,
+8627,1,8625,1,
+8627,2,2,8626,1,
+8627,3,8625,2,0,1,
+8627,4,2,6369,2,0,1,
+8627,5,8625,7,0,0,0,1,
+8627,6,2,6559,3726,6628,1,0,1,
+8629,1,8623,1,
+8629,2,6,8621,1,
+8629,3,8623,8,0,1,
+8629,4,6,8257,0,0,1,
+8629,5,8623,6,0,0,0,1,
+8629,6,6,8607,8139,6917,2,0,1,
+8641,1,8624,1,
+8641,2,17,8634,1,
+8641,3,8624,3,0,1,
+8641,4,17,8622,26,0,1,
+8641,5,8624,8,0,0,0,1,
+8641,6,17,811,5137,8132,0,0,1,
+8647,1,8644,1,
+8647,2,3,8645,1,
+8647,3,8644,1,0,1,
+8647,4,3,8461,3,0,1,
+8647,5,8644,6,0,0,0,1,
+8647,6,3,5759,720,3543,0,0,1,
+8663,1,8658,1,
+8663,2,5,8662,1,
+8663,3,8658,3,0,1,
+8663,4,5,6897,5,0,1,
+8663,5,8658,5,0,0,0,1,
+8663,6,5,5105,6101,4990,2,0,1,
+8669,1,8667,1,
+8669,2,2,8665,1,
+8669,3,8667,3,0,1,
+8669,4,2,6162,1,0,1,
+8669,5,8667,3,0,0,0,1,
+8669,6,2,5286,1956,5119,1,0,1,
+8677,1,8675,1,
+8677,2,2,8673,1,
+8677,3,8675,6,0,1,
+8677,4,2,7175,6,0,1,
+8677,5,8675,5,0,0,0,1,
+8677,6,2,8665,8659,8673,0,0,1,
+8681,1,8666,1,
+8681,2,15,8680,1,
+8681,3,8666,3,0,1,
+8681,4,15,5574,4,0,1,
+8681,5,8666,4,0,0,0,1,
+8681,6,15,4442,6034,7487,2,0,1,
+8689,1,8676,1,
+8689,2,13,8686,1,
+8689,3,8676,9,0,1,
+8689,4,13,8553,29,0,1,
+8689,5,8676,1,0,0,0,1,
+8689,6,13,5398,120,8133,0,0,1,
+8693,1,8691,1,
+8693,2,2,8688,1,
+8693,3,8691,2,0,1,
+8693,4,2,5646,0,0,1,
+8693,5,8691,5,0,0,0,1,
+8693,6,2,8213,3798,8606,3,0,1,
+8699,1,8697,1,
+8699,2,2,8694,1,
+8699,3,8697,3,0,1,
+8699,4,2,6822,3,0,1,
+8699,5,8697,11,0,0,0,1,
+8699,6,2,3504,7003,4612,1,0,1,
+8707,1,8702,1,
+8707,2,5,8705,1,
+8707,3,8702,1,0,1,
+8707,4,5,8703,3,0,1,
+8707,5,8702,2,0,0,0,1,
+8707,6,5,3691,3786,6104,0,0,1,
+8713,1,8708,1,
+8713,2,5,8708,1,
+8713,3,8708,1,0,1,
+8713,4,5,8053,15,0,1,
+8713,5,8708,1,0,0,0,1,
+8713,6,5,5244,6551,7568,3,0,1,
+8719,1,8716,1,
+8719,2,3,8717,1,
+8719,3,8716,1,0,1,
+8719,4,3,7179,6,0,1,
+8719,5,8716,3,0,0,0,1,
+8719,6,3,8369,6247,8216,0,0,1,
+8731,1,8729,1,
+8731,2,2,8727,1,
+8731,3,8729,2,0,1,
+8731,4,2,6427,8,0,1,
+8731,5,8729,3,0,0,0,1,
+8731,6,2,6142,4660,815,3,0,1,
+8737,1,8732,1,
+8737,2,5,8732,1,
+8737,3,8732,5,0,1,
+8737,4,5,6826,34,0,1,
+8737,5,8732,5,0,0,0,1,
+8737,6,5,2847,8068,6560,0,0,1,
+8741,1,8739,1,
+8741,2,2,8737,1,
+8741,3,8739,3,0,1,
+8741,4,2,5400,1,0,1,
+8741,5,8739,7,0,0,0,1,
+8741,6,2,7582,7150,7172,1,0,1,
+8747,1,8745,1,
+8747,2,2,8743,1,
+8747,3,8745,3,0,1,
+8747,4,2,6301,8,0,1,
+8747,5,8745,8,0,0,0,1,
+8747,6,2,3019,1296,1216,1,0,1,
+8753,1,8750,1,
+8753,2,3,8744,1,
+8753,3,8750,4,0,1,
+8753,4,3,5995,6,0,1,
+8753,5,8750,4,0,0,0,1,
+8753,6,3,3660,1441,4276,2,0,1,
+8761,1,8738,1,
+8761,2,23,8758,1,
+8761,3,8738,10,0,1,
+8761,4,23,5114,20,0,1,
+8761,5,8738,8,0,0,0,1,
+8761,6,23,7319,3611,1537,1,0,1,
+8779,1,8768,1,
+8779,2,11,8778,1,
+8779,3,8768,3,0,1,
+8779,4,11,7274,2,0,1,
+8779,5,8768,1,0,0,0,1,
+8779,6,11,7050,2306,4786,1,0,1,
+8783,1,8778,1,
+8783,2,5,8781,1,
+8783,3,8778,6,0,1,
+8783,4,5,7117,10,0,1,
+8783,5,8778,23,0,0,0,1,
+8783,6,5,3955,5862,8316,1,0,1,
+8803,1,8801,1,
+8803,2,2,8799,1,
+8803,3,8801,6,0,1,
+8803,4,2,6724,8,0,1,
+8803,5,8801,2,0,0,0,1,
+8803,6,2,8791,8785,8799,0,0,1,
+8807,1,8802,1,
+8807,2,5,8805,1,
+8807,3,8802,5,0,1,
+8807,4,5,4665,10,0,1,
+8807,5,8802,2,0,0,0,1,
+8807,6,5,1200,2306,7401,2,0,1,
+8819,1,8817,1,
+8819,2,2,8818,1,
+8819,3,8817,3,0,1,
+8819,4,2,6655,2,0,1,
+8819,5,8817,5,0,0,0,1,
+8819,6,2,2915,3630,3811,2,0,1,
+8821,1,8819,1,
+8821,2,2,8817,1,
+8821,3,8819,2,0,1,
+8821,4,2,6971,10,0,1,
+8821,5,8819,3,0,0,0,1,
+8821,6,2,6300,1857,297,0,0,1,
+8831,1,8824,1,
+8831,2,7,8830,1,
+8831,3,8824,1,0,1,
+8831,4,7,8822,4,0,1,
+8831,5,8824,5,0,0,0,1,
+8831,6,7,3580,2624,6291,1,0,1,
+8837,1,8835,1,
+8837,2,2,8833,1,
+8837,3,8835,3,0,1,
+8837,4,2,7250,1,0,1,
+8837,5,8835,7,0,0,0,1,
+8837,6,2,6956,8689,2566,2,0,1,
+8839,1,8836,1,
+8839,2,3,8837,1,
+8839,3,8836,1,0,1,
+8839,4,3,4544,6,0,1,
+8839,5,8836,11,0,0,0,1,
+8839,6,3,2176,397,8457,0,0,1,
+8849,1,8846,1,
+8849,2,3,8843,1,
+8849,3,8846,5,0,1,
+8849,4,3,8837,0,0,1,
+8849,5,8846,8,0,0,0,1,
+8849,6,3,365,3317,2590,1,0,1,
+8861,1,8859,1,
+8861,2,2,8852,1,
+8861,3,8859,4,0,1,
+8861,4,2,4774,1,0,1,
+8861,5,8859,2,0,0,0,1,
+8861,6,2,6360,3414,6144,2,0,1,
+8863,1,8860,1,
+8863,2,3,8862,1,
+8863,3,8860,1,0,1,
+8863,4,3,8306,5,0,1,
+8863,5,8860,15,0,0,0,1,
+8863,6,3,6194,2869,6513,0,0,1,
+8867,1,8865,1,
+8867,2,2,8866,1,
+8867,3,8865,5,0,1,
+8867,4,2,5451,13,0,1,
+8867,5,8865,4,0,0,0,1,
+8867,6,2,6602,2630,2828,2,0,1,
+8887,1,8884,1,
+8887,2,3,8886,1,
+8887,3,8884,1,0,1,
+8887,4,3,7808,5,0,1,
+8887,5,8884,3,0,0,0,1,
+8887,6,3,3843,8137,8361,1,0,1,
+8893,1,8888,1,
+8893,2,5,8888,1,
+8893,3,8888,6,0,1,
+8893,4,5,6168,11,0,1,
+8893,5,8888,13,0,0,0,1,
+8893,6,5,2650,334,8386,0,0,1,
+8923,1,8921,1,
+8923,2,2,8922,1,
+8923,3,8921,2,0,1,
+8923,4,2,8144,12,0,1,
+8923,5,8921,2,0,0,0,1,
+8923,6,2,3743,1143,5020,2,0,1,
+8929,1,8918,1,
+8929,2,11,8924,1,
+8929,3,8918,2,0,1,
+8929,4,11,7151,27,0,1,
+8929,5,8918,1,0,0,0,1,
+8929,6,11,595,4416,6678,0,0,1,
+8933,1,8931,1,
+8933,2,2,8929,1,
+8933,3,8931,3,0,1,
+8933,4,2,5194,7,0,1,
+8933,5,8931,4,0,0,0,1,
+8933,6,2,4122,4036,7280,1,0,1,
+8941,1,8935,1,
+8941,2,6,8940,1,
+8941,3,8935,6,0,1,
+8941,4,6,6891,11,0,1,
+8941,5,8935,6,0,0,0,1,
+8941,6,6,1810,8744,7820,0,0,1,
+8951,1,8938,1,
+8951,2,13,8946,1,
+8951,3,8938,5,0,1,
+8951,4,13,5765,11,0,1,
+8951,5,8938,1,0,0,0,1,
+8951,6,13,8329,7274,6547,3,0,1,
+8963,1,8961,1,
+8963,2,2,8962,1,
+8963,3,8961,2,0,1,
+8963,4,2,4564,13,0,1,
+8963,5,8961,7,0,0,0,1,
+8963,6,2,4734,1878,3128,1,0,1,
+8969,1,8966,1,
+8969,2,3,8957,1,
+8969,3,8966,5,0,1,
+8969,4,3,8121,0,0,1,
+8969,5,8966,4,0,0,0,1,
+8969,6,3,7099,1084,5646,2,0,1,
+8971,1,8969,1,
+8971,2,2,8967,1,
+8971,3,8969,2,0,1,
+8971,4,2,8043,8,0,1,
+8971,5,8969,6,0,0,0,1,
+8971,6,2,4491,1899,493,0,0,1,
+8999,1,8992,1,
+8999,2,7,8997,1,
+8999,3,8992,9,0,1,
+8999,4,7,8544,4,0,1,
+8999,5,8992,3,0,0,0,1,
+8999,6,7,8803,8232,6050,5,0,1,
+9001,1,8994,1,
+9001,2,7,8998,1,
+9001,3,8994,3,0,1,
+9001,4,7,5064,16,0,1,
+9001,5,8994,4,0,0,0,1,
+9001,6,7,8167,7414,7543,0,0,1,
+9007,1,9004,1,
+9007,2,3,9005,1,
+9007,3,9004,5,0,1,
+9007,4,3,9003,4,0,1,
+9007,5,9004,6,0,0,0,1,
+9007,6,3,4954,800,6000,1,0,1,
+9011,1,9009,1,
+9011,2,2,9005,1,
+9011,3,9009,2,0,1,
+9011,4,2,8821,4,0,1,
+9011,5,9009,4,0,0,0,1,
+9011,6,2,649,2187,8646,1,0,1,
+9013,1,9008,1,
+9013,2,5,9008,1,
+9013,3,9008,2,0,1,
+9013,4,5,5925,7,0,1,
+9013,5,9008,19,0,0,0,1,
+9013,6,5,8822,5809,6555,0,0,1,
+9029,1,9027,1,
+9029,2,2,9028,1,
+9029,3,9027,3,0,1,
+9029,4,2,5776,4,0,1,
+9029,5,9027,4,0,0,0,1,
+9029,6,2,7194,1991,4979,2,0,1,
+9041,1,9038,1,
+9041,2,3,9040,1,
+9041,3,9038,3,0,1,
+9041,4,3,8772,4,0,1,
+9041,5,9038,9,0,0,0,1,
+9041,6,3,6171,2124,889,1,0,1,
+9043,1,9040,1,
+9043,2,3,9038,1,
+9043,3,9040,1,0,1,
+9043,4,3,7495,12,0,1,
+9043,5,9040,13,0,0,0,1,
+9043,6,3,1849,8353,8638,0,0,1,
+9049,1,9042,1,
+9049,2,7,9042,1,
+9049,3,9042,2,0,1,
+9049,4,7,5725,0,0,1,
+9049,5,9042,4,0,0,0,1,
+9049,6,7,4624,3105,2186,0,0,1,
+9059,1,9057,1,
+9059,2,2,9055,1,
+9059,3,9057,2,0,1,
+9059,4,2,4811,7,0,1,
+9059,5,9057,5,0,0,0,1,
+9059,6,2,1482,2453,1579,2,0,1,
+9067,1,9064,1,
+9067,2,3,9062,1,
+9067,3,9064,10,0,1,
+9067,4,3,6260,3,0,1,
+9067,5,9064,3,0,0,0,1,
+9067,6,3,6562,6836,6692,0,0,1,
+9091,1,9088,1,
+9091,2,3,9080,1,
+9091,3,9088,3,0,1,
+9091,4,3,7453,0,0,1,
+9091,5,9088,1,0,0,0,1,
+9091,6,3,5472,6337,1877,0,0,1,
+9103,1,9097,1,
+9103,2,6,9100,1,
+9103,3,9097,6,0,1,
+9103,4,6,5578,5,0,1,
+9103,5,9097,2,0,0,0,1,
+9103,6,6,1096,3322,4647,0,0,1,
+9109,1,9099,1,
+9109,2,10,9106,1,
+9109,3,9099,6,0,1,
+9109,4,10,4902,5,0,1,
+9109,5,9099,11,0,0,0,1,
+9109,6,10,3208,1962,6330,0,0,1,
+9127,1,9124,1,
+9127,2,3,9126,1,
+9127,3,9124,1,0,1,
+9127,4,3,5302,5,0,1,
+9127,5,9124,4,0,0,0,1,
+9127,6,3,702,4646,7426,0,0,1,
+9133,1,9127,1,
+9133,2,6,9131,1,
+9133,3,9127,3,0,1,
+9133,4,6,6574,8,0,1,
+9133,5,9127,12,0,0,0,1,
+9133,6,6,1196,3312,2556,0,0,1,
+9137,1,9134,1,
+9137,2,3,9136,1,
+9137,3,9134,4,0,1,
+9137,4,3,5911,4,0,1,
+9137,5,9134,1,0,0,0,1,
+9137,6,3,5560,3193,7286,1,0,1,
+9151,1,9148,1,
+9151,2,3,9150,1,
+9151,3,9148,3,0,1,
+9151,4,3,8204,2,0,1,
+9151,5,9148,6,0,0,0,1,
+9151,6,3,3429,6655,5977,0,0,1,
+9157,1,9151,1,
+9157,2,6,9155,1,
+9157,3,9151,3,0,1,
+9157,4,6,6299,8,0,1,
+9157,5,9151,6,0,0,0,1,
+9157,6,6,110,1682,5647,0,0,1,
+9161,1,9158,1,
+9161,2,3,9155,1,
+9161,3,9158,12,0,1,
+9161,4,3,9149,0,0,1,
+9161,5,9158,3,0,0,0,1,
+9161,6,3,6453,200,1330,2,0,1,
+9173,1,9171,1,
+9173,2,2,9172,1,
+9173,3,9171,2,0,1,
+9173,4,2,7906,3,0,1,
+9173,5,9171,5,0,0,0,1,
+9173,6,2,2784,3937,4880,2,0,1,
+9181,1,9179,1,
+9181,2,2,9177,1,
+9181,3,9179,6,0,1,
+9181,4,2,8076,10,0,1,
+9181,5,9179,2,0,0,0,1,
+9181,6,2,9169,9163,9177,0,0,1,
+9187,1,9184,1,
+9187,2,3,9186,1,
+9187,3,9184,9,0,1,
+9187,4,3,5702,2,0,1,
+9187,5,9184,1,0,0,0,1,
+9187,6,3,190,1967,7141,0,0,1,
+9199,1,9196,1,
+9199,2,3,9197,1,
+9199,3,9196,1,0,1,
+9199,4,3,7846,3,0,1,
+9199,5,9196,4,0,0,0,1,
+9199,6,3,5822,6629,9182,0,0,1,
+9203,1,9201,1,
+9203,2,2,9202,1,
+9203,3,9201,2,0,1,
+9203,4,2,7110,4,0,1,
+9203,5,9201,7,0,0,0,1,
+9203,6,2,5524,643,8945,1,0,1,
+9209,1,9206,1,
+9209,2,3,9208,1,
+9209,3,9206,7,0,1,
+9209,4,3,7273,4,0,1,
+9209,5,9206,7,0,0,0,1,
+9209,6,3,6289,1969,4074,1,0,1,
+9221,1,9219,1,
+9221,2,2,9216,1,
+9221,3,9219,7,0,1,
+9221,4,2,7422,15,0,1,
+9221,5,9219,9,0,0,0,1,
+9221,6,2,910,722,2441,2,0,1,
+9227,1,9225,1,
+9227,2,2,9223,1,
+9227,3,9225,3,0,1,
+9227,4,2,6443,7,0,1,
+9227,5,9225,2,0,0,0,1,
+9227,6,2,9082,3243,6820,1,0,1,
+9239,1,9220,1,
+9239,2,19,9234,1,
+9239,3,9220,7,0,1,
+9239,4,19,8312,7,0,1,
+9239,5,9220,12,0,0,0,1,
+9239,6,19,1407,6785,7285,2,0,1,
+9241,1,9228,1,
+9241,2,13,9240,1,
+9241,3,9228,4,0,1,
+9241,4,13,4914,14,0,1,
+9241,5,9228,4,0,0,0,1,
+9241,6,13,7794,4004,1012,0,0,1,
+9257,1,9254,1,
+9257,2,3,9256,1,
+9257,3,9254,1,0,1,
+9257,4,3,7434,7,0,1,
+9257,5,9254,3,0,0,0,1,
+9257,6,3,5278,4027,1045,2,0,1,
+9277,1,9272,1,
+9277,2,5,9272,1,
+9277,3,9272,5,0,1,
+9277,4,5,5440,11,0,1,
+9277,5,9272,8,0,0,0,1,
+9277,6,5,4880,1596,7970,0,0,1,
+9281,1,9278,1,
+9281,2,3,9275,1,
+9281,3,9278,5,0,1,
+9281,4,3,9269,0,0,1,
+9281,5,9278,1,0,0,0,1,
+9281,6,3,8133,1833,5545,1,0,1,
+9283,1,9281,1,
+9283,2,2,9279,1,
+9283,3,9281,6,0,1,
+9283,4,2,8339,8,0,1,
+9283,5,9281,3,0,0,0,1,
+9283,6,2,9271,9265,9279,0,0,1,
+9293,1,9291,1,
+9293,2,2,9289,1,
+9293,3,9291,3,0,1,
+9293,4,2,7365,6,0,1,
+9293,5,9291,12,0,0,0,1,
+9293,6,2,749,6168,4056,1,0,1,
+9311,1,9304,1,
+9311,2,7,9309,1,
+9311,3,9304,1,0,1,
+9311,4,7,6729,4,0,1,
+9311,5,9304,4,0,0,0,1,
+9311,6,7,4113,1876,1736,1,0,1,
+9319,1,9316,1,
+9319,2,3,9317,1,
+9319,3,9316,4,0,1,
+9319,4,3,9315,4,0,1,
+9319,5,9316,1,0,0,0,1,
+9319,6,3,6313,8883,8118,0,0,1,
+9323,1,9321,1,
+9323,2,2,9322,1,
+9323,3,9321,2,0,1,
+9323,4,2,9316,8,0,1,
+9323,5,9321,11,0,0,0,1,
+9323,6,2,6343,5860,726,2,0,1,
+9337,1,9332,1,
+9337,2,5,9336,1,
+9337,3,9332,3,0,1,
+9337,4,5,7142,8,0,1,
+9337,5,9332,17,0,0,0,1,
+9337,6,5,5575,6468,244,2,0,1,
+9341,1,9339,1,
+9341,2,2,9340,1,
+9341,3,9339,3,0,1,
+9341,4,2,6817,3,0,1,
+9341,5,9339,4,0,0,0,1,
+9341,6,2,2514,6633,7176,2,0,1,
+9343,1,9338,1,
+9343,2,5,9342,1,
+9343,3,9338,2,0,1,
+9343,4,5,6592,10,0,1,
+9343,5,9338,7,0,0,0,1,
+9343,6,5,2315,2343,6295,3,0,1,
+9349,1,9347,1,
+9349,2,2,9341,1,
+9349,3,9347,2,0,1,
+9349,4,2,5840,0,0,1,
+9349,5,9347,3,0,0,0,1,
+9349,6,2,8492,2492,7008,0,0,1,
+9371,1,9369,1,
+9371,2,2,9370,1,
+9371,3,9369,4,0,1,
+9371,4,2,5834,13,0,1,
+9371,5,9369,2,0,0,0,1,
+9371,6,2,6635,7764,3855,1,0,1,
+9377,1,9374,1,
+9377,2,3,9368,1,
+9377,3,9374,10,0,1,
+9377,4,3,5819,3,0,1,
+9377,5,9374,12,0,0,0,1,
+9377,6,3,3121,5127,2868,1,0,1,
+9391,1,9388,1,
+9391,2,3,9390,1,
+9391,3,9388,6,0,1,
+9391,4,3,6807,6,0,1,
+9391,5,9388,7,0,0,0,1,
+9391,6,3,1863,2392,5521,0,0,1,
+9397,1,9395,1,
+9397,2,2,9396,1,
+9397,3,9395,6,0,1,
+9397,4,2,7969,6,0,1,
+9397,5,9395,9,0,0,0,1,
+9397,6,2,5616,6531,5832,0,0,1,
+9403,1,9400,1,
+9403,2,3,9396,1,
+9403,3,9400,1,0,1,
+9403,4,3,9129,11,0,1,
+9403,5,9400,5,0,0,0,1,
+9403,6,3,5255,7055,4230,1,0,1,
+9413,1,9410,1,
+9413,2,3,9412,1,
+9413,3,9410,4,0,1,
+9413,4,3,5447,4,0,1,
+9413,5,9410,5,0,0,0,1,
+9413,6,3,8993,8167,4942,4,0,1,
+9419,1,9417,1,
+9419,2,2,9413,1,
+9419,3,9417,9,0,1,
+9419,4,2,6628,0,0,1,
+9419,5,9417,3,0,0,0,1,
+9419,6,2,7744,1647,8231,1,0,1,
+9421,1,9419,1,
+9421,2,2,9420,1,
+9421,3,9419,6,0,1,
+9421,4,2,8855,7,0,1,
+9421,5,9419,2,0,0,0,1,
+9421,6,2,4585,2484,1701,0,0,1,
+9431,1,9424,1,
+9431,2,7,9430,1,
+9431,3,9424,3,0,1,
+9431,4,7,6132,2,0,1,
+9431,5,9424,5,0,0,0,1,
+9431,6,7,2701,1680,8388,1,0,1,
+9433,1,9428,1,
+9433,2,5,9430,1,
+9433,3,9428,9,0,1,
+9433,4,5,9422,14,0,1,
+9433,5,9428,5,0,0,0,1,
+9433,6,5,8892,1778,9190,0,0,1,
+9437,1,9435,1,
+9437,2,2,9428,1,
+9437,3,9435,4,0,1,
+9437,4,2,6215,1,0,1,
+9437,5,9435,4,0,0,0,1,
+9437,6,2,2779,7855,3741,1,0,1,
+9439,1,9417,1,
+9439,2,22,9438,1,
+9439,3,9417,2,0,1,
+9439,4,22,8780,2,0,1,
+9439,5,9417,3,0,0,0,1,
+9439,6,22,8565,5999,6390,0,0,1,
+9461,1,9458,1,
+9461,2,3,9459,1,
+9461,3,9458,12,0,1,
+9461,4,3,7151,14,0,1,
+9461,5,9458,6,0,0,0,1,
+9461,6,3,1197,6380,4176,1,0,1,
+9463,1,9460,1,
+9463,2,3,9461,1,
+9463,3,9460,4,0,1,
+9463,4,3,9459,4,0,1,
+9463,5,9460,1,0,0,0,1,
+9463,6,3,5543,5930,5856,0,0,1,
+9467,1,9465,1,
+9467,2,2,9466,1,
+9467,3,9465,2,0,1,
+9467,4,2,6384,4,0,1,
+9467,5,9465,2,0,0,0,1,
+9467,6,2,1881,6205,5578,1,0,1,
+9473,1,9470,1,
+9473,2,3,9467,1,
+9473,3,9470,1,0,1,
+9473,4,3,5129,1,0,1,
+9473,5,9470,19,0,0,0,1,
+9473,6,3,1935,6654,995,2,0,1,
+9479,1,9472,1,
+9479,2,7,9472,1,
+9479,3,9472,2,0,1,
+9479,4,7,6365,8,0,1,
+9479,5,9472,2,0,0,0,1,
+9479,6,7,7469,8721,3242,3,0,1,
+9491,1,9489,1,
+9491,2,2,9476,1,
+9491,3,9489,5,0,1,
+9491,4,2,5083,4,0,1,
+9491,5,9489,6,0,0,0,1,
+9491,6,2,270,5031,8755,3,0,1,
+9497,1,9494,1,
+9497,2,3,9491,1,
+9497,3,9494,3,0,1,
+9497,4,3,6593,11,0,1,
+9497,5,9494,6,0,0,0,1,
+9497,6,3,6345,5362,863,1,0,1,
+9511,1,9508,1,
+9511,2,3,9510,1,
+9511,3,9508,4,0,1,
+9511,4,3,9373,3,0,1,
+9511,5,9508,6,0,0,0,1,
+9511,6,3,6658,4480,7514,0,0,1,
+9521,1,9518,1,
+9521,2,3,9520,1,
+9521,3,9518,3,0,1,
+9521,4,3,5073,7,0,1,
+9521,5,9518,3,0,0,0,1,
+9521,6,3,4999,8694,307,2,0,1,
+9533,1,9531,1,
+9533,2,2,9529,1,
+9533,3,9531,2,0,1,
+9533,4,2,5479,1,0,1,
+9533,5,9531,2,0,0,0,1,
+9533,6,2,2635,4771,6184,5,0,1,
+9539,1,9537,1,
+9539,2,2,9538,1,
+9539,3,9537,11,0,1,
+9539,4,2,9532,8,0,1,
+9539,5,9537,2,0,0,0,1,
+9539,6,2,4451,8475,9120,1,0,1,
+9547,1,9545,1,
+9547,2,2,9546,1,
+9547,3,9545,2,0,1,
+9547,4,2,4903,10,0,1,
+9547,5,9545,6,0,0,0,1,
+9547,6,2,9537,5553,3164,0,0,1,
+9551,1,9540,1,
+9551,2,11,9550,1,
+9551,3,9540,7,0,1,
+9551,4,11,8763,4,0,1,
+9551,5,9540,8,0,0,0,1,
+9551,6,11,4846,6942,2120,1,0,1,
+9587,1,9585,1,
+9587,2,2,9583,1,
+9587,3,9585,3,0,1,
+9587,4,2,7602,8,0,1,
+9587,5,9585,15,0,0,0,1,
+9587,6,2,3461,1202,8007,4,0,1,
+9601,1,9588,1,
+9601,2,13,9598,1,
+9601,3,9588,5,0,1,
+9601,4,13,6113,42,0,1,
+9601,5,9588,15,0,0,0,1,
+9601,6,13,8072,4399,5411,0,0,1,
+9613,1,9611,1,
+9613,2,2,9606,1,
+9613,3,9611,5,0,1,
+9613,4,2,6141,5,0,1,
+9613,5,9611,6,0,0,0,1,
+9613,6,2,3952,1517,6558,0,0,1,
+9619,1,9617,1,
+9619,2,2,9615,1,
+9619,3,9617,2,0,1,
+9619,4,2,7026,8,0,1,
+9619,5,9617,3,0,0,0,1,
+9619,6,2,373,4736,8835,0,0,1,
+9623,1,9618,1,
+9623,2,5,9621,1,
+9623,3,9618,1,0,1,
+9623,4,5,7793,8,0,1,
+9623,5,9618,18,0,0,0,1,
+9623,6,5,3984,8996,5702,2,0,1,
+9629,1,9627,1,
+9629,2,2,9621,1,
+9629,3,9627,2,0,1,
+9629,4,2,6790,0,0,1,
+9629,5,9627,13,0,0,0,1,
+9629,6,2,4940,5754,6591,1,0,1,
+9631,1,9628,1,
+9631,2,3,9629,1,
+9631,3,9628,7,0,1,
+9631,4,3,5229,6,0,1,
+9631,5,9628,7,0,0,0,1,
+9631,6,3,5073,5882,7033,0,0,1,
+9643,1,9641,1,
+9643,2,2,9639,1,
+9643,3,9641,6,0,1,
+9643,4,2,5310,8,0,1,
+9643,5,9641,4,0,0,0,1,
+9643,6,2,9631,9625,9639,0,0,1,
+9649,1,9642,1,
+9649,2,7,9642,1,
+9649,3,9642,2,0,1,
+9649,4,7,5002,0,0,1,
+9649,5,9642,11,0,0,0,1,
+9649,6,7,7129,3802,1048,0,0,1,
+9661,1,9659,1,
+9661,2,2,9657,1,
+9661,3,9659,2,0,1,
+9661,4,2,9105,6,0,1,
+9661,5,9659,6,0,0,0,1,
+9661,6,2,8970,4756,665,0,0,1,
+9677,1,9675,1,
+9677,2,2,9673,1,
+9677,3,9675,3,0,1,
+9677,4,2,8915,1,0,1,
+9677,5,9675,21,0,0,0,1,
+9677,6,2,747,3816,3455,2,0,1,
+9679,1,9676,1,
+9679,2,3,9678,1,
+9679,3,9676,7,0,1,
+9679,4,3,7499,2,0,1,
+9679,5,9676,8,0,0,0,1,
+9679,6,3,90,9445,7366,0,0,1,
+9689,1,9686,1,
+9689,2,3,9683,1,
+9689,3,9686,6,0,1,
+9689,4,3,9677,0,0,1,
+9689,5,9686,4,0,0,0,1,
+9689,6,3,223,5702,6648,1,0,1,
+9697,1,9687,1,
+9697,2,10,9692,1,
+9697,3,9687,5,0,1,
+9697,4,10,6346,10,0,1,
+9697,5,9687,24,0,0,0,1,
+9697,6,10,3349,7898,2350,0,0,1,
+9719,1,9702,1,
+9719,2,17,9712,1,
+9719,3,9702,1,0,1,
+9719,4,17,5263,8,0,1,
+9719,5,9702,3,0,0,0,1,
+9719,6,17,7452,2386,9440,3,0,1,
+9721,1,9714,1,
+9721,2,7,9718,1,
+9721,3,9714,5,0,1,
+9721,4,7,9702,22,0,1,
+9721,5,9714,1,0,0,0,1,
+9721,6,7,113,1306,5624,0,0,1,
+9733,1,9731,1,
+9733,2,2,9732,1,
+9733,3,9731,2,0,1,
+9733,4,2,9726,8,0,1,
+9733,5,9731,2,0,0,0,1,
+9733,6,2,8889,7453,2254,0,0,1,
+9739,1,9736,1,
+9739,2,3,9732,1,
+9739,3,9736,8,0,1,
+9739,4,3,8326,5,0,1,
+9739,5,9736,1,0,0,0,1,
+9739,6,3,9508,7496,2435,0,0,1,
+9743,1,9738,1,
+9743,2,5,9740,1,
+9743,3,9738,8,0,1,
+9743,4,5,5224,6,0,1,
+9743,5,9738,2,0,0,0,1,
+9743,6,5,6883,8750,5105,1,0,1,
+9749,1,9747,1,
+9749,2,2,9748,1,
+9749,3,9747,5,0,1,
+9749,4,2,5546,4,0,1,
+9749,5,9747,6,0,0,0,1,
+9749,6,2,7694,5721,3734,2,0,1,
+9767,1,9762,1,
+9767,2,5,9765,1,
+9767,3,9762,2,0,1,
+9767,4,5,9763,3,0,1,
+9767,5,9762,3,0,0,0,1,
+9767,6,5,2381,5959,3257,3,0,1,
+9769,1,9756,1,
+9769,2,13,9768,1,
+9769,3,9756,9,0,1,
+9769,4,13,6230,14,0,1,
+9769,5,9756,1,0,0,0,1,
+9769,6,13,6921,632,8704,0,0,1,
+9781,1,9775,1,
+9781,2,6,9777,1,
+9781,3,9775,4,0,1,
+9781,4,6,5001,2,0,1,
+9781,5,9775,6,0,0,0,1,
+9781,6,6,9149,9684,2229,0,0,1,
+9787,1,9784,1,
+9787,2,3,9786,1,
+9787,3,9784,4,0,1,
+9787,4,3,6629,2,0,1,
+9787,5,9784,4,0,0,0,1,
+9787,6,3,5127,4555,9505,0,0,1,
+9791,1,9780,1,
+9791,2,11,9790,1,
+9791,3,9780,1,0,1,
+9791,4,11,6086,2,0,1,
+9791,5,9780,2,0,0,0,1,
+9791,6,11,2437,3419,6324,2,0,1,
+9803,1,9801,1,
+9803,2,2,9802,1,
+9803,3,9801,2,0,1,
+9803,4,2,7808,2,0,1,
+9803,5,9801,3,0,0,0,1,
+9803,6,2,1791,6435,2148,1,0,1,
+9811,1,9808,1,
+9811,2,3,9810,1,
+9811,3,9808,1,0,1,
+9811,4,3,6930,6,0,1,
+9811,5,9808,13,0,0,0,1,
+9811,6,3,7526,2384,5050,0,0,1,
+9817,1,9812,1,
+9817,2,5,9816,1,
+9817,3,9812,1,0,1,
+9817,4,5,5210,6,0,1,
+9817,5,9812,1,0,0,0,1,
+9817,6,5,1895,215,6969,0,0,1,
+9829,1,9819,1,
+9829,2,10,9825,1,
+9829,3,9819,11,0,1,
+9829,4,10,5988,2,0,1,
+9829,5,9819,3,0,0,0,1,
+9829,6,10,2581,8245,8531,0,0,1,
+9833,1,9830,1,
+9833,2,3,9824,1,
+9833,3,9830,6,0,1,
+9833,4,3,6035,12,0,1,
+9833,5,9830,5,0,0,0,1,
+9833,6,3,3223,2059,6117,1,0,1,
+9839,1,9832,1,
+9839,2,7,9838,1,
+9839,3,9832,1,0,1,
+9839,4,7,5413,2,0,1,
+9839,5,9832,1,0,0,0,1,
+9839,6,7,8207,1934,3887,1,0,1,
+9851,1,9849,1,
+9851,2,2,9845,1,
+9851,3,9849,2,0,1,
+9851,4,2,5951,4,0,1,
+9851,5,9849,7,0,0,0,1,
+9851,6,2,6021,1251,5705,2,0,1,
+9857,1,9852,1,
+9857,2,5,9856,1,
+9857,3,9852,5,0,1,
+9857,4,5,9114,4,0,1,
+9857,5,9852,10,0,0,0,1,
+9857,6,5,4495,7184,7053,2,0,1,
+9859,1,9857,1,
+9859,2,2,9855,1,
+9859,3,9857,4,0,1,
+9859,4,2,9231,1,0,1,
+9859,5,9857,3,0,0,0,1,
+9859,6,2,2796,4250,5028,0,0,1,
+9871,1,9868,1,
+9871,2,3,9869,1,
+9871,3,9868,3,0,1,
+9871,4,3,6493,3,0,1,
+9871,5,9868,3,0,0,0,1,
+9871,6,3,7230,2345,4177,1,0,1,
+9883,1,9881,1,
+9883,2,2,9882,1,
+9883,3,9881,2,0,1,
+9883,4,2,5028,11,0,1,
+9883,5,9881,12,0,0,0,1,
+9883,6,2,8787,9638,9399,0,0,1,
+9887,1,9882,1,
+9887,2,5,9882,1,
+9887,3,9882,1,0,1,
+9887,4,5,7319,6,0,1,
+9887,5,9882,3,0,0,0,1,
+9887,6,5,8678,2032,6861,1,0,1,
+9901,1,9899,1,
+9901,2,2,9900,1,
+9901,3,9899,4,0,1,
+9901,4,2,9894,8,0,1,
+9901,5,9899,2,0,0,0,1,
+9901,6,2,1748,4483,8692,1,0,1,
+9907,1,9905,1,
+9907,2,2,9903,1,
+9907,3,9905,4,0,1,
+9907,4,2,6151,8,0,1,
+9907,5,9905,9,0,0,0,1,
+9907,6,2,5230,3284,7577,0,0,1,
+9923,1,9921,1,
+9923,2,2,9918,1,
+9923,3,9921,4,0,1,
+9923,4,2,9317,0,0,1,
+9923,5,9921,6,0,0,0,1,
+9923,6,2,2269,2624,6629,1,0,1,
+9929,1,9926,1,
+9929,2,3,9928,1,
+9929,3,9926,1,0,1,
+9929,4,3,8041,4,0,1,
+9929,5,9926,3,0,0,0,1,
+9929,6,3,2171,5942,8347,1,0,1,
+9931,1,9921,1,
+9931,2,10,9928,1,
+9931,3,9921,4,0,1,
+9931,4,10,9545,4,0,1,
+9931,5,9921,2,0,0,0,1,
+9931,6,10,2316,8350,5581,2,0,1,
+9941,1,9939,1,
+9941,2,2,9937,1,
+9941,3,9939,3,0,1,
+9941,4,2,8321,7,0,1,
+9941,5,9939,2,0,0,0,1,
+9941,6,2,1291,7931,1408,2,0,1,
+9949,1,9947,1,
+9949,2,2,9945,1,
+9949,3,9947,4,0,1,
+9949,4,2,9170,10,0,1,
+9949,5,9947,5,0,0,0,1,
+9949,6,2,1443,1156,6970,0,0,1,
+9967,1,9964,1,
+9967,2,3,9965,1,
+9967,3,9964,3,0,1,
+9967,4,3,9963,4,0,1,
+9967,5,9964,4,0,0,0,1,
+9967,6,3,6881,7254,9681,0,0,1,
+9973,1,9962,1,
+9973,2,11,9969,1,
+9973,3,9962,1,0,1,
+9973,4,11,7687,2,0,1,
+9973,5,9962,8,0,0,0,1,
+9973,6,11,3928,2985,9944,0,0,1,
+10007,1,10002,1,
+10007,2,5,10005,1,
+10007,3,10002,3,0,1,
+10007,4,5,9995,11,0,1,
+10007,5,10002,3,0,0,0,1,
+10007,6,5,7978,7220,7070,1,0,1,
+10009,1,9998,1,
+10009,2,11,10005,1,
+10009,3,9998,1,0,1,
+10009,4,11,9995,11,0,1,
+10009,5,9998,1,0,0,0,1,
+10009,6,11,8706,3520,9952,1,0,1,
+10037,1,10035,1,
+10037,2,2,10033,1,
+10037,3,10035,2,0,1,
+10037,4,2,7099,1,0,1,
+10037,5,10035,3,0,0,0,1,
+10037,6,2,102,8872,6761,1,0,1,
+10039,1,10036,1,
+10039,2,3,10038,1,
+10039,3,10036,1,0,1,
+10039,4,3,6587,2,0,1,
+10039,5,10036,3,0,0,0,1,
+10039,6,3,4408,9268,8821,3,0,1,
+10061,1,10058,1,
+10061,2,3,10059,1,
+10061,3,10058,4,0,1,
+10061,4,3,10057,4,0,1,
+10061,5,10058,9,0,0,0,1,
+10061,6,3,8516,7568,6258,2,0,1,
+10067,1,10065,1,
+10067,2,2,10063,1,
+10067,3,10065,3,0,1,
+10067,4,2,7032,14,0,1,
+10067,5,10065,3,0,0,0,1,
+10067,6,2,9132,2222,7159,1,0,1,
+10069,1,10067,1,
+10069,2,2,10065,1,
+10069,3,10067,4,0,1,
+10069,4,2,8451,6,0,1,
+10069,5,10067,4,0,0,0,1,
+10069,6,2,2432,8214,5305,0,0,1,
+10079,1,10068,1,
+10079,2,11,10076,1,
+10079,3,10068,2,0,1,
+10079,4,11,5337,12,0,1,
+10079,5,10068,3,0,0,0,1,
+10079,6,11,9540,4152,9065,5,0,1,
+10091,1,10089,1,
+10091,2,2,10087,1,
+10091,3,10089,3,0,1,
+10091,4,2,6538,8,0,1,
+10091,5,10089,8,0,0,0,1,
+10091,6,2,7118,9253,3773,1,0,1,
+10093,1,10091,1,
+10093,2,2,10092,1,
+10093,3,10091,2,0,1,
+10093,4,2,5918,3,0,1,
+10093,5,10091,2,0,0,0,1,
+10093,6,2,6200,562,4293,0,0,1,
+10099,1,10097,1,
+10099,2,2,10095,1,
+10099,3,10097,6,0,1,
+10099,4,2,9440,1,0,1,
+10099,5,10097,5,0,0,0,1,
+10099,6,2,355,883,6474,0,0,1,
+10103,1,10098,1,
+10103,2,5,10102,1,
+10103,3,10098,8,0,1,
+10103,4,5,6950,4,0,1,
+10103,5,10098,1,0,0,0,1,
+10103,6,5,8645,8394,7728,1,0,1,
+10111,1,10099,1,
+10111,2,12,10109,1,
+10111,3,10099,5,0,1,
+10111,4,12,8381,3,0,1,
+10111,5,10099,4,0,0,0,1,
+10111,6,12,91,4329,5293,1,0,1,
+10133,1,10131,1,
+10133,2,2,10129,1,
+10133,3,10131,3,0,1,
+10133,4,2,5713,7,0,1,
+10133,5,10131,2,0,0,0,1,
+10133,6,2,9574,3849,8838,1,0,1,
+10139,1,10137,1,
+10139,2,2,10138,1,
+10139,3,10137,5,0,1,
+10139,4,2,10132,8,0,1,
+10139,5,10137,4,0,0,0,1,
+10139,6,2,1353,1688,2822,1,0,1,
+10141,1,10139,1,
+10141,2,2,10140,1,
+10141,3,10139,5,0,1,
+10141,4,2,8225,3,0,1,
+10141,5,10139,5,0,0,0,1,
+10141,6,2,4279,4575,8246,0,0,1,
+10151,1,10144,1,
+10151,2,7,10149,1,
+10151,3,10144,1,0,1,
+10151,4,7,7169,4,0,1,
+10151,5,10144,17,0,0,0,1,
+10151,6,7,502,5985,7872,1,0,1,
+10159,1,10156,1,
+10159,2,3,10157,1,
+10159,3,10156,1,0,1,
+10159,4,3,9468,3,0,1,
+10159,5,10156,4,0,0,0,1,
+10159,6,3,9446,9225,438,0,0,1,
+10163,1,10161,1,
+10163,2,2,10159,1,
+10163,3,10161,2,0,1,
+10163,4,2,8097,17,0,1,
+10163,5,10161,5,0,0,0,1,
+10163,6,2,2747,2058,9888,1,0,1,
+10169,1,10166,1,
+10169,2,3,10163,1,
+10169,3,10166,1,0,1,
+10169,4,3,10157,0,0,1,
+10169,5,10166,9,0,0,0,1,
+10169,6,3,9807,1773,6295,5,0,1,
+10177,1,10170,1,
+10177,2,7,10174,1,
+10177,3,10170,1,0,1,
+10177,4,7,10034,8,0,1,
+10177,5,10170,9,0,0,0,1,
+10177,6,7,8952,8195,10064,0,0,1,
+10181,1,10179,1,
+10181,2,2,10180,1,
+10181,3,10179,9,0,1,
+10181,4,2,6033,3,0,1,
+10181,5,10179,7,0,0,0,1,
+10181,6,2,3594,8153,7912,1,0,1,
+10193,1,10190,1,
+10193,2,3,10192,1,
+10193,3,10190,7,0,1,
+10193,4,3,8097,4,0,1,
+10193,5,10190,1,0,0,0,1,
+10193,6,3,3862,8561,9167,1,0,1,
+10211,1,10205,1,
+10211,2,6,10210,1,
+10211,3,10205,1,0,1,
+10211,4,6,8236,2,0,1,
+10211,5,10205,7,0,0,0,1,
+10211,6,6,7499,8739,8209,1,0,1,
+10223,1,10218,1,
+10223,2,5,10221,1,
+10223,3,10218,1,0,1,
+10223,4,5,9079,14,0,1,
+10223,5,10218,12,0,0,0,1,
+10223,6,5,7202,5227,9800,1,0,1,
+10243,1,10236,1,
+10243,2,7,10241,1,
+10243,3,10236,2,0,1,
+10243,4,7,9513,13,0,1,
+10243,5,10236,7,0,0,0,1,
+10243,6,7,5937,6838,8205,0,0,1,
+10247,1,10242,1,
+10247,2,5,10244,1,
+10247,3,10242,5,0,1,
+10247,4,5,5485,6,0,1,
+10247,5,10242,2,0,0,0,1,
+10247,6,5,5326,8735,6340,1,0,1,
+10253,1,10251,1,
+10253,2,2,10252,1,
+10253,3,10251,8,0,1,
+10253,4,2,8614,6,0,1,
+10253,5,10251,11,0,0,0,1,
+10253,6,2,2012,2852,5703,1,0,1,
+10259,1,10257,1,
+10259,2,2,10249,1,
+10259,3,10257,5,0,1,
+10259,4,2,8416,0,0,1,
+10259,5,10257,5,0,0,0,1,
+10259,6,2,1727,5263,7235,1,0,1,
+10267,1,10265,1,
+10267,2,2,10263,1,
+10267,3,10265,2,0,1,
+10267,4,2,8737,1,0,1,
+10267,5,10265,17,0,0,0,1,
+10267,6,2,3657,3099,4244,0,0,1,
+10271,1,10264,1,
+10271,2,7,10270,1,
+10271,3,10264,1,0,1,
+10271,4,7,6272,3,0,1,
+10271,5,10264,1,0,0,0,1,
+10271,6,7,9500,1943,3784,1,0,1,
+10273,1,10263,1,
+10273,2,10,10268,1,
+10273,3,10263,5,0,1,
+10273,4,10,9542,16,0,1,
+10273,5,10263,4,0,0,0,1,
+10273,6,10,2243,6345,3002,1,0,1,
+10289,1,10286,1,
+10289,2,3,10283,1,
+10289,3,10286,1,0,1,
+10289,4,3,10277,0,0,1,
+10289,5,10286,4,0,0,0,1,
+10289,6,3,8887,8083,9311,1,0,1,
+10301,1,10299,1,
+10301,2,2,10293,1,
+10301,3,10299,2,0,1,
+10301,4,2,9322,0,0,1,
+10301,5,10299,7,0,0,0,1,
+10301,6,2,1126,316,2802,2,0,1,
+10303,1,10300,1,
+10303,2,3,10302,1,
+10303,3,10300,4,0,1,
+10303,4,3,9982,2,0,1,
+10303,5,10300,6,0,0,0,1,
+10303,6,3,119,6862,2036,9,0,1,
+10313,1,10310,1,
+10313,2,3,10312,1,
+10313,3,10310,5,0,1,
+10313,4,3,5430,4,0,1,
+10313,5,10310,12,0,0,0,1,
+10313,6,3,3920,3425,5885,1,0,1,
+10321,1,10314,1,
+10321,2,7,10314,1,
+10321,3,10314,8,0,1,
+10321,4,7,5844,0,0,1,
+10321,5,10314,9,0,0,0,1,
+10321,6,7,8505,8845,7362,0,0,1,
+10331,1,10329,1,
+10331,2,2,10330,1,
+10331,3,10329,3,0,1,
+10331,4,2,8493,2,0,1,
+10331,5,10329,2,0,0,0,1,
+10331,6,2,3409,9355,5321,1,0,1,
+10333,1,10328,1,
+10333,2,5,10328,1,
+10333,3,10328,3,0,1,
+10333,4,5,6295,11,0,1,
+10333,5,10328,7,0,0,0,1,
+10333,6,5,5943,6139,5383,0,0,1,
+10337,1,10334,1,
+10337,2,3,10336,1,
+10337,3,10334,3,0,1,
+10337,4,3,9346,7,0,1,
+10337,5,10334,10,0,0,0,1,
+10337,6,3,9593,5351,1518,1,0,1,
+10343,1,10338,1,
+10343,2,5,10341,1,
+10343,3,10338,5,0,1,
+10343,4,5,10339,3,0,1,
+10343,5,10338,5,0,0,0,1,
+10343,6,5,4855,709,8804,2,0,1,
+10357,1,10355,1,
+10357,2,2,10353,1,
+10357,3,10355,4,0,1,
+10357,4,2,9464,9,0,1,
+10357,5,10355,29,0,0,0,1,
+10357,6,2,7218,4223,6369,1,0,1,
+10369,1,10356,1,
+10369,2,13,10358,1,
+10369,3,10356,4,0,1,
+10369,4,13,5914,0,0,1,
+10369,5,10356,14,0,0,0,1,
+10369,6,13,9237,7072,9774,5,0,1,
+10391,1,10372,1,
+10391,2,19,10389,1,
+10391,3,10372,1,0,1,
+10391,4,19,8160,3,0,1,
+10391,5,10372,6,0,0,0,1,
+10391,6,19,8612,5888,4117,2,0,1,
+10399,1,10393,1,
+10399,2,6,10397,1,
+10399,3,10393,1,0,1,
+10399,4,6,10004,4,0,1,
+10399,5,10393,4,0,0,0,1,
+10399,6,6,3057,5189,6359,1,0,1,
+10427,1,10425,1,
+10427,2,2,10423,1,
+10427,3,10425,3,0,1,
+10427,4,2,6390,8,0,1,
+10427,5,10425,4,0,0,0,1,
+10427,6,2,2327,2364,2585,3,0,1,
+10429,1,10422,1,
+10429,2,7,10423,1,
+10429,3,10422,8,0,1,
+10429,4,7,6339,8,0,1,
+10429,5,10422,5,0,0,0,1,
+10429,6,7,702,1521,2882,0,0,1,
+10433,1,10430,1,
+10433,2,3,10428,1,
+10433,3,10430,1,0,1,
+10433,4,3,9291,2,0,1,
+10433,5,10430,11,0,0,0,1,
+10433,6,3,5541,9400,2175,1,0,1,
+10453,1,10448,1,
+10453,2,5,10452,1,
+10453,3,10448,3,0,1,
+10453,4,5,8607,3,0,1,
+10453,5,10448,11,0,0,0,1,
+10453,6,5,9188,8836,20,2,0,1,
+10457,1,10454,1,
+10457,2,3,10456,1,
+10457,3,10454,3,0,1,
+10457,4,3,5413,6,0,1,
+10457,5,10454,4,0,0,0,1,
+10457,6,3,3710,9475,2194,2,0,1,
+10459,1,10457,1,
+10459,2,2,10455,1,
+10459,3,10457,2,0,1,
+10459,4,2,5399,8,0,1,
+10459,5,10457,5,0,0,0,1,
+10459,6,2,5965,1050,1150,0,0,1,
+10463,1,10458,1,
+10463,2,5,10461,1,
+10463,3,10458,2,0,1,
+10463,4,5,7139,5,0,1,
+10463,5,10458,9,0,0,0,1,
+10463,6,5,2150,9054,10455,1,0,1,
+10477,1,10475,1,
+10477,2,2,10476,1,
+10477,3,10475,2,0,1,
+10477,4,2,9846,6,0,1,
+10477,5,10475,5,0,0,0,1,
+10477,6,2,5188,9854,6644,0,0,1,
+10487,1,10482,1,
+10487,2,5,10486,1,
+10487,3,10482,1,0,1,
+10487,4,5,5442,5,0,1,
+10487,5,10482,5,0,0,0,1,
+10487,6,5,10225,1681,7999,1,0,1,
+10499,1,10497,1,
+10499,2,2,10495,1,
+10499,3,10497,3,0,1,
+10499,4,2,7152,7,0,1,
+10499,5,10497,12,0,0,0,1,
+10499,6,2,6824,8169,10136,1,0,1,
+10501,1,10499,1,
+10501,2,2,10497,1,
+10501,3,10499,2,0,1,
+10501,4,2,5365,6,0,1,
+10501,5,10499,11,0,0,0,1,
+10501,6,2,806,246,10118,0,0,1,
+10513,1,10506,1,
+10513,2,7,10506,1,
+10513,3,10506,1,0,1,
+10513,4,7,8031,21,0,1,
+10513,5,10506,3,0,0,0,1,
+10513,6,7,4862,7613,5528,0,0,1,
+10529,1,10526,1,
+10529,2,3,10520,1,
+10529,3,10526,5,0,1,
+10529,4,3,9453,15,0,1,
+10529,5,10526,5,0,0,0,1,
+10529,6,3,9960,3590,9477,3,0,1,
+10531,1,10528,1,
+10531,2,3,10524,1,
+10531,3,10528,3,0,1,
+10531,4,3,9291,5,0,1,
+10531,5,10528,13,0,0,0,1,
+10531,6,3,4037,4785,8414,1,0,1,
+10559,1,10536,1,
+10559,2,23,10558,1,
+10559,3,10536,10,0,1,
+10559,4,23,10135,4,0,1,
+10559,5,10536,2,0,0,0,1,
+10559,6,23,4513,1327,8562,1,0,1,
+10567,1,10561,1,
+10567,2,6,10566,1,
+10567,3,10561,2,0,1,
+10567,4,6,8731,2,0,1,
+10567,5,10561,6,0,0,0,1,
+10567,6,6,2127,2150,5867,0,0,1,
+10589,1,10587,1,
+10589,2,2,10588,1,
+10589,3,10587,3,0,1,
+10589,4,2,5746,3,0,1,
+10589,5,10587,18,0,0,0,1,
+10589,6,2,6284,3375,5122,1,0,1,
+10597,1,10592,1,
+10597,2,5,10596,1,
+10597,3,10592,11,0,1,
+10597,4,5,8893,3,0,1,
+10597,5,10592,2,0,0,0,1,
+10597,6,5,8342,5064,9389,0,0,1,
+10601,1,10598,1,
+10601,2,3,10596,1,
+10601,3,10598,7,0,1,
+10601,4,3,5797,2,0,1,
+10601,5,10598,3,0,0,0,1,
+10601,6,3,1548,5573,8384,8,0,1,
+10607,1,10602,1,
+10607,2,5,10599,1,
+10607,3,10602,5,0,1,
+10607,4,5,10428,3,0,1,
+10607,5,10602,3,0,0,0,1,
+10607,6,5,3761,10137,9577,1,0,1,
+10613,1,10611,1,
+10613,2,2,10608,1,
+10613,3,10611,8,0,1,
+10613,4,2,7629,8,0,1,
+10613,5,10611,6,0,0,0,1,
+10613,6,2,5300,6621,6918,2,0,1,
+10627,1,10622,1,
+10627,2,5,10625,1,
+10627,3,10622,1,0,1,
+10627,4,5,10619,6,0,1,
+10627,5,10622,2,0,0,0,1,
+10627,6,5,2103,2607,6675,0,0,1,
+10631,1,10620,1,
+10631,2,11,10629,1,
+10631,3,10620,1,0,1,
+10631,4,11,7438,5,0,1,
+10631,5,10620,1,0,0,0,1,
+10631,6,11,2265,3246,2360,2,0,1,
+10639,1,10633,1,
+10639,2,6,10635,1,
+10639,3,10633,3,0,1,
+10639,4,6,6229,5,0,1,
+10639,5,10633,3,0,0,0,1,
+10639,6,6,7741,10588,5732,2,0,1,
+10651,1,10644,1,
+10651,2,7,10649,1,
+10651,3,10644,2,0,1,
+10651,4,7,8034,6,0,1,
+10651,5,10644,8,0,0,0,1,
+10651,6,7,8343,5328,6888,0,0,1,
+10657,1,10650,1,
+10657,2,7,10650,1,
+10657,3,10650,3,0,1,
+10657,4,7,8173,14,0,1,
+10657,5,10650,3,0,0,0,1,
+10657,6,7,6442,4670,9286,0,0,1,
+10663,1,10660,1,
+10663,2,3,10657,1,
+10663,3,10660,1,0,1,
+10663,4,3,10651,0,0,1,
+10663,5,10660,3,0,0,0,1,
+10663,6,3,2853,8493,7534,0,0,1,
+10667,1,10665,1,
+10667,2,2,10666,1,
+10667,3,10665,3,0,1,
+10667,4,2,9077,4,0,1,
+10667,5,10665,16,0,0,0,1,
+10667,6,2,9831,1922,2875,1,0,1,
+10687,1,10682,1,
+10687,2,5,10685,1,
+10687,3,10682,7,0,1,
+10687,4,5,10683,3,0,1,
+10687,5,10682,5,0,0,0,1,
+10687,6,5,8608,2242,1554,4,0,1,
+10691,1,10689,1,
+10691,2,2,10685,1,
+10691,3,10689,12,0,1,
+10691,4,2,8483,0,0,1,
+10691,5,10689,21,0,0,0,1,
+10691,6,2,4913,8402,879,2,0,1,
+10709,1,10707,1,
+10709,2,2,10708,1,
+10709,3,10707,5,0,1,
+10709,4,2,6531,3,0,1,
+10709,5,10707,4,0,0,0,1,
+10709,6,2,2824,7462,9497,2,0,1,
+10711,1,10708,1,
+10711,2,3,10710,1,
+10711,3,10708,9,0,1,
+10711,4,3,7232,2,0,1,
+10711,5,10708,1,0,0,0,1,
+10711,6,3,9464,216,6034,0,0,1,
+10723,1,10721,1,
+10723,2,2,10722,1,
+10723,3,10721,2,0,1,
+10723,4,2,10716,8,0,1,
+10723,5,10721,6,0,0,0,1,
+10723,6,2,8107,9992,10099,0,0,1,
+10729,1,10722,1,
+10729,2,7,10722,1,
+10729,3,10722,7,0,1,
+10729,4,7,8196,0,0,1,
+10729,5,10722,5,0,0,0,1,
+10729,6,7,9079,3233,3512,1,0,1,
+10733,1,10731,1,
+10733,2,2,10729,1,
+10733,3,10731,3,0,1,
+10733,4,2,5821,9,0,1,
+10733,5,10731,2,0,0,0,1,
+10733,6,2,9859,3470,7843,2,0,1,
+10739,1,10733,1,
+10739,2,6,10738,1,
+10739,3,10733,2,0,1,
+10739,4,6,6930,5,0,1,
+10739,5,10733,4,0,0,0,1,
+10739,6,6,10428,8594,10506,1,0,1,
+10753,1,10742,1,
+10753,2,11,10752,1,
+10753,3,10742,2,0,1,
+10753,4,11,9268,21,0,1,
+10753,5,10742,1,0,0,0,1,
+10753,6,11,8853,456,6717,0,0,1,
+10771,1,10768,1,
+10771,2,3,10770,1,
+10771,3,10768,4,0,1,
+10771,4,3,10157,2,0,1,
+10771,5,10768,4,0,0,0,1,
+10771,6,3,4964,4159,3365,0,0,1,
+10781,1,10771,1,
+10781,2,10,10780,1,
+10781,3,10771,4,0,1,
+10781,4,10,7606,11,0,1,
+10781,5,10771,11,0,0,0,1,
+10781,6,10,8080,7494,10445,2,0,1,
+10789,1,10787,1,
+10789,2,2,10782,1,
+10789,3,10787,2,0,1,
+10789,4,2,7877,17,0,1,
+10789,5,10787,12,0,0,0,1,
+10789,6,2,8124,4627,10087,0,0,1,
+10799,1,10780,1,
+10799,2,19,10797,1,
+10799,3,10780,2,0,1,
+10799,4,19,9456,5,0,1,
+10799,5,10780,2,0,0,0,1,
+10799,6,19,8481,4614,8994,10,0,1,
+10831,1,10824,1,
+10831,2,7,10822,1,
+10831,3,10824,5,0,1,
+10831,4,7,10215,2,0,1,
+10831,5,10824,10,0,0,0,1,
+10831,6,7,6435,9453,10520,0,0,1,
+10837,1,10835,1,
+10837,2,2,10833,1,
+10837,3,10835,6,0,1,
+10837,4,2,10360,10,0,1,
+10837,5,10835,7,0,0,0,1,
+10837,6,2,10825,10819,10833,0,0,1,
+10847,1,10842,1,
+10847,2,5,10845,1,
+10847,3,10842,5,0,1,
+10847,4,5,6619,10,0,1,
+10847,5,10842,7,0,0,0,1,
+10847,6,5,5616,1870,8460,2,0,1,
+10853,1,10851,1,
+10853,2,2,10852,1,
+10853,3,10851,2,0,1,
+10853,4,2,10846,8,0,1,
+10853,5,10851,3,0,0,0,1,
+10853,6,2,4861,2671,8870,1,0,1,
+10859,1,10857,1,
+10859,2,2,10853,1,
+10859,3,10857,2,0,1,
+10859,4,2,6366,0,0,1,
+10859,5,10857,5,0,0,0,1,
+10859,6,2,1506,6878,10660,1,0,1,
+10861,1,10859,1,
+10861,2,2,10857,1,
+10861,3,10859,2,0,1,
+10861,4,2,10395,12,0,1,
+10861,5,10859,9,0,0,0,1,
+10861,6,2,7967,1894,9957,0,0,1,
+10867,1,10865,1,
+10867,2,2,10866,1,
+10867,3,10865,2,0,1,
+10867,4,2,10860,8,0,1,
+10867,5,10865,6,0,0,0,1,
+10867,6,2,7094,7525,5213,0,0,1,
+10883,1,10881,1,
+10883,2,2,10882,1,
+10883,3,10881,3,0,1,
+10883,4,2,8117,2,0,1,
+10883,5,10881,2,0,0,0,1,
+10883,6,2,6775,5586,8864,2,0,1,
+10889,1,10886,1,
+10889,2,3,10884,1,
+10889,3,10886,1,0,1,
+10889,4,3,6640,2,0,1,
+10889,5,10886,7,0,0,0,1,
+10889,6,3,7550,68,2058,2,0,1,
+10891,1,10889,1,
+10891,2,2,10890,1,
+10891,3,10889,6,0,1,
+10891,4,2,6688,2,0,1,
+10891,5,10889,16,0,0,0,1,
+10891,6,2,6672,8404,2556,0,0,1,
+10903,1,10900,1,
+10903,2,3,10902,1,
+10903,3,10900,1,0,1,
+10903,4,3,7497,5,0,1,
+10903,5,10900,5,0,0,0,1,
+10903,6,3,3939,7090,1946,0,0,1,
+10909,1,10907,1,
+10909,2,2,10908,1,
+10909,3,10907,6,0,1,
+10909,4,2,9660,3,0,1,
+10909,5,10907,27,0,0,0,1,
+10909,6,2,4559,6806,6471,0,0,1,
+10937,1,10934,1,
+10937,2,3,10931,1,
+10937,3,10934,4,0,1,
+10937,4,3,10641,1,0,1,
+10937,5,10934,11,0,0,0,1,
+10937,6,3,9042,5447,8395,1,0,1,
+10939,1,10936,1,
+10939,2,3,10934,1,
+10939,3,10936,1,0,1,
+10939,4,3,10791,3,0,1,
+10939,5,10936,8,0,0,0,1,
+10939,6,3,6782,6456,6392,0,0,1,
+10949,1,10947,1,
+10949,2,2,10945,1,
+10949,3,10947,3,0,1,
+10949,4,2,9086,12,0,1,
+10949,5,10947,2,0,0,0,1,
+10949,6,2,4707,4207,10455,1,0,1,
+10957,1,10952,1,
+10957,2,5,10956,1,
+10957,3,10952,1,0,1,
+10957,4,5,6612,7,0,1,
+10957,5,10952,1,0,0,0,1,
+10957,6,5,2344,954,10070,3,0,1,
+10973,1,10971,1,
+10973,2,2,10969,1,
+10973,3,10971,3,0,1,
+10973,4,2,7937,7,0,1,
+10973,5,10971,4,0,0,0,1,
+10973,6,2,1660,7027,5553,1,0,1,
+10979,1,10977,1,
+10979,2,2,10974,1,
+10979,3,10977,4,0,1,
+10979,4,2,10209,3,0,1,
+10979,5,10977,8,0,0,0,1,
+10979,6,2,1555,2504,2716,1,0,1,
+10987,1,10985,1,
+10987,2,2,10983,1,
+10987,3,10985,6,0,1,
+10987,4,2,8862,8,0,1,
+10987,5,10985,5,0,0,0,1,
+10987,6,2,10975,10969,10983,0,0,1,
+10993,1,10986,1,
+10993,2,7,10986,1,
+10993,3,10986,10,0,1,
+10993,4,7,9709,21,0,1,
+10993,5,10986,1,0,0,0,1,
+10993,6,7,4015,6869,8311,0,0,1,
+11003,1,11001,1,
+11003,2,2,11002,1,
+11003,3,11001,4,0,1,
+11003,4,2,10996,8,0,1,
+11027,1,11025,1,
+11027,2,2,11023,1,
+11027,3,11025,3,0,1,
+11027,4,2,10607,8,0,1,
+11047,1,11044,1,
+11047,2,3,11045,1,
+11047,3,11044,4,0,1,
+11047,4,3,9701,3,0,1,
+11057,1,11054,1,
+11057,2,3,11056,1,
+11057,3,11054,1,0,1,
+11057,4,3,10481,7,0,1,
+11059,1,11049,1,
+11059,2,10,11049,1,
+11059,3,11049,8,0,1,
+11059,4,10,5760,0,0,1,
+11069,1,11067,1,
+11069,2,2,11061,1,
+11069,3,11067,12,0,1,
+11069,4,2,6982,0,0,1,
+11071,1,11068,1,
+11071,2,3,11069,1,
+11071,3,11068,6,0,1,
+11071,4,3,7980,3,0,1,
+11083,1,11081,1,
+11083,2,2,11079,1,
+11083,3,11081,6,0,1,
+11083,4,2,10536,8,0,1,
+11087,1,11082,1,
+11087,2,5,11086,1,
+11087,3,11082,5,0,1,
+11087,4,5,10473,3,0,1,
+11093,1,11091,1,
+11093,2,2,11092,1,
+11093,3,11091,2,0,1,
+11093,4,2,7869,6,0,1,
+11113,1,11100,1,
+11113,2,13,11112,1,
+11113,3,11100,4,0,1,
+11113,4,13,7710,14,0,1,
+11117,1,11114,1,
+11117,2,3,11116,1,
+11117,3,11114,1,0,1,
+11117,4,3,7991,4,0,1,
+11119,1,11116,1,
+11119,2,3,11117,1,
+11119,3,11116,1,0,1,
+11119,4,3,10561,6,0,1,
+11131,1,11129,1,
+11131,2,2,11127,1,
+11131,3,11129,4,0,1,
+11131,4,2,9391,8,0,1,
+11149,1,11139,1,
+11149,2,10,11148,1,
+11149,3,11139,2,0,1,
+11149,4,10,5896,7,0,1,
+11159,1,11152,1,
+11159,2,7,11157,1,
+11159,3,11152,11,0,1,
+11159,4,7,10793,4,0,1,
+11161,1,11154,1,
+11161,2,7,11158,1,
+11161,3,11154,1,0,1,
+11161,4,7,9994,16,0,1,
+11171,1,11169,1,
+11171,2,2,11170,1,
+11171,3,11169,3,0,1,
+11171,4,2,7302,4,0,1,
+11173,1,11168,1,
+11173,2,5,11170,1,
+11173,3,11168,1,0,1,
+11173,4,5,9051,18,0,1,
+11177,1,11174,1,
+11177,2,3,11171,1,
+11177,3,11174,4,0,1,
+11177,4,3,6647,9,0,1,
+11197,1,11195,1,
+11197,2,2,11193,1,
+11197,3,11195,6,0,1,
+11197,4,2,6642,6,0,1,
+11213,1,11211,1,
+11213,2,2,11209,1,
+11213,3,11211,2,0,1,
+11213,4,2,9249,1,0,1,
+11239,1,11236,1,
+11239,2,3,11238,1,
+11239,3,11236,1,0,1,
+11239,4,3,6673,2,0,1,
+11243,1,11238,1,
+11243,2,5,11238,1,
+11243,3,11238,7,0,1,
+11243,4,5,5897,3,0,1,
+11251,1,11238,1,
+11251,2,13,11250,1,
+11251,3,11238,2,0,1,
+11251,4,13,5766,2,0,1,
+11257,1,11247,1,
+11257,2,10,11252,1,
+11257,3,11247,4,0,1,
+11257,4,10,9783,10,0,1,
+11261,1,11259,1,
+11261,2,2,11260,1,
+11261,3,11259,3,0,1,
+11261,4,2,10474,3,0,1,
+11273,1,11270,1,
+11273,2,3,11268,1,
+11273,3,11270,3,0,1,
+11273,4,3,9079,0,0,1,
+11279,1,11272,1,
+11279,2,7,11278,1,
+11279,3,11272,7,0,1,
+11279,4,7,7469,2,0,1,
+11287,1,11284,1,
+11287,2,3,11285,1,
+11287,3,11284,1,0,1,
+11287,4,3,6223,6,0,1,
+11299,1,11296,1,
+11299,2,3,11298,1,
+11299,3,11296,1,0,1,
+11299,4,3,6832,6,0,1,
+11311,1,11308,1,
+11311,2,3,11309,1,
+11311,3,11308,1,0,1,
+11311,4,3,11307,4,0,1,
+11317,1,11315,1,
+11317,2,2,11316,1,
+11317,3,11315,2,0,1,
+11317,4,2,11310,8,0,1,
+11321,1,11318,1,
+11321,2,3,11320,1,
+11321,3,11318,5,0,1,
+11321,4,3,5880,7,0,1,
+11329,1,11322,1,
+11329,2,7,11317,1,
+11329,3,11322,3,0,1,
+11329,4,7,8324,5,0,1,
+11351,1,11344,1,
+11351,2,7,11350,1,
+11351,3,11344,11,0,1,
+11351,4,7,8130,2,0,1,
+11353,1,11346,1,
+11353,2,7,11350,1,
+11353,3,11346,3,0,1,
+11353,4,7,11202,8,0,1,
+11369,1,11366,1,
+11369,2,3,11354,1,
+11369,3,11366,3,0,1,
+11369,4,3,10844,2,0,1,
+11383,1,11378,1,
+11383,2,5,11382,1,
+11383,3,11378,2,0,1,
+11383,4,5,9168,9,0,1,
+11393,1,11390,1,
+11393,2,3,11392,1,
+11393,3,11390,3,0,1,
+11393,4,3,7035,4,0,1,
+11399,1,11388,1,
+11399,2,11,11397,1,
+11399,3,11388,1,0,1,
+11399,4,11,9253,5,0,1,
+11411,1,11404,1,
+11411,2,7,11405,1,
+11411,3,11404,4,0,1,
+11411,4,7,11226,7,0,1,
+11423,1,11418,1,
+11423,2,5,11421,1,
+11423,3,11418,2,0,1,
+11423,4,5,11419,3,0,1,
+11437,1,11435,1,
+11437,2,2,11436,1,
+11437,3,11435,2,0,1,
+11437,4,2,7118,3,0,1,
+11443,1,11441,1,
+11443,2,2,11442,1,
+11443,3,11441,2,0,1,
+11443,4,2,8699,7,0,1,
+11447,1,11442,1,
+11447,2,5,11445,1,
+11447,3,11442,1,0,1,
+11447,4,5,7158,14,0,1,
+11467,1,11462,1,
+11467,2,5,11466,1,
+11467,3,11462,2,0,1,
+11467,4,5,9143,2,0,1,
+11471,1,11460,1,
+11471,2,11,11470,1,
+11471,3,11460,1,0,1,
+11471,4,11,6789,2,0,1,
+11483,1,11481,1,
+11483,2,2,11476,1,
+11483,3,11481,2,0,1,
+11483,4,2,7121,14,0,1,
+11489,1,11486,1,
+11489,2,3,11483,1,
+11489,3,11486,5,0,1,
+11489,4,3,11477,0,0,1,
+11491,1,11488,1,
+11491,2,3,11481,1,
+11491,3,11488,3,0,1,
+11491,4,3,8779,2,0,1,
+11497,1,11490,1,
+11497,2,7,11494,1,
+11497,3,11490,7,0,1,
+11497,4,7,9646,8,0,1,
+11503,1,11500,1,
+11503,2,3,11502,1,
+11503,3,11500,4,0,1,
+11503,4,3,7225,2,0,1,
+11519,1,11512,1,
+11519,2,7,11518,1,
+11519,3,11512,3,0,1,
+11519,4,7,7599,3,0,1,
+11527,1,11522,1,
+11527,2,5,11526,1,
+11527,3,11522,5,0,1,
+11527,4,5,8088,2,0,1,
+11549,1,11547,1,
+11549,2,2,11544,1,
+11549,3,11547,3,0,1,
+11549,4,2,11363,8,0,1,
+11551,1,11544,1,
+11551,2,7,11542,1,
+11551,3,11544,4,0,1,
+11551,4,7,6094,2,0,1,
+11579,1,11577,1,
+11579,2,2,11566,1,
+11579,3,11577,2,0,1,
+11579,4,2,8159,3,0,1,
+11587,1,11585,1,
+11587,2,2,11583,1,
+11587,3,11585,6,0,1,
+11587,4,2,10873,8,0,1,
+11593,1,11588,1,
+11593,2,5,11592,1,
+11593,3,11588,2,0,1,
+11593,4,5,9337,12,0,1,
+11597,1,11594,1,
+11597,2,3,11587,1,
+11597,3,11594,4,0,1,
+11597,4,3,9996,7,0,1,
+11617,1,11607,1,
+11617,2,10,11616,1,
+11617,3,11607,4,0,1,
+11617,4,10,6340,21,0,1,
+11621,1,11619,1,
+11621,2,2,11617,1,
+11621,3,11619,3,0,1,
+11621,4,2,10543,6,0,1,
+11633,1,11630,1,
+11633,2,3,11632,1,
+11633,3,11630,4,0,1,
+11633,4,3,8552,4,0,1,
+11657,1,11654,1,
+11657,2,3,11656,1,
+11657,3,11654,6,0,1,
+11657,4,3,6727,6,0,1,
+11677,1,11675,1,
+11677,2,2,11673,1,
+11677,3,11675,4,0,1,
+11677,4,2,10358,18,0,1,
+11681,1,11678,1,
+11681,2,3,11673,1,
+11681,3,11678,1,0,1,
+11681,4,3,8444,2,0,1,
+11689,1,11682,1,
+11689,2,7,11682,1,
+11689,3,11682,2,0,1,
+11689,4,7,7401,0,0,1,
+11699,1,11697,1,
+11699,2,2,11695,1,
+11699,3,11697,4,0,1,
+11699,4,2,5943,8,0,1,
+11701,1,11695,1,
+11701,2,6,11700,1,
+11701,3,11695,2,0,1,
+11701,4,6,6465,12,0,1,
+11717,1,11715,1,
+11717,2,2,11716,1,
+11717,3,11715,7,0,1,
+11717,4,2,9431,3,0,1,
+11719,1,11713,1,
+11719,2,6,11717,1,
+11719,3,11713,2,0,1,
+11719,4,6,10615,4,0,1,
+11731,1,11728,1,
+11731,2,3,11726,1,
+11731,3,11728,6,0,1,
+11731,4,3,7601,3,0,1,
+11743,1,11740,1,
+11743,2,3,11742,1,
+11743,3,11740,3,0,1,
+11743,4,3,11732,12,0,1,
+11777,1,11774,1,
+11777,2,3,11768,1,
+11777,3,11774,1,0,1,
+11777,4,3,8084,2,0,1,
+11779,1,11777,1,
+11779,2,2,11778,1,
+11779,3,11777,5,0,1,
+11779,4,2,11591,2,0,1,
+11783,1,11778,1,
+11783,2,5,11782,1,
+11783,3,11778,7,0,1,
+11783,4,5,10624,2,0,1,
+11789,1,11787,1,
+11789,2,2,11785,1,
+11789,3,11787,2,0,1,
+11789,4,2,9784,7,0,1,
+11801,1,11798,1,
+11801,2,3,11795,1,
+11801,3,11798,4,0,1,
+11801,4,3,11789,0,0,1,
+11807,1,11802,1,
+11807,2,5,11802,1,
+11807,3,11802,2,0,1,
+11807,4,5,11346,6,0,1,
+11813,1,11811,1,
+11813,2,2,11809,1,
+11813,3,11811,5,0,1,
+11813,4,2,6237,9,0,1,
+11821,1,11819,1,
+11821,2,2,11820,1,
+11821,3,11819,6,0,1,
+11821,4,2,7766,3,0,1,
+11827,1,11825,1,
+11827,2,2,11823,1,
+11827,3,11825,4,0,1,
+11827,4,2,8917,8,0,1,
+11831,1,11824,1,
+11831,2,7,11829,1,
+11831,3,11824,1,0,1,
+11831,4,7,11523,11,0,1,
+11833,1,11828,1,
+11833,2,5,11832,1,
+11833,3,11828,3,0,1,
+11833,4,5,9164,6,0,1,
+11839,1,11836,1,
+11839,2,3,11837,1,
+11839,3,11836,3,0,1,
+11839,4,3,9176,3,0,1,
+11863,1,11860,1,
+11863,2,3,11861,1,
+11863,3,11860,4,0,1,
+11863,4,3,11859,4,0,1,
+11867,1,11865,1,
+11867,2,2,11863,1,
+11867,3,11865,3,0,1,
+11867,4,2,7791,7,0,1,
+11887,1,11884,1,
+11887,2,3,11886,1,
+11887,3,11884,1,0,1,
+11887,4,3,10400,18,0,1,
+11897,1,11894,1,
+11897,2,3,11896,1,
+11897,3,11894,1,0,1,
+11897,4,3,8766,4,0,1,
+11903,1,11898,1,
+11903,2,5,11901,1,
+11903,3,11898,2,0,1,
+11903,4,5,11899,3,0,1,
+11909,1,11907,1,
+11909,2,2,11893,1,
+11909,3,11907,5,0,1,
+11909,4,2,7289,2,0,1,
+11923,1,11918,1,
+11923,2,5,11922,1,
+11923,3,11918,1,0,1,
+11923,4,5,6692,5,0,1,
+11927,1,11922,1,
+11927,2,5,11919,1,
+11927,3,11922,3,0,1,
+11927,4,5,7777,10,0,1,
+11933,1,11931,1,
+11933,2,2,11932,1,
+11933,3,11931,2,0,1,
+11933,4,2,7489,4,0,1,
+11939,1,11937,1,
+11939,2,2,11934,1,
+11939,3,11937,9,0,1,
+11939,4,2,11206,3,0,1,
+11941,1,11931,1,
+11941,2,10,11940,1,
+11941,3,11931,3,0,1,
+11941,4,10,6541,3,0,1,
+11953,1,11948,1,
+11953,2,5,11952,1,
+11953,3,11948,3,0,1,
+11953,4,5,8562,6,0,1,
+11959,1,11956,1,
+11959,2,3,11958,1,
+11959,3,11956,4,0,1,
+11959,4,3,6303,2,0,1,
+11969,1,11966,1,
+11969,2,3,11962,1,
+11969,3,11966,10,0,1,
+11969,4,3,8176,4,0,1,
+11971,1,11961,1,
+11971,2,10,11970,1,
+11971,3,11961,2,0,1,
+11971,4,10,8429,5,0,1,
+11981,1,11979,1,
+11981,2,2,11973,1,
+11981,3,11979,2,0,1,
+11981,4,2,7574,0,0,1,
+11987,1,11985,1,
+11987,2,2,11980,1,
+11987,3,11985,2,0,1,
+11987,4,2,10954,1,0,1,
+12007,1,11994,1,
+12007,2,13,12006,1,
+12007,3,11994,5,0,1,
+12007,4,13,10837,3,0,1,
+12011,1,12009,1,
+12011,2,2,12007,1,
+12011,3,12009,3,0,1,
+12011,4,2,9302,9,0,1,
+12037,1,12032,1,
+12037,2,5,12036,1,
+12037,3,12032,1,0,1,
+12037,4,5,7802,6,0,1,
+12041,1,12038,1,
+12041,2,3,12040,1,
+12041,3,12038,6,0,1,
+12041,4,3,8855,4,0,1,
+12043,1,12041,1,
+12043,2,2,12042,1,
+12043,3,12041,2,0,1,
+12043,4,2,9243,2,0,1,
+12049,1,12036,1,
+12049,2,13,12040,1,
+12049,3,12036,4,0,1,
+12049,4,13,8499,35,0,1,
+12071,1,12060,1,
+12071,2,11,12068,1,
+12071,3,12060,4,0,1,
+12071,4,11,10269,6,0,1,
+12073,1,12066,1,
+12073,2,7,12070,1,
+12073,3,12066,2,0,1,
+12073,4,7,8681,8,0,1,
+12097,1,12092,1,
+12097,2,5,12096,1,
+12097,3,12092,3,0,1,
+12097,4,5,6345,12,0,1,
+12101,1,12098,1,
+12101,2,3,12090,1,
+12101,3,12098,4,0,1,
+12101,4,3,9744,1,0,1,
+12107,1,12105,1,
+12107,2,2,12102,1,
+12107,3,12105,4,0,1,
+12107,4,2,11759,3,0,1,
+12109,1,12103,1,
+12109,2,6,12108,1,
+12109,3,12103,8,0,1,
+12109,4,6,8914,7,0,1,
+12113,1,12110,1,
+12113,2,3,12106,1,
+12113,3,12110,4,0,1,
+12113,4,3,6426,0,0,1,
+12119,1,12112,1,
+12119,2,7,12118,1,
+12119,3,12112,1,0,1,
+12119,4,7,8857,7,0,1,
+12143,1,12133,1,
+12143,2,10,12142,1,
+12143,3,12133,10,0,1,
+12143,4,10,10228,2,0,1,
+12149,1,12147,1,
+12149,2,2,12144,1,
+12149,3,12147,5,0,1,
+12149,4,2,10662,2,0,1,
+12157,1,12155,1,
+12157,2,2,12156,1,
+12157,3,12155,2,0,1,
+12157,4,2,9056,3,0,1,
+12161,1,12158,1,
+12161,2,3,12153,1,
+12161,3,12158,3,0,1,
+12161,4,3,6434,2,0,1,
+12163,1,12158,1,
+12163,2,5,12162,1,
+12163,3,12158,2,0,1,
+12163,4,5,8225,2,0,1,
+12197,1,12195,1,
+12197,2,2,12196,1,
+12197,3,12195,11,0,1,
+12197,4,2,7573,6,0,1,
+12203,1,12201,1,
+12203,2,2,12199,1,
+12203,3,12201,3,0,1,
+12203,4,2,6197,8,0,1,
+12211,1,12209,1,
+12211,2,2,12210,1,
+12211,3,12209,5,0,1,
+12211,4,2,7980,6,0,1,
+12227,1,12225,1,
+12227,2,2,12226,1,
+12227,3,12225,2,0,1,
+12227,4,2,6696,2,0,1,
+12239,1,12226,1,
+12239,2,13,12238,1,
+12239,3,12226,3,0,1,
+12239,4,13,11522,2,0,1,
+12241,1,12234,1,
+12241,2,7,12234,1,
+12241,3,12234,5,0,1,
+12241,4,7,7895,14,0,1,
+12251,1,12249,1,
+12251,2,2,12246,1,
+12251,3,12249,2,0,1,
+12251,4,2,6778,3,0,1,
+12253,1,12251,1,
+12253,2,2,12252,1,
+12253,3,12251,2,0,1,
+12253,4,2,7895,3,0,1,
+12263,1,12258,1,
+12263,2,5,12262,1,
+12263,3,12258,1,0,1,
+12263,4,5,8857,3,0,1,
+12269,1,12267,1,
+12269,2,2,12268,1,
+12269,3,12267,5,0,1,
+12269,4,2,6657,4,0,1,
+12277,1,12275,1,
+12277,2,2,12276,1,
+12277,3,12275,2,0,1,
+12277,4,2,6367,6,0,1,
+12281,1,12278,1,
+12281,2,3,12264,1,
+12281,3,12278,1,0,1,
+12281,4,3,9966,0,0,1,
+12289,1,12278,1,
+12289,2,11,12288,1,
+12289,3,12278,1,0,1,
+12289,4,11,10637,23,0,1,
+12301,1,12299,1,
+12301,2,2,12297,1,
+12301,3,12299,5,0,1,
+12301,4,2,11309,6,0,1,
+12323,1,12321,1,
+12323,2,2,12322,1,
+12323,3,12321,3,0,1,
+12323,4,2,7335,2,0,1,
+12329,1,12326,1,
+12329,2,3,12324,1,
+12329,3,12326,6,0,1,
+12329,4,3,8762,8,0,1,
+12343,1,12336,1,
+12343,2,7,12340,1,
+12343,3,12336,3,0,1,
+12343,4,7,11091,0,0,1,
+12347,1,12345,1,
+12347,2,2,12346,1,
+12347,3,12345,2,0,1,
+12347,4,2,10924,4,0,1,
+12373,1,12371,1,
+12373,2,2,12369,1,
+12373,3,12371,4,0,1,
+12373,4,2,11774,6,0,1,
+12377,1,12371,1,
+12377,2,6,12366,1,
+12377,3,12371,3,0,1,
+12377,4,6,9835,1,0,1,
+12379,1,12377,1,
+12379,2,2,12378,1,
+12379,3,12377,5,0,1,
+12379,4,2,12372,8,0,1,
+12391,1,12365,1,
+12391,2,26,12390,1,
+12391,3,12365,1,0,1,
+12391,4,26,10137,3,0,1,
+12401,1,12398,1,
+12401,2,3,12395,1,
+12401,3,12398,6,0,1,
+12401,4,3,12389,0,0,1,
+12409,1,12402,1,
+12409,2,7,12406,1,
+12409,3,12402,4,0,1,
+12409,4,7,9146,16,0,1,
+12413,1,12411,1,
+12413,2,2,12409,1,
+12413,3,12411,8,0,1,
+12413,4,2,6331,6,0,1,
+12421,1,12414,1,
+12421,2,7,12419,1,
+12421,3,12414,5,0,1,
+12421,4,7,11329,4,0,1,
+12433,1,12420,1,
+12433,2,13,12432,1,
+12433,3,12420,3,0,1,
+12433,4,13,7663,11,0,1,
+12437,1,12435,1,
+12437,2,2,12436,1,
+12437,3,12435,3,0,1,
+12437,4,2,10551,3,0,1,
+12451,1,12448,1,
+12451,2,3,12450,1,
+12451,3,12448,1,0,1,
+12451,4,3,11286,7,0,1,
+12457,1,12447,1,
+12457,2,10,12454,1,
+12457,3,12447,2,0,1,
+12457,4,10,10267,8,0,1,
+12473,1,12470,1,
+12473,2,3,12467,1,
+12473,3,12470,3,0,1,
+12473,4,3,10319,16,0,1,
+12479,1,12456,1,
+12479,2,23,12466,1,
+12479,3,12456,3,0,1,
+12479,4,23,8509,14,0,1,
+12487,1,12484,1,
+12487,2,3,12486,1,
+12487,3,12484,10,0,1,
+12487,4,3,6883,2,0,1,
+12491,1,12489,1,
+12491,2,2,12487,1,
+12491,3,12489,3,0,1,
+12491,4,2,10160,7,0,1,
+12497,1,12494,1,
+12497,2,3,12491,1,
+12497,3,12494,4,0,1,
+12497,4,3,8631,25,0,1,
+12503,1,12498,1,
+12503,2,5,12498,1,
+12503,3,12498,2,0,1,
+12503,4,5,10642,7,0,1,
+12511,1,12508,1,
+12511,2,3,12509,1,
+12511,3,12508,5,0,1,
+12511,4,3,8133,6,0,1,
+12517,1,12511,1,
+12517,2,6,12516,1,
+12517,3,12511,1,0,1,
+12517,4,6,10850,6,0,1,
+12527,1,12522,1,
+12527,2,5,12519,1,
+12527,3,12522,5,0,1,
+12527,4,5,10348,1,0,1,
+12539,1,12537,1,
+12539,2,2,12535,1,
+12539,3,12537,3,0,1,
+12539,4,2,8483,8,0,1,
+12541,1,12527,1,
+12541,2,14,12538,1,
+12541,3,12527,2,0,1,
+12541,4,14,12187,1,0,1,
+12547,1,12545,1,
+12547,2,2,12546,1,
+12547,3,12545,2,0,1,
+12547,4,2,11040,7,0,1,
+12553,1,12548,1,
+12553,2,5,12552,1,
+12553,3,12548,5,0,1,
+12553,4,5,9804,6,0,1,
+12569,1,12566,1,
+12569,2,3,12563,1,
+12569,3,12566,3,0,1,
+12569,4,3,12557,0,0,1,
+12577,1,12567,1,
+12577,2,10,12576,1,
+12577,3,12567,4,0,1,
+12577,4,10,10786,15,0,1,
+12583,1,12578,1,
+12583,2,5,12581,1,
+12583,3,12578,1,0,1,
+12583,4,5,7861,15,0,1,
+12589,1,12587,1,
+12589,2,2,12588,1,
+12589,3,12587,4,0,1,
+12589,4,2,12582,8,0,1,
+12601,1,12590,1,
+12601,2,11,12600,1,
+12601,3,12590,3,0,1,
+12601,4,11,8297,23,0,1,
+12611,1,12609,1,
+12611,2,2,12607,1,
+12611,3,12609,2,0,1,
+12611,4,2,8240,7,0,1,
+12613,1,12611,1,
+12613,2,2,12612,1,
+12613,3,12611,6,0,1,
+12613,4,2,6509,3,0,1,
+12619,1,12617,1,
+12619,2,2,12618,1,
+12619,3,12617,5,0,1,
+12619,4,2,9097,2,0,1,
+12637,1,12635,1,
+12637,2,2,12633,1,
+12637,3,12635,4,0,1,
+12637,4,2,9579,6,0,1,
+12641,1,12638,1,
+12641,2,3,12636,1,
+12641,3,12638,3,0,1,
+12641,4,3,11325,2,0,1,
+12647,1,12642,1,
+12647,2,5,12645,1,
+12647,3,12642,1,0,1,
+12647,4,5,10998,8,0,1,
+12653,1,12651,1,
+12653,2,2,12649,1,
+12653,3,12651,3,0,1,
+12653,4,2,7719,6,0,1,
+12659,1,12657,1,
+12659,2,2,12655,1,
+12659,3,12657,3,0,1,
+12659,4,2,9226,9,0,1,
+12671,1,12657,1,
+12671,2,14,12666,1,
+12671,3,12657,6,0,1,
+12671,4,14,8174,8,0,1,
+12689,1,12686,1,
+12689,2,3,12663,1,
+12689,3,12686,1,0,1,
+12689,4,3,10300,11,0,1,
+12697,1,12690,1,
+12697,2,7,12690,1,
+12697,3,12690,11,0,1,
+12697,4,7,7201,14,0,1,
+12703,1,12700,1,
+12703,2,3,12701,1,
+12703,3,12700,4,0,1,
+12703,4,3,12695,10,0,1,
+12713,1,12710,1,
+12713,2,3,12712,1,
+12713,3,12710,5,0,1,
+12713,4,3,11614,7,0,1,
+12721,1,12708,1,
+12721,2,13,12720,1,
+12721,3,12708,5,0,1,
+12721,4,13,11757,14,0,1,
+12739,1,12737,1,
+12739,2,2,12738,1,
+12739,3,12737,6,0,1,
+12739,4,2,7197,6,0,1,
+12743,1,12738,1,
+12743,2,5,12742,1,
+12743,3,12738,3,0,1,
+12743,4,5,9400,3,0,1,
+12757,1,12755,1,
+12757,2,2,12756,1,
+12757,3,12755,2,0,1,
+12757,4,2,10778,7,0,1,
+12763,1,12761,1,
+12763,2,2,12759,1,
+12763,3,12761,4,0,1,
+12763,4,2,12176,8,0,1,
+12781,1,12779,1,
+12781,2,2,12780,1,
+12781,3,12779,4,0,1,
+12781,4,2,7134,3,0,1,
+12791,1,12784,1,
+12791,2,7,12790,1,
+12791,3,12784,13,0,1,
+12791,4,7,12538,3,0,1,
+12799,1,12786,1,
+12799,2,13,12796,1,
+12799,3,12786,7,0,1,
+12799,4,13,9776,4,0,1,
+12809,1,12806,1,
+12809,2,3,12803,1,
+12809,3,12806,8,0,1,
+12809,4,3,12797,0,0,1,
+12821,1,12819,1,
+12821,2,2,12817,1,
+12821,3,12819,7,0,1,
+12821,4,2,8064,6,0,1,
+12823,1,12820,1,
+12823,2,3,12821,1,
+12823,3,12820,5,0,1,
+12823,4,3,12819,4,0,1,
+12829,1,12827,1,
+12829,2,2,12828,1,
+12829,3,12827,6,0,1,
+12829,4,2,12822,8,0,1,
+12841,1,12820,1,
+12841,2,21,12837,1,
+12841,3,12820,1,0,1,
+12841,4,21,12285,18,0,1,
+12853,1,12848,1,
+12853,2,5,12848,1,
+12853,3,12848,1,0,1,
+12853,4,5,10364,10,0,1,
+12889,1,12876,1,
+12889,2,13,12876,1,
+12889,3,12876,1,0,1,
+12889,4,13,12850,0,0,1,
+12893,1,12890,1,
+12893,2,3,12891,1,
+12893,3,12890,1,0,1,
+12893,4,3,12889,4,0,1,
+12899,1,12897,1,
+12899,2,2,12895,1,
+12899,3,12897,3,0,1,
+12899,4,2,11522,7,0,1,
+12907,1,12905,1,
+12907,2,2,12906,1,
+12907,3,12905,2,0,1,
+12907,4,2,10806,2,0,1,
+12911,1,12888,1,
+12911,2,23,12909,1,
+12911,3,12888,3,0,1,
+12911,4,23,11184,3,0,1,
+12917,1,12915,1,
+12917,2,2,12913,1,
+12917,3,12915,3,0,1,
+12917,4,2,10722,6,0,1,
+12919,1,12913,1,
+12919,2,6,12917,1,
+12919,3,12913,3,0,1,
+12919,4,6,12237,4,0,1,
+12923,1,12921,1,
+12923,2,2,12919,1,
+12923,3,12921,5,0,1,
+12923,4,2,9816,8,0,1,
+12941,1,12939,1,
+12941,2,2,12937,1,
+12941,3,12939,3,0,1,
+12941,4,2,6943,1,0,1,
+12953,1,12950,1,
+12953,2,3,12952,1,
+12953,3,12950,3,0,1,
+12953,4,3,6783,4,0,1,
+12959,1,12952,1,
+12959,2,7,12958,1,
+12959,3,12952,1,0,1,
+12959,4,7,12476,2,0,1,
+12967,1,12964,1,
+12967,2,3,12965,1,
+12967,3,12964,8,0,1,
+12967,4,3,12959,10,0,1,
+12973,1,12959,1,
+12973,2,14,12972,1,
+12973,3,12959,1,0,1,
+12973,4,14,8938,3,0,1,
+12979,1,12977,1,
+12979,2,2,12975,1,
+12979,3,12977,2,0,1,
+12979,4,2,12782,20,0,1,
+12983,1,12978,1,
+12983,2,5,12978,1,
+12983,3,12978,8,0,1,
+12983,4,5,8709,6,0,1,
+13001,1,12998,1,
+13001,2,3,12992,1,
+13001,3,12998,1,0,1,
+13001,4,3,8473,6,0,1,
+13003,1,12998,1,
+13003,2,5,13001,1,
+13003,3,12998,9,0,1,
+13003,4,5,12995,6,0,1,
+13007,1,13002,1,
+13007,2,5,13005,1,
+13007,3,13002,2,0,1,
+13007,4,5,13003,3,0,1,
+13009,1,13002,1,
+13009,2,7,13006,1,
+13009,3,13002,2,0,1,
+13009,4,7,11645,14,0,1,
+13033,1,13028,1,
+13033,2,5,13028,1,
+13033,3,13028,5,0,1,
+13033,4,5,8087,10,0,1,
+13037,1,13035,1,
+13037,2,2,13036,1,
+13037,3,13035,2,0,1,
+13037,4,2,10273,3,0,1,
+13043,1,13041,1,
+13043,2,2,13037,1,
+13043,3,13041,4,0,1,
+13043,4,2,10220,4,0,1,
+13049,1,13046,1,
+13049,2,3,13043,1,
+13049,3,13046,6,0,1,
+13049,4,3,13037,0,0,1,
+13063,1,13058,1,
+13063,2,5,13062,1,
+13063,3,13058,1,0,1,
+13063,4,5,6753,5,0,1,
+13093,1,13087,1,
+13093,2,6,13091,1,
+13093,3,13087,2,0,1,
+13093,4,6,12260,0,0,1,
+13099,1,13096,1,
+13099,2,3,13094,1,
+13099,3,13096,1,0,1,
+13099,4,3,9131,3,0,1,
+13103,1,13098,1,
+13103,2,5,13100,1,
+13103,3,13098,2,0,1,
+13103,4,5,12631,6,0,1,
+13109,1,13107,1,
+13109,2,2,13108,1,
+13109,3,13107,4,0,1,
+13109,4,2,10967,3,0,1,
+13121,1,13114,1,
+13121,2,7,13120,1,
+13121,3,13114,1,0,1,
+13121,4,7,13112,4,0,1,
+13127,1,13122,1,
+13127,2,5,13125,1,
+13127,3,13122,6,0,1,
+13127,4,5,11607,5,0,1,
+13147,1,13145,1,
+13147,2,2,13143,1,
+13147,3,13145,5,0,1,
+13147,4,2,10388,8,0,1,
+13151,1,13138,1,
+13151,2,13,13149,1,
+13151,3,13138,2,0,1,
+13151,4,13,8034,3,0,1,
+13159,1,13156,1,
+13159,2,3,13157,1,
+13159,3,13156,1,0,1,
+13159,4,3,7702,6,0,1,
+13163,1,13161,1,
+13163,2,2,13162,1,
+13163,3,13161,2,0,1,
+13163,4,2,10042,4,0,1,
+13171,1,13160,1,
+13171,2,11,13155,1,
+13171,3,13160,3,0,1,
+13171,4,11,9001,1,0,1,
+13177,1,13172,1,
+13177,2,5,13176,1,
+13177,3,13172,1,0,1,
+13177,4,5,12852,12,0,1,
+13183,1,13180,1,
+13183,2,3,13181,1,
+13183,3,13180,3,0,1,
+13183,4,3,9259,6,0,1,
+13187,1,13185,1,
+13187,2,2,13186,1,
+13187,3,13185,2,0,1,
+13187,4,2,11476,2,0,1,
+13217,1,13214,1,
+13217,2,3,13216,1,
+13217,3,13214,6,0,1,
+13217,4,3,8353,7,0,1,
+13219,1,13216,1,
+13219,2,3,13218,1,
+13219,3,13216,1,0,1,
+13219,4,3,9064,2,0,1,
+13229,1,13227,1,
+13229,2,2,13228,1,
+13229,3,13227,3,0,1,
+13229,4,2,12376,3,0,1,
+13241,1,13238,1,
+13241,2,3,13235,1,
+13241,3,13238,3,0,1,
+13241,4,3,13229,0,0,1,
+13249,1,13242,1,
+13249,2,7,13242,1,
+13249,3,13242,2,0,1,
+13249,4,7,9771,0,0,1,
+13259,1,13253,1,
+13259,2,6,13258,1,
+13259,3,13253,2,0,1,
+13259,4,6,7318,2,0,1,
+13267,1,13264,1,
+13267,2,3,13262,1,
+13267,3,13264,4,0,1,
+13267,4,3,12885,6,0,1,
+13291,1,13289,1,
+13291,2,2,13290,1,
+13291,3,13289,4,0,1,
+13291,4,2,9534,2,0,1,
+13297,1,13292,1,
+13297,2,5,13292,1,
+13297,3,13292,1,0,1,
+13297,4,5,10985,15,0,1,
+13309,1,13303,1,
+13309,2,6,13308,1,
+13309,3,13303,9,0,1,
+13309,4,6,10048,11,0,1,
+13313,1,13310,1,
+13313,2,3,13307,1,
+13313,3,13310,5,0,1,
+13313,4,3,10149,26,0,1,
+13327,1,13324,1,
+13327,2,3,13326,1,
+13327,3,13324,1,0,1,
+13327,4,3,12644,5,0,1,
+13331,1,13329,1,
+13331,2,2,13330,1,
+13331,3,13329,3,0,1,
+13331,4,2,13324,8,0,1,
+13337,1,13334,1,
+13337,2,3,13331,1,
+13337,3,13334,6,0,1,
+13337,4,3,11563,25,0,1,
+13339,1,13337,1,
+13339,2,2,13335,1,
+13339,3,13337,4,0,1,
+13339,4,2,11379,8,0,1,
+13367,1,13362,1,
+13367,2,5,13365,1,
+13367,3,13362,7,0,1,
+13367,4,5,10774,5,0,1,
+13381,1,13371,1,
+13381,2,10,13377,1,
+13381,3,13371,4,0,1,
+13381,4,10,13369,10,0,1,
+13397,1,13395,1,
+13397,2,2,13387,1,
+13397,3,13395,2,0,1,
+13397,4,2,8569,23,0,1,
+13399,1,13396,1,
+13399,2,3,13397,1,
+13399,3,13396,9,0,1,
+13399,4,3,13395,4,0,1,
+13411,1,13409,1,
+13411,2,2,13410,1,
+13411,3,13409,6,0,1,
+13411,4,2,12560,2,0,1,
+13417,1,13412,1,
+13417,2,5,13416,1,
+13417,3,13412,7,0,1,
+13417,4,5,9896,8,0,1,
+13421,1,13411,1,
+13421,2,10,13412,1,
+13421,3,13411,6,0,1,
+13421,4,10,11263,12,0,1,
+13441,1,13430,1,
+13441,2,11,13436,1,
+13441,3,13430,2,0,1,
+13441,4,11,13422,24,0,1,
+13451,1,13449,1,
+13451,2,2,13447,1,
+13451,3,13449,3,0,1,
+13451,4,2,13123,7,0,1,
+13457,1,13454,1,
+13457,2,3,13451,1,
+13457,3,13454,5,0,1,
+13457,4,3,13055,1,0,1,
+13463,1,13458,1,
+13463,2,5,13461,1,
+13463,3,13458,2,0,1,
+13463,4,5,7855,8,0,1,
+13469,1,13467,1,
+13469,2,2,13465,1,
+13469,3,13467,2,0,1,
+13469,4,2,12001,6,0,1,
+13477,1,13475,1,
+13477,2,2,13473,1,
+13477,3,13475,6,0,1,
+13477,4,2,8310,10,0,1,
+13487,1,13482,1,
+13487,2,5,13485,1,
+13487,3,13482,9,0,1,
+13487,4,5,13483,3,0,1,
+13499,1,13493,1,
+13499,2,6,13498,1,
+13499,3,13493,1,0,1,
+13499,4,6,11673,2,0,1,
+13513,1,13508,1,
+13513,2,5,13508,1,
+13513,3,13508,1,0,1,
+13513,4,5,12909,12,0,1,
+13523,1,13521,1,
+13523,2,2,13522,1,
+13523,3,13521,3,0,1,
+13523,4,2,10269,2,0,1,
+13537,1,13530,1,
+13537,2,7,13530,1,
+13537,3,13530,7,0,1,
+13537,4,7,13336,17,0,1,
+13553,1,13550,1,
+13553,2,3,13548,1,
+13553,3,13550,4,0,1,
+13553,4,3,9255,0,0,1,
+13567,1,13564,1,
+13567,2,3,13565,1,
+13567,3,13564,17,0,1,
+13567,4,3,10098,6,0,1,
+13577,1,13574,1,
+13577,2,3,13572,1,
+13577,3,13574,9,0,1,
+13577,4,3,11270,0,0,1,
+13591,1,13588,1,
+13591,2,3,13590,1,
+13591,3,13588,4,0,1,
+13591,4,3,7954,2,0,1,
+13597,1,13592,1,
+13597,2,5,13592,1,
+13597,3,13592,2,0,1,
+13597,4,5,8962,12,0,1,
+13613,1,13611,1,
+13613,2,2,13612,1,
+13613,3,13611,2,0,1,
+13613,4,2,9342,4,0,1,
+13619,1,13617,1,
+13619,2,2,13612,1,
+13619,3,13617,7,0,1,
+13619,4,2,12678,1,0,1,
+13627,1,13625,1,
+13627,2,2,13626,1,
+13627,3,13625,6,0,1,
+13627,4,2,13620,8,0,1,
+13633,1,13628,1,
+13633,2,5,13632,1,
+13633,3,13628,10,0,1,
+13633,4,5,8948,6,0,1,
+13649,1,13646,1,
+13649,2,3,13643,1,
+13649,3,13646,5,0,1,
+13649,4,3,13637,0,0,1,
+13669,1,13663,1,
+13669,2,6,13668,1,
+13669,3,13663,2,0,1,
+13669,4,6,8034,7,0,1,
+13679,1,13672,1,
+13679,2,7,13677,1,
+13679,3,13672,1,0,1,
+13679,4,7,12320,11,0,1,
+13681,1,13659,1,
+13681,2,22,13679,1,
+13681,3,13659,5,0,1,
+13681,4,22,12837,13,0,1,
+13687,1,13684,1,
+13687,2,3,13685,1,
+13687,3,13684,5,0,1,
+13687,4,3,13219,6,0,1,
+13691,1,13689,1,
+13691,2,2,13684,1,
+13691,3,13689,4,0,1,
+13691,4,2,7555,1,0,1,
+13693,1,13687,1,
+13693,2,6,13691,1,
+13693,3,13687,3,0,1,
+13693,4,6,12123,10,0,1,
+13697,1,13694,1,
+13697,2,3,13692,1,
+13697,3,13694,3,0,1,
+13697,4,3,12739,0,0,1,
+13709,1,13707,1,
+13709,2,2,13705,1,
+13709,3,13707,3,0,1,
+13709,4,2,10841,1,0,1,
+13711,1,13705,1,
+13711,2,6,13709,1,
+13711,3,13705,3,0,1,
+13711,4,6,10891,3,0,1,
+13721,1,13718,1,
+13721,2,3,13716,1,
+13721,3,13718,1,0,1,
+13721,4,3,13459,2,0,1,
+13723,1,13721,1,
+13723,2,2,13722,1,
+13723,3,13721,2,0,1,
+13723,4,2,13716,8,0,1,
+13729,1,13706,1,
+13729,2,23,13724,1,
+13729,3,13706,7,0,1,
+13729,4,23,9923,28,0,1,
+13751,1,13740,1,
+13751,2,11,13750,1,
+13751,3,13740,1,0,1,
+13751,4,11,12072,3,0,1,
+13757,1,13755,1,
+13757,2,2,13753,1,
+13757,3,13755,3,0,1,
+13757,4,2,12979,7,0,1,
+13759,1,13753,1,
+13759,2,6,13758,1,
+13759,3,13753,2,0,1,
+13759,4,6,11518,3,0,1,
+13763,1,13761,1,
+13763,2,2,13758,1,
+13763,3,13761,4,0,1,
+13763,4,2,8176,0,0,1,
+13781,1,13774,1,
+13781,2,7,13780,1,
+13781,3,13774,1,0,1,
+13781,4,7,12092,3,0,1,
+13789,1,13782,1,
+13789,2,7,13787,1,
+13789,3,13782,3,0,1,
+13789,4,7,12012,4,0,1,
+13799,1,13792,1,
+13799,2,7,13798,1,
+13799,3,13792,1,0,1,
+13799,4,7,13200,2,0,1,
+13807,1,13802,1,
+13807,2,5,13806,1,
+13807,3,13802,7,0,1,
+13807,4,5,7160,12,0,1,
+13829,1,13827,1,
+13829,2,2,13822,1,
+13829,3,13827,4,0,1,
+13829,4,2,13104,4,0,1,
+13831,1,13825,1,
+13831,2,6,13829,1,
+13831,3,13825,3,0,1,
+13831,4,6,7411,3,0,1,
+13841,1,13835,1,
+13841,2,6,13835,1,
+13841,3,13835,4,0,1,
+13841,4,6,9725,0,0,1,
+13859,1,13857,1,
+13859,2,2,13849,1,
+13859,3,13857,3,0,1,
+13859,4,2,8838,0,0,1,
+13873,1,13868,1,
+13873,2,5,13872,1,
+13873,3,13868,5,0,1,
+13873,4,5,12572,6,0,1,
+13877,1,13875,1,
+13877,2,2,13873,1,
+13877,3,13875,3,0,1,
+13877,4,2,12699,6,0,1,
+13879,1,13873,1,
+13879,2,6,13878,1,
+13879,3,13873,1,0,1,
+13879,4,6,7827,2,0,1,
+13883,1,13881,1,
+13883,2,2,13878,1,
+13883,3,13881,3,0,1,
+13883,4,2,8704,0,0,1,
+13901,1,13899,1,
+13901,2,2,13900,1,
+13901,3,13899,3,0,1,
+13901,4,2,10722,3,0,1,
+13903,1,13900,1,
+13903,2,3,13902,1,
+13903,3,13900,5,0,1,
+13903,4,3,9020,5,0,1,
+13907,1,13905,1,
+13907,2,2,13906,1,
+13907,3,13905,2,0,1,
+13907,4,2,12303,4,0,1,
+13913,1,13910,1,
+13913,2,3,13907,1,
+13913,3,13910,1,0,1,
+13913,4,3,9536,9,0,1,
+13921,1,13914,1,
+13921,2,7,13918,1,
+13921,3,13914,2,0,1,
+13921,4,7,10679,14,0,1,
+13931,1,13929,1,
+13931,2,2,13927,1,
+13931,3,13929,3,0,1,
+13931,4,2,12622,8,0,1,
+13933,1,13931,1,
+13933,2,2,13932,1,
+13933,3,13931,2,0,1,
+13933,4,2,12695,3,0,1,
+13963,1,13960,1,
+13963,2,3,13956,1,
+13963,3,13960,1,0,1,
+13963,4,3,9166,2,0,1,
+13967,1,13962,1,
+13967,2,5,13964,1,
+13967,3,13962,1,0,1,
+13967,4,5,13388,6,0,1,
+13997,1,13995,1,
+13997,2,2,13993,1,
+13997,3,13995,3,0,1,
+13997,4,2,9119,6,0,1,
+13999,1,13996,1,
+13999,2,3,13998,1,
+13999,3,13996,5,0,1,
+13999,4,3,13497,3,0,1,
+14009,1,14006,1,
+14009,2,3,14002,1,
+14009,3,14006,6,0,1,
+14009,4,3,7563,1,0,1,
+14011,1,14009,1,
+14011,2,2,14007,1,
+14011,3,14009,4,0,1,
+14011,4,2,13601,8,0,1,
+14029,1,14023,1,
+14029,2,6,14028,1,
+14029,3,14023,1,0,1,
+14029,4,6,10970,7,0,1,
+14033,1,14030,1,
+14033,2,3,14032,1,
+14033,3,14030,3,0,1,
+14033,4,3,13187,4,0,1,
+14051,1,14049,1,
+14051,2,2,14047,1,
+14051,3,14049,2,0,1,
+14051,4,2,7128,8,0,1,
+14057,1,14054,1,
+14057,2,3,14051,1,
+14057,3,14054,1,0,1,
+14057,4,3,11112,12,0,1,
+14071,1,14064,1,
+14071,2,7,14062,1,
+14071,3,14064,2,0,1,
+14071,4,7,13232,2,0,1,
+14081,1,14078,1,
+14081,2,3,14076,1,
+14081,3,14078,1,0,1,
+14081,4,3,9476,2,0,1,
+14083,1,14080,1,
+14083,2,3,14076,1,
+14083,3,14080,1,0,1,
+14083,4,3,8351,2,0,1,
+14087,1,14082,1,
+14087,2,5,14085,1,
+14087,3,14082,5,0,1,
+14087,4,5,10003,5,0,1,
+14107,1,14105,1,
+14107,2,2,14103,1,
+14107,3,14105,6,0,1,
+14107,4,2,8711,8,0,1,
+14143,1,14140,1,
+14143,2,3,14142,1,
+14143,3,14140,1,0,1,
+14143,4,3,8452,2,0,1,
+14149,1,14143,1,
+14149,2,6,14145,1,
+14149,3,14143,1,0,1,
+14149,4,6,12231,2,0,1,
+14153,1,14150,1,
+14153,2,3,14152,1,
+14153,3,14150,4,0,1,
+14153,4,3,9492,7,0,1,
+14159,1,14146,1,
+14159,2,13,14142,1,
+14159,3,14146,2,0,1,
+14159,4,13,7929,4,0,1,
+14173,1,14171,1,
+14173,2,2,14172,1,
+14173,3,14171,2,0,1,
+14173,4,2,7332,6,0,1,
+14177,1,14174,1,
+14177,2,3,14172,1,
+14177,3,14174,1,0,1,
+14177,4,3,13112,0,0,1,
+14197,1,14186,1,
+14197,2,11,14196,1,
+14197,3,14186,1,0,1,
+14197,4,11,13990,7,0,1,
+14207,1,14202,1,
+14207,2,5,14206,1,
+14207,3,14202,3,0,1,
+14207,4,5,10123,3,0,1,
+14221,1,14219,1,
+14221,2,2,14217,1,
+14221,3,14219,2,0,1,
+14221,4,2,10322,10,0,1,
+14243,1,14241,1,
+14243,2,2,14239,1,
+14243,3,14241,2,0,1,
+14243,4,2,11177,7,0,1,
+14249,1,14246,1,
+14249,2,3,14240,1,
+14249,3,14246,5,0,1,
+14249,4,3,8020,3,0,1,
+14251,1,14248,1,
+14251,2,3,14244,1,
+14251,3,14248,1,0,1,
+14251,4,3,7517,5,0,1,
+14281,1,14262,1,
+14281,2,19,14268,1,
+14281,3,14262,4,0,1,
+14281,4,19,12888,32,0,1,
+14293,1,14287,1,
+14293,2,6,14292,1,
+14293,3,14287,1,0,1,
+14293,4,6,9296,7,0,1,
+14303,1,14298,1,
+14303,2,5,14302,1,
+14303,3,14298,1,0,1,
+14303,4,5,13408,4,0,1,
+14321,1,14318,1,
+14321,2,3,14320,1,
+14321,3,14318,1,0,1,
+14321,4,3,12410,7,0,1,
+14323,1,14318,1,
+14323,2,5,14321,1,
+14323,3,14318,1,0,1,
+14323,4,5,14315,6,0,1,
+14327,1,14322,1,
+14327,2,5,14319,1,
+14327,3,14322,1,0,1,
+14327,4,5,13083,3,0,1,
+14341,1,14339,1,
+14341,2,2,14340,1,
+14341,3,14339,4,0,1,
+14341,4,2,13520,3,0,1,
+14347,1,14344,1,
+14347,2,3,14342,1,
+14347,3,14344,7,0,1,
+14347,4,3,12043,3,0,1,
+14369,1,14366,1,
+14369,2,3,14363,1,
+14369,3,14366,1,0,1,
+14369,4,3,14357,0,0,1,
+14387,1,14385,1,
+14387,2,2,14383,1,
+14387,3,14385,3,0,1,
+14387,4,2,11871,7,0,1,
+14389,1,14387,1,
+14389,2,2,14384,1,
+14389,3,14387,2,0,1,
+14389,4,2,12161,18,0,1,
+14401,1,14390,1,
+14401,2,11,14400,1,
+14401,3,14390,2,0,1,
+14401,4,11,9977,20,0,1,
+14407,1,14388,1,
+14407,2,19,14405,1,
+14407,3,14388,1,0,1,
+14407,4,19,13007,11,0,1,
+14411,1,14409,1,
+14411,2,2,14406,1,
+14411,3,14409,4,0,1,
+14411,4,2,9697,3,0,1,
+14419,1,14417,1,
+14419,2,2,14418,1,
+14419,3,14417,4,0,1,
+14419,4,2,8774,6,0,1,
+14423,1,14418,1,
+14423,2,5,14422,1,
+14423,3,14418,1,0,1,
+14423,4,5,9831,3,0,1,
+14431,1,14428,1,
+14431,2,3,14430,1,
+14431,3,14428,3,0,1,
+14431,4,3,11655,3,0,1,
+14437,1,14432,1,
+14437,2,5,14432,1,
+14437,3,14432,3,0,1,
+14437,4,5,9262,7,0,1,
+14447,1,14442,1,
+14447,2,5,14442,1,
+14447,3,14442,6,0,1,
+14447,4,5,9069,7,0,1,
+14449,1,14427,1,
+14449,2,22,14443,1,
+14449,3,14427,1,0,1,
+14449,4,22,13340,39,0,1,
+14461,1,14459,1,
+14461,2,2,14460,1,
+14461,3,14459,4,0,1,
+14461,4,2,7365,3,0,1,
+14479,1,14476,1,
+14479,2,3,14477,1,
+14479,3,14476,1,0,1,
+14479,4,3,14475,4,0,1,
+14489,1,14486,1,
+14489,2,3,14484,1,
+14489,3,14486,3,0,1,
+14489,4,3,11364,2,0,1,
+14503,1,14500,1,
+14503,2,3,14501,1,
+14503,3,14500,15,0,1,
+14503,4,3,14495,10,0,1,
+14519,1,14506,1,
+14519,2,13,14516,1,
+14519,3,14506,1,0,1,
+14519,4,13,10077,4,0,1,
+14533,1,14531,1,
+14533,2,2,14526,1,
+14533,3,14531,4,0,1,
+14533,4,2,12880,2,0,1,
+14537,1,14534,1,
+14537,2,3,14536,1,
+14537,3,14534,5,0,1,
+14537,4,3,11076,4,0,1,
+14543,1,14538,1,
+14543,2,5,14542,1,
+14543,3,14538,2,0,1,
+14543,4,5,8060,2,0,1,
+14549,1,14547,1,
+14549,2,2,14536,1,
+14549,3,14547,4,0,1,
+14549,4,2,13678,0,0,1,
+14551,1,14548,1,
+14551,2,3,14549,1,
+14551,3,14548,1,0,1,
+14551,4,3,13724,6,0,1,
+14557,1,14555,1,
+14557,2,2,14553,1,
+14557,3,14555,4,0,1,
+14557,4,2,14122,6,0,1,
+14561,1,14555,1,
+14561,2,6,14558,1,
+14561,3,14555,2,0,1,
+14561,4,6,13475,0,0,1,
+14563,1,14560,1,
+14563,2,3,14562,1,
+14563,3,14560,1,0,1,
+14563,4,3,10162,2,0,1,
+14591,1,14580,1,
+14591,2,11,14588,1,
+14591,3,14580,2,0,1,
+14591,4,11,14295,5,0,1,
+14593,1,14588,1,
+14593,2,5,14590,1,
+14593,3,14588,7,0,1,
+14593,4,5,14582,14,0,1,
+14621,1,14619,1,
+14621,2,2,14615,1,
+14621,3,14619,7,0,1,
+14621,4,2,11075,4,0,1,
+14627,1,14625,1,
+14627,2,2,14623,1,
+14627,3,14625,3,0,1,
+14627,4,2,7514,7,0,1,
+14629,1,14627,1,
+14629,2,2,14623,1,
+14629,3,14627,5,0,1,
+14629,4,2,8495,0,0,1,
+14633,1,14630,1,
+14633,2,3,14627,1,
+14633,3,14630,1,0,1,
+14633,4,3,9488,9,0,1,
+14639,1,14628,1,
+14639,2,11,14633,1,
+14639,3,14628,1,0,1,
+14639,4,11,14397,7,0,1,
+14653,1,14651,1,
+14653,2,2,14649,1,
+14653,3,14651,7,0,1,
+14653,4,2,9191,12,0,1,
+14657,1,14654,1,
+14657,2,3,14652,1,
+14657,3,14654,3,0,1,
+14657,4,3,12260,0,0,1,
+14669,1,14667,1,
+14669,2,2,14657,1,
+14669,3,14667,2,0,1,
+14669,4,2,11437,1,0,1,
+14683,1,14680,1,
+14683,2,3,14678,1,
+14683,3,14680,5,0,1,
+14683,4,3,14412,3,0,1,
+14699,1,14697,1,
+14699,2,2,14698,1,
+14699,3,14697,3,0,1,
+14699,4,2,11988,4,0,1,
+14713,1,14708,1,
+14713,2,5,14710,1,
+14713,3,14708,5,0,1,
+14713,4,5,14702,14,0,1,
+14717,1,14715,1,
+14717,2,2,14713,1,
+14717,3,14715,2,0,1,
+14717,4,2,9721,6,0,1,
+14723,1,14721,1,
+14723,2,2,14719,1,
+14723,3,14721,3,0,1,
+14723,4,2,13815,7,0,1,
+14731,1,14721,1,
+14731,2,10,14730,1,
+14731,3,14721,3,0,1,
+14731,4,10,13058,2,0,1,
+14737,1,14727,1,
+14737,2,10,14736,1,
+14737,3,14727,7,0,1,
+14737,4,10,10198,6,0,1,
+14741,1,14739,1,
+14741,2,2,14740,1,
+14741,3,14739,3,0,1,
+14741,4,2,11603,9,0,1,
+14747,1,14745,1,
+14747,2,2,14740,1,
+14747,3,14745,2,0,1,
+14747,4,2,10091,1,0,1,
+14753,1,14750,1,
+14753,2,3,14752,1,
+14753,3,14750,3,0,1,
+14753,4,3,14315,6,0,1,
+14759,1,14742,1,
+14759,2,17,14757,1,
+14759,3,14742,5,0,1,
+14759,4,17,14751,3,0,1,
+14767,1,14764,1,
+14767,2,3,14765,1,
+14767,3,14764,8,0,1,
+14767,4,3,11676,6,0,1,
+14771,1,14769,1,
+14771,2,2,14765,1,
+14771,3,14769,2,0,1,
+14771,4,2,14427,0,0,1,
+14779,1,14776,1,
+14779,2,3,14778,1,
+14779,3,14776,8,0,1,
+14779,4,3,9676,2,0,1,
+14783,1,14778,1,
+14783,2,5,14774,1,
+14783,3,14778,5,0,1,
+14783,4,5,12067,10,0,1,
+14797,1,14795,1,
+14797,2,2,14796,1,
+14797,3,14795,6,0,1,
+14797,4,2,11646,3,0,1,
+14813,1,14811,1,
+14813,2,2,14809,1,
+14813,3,14811,3,0,1,
+14813,4,2,13288,6,0,1,
+14821,1,14819,1,
+14821,2,2,14817,1,
+14821,3,14819,4,0,1,
+14821,4,2,10680,6,0,1,
+14827,1,14825,1,
+14827,2,2,14823,1,
+14827,3,14825,6,0,1,
+14827,4,2,8938,8,0,1,
+14831,1,14820,1,
+14831,2,11,14830,1,
+14831,3,14820,1,0,1,
+14831,4,11,14142,4,0,1,
+14843,1,14841,1,
+14843,2,2,14839,1,
+14843,3,14841,3,0,1,
+14843,4,2,14210,13,0,1,
+14851,1,14849,1,
+14851,2,2,14847,1,
+14851,3,14849,5,0,1,
+14851,4,2,14640,8,0,1,
+14867,1,14865,1,
+14867,2,2,14866,1,
+14867,3,14865,2,0,1,
+14867,4,2,11809,4,0,1,
+14869,1,14867,1,
+14869,2,2,14865,1,
+14869,3,14867,2,0,1,
+14869,4,2,12464,6,0,1,
+14879,1,14872,1,
+14879,2,7,14878,1,
+14879,3,14872,2,0,1,
+14879,4,7,7908,2,0,1,
+14887,1,14884,1,
+14887,2,3,14885,1,
+14887,3,14884,1,0,1,
+14887,4,3,13556,3,0,1,
+14891,1,14889,1,
+14891,2,2,14887,1,
+14891,3,14889,2,0,1,
+14891,4,2,9122,7,0,1,
+14897,1,14894,1,
+14897,2,3,14891,1,
+14897,3,14894,1,0,1,
+14897,4,3,11419,1,0,1,
+14923,1,14921,1,
+14923,2,2,14922,1,
+14923,3,14921,5,0,1,
+14923,4,2,9081,10,0,1,
+14929,1,14922,1,
+14929,2,7,14926,1,
+14929,3,14922,1,0,1,
+14929,4,7,9447,16,0,1,
+14939,1,14937,1,
+14939,2,2,14935,1,
+14939,3,14937,3,0,1,
+14939,4,2,12854,7,0,1,
+14947,1,14945,1,
+14947,2,2,14943,1,
+14947,3,14945,6,0,1,
+14947,4,2,12696,8,0,1,
+14951,1,14932,1,
+14951,2,19,14950,1,
+14951,3,14932,1,0,1,
+14951,4,19,9679,2,0,1,
+14957,1,14955,1,
+14957,2,2,14956,1,
+14957,3,14955,2,0,1,
+14957,4,2,14950,8,0,1,
+14969,1,14966,1,
+14969,2,3,14964,1,
+14969,3,14966,3,0,1,
+14969,4,3,13196,2,0,1,
+14983,1,14980,1,
+14983,2,3,14981,1,
+14983,3,14980,6,0,1,
+14983,4,3,14979,4,0,1,
+15013,1,15011,1,
+15013,2,2,15012,1,
+15013,3,15011,2,0,1,
+15013,4,2,11191,6,0,1,
+15017,1,15014,1,
+15017,2,3,15016,1,
+15017,3,15014,4,0,1,
+15017,4,3,11978,7,0,1,
+15031,1,15028,1,
+15031,2,3,15029,1,
+15031,3,15028,3,0,1,
+15031,4,3,8554,3,0,1,
+15053,1,15051,1,
+15053,2,2,15047,1,
+15053,3,15051,8,0,1,
+15053,4,2,14277,4,0,1,
+15061,1,15059,1,
+15061,2,2,15057,1,
+15061,3,15059,5,0,1,
+15061,4,2,9468,10,0,1,
+15073,1,15068,1,
+15073,2,5,15068,1,
+15073,3,15068,3,0,1,
+15073,4,5,13101,15,0,1,
+15077,1,15075,1,
+15077,2,2,15076,1,
+15077,3,15075,3,0,1,
+15077,4,2,10509,9,0,1,
+15083,1,15081,1,
+15083,2,2,15075,1,
+15083,3,15081,2,0,1,
+15083,4,2,7810,0,0,1,
+15091,1,15089,1,
+15091,2,2,15087,1,
+15091,3,15089,6,0,1,
+15091,4,2,7652,1,0,1,
+15101,1,15099,1,
+15101,2,2,15093,1,
+15101,3,15099,7,0,1,
+15101,4,2,14609,0,0,1,
+15107,1,15105,1,
+15107,2,2,15101,1,
+15107,3,15105,8,0,1,
+15107,4,2,12520,0,0,1,
+15121,1,15110,1,
+15121,2,11,15120,1,
+15121,3,15110,3,0,1,
+15121,4,11,11091,23,0,1,
+15131,1,15129,1,
+15131,2,2,15127,1,
+15131,3,15129,3,0,1,
+15131,4,2,14639,8,0,1,
+15137,1,15134,1,
+15137,2,3,15132,1,
+15137,3,15134,1,0,1,
+15137,4,3,12044,0,0,1,
+15139,1,15137,1,
+15139,2,2,15138,1,
+15139,3,15137,4,0,1,
+15139,4,2,10952,2,0,1,
+15149,1,15147,1,
+15149,2,2,15145,1,
+15149,3,15147,2,0,1,
+15149,4,2,13568,7,0,1,
+15161,1,15158,1,
+15161,2,3,15155,1,
+15161,3,15158,7,0,1,
+15161,4,3,15149,0,0,1,
+15173,1,15171,1,
+15173,2,2,15169,1,
+15173,3,15171,3,0,1,
+15173,4,2,9189,7,0,1,
+15187,1,15185,1,
+15187,2,2,15183,1,
+15187,3,15185,4,0,1,
+15187,4,2,12918,8,0,1,
+15193,1,15188,1,
+15193,2,5,15192,1,
+15193,3,15188,8,0,1,
+15193,4,5,9152,6,0,1,
+15199,1,15193,1,
+15199,2,6,15197,1,
+15199,3,15193,6,0,1,
+15199,4,6,14595,4,0,1,
+15217,1,15207,1,
+15217,2,10,15216,1,
+15217,3,15207,2,0,1,
+15217,4,10,8075,21,0,1,
+15227,1,15225,1,
+15227,2,2,15223,1,
+15227,3,15225,3,0,1,
+15227,4,2,13122,8,0,1,
+15233,1,15230,1,
+15233,2,3,15227,1,
+15233,3,15230,5,0,1,
+15233,4,3,14724,1,0,1,
+15241,1,15230,1,
+15241,2,11,15240,1,
+15241,3,15230,2,0,1,
+15241,4,11,12892,14,0,1,
+15259,1,15257,1,
+15259,2,2,15258,1,
+15259,3,15257,5,0,1,
+15259,4,2,9510,2,0,1,
+15263,1,15258,1,
+15263,2,5,15261,1,
+15263,3,15258,6,0,1,
+15263,4,5,9395,8,0,1,
+15269,1,15267,1,
+15269,2,2,15262,1,
+15269,3,15267,5,0,1,
+15269,4,2,14071,9,0,1,
+15271,1,15260,1,
+15271,2,11,15269,1,
+15271,3,15260,5,0,1,
+15271,4,11,10687,6,0,1,
+15277,1,15271,1,
+15277,2,6,15276,1,
+15277,3,15271,1,0,1,
+15277,4,6,10990,7,0,1,
+15287,1,15282,1,
+15287,2,5,15285,1,
+15287,3,15282,1,0,1,
+15287,4,5,10761,8,0,1,
+15289,1,15278,1,
+15289,2,11,15284,1,
+15289,3,15278,1,0,1,
+15289,4,11,13890,16,0,1,
+15299,1,15297,1,
+15299,2,2,15295,1,
+15299,3,15297,3,0,1,
+15299,4,2,12536,8,0,1,
+15307,1,15304,1,
+15307,2,3,15306,1,
+15307,3,15304,1,0,1,
+15307,4,3,14957,5,0,1,
+15313,1,15308,1,
+15313,2,5,15312,1,
+15313,3,15308,3,0,1,
+15313,4,5,15294,20,0,1,
+15319,1,15316,1,
+15319,2,3,15313,1,
+15319,3,15316,11,0,1,
+15319,4,3,13897,7,0,1,
+15329,1,15326,1,
+15329,2,3,15328,1,
+15329,3,15326,1,0,1,
+15329,4,3,9817,7,0,1,
+15331,1,15329,1,
+15331,2,2,15327,1,
+15331,3,15329,2,0,1,
+15331,4,2,8141,8,0,1,
+15349,1,15347,1,
+15349,2,2,15348,1,
+15349,3,15347,6,0,1,
+15349,4,2,10522,22,0,1,
+15359,1,15348,1,
+15359,2,11,15357,1,
+15359,3,15348,1,0,1,
+15359,4,11,11082,6,0,1,
+15361,1,15354,1,
+15361,2,7,15354,1,
+15361,3,15354,2,0,1,
+15361,4,7,8585,0,0,1,
+15373,1,15371,1,
+15373,2,2,15369,1,
+15373,3,15371,5,0,1,
+15373,4,2,11244,6,0,1,
+15377,1,15374,1,
+15377,2,3,15372,1,
+15377,3,15374,8,0,1,
+15377,4,3,13302,0,0,1,
+15383,1,15378,1,
+15383,2,5,15382,1,
+15383,3,15378,2,0,1,
+15383,4,5,7799,2,0,1,
+15391,1,15379,1,
+15391,2,12,15390,1,
+15391,3,15379,6,0,1,
+15391,4,12,8544,10,0,1,
+15401,1,15395,1,
+15401,2,6,15398,1,
+15401,3,15395,11,0,1,
+15401,4,6,13736,6,0,1,
+15413,1,15411,1,
+15413,2,2,15412,1,
+15413,3,15411,2,0,1,
+15413,4,2,9182,3,0,1,
+15427,1,15425,1,
+15427,2,2,15426,1,
+15427,3,15425,5,0,1,
+15427,4,2,12801,2,0,1,
+15439,1,15436,1,
+15439,2,3,15438,1,
+15439,3,15436,8,0,1,
+15439,4,3,8299,3,0,1,
+15443,1,15441,1,
+15443,2,2,15438,1,
+15443,3,15441,3,0,1,
+15443,4,2,13921,3,0,1,
+15451,1,15448,1,
+15451,2,3,15450,1,
+15451,3,15448,4,0,1,
+15451,4,3,8718,6,0,1,
+15461,1,15459,1,
+15461,2,2,15460,1,
+15461,3,15459,3,0,1,
+15461,4,2,15132,3,0,1,
+15467,1,15462,1,
+15467,2,5,15462,1,
+15467,3,15462,5,0,1,
+15467,4,5,13985,3,0,1,
+15473,1,15470,1,
+15473,2,3,15472,1,
+15473,3,15470,1,0,1,
+15473,4,3,9553,6,0,1,
+15493,1,15488,1,
+15493,2,5,15492,1,
+15493,3,15488,1,0,1,
+15493,4,5,13989,3,0,1,
+15497,1,15494,1,
+15497,2,3,15491,1,
+15497,3,15494,11,0,1,
+15497,4,3,15145,9,0,1,
+15511,1,15508,1,
+15511,2,3,15509,1,
+15511,3,15508,10,0,1,
+15511,4,3,15507,4,0,1,
+15527,1,15522,1,
+15527,2,5,15524,1,
+15527,3,15522,3,0,1,
+15527,4,5,12618,9,0,1,
+15541,1,15535,1,
+15541,2,6,15537,1,
+15541,3,15535,1,0,1,
+15541,4,6,13485,2,0,1,
+15551,1,15544,1,
+15551,2,7,15550,1,
+15551,3,15544,5,0,1,
+15551,4,7,8500,3,0,1,
+15559,1,15556,1,
+15559,2,3,15557,1,
+15559,3,15556,6,0,1,
+15559,4,3,12175,6,0,1,
+15569,1,15566,1,
+15569,2,3,15564,1,
+15569,3,15566,1,0,1,
+15569,4,3,9214,2,0,1,
+15581,1,15579,1,
+15581,2,2,15580,1,
+15581,3,15579,3,0,1,
+15581,4,2,15574,8,0,1,
+15583,1,15578,1,
+15583,2,5,15582,1,
+15583,3,15578,7,0,1,
+15583,4,5,12039,3,0,1,
+15601,1,15578,1,
+15601,2,23,15600,1,
+15601,3,15578,2,0,1,
+15601,4,23,9357,8,0,1,
+15607,1,15604,1,
+15607,2,3,15605,1,
+15607,3,15604,1,0,1,
+15607,4,3,10488,3,0,1,
+15619,1,15612,1,
+15619,2,7,15617,1,
+15619,3,15612,3,0,1,
+15619,4,7,15119,6,0,1,
+15629,1,15627,1,
+15629,2,2,15624,1,
+15629,3,15627,3,0,1,
+15629,4,2,13192,8,0,1,
+15641,1,15638,1,
+15641,2,3,15636,1,
+15641,3,15638,3,0,1,
+15641,4,3,10034,2,0,1,
+15643,1,15638,1,
+15643,2,5,15641,1,
+15643,3,15638,2,0,1,
+15643,4,5,10262,0,0,1,
+15647,1,15642,1,
+15647,2,5,15646,1,
+15647,3,15642,12,0,1,
+15647,4,5,10656,4,0,1,
+15649,1,15638,1,
+15649,2,11,15644,1,
+15649,3,15638,3,0,1,
+15649,4,11,13785,27,0,1,
+15661,1,15659,1,
+15661,2,2,15657,1,
+15661,3,15659,2,0,1,
+15661,4,2,10274,12,0,1,
+15667,1,15665,1,
+15667,2,2,15663,1,
+15667,3,15665,6,0,1,
+15667,4,2,8825,8,0,1,
+15671,1,15658,1,
+15671,2,13,15669,1,
+15671,3,15658,3,0,1,
+15671,4,13,11603,3,0,1,
+15679,1,15668,1,
+15679,2,11,15678,1,
+15679,3,15668,3,0,1,
+15679,4,11,14897,2,0,1,
+15683,1,15681,1,
+15683,2,2,15682,1,
+15683,3,15681,3,0,1,
+15683,4,2,14689,2,0,1,
+15727,1,15724,1,
+15727,2,3,15726,1,
+15727,3,15724,5,0,1,
+15727,4,3,13197,2,0,1,
+15731,1,15729,1,
+15731,2,2,15726,1,
+15731,3,15729,2,0,1,
+15731,4,2,10581,3,0,1,
+15733,1,15727,1,
+15733,2,6,15731,1,
+15733,3,15727,3,0,1,
+15733,4,6,13802,4,0,1,
+15737,1,15734,1,
+15737,2,3,15736,1,
+15737,3,15734,3,0,1,
+15737,4,3,12626,7,0,1,
+15739,1,15737,1,
+15739,2,2,15738,1,
+15739,3,15737,6,0,1,
+15739,4,2,12090,2,0,1,
+15749,1,15747,1,
+15749,2,2,15744,1,
+15749,3,15747,7,0,1,
+15749,4,2,13579,8,0,1,
+15761,1,15758,1,
+15761,2,3,15756,1,
+15761,3,15758,1,0,1,
+15761,4,3,8021,2,0,1,
+15767,1,15762,1,
+15767,2,5,15765,1,
+15767,3,15762,6,0,1,
+15767,4,5,15763,3,0,1,
+15773,1,15771,1,
+15773,2,2,15765,1,
+15773,3,15771,4,0,1,
+15773,4,2,11997,19,0,1,
+15787,1,15785,1,
+15787,2,2,15783,1,
+15787,3,15785,6,0,1,
+15787,4,2,8715,8,0,1,
+15791,1,15762,1,
+15791,2,29,15789,1,
+15791,3,15762,1,0,1,
+15791,4,29,13692,3,0,1,
+15797,1,15795,1,
+15797,2,2,15796,1,
+15797,3,15795,2,0,1,
+15797,4,2,11364,4,0,1,
+15803,1,15801,1,
+15803,2,2,15799,1,
+15803,3,15801,3,0,1,
+15803,4,2,13330,8,0,1,
+15809,1,15806,1,
+15809,2,3,15793,1,
+15809,3,15806,5,0,1,
+15809,4,3,11417,5,0,1,
+15817,1,15812,1,
+15817,2,5,15814,1,
+15817,3,15812,1,0,1,
+15817,4,5,15806,14,0,1,
+15823,1,15820,1,
+15823,2,3,15821,1,
+15823,3,15820,1,0,1,
+15823,4,3,11784,3,0,1,
+15859,1,15857,1,
+15859,2,2,15855,1,
+15859,3,15857,2,0,1,
+15859,4,2,14606,8,0,1,
+15877,1,15872,1,
+15877,2,5,15876,1,
+15877,3,15872,1,0,1,
+15877,4,5,12548,6,0,1,
+15881,1,15878,1,
+15881,2,3,15880,1,
+15881,3,15878,3,0,1,
+15881,4,3,14374,7,0,1,
+15887,1,15882,1,
+15887,2,5,15885,1,
+15887,3,15882,2,0,1,
+15887,4,5,12622,5,0,1,
+15889,1,15868,1,
+15889,2,21,15885,1,
+15889,3,15868,3,0,1,
+15889,4,21,8661,18,0,1,
+15901,1,15891,1,
+15901,2,10,15900,1,
+15901,3,15891,2,0,1,
+15901,4,10,8178,3,0,1,
+15907,1,15905,1,
+15907,2,2,15906,1,
+15907,3,15905,2,0,1,
+15907,4,2,14352,24,0,1,
+15913,1,15908,1,
+15913,2,5,15912,1,
+15913,3,15908,2,0,1,
+15913,4,5,10875,12,0,1,
+15919,1,15913,1,
+15919,2,6,15915,1,
+15919,3,15913,1,0,1,
+15919,4,6,15915,6,0,1,
+15923,1,15921,1,
+15923,2,2,15922,1,
+15923,3,15921,2,0,1,
+15923,4,2,11080,11,0,1,
+15937,1,15930,1,
+15937,2,7,15934,1,
+15937,3,15930,1,0,1,
+15937,4,7,9049,8,0,1,
+15959,1,15948,1,
+15959,2,11,15957,1,
+15959,3,15948,1,0,1,
+15959,4,11,12406,8,0,1,
+15971,1,15969,1,
+15971,2,2,15967,1,
+15971,3,15969,2,0,1,
+15971,4,2,13906,8,0,1,
+15973,1,15966,1,
+15973,2,7,15971,1,
+15973,3,15966,4,0,1,
+15973,4,7,15535,9,0,1,
+15991,1,15979,1,
+15991,2,12,15990,1,
+15991,3,15979,6,0,1,
+15991,4,12,15501,6,0,1,
+16001,1,15998,1,
+16001,2,3,16000,1,
+16001,3,15998,3,0,1,
+16001,4,3,11518,4,0,1,
+16007,1,16002,1,
+16007,2,5,16005,1,
+16007,3,16002,5,0,1,
+16007,4,5,10910,5,0,1,
+16033,1,16028,1,
+16033,2,5,16030,1,
+16033,3,16028,1,0,1,
+16033,4,5,10823,24,0,1,
+16057,1,16050,1,
+16057,2,7,16054,1,
+16057,3,16050,4,0,1,
+16057,4,7,8370,14,0,1,
+16061,1,16049,1,
+16061,2,12,16057,1,
+16061,3,16049,5,0,1,
+16061,4,12,12651,2,0,1,
+16063,1,16058,1,
+16063,2,5,16062,1,
+16063,3,16058,1,0,1,
+16063,4,5,10575,2,0,1,
+16067,1,16065,1,
+16067,2,2,16061,1,
+16067,3,16065,4,0,1,
+16067,4,2,10096,0,0,1,
+16069,1,16067,1,
+16069,2,2,16062,1,
+16069,3,16067,2,0,1,
+16069,4,2,15200,9,0,1,
+16073,1,16070,1,
+16073,2,3,16072,1,
+16073,3,16070,3,0,1,
+16073,4,3,11304,7,0,1,
+16087,1,16082,1,
+16087,2,5,16086,1,
+16087,3,16082,11,0,1,
+16087,4,5,14210,5,0,1,
+16091,1,16085,1,
+16091,2,6,16090,1,
+16091,3,16085,3,0,1,
+16091,4,6,15496,2,0,1,
+16097,1,16094,1,
+16097,2,3,16091,1,
+16097,3,16094,8,0,1,
+16097,4,3,13585,1,0,1,
+16103,1,16098,1,
+16103,2,5,16102,1,
+16103,3,16098,2,0,1,
+16103,4,5,8601,2,0,1,
+16111,1,16104,1,
+16111,2,7,16100,1,
+16111,3,16104,1,0,1,
+16111,4,7,11905,5,0,1,
+16127,1,16122,1,
+16127,2,5,16126,1,
+16127,3,16122,5,0,1,
+16127,4,5,9406,7,0,1,
+16139,1,16137,1,
+16139,2,2,16134,1,
+16139,3,16137,2,0,1,
+16139,4,2,13098,3,0,1,
+16141,1,16135,1,
+16141,2,6,16137,1,
+16141,3,16135,4,0,1,
+16141,4,6,12611,10,0,1,
+16183,1,16180,1,
+16183,2,3,16181,1,
+16183,3,16180,1,0,1,
+16183,4,3,13542,3,0,1,
+16187,1,16185,1,
+16187,2,2,16186,1,
+16187,3,16185,2,0,1,
+16187,4,2,14687,2,0,1,
+16189,1,16187,1,
+16189,2,2,16188,1,
+16189,3,16187,6,0,1,
+16189,4,2,12027,3,0,1,
+16193,1,16188,1,
+16193,2,5,16186,1,
+16193,3,16188,2,0,1,
+16193,4,5,11495,2,0,1,
+16217,1,16214,1,
+16217,2,3,16209,1,
+16217,3,16214,3,0,1,
+16217,4,3,9176,2,0,1,
+16223,1,16218,1,
+16223,2,5,16221,1,
+16223,3,16218,1,0,1,
+16223,4,5,16211,11,0,1,
+16229,1,16227,1,
+16229,2,2,16225,1,
+16229,3,16227,3,0,1,
+16229,4,2,10412,1,0,1,
+16231,1,16228,1,
+16231,2,3,16230,1,
+16231,3,16228,4,0,1,
+16231,4,3,11282,3,0,1,
+16249,1,16232,1,
+16249,2,17,16246,1,
+16249,3,16232,6,0,1,
+16249,4,17,9288,20,0,1,
+16253,1,16251,1,
+16253,2,2,16252,1,
+16253,3,16251,5,0,1,
+16253,4,2,11667,3,0,1,
+16267,1,16264,1,
+16267,2,3,16254,1,
+16267,3,16264,6,0,1,
+16267,4,3,9631,2,0,1,
+16273,1,16266,1,
+16273,2,7,16266,1,
+16273,3,16266,1,0,1,
+16273,4,7,9328,14,0,1,
+16301,1,16299,1,
+16301,2,2,16300,1,
+16301,3,16299,3,0,1,
+16301,4,2,9533,3,0,1,
+16319,1,16312,1,
+16319,2,7,16318,1,
+16319,3,16312,3,0,1,
+16319,4,7,14283,11,0,1,
+16333,1,16331,1,
+16333,2,2,16329,1,
+16333,3,16331,6,0,1,
+16333,4,2,13777,12,0,1,
+16339,1,16337,1,
+16339,2,2,16335,1,
+16339,3,16337,5,0,1,
+16339,4,2,9888,8,0,1,
+16349,1,16347,1,
+16349,2,2,16345,1,
+16349,3,16347,3,0,1,
+16349,4,2,15888,6,0,1,
+16361,1,16358,1,
+16361,2,3,16353,1,
+16361,3,16358,7,0,1,
+16361,4,3,15626,2,0,1,
+16363,1,16361,1,
+16363,2,2,16359,1,
+16363,3,16361,4,0,1,
+16363,4,2,13047,14,0,1,
+16369,1,16362,1,
+16369,2,7,16366,1,
+16369,3,16362,4,0,1,
+16369,4,7,11519,16,0,1,
+16381,1,16379,1,
+16381,2,2,16377,1,
+16381,3,16379,4,0,1,
+16381,4,2,15657,6,0,1,
+16411,1,16408,1,
+16411,2,3,16410,1,
+16411,3,16408,1,0,1,
+16411,4,3,8375,2,0,1,
+16417,1,16407,1,
+16417,2,10,16416,1,
+16417,3,16407,4,0,1,
+16417,4,10,13893,21,0,1,
+16421,1,16419,1,
+16421,2,2,16411,1,
+16421,3,16419,8,0,1,
+16421,4,2,11652,7,0,1,
+16427,1,16425,1,
+16427,2,2,16423,1,
+16427,3,16425,3,0,1,
+16427,4,2,15023,7,0,1,
+16433,1,16430,1,
+16433,2,3,16423,1,
+16433,3,16430,11,0,1,
+16433,4,3,14284,4,0,1,
+16447,1,16444,1,
+16447,2,3,16446,1,
+16447,3,16444,5,0,1,
+16447,4,3,13423,5,0,1,
+16451,1,16444,1,
+16451,2,7,16445,1,
+16451,3,16444,3,0,1,
+16451,4,7,16447,4,0,1,
+16453,1,16451,1,
+16453,2,2,16452,1,
+16453,3,16451,2,0,1,
+16453,4,2,15443,3,0,1,
+16477,1,16475,1,
+16477,2,2,16476,1,
+16477,3,16475,2,0,1,
+16477,4,2,16470,8,0,1,
+16481,1,16475,1,
+16481,2,6,16471,1,
+16481,3,16475,7,0,1,
+16481,4,6,13531,3,0,1,
+16487,1,16482,1,
+16487,2,5,16486,1,
+16487,3,16482,1,0,1,
+16487,4,5,14263,5,0,1,
+16493,1,16491,1,
+16493,2,2,16489,1,
+16493,3,16491,3,0,1,
+16493,4,2,8748,6,0,1,
+16519,1,16516,1,
+16519,2,3,16517,1,
+16519,3,16516,6,0,1,
+16519,4,3,12886,3,0,1,
+16529,1,16526,1,
+16529,2,3,16528,1,
+16529,3,16526,10,0,1,
+16529,4,3,16347,7,0,1,
+16547,1,16545,1,
+16547,2,2,16546,1,
+16547,3,16545,2,0,1,
+16547,4,2,10767,2,0,1,
+16553,1,16550,1,
+16553,2,3,16547,1,
+16553,3,16550,1,0,1,
+16553,4,3,12969,9,0,1,
+16561,1,16554,1,
+16561,2,7,16558,1,
+16561,3,16554,1,0,1,
+16561,4,7,9382,14,0,1,
+16567,1,16564,1,
+16567,2,3,16565,1,
+16567,3,16564,4,0,1,
+16567,4,3,10444,3,0,1,
+16573,1,16571,1,
+16573,2,2,16569,1,
+16573,3,16571,7,0,1,
+16573,4,2,9569,12,0,1,
+16603,1,16601,1,
+16603,2,2,16602,1,
+16603,3,16601,6,0,1,
+16603,4,2,15788,16,0,1,
+16607,1,16602,1,
+16607,2,5,16605,1,
+16607,3,16602,1,0,1,
+16607,4,5,15925,10,0,1,
+16619,1,16617,1,
+16619,2,2,16615,1,
+16619,3,16617,2,0,1,
+16619,4,2,15056,7,0,1,
+16631,1,16612,1,
+16631,2,19,16630,1,
+16631,3,16612,1,0,1,
+16631,4,19,10223,8,0,1,
+16633,1,16618,1,
+16633,2,15,16632,1,
+16633,3,16618,4,0,1,
+16633,4,15,9934,14,0,1,
+16649,1,16646,1,
+16649,2,3,16643,1,
+16649,3,16646,6,0,1,
+16649,4,3,16637,0,0,1,
+16651,1,16649,1,
+16651,2,2,16650,1,
+16651,3,16649,4,0,1,
+16651,4,2,11256,12,0,1,
+16657,1,16652,1,
+16657,2,5,16656,1,
+16657,3,16652,13,0,1,
+16657,4,5,13959,6,0,1,
+16661,1,16651,1,
+16661,2,10,16656,1,
+16661,3,16651,7,0,1,
+16661,4,10,12016,7,0,1,
+16673,1,16670,1,
+16673,2,3,16672,1,
+16673,3,16670,1,0,1,
+16673,4,3,8824,7,0,1,
+16691,1,16685,1,
+16691,2,6,16689,1,
+16691,3,16685,1,0,1,
+16691,4,6,16681,7,0,1,
+16693,1,16691,1,
+16693,2,2,16692,1,
+16693,3,16691,6,0,1,
+16693,4,2,8491,3,0,1,
+16699,1,16696,1,
+16699,2,3,16694,1,
+16699,3,16696,10,0,1,
+16699,4,3,16410,3,0,1,
+16703,1,16698,1,
+16703,2,5,16702,1,
+16703,3,16698,8,0,1,
+16703,4,5,8813,2,0,1,
+16729,1,16716,1,
+16729,2,13,16726,1,
+16729,3,16716,2,0,1,
+16729,4,13,12734,16,0,1,
+16741,1,16735,1,
+16741,2,6,16740,1,
+16741,3,16735,1,0,1,
+16741,4,6,8876,11,0,1,
+16747,1,16745,1,
+16747,2,2,16746,1,
+16747,3,16745,2,0,1,
+16747,4,2,16430,2,0,1,
+16759,1,16756,1,
+16759,2,3,16754,1,
+16759,3,16756,4,0,1,
+16759,4,3,13520,6,0,1,
+16763,1,16761,1,
+16763,2,2,16759,1,
+16763,3,16761,2,0,1,
+16763,4,2,13241,21,0,1,
+16787,1,16785,1,
+16787,2,2,16783,1,
+16787,3,16785,3,0,1,
+16787,4,2,10145,13,0,1,
+16811,1,16804,1,
+16811,2,7,16810,1,
+16811,3,16804,2,0,1,
+16811,4,7,14794,2,0,1,
+16823,1,16818,1,
+16823,2,5,16821,1,
+16823,3,16818,3,0,1,
+16823,4,5,11944,8,0,1,
+16829,1,16827,1,
+16829,2,2,16825,1,
+16829,3,16827,2,0,1,
+16829,4,2,13058,12,0,1,
+16831,1,16825,1,
+16831,2,6,16829,1,
+16831,3,16825,3,0,1,
+16831,4,6,14569,3,0,1,
+16843,1,16841,1,
+16843,2,2,16839,1,
+16843,3,16841,6,0,1,
+16843,4,2,11857,13,0,1,
+16871,1,16854,1,
+16871,2,17,16869,1,
+16871,3,16854,2,0,1,
+16871,4,17,16863,3,0,1,
+16879,1,16876,1,
+16879,2,3,16877,1,
+16879,3,16876,4,0,1,
+16879,4,3,9540,6,0,1,
+16883,1,16881,1,
+16883,2,2,16875,1,
+16883,3,16881,15,0,1,
+16883,4,2,8556,0,0,1,
+16889,1,16886,1,
+16889,2,3,16882,1,
+16889,3,16886,7,0,1,
+16889,4,3,15970,4,0,1,
+16901,1,16899,1,
+16901,2,2,16900,1,
+16901,3,16899,3,0,1,
+16901,4,2,16894,8,0,1,
+16903,1,16900,1,
+16903,2,3,16902,1,
+16903,3,16900,3,0,1,
+16903,4,3,12591,5,0,1,
+16921,1,16904,1,
+16921,2,17,16918,1,
+16921,3,16904,3,0,1,
+16921,4,17,16162,16,0,1,
+16927,1,16921,1,
+16927,2,6,16926,1,
+16927,3,16921,1,0,1,
+16927,4,6,9845,2,0,1,
+16931,1,16929,1,
+16931,2,2,16930,1,
+16931,3,16929,3,0,1,
+16931,4,2,13481,2,0,1,
+16937,1,16934,1,
+16937,2,3,16936,1,
+16937,3,16934,1,0,1,
+16937,4,3,9810,7,0,1,
+16943,1,16938,1,
+16943,2,5,16942,1,
+16943,3,16938,7,0,1,
+16943,4,5,9020,7,0,1,
+16963,1,16961,1,
+16963,2,2,16959,1,
+16963,3,16961,5,0,1,
+16963,4,2,14815,8,0,1,
+16979,1,16977,1,
+16979,2,2,16973,1,
+16979,3,16977,2,0,1,
+16979,4,2,10100,0,0,1,
+16981,1,16979,1,
+16981,2,2,16980,1,
+16981,3,16979,6,0,1,
+16981,4,2,13100,3,0,1,
+16987,1,16984,1,
+16987,2,3,16976,1,
+16987,3,16984,1,0,1,
+16987,4,3,13805,3,0,1,
+16993,1,16983,1,
+16993,2,10,16992,1,
+16993,3,16983,5,0,1,
+16993,4,10,15879,14,0,1,
+17011,1,17009,1,
+17011,2,2,17007,1,
+17011,3,17009,2,0,1,
+17011,4,2,13795,8,0,1,
+17021,1,17019,1,
+17021,2,2,17013,1,
+17021,3,17019,8,0,1,
+17021,4,2,13081,0,0,1,
+17027,1,17025,1,
+17027,2,2,17026,1,
+17027,3,17025,2,0,1,
+17027,4,2,14040,4,0,1,
+17029,1,17019,1,
+17029,2,10,17025,1,
+17029,3,17019,6,0,1,
+17029,4,10,17017,10,0,1,
+17033,1,17030,1,
+17033,2,3,17027,1,
+17033,3,17030,5,0,1,
+17033,4,3,14449,1,0,1,
+17041,1,17034,1,
+17041,2,7,17034,1,
+17041,3,17034,1,0,1,
+17041,4,7,16291,0,0,1,
+17047,1,17044,1,
+17047,2,3,17046,1,
+17047,3,17044,1,0,1,
+17047,4,3,11227,2,0,1,
+17053,1,17051,1,
+17053,2,2,17049,1,
+17053,3,17051,4,0,1,
+17053,4,2,14289,10,0,1,
+17077,1,17075,1,
+17077,2,2,17073,1,
+17077,3,17075,6,0,1,
+17077,4,2,8890,36,0,1,
+17093,1,17091,1,
+17093,2,2,17089,1,
+17093,3,17091,2,0,1,
+17093,4,2,12893,1,0,1,
+17099,1,17097,1,
+17099,2,2,17098,1,
+17099,3,17097,3,0,1,
+17099,4,2,13487,2,0,1,
+17107,1,17104,1,
+17107,2,3,17106,1,
+17107,3,17104,5,0,1,
+17107,4,3,16922,2,0,1,
+17117,1,17114,1,
+17117,2,3,17115,1,
+17117,3,17114,4,0,1,
+17117,4,3,14382,14,0,1,
+17123,1,17121,1,
+17123,2,2,17119,1,
+17123,3,17121,3,0,1,
+17123,4,2,14197,7,0,1,
+17137,1,17132,1,
+17137,2,5,17136,1,
+17137,3,17132,1,0,1,
+17137,4,5,11563,6,0,1,
+17159,1,17152,1,
+17159,2,7,17158,1,
+17159,3,17152,1,0,1,
+17159,4,7,16866,3,0,1,
+17167,1,17164,1,
+17167,2,3,17166,1,
+17167,3,17164,11,0,1,
+17167,4,3,10995,2,0,1,
+17183,1,17178,1,
+17183,2,5,17178,1,
+17183,3,17178,1,0,1,
+17183,4,5,11186,7,0,1,
+17189,1,17187,1,
+17189,2,2,17177,1,
+17189,3,17187,4,0,1,
+17189,4,2,8834,1,0,1,
+17191,1,17188,1,
+17191,2,3,17189,1,
+17191,3,17188,4,0,1,
+17191,4,3,11345,3,0,1,
+17203,1,17201,1,
+17203,2,2,17199,1,
+17203,3,17201,5,0,1,
+17203,4,2,16333,8,0,1,
+17207,1,17202,1,
+17207,2,5,17205,1,
+17207,3,17202,3,0,1,
+17207,4,5,17203,3,0,1,
+17209,1,17195,1,
+17209,2,14,17202,1,
+17209,3,17195,5,0,1,
+17209,4,14,8751,0,0,1,
+17231,1,17218,1,
+17231,2,13,17227,1,
+17231,3,17218,3,0,1,
+17231,4,13,9900,6,0,1,
+17239,1,17233,1,
+17239,2,6,17237,1,
+17239,3,17233,3,0,1,
+17239,4,6,9995,3,0,1,
+17257,1,17252,1,
+17257,2,5,17252,1,
+17257,3,17252,1,0,1,
+17257,4,5,12127,10,0,1,
+17291,1,17285,1,
+17291,2,6,17288,1,
+17291,3,17285,1,0,1,
+17291,4,6,9115,1,0,1,
+17293,1,17286,1,
+17293,2,7,17291,1,
+17293,3,17286,3,0,1,
+17293,4,7,13974,7,0,1,
+17299,1,17297,1,
+17299,2,2,17295,1,
+17299,3,17297,6,0,1,
+17299,4,2,16555,8,0,1,
+17317,1,17315,1,
+17317,2,2,17316,1,
+17317,3,17315,2,0,1,
+17317,4,2,14695,6,0,1,
+17321,1,17318,1,
+17321,2,3,17316,1,
+17321,3,17318,6,0,1,
+17321,4,3,11113,2,0,1,
+17327,1,17322,1,
+17327,2,5,17324,1,
+17327,3,17322,2,0,1,
+17327,4,5,12024,11,0,1,
+17333,1,17331,1,
+17333,2,2,17329,1,
+17333,3,17331,3,0,1,
+17333,4,2,15647,6,0,1,
+17341,1,17335,1,
+17341,2,6,17340,1,
+17341,3,17335,4,0,1,
+17341,4,6,16573,11,0,1,
+17351,1,17340,1,
+17351,2,11,17350,1,
+17351,3,17340,2,0,1,
+17351,4,11,8850,3,0,1,
+17359,1,17356,1,
+17359,2,3,17357,1,
+17359,3,17356,3,0,1,
+17359,4,3,14524,3,0,1,
+17377,1,17370,1,
+17377,2,7,17370,1,
+17377,3,17370,2,0,1,
+17377,4,7,13357,17,0,1,
+17383,1,17378,1,
+17383,2,5,17381,1,
+17383,3,17378,6,0,1,
+17383,4,5,17379,3,0,1,
+17387,1,17385,1,
+17387,2,2,17380,1,
+17387,3,17385,4,0,1,
+17387,4,2,11427,8,0,1,
+17389,1,17387,1,
+17389,2,2,17385,1,
+17389,3,17387,6,0,1,
+17389,4,2,14053,12,0,1,
+17393,1,17390,1,
+17393,2,3,17387,1,
+17393,3,17390,5,0,1,
+17393,4,3,15367,9,0,1,
+17401,1,17390,1,
+17401,2,11,17400,1,
+17401,3,17390,2,0,1,
+17401,4,11,8849,8,0,1,
+17417,1,17414,1,
+17417,2,3,17408,1,
+17417,3,17414,5,0,1,
+17417,4,3,12851,6,0,1,
+17419,1,17416,1,
+17419,2,3,17418,1,
+17419,3,17416,3,0,1,
+17419,4,3,14679,2,0,1,
+17431,1,17428,1,
+17431,2,3,17430,1,
+17431,3,17428,1,0,1,
+17431,4,3,16720,3,0,1,
+17443,1,17441,1,
+17443,2,2,17439,1,
+17443,3,17441,6,0,1,
+17443,4,2,9848,1,0,1,
+17449,1,17435,1,
+17449,2,14,17444,1,
+17449,3,17435,4,0,1,
+17449,4,14,15512,19,0,1,
+17467,1,17464,1,
+17467,2,3,17466,1,
+17467,3,17464,12,0,1,
+17467,4,3,13632,2,0,1,
+17471,1,17460,1,
+17471,2,11,17468,1,
+17471,3,17460,2,0,1,
+17471,4,11,9740,5,0,1,
+17477,1,17475,1,
+17477,2,2,17476,1,
+17477,3,17475,3,0,1,
+17477,4,2,10983,6,0,1,
+17483,1,17481,1,
+17483,2,2,17478,1,
+17483,3,17481,5,0,1,
+17483,4,2,16596,3,0,1,
+17489,1,17486,1,
+17489,2,3,17480,1,
+17489,3,17486,4,0,1,
+17489,4,3,12697,6,0,1,
+17491,1,17488,1,
+17491,2,3,17486,1,
+17491,3,17488,4,0,1,
+17491,4,3,11158,3,0,1,
+17497,1,17492,1,
+17497,2,5,17494,1,
+17497,3,17492,2,0,1,
+17497,4,5,11505,23,0,1,
+17509,1,17507,1,
+17509,2,2,17505,1,
+17509,3,17507,2,0,1,
+17509,4,2,14794,12,0,1,
+17519,1,17506,1,
+17519,2,13,17517,1,
+17519,3,17506,2,0,1,
+17519,4,13,16641,3,0,1,
+17539,1,17536,1,
+17539,2,3,17531,1,
+17539,3,17536,5,0,1,
+17539,4,3,12655,0,0,1,
+17551,1,17548,1,
+17551,2,3,17550,1,
+17551,3,17548,3,0,1,
+17551,4,3,10092,2,0,1,
+17569,1,17558,1,
+17569,2,11,17564,1,
+17569,3,17558,3,0,1,
+17569,4,11,11572,19,0,1,
+17573,1,17571,1,
+17573,2,2,17569,1,
+17573,3,17571,3,0,1,
+17573,4,2,15339,1,0,1,
+17579,1,17577,1,
+17579,2,2,17575,1,
+17579,3,17577,4,0,1,
+17579,4,2,12349,7,0,1,
+17581,1,17571,1,
+17581,2,10,17580,1,
+17581,3,17571,13,0,1,
+17581,4,10,14731,3,0,1,
+17597,1,17595,1,
+17597,2,2,17596,1,
+17597,3,17595,2,0,1,
+17597,4,2,13272,3,0,1,
+17599,1,17593,1,
+17599,2,6,17597,1,
+17599,3,17593,1,0,1,
+17599,4,6,11910,10,0,1,
+17609,1,17606,1,
+17609,2,3,17603,1,
+17609,3,17606,1,0,1,
+17609,4,3,17597,0,0,1,
+17623,1,17620,1,
+17623,2,3,17621,1,
+17623,3,17620,1,0,1,
+17623,4,3,10124,3,0,1,
+17627,1,17625,1,
+17627,2,2,17621,1,
+17627,3,17625,4,0,1,
+17627,4,2,9640,4,0,1,
+17657,1,17654,1,
+17657,2,3,17648,1,
+17657,3,17654,5,0,1,
+17657,4,3,16553,2,0,1,
+17659,1,17656,1,
+17659,2,3,17643,1,
+17659,3,17656,1,0,1,
+17659,4,3,9493,3,0,1,
+17669,1,17667,1,
+17669,2,2,17665,1,
+17669,3,17667,3,0,1,
+17669,4,2,13132,6,0,1,
+17681,1,17678,1,
+17681,2,3,17675,1,
+17681,3,17678,1,0,1,
+17681,4,3,17669,0,0,1,
+17683,1,17678,1,
+17683,2,5,17682,1,
+17683,3,17678,7,0,1,
+17683,4,5,10266,5,0,1,
+17707,1,17704,1,
+17707,2,3,17706,1,
+17707,3,17704,9,0,1,
+17707,4,3,9502,2,0,1,
+17713,1,17706,1,
+17713,2,7,17706,1,
+17713,3,17706,1,0,1,
+17713,4,7,10800,12,0,1,
+17729,1,17726,1,
+17729,2,3,17723,1,
+17729,3,17726,14,0,1,
+17729,4,3,17717,0,0,1,
+17737,1,17730,1,
+17737,2,7,17730,1,
+17737,3,17730,4,0,1,
+17737,4,7,12831,20,0,1,
+17747,1,17745,1,
+17747,2,2,17743,1,
+17747,3,17745,3,0,1,
+17747,4,2,10694,8,0,1,
+17749,1,17747,1,
+17749,2,2,17740,1,
+17749,3,17747,2,0,1,
+17749,4,2,13430,15,0,1,
+17761,1,17742,1,
+17761,2,19,17748,1,
+17761,3,17742,1,0,1,
+17761,4,19,14869,32,0,1,
+17783,1,17778,1,
+17783,2,5,17778,1,
+17783,3,17778,5,0,1,
+17783,4,5,9981,6,0,1,
+17789,1,17787,1,
+17789,2,2,17784,1,
+17789,3,17787,3,0,1,
+17789,4,2,10357,18,0,1,
+17791,1,17788,1,
+17791,2,3,17789,1,
+17791,3,17788,4,0,1,
+17791,4,3,12096,6,0,1,
+17807,1,17802,1,
+17807,2,5,17802,1,
+17807,3,17802,1,0,1,
+17807,4,5,17454,13,0,1,
+17827,1,17825,1,
+17827,2,2,17826,1,
+17827,3,17825,2,0,1,
+17827,4,2,11229,11,0,1,
+17837,1,17835,1,
+17837,2,2,17833,1,
+17837,3,17835,3,0,1,
+17837,4,2,14362,7,0,1,
+17839,1,17833,1,
+17839,2,6,17837,1,
+17839,3,17833,3,0,1,
+17839,4,6,17396,3,0,1,
+17851,1,17849,1,
+17851,2,2,17847,1,
+17851,3,17849,2,0,1,
+17851,4,2,13825,8,0,1,
+17863,1,17857,1,
+17863,2,6,17862,1,
+17863,3,17857,1,0,1,
+17863,4,6,16183,3,0,1,
+17881,1,17874,1,
+17881,2,7,17878,1,
+17881,3,17874,1,0,1,
+17881,4,7,9480,29,0,1,
+17891,1,17889,1,
+17891,2,2,17887,1,
+17891,3,17889,3,0,1,
+17891,4,2,12191,11,0,1,
+17903,1,17898,1,
+17903,2,5,17898,1,
+17903,3,17898,13,0,1,
+17903,4,5,17549,6,0,1,
+17909,1,17907,1,
+17909,2,2,17903,1,
+17909,3,17907,3,0,1,
+17909,4,2,12859,3,0,1,
+17911,1,17908,1,
+17911,2,3,17909,1,
+17911,3,17908,3,0,1,
+17911,4,3,9990,3,0,1,
+17921,1,17918,1,
+17921,2,3,17914,1,
+17921,3,17918,8,0,1,
+17921,4,3,15904,1,0,1,
+17923,1,17921,1,
+17923,2,2,17922,1,
+17923,3,17921,2,0,1,
+17923,4,2,12671,2,0,1,
+17929,1,17918,1,
+17929,2,11,17915,1,
+17929,3,17918,3,0,1,
+17929,4,11,15684,1,0,1,
+17939,1,17937,1,
+17939,2,2,17932,1,
+17939,3,17937,5,0,1,
+17939,4,2,9366,1,0,1,
+17957,1,17955,1,
+17957,2,2,17952,1,
+17957,3,17955,5,0,1,
+17957,4,2,16029,0,0,1,
+17959,1,17953,1,
+17959,2,6,17957,1,
+17959,3,17953,14,0,1,
+17959,4,6,15994,4,0,1,
+17971,1,17968,1,
+17971,2,3,17970,1,
+17971,3,17968,7,0,1,
+17971,4,3,10615,6,0,1,
+17977,1,17972,1,
+17977,2,5,17976,1,
+17977,3,17972,16,0,1,
+17977,4,5,11843,6,0,1,
+17981,1,17979,1,
+17981,2,2,17980,1,
+17981,3,17979,12,0,1,
+17981,4,2,14248,3,0,1,
+17987,1,17982,1,
+17987,2,5,17984,1,
+17987,3,17982,2,0,1,
+17987,4,5,14070,1,0,1,
+17989,1,17987,1,
+17989,2,2,17988,1,
+17989,3,17987,6,0,1,
+17989,4,2,14690,9,0,1,
+18013,1,18011,1,
+18013,2,2,18009,1,
+18013,3,18011,6,0,1,
+18013,4,2,15982,6,0,1,
+18041,1,18038,1,
+18041,2,3,18035,1,
+18041,3,18038,4,0,1,
+18041,4,3,18029,0,0,1,
+18043,1,18041,1,
+18043,2,2,18039,1,
+18043,3,18041,4,0,1,
+18043,4,2,13772,8,0,1,
+18047,1,18042,1,
+18047,2,5,18044,1,
+18047,3,18042,6,0,1,
+18047,4,5,11073,4,0,1,
+18049,1,18036,1,
+18049,2,13,18048,1,
+18049,3,18036,3,0,1,
+18049,4,13,15234,15,0,1,
+18059,1,18057,1,
+18059,2,2,18054,1,
+18059,3,18057,10,0,1,
+18059,4,2,11939,3,0,1,
+18061,1,18055,1,
+18061,2,6,18057,1,
+18061,3,18055,1,0,1,
+18061,4,6,9650,2,0,1,
+18077,1,18075,1,
+18077,2,2,18071,1,
+18077,3,18075,5,0,1,
+18077,4,2,12604,1,0,1,
+18089,1,18086,1,
+18089,2,3,18084,1,
+18089,3,18086,3,0,1,
+18089,4,3,9195,2,0,1,
+18097,1,18092,1,
+18097,2,5,18094,1,
+18097,3,18092,3,0,1,
+18097,4,5,14769,23,0,1,
+18119,1,18102,1,
+18119,2,17,18117,1,
+18119,3,18102,2,0,1,
+18119,4,17,18111,3,0,1,
+18121,1,18098,1,
+18121,2,23,18120,1,
+18121,3,18098,3,0,1,
+18121,4,23,17654,8,0,1,
+18127,1,18124,1,
+18127,2,3,18126,1,
+18127,3,18124,6,0,1,
+18127,4,3,18116,12,0,1,
+18131,1,18124,1,
+18131,2,7,18127,1,
+18131,3,18124,2,0,1,
+18131,4,7,12288,2,0,1,
+18133,1,18128,1,
+18133,2,5,18128,1,
+18133,3,18128,6,0,1,
+18133,4,5,13395,7,0,1,
+18143,1,18138,1,
+18143,2,5,18135,1,
+18143,3,18138,5,0,1,
+18143,4,5,15942,3,0,1,
+18149,1,18147,1,
+18149,2,2,18148,1,
+18149,3,18147,3,0,1,
+18149,4,2,16538,3,0,1,
+18169,1,18158,1,
+18169,2,11,18154,1,
+18169,3,18158,3,0,1,
+18169,4,11,17818,37,0,1,
+18181,1,18179,1,
+18181,2,2,18177,1,
+18181,3,18179,6,0,1,
+18181,4,2,9768,12,0,1,
+18191,1,18162,1,
+18191,2,29,18190,1,
+18191,3,18162,6,0,1,
+18191,4,29,15236,4,0,1,
+18199,1,18188,1,
+18199,2,11,18197,1,
+18199,3,18188,3,0,1,
+18199,4,11,13365,3,0,1,
+18211,1,18204,1,
+18211,2,7,18205,1,
+18211,3,18204,1,0,1,
+18211,4,7,11326,7,0,1,
+18217,1,18210,1,
+18217,2,7,18214,1,
+18217,3,18210,3,0,1,
+18217,4,7,11839,20,0,1,
+18223,1,18220,1,
+18223,2,3,18222,1,
+18223,3,18220,4,0,1,
+18223,4,3,16672,16,0,1,
+18229,1,18227,1,
+18229,2,2,18225,1,
+18229,3,18227,4,0,1,
+18229,4,2,17959,6,0,1,
+18233,1,18230,1,
+18233,2,3,18232,1,
+18233,3,18230,1,0,1,
+18233,4,3,9739,6,0,1,
+18251,1,18249,1,
+18251,2,2,18246,1,
+18251,3,18249,2,0,1,
+18251,4,2,11575,3,0,1,
+18253,1,18248,1,
+18253,2,5,18252,1,
+18253,3,18248,17,0,1,
+18253,4,5,11906,3,0,1,
+18257,1,18252,1,
+18257,2,5,18249,1,
+18257,3,18252,2,0,1,
+18257,4,5,16485,13,0,1,
+18269,1,18267,1,
+18269,2,2,18265,1,
+18269,3,18267,3,0,1,
+18269,4,2,9937,1,0,1,
+18287,1,18282,1,
+18287,2,5,18282,1,
+18287,3,18282,1,0,1,
+18287,4,5,13947,7,0,1,
+18289,1,18276,1,
+18289,2,13,18280,1,
+18289,3,18276,3,0,1,
+18289,4,13,9706,16,0,1,
+18301,1,18295,1,
+18301,2,6,18297,1,
+18301,3,18295,1,0,1,
+18301,4,6,18297,6,0,1,
+18307,1,18296,1,
+18307,2,11,18306,1,
+18307,3,18296,7,0,1,
+18307,4,11,16831,2,0,1,
+18311,1,18298,1,
+18311,2,13,18307,1,
+18311,3,18298,2,0,1,
+18311,4,13,14877,6,0,1,
+18313,1,18303,1,
+18313,2,10,18310,1,
+18313,3,18303,3,0,1,
+18313,4,10,17080,13,0,1,
+18329,1,18326,1,
+18329,2,3,18323,1,
+18329,3,18326,4,0,1,
+18329,4,3,18317,0,0,1,
+18341,1,18338,1,
+18341,2,3,18336,1,
+18341,3,18338,3,0,1,
+18341,4,3,14231,2,0,1,
+18353,1,18350,1,
+18353,2,3,18341,1,
+18353,3,18350,6,0,1,
+18353,4,3,16535,0,0,1,
+18367,1,18364,1,
+18367,2,3,18366,1,
+18367,3,18364,1,0,1,
+18367,4,3,9844,5,0,1,
+18371,1,18360,1,
+18371,2,11,18368,1,
+18371,3,18360,4,0,1,
+18371,4,11,16148,1,0,1,
+18379,1,18376,1,
+18379,2,3,18368,1,
+18379,3,18376,1,0,1,
+18379,4,3,16019,4,0,1,
+18397,1,18391,1,
+18397,2,6,18396,1,
+18397,3,18391,2,0,1,
+18397,4,6,12477,6,0,1,
+18401,1,18398,1,
+18401,2,3,18396,1,
+18401,3,18398,3,0,1,
+18401,4,3,12715,2,0,1,
+18413,1,18411,1,
+18413,2,2,18409,1,
+18413,3,18411,3,0,1,
+18413,4,2,13627,1,0,1,
+18427,1,18425,1,
+18427,2,2,18426,1,
+18427,3,18425,6,0,1,
+18427,4,2,9861,7,0,1,
+18433,1,18428,1,
+18433,2,5,18432,1,
+18433,3,18428,5,0,1,
+18433,4,5,15443,6,0,1,
+18439,1,18436,1,
+18439,2,3,18437,1,
+18439,3,18436,5,0,1,
+18439,4,3,18435,4,0,1,
+18443,1,18441,1,
+18443,2,2,18442,1,
+18443,3,18441,2,0,1,
+18443,4,2,14970,2,0,1,
+18451,1,18448,1,
+18451,2,3,18440,1,
+18451,3,18448,3,0,1,
+18451,4,3,17314,0,0,1,
+18457,1,18452,1,
+18457,2,5,18456,1,
+18457,3,18452,2,0,1,
+18457,4,5,10609,6,0,1,
+18461,1,18459,1,
+18461,2,2,18453,1,
+18461,3,18459,7,0,1,
+18461,4,2,17838,0,0,1,
+18481,1,18468,1,
+18481,2,13,18478,1,
+18481,3,18468,4,0,1,
+18481,4,13,15261,16,0,1,
+18493,1,18491,1,
+18493,2,2,18492,1,
+18493,3,18491,4,0,1,
+18493,4,2,11729,3,0,1,
+18503,1,18498,1,
+18503,2,5,18501,1,
+18503,3,18498,5,0,1,
+18503,4,5,14477,5,0,1,
+18517,1,18511,1,
+18517,2,6,18515,1,
+18517,3,18511,4,0,1,
+18517,4,6,12181,4,0,1,
+18521,1,18518,1,
+18521,2,3,18515,1,
+18521,3,18518,6,0,1,
+18521,4,3,18509,0,0,1,
+18523,1,18520,1,
+18523,2,3,18522,1,
+18523,3,18520,6,0,1,
+18523,4,3,13398,2,0,1,
+18539,1,18533,1,
+18539,2,6,18537,1,
+18539,3,18533,4,0,1,
+18539,4,6,15012,5,0,1,
+18541,1,18535,1,
+18541,2,6,18537,1,
+18541,3,18535,2,0,1,
+18541,4,6,10978,2,0,1,
+18553,1,18548,1,
+18553,2,5,18550,1,
+18553,3,18548,7,0,1,
+18553,4,5,9961,10,0,1,
+18583,1,18580,1,
+18583,2,3,18581,1,
+18583,3,18580,4,0,1,
+18583,4,3,18575,10,0,1,
+18587,1,18585,1,
+18587,2,2,18583,1,
+18587,3,18585,3,0,1,
+18587,4,2,13034,7,0,1,
+18593,1,18590,1,
+18593,2,3,18587,1,
+18593,3,18590,12,0,1,
+18593,4,3,16589,9,0,1,
+18617,1,18614,1,
+18617,2,3,18610,1,
+18617,3,18614,6,0,1,
+18617,4,3,12761,1,0,1,
+18637,1,18635,1,
+18637,2,2,18636,1,
+18637,3,18635,2,0,1,
+18637,4,2,18630,8,0,1,
+18661,1,18651,1,
+18661,2,10,18660,1,
+18661,3,18651,2,0,1,
+18661,4,10,13839,3,0,1,
+18671,1,18664,1,
+18671,2,7,18670,1,
+18671,3,18664,1,0,1,
+18671,4,7,10586,3,0,1,
+18679,1,18673,1,
+18679,2,6,18677,1,
+18679,3,18673,3,0,1,
+18679,4,6,17207,3,0,1,
+18691,1,18688,1,
+18691,2,3,18690,1,
+18691,3,18688,3,0,1,
+18691,4,3,16159,2,0,1,
+18701,1,18699,1,
+18701,2,2,18693,1,
+18701,3,18699,2,0,1,
+18701,4,2,10844,0,0,1,
+18713,1,18710,1,
+18713,2,3,18712,1,
+18713,3,18710,10,0,1,
+18713,4,3,17106,6,0,1,
+18719,1,18712,1,
+18719,2,7,18717,1,
+18719,3,18712,2,0,1,
+18719,4,7,11067,5,0,1,
+18731,1,18729,1,
+18731,2,2,18727,1,
+18731,3,18729,3,0,1,
+18731,4,2,18494,7,0,1,
+18743,1,18738,1,
+18743,2,5,18738,1,
+18743,3,18738,1,0,1,
+18743,4,5,16527,7,0,1,
+18749,1,18747,1,
+18749,2,2,18742,1,
+18749,3,18747,5,0,1,
+18749,4,2,17743,17,0,1,
+18757,1,18755,1,
+18757,2,2,18753,1,
+18757,3,18755,6,0,1,
+18757,4,2,10613,6,0,1,
+18773,1,18771,1,
+18773,2,2,18768,1,
+18773,3,18771,3,0,1,
+18773,4,2,10974,12,0,1,
+18787,1,18785,1,
+18787,2,2,18786,1,
+18787,3,18785,2,0,1,
+18787,4,2,16032,12,0,1,
+18793,1,18788,1,
+18793,2,5,18792,1,
+18793,3,18788,13,0,1,
+18793,4,5,14561,6,0,1,
+18797,1,18794,1,
+18797,2,3,18795,1,
+18797,3,18794,1,0,1,
+18797,4,3,18793,4,0,1,
+18803,1,18798,1,
+18803,2,5,18802,1,
+18803,3,18798,2,0,1,
+18803,4,5,16948,5,0,1,
+18839,1,18832,1,
+18839,2,7,18838,1,
+18839,3,18832,1,0,1,
+18839,4,7,14835,2,0,1,
+18859,1,18857,1,
+18859,2,2,18855,1,
+18859,3,18857,2,0,1,
+18859,4,2,10191,8,0,1,
+18869,1,18867,1,
+18869,2,2,18861,1,
+18869,3,18867,2,0,1,
+18869,4,2,15316,0,0,1,
+18899,1,18897,1,
+18899,2,2,18895,1,
+18899,3,18897,3,0,1,
+18899,4,2,15825,7,0,1,
+18911,1,18897,1,
+18911,2,14,18905,1,
+18911,3,18897,7,0,1,
+18911,4,14,17681,7,0,1,
+18913,1,18906,1,
+18913,2,7,18910,1,
+18913,3,18906,1,0,1,
+18913,4,7,10361,10,0,1,
+18917,1,18915,1,
+18917,2,2,18916,1,
+18917,3,18915,2,0,1,
+18917,4,2,16591,3,0,1,
+18919,1,18916,1,
+18919,2,3,18918,1,
+18919,3,18916,3,0,1,
+18919,4,3,16302,2,0,1,
+18947,1,18945,1,
+18947,2,2,18946,1,
+18947,3,18945,2,0,1,
+18947,4,2,15044,4,0,1,
+18959,1,18946,1,
+18959,2,13,18958,1,
+18959,3,18946,3,0,1,
+18959,4,13,11516,2,0,1,
+18973,1,18971,1,
+18973,2,2,18972,1,
+18973,3,18971,4,0,1,
+18973,4,2,15546,7,0,1,
+18979,1,18977,1,
+18979,2,2,18975,1,
+18979,3,18977,2,0,1,
+18979,4,2,10202,8,0,1,
+19001,1,18998,1,
+19001,2,3,18995,1,
+19001,3,18998,3,0,1,
+19001,4,3,18989,0,0,1,
+19009,1,18986,1,
+19009,2,23,19006,1,
+19009,3,18986,1,0,1,
+19009,4,23,15317,20,0,1,
+19013,1,19011,1,
+19013,2,2,19008,1,
+19013,3,19011,5,0,1,
+19013,4,2,10213,2,0,1,
+19031,1,19020,1,
+19031,2,11,19029,1,
+19031,3,19020,2,0,1,
+19031,4,11,16760,3,0,1,
+19037,1,19035,1,
+19037,2,2,19033,1,
+19037,3,19035,3,0,1,
+19037,4,2,16206,6,0,1,
+19051,1,19049,1,
+19051,2,2,19047,1,
+19051,3,19049,2,0,1,
+19051,4,2,18812,8,0,1,
+19069,1,19067,1,
+19069,2,2,19064,1,
+19069,3,19067,2,0,1,
+19069,4,2,10991,7,0,1,
+19073,1,19070,1,
+19073,2,3,19068,1,
+19073,3,19070,3,0,1,
+19073,4,3,15571,0,0,1,
+19079,1,19072,1,
+19079,2,7,19077,1,
+19079,3,19072,5,0,1,
+19079,4,7,10494,4,0,1,
+19081,1,19064,1,
+19081,2,17,19080,1,
+19081,3,19064,3,0,1,
+19081,4,17,18602,8,0,1,
+19087,1,19068,1,
+19087,2,19,19085,1,
+19087,3,19068,1,0,1,
+19087,4,19,15189,18,0,1,
+19121,1,19115,1,
+19121,2,6,19118,1,
+19121,3,19115,4,0,1,
+19121,4,6,12575,0,0,1,
+19139,1,19137,1,
+19139,2,2,19135,1,
+19139,3,19137,3,0,1,
+19139,4,2,18536,8,0,1,
+19141,1,19139,1,
+19141,2,2,19140,1,
+19141,3,19139,4,0,1,
+19141,4,2,9820,7,0,1,
+19157,1,19155,1,
+19157,2,2,19156,1,
+19157,3,19155,3,0,1,
+19157,4,2,12944,3,0,1,
+19163,1,19161,1,
+19163,2,2,19159,1,
+19163,3,19161,3,0,1,
+19163,4,2,16983,7,0,1,
+19181,1,19179,1,
+19181,2,2,19177,1,
+19181,3,19179,3,0,1,
+19181,4,2,13168,6,0,1,
+19183,1,19180,1,
+19183,2,3,19182,1,
+19183,3,19180,1,0,1,
+19183,4,3,10706,2,0,1,
+19207,1,19202,1,
+19207,2,5,19205,1,
+19207,3,19202,3,0,1,
+19207,4,5,17416,9,0,1,
+19211,1,19205,1,
+19211,2,6,19208,1,
+19211,3,19205,3,0,1,
+19211,4,6,17571,7,0,1,
+19213,1,19208,1,
+19213,2,5,19210,1,
+19213,3,19208,1,0,1,
+19213,4,5,13122,1,0,1,
+19219,1,19217,1,
+19219,2,2,19210,1,
+19219,3,19217,5,0,1,
+19219,4,2,15652,2,0,1,
+19231,1,19225,1,
+19231,2,6,19229,1,
+19231,3,19225,2,0,1,
+19231,4,6,13006,10,0,1,
+19237,1,19235,1,
+19237,2,2,19233,1,
+19237,3,19235,4,0,1,
+19237,4,2,10465,6,0,1,
+19249,1,19242,1,
+19249,2,7,19242,1,
+19249,3,19242,1,0,1,
+19249,4,7,10637,0,0,1,
+19259,1,19257,1,
+19259,2,2,19255,1,
+19259,3,19257,3,0,1,
+19259,4,2,18438,7,0,1,
+19267,1,19264,1,
+19267,2,3,19266,1,
+19267,3,19264,1,0,1,
+19267,4,3,11639,5,0,1,
+19273,1,19268,1,
+19273,2,5,19268,1,
+19273,3,19268,5,0,1,
+19273,4,5,13201,18,0,1,
+19289,1,19286,1,
+19289,2,3,19276,1,
+19289,3,19286,5,0,1,
+19289,4,3,14941,1,0,1,
+19301,1,19299,1,
+19301,2,2,19297,1,
+19301,3,19299,2,0,1,
+19301,4,2,16927,6,0,1,
+19309,1,19303,1,
+19309,2,6,19305,1,
+19309,3,19303,4,0,1,
+19309,4,6,18808,2,0,1,
+19319,1,19308,1,
+19319,2,11,19318,1,
+19319,3,19308,4,0,1,
+19319,4,11,18667,3,0,1,
+19333,1,19331,1,
+19333,2,2,19332,1,
+19333,3,19331,4,0,1,
+19333,4,2,9822,3,0,1,
+19373,1,19371,1,
+19373,2,2,19358,1,
+19373,3,19371,4,0,1,
+19373,4,2,13948,1,0,1,
+19379,1,19377,1,
+19379,2,2,19378,1,
+19379,3,19377,3,0,1,
+19379,4,2,10801,4,0,1,
+19381,1,19374,1,
+19381,2,7,19379,1,
+19381,3,19374,2,0,1,
+19381,4,7,12050,4,0,1,
+19387,1,19385,1,
+19387,2,2,19383,1,
+19387,3,19385,4,0,1,
+19387,4,2,13594,10,0,1,
+19391,1,19380,1,
+19391,2,11,19389,1,
+19391,3,19380,4,0,1,
+19391,4,11,11000,6,0,1,
+19403,1,19401,1,
+19403,2,2,19402,1,
+19403,3,19401,2,0,1,
+19403,4,2,10684,2,0,1,
+19417,1,19412,1,
+19417,2,5,19416,1,
+19417,3,19412,1,0,1,
+19417,4,5,15493,6,0,1,
+19421,1,19418,1,
+19421,2,3,19412,1,
+19421,3,19418,4,0,1,
+19421,4,3,13945,1,0,1,
+19423,1,19420,1,
+19423,2,3,19422,1,
+19423,3,19420,1,0,1,
+19423,4,3,14877,5,0,1,
+19427,1,19425,1,
+19427,2,2,19423,1,
+19427,3,19425,3,0,1,
+19427,4,2,11849,20,0,1,
+19429,1,19423,1,
+19429,2,6,19421,1,
+19429,3,19423,9,0,1,
+19429,4,6,11211,0,0,1,
+19433,1,19430,1,
+19433,2,3,19428,1,
+19433,3,19430,1,0,1,
+19433,4,3,13274,0,0,1,
+19441,1,19428,1,
+19441,2,13,19440,1,
+19441,3,19428,2,0,1,
+19441,4,13,14039,14,0,1,
+19447,1,19444,1,
+19447,2,3,19446,1,
+19447,3,19444,9,0,1,
+19447,4,3,18565,5,0,1,
+19457,1,19454,1,
+19457,2,3,19450,1,
+19457,3,19454,1,0,1,
+19457,4,3,19115,1,0,1,
+19463,1,19458,1,
+19463,2,5,19455,1,
+19463,3,19458,9,0,1,
+19463,4,5,16645,3,0,1,
+19469,1,19467,1,
+19469,2,2,19465,1,
+19469,3,19467,2,0,1,
+19469,4,2,16973,12,0,1,
+19471,1,19460,1,
+19471,2,11,19469,1,
+19471,3,19460,8,0,1,
+19471,4,11,14971,6,0,1,
+19477,1,19471,1,
+19477,2,6,19476,1,
+19477,3,19471,3,0,1,
+19477,4,6,14529,6,0,1,
+19483,1,19481,1,
+19483,2,2,19479,1,
+19483,3,19481,4,0,1,
+19483,4,2,15277,20,0,1,
+19489,1,19470,1,
+19489,2,19,19484,1,
+19489,3,19470,2,0,1,
+19489,4,19,14131,22,0,1,
+19501,1,19499,1,
+19501,2,2,19500,1,
+19501,3,19499,6,0,1,
+19501,4,2,16335,7,0,1,
+19507,1,19505,1,
+19507,2,2,19506,1,
+19507,3,19505,2,0,1,
+19507,4,2,17426,2,0,1,
+19531,1,19518,1,
+19531,2,13,19527,1,
+19531,3,19518,2,0,1,
+19531,4,13,19519,8,0,1,
+19541,1,19539,1,
+19541,2,2,19537,1,
+19541,3,19539,3,0,1,
+19541,4,2,14530,12,0,1,
+19543,1,19540,1,
+19543,2,3,19542,1,
+19543,3,19540,1,0,1,
+19543,4,3,13152,2,0,1,
+19553,1,19550,1,
+19553,2,3,19552,1,
+19553,3,19550,8,0,1,
+19553,4,3,14809,4,0,1,
+19559,1,19546,1,
+19559,2,13,19557,1,
+19559,3,19546,2,0,1,
+19559,4,13,17030,3,0,1,
+19571,1,19569,1,
+19571,2,2,19567,1,
+19571,3,19569,3,0,1,
+19571,4,2,11687,9,0,1,
+19577,1,19574,1,
+19577,2,3,19576,1,
+19577,3,19574,4,0,1,
+19577,4,3,17994,4,0,1,
+19583,1,19578,1,
+19583,2,5,19582,1,
+19583,3,19578,1,0,1,
+19583,4,5,19041,2,0,1,
+19597,1,19595,1,
+19597,2,2,19593,1,
+19597,3,19595,6,0,1,
+19597,4,2,18971,12,0,1,
+19603,1,19601,1,
+19603,2,2,19602,1,
+19603,3,19601,2,0,1,
+19603,4,2,19596,8,0,1,
+19609,1,19596,1,
+19609,2,13,19596,1,
+19609,3,19596,4,0,1,
+19609,4,13,19570,0,0,1,
+19661,1,19659,1,
+19661,2,2,19660,1,
+19661,3,19659,5,0,1,
+19661,4,2,17605,4,0,1,
+19681,1,19670,1,
+19681,2,11,19680,1,
+19681,3,19670,4,0,1,
+19681,4,11,14428,30,0,1,
+19687,1,19682,1,
+19687,2,5,19686,1,
+19687,3,19682,2,0,1,
+19687,4,5,11861,2,0,1,
+19697,1,19694,1,
+19697,2,3,19696,1,
+19697,3,19694,3,0,1,
+19697,4,3,19300,4,0,1,
+19699,1,19692,1,
+19699,2,7,19697,1,
+19699,3,19692,2,0,1,
+19699,4,7,12581,6,0,1,
+19709,1,19707,1,
+19709,2,2,19702,1,
+19709,3,19707,2,0,1,
+19709,4,2,11056,9,0,1,
+19717,1,19715,1,
+19717,2,2,19716,1,
+19717,3,19715,2,0,1,
+19717,4,2,10550,6,0,1,
+19727,1,19722,1,
+19727,2,5,19725,1,
+19727,3,19722,1,0,1,
+19727,4,5,19723,3,0,1,
+19739,1,19737,1,
+19739,2,2,19738,1,
+19739,3,19737,3,0,1,
+19739,4,2,13586,2,0,1,
+19751,1,19744,1,
+19751,2,7,19750,1,
+19751,3,19744,5,0,1,
+19751,4,7,12836,3,0,1,
+19753,1,19748,1,
+19753,2,5,19750,1,
+19753,3,19748,9,0,1,
+19753,4,5,19742,14,0,1,
+19759,1,19756,1,
+19759,2,3,19757,1,
+19759,3,19756,3,0,1,
+19759,4,3,11645,3,0,1,
+19763,1,19761,1,
+19763,2,2,19757,1,
+19763,3,19761,4,0,1,
+19763,4,2,11361,0,0,1,
+19777,1,19766,1,
+19777,2,11,19775,1,
+19777,3,19766,4,0,1,
+19777,4,11,19757,12,0,1,
+19793,1,19790,1,
+19793,2,3,19788,1,
+19793,3,19790,1,0,1,
+19793,4,3,16165,2,0,1,
+19801,1,19788,1,
+19801,2,13,19790,1,
+19801,3,19788,5,0,1,
+19801,4,13,16129,24,0,1,
+19813,1,19811,1,
+19813,2,2,19812,1,
+19813,3,19811,2,0,1,
+19813,4,2,18848,3,0,1,
+19819,1,19816,1,
+19819,2,3,19818,1,
+19819,3,19816,1,0,1,
+19819,4,3,16578,2,0,1,
+19841,1,19838,1,
+19841,2,3,19840,1,
+19841,3,19838,1,0,1,
+19841,4,3,10211,7,0,1,
+19843,1,19824,1,
+19843,2,19,19840,1,
+19843,3,19824,2,0,1,
+19843,4,19,15188,10,0,1,
+19853,1,19851,1,
+19853,2,2,19848,1,
+19853,3,19851,7,0,1,
+19853,4,2,15733,0,0,1,
+19861,1,19850,1,
+19861,2,11,19859,1,
+19861,3,19850,4,0,1,
+19861,4,11,19546,0,0,1,
+19867,1,19865,1,
+19867,2,2,19863,1,
+19867,3,19865,4,0,1,
+19867,4,2,17475,8,0,1,
+19889,1,19886,1,
+19889,2,3,19883,1,
+19889,3,19886,13,0,1,
+19889,4,3,19877,0,0,1,
+19891,1,19889,1,
+19891,2,2,19887,1,
+19891,3,19889,2,0,1,
+19891,4,2,11654,8,0,1,
+19913,1,19910,1,
+19913,2,3,19907,1,
+19913,3,19910,1,0,1,
+19913,4,3,10168,9,0,1,
+19919,1,19912,1,
+19919,2,7,19918,1,
+19919,3,19912,4,0,1,
+19919,4,7,11212,6,0,1,
+19927,1,19921,1,
+19927,2,6,19924,1,
+19927,3,19921,7,0,1,
+19927,4,6,17010,7,0,1,
+19937,1,19934,1,
+19937,2,3,19932,1,
+19937,3,19934,4,0,1,
+19937,4,3,11705,8,0,1,
+19949,1,19947,1,
+19949,2,2,19948,1,
+19949,3,19947,3,0,1,
+19949,4,2,18260,3,0,1,
+19961,1,19955,1,
+19961,2,6,19960,1,
+19961,3,19955,1,0,1,
+19961,4,6,12333,4,0,1,
+19963,1,19961,1,
+19963,2,2,19962,1,
+19963,3,19961,4,0,1,
+19963,4,2,15034,11,0,1,
+19973,1,19971,1,
+19973,2,2,19969,1,
+19973,3,19971,3,0,1,
+19973,4,2,10367,7,0,1,
+19979,1,19977,1,
+19979,2,2,19975,1,
+19979,3,19977,2,0,1,
+19979,4,2,17346,7,0,1,
+19991,1,19980,1,
+19991,2,11,19990,1,
+19991,3,19980,5,0,1,
+19991,4,11,13741,3,0,1,
+19993,1,19983,1,
+19993,2,10,19990,1,
+19993,3,19983,2,0,1,
+19993,4,10,10617,8,0,1,
+19997,1,19995,1,
+19997,2,2,19996,1,
+19997,3,19995,2,0,1,
+19997,4,2,16717,3,0,1,
+20011,1,19999,1,
+20011,2,12,20009,1,
+20011,3,19999,4,0,1,
+20011,4,12,15522,3,0,1,
+20021,1,20018,1,
+20021,2,3,20019,1,
+20021,3,20018,5,0,1,
+20021,4,3,20017,4,0,1,
+20023,1,20020,1,
+20023,2,3,20021,1,
+20023,3,20020,3,0,1,
+20023,4,3,20019,4,0,1,
+20029,1,20027,1,
+20029,2,2,20025,1,
+20029,3,20027,4,0,1,
+20029,4,2,17747,6,0,1,
+20047,1,20044,1,
+20047,2,3,20045,1,
+20047,3,20044,3,0,1,
+20047,4,3,10742,6,0,1,
+20051,1,20049,1,
+20051,2,2,20050,1,
+20051,3,20049,4,0,1,
+20051,4,2,15376,6,0,1,
+20063,1,20058,1,
+20063,2,5,20062,1,
+20063,3,20058,1,0,1,
+20063,4,5,17486,5,0,1,
+20071,1,20068,1,
+20071,2,3,20070,1,
+20071,3,20068,3,0,1,
+20071,4,3,13551,3,0,1,
+20089,1,20082,1,
+20089,2,7,20080,1,
+20089,3,20082,2,0,1,
+20089,4,7,16179,2,0,1,
+20101,1,20095,1,
+20101,2,6,20100,1,
+20101,3,20095,2,0,1,
+20101,4,6,16896,19,0,1,
+20107,1,20105,1,
+20107,2,2,20106,1,
+20107,3,20105,2,0,1,
+20107,4,2,20100,8,0,1,
+20113,1,20103,1,
+20113,2,10,20112,1,
+20113,3,20103,5,0,1,
+20113,4,10,19737,16,0,1,
+20117,1,20115,1,
+20117,2,2,20112,1,
+20117,3,20115,3,0,1,
+20117,4,2,17193,2,0,1,
+20123,1,20121,1,
+20123,2,2,20122,1,
+20123,3,20121,3,0,1,
+20123,4,2,20116,8,0,1,
+20129,1,20126,1,
+20129,2,3,20128,1,
+20129,3,20126,3,0,1,
+20129,4,3,14233,4,0,1,
+20143,1,20138,1,
+20143,2,5,20142,1,
+20143,3,20138,1,0,1,
+20143,4,5,15741,3,0,1,
+20147,1,20141,1,
+20147,2,6,20138,1,
+20147,3,20141,2,0,1,
+20147,4,6,16405,2,0,1,
+20149,1,20147,1,
+20149,2,2,20148,1,
+20149,3,20147,6,0,1,
+20149,4,2,11354,3,0,1,
+20161,1,20148,1,
+20161,2,13,20158,1,
+20161,3,20148,7,0,1,
+20161,4,13,10924,22,0,1,
+20173,1,20171,1,
+20173,2,2,20172,1,
+20173,3,20171,5,0,1,
+20173,4,2,12648,3,0,1,
+20177,1,20174,1,
+20177,2,3,20171,1,
+20177,3,20174,14,0,1,
+20177,4,3,12724,9,0,1,
+20183,1,20178,1,
+20183,2,5,20175,1,
+20183,3,20178,2,0,1,
+20183,4,5,19020,1,0,1,
+20201,1,20195,1,
+20201,2,6,20195,1,
+20201,3,20195,2,0,1,
+20201,4,6,15004,0,0,1,
+20219,1,20217,1,
+20219,2,2,20218,1,
+20219,3,20217,3,0,1,
+20219,4,2,11006,2,0,1,
+20231,1,20202,1,
+20231,2,29,20230,1,
+20231,3,20202,6,0,1,
+20231,4,29,19120,3,0,1,
+20233,1,20228,1,
+20233,2,5,20228,1,
+20233,3,20228,1,0,1,
+20233,4,5,16403,10,0,1,
+20249,1,20246,1,
+20249,2,3,20243,1,
+20249,3,20246,1,0,1,
+20249,4,3,20237,0,0,1,
+20261,1,20259,1,
+20261,2,2,20260,1,
+20261,3,20259,4,0,1,
+20261,4,2,18378,3,0,1,
+20269,1,20267,1,
+20269,2,2,20265,1,
+20269,3,20267,2,0,1,
+20269,4,2,19095,6,0,1,
+20287,1,20282,1,
+20287,2,5,20286,1,
+20287,3,20282,3,0,1,
+20287,4,5,11622,3,0,1,
+20297,1,20294,1,
+20297,2,3,20296,1,
+20297,3,20294,4,0,1,
+20297,4,3,12438,11,0,1,
+20323,1,20321,1,
+20323,2,2,20319,1,
+20323,3,20321,4,0,1,
+20323,4,2,19228,8,0,1,
+20327,1,20322,1,
+20327,2,5,20325,1,
+20327,3,20322,2,0,1,
+20327,4,5,20323,3,0,1,
+20333,1,20330,1,
+20333,2,3,20326,1,
+20333,3,20330,11,0,1,
+20333,4,3,15379,2,0,1,
+20341,1,20339,1,
+20341,2,2,20340,1,
+20341,3,20339,6,0,1,
+20341,4,2,10330,3,0,1,
+20347,1,20344,1,
+20347,2,3,20346,1,
+20347,3,20344,4,0,1,
+20347,4,3,11117,2,0,1,
+20353,1,20348,1,
+20353,2,5,20348,1,
+20353,3,20348,2,0,1,
+20353,4,5,20106,15,0,1,
+20357,1,20355,1,
+20357,2,2,20349,1,
+20357,3,20355,4,0,1,
+20357,4,2,12291,19,0,1,
+20359,1,20348,1,
+20359,2,11,20356,1,
+20359,3,20348,2,0,1,
+20359,4,11,19263,4,0,1,
+20369,1,20366,1,
+20369,2,3,20364,1,
+20369,3,20366,4,0,1,
+20369,4,3,14324,2,0,1,
+20389,1,20383,1,
+20389,2,6,20385,1,
+20389,3,20383,2,0,1,
+20389,4,6,10912,2,0,1,
+20393,1,20390,1,
+20393,2,3,20392,1,
+20393,3,20390,1,0,1,
+20393,4,3,12277,7,0,1,
+20399,1,20392,1,
+20399,2,7,20395,1,
+20399,3,20392,7,0,1,
+20399,4,7,10542,5,0,1,
+20407,1,20402,1,
+20407,2,5,20405,1,
+20407,3,20402,3,0,1,
+20407,4,5,20403,3,0,1,
+20411,1,20405,1,
+20411,2,6,20410,1,
+20411,3,20405,1,0,1,
+20411,4,6,10887,5,0,1,
+20431,1,20428,1,
+20431,2,3,20429,1,
+20431,3,20428,13,0,1,
+20431,4,3,20427,4,0,1,
+20441,1,20438,1,
+20441,2,3,20435,1,
+20441,3,20438,4,0,1,
+20441,4,3,20429,0,0,1,
+20443,1,20441,1,
+20443,2,2,20442,1,
+20443,3,20441,2,0,1,
+20443,4,2,16404,2,0,1,
+20477,1,20475,1,
+20477,2,2,20473,1,
+20477,3,20475,3,0,1,
+20477,4,2,12367,7,0,1,
+20479,1,20476,1,
+20479,2,3,20478,1,
+20479,3,20476,3,0,1,
+20479,4,3,16508,2,0,1,
+20483,1,20478,1,
+20483,2,5,20481,1,
+20483,3,20478,6,0,1,
+20483,4,5,20479,3,0,1,
+20507,1,20505,1,
+20507,2,2,20503,1,
+20507,3,20505,3,0,1,
+20507,4,2,11073,7,0,1,
+20509,1,20507,1,
+20509,2,2,20505,1,
+20509,3,20507,4,0,1,
+20509,4,2,11765,6,0,1,
+20521,1,20510,1,
+20521,2,11,20512,1,
+20521,3,20510,6,0,1,
+20521,4,11,13028,20,0,1,
+20533,1,20531,1,
+20533,2,2,20529,1,
+20533,3,20531,9,0,1,
+20533,4,2,12737,12,0,1,
+20543,1,20538,1,
+20543,2,5,20532,1,
+20543,3,20538,1,0,1,
+20543,4,5,12630,6,0,1,
+20549,1,20547,1,
+20549,2,2,20545,1,
+20549,3,20547,3,0,1,
+20549,4,2,12215,12,0,1,
+20551,1,20548,1,
+20551,2,3,20549,1,
+20551,3,20548,1,0,1,
+20551,4,3,11603,3,0,1,
+20563,1,20560,1,
+20563,2,3,20548,1,
+20563,3,20560,1,0,1,
+20563,4,3,13174,3,0,1,
+20593,1,20588,1,
+20593,2,5,20586,1,
+20593,3,20588,1,0,1,
+20593,4,5,10926,12,0,1,
+20599,1,20596,1,
+20599,2,3,20598,1,
+20599,3,20596,1,0,1,
+20599,4,3,20396,2,0,1,
+20611,1,20609,1,
+20611,2,2,20610,1,
+20611,3,20609,4,0,1,
+20611,4,2,19726,2,0,1,
+20627,1,20625,1,
+20627,2,2,20626,1,
+20627,3,20625,3,0,1,
+20627,4,2,11219,2,0,1,
+20639,1,20628,1,
+20639,2,11,20636,1,
+20639,3,20628,8,0,1,
+20639,4,11,19354,6,0,1,
+20641,1,20634,1,
+20641,2,7,20634,1,
+20641,3,20634,2,0,1,
+20641,4,7,17957,0,0,1,
+20663,1,20658,1,
+20663,2,5,20655,1,
+20663,3,20658,2,0,1,
+20663,4,5,14980,3,0,1,
+20681,1,20678,1,
+20681,2,3,20676,1,
+20681,3,20678,3,0,1,
+20681,4,3,11466,2,0,1,
+20693,1,20691,1,
+20693,2,2,20689,1,
+20693,3,20691,3,0,1,
+20693,4,2,11356,9,0,1,
+20707,1,20702,1,
+20707,2,5,20705,1,
+20707,3,20702,3,0,1,
+20707,4,5,20703,3,0,1,
+20717,1,20715,1,
+20717,2,2,20713,1,
+20717,3,20715,3,0,1,
+20717,4,2,19390,6,0,1,
+20719,1,20716,1,
+20719,2,3,20718,1,
+20719,3,20716,3,0,1,
+20719,4,3,16971,3,0,1,
+20731,1,20729,1,
+20731,2,2,20727,1,
+20731,3,20729,2,0,1,
+20731,4,2,15429,8,0,1,
+20743,1,20738,1,
+20743,2,5,20742,1,
+20743,3,20738,5,0,1,
+20743,4,5,13294,5,0,1,
+20747,1,20742,1,
+20747,2,5,20746,1,
+20747,3,20742,3,0,1,
+20747,4,5,19111,8,0,1,
+20749,1,20747,1,
+20749,2,2,20745,1,
+20749,3,20747,4,0,1,
+20749,4,2,16542,10,0,1,
+20753,1,20750,1,
+20753,2,3,20748,1,
+20753,3,20750,3,0,1,
+20753,4,3,15131,0,0,1,
+20759,1,20752,1,
+20759,2,7,20758,1,
+20759,3,20752,8,0,1,
+20759,4,7,17518,2,0,1,
+20771,1,20769,1,
+20771,2,2,20767,1,
+20771,3,20769,3,0,1,
+20771,4,2,10858,8,0,1,
+20773,1,20771,1,
+20773,2,2,20769,1,
+20773,3,20771,4,0,1,
+20773,4,2,11356,10,0,1,
+20789,1,20787,1,
+20789,2,2,20785,1,
+20789,3,20787,3,0,1,
+20789,4,2,15511,1,0,1,
+20807,1,20802,1,
+20807,2,5,20805,1,
+20807,3,20802,7,0,1,
+20807,4,5,20803,3,0,1,
+20809,1,20802,1,
+20809,2,7,20802,1,
+20809,3,20802,2,0,1,
+20809,4,7,17529,0,0,1,
+20849,1,20846,1,
+20849,2,3,20843,1,
+20849,3,20846,11,0,1,
+20849,4,3,20837,0,0,1,
+20857,1,20847,1,
+20857,2,10,20856,1,
+20857,3,20847,5,0,1,
+20857,4,10,18094,14,0,1,
+20873,1,20870,1,
+20873,2,3,20868,1,
+20873,3,20870,4,0,1,
+20873,4,3,19344,0,0,1,
+20879,1,20868,1,
+20879,2,11,20877,1,
+20879,3,20868,1,0,1,
+20879,4,11,12172,7,0,1,
+20887,1,20884,1,
+20887,2,3,20885,1,
+20887,3,20884,1,0,1,
+20887,4,3,17620,6,0,1,
+20897,1,20894,1,
+20897,2,3,20892,1,
+20897,3,20894,4,0,1,
+20897,4,3,18719,0,0,1,
+20899,1,20897,1,
+20899,2,2,20895,1,
+20899,3,20897,2,0,1,
+20899,4,2,11108,8,0,1,
+20903,1,20898,1,
+20903,2,5,20901,1,
+20903,3,20898,1,0,1,
+20903,4,5,20899,3,0,1,
+20921,1,20918,1,
+20921,2,3,20915,1,
+20921,3,20918,4,0,1,
+20921,4,3,20909,0,0,1,
+20929,1,20922,1,
+20929,2,7,20926,1,
+20929,3,20922,3,0,1,
+20929,4,7,15261,14,0,1,
+20939,1,20937,1,
+20939,2,2,20928,1,
+20939,3,20937,10,0,1,
+20939,4,2,12137,3,0,1,
+20947,1,20944,1,
+20947,2,3,20940,1,
+20947,3,20944,1,0,1,
+20947,4,3,17590,8,0,1,
+20959,1,20952,1,
+20959,2,7,20948,1,
+20959,3,20952,3,0,1,
+20959,4,7,18067,0,0,1,
+20963,1,20961,1,
+20963,2,2,20962,1,
+20963,3,20961,2,0,1,
+20963,4,2,20712,17,0,1,
+20981,1,20979,1,
+20981,2,2,20977,1,
+20981,3,20979,2,0,1,
+20981,4,2,17538,6,0,1,
+20983,1,20980,1,
+20983,2,3,20982,1,
+20983,3,20980,4,0,1,
+20983,4,3,10920,2,0,1,
+21001,1,20990,1,
+21001,2,11,20992,1,
+21001,3,20990,2,0,1,
+21001,4,11,11284,20,0,1,
+21011,1,21009,1,
+21011,2,2,21004,1,
+21011,3,21009,2,0,1,
+21011,4,2,12497,1,0,1,
+21013,1,21011,1,
+21013,2,2,21012,1,
+21013,3,21011,2,0,1,
+21013,4,2,15841,6,0,1,
+21017,1,21014,1,
+21017,2,3,21011,1,
+21017,3,21014,5,0,1,
+21017,4,3,12444,11,0,1,
+21019,1,21017,1,
+21019,2,2,21018,1,
+21019,3,21017,6,0,1,
+21019,4,2,17038,6,0,1,
+21023,1,21018,1,
+21023,2,5,21020,1,
+21023,3,21018,3,0,1,
+21023,4,5,18234,4,0,1,
+21031,1,21019,1,
+21031,2,12,21030,1,
+21031,3,21019,1,0,1,
+21031,4,12,11608,2,0,1,
+21059,1,21057,1,
+21059,2,2,21058,1,
+21059,3,21057,3,0,1,
+21059,4,2,17715,2,0,1,
+21061,1,21054,1,
+21061,2,7,21059,1,
+21061,3,21054,1,0,1,
+21061,4,7,14335,4,0,1,
+21067,1,21065,1,
+21067,2,2,21063,1,
+21067,3,21065,5,0,1,
+21067,4,2,16954,8,0,1,
+21089,1,21086,1,
+21089,2,3,21079,1,
+21089,3,21086,6,0,1,
+21089,4,3,11010,4,0,1,
+21101,1,21099,1,
+21101,2,2,21100,1,
+21101,3,21099,3,0,1,
+21101,4,2,12337,9,0,1,
+21107,1,21105,1,
+21107,2,2,21102,1,
+21107,3,21105,10,0,1,
+21107,4,2,18689,0,0,1,
+21121,1,21102,1,
+21121,2,19,21109,1,
+21121,3,21102,7,0,1,
+21121,4,19,11023,50,0,1,
+21139,1,21137,1,
+21139,2,2,21138,1,
+21139,3,21137,7,0,1,
+21139,4,2,13810,7,0,1,
+21143,1,21133,1,
+21143,2,10,21139,1,
+21143,3,21133,3,0,1,
+21143,4,10,16832,5,0,1,
+21149,1,21146,1,
+21149,2,3,21147,1,
+21149,3,21146,6,0,1,
+21149,4,3,21141,10,0,1,
+21157,1,21155,1,
+21157,2,2,21156,1,
+21157,3,21155,4,0,1,
+21157,4,2,13289,7,0,1,
+21163,1,21161,1,
+21163,2,2,21159,1,
+21163,3,21161,4,0,1,
+21163,4,2,11414,8,0,1,
+21169,1,21156,1,
+21169,2,13,21156,1,
+21169,3,21156,1,0,1,
+21169,4,13,21130,0,0,1,
+21179,1,21177,1,
+21179,2,2,21175,1,
+21179,3,21177,2,0,1,
+21179,4,2,13268,7,0,1,
+21187,1,21185,1,
+21187,2,2,21186,1,
+21187,3,21185,2,0,1,
+21187,4,2,18507,2,0,1,
+21191,1,21184,1,
+21191,2,7,21190,1,
+21191,3,21184,2,0,1,
+21191,4,7,20985,3,0,1,
+21193,1,21182,1,
+21193,2,11,21192,1,
+21193,3,21182,4,0,1,
+21193,4,11,13689,6,0,1,
+21211,1,21209,1,
+21211,2,2,21207,1,
+21211,3,21209,6,0,1,
+21211,4,2,20728,8,0,1,
+21221,1,21219,1,
+21221,2,2,21217,1,
+21221,3,21219,3,0,1,
+21221,4,2,18148,6,0,1,
+21227,1,21225,1,
+21227,2,2,21226,1,
+21227,3,21225,3,0,1,
+21227,4,2,15984,13,0,1,
+21247,1,21244,1,
+21247,2,3,21246,1,
+21247,3,21244,7,0,1,
+21247,4,3,14636,23,0,1,
+21269,1,21267,1,
+21269,2,2,21265,1,
+21269,3,21267,3,0,1,
+21269,4,2,13497,1,0,1,
+21277,1,21271,1,
+21277,2,6,21275,1,
+21277,3,21271,1,0,1,
+21277,4,6,11311,8,0,1,
+21283,1,21272,1,
+21283,2,11,21281,1,
+21283,3,21272,1,0,1,
+21283,4,11,21030,6,0,1,
+21313,1,21308,1,
+21313,2,5,21312,1,
+21313,3,21308,2,0,1,
+21313,4,5,11188,6,0,1,
+21317,1,21315,1,
+21317,2,2,21310,1,
+21317,3,21315,5,0,1,
+21317,4,2,17994,4,0,1,
+21319,1,21305,1,
+21319,2,14,21317,1,
+21319,3,21305,2,0,1,
+21319,4,14,11947,4,0,1,
+21323,1,21318,1,
+21323,2,5,21321,1,
+21323,3,21318,3,0,1,
+21323,4,5,15462,0,0,1,
+21341,1,21339,1,
+21341,2,2,21340,1,
+21341,3,21339,3,0,1,
+21341,4,2,11664,4,0,1,
+21347,1,21345,1,
+21347,2,2,21343,1,
+21347,3,21345,3,0,1,
+21347,4,2,19528,7,0,1,
+21377,1,21374,1,
+21377,2,3,21369,1,
+21377,3,21374,1,0,1,
+21377,4,3,20407,2,0,1,
+21379,1,21377,1,
+21379,2,2,21375,1,
+21379,3,21377,2,0,1,
+21379,4,2,10816,8,0,1,
+21383,1,21378,1,
+21383,2,5,21382,1,
+21383,3,21378,2,0,1,
+21383,4,5,11578,4,0,1,
+21391,1,21385,1,
+21391,2,6,21389,1,
+21391,3,21385,7,0,1,
+21391,4,6,17645,3,0,1,
+21397,1,21395,1,
+21397,2,2,21396,1,
+21397,3,21395,2,0,1,
+21397,4,2,16917,3,0,1,
+21401,1,21398,1,
+21401,2,3,21394,1,
+21401,3,21398,1,0,1,
+21401,4,3,17194,1,0,1,
+21407,1,21402,1,
+21407,2,5,21406,1,
+21407,3,21402,9,0,1,
+21407,4,5,15684,2,0,1,
+21419,1,21417,1,
+21419,2,2,21415,1,
+21419,3,21417,3,0,1,
+21419,4,2,15943,7,0,1,
+21433,1,21428,1,
+21433,2,5,21428,1,
+21433,3,21428,6,0,1,
+21433,4,5,18101,19,0,1,
+21467,1,21465,1,
+21467,2,2,21466,1,
+21467,3,21465,2,0,1,
+21467,4,2,15783,4,0,1,
+21481,1,21468,1,
+21481,2,13,21480,1,
+21481,3,21468,1,0,1,
+21481,4,13,11187,14,0,1,
+21487,1,21484,1,
+21487,2,3,21485,1,
+21487,3,21484,4,0,1,
+21487,4,3,20081,6,0,1,
+21491,1,21489,1,
+21491,2,2,21486,1,
+21491,3,21489,2,0,1,
+21491,4,2,17541,3,0,1,
+21493,1,21491,1,
+21493,2,2,21492,1,
+21493,3,21491,2,0,1,
+21493,4,2,15459,3,0,1,
+21499,1,21496,1,
+21499,2,3,21492,1,
+21499,3,21496,3,0,1,
+21499,4,3,13890,5,0,1,
+21503,1,21498,1,
+21503,2,5,21502,1,
+21503,3,21498,2,0,1,
+21503,4,5,14072,4,0,1,
+21517,1,21512,1,
+21517,2,5,21512,1,
+21517,3,21512,3,0,1,
+21517,4,5,16883,7,0,1,
+21521,1,21518,1,
+21521,2,3,21516,1,
+21521,3,21518,3,0,1,
+21521,4,3,15845,2,0,1,
+21523,1,21521,1,
+21523,2,2,21522,1,
+21523,3,21521,2,0,1,
+21523,4,2,20994,7,0,1,
+21529,1,21518,1,
+21529,2,11,21528,1,
+21529,3,21518,3,0,1,
+21529,4,11,15558,20,0,1,
+21557,1,21555,1,
+21557,2,2,21553,1,
+21557,3,21555,11,0,1,
+21557,4,2,12548,7,0,1,
+21559,1,21544,1,
+21559,2,15,21554,1,
+21559,3,21544,4,0,1,
+21559,4,15,16632,2,0,1,
+21563,1,21561,1,
+21563,2,2,21562,1,
+21563,3,21561,2,0,1,
+21563,4,2,21556,8,0,1,
+21569,1,21566,1,
+21569,2,3,21564,1,
+21569,3,21566,5,0,1,
+21569,4,3,19927,2,0,1,
+21577,1,21572,1,
+21577,2,5,21576,1,
+21577,3,21572,3,0,1,
+21577,4,5,12406,6,0,1,
+21587,1,21585,1,
+21587,2,2,21586,1,
+21587,3,21585,3,0,1,
+21587,4,2,15908,10,0,1,
+21589,1,21587,1,
+21589,2,2,21585,1,
+21589,3,21587,2,0,1,
+21589,4,2,12637,12,0,1,
+21599,1,21592,1,
+21599,2,7,21598,1,
+21599,3,21592,8,0,1,
+21599,4,7,15458,2,0,1,
+21601,1,21594,1,
+21601,2,7,21594,1,
+21601,3,21594,11,0,1,
+21601,4,7,18308,0,0,1,
+21611,1,21609,1,
+21611,2,2,21607,1,
+21611,3,21609,3,0,1,
+21611,4,2,21023,8,0,1,
+21613,1,21611,1,
+21613,2,2,21609,1,
+21613,3,21611,5,0,1,
+21613,4,2,21319,6,0,1,
+21617,1,21614,1,
+21617,2,3,21612,1,
+21617,3,21614,1,0,1,
+21617,4,3,20609,0,0,1,
+21647,1,21642,1,
+21647,2,5,21644,1,
+21647,3,21642,6,0,1,
+21647,4,5,13870,4,0,1,
+21649,1,21635,1,
+21649,2,14,21646,1,
+21649,3,21635,2,0,1,
+21649,4,14,10990,10,0,1,
+21661,1,21659,1,
+21661,2,2,21660,1,
+21661,3,21659,6,0,1,
+21661,4,2,20652,3,0,1,
+21673,1,21663,1,
+21673,2,10,21672,1,
+21673,3,21663,6,0,1,
+21673,4,10,11562,21,0,1,
+21683,1,21681,1,
+21683,2,2,21679,1,
+21683,3,21681,3,0,1,
+21683,4,2,21428,7,0,1,
+21701,1,21699,1,
+21701,2,2,21697,1,
+21701,3,21699,3,0,1,
+21701,4,2,11188,7,0,1,
+21713,1,21710,1,
+21713,2,3,21706,1,
+21713,3,21710,4,0,1,
+21713,4,3,11351,0,0,1,
+21727,1,21724,1,
+21727,2,3,21726,1,
+21727,3,21724,3,0,1,
+21727,4,3,20947,5,0,1,
+21737,1,21731,1,
+21737,2,6,21735,1,
+21737,3,21731,3,0,1,
+21737,4,6,15587,8,0,1,
+21739,1,21737,1,
+21739,2,2,21735,1,
+21739,3,21737,2,0,1,
+21739,4,2,20761,8,0,1,
+21751,1,21748,1,
+21751,2,3,21749,1,
+21751,3,21748,8,0,1,
+21751,4,3,18831,3,0,1,
+21757,1,21752,1,
+21757,2,5,21756,1,
+21757,3,21752,3,0,1,
+21757,4,5,20260,3,0,1,
+21767,1,21762,1,
+21767,2,5,21766,1,
+21767,3,21762,3,0,1,
+21767,4,5,11790,3,0,1,
+21773,1,21771,1,
+21773,2,2,21769,1,
+21773,3,21771,2,0,1,
+21773,4,2,14021,1,0,1,
+21787,1,21764,1,
+21787,2,23,21786,1,
+21787,3,21764,4,0,1,
+21787,4,23,17555,11,0,1,
+21799,1,21792,1,
+21799,2,7,21788,1,
+21799,3,21792,4,0,1,
+21799,4,7,12115,5,0,1,
+21803,1,21801,1,
+21803,2,2,21802,1,
+21803,3,21801,2,0,1,
+21803,4,2,13905,4,0,1,
+21817,1,21810,1,
+21817,2,7,21810,1,
+21817,3,21810,11,0,1,
+21817,4,7,16726,22,0,1,
+21821,1,21819,1,
+21821,2,2,21817,1,
+21821,3,21819,2,0,1,
+21821,4,2,15700,6,0,1,
+21839,1,21828,1,
+21839,2,11,21835,1,
+21839,3,21828,5,0,1,
+21839,4,11,14928,5,0,1,
+21841,1,21830,1,
+21841,2,11,21836,1,
+21841,3,21830,6,0,1,
+21841,4,11,21822,24,0,1,
+21851,1,21845,1,
+21851,2,6,21849,1,
+21851,3,21845,3,0,1,
+21851,4,6,15992,0,0,1,
+21859,1,21857,1,
+21859,2,2,21858,1,
+21859,3,21857,6,0,1,
+21859,4,2,16731,2,0,1,
+21863,1,21858,1,
+21863,2,5,21861,1,
+21863,3,21858,2,0,1,
+21863,4,5,18880,5,0,1,
+21871,1,21865,1,
+21871,2,6,21870,1,
+21871,3,21865,6,0,1,
+21871,4,6,17088,2,0,1,
+21881,1,21878,1,
+21881,2,3,21876,1,
+21881,3,21878,1,0,1,
+21881,4,3,11106,2,0,1,
+21893,1,21891,1,
+21893,2,2,21885,1,
+21893,3,21891,4,0,1,
+21893,4,2,20466,3,0,1,
+21911,1,21898,1,
+21911,2,13,21910,1,
+21911,3,21898,10,0,1,
+21911,4,13,16837,2,0,1,
+21929,1,21926,1,
+21929,2,3,21924,1,
+21929,3,21926,3,0,1,
+21929,4,3,18844,2,0,1,
+21937,1,21930,1,
+21937,2,7,21930,1,
+21937,3,21930,8,0,1,
+21937,4,7,19558,12,0,1,
+21943,1,21938,1,
+21943,2,5,21941,1,
+21943,3,21938,2,0,1,
+21943,4,5,21931,11,0,1,
+21961,1,21944,1,
+21961,2,17,21960,1,
+21961,3,21944,15,0,1,
+21961,4,17,18877,30,0,1,
+21977,1,21974,1,
+21977,2,3,21972,1,
+21977,3,21974,3,0,1,
+21977,4,3,18370,0,0,1,
+21991,1,21988,1,
+21991,2,3,21990,1,
+21991,3,21988,7,0,1,
+21991,4,3,17520,3,0,1,
+21997,1,21990,1,
+21997,2,7,21995,1,
+21997,3,21990,2,0,1,
+21997,4,7,18589,4,0,1,
+22003,1,22001,1,
+22003,2,2,21999,1,
+22003,3,22001,6,0,1,
+22003,4,2,20223,8,0,1,
+22013,1,22011,1,
+22013,2,2,22012,1,
+22013,3,22011,2,0,1,
+22013,4,2,11274,3,0,1,
+22027,1,22024,1,
+22027,2,3,22022,1,
+22027,3,22024,6,0,1,
+22027,4,3,16824,3,0,1,
+22031,1,22024,1,
+22031,2,7,22030,1,
+22031,3,22024,4,0,1,
+22031,4,7,22022,4,0,1,
+22037,1,22035,1,
+22037,2,2,22033,1,
+22037,3,22035,3,0,1,
+22037,4,2,19625,7,0,1,
+22039,1,22033,1,
+22039,2,6,22038,1,
+22039,3,22033,1,0,1,
+22039,4,6,19033,3,0,1,
+22051,1,22048,1,
+22051,2,3,22050,1,
+22051,3,22048,3,0,1,
+22051,4,3,11985,2,0,1,
+22063,1,22058,1,
+22063,2,5,22061,1,
+22063,3,22058,3,0,1,
+22063,4,5,20190,9,0,1,
+22067,1,22065,1,
+22067,2,2,22066,1,
+22067,3,22065,2,0,1,
+22067,4,2,17808,2,0,1,
+22073,1,22070,1,
+22073,2,3,22067,1,
+22073,3,22070,5,0,1,
+22073,4,3,15707,9,0,1,
+22079,1,22072,1,
+22079,2,7,22075,1,
+22079,3,22072,2,0,1,
+22079,4,7,13498,12,0,1,
+22091,1,22089,1,
+22091,2,2,22090,1,
+22091,3,22089,3,0,1,
+22091,4,2,13125,2,0,1,
+22093,1,22087,1,
+22093,2,6,22091,1,
+22093,3,22087,2,0,1,
+22093,4,6,19829,8,0,1,
+22109,1,22107,1,
+22109,2,2,22103,1,
+22109,3,22107,3,0,1,
+22109,4,2,18368,3,0,1,
+22111,1,22105,1,
+22111,2,6,22109,1,
+22111,3,22105,2,0,1,
+22111,4,6,20781,3,0,1,
+22123,1,22121,1,
+22123,2,2,22122,1,
+22123,3,22121,6,0,1,
+22123,4,2,17751,17,0,1,
+22129,1,22110,1,
+22129,2,19,22124,1,
+22129,3,22110,1,0,1,
+22129,4,19,14125,16,0,1,
+22133,1,22131,1,
+22133,2,2,22127,1,
+22133,3,22131,8,0,1,
+22133,4,2,15963,1,0,1,
+22147,1,22142,1,
+22147,2,5,22146,1,
+22147,3,22142,3,0,1,
+22147,4,5,16305,24,0,1,
+22153,1,22148,1,
+22153,2,5,22152,1,
+22153,3,22148,1,0,1,
+22153,4,5,11345,6,0,1,
+22157,1,22155,1,
+22157,2,2,22153,1,
+22157,3,22155,8,0,1,
+22157,4,2,19121,6,0,1,
+22159,1,22153,1,
+22159,2,6,22158,1,
+22159,3,22153,6,0,1,
+22159,4,6,21602,2,0,1,
+22171,1,22169,1,
+22171,2,2,22167,1,
+22171,3,22169,2,0,1,
+22171,4,2,16048,8,0,1,
+22189,1,22187,1,
+22189,2,2,22185,1,
+22189,3,22187,4,0,1,
+22189,4,2,14003,27,0,1,
+22193,1,22190,1,
+22193,2,3,22192,1,
+22193,3,22190,3,0,1,
+22193,4,3,12354,6,0,1,
+22229,1,22227,1,
+22229,2,2,22221,1,
+22229,3,22227,5,0,1,
+22229,4,2,15382,0,0,1,
+22247,1,22242,1,
+22247,2,5,22245,1,
+22247,3,22242,5,0,1,
+22247,4,5,17628,20,0,1,
+22259,1,22257,1,
+22259,2,2,22255,1,
+22259,3,22257,3,0,1,
+22259,4,2,12627,15,0,1,
+22271,1,22264,1,
+22271,2,7,22270,1,
+22271,3,22264,9,0,1,
+22271,4,7,12906,2,0,1,
+22273,1,22268,1,
+22273,2,5,22268,1,
+22273,3,22268,5,0,1,
+22273,4,5,22062,10,0,1,
+22277,1,22275,1,
+22277,2,2,22273,1,
+22277,3,22275,2,0,1,
+22277,4,2,18990,1,0,1,
+22279,1,22276,1,
+22279,2,3,22277,1,
+22279,3,22276,1,0,1,
+22279,4,3,15116,6,0,1,
+22283,1,22281,1,
+22283,2,2,22277,1,
+22283,3,22281,4,0,1,
+22283,4,2,18879,4,0,1,
+22291,1,22288,1,
+22291,2,3,22284,1,
+22291,3,22288,1,0,1,
+22291,4,3,20233,5,0,1,
+22303,1,22297,1,
+22303,2,6,22300,1,
+22303,3,22297,1,0,1,
+22303,4,6,19217,4,0,1,
+22307,1,22305,1,
+22307,2,2,22302,1,
+22307,3,22305,12,0,1,
+22307,4,2,19485,0,0,1,
+22343,1,22338,1,
+22343,2,5,22342,1,
+22343,3,22338,8,0,1,
+22343,4,5,20747,7,0,1,
+22349,1,22347,1,
+22349,2,2,22340,1,
+22349,3,22347,3,0,1,
+22349,4,2,12245,1,0,1,
+22367,1,22362,1,
+22367,2,5,22365,1,
+22367,3,22362,3,0,1,
+22367,4,5,22363,3,0,1,
+22369,1,22358,1,
+22369,2,11,22358,1,
+22369,3,22358,3,0,1,
+22369,4,11,20057,22,0,1,
+22381,1,22371,1,
+22381,2,10,22378,1,
+22381,3,22371,3,0,1,
+22381,4,10,20073,9,0,1,
+22391,1,22378,1,
+22391,2,13,22390,1,
+22391,3,22378,1,0,1,
+22391,4,13,19015,8,0,1,
+22397,1,22395,1,
+22397,2,2,22393,1,
+22397,3,22395,3,0,1,
+22397,4,2,17655,7,0,1,
+22409,1,22406,1,
+22409,2,3,22408,1,
+22409,3,22406,5,0,1,
+22409,4,3,11808,7,0,1,
+22433,1,22430,1,
+22433,2,3,22428,1,
+22433,3,22430,1,0,1,
+22433,4,3,21207,0,0,1,
+22441,1,22427,1,
+22441,2,14,22438,1,
+22441,3,22427,2,0,1,
+22441,4,14,15277,10,0,1,
+22447,1,22444,1,
+22447,2,3,22446,1,
+22447,3,22444,3,0,1,
+22447,4,3,16286,5,0,1,
+22453,1,22448,1,
+22453,2,5,22452,1,
+22453,3,22448,2,0,1,
+22453,4,5,11570,7,0,1,
+22469,1,22467,1,
+22469,2,2,22465,1,
+22469,3,22467,3,0,1,
+22469,4,2,18906,6,0,1,
+22481,1,22478,1,
+22481,2,3,22480,1,
+22481,3,22478,1,0,1,
+22481,4,3,20688,7,0,1,
+22483,1,22481,1,
+22483,2,2,22479,1,
+22483,3,22481,2,0,1,
+22483,4,2,13033,1,0,1,
+22501,1,22499,1,
+22501,2,2,22500,1,
+22501,3,22499,4,0,1,
+22501,4,2,12237,3,0,1,
+22511,1,22500,1,
+22511,2,11,22510,1,
+22511,3,22500,1,0,1,
+22511,4,11,19183,5,0,1,
+22531,1,22529,1,
+22531,2,2,22530,1,
+22531,3,22529,4,0,1,
+22531,4,2,22271,2,0,1,
+22541,1,22538,1,
+22541,2,3,22539,1,
+22541,3,22538,1,0,1,
+22541,4,3,22533,10,0,1,
+22543,1,22540,1,
+22543,2,3,22541,1,
+22543,3,22540,1,0,1,
+22543,4,3,20698,6,0,1,
+22549,1,22547,1,
+22549,2,2,22545,1,
+22549,3,22547,2,0,1,
+22549,4,2,19242,6,0,1,
+22567,1,22564,1,
+22567,2,3,22565,1,
+22567,3,22564,3,0,1,
+22567,4,3,14944,15,0,1,
+22571,1,22565,1,
+22571,2,6,22569,1,
+22571,3,22565,2,0,1,
+22571,4,6,22561,7,0,1,
+22573,1,22567,1,
+22573,2,6,22572,1,
+22573,3,22567,7,0,1,
+22573,4,6,12988,6,0,1,
+22613,1,22611,1,
+22613,2,2,22608,1,
+22613,3,22611,2,0,1,
+22613,4,2,13162,2,0,1,
+22619,1,22617,1,
+22619,2,2,22612,1,
+22619,3,22617,2,0,1,
+22619,4,2,19196,0,0,1,
+22621,1,22619,1,
+22621,2,2,22617,1,
+22621,3,22619,2,0,1,
+22621,4,2,20510,6,0,1,
+22637,1,22635,1,
+22637,2,2,22631,1,
+22637,3,22635,5,0,1,
+22637,4,2,17813,1,0,1,
+22639,1,22633,1,
+22639,2,6,22638,1,
+22639,3,22633,2,0,1,
+22639,4,6,22076,2,0,1,
+22643,1,22641,1,
+22643,2,2,22639,1,
+22643,3,22641,2,0,1,
+22643,4,2,14386,7,0,1,
+22651,1,22648,1,
+22651,2,3,22650,1,
+22651,3,22648,1,0,1,
+22651,4,3,17235,2,0,1,
+22669,1,22667,1,
+22669,2,2,22668,1,
+22669,3,22667,5,0,1,
+22669,4,2,15799,7,0,1,
+22679,1,22666,1,
+22679,2,13,22677,1,
+22679,3,22666,1,0,1,
+22679,4,13,13290,3,0,1,
+22691,1,22689,1,
+22691,2,2,22687,1,
+22691,3,22689,2,0,1,
+22691,4,2,20225,8,0,1,
+22697,1,22694,1,
+22697,2,3,22691,1,
+22697,3,22694,6,0,1,
+22697,4,3,22175,1,0,1,
+22699,1,22687,1,
+22699,2,12,22698,1,
+22699,3,22687,1,0,1,
+22699,4,12,19604,2,0,1,
+22709,1,22707,1,
+22709,2,2,22704,1,
+22709,3,22707,2,0,1,
+22709,4,2,21768,15,0,1,
+22717,1,22715,1,
+22717,2,2,22713,1,
+22717,3,22715,6,0,1,
+22717,4,2,22380,6,0,1,
+22721,1,22718,1,
+22721,2,3,22720,1,
+22721,3,22718,5,0,1,
+22721,4,3,20033,7,0,1,
+22727,1,22722,1,
+22727,2,5,22719,1,
+22727,3,22722,7,0,1,
+22727,4,5,13027,3,0,1,
+22739,1,22737,1,
+22739,2,2,22738,1,
+22739,3,22737,4,0,1,
+22739,4,2,12192,4,0,1,
+22741,1,22734,1,
+22741,2,7,22739,1,
+22741,3,22734,2,0,1,
+22741,4,7,17229,9,0,1,
+22751,1,22730,1,
+22751,2,21,22749,1,
+22751,3,22730,2,0,1,
+22751,4,21,18369,3,0,1,
+22769,1,22766,1,
+22769,2,3,22768,1,
+22769,3,22766,3,0,1,
+22769,4,3,16921,7,0,1,
+22777,1,22770,1,
+22777,2,7,22774,1,
+22777,3,22770,2,0,1,
+22777,4,7,13091,10,0,1,
+22783,1,22780,1,
+22783,2,3,22782,1,
+22783,3,22780,1,0,1,
+22783,4,3,21890,5,0,1,
+22787,1,22785,1,
+22787,2,2,22783,1,
+22787,3,22785,3,0,1,
+22787,4,2,11840,7,0,1,
+22807,1,22804,1,
+22807,2,3,22805,1,
+22807,3,22804,4,0,1,
+22807,4,3,22803,4,0,1,
+22811,1,22805,1,
+22811,2,6,22809,1,
+22811,3,22805,2,0,1,
+22811,4,6,22226,5,0,1,
+22817,1,22814,1,
+22817,2,3,22811,1,
+22817,3,22814,8,0,1,
+22817,4,3,12875,1,0,1,
+22853,1,22851,1,
+22853,2,2,22849,1,
+22853,3,22851,2,0,1,
+22853,4,2,11699,6,0,1,
+22859,1,22857,1,
+22859,2,2,22852,1,
+22859,3,22857,7,0,1,
+22859,4,2,13165,0,0,1,
+22861,1,22859,1,
+22861,2,2,22860,1,
+22861,3,22859,7,0,1,
+22861,4,2,11777,7,0,1,
+22871,1,22864,1,
+22871,2,7,22870,1,
+22871,3,22864,4,0,1,
+22871,4,7,22862,4,0,1,
+22877,1,22875,1,
+22877,2,2,22873,1,
+22877,3,22875,3,0,1,
+22877,4,2,15815,6,0,1,
+22901,1,22899,1,
+22901,2,2,22897,1,
+22901,3,22899,2,0,1,
+22901,4,2,22473,7,0,1,
+22907,1,22902,1,
+22907,2,5,22902,1,
+22907,3,22902,3,0,1,
+22907,4,5,19319,3,0,1,
+22921,1,22914,1,
+22921,2,7,22914,1,
+22921,3,22914,4,0,1,
+22921,4,7,18100,0,0,1,
+22937,1,22934,1,
+22937,2,3,22936,1,
+22937,3,22934,3,0,1,
+22937,4,3,12673,6,0,1,
+22943,1,22938,1,
+22943,2,5,22940,1,
+22943,3,22938,2,0,1,
+22943,4,5,15087,9,0,1,
+22961,1,22955,1,
+22961,2,6,22960,1,
+22961,3,22955,1,0,1,
+22961,4,6,19430,7,0,1,
+22963,1,22960,1,
+22963,2,3,22962,1,
+22963,3,22960,4,0,1,
+22963,4,3,12220,2,0,1,
+22973,1,22971,1,
+22973,2,2,22972,1,
+22973,3,22971,3,0,1,
+22973,4,2,22634,9,0,1,
+22993,1,22988,1,
+22993,2,5,22992,1,
+22993,3,22988,3,0,1,
+22993,4,5,20272,6,0,1,
+23003,1,23001,1,
+23003,2,2,22993,1,
+23003,3,23001,11,0,1,
+23003,4,2,18086,2,0,1,
+23011,1,23004,1,
+23011,2,7,23009,1,
+23011,3,23004,5,0,1,
+23011,4,7,15883,6,0,1,
+23017,1,23012,1,
+23017,2,5,23016,1,
+23017,3,23012,3,0,1,
+23017,4,5,20398,6,0,1,
+23021,1,23019,1,
+23021,2,2,23020,1,
+23021,3,23019,3,0,1,
+23021,4,2,21707,4,0,1,
+23027,1,23025,1,
+23027,2,2,23023,1,
+23027,3,23025,3,0,1,
+23027,4,2,19504,7,0,1,
+23029,1,23027,1,
+23029,2,2,23025,1,
+23029,3,23027,6,0,1,
+23029,4,2,15045,6,0,1,
+23039,1,23032,1,
+23039,2,7,23038,1,
+23039,3,23032,5,0,1,
+23039,4,7,16180,10,0,1,
+23041,1,23030,1,
+23041,2,11,23036,1,
+23041,3,23030,1,0,1,
+23041,4,11,23022,24,0,1,
+23053,1,23051,1,
+23053,2,2,23049,1,
+23053,3,23051,4,0,1,
+23053,4,2,19444,12,0,1,
+23057,1,23052,1,
+23057,2,5,23050,1,
+23057,3,23052,1,0,1,
+23057,4,5,16889,1,0,1,
+23059,1,23056,1,
+23059,2,3,23042,1,
+23059,3,23056,4,0,1,
+23059,4,3,16809,15,0,1,
+23063,1,23058,1,
+23063,2,5,23060,1,
+23063,3,23058,1,0,1,
+23063,4,5,16943,11,0,1,
+23071,1,23068,1,
+23071,2,3,23069,1,
+23071,3,23068,1,0,1,
+23071,4,3,17794,6,0,1,
+23081,1,23078,1,
+23081,2,3,23075,1,
+23081,3,23078,1,0,1,
+23081,4,3,23069,0,0,1,
+23087,1,23082,1,
+23087,2,5,23086,1,
+23087,3,23082,1,0,1,
+23087,4,5,22201,3,0,1,
+23099,1,23097,1,
+23099,2,2,23098,1,
+23099,3,23097,7,0,1,
+23099,4,2,16685,12,0,1,
+23117,1,23115,1,
+23117,2,2,23113,1,
+23117,3,23115,3,0,1,
+23117,4,2,12190,1,0,1,
+23131,1,23128,1,
+23131,2,3,23124,1,
+23131,3,23128,3,0,1,
+23131,4,3,12649,5,0,1,
+23143,1,23138,1,
+23143,2,5,23141,1,
+23143,3,23138,2,0,1,
+23143,4,5,23139,3,0,1,
+23159,1,23148,1,
+23159,2,11,23153,1,
+23159,3,23148,1,0,1,
+23159,4,11,23155,8,0,1,
+23167,1,23164,1,
+23167,2,3,23165,1,
+23167,3,23164,1,0,1,
+23167,4,3,14687,6,0,1,
+23173,1,23168,1,
+23173,2,5,23172,1,
+23173,3,23168,1,0,1,
+23173,4,5,21666,6,0,1,
+23189,1,23187,1,
+23189,2,2,23188,1,
+23189,3,23187,3,0,1,
+23189,4,2,19547,9,0,1,
+23197,1,23195,1,
+23197,2,2,23196,1,
+23197,3,23195,2,0,1,
+23197,4,2,21941,21,0,1,
+23201,1,23198,1,
+23201,2,3,23200,1,
+23201,3,23198,4,0,1,
+23201,4,3,19539,7,0,1,
+23203,1,23200,1,
+23203,2,3,23198,1,
+23203,3,23200,4,0,1,
+23203,4,3,19660,3,0,1,
+23209,1,23178,1,
+23209,2,31,23208,1,
+23209,3,23178,1,0,1,
+23209,4,31,11886,32,0,1,
+23227,1,23224,1,
+23227,2,3,23226,1,
+23227,3,23224,1,0,1,
+23227,4,3,13128,5,0,1,
+23251,1,23249,1,
+23251,2,2,23247,1,
+23251,3,23249,5,0,1,
+23251,4,2,17091,8,0,1,
+23269,1,23263,1,
+23269,2,6,23265,1,
+23269,3,23263,6,0,1,
+23269,4,6,21069,10,0,1,
+23279,1,23272,1,
+23279,2,7,23278,1,
+23279,3,23272,2,0,1,
+23279,4,7,22708,6,0,1,
+23291,1,23285,1,
+23291,2,6,23290,1,
+23291,3,23285,1,0,1,
+23291,4,6,12883,2,0,1,
+23293,1,23288,1,
+23293,2,5,23292,1,
+23293,3,23288,10,0,1,
+23293,4,5,18037,3,0,1,
+23297,1,23294,1,
+23297,2,3,23296,1,
+23297,3,23294,5,0,1,
+23297,4,3,14862,18,0,1,
+23311,1,23308,1,
+23311,2,3,23310,1,
+23311,3,23308,5,0,1,
+23311,4,3,21212,3,0,1,
+23321,1,23318,1,
+23321,2,3,23315,1,
+23321,3,23318,7,0,1,
+23321,4,3,23309,0,0,1,
+23327,1,23322,1,
+23327,2,5,23325,1,
+23327,3,23322,3,0,1,
+23327,4,5,21599,10,0,1,
+23333,1,23331,1,
+23333,2,2,23329,1,
+23333,3,23331,3,0,1,
+23333,4,2,17585,7,0,1,
+23339,1,23337,1,
+23339,2,2,23335,1,
+23339,3,23337,3,0,1,
+23339,4,2,21157,8,0,1,
+23357,1,23355,1,
+23357,2,2,23356,1,
+23357,3,23355,2,0,1,
+23357,4,2,14555,6,0,1,
+23369,1,23366,1,
+23369,2,3,23364,1,
+23369,3,23366,1,0,1,
+23369,4,3,15507,2,0,1,
+23371,1,23369,1,
+23371,2,2,23370,1,
+23371,3,23369,6,0,1,
+23371,4,2,17462,2,0,1,
+23399,1,23382,1,
+23399,2,17,23397,1,
+23399,3,23382,2,0,1,
+23399,4,17,23391,3,0,1,
+23417,1,23414,1,
+23417,2,3,23408,1,
+23417,3,23414,1,0,1,
+23417,4,3,15219,3,0,1,
+23431,1,23428,1,
+23431,2,3,23429,1,
+23431,3,23428,5,0,1,
+23431,4,3,23427,4,0,1,
+23447,1,23442,1,
+23447,2,5,23444,1,
+23447,3,23442,3,0,1,
+23447,4,5,18884,6,0,1,
+23459,1,23457,1,
+23459,2,2,23450,1,
+23459,3,23457,2,0,1,
+23459,4,2,17342,1,0,1,
+23473,1,23468,1,
+23473,2,5,23472,1,
+23473,3,23468,1,0,1,
+23473,4,5,12620,6,0,1,
+23497,1,23492,1,
+23497,2,5,23496,1,
+23497,3,23492,1,0,1,
+23497,4,5,23280,6,0,1,
+23509,1,23507,1,
+23509,2,2,23508,1,
+23509,3,23507,4,0,1,
+23509,4,2,18922,3,0,1,
+23531,1,23529,1,
+23531,2,2,23526,1,
+23531,3,23529,2,0,1,
+23531,4,2,20955,3,0,1,
+23537,1,23534,1,
+23537,2,3,23536,1,
+23537,3,23534,3,0,1,
+23537,4,3,20947,6,0,1,
+23539,1,23537,1,
+23539,2,2,23534,1,
+23539,3,23537,6,0,1,
+23539,4,2,13023,3,0,1,
+23549,1,23547,1,
+23549,2,2,23545,1,
+23549,3,23547,3,0,1,
+23549,4,2,16278,12,0,1,
+23557,1,23552,1,
+23557,2,5,23554,1,
+23557,3,23552,2,0,1,
+23557,4,5,13162,9,0,1,
+23561,1,23558,1,
+23561,2,3,23556,1,
+23561,3,23558,3,0,1,
+23561,4,3,13414,2,0,1,
+23563,1,23561,1,
+23563,2,2,23559,1,
+23563,3,23561,6,0,1,
+23563,4,2,22059,8,0,1,
+23567,1,23562,1,
+23567,2,5,23562,1,
+23567,3,23562,2,0,1,
+23567,4,5,15639,6,0,1,
+23581,1,23575,1,
+23581,2,6,23577,1,
+23581,3,23575,9,0,1,
+23581,4,6,23577,6,0,1,
+23593,1,23588,1,
+23593,2,5,23592,1,
+23593,3,23588,2,0,1,
+23593,4,5,13402,6,0,1,
+23599,1,23596,1,
+23599,2,3,23597,1,
+23599,3,23596,5,0,1,
+23599,4,3,23595,4,0,1,
+23603,1,23601,1,
+23603,2,2,23602,1,
+23603,3,23601,2,0,1,
+23603,4,2,20737,17,0,1,
+23609,1,23603,1,
+23609,2,6,23606,1,
+23609,3,23603,4,0,1,
+23609,4,6,12496,9,0,1,
+23623,1,23617,1,
+23623,2,6,23620,1,
+23623,3,23617,7,0,1,
+23623,4,6,20619,5,0,1,
+23627,1,23625,1,
+23627,2,2,23623,1,
+23627,3,23625,3,0,1,
+23627,4,2,20095,8,0,1,
+23629,1,23627,1,
+23629,2,2,23625,1,
+23629,3,23627,2,0,1,
+23629,4,2,22694,10,0,1,
+23633,1,23628,1,
+23633,2,5,23628,1,
+23633,3,23628,3,0,1,
+23633,4,5,22258,8,0,1,
+23663,1,23658,1,
+23663,2,5,23661,1,
+23663,3,23658,1,0,1,
+23663,4,5,14091,5,0,1,
+23669,1,23667,1,
+23669,2,2,23662,1,
+23669,3,23667,5,0,1,
+23669,4,2,22391,4,0,1,
+23671,1,23668,1,
+23671,2,3,23670,1,
+23671,3,23668,8,0,1,
+23671,4,3,13774,2,0,1,
+23677,1,23672,1,
+23677,2,5,23676,1,
+23677,3,23672,3,0,1,
+23677,4,5,17965,3,0,1,
+23687,1,23682,1,
+23687,2,5,23685,1,
+23687,3,23682,1,0,1,
+23687,4,5,23683,3,0,1,
+23689,1,23678,1,
+23689,2,11,23684,1,
+23689,3,23678,3,0,1,
+23689,4,11,17232,16,0,1,
+23719,1,23713,1,
+23719,2,6,23717,1,
+23719,3,23713,1,0,1,
+23719,4,6,17194,3,0,1,
+23741,1,23739,1,
+23741,2,2,23737,1,
+23741,3,23739,3,0,1,
+23741,4,2,14491,12,0,1,
+23743,1,23740,1,
+23743,2,3,23738,1,
+23743,3,23740,6,0,1,
+23743,4,3,12127,6,0,1,
+23747,1,23745,1,
+23747,2,2,23746,1,
+23747,3,23745,2,0,1,
+23747,4,2,21173,10,0,1,
+23753,1,23750,1,
+23753,2,3,23747,1,
+23753,3,23750,3,0,1,
+23753,4,3,21853,25,0,1,
+23761,1,23754,1,
+23761,2,7,23754,1,
+23761,3,23754,1,0,1,
+23761,4,7,13633,0,0,1,
+23767,1,23764,1,
+23767,2,3,23766,1,
+23767,3,23764,3,0,1,
+23767,4,3,22423,5,0,1,
+23773,1,23768,1,
+23773,2,5,23770,1,
+23773,3,23768,1,0,1,
+23773,4,5,22420,11,0,1,
+23789,1,23787,1,
+23789,2,2,23788,1,
+23789,3,23787,10,0,1,
+23789,4,2,20966,3,0,1,
+23801,1,23798,1,
+23801,2,3,23791,1,
+23801,3,23798,1,0,1,
+23801,4,3,18160,22,0,1,
+23813,1,23811,1,
+23813,2,2,23809,1,
+23813,3,23811,2,0,1,
+23813,4,2,23057,1,0,1,
+23819,1,23817,1,
+23819,2,2,23811,1,
+23819,3,23817,5,0,1,
+23819,4,2,19293,2,0,1,
+23827,1,23825,1,
+23827,2,2,23826,1,
+23827,3,23825,2,0,1,
+23827,4,2,23820,8,0,1,
+23831,1,23820,1,
+23831,2,11,23827,1,
+23831,3,23820,1,0,1,
+23831,4,11,18265,6,0,1,
+23833,1,23828,1,
+23833,2,5,23830,1,
+23833,3,23828,1,0,1,
+23833,4,5,23822,14,0,1,
+23857,1,23852,1,
+23857,2,5,23856,1,
+23857,3,23852,2,0,1,
+23857,4,5,13498,6,0,1,
+23869,1,23867,1,
+23869,2,2,23863,1,
+23869,3,23867,6,0,1,
+23869,4,2,14180,8,0,1,
+23873,1,23870,1,
+23873,2,3,23868,1,
+23873,3,23870,4,0,1,
+23873,4,3,13312,0,0,1,
+23879,1,23872,1,
+23879,2,7,23878,1,
+23879,3,23872,1,0,1,
+23879,4,7,12533,2,0,1,
+23887,1,23884,1,
+23887,2,3,23886,1,
+23887,3,23884,4,0,1,
+23887,4,3,21324,5,0,1,
+23893,1,23888,1,
+23893,2,5,23892,1,
+23893,3,23888,1,0,1,
+23893,4,5,21391,3,0,1,
+23899,1,23897,1,
+23899,2,2,23895,1,
+23899,3,23897,6,0,1,
+23899,4,2,20028,8,0,1,
+23909,1,23907,1,
+23909,2,2,23905,1,
+23909,3,23907,2,0,1,
+23909,4,2,16857,6,0,1,
+23911,1,23905,1,
+23911,2,6,23910,1,
+23911,3,23905,2,0,1,
+23911,4,6,22897,2,0,1,
+23917,1,23915,1,
+23917,2,2,23916,1,
+23917,3,23915,6,0,1,
+23917,4,2,18746,6,0,1,
+23929,1,23922,1,
+23929,2,7,23926,1,
+23929,3,23922,5,0,1,
+23929,4,7,13359,24,0,1,
+23957,1,23955,1,
+23957,2,2,23950,1,
+23957,3,23955,2,0,1,
+23957,4,2,18108,2,0,1,
+23971,1,23961,1,
+23971,2,10,23969,1,
+23971,3,23961,2,0,1,
+23971,4,10,21167,0,0,1,
+23977,1,23972,1,
+23977,2,5,23976,1,
+23977,3,23972,1,0,1,
+23977,4,5,16580,6,0,1,
+23981,1,23978,1,
+23981,2,3,23979,1,
+23981,3,23978,4,0,1,
+23981,4,3,23977,4,0,1,
+23993,1,23990,1,
+23993,2,3,23985,1,
+23993,3,23990,3,0,1,
+23993,4,3,17629,2,0,1,
+24001,1,23987,1,
+24001,2,14,23998,1,
+24001,3,23987,4,0,1,
+24001,4,14,19905,14,0,1,
+24007,1,23990,1,
+24007,2,17,24005,1,
+24007,3,23990,4,0,1,
+24007,4,17,23999,3,0,1,
+24019,1,24017,1,
+24019,2,2,24015,1,
+24019,3,24017,2,0,1,
+24019,4,2,21463,8,0,1,
+24023,1,24018,1,
+24023,2,5,24021,1,
+24023,3,24018,2,0,1,
+24023,4,5,24019,3,0,1,
+24029,1,24027,1,
+24029,2,2,24025,1,
+24029,3,24027,3,0,1,
+24029,4,2,17813,1,0,1,
+24043,1,24041,1,
+24043,2,2,24042,1,
+24043,3,24041,2,0,1,
+24043,4,2,19923,7,0,1,
+24049,1,24030,1,
+24049,2,19,24046,1,
+24049,3,24030,3,0,1,
+24049,4,19,17444,20,0,1,
+24061,1,24051,1,
+24061,2,10,24060,1,
+24061,3,24051,3,0,1,
+24061,4,10,15322,14,0,1,
+24071,1,24060,1,
+24071,2,11,24070,1,
+24071,3,24060,2,0,1,
+24071,4,11,22963,2,0,1,
+24077,1,24075,1,
+24077,2,2,24073,1,
+24077,3,24075,7,0,1,
+24077,4,2,21575,6,0,1,
+24083,1,24081,1,
+24083,2,2,24082,1,
+24083,3,24081,2,0,1,
+24083,4,2,15842,4,0,1,
+24091,1,24084,1,
+24091,2,7,24089,1,
+24091,3,24084,3,0,1,
+24091,4,7,19002,6,0,1,
+24097,1,24092,1,
+24097,2,5,24094,1,
+24097,3,24092,1,0,1,
+24097,4,5,18233,10,0,1,
+24103,1,24098,1,
+24103,2,5,24101,1,
+24103,3,24098,3,0,1,
+24103,4,5,16916,17,0,1,
+24107,1,24105,1,
+24107,2,2,24106,1,
+24107,3,24105,2,0,1,
+24107,4,2,16265,2,0,1,
+24109,1,24107,1,
+24109,2,2,24105,1,
+24109,3,24107,6,0,1,
+24109,4,2,15418,6,0,1,
+24113,1,24110,1,
+24113,2,3,24107,1,
+24113,3,24110,3,0,1,
+24113,4,3,13869,16,0,1,
+24121,1,24108,1,
+24121,2,13,24109,1,
+24121,3,24108,6,0,1,
+24121,4,13,21986,19,0,1,
+24133,1,24127,1,
+24133,2,6,24131,1,
+24133,3,24127,3,0,1,
+24133,4,6,18645,10,0,1,
+24137,1,24134,1,
+24137,2,3,24131,1,
+24137,3,24134,1,0,1,
+24137,4,3,22964,1,0,1,
+24151,1,24145,1,
+24151,2,6,24149,1,
+24151,3,24145,3,0,1,
+24151,4,6,19583,10,0,1,
+24169,1,24158,1,
+24169,2,11,24168,1,
+24169,3,24158,3,0,1,
+24169,4,11,23491,12,0,1,
+24179,1,24177,1,
+24179,2,2,24175,1,
+24179,3,24177,3,0,1,
+24179,4,2,18883,7,0,1,
+24181,1,24164,1,
+24181,2,17,24180,1,
+24181,3,24164,1,0,1,
+24181,4,17,20864,3,0,1,
+24197,1,24195,1,
+24197,2,2,24191,1,
+24197,3,24195,5,0,1,
+24197,4,2,20105,1,0,1,
+24203,1,24201,1,
+24203,2,2,24199,1,
+24203,3,24201,3,0,1,
+24203,4,2,23092,8,0,1,
+24223,1,24220,1,
+24223,2,3,24221,1,
+24223,3,24220,1,0,1,
+24223,4,3,16011,16,0,1,
+24229,1,24227,1,
+24229,2,2,24225,1,
+24229,3,24227,6,0,1,
+24229,4,2,12395,12,0,1,
+24239,1,24226,1,
+24239,2,13,24237,1,
+24239,3,24226,5,0,1,
+24239,4,13,17548,3,0,1,
+24247,1,24244,1,
+24247,2,3,24242,1,
+24247,3,24244,1,0,1,
+24247,4,3,15502,6,0,1,
+24251,1,24245,1,
+24251,2,6,24249,1,
+24251,3,24245,7,0,1,
+24251,4,6,24241,7,0,1,
+24281,1,24278,1,
+24281,2,3,24269,1,
+24281,3,24278,7,0,1,
+24281,4,3,23583,0,0,1,
+24317,1,24315,1,
+24317,2,2,24316,1,
+24317,3,24315,2,0,1,
+24317,4,2,19371,3,0,1,
+24329,1,24326,1,
+24329,2,3,24328,1,
+24329,3,24326,3,0,1,
+24329,4,3,13839,4,0,1,
+24337,1,24332,1,
+24337,2,5,24332,1,
+24337,3,24332,1,0,1,
+24337,4,5,13634,15,0,1,
+24359,1,24348,1,
+24359,2,11,24357,1,
+24359,3,24348,2,0,1,
+24359,4,11,18118,3,0,1,
+24371,1,24369,1,
+24371,2,2,24367,1,
+24371,3,24369,4,0,1,
+24371,4,2,16480,7,0,1,
+24373,1,24366,1,
+24373,2,7,24371,1,
+24373,3,24366,2,0,1,
+24373,4,7,14265,4,0,1,
+24379,1,24377,1,
+24379,2,2,24375,1,
+24379,3,24377,5,0,1,
+24379,4,2,19135,1,0,1,
+24391,1,24388,1,
+24391,2,3,24389,1,
+24391,3,24388,4,0,1,
+24391,4,3,23642,3,0,1,
+24407,1,24402,1,
+24407,2,5,24405,1,
+24407,3,24402,1,0,1,
+24407,4,5,16779,8,0,1,
+24413,1,24411,1,
+24413,2,2,24405,1,
+24413,3,24411,3,0,1,
+24413,4,2,20485,5,0,1,
+24419,1,24417,1,
+24419,2,2,24418,1,
+24419,3,24417,3,0,1,
+24419,4,2,17258,4,0,1,
+24421,1,24414,1,
+24421,2,7,24419,1,
+24421,3,24414,2,0,1,
+24421,4,7,14717,12,0,1,
+24439,1,24433,1,
+24439,2,6,24435,1,
+24439,3,24433,2,0,1,
+24439,4,6,24435,6,0,1,
+24443,1,24441,1,
+24443,2,2,24442,1,
+24443,3,24441,7,0,1,
+24443,4,2,18400,2,0,1,
+24469,1,24455,1,
+24469,2,14,24466,1,
+24469,3,24455,2,0,1,
+24469,4,14,20631,1,0,1,
+24473,1,24470,1,
+24473,2,3,24467,1,
+24473,3,24470,12,0,1,
+24473,4,3,22810,1,0,1,
+24481,1,24470,1,
+24481,2,11,24472,1,
+24481,3,24470,4,0,1,
+24481,4,11,20309,20,0,1,
+24499,1,24497,1,
+24499,2,2,24495,1,
+24499,3,24497,5,0,1,
+24499,4,2,19662,1,0,1,
+24509,1,24507,1,
+24509,2,2,24501,1,
+24509,3,24507,3,0,1,
+24509,4,2,20791,0,0,1,
+24517,1,24512,1,
+24517,2,5,24512,1,
+24517,3,24512,6,0,1,
+24517,4,5,14823,10,0,1,
+24527,1,24522,1,
+24527,2,5,24510,1,
+24527,3,24522,1,0,1,
+24527,4,5,21810,19,0,1,
+24533,1,24531,1,
+24533,2,2,24532,1,
+24533,3,24531,3,0,1,
+24533,4,2,13522,6,0,1,
+24547,1,24545,1,
+24547,2,2,24546,1,
+24547,3,24545,5,0,1,
+24547,4,2,17155,7,0,1,
+24551,1,24544,1,
+24551,2,7,24550,1,
+24551,3,24544,3,0,1,
+24551,4,7,24542,4,0,1,
+24571,1,24564,1,
+24571,2,7,24569,1,
+24571,3,24564,1,0,1,
+24571,4,7,22890,6,0,1,
+24593,1,24590,1,
+24593,2,3,24592,1,
+24593,3,24590,1,0,1,
+24593,4,3,23409,6,0,1,
+24611,1,24598,1,
+24611,2,13,24607,1,
+24611,3,24598,2,0,1,
+24611,4,13,13355,7,0,1,
+24623,1,24618,1,
+24623,2,5,24622,1,
+24623,3,24618,2,0,1,
+24623,4,5,24401,3,0,1,
+24631,1,24628,1,
+24631,2,3,24630,1,
+24631,3,24628,3,0,1,
+24631,4,3,18822,2,0,1,
+24659,1,24657,1,
+24659,2,2,24658,1,
+24659,3,24657,12,0,1,
+24659,4,2,24387,2,0,1,
+24671,1,24660,1,
+24671,2,11,24670,1,
+24671,3,24660,2,0,1,
+24671,4,11,12472,4,0,1,
+24677,1,24675,1,
+24677,2,2,24673,1,
+24677,3,24675,3,0,1,
+24677,4,2,21473,6,0,1,
+24683,1,24681,1,
+24683,2,2,24677,1,
+24683,3,24681,4,0,1,
+24683,4,2,20298,0,0,1,
+24691,1,24689,1,
+24691,2,2,24687,1,
+24691,3,24689,4,0,1,
+24691,4,2,12606,9,0,1,
+24697,1,24692,1,
+24697,2,5,24694,1,
+24697,3,24692,7,0,1,
+24697,4,5,24686,14,0,1,
+24709,1,24707,1,
+24709,2,2,24705,1,
+24709,3,24707,6,0,1,
+24709,4,2,17368,10,0,1,
+24733,1,24731,1,
+24733,2,2,24729,1,
+24733,3,24731,6,0,1,
+24733,4,2,20705,12,0,1,
+24749,1,24747,1,
+24749,2,2,24745,1,
+24749,3,24747,3,0,1,
+24749,4,2,19862,6,0,1,
+24763,1,24761,1,
+24763,2,2,24759,1,
+24763,3,24761,6,0,1,
+24763,4,2,15839,8,0,1,
+24767,1,24762,1,
+24767,2,5,24766,1,
+24767,3,24762,1,0,1,
+24767,4,5,23274,2,0,1,
+24781,1,24779,1,
+24781,2,2,24777,1,
+24781,3,24779,2,0,1,
+24781,4,2,19579,10,0,1,
+24793,1,24788,1,
+24793,2,5,24790,1,
+24793,3,24788,1,0,1,
+24793,4,5,15414,10,0,1,
+24799,1,24793,1,
+24799,2,6,24798,1,
+24799,3,24793,1,0,1,
+24799,4,6,15233,3,0,1,
+24809,1,24803,1,
+24809,2,6,24806,1,
+24809,3,24803,2,0,1,
+24809,4,6,23226,15,0,1,
+24821,1,24819,1,
+24821,2,2,24820,1,
+24821,3,24819,3,0,1,
+24821,4,2,16665,9,0,1,
+24841,1,24827,1,
+24841,2,14,24839,1,
+24841,3,24827,1,0,1,
+24841,4,14,14749,9,0,1,
+24847,1,24844,1,
+24847,2,3,24845,1,
+24847,3,24844,5,0,1,
+24847,4,3,17856,6,0,1,
+24851,1,24849,1,
+24851,2,2,24846,1,
+24851,3,24849,2,0,1,
+24851,4,2,24434,9,0,1,
+24859,1,24857,1,
+24859,2,2,24855,1,
+24859,3,24857,2,0,1,
+24859,4,2,22967,8,0,1,
+24877,1,24872,1,
+24877,2,5,24874,1,
+24877,3,24872,1,0,1,
+24877,4,5,19054,1,0,1,
+24889,1,24878,1,
+24889,2,11,24884,1,
+24889,3,24878,3,0,1,
+24889,4,11,24870,24,0,1,
+24907,1,24905,1,
+24907,2,2,24903,1,
+24907,3,24905,4,0,1,
+24907,4,2,18748,14,0,1,
+24917,1,24915,1,
+24917,2,2,24913,1,
+24917,3,24915,3,0,1,
+24917,4,2,15180,6,0,1,
+24919,1,24916,1,
+24919,2,3,24917,1,
+24919,3,24916,1,0,1,
+24919,4,3,19134,3,0,1,
+24923,1,24921,1,
+24923,2,2,24922,1,
+24923,3,24921,2,0,1,
+24923,4,2,12901,2,0,1,
+24943,1,24938,1,
+24943,2,5,24942,1,
+24943,3,24938,2,0,1,
+24943,4,5,22421,2,0,1,
+24953,1,24950,1,
+24953,2,3,24948,1,
+24953,3,24950,7,0,1,
+24953,4,3,12957,0,0,1,
+24967,1,24964,1,
+24967,2,3,24966,1,
+24967,3,24964,7,0,1,
+24967,4,3,15797,5,0,1,
+24971,1,24969,1,
+24971,2,2,24967,1,
+24971,3,24969,3,0,1,
+24971,4,2,18660,7,0,1,
+24977,1,24974,1,
+24977,2,3,24976,1,
+24977,3,24974,10,0,1,
+24977,4,3,23990,7,0,1,
+24979,1,24977,1,
+24979,2,2,24978,1,
+24979,3,24977,4,0,1,
+24979,4,2,23765,6,0,1,
+24989,1,24987,1,
+24989,2,2,24988,1,
+24989,3,24987,3,0,1,
+24989,4,2,21711,3,0,1,
+25013,1,25011,1,
+25013,2,2,25009,1,
+25013,3,25011,3,0,1,
+25013,4,2,21530,6,0,1,
+25031,1,25018,1,
+25031,2,13,25029,1,
+25031,3,25018,6,0,1,
+25031,4,13,18502,3,0,1,
+25033,1,25028,1,
+25033,2,5,25032,1,
+25033,3,25028,3,0,1,
+25033,4,5,20483,12,0,1,
+25037,1,25035,1,
+25037,2,2,25033,1,
+25037,3,25035,2,0,1,
+25037,4,2,22014,1,0,1,
+25057,1,25052,1,
+25057,2,5,25056,1,
+25057,3,25052,1,0,1,
+25057,4,5,17482,6,0,1,
+25073,1,25070,1,
+25073,2,3,25067,1,
+25073,3,25070,6,0,1,
+25073,4,3,24625,1,0,1,
+25087,1,25084,1,
+25087,2,3,25086,1,
+25087,3,25084,1,0,1,
+25087,4,3,18369,2,0,1,
+25097,1,25094,1,
+25097,2,3,25092,1,
+25097,3,25094,3,0,1,
+25097,4,3,22684,0,0,1,
+25111,1,25108,1,
+25111,2,3,25109,1,
+25111,3,25108,1,0,1,
+25111,4,3,23263,3,0,1,
+25117,1,25112,1,
+25117,2,5,25116,1,
+25117,3,25112,10,0,1,
+25117,4,5,19643,6,0,1,
+25121,1,25118,1,
+25121,2,3,25120,1,
+25121,3,25118,3,0,1,
+25121,4,3,13068,7,0,1,
+25127,1,25122,1,
+25127,2,5,25125,1,
+25127,3,25122,1,0,1,
+25127,4,5,15511,8,0,1,
+25147,1,25145,1,
+25147,2,2,25146,1,
+25147,3,25145,2,0,1,
+25147,4,2,24323,2,0,1,
+25153,1,25143,1,
+25153,2,10,25152,1,
+25153,3,25143,5,0,1,
+25153,4,10,24581,6,0,1,
+25163,1,25161,1,
+25163,2,2,25159,1,
+25163,3,25161,3,0,1,
+25163,4,2,17257,11,0,1,
+25169,1,25166,1,
+25169,2,3,25158,1,
+25169,3,25166,8,0,1,
+25169,4,3,24153,8,0,1,
+25171,1,25168,1,
+25171,2,3,25160,1,
+25171,3,25168,3,0,1,
+25171,4,3,19305,0,0,1,
+25183,1,25178,1,
+25183,2,5,25182,1,
+25183,3,25178,21,0,1,
+25183,4,5,25164,20,0,1,
+25189,1,25187,1,
+25189,2,2,25188,1,
+25189,3,25187,4,0,1,
+25189,4,2,15569,3,0,1,
+25219,1,25217,1,
+25219,2,2,25210,1,
+25219,3,25217,6,0,1,
+25219,4,2,13660,6,0,1,
+25229,1,25227,1,
+25229,2,2,25225,1,
+25229,3,25227,2,0,1,
+25229,4,2,15951,12,0,1,
+25237,1,25235,1,
+25237,2,2,25233,1,
+25237,3,25235,4,0,1,
+25237,4,2,12796,9,0,1,
+25243,1,25241,1,
+25243,2,2,25239,1,
+25243,3,25241,4,0,1,
+25243,4,2,20249,10,0,1,
+25247,1,25242,1,
+25247,2,5,25246,1,
+25247,3,25242,2,0,1,
+25247,4,5,18166,2,0,1,
+25253,1,25251,1,
+25253,2,2,25249,1,
+25253,3,25251,3,0,1,
+25253,4,2,16484,7,0,1,
+25261,1,25254,1,
+25261,2,7,25259,1,
+25261,3,25254,4,0,1,
+25261,4,7,23105,15,0,1,
+25301,1,25298,1,
+25301,2,3,25299,1,
+25301,3,25298,4,0,1,
+25301,4,3,25297,4,0,1,
+25303,1,25300,1,
+25303,2,3,25301,1,
+25303,3,25300,1,0,1,
+25303,4,3,20395,3,0,1,
+25307,1,25305,1,
+25307,2,2,25303,1,
+25307,3,25305,4,0,1,
+25307,4,2,23849,7,0,1,
+25309,1,25296,1,
+25309,2,13,25300,1,
+25309,3,25296,1,0,1,
+25309,4,13,17876,11,0,1,
+25321,1,25302,1,
+25321,2,19,25302,1,
+25321,3,25302,2,0,1,
+25321,4,19,17706,8,0,1,
+25339,1,25336,1,
+25339,2,3,25338,1,
+25339,3,25336,17,0,1,
+25339,4,3,14839,2,0,1,
+25343,1,25338,1,
+25343,2,5,25341,1,
+25343,3,25338,1,0,1,
+25343,4,5,23928,10,0,1,
+25349,1,25347,1,
+25349,2,2,25345,1,
+25349,3,25347,4,0,1,
+25349,4,2,15950,12,0,1,
+25357,1,25355,1,
+25357,2,2,25356,1,
+25357,3,25355,2,0,1,
+25357,4,2,16390,7,0,1,
+25367,1,25362,1,
+25367,2,5,25366,1,
+25367,3,25362,5,0,1,
+25367,4,5,24452,7,0,1,
+25373,1,25371,1,
+25373,2,2,25372,1,
+25373,3,25371,3,0,1,
+25373,4,2,18348,21,0,1,
+25391,1,25384,1,
+25391,2,7,25390,1,
+25391,3,25384,1,0,1,
+25391,4,7,24563,2,0,1,
+25409,1,25406,1,
+25409,2,3,25408,1,
+25409,3,25406,3,0,1,
+25409,4,3,16382,7,0,1,
+25411,1,25404,1,
+25411,2,7,25409,1,
+25411,3,25404,1,0,1,
+25411,4,7,17404,6,0,1,
+25423,1,25420,1,
+25423,2,3,25422,1,
+25423,3,25420,11,0,1,
+25423,4,3,20629,5,0,1,
+25439,1,25432,1,
+25439,2,7,25435,1,
+25439,3,25432,9,0,1,
+25439,4,7,15607,6,0,1,
+25447,1,25444,1,
+25447,2,3,25445,1,
+25447,3,25444,13,0,1,
+25447,4,3,20273,6,0,1,
+25453,1,25451,1,
+25453,2,2,25443,1,
+25453,3,25451,4,0,1,
+25453,4,2,24739,2,0,1,
+25457,1,25454,1,
+25457,2,3,25445,1,
+25457,3,25454,1,0,1,
+25457,4,3,18293,0,0,1,
+25463,1,25458,1,
+25463,2,5,25462,1,
+25463,3,25458,5,0,1,
+25463,4,5,18607,3,0,1,
+25469,1,25467,1,
+25469,2,2,25468,1,
+25469,3,25467,3,0,1,
+25469,4,2,25462,8,0,1,
+25471,1,25465,1,
+25471,2,6,25470,1,
+25471,3,25465,3,0,1,
+25471,4,6,16657,3,0,1,
+25523,1,25521,1,
+25523,2,2,25518,1,
+25523,3,25521,4,0,1,
+25523,4,2,24349,3,0,1,
+25537,1,25527,1,
+25537,2,10,25536,1,
+25537,3,25527,2,0,1,
+25537,4,10,13603,14,0,1,
+25541,1,25539,1,
+25541,2,2,25537,1,
+25541,3,25539,3,0,1,
+25541,4,2,21841,1,0,1,
+25561,1,25550,1,
+25561,2,11,25560,1,
+25561,3,25550,3,0,1,
+25561,4,11,18210,30,0,1,
+25577,1,25574,1,
+25577,2,3,25576,1,
+25577,3,25574,3,0,1,
+25577,4,3,20220,6,0,1,
+25579,1,25577,1,
+25579,2,2,25575,1,
+25579,3,25577,6,0,1,
+25579,4,2,25025,8,0,1,
+25583,1,25578,1,
+25583,2,5,25581,1,
+25583,3,25578,6,0,1,
+25583,4,5,20849,5,0,1,
+25589,1,25587,1,
+25589,2,2,25581,1,
+25589,3,25587,5,0,1,
+25589,4,2,17836,0,0,1,
+25601,1,25598,1,
+25601,2,3,25583,1,
+25601,3,25598,8,0,1,
+25601,4,3,19529,6,0,1,
+25603,1,25601,1,
+25603,2,2,25599,1,
+25603,3,25601,5,0,1,
+25603,4,2,14069,8,0,1,
+25609,1,25602,1,
+25609,2,7,25598,1,
+25609,3,25602,1,0,1,
+25609,4,7,25333,18,0,1,
+25621,1,25611,1,
+25621,2,10,25618,1,
+25621,3,25611,7,0,1,
+25621,4,10,17653,9,0,1,
+25633,1,25628,1,
+25633,2,5,25632,1,
+25633,3,25628,5,0,1,
+25633,4,5,16896,6,0,1,
+25639,1,25636,1,
+25639,2,3,25637,1,
+25639,3,25636,3,0,1,
+25639,4,3,23467,3,0,1,
+25643,1,25641,1,
+25643,2,2,25639,1,
+25643,3,25641,3,0,1,
+25643,4,2,15275,8,0,1,
+25657,1,25652,1,
+25657,2,5,25652,1,
+25657,3,25652,1,0,1,
+25657,4,5,13832,10,0,1,
+25667,1,25665,1,
+25667,2,2,25666,1,
+25667,3,25665,2,0,1,
+25667,4,2,25660,8,0,1,
+25673,1,25670,1,
+25673,2,3,25672,1,
+25673,3,25670,3,0,1,
+25673,4,3,14189,6,0,1,
+25679,1,25668,1,
+25679,2,11,25678,1,
+25679,3,25668,7,0,1,
+25679,4,11,22310,2,0,1,
+25693,1,25691,1,
+25693,2,2,25692,1,
+25693,3,25691,2,0,1,
+25693,4,2,19927,3,0,1,
+25703,1,25698,1,
+25703,2,5,25701,1,
+25703,3,25698,7,0,1,
+25703,4,5,20340,9,0,1,
+25717,1,25715,1,
+25717,2,2,25716,1,
+25717,3,25715,2,0,1,
+25717,4,2,19736,3,0,1,
+25733,1,25731,1,
+25733,2,2,25728,1,
+25733,3,25731,8,0,1,
+25733,4,2,25455,0,0,1,
+25741,1,25735,1,
+25741,2,6,25737,1,
+25741,3,25735,1,0,1,
+25741,4,6,17719,2,0,1,
+25747,1,25745,1,
+25747,2,2,25743,1,
+25747,3,25745,5,0,1,
+25747,4,2,19241,8,0,1,
+25759,1,25756,1,
+25759,2,3,25758,1,
+25759,3,25756,1,0,1,
+25759,4,3,15974,3,0,1,
+25763,1,25758,1,
+25763,2,5,25762,1,
+25763,3,25758,2,0,1,
+25763,4,5,15195,2,0,1,
+25771,1,25769,1,
+25771,2,2,25767,1,
+25771,3,25769,8,0,1,
+25771,4,2,21110,8,0,1,
+25793,1,25790,1,
+25793,2,3,25787,1,
+25793,3,25790,7,0,1,
+25793,4,3,16061,9,0,1,
+25799,1,25792,1,
+25799,2,7,25798,1,
+25799,3,25792,3,0,1,
+25799,4,7,23379,2,0,1,
+25801,1,25794,1,
+25801,2,7,25788,1,
+25801,3,25794,2,0,1,
+25801,4,7,13642,2,0,1,
+25819,1,25816,1,
+25819,2,3,25809,1,
+25819,3,25816,1,0,1,
+25819,4,3,18669,0,0,1,
+25841,1,25838,1,
+25841,2,3,25840,1,
+25841,3,25838,1,0,1,
+25841,4,3,17379,4,0,1,
+25847,1,25842,1,
+25847,2,5,25844,1,
+25847,3,25842,3,0,1,
+25847,4,5,15693,6,0,1,
+25849,1,25842,1,
+25849,2,7,25842,1,
+25849,3,25842,1,0,1,
+25849,4,7,23130,0,0,1,
+25867,1,25865,1,
+25867,2,2,25863,1,
+25867,3,25865,6,0,1,
+25867,4,2,17712,8,0,1,
+25873,1,25863,1,
+25873,2,10,25863,1,
+25873,3,25863,6,0,1,
+25873,4,10,21826,0,0,1,
+25889,1,25886,1,
+25889,2,3,25888,1,
+25889,3,25886,4,0,1,
+25889,4,3,16880,7,0,1,
+25903,1,25898,1,
+25903,2,5,25901,1,
+25903,3,25898,5,0,1,
+25903,4,5,17698,10,0,1,
+25913,1,25910,1,
+25913,2,3,25912,1,
+25913,3,25910,1,0,1,
+25913,4,3,23988,7,0,1,
+25919,1,25908,1,
+25919,2,11,25918,1,
+25919,3,25908,1,0,1,
+25919,4,11,23765,6,0,1,
+25931,1,25929,1,
+25931,2,2,25930,1,
+25931,3,25929,3,0,1,
+25931,4,2,24429,2,0,1,
+25933,1,25931,1,
+25933,2,2,25932,1,
+25933,3,25931,2,0,1,
+25933,4,2,25231,12,0,1,
+25939,1,25936,1,
+25939,2,3,25926,1,
+25939,3,25936,3,0,1,
+25939,4,3,16606,2,0,1,
+25943,1,25938,1,
+25943,2,5,25942,1,
+25943,3,25938,1,0,1,
+25943,4,5,16536,5,0,1,
+25951,1,25948,1,
+25951,2,3,25950,1,
+25951,3,25948,1,0,1,
+25951,4,3,22211,2,0,1,
+25969,1,25962,1,
+25969,2,7,25966,1,
+25969,3,25962,2,0,1,
+25969,4,7,23150,16,0,1,
+25981,1,25970,1,
+25981,2,11,25979,1,
+25981,3,25970,3,0,1,
+25981,4,11,16071,0,0,1,
+25997,1,25995,1,
+25997,2,2,25990,1,
+25997,3,25995,2,0,1,
+25997,4,2,18736,2,0,1,
+25999,1,25992,1,
+25999,2,7,25987,1,
+25999,3,25992,3,0,1,
+25999,4,7,15883,0,0,1,
+26003,1,26001,1,
+26003,2,2,25999,1,
+26003,3,26001,2,0,1,
+26003,4,2,23173,7,0,1,
+26017,1,26012,1,
+26017,2,5,26014,1,
+26017,3,26012,1,0,1,
+26017,4,5,26006,14,0,1,
+26021,1,26019,1,
+26021,2,2,26017,1,
+26021,3,26019,2,0,1,
+26021,4,2,15677,6,0,1,
+26029,1,26023,1,
+26029,2,6,26025,1,
+26029,3,26023,9,0,1,
+26029,4,6,18412,10,0,1,
+26041,1,26028,1,
+26041,2,13,26038,1,
+26041,3,26028,10,0,1,
+26041,4,13,19185,20,0,1,
+26053,1,26051,1,
+26053,2,2,26052,1,
+26053,3,26051,2,0,1,
+26053,4,2,25471,6,0,1,
+26083,1,26076,1,
+26083,2,7,26081,1,
+26083,3,26076,1,0,1,
+26083,4,7,17280,11,0,1,
+26099,1,26097,1,
+26099,2,2,26098,1,
+26099,3,26097,3,0,1,
+26099,4,2,14663,2,0,1,
+26107,1,26105,1,
+26107,2,2,26103,1,
+26107,3,26105,4,0,1,
+26107,4,2,16461,8,0,1,
+26111,1,26104,1,
+26111,2,7,26109,1,
+26111,3,26104,3,0,1,
+26111,4,7,25336,5,0,1,
+26113,1,26106,1,
+26113,2,7,26102,1,
+26113,3,26106,4,0,1,
+26113,4,7,20499,26,0,1,
+26119,1,26116,1,
+26119,2,3,26117,1,
+26119,3,26116,1,0,1,
+26119,4,3,24356,3,0,1,
+26141,1,26139,1,
+26141,2,2,26136,1,
+26141,3,26139,4,0,1,
+26141,4,2,21261,8,0,1,
+26153,1,26150,1,
+26153,2,3,26152,1,
+26153,3,26150,5,0,1,
+26153,4,3,18937,4,0,1,
+26161,1,26148,1,
+26161,2,13,26152,1,
+26161,3,26148,1,0,1,
+26161,4,13,24227,32,0,1,
+26171,1,26169,1,
+26171,2,2,26170,1,
+26171,3,26169,3,0,1,
+26171,4,2,26164,8,0,1,
+26177,1,26174,1,
+26177,2,3,26176,1,
+26177,3,26174,1,0,1,
+26177,4,3,18571,7,0,1,
+26183,1,26178,1,
+26183,2,5,26181,1,
+26183,3,26178,1,0,1,
+26183,4,5,15893,5,0,1,
+26189,1,26187,1,
+26189,2,2,26179,1,
+26189,3,26187,2,0,1,
+26189,4,2,19369,2,0,1,
+26203,1,26200,1,
+26203,2,3,26198,1,
+26203,3,26200,1,0,1,
+26203,4,3,17154,3,0,1,
+26209,1,26198,1,
+26209,2,11,26208,1,
+26209,3,26198,3,0,1,
+26209,4,11,21110,12,0,1,
+26227,1,26224,1,
+26227,2,3,26222,1,
+26227,3,26224,4,0,1,
+26227,4,3,18650,3,0,1,
+26237,1,26235,1,
+26237,2,2,26233,1,
+26237,3,26235,3,0,1,
+26237,4,2,15275,6,0,1,
+26249,1,26246,1,
+26249,2,3,26244,1,
+26249,3,26246,1,0,1,
+26249,4,3,23205,2,0,1,
+26251,1,26249,1,
+26251,2,2,26247,1,
+26251,3,26249,6,0,1,
+26251,4,2,15154,8,0,1,
+26261,1,26259,1,
+26261,2,2,26257,1,
+26261,3,26259,5,0,1,
+26261,4,2,23709,7,0,1,
+26263,1,26260,1,
+26263,2,3,26262,1,
+26263,3,26260,1,0,1,
+26263,4,3,15154,5,0,1,
+26267,1,26265,1,
+26267,2,2,26263,1,
+26267,3,26265,2,0,1,
+26267,4,2,24302,7,0,1,
+26293,1,26287,1,
+26293,2,6,26291,1,
+26293,3,26287,2,0,1,
+26293,4,6,21461,4,0,1,
+26297,1,26294,1,
+26297,2,3,26296,1,
+26297,3,26294,3,0,1,
+26297,4,3,19083,4,0,1,
+26309,1,26307,1,
+26309,2,2,26308,1,
+26309,3,26307,7,0,1,
+26309,4,2,19641,3,0,1,
+26317,1,26311,1,
+26317,2,6,26316,1,
+26317,3,26311,6,0,1,
+26317,4,6,20554,6,0,1,
+26321,1,26318,1,
+26321,2,3,26315,1,
+26321,3,26318,1,0,1,
+26321,4,3,26309,0,0,1,
+26339,1,26337,1,
+26339,2,2,26338,1,
+26339,3,26337,8,0,1,
+26339,4,2,24248,2,0,1,
+26347,1,26344,1,
+26347,2,3,26346,1,
+26347,3,26344,3,0,1,
+26347,4,3,19895,5,0,1,
+26357,1,26355,1,
+26357,2,2,26350,1,
+26357,3,26355,8,0,1,
+26357,4,2,20207,2,0,1,
+26371,1,26368,1,
+26371,2,3,26366,1,
+26371,3,26368,1,0,1,
+26371,4,3,23788,3,0,1,
+26387,1,26385,1,
+26387,2,2,26382,1,
+26387,3,26385,5,0,1,
+26387,4,2,21859,0,0,1,
+26393,1,26390,1,
+26393,2,3,26387,1,
+26393,3,26390,5,0,1,
+26393,4,3,25460,26,0,1,
+26399,1,26392,1,
+26399,2,7,26390,1,
+26399,3,26392,1,0,1,
+26399,4,7,20930,11,0,1,
+26407,1,26402,1,
+26407,2,5,26405,1,
+26407,3,26402,2,0,1,
+26407,4,5,26403,3,0,1,
+26417,1,26414,1,
+26417,2,3,26408,1,
+26417,3,26414,5,0,1,
+26417,4,3,16448,6,0,1,
+26423,1,26418,1,
+26423,2,5,26422,1,
+26423,3,26418,1,0,1,
+26423,4,5,15901,7,0,1,
+26431,1,26428,1,
+26431,2,3,26429,1,
+26431,3,26428,1,0,1,
+26431,4,3,21524,3,0,1,
+26437,1,26432,1,
+26437,2,5,26436,1,
+26437,3,26432,8,0,1,
+26437,4,5,21196,3,0,1,
+26449,1,26442,1,
+26449,2,7,26442,1,
+26449,3,26442,1,0,1,
+26449,4,7,18096,0,0,1,
+26459,1,26457,1,
+26459,2,2,26452,1,
+26459,3,26457,7,0,1,
+26459,4,2,14846,1,0,1,
+26479,1,26476,1,
+26479,2,3,26478,1,
+26479,3,26476,7,0,1,
+26479,4,3,24093,2,0,1,
+26489,1,26486,1,
+26489,2,3,26478,1,
+26489,3,26486,1,0,1,
+26489,4,3,14238,8,0,1,
+26497,1,26492,1,
+26497,2,5,26492,1,
+26497,3,26492,5,0,1,
+26497,4,5,21704,15,0,1,
+26501,1,26499,1,
+26501,2,2,26500,1,
+26501,3,26499,3,0,1,
+26501,4,2,13544,3,0,1,
+26513,1,26510,1,
+26513,2,3,26507,1,
+26513,3,26510,1,0,1,
+26513,4,3,18750,1,0,1,
+26539,1,26537,1,
+26539,2,2,26535,1,
+26539,3,26537,6,0,1,
+26539,4,2,20981,8,0,1,
+26557,1,26555,1,
+26557,2,2,26556,1,
+26557,3,26555,4,0,1,
+26557,4,2,17024,6,0,1,
+26561,1,26558,1,
+26561,2,3,26560,1,
+26561,3,26558,1,0,1,
+26561,4,3,24291,7,0,1,
+26573,1,26571,1,
+26573,2,2,26569,1,
+26573,3,26571,3,0,1,
+26573,4,2,25826,7,0,1,
+26591,1,26569,1,
+26591,2,22,26589,1,
+26591,3,26569,1,0,1,
+26591,4,22,17105,5,0,1,
+26597,1,26595,1,
+26597,2,2,26593,1,
+26597,3,26595,3,0,1,
+26597,4,2,15264,7,0,1,
+26627,1,26625,1,
+26627,2,2,26626,1,
+26627,3,26625,2,0,1,
+26627,4,2,21132,2,0,1,
+26633,1,26630,1,
+26633,2,3,26627,1,
+26633,3,26630,5,0,1,
+26633,4,3,20767,1,0,1,
+26641,1,26634,1,
+26641,2,7,26638,1,
+26641,3,26634,1,0,1,
+26641,4,7,20536,17,0,1,
+26647,1,26644,1,
+26647,2,3,26645,1,
+26647,3,26644,1,0,1,
+26647,4,3,17281,6,0,1,
+26669,1,26667,1,
+26669,2,2,26668,1,
+26669,3,26667,4,0,1,
+26669,4,2,13629,9,0,1,
+26681,1,26675,1,
+26681,2,6,26678,1,
+26681,3,26675,2,0,1,
+26681,4,6,13523,0,0,1,
+26683,1,26681,1,
+26683,2,2,26682,1,
+26683,3,26681,2,0,1,
+26683,4,2,14202,2,0,1,
+26687,1,26682,1,
+26687,2,5,26685,1,
+26687,3,26682,8,0,1,
+26687,4,5,26683,3,0,1,
+26693,1,26691,1,
+26693,2,2,26688,1,
+26693,3,26691,4,0,1,
+26693,4,2,25003,8,0,1,
+26699,1,26697,1,
+26699,2,2,26693,1,
+26699,3,26697,2,0,1,
+26699,4,2,25065,4,0,1,
+26701,1,26679,1,
+26701,2,22,26700,1,
+26701,3,26679,1,0,1,
+26701,4,22,26068,3,0,1,
+26711,1,26700,1,
+26711,2,11,26709,1,
+26711,3,26700,11,0,1,
+26711,4,11,14485,10,0,1,
+26713,1,26703,1,
+26713,2,10,26712,1,
+26713,3,26703,2,0,1,
+26713,4,10,21848,14,0,1,
+26717,1,26715,1,
+26717,2,2,26716,1,
+26717,3,26715,2,0,1,
+26717,4,2,20892,6,0,1,
+26723,1,26721,1,
+26723,2,2,26719,1,
+26723,3,26721,3,0,1,
+26723,4,2,17493,7,0,1,
+26729,1,26726,1,
+26729,2,3,26719,1,
+26729,3,26726,4,0,1,
+26729,4,3,16586,4,0,1,
+26731,1,26728,1,
+26731,2,3,26724,1,
+26731,3,26728,5,0,1,
+26731,4,3,21780,5,0,1,
+26737,1,26727,1,
+26737,2,10,26734,1,
+26737,3,26727,4,0,1,
+26737,4,10,25022,8,0,1,
+26759,1,26746,1,
+26759,2,13,26757,1,
+26759,3,26746,6,0,1,
+26759,4,13,22112,4,0,1,
+26777,1,26774,1,
+26777,2,3,26771,1,
+26777,3,26774,1,0,1,
+26777,4,3,14760,9,0,1,
+26783,1,26778,1,
+26783,2,5,26782,1,
+26783,3,26778,7,0,1,
+26783,4,5,19230,2,0,1,
+26801,1,26798,1,
+26801,2,3,26795,1,
+26801,3,26798,8,0,1,
+26801,4,3,26789,0,0,1,
+26813,1,26811,1,
+26813,2,2,26812,1,
+26813,3,26811,2,0,1,
+26813,4,2,14508,3,0,1,
+26821,1,26819,1,
+26821,2,2,26817,1,
+26821,3,26819,2,0,1,
+26821,4,2,14326,6,0,1,
+26833,1,26828,1,
+26833,2,5,26828,1,
+26833,3,26828,2,0,1,
+26833,4,5,24987,20,0,1,
+26839,1,26836,1,
+26839,2,3,26837,1,
+26839,3,26836,5,0,1,
+26839,4,3,22643,6,0,1,
+26849,1,26846,1,
+26849,2,3,26840,1,
+26849,3,26846,4,0,1,
+26849,4,3,19139,3,0,1,
+26861,1,26859,1,
+26861,2,2,26854,1,
+26861,3,26859,2,0,1,
+26861,4,2,19313,4,0,1,
+26863,1,26858,1,
+26863,2,5,26861,1,
+26863,3,26858,1,0,1,
+26863,4,5,26859,3,0,1,
+26879,1,26866,1,
+26879,2,13,26878,1,
+26879,3,26866,2,0,1,
+26879,4,13,26387,4,0,1,
+26881,1,26870,1,
+26881,2,11,26876,1,
+26881,3,26870,3,0,1,
+26881,4,11,26862,24,0,1,
+26891,1,26885,1,
+26891,2,6,26889,1,
+26891,3,26885,3,0,1,
+26891,4,6,16896,0,0,1,
+26893,1,26888,1,
+26893,2,5,26892,1,
+26893,3,26888,2,0,1,
+26893,4,5,24300,22,0,1,
+26903,1,26898,1,
+26903,2,5,26902,1,
+26903,3,26898,2,0,1,
+26903,4,5,23332,2,0,1,
+26921,1,26908,1,
+26921,2,13,26916,1,
+26921,3,26908,6,0,1,
+26921,4,13,21832,2,0,1,
+26927,1,26922,1,
+26927,2,5,26924,1,
+26927,3,26922,3,0,1,
+26927,4,5,22601,4,0,1,
+26947,1,26945,1,
+26947,2,2,26943,1,
+26947,3,26945,6,0,1,
+26947,4,2,23175,8,0,1,
+26951,1,26944,1,
+26951,2,7,26949,1,
+26951,3,26944,2,0,1,
+26951,4,7,24429,4,0,1,
+26953,1,26946,1,
+26953,2,7,26946,1,
+26953,3,26946,1,0,1,
+26953,4,7,16703,21,0,1,
+26959,1,26953,1,
+26959,2,6,26955,1,
+26959,3,26953,3,0,1,
+26959,4,6,16795,5,0,1,
+26981,1,26978,1,
+26981,2,3,26976,1,
+26981,3,26978,7,0,1,
+26981,4,3,15016,2,0,1,
+26987,1,26985,1,
+26987,2,2,26983,1,
+26987,3,26985,3,0,1,
+26987,4,2,17425,18,0,1,
+26993,1,26990,1,
+26993,2,3,26992,1,
+26993,3,26990,6,0,1,
+26993,4,3,24801,11,0,1,
+27011,1,27009,1,
+27011,2,2,27003,1,
+27011,3,27009,5,0,1,
+27011,4,2,22922,6,0,1,
+27017,1,27012,1,
+27017,2,5,27016,1,
+27017,3,27012,3,0,1,
+27017,4,5,18792,4,0,1,
+27031,1,27025,1,
+27031,2,6,27029,1,
+27031,3,27025,6,0,1,
+27031,4,6,17674,4,0,1,
+27043,1,27041,1,
+27043,2,2,27039,1,
+27043,3,27041,6,0,1,
+27043,4,2,23086,10,0,1,
+27059,1,27057,1,
+27059,2,2,27055,1,
+27059,3,27057,3,0,1,
+27059,4,2,15396,7,0,1,
+27061,1,27059,1,
+27061,2,2,27057,1,
+27061,3,27059,6,0,1,
+27061,4,2,17843,6,0,1,
+27067,1,27065,1,
+27067,2,2,27066,1,
+27067,3,27065,2,0,1,
+27067,4,2,26664,2,0,1,
+27073,1,27068,1,
+27073,2,5,27070,1,
+27073,3,27068,3,0,1,
+27073,4,5,26840,16,0,1,
+27077,1,27075,1,
+27077,2,2,27073,1,
+27077,3,27075,3,0,1,
+27077,4,2,14297,12,0,1,
+27091,1,27089,1,
+27091,2,2,27087,1,
+27091,3,27089,2,0,1,
+27091,4,2,19090,8,0,1,
+27103,1,27100,1,
+27103,2,3,27102,1,
+27103,3,27100,6,0,1,
+27103,4,3,14162,5,0,1,
+27107,1,27105,1,
+27107,2,2,27106,1,
+27107,3,27105,2,0,1,
+27107,4,2,21945,10,0,1,
+27109,1,27102,1,
+27109,2,7,27103,1,
+27109,3,27102,4,0,1,
+27109,4,7,27105,4,0,1,
+27127,1,27124,1,
+27127,2,3,27125,1,
+27127,3,27124,4,0,1,
+27127,4,3,15454,3,0,1,
+27143,1,27138,1,
+27143,2,5,27141,1,
+27143,3,27138,5,0,1,
+27143,4,5,26211,5,0,1,
+27179,1,27177,1,
+27179,2,2,27175,1,
+27179,3,27177,3,0,1,
+27179,4,2,20628,9,0,1,
+27191,1,27165,1,
+27191,2,26,27189,1,
+27191,3,27165,2,0,1,
+27191,4,26,22000,4,0,1,
+27197,1,27195,1,
+27197,2,2,27192,1,
+27197,3,27195,4,0,1,
+27197,4,2,19228,7,0,1,
+27211,1,27201,1,
+27211,2,10,27210,1,
+27211,3,27201,4,0,1,
+27211,4,10,13925,2,0,1,
+27239,1,27232,1,
+27239,2,7,27238,1,
+27239,3,27232,2,0,1,
+27239,4,7,27230,4,0,1,
+27241,1,27224,1,
+27241,2,17,27238,1,
+27241,3,27224,4,0,1,
+27241,4,17,22918,20,0,1,
+27253,1,27251,1,
+27253,2,2,27249,1,
+27253,3,27251,6,0,1,
+27253,4,2,23503,10,0,1,
+27259,1,27257,1,
+27259,2,2,27255,1,
+27259,3,27257,2,0,1,
+27259,4,2,22941,8,0,1,
+27271,1,27265,1,
+27271,2,6,27267,1,
+27271,3,27265,3,0,1,
+27271,4,6,18035,5,0,1,
+27277,1,27271,1,
+27277,2,6,27276,1,
+27277,3,27271,2,0,1,
+27277,4,6,21297,12,0,1,
+27281,1,27275,1,
+27281,2,6,27278,1,
+27281,3,27275,1,0,1,
+27281,4,6,23165,0,0,1,
+27283,1,27278,1,
+27283,2,5,27282,1,
+27283,3,27278,2,0,1,
+27283,4,5,24149,5,0,1,
+27299,1,27297,1,
+27299,2,2,27292,1,
+27299,3,27297,7,0,1,
+27299,4,2,18406,1,0,1,
+27329,1,27326,1,
+27329,2,3,27323,1,
+27329,3,27326,1,0,1,
+27329,4,3,27317,0,0,1,
+27337,1,27332,1,
+27337,2,5,27336,1,
+27337,3,27332,13,0,1,
+27337,4,5,22681,6,0,1,
+27361,1,27354,1,
+27361,2,7,27354,1,
+27361,3,27354,5,0,1,
+27361,4,7,23316,0,0,1,
+27367,1,27364,1,
+27367,2,3,27366,1,
+27367,3,27364,12,0,1,
+27367,4,3,16245,5,0,1,
+27397,1,27395,1,
+27397,2,2,27396,1,
+27397,3,27395,6,0,1,
+27397,4,2,26553,3,0,1,
+27407,1,27402,1,
+27407,2,5,27405,1,
+27407,3,27402,1,0,1,
+27407,4,5,26272,8,0,1,
+27409,1,27396,1,
+27409,2,13,27408,1,
+27409,3,27396,1,0,1,
+27409,4,13,17344,12,0,1,
+27427,1,27422,1,
+27427,2,5,27426,1,
+27427,3,27422,12,0,1,
+27427,4,5,26705,10,0,1,
+27431,1,27414,1,
+27431,2,17,27430,1,
+27431,3,27414,3,0,1,
+27431,4,17,20902,2,0,1,
+27437,1,27435,1,
+27437,2,2,27433,1,
+27437,3,27435,10,0,1,
+27437,4,2,20670,12,0,1,
+27449,1,27446,1,
+27449,2,3,27443,1,
+27449,3,27446,3,0,1,
+27449,4,3,27437,0,0,1,
+27457,1,27450,1,
+27457,2,7,27454,1,
+27457,3,27450,2,0,1,
+27457,4,7,25825,8,0,1,
+27479,1,27472,1,
+27479,2,7,27478,1,
+27479,3,27472,7,0,1,
+27479,4,7,23201,11,0,1,
+27481,1,27474,1,
+27481,2,7,27474,1,
+27481,3,27474,7,0,1,
+27481,4,7,16721,0,0,1,
+27487,1,27484,1,
+27487,2,3,27485,1,
+27487,3,27484,14,0,1,
+27487,4,3,14442,3,0,1,
+27509,1,27507,1,
+27509,2,2,27504,1,
+27509,3,27507,16,0,1,
+27509,4,2,16018,12,0,1,
+27527,1,27522,1,
+27527,2,5,27526,1,
+27527,3,27522,1,0,1,
+27527,4,5,18273,2,0,1,
+27529,1,27522,1,
+27529,2,7,27522,1,
+27529,3,27522,4,0,1,
+27529,4,7,18740,0,0,1,
+27539,1,27537,1,
+27539,2,2,27535,1,
+27539,3,27537,3,0,1,
+27539,4,2,18112,7,0,1,
+27541,1,27522,1,
+27541,2,19,27539,1,
+27541,3,27522,1,0,1,
+27541,4,19,14327,0,0,1,
+27551,1,27534,1,
+27551,2,17,27549,1,
+27551,3,27534,10,0,1,
+27551,4,17,27543,3,0,1,
+27581,1,27579,1,
+27581,2,2,27577,1,
+27581,3,27579,2,0,1,
+27581,4,2,21932,6,0,1,
+27583,1,27580,1,
+27583,2,3,27582,1,
+27583,3,27580,3,0,1,
+27583,4,3,18630,2,0,1,
+27611,1,27609,1,
+27611,2,2,27607,1,
+27611,3,27609,3,0,1,
+27611,4,2,18864,13,0,1,
+27617,1,27614,1,
+27617,2,3,27616,1,
+27617,3,27614,4,0,1,
+27617,4,3,19393,14,0,1,
+27631,1,27625,1,
+27631,2,6,27627,1,
+27631,3,27625,1,0,1,
+27631,4,6,21856,5,0,1,
+27647,1,27642,1,
+27647,2,5,27645,1,
+27647,3,27642,1,0,1,
+27647,4,5,26495,5,0,1,
+27653,1,27651,1,
+27653,2,2,27649,1,
+27653,3,27651,3,0,1,
+27653,4,2,22982,1,0,1,
+27673,1,27662,1,
+27673,2,11,27671,1,
+27673,3,27662,4,0,1,
+27673,4,11,21682,7,0,1,
+27689,1,27686,1,
+27689,2,3,27688,1,
+27689,3,27686,12,0,1,
+27689,4,3,15654,7,0,1,
+27691,1,27688,1,
+27691,2,3,27684,1,
+27691,3,27688,3,0,1,
+27691,4,3,23649,5,0,1,
+27697,1,27692,1,
+27697,2,5,27696,1,
+27697,3,27692,1,0,1,
+27697,4,5,14230,8,0,1,
+27701,1,27699,1,
+27701,2,2,27697,1,
+27701,3,27699,2,0,1,
+27701,4,2,22935,12,0,1,
+27733,1,27731,1,
+27733,2,2,27732,1,
+27733,3,27731,2,0,1,
+27733,4,2,16728,3,0,1,
+27737,1,27734,1,
+27737,2,3,27736,1,
+27737,3,27734,4,0,1,
+27737,4,3,22452,7,0,1,
+27739,1,27736,1,
+27739,2,3,27738,1,
+27739,3,27736,3,0,1,
+27739,4,3,15220,2,0,1,
+27743,1,27738,1,
+27743,2,5,27738,1,
+27743,3,27738,1,0,1,
+27743,4,5,16117,9,0,1,
+27749,1,27746,1,
+27749,2,3,27744,1,
+27749,3,27746,3,0,1,
+27749,4,3,24376,2,0,1,
+27751,1,27748,1,
+27751,2,3,27749,1,
+27751,3,27748,10,0,1,
+27751,4,3,27747,4,0,1,
+27763,1,27760,1,
+27763,2,3,27762,1,
+27763,3,27760,8,0,1,
+27763,4,3,18860,5,0,1,
+27767,1,27762,1,
+27767,2,5,27766,1,
+27767,3,27762,2,0,1,
+27767,4,5,22807,3,0,1,
+27773,1,27771,1,
+27773,2,2,27768,1,
+27773,3,27771,5,0,1,
+27773,4,2,17311,2,0,1,
+27779,1,27777,1,
+27779,2,2,27778,1,
+27779,3,27777,3,0,1,
+27779,4,2,14110,2,0,1,
+27791,1,27784,1,
+27791,2,7,27789,1,
+27791,3,27784,1,0,1,
+27791,4,7,18896,4,0,1,
+27793,1,27788,1,
+27793,2,5,27790,1,
+27793,3,27788,1,0,1,
+27793,4,5,27782,14,0,1,
+27799,1,27792,1,
+27799,2,7,27796,1,
+27799,3,27792,17,0,1,
+27799,4,7,27175,13,0,1,
+27803,1,27801,1,
+27803,2,2,27802,1,
+27803,3,27801,11,0,1,
+27803,4,2,21069,10,0,1,
+27809,1,27806,1,
+27809,2,3,27804,1,
+27809,3,27806,1,0,1,
+27809,4,3,25850,2,0,1,
+27817,1,27812,1,
+27817,2,5,27812,1,
+27817,3,27812,3,0,1,
+27817,4,5,18284,15,0,1,
+27823,1,27817,1,
+27823,2,6,27820,1,
+27823,3,27817,1,0,1,
+27823,4,6,20444,5,0,1,
+27827,1,27825,1,
+27827,2,2,27821,1,
+27827,3,27825,9,0,1,
+27827,4,2,14407,4,0,1,
+27847,1,27841,1,
+27847,2,6,27846,1,
+27847,3,27841,1,0,1,
+27847,4,6,19020,2,0,1,
+27851,1,27849,1,
+27851,2,2,27850,1,
+27851,3,27849,3,0,1,
+27851,4,2,23955,4,0,1,
+27883,1,27880,1,
+27883,2,3,27878,1,
+27883,3,27880,5,0,1,
+27883,4,3,17518,3,0,1,
+27893,1,27891,1,
+27893,2,2,27892,1,
+27893,3,27891,2,0,1,
+27893,4,2,20167,9,0,1,
+27901,1,27899,1,
+27901,2,2,27895,1,
+27901,3,27899,6,0,1,
+27901,4,2,17018,8,0,1,
+27917,1,27915,1,
+27917,2,2,27913,1,
+27917,3,27915,3,0,1,
+27917,4,2,21672,7,0,1,
+27919,1,27916,1,
+27919,2,3,27917,1,
+27919,3,27916,1,0,1,
+27919,4,3,20139,3,0,1,
+27941,1,27939,1,
+27941,2,2,27937,1,
+27941,3,27939,2,0,1,
+27941,4,2,23222,6,0,1,
+27943,1,27938,1,
+27943,2,5,27942,1,
+27943,3,27938,2,0,1,
+27943,4,5,25944,9,0,1,
+27947,1,27945,1,
+27947,2,2,27946,1,
+27947,3,27945,3,0,1,
+27947,4,2,24727,10,0,1,
+27953,1,27950,1,
+27953,2,3,27952,1,
+27953,3,27950,1,0,1,
+27953,4,3,26759,4,0,1,
+27961,1,27948,1,
+27961,2,13,27948,1,
+27961,3,27948,4,0,1,
+27961,4,13,27922,0,0,1,
+27967,1,27964,1,
+27967,2,3,27965,1,
+27967,3,27964,3,0,1,
+27967,4,3,23857,6,0,1,
+27983,1,27978,1,
+27983,2,5,27982,1,
+27983,3,27978,2,0,1,
+27983,4,5,25214,2,0,1,
+27997,1,27992,1,
+27997,2,5,27996,1,
+27997,3,27992,5,0,1,
+27997,4,5,18866,6,0,1,
+28001,1,27998,1,
+28001,2,3,28000,1,
+28001,3,27998,4,0,1,
+28001,4,3,26370,7,0,1,
+28019,1,28017,1,
+28019,2,2,28015,1,
+28019,3,28017,3,0,1,
+28019,4,2,14907,9,0,1,
+28027,1,28025,1,
+28027,2,2,28022,1,
+28027,3,28025,2,0,1,
+28027,4,2,23430,2,0,1,
+28031,1,28012,1,
+28031,2,19,28030,1,
+28031,3,28012,2,0,1,
+28031,4,19,17916,2,0,1,
+28051,1,28049,1,
+28051,2,2,28047,1,
+28051,3,28049,2,0,1,
+28051,4,2,24860,8,0,1,
+28057,1,28052,1,
+28057,2,5,28056,1,
+28057,3,28052,2,0,1,
+28057,4,5,19702,12,0,1,
+28069,1,28062,1,
+28069,2,7,28063,1,
+28069,3,28062,1,0,1,
+28069,4,7,18824,16,0,1,
+28081,1,28062,1,
+28081,2,19,28078,1,
+28081,3,28062,3,0,1,
+28081,4,19,22235,20,0,1,
+28087,1,28084,1,
+28087,2,3,28085,1,
+28087,3,28084,4,0,1,
+28087,4,3,25323,6,0,1,
+28097,1,28094,1,
+28097,2,3,28091,1,
+28097,3,28094,5,0,1,
+28097,4,3,15760,1,0,1,
+28099,1,28097,1,
+28099,2,2,28095,1,
+28099,3,28097,2,0,1,
+28099,4,2,27228,8,0,1,
+28109,1,28107,1,
+28109,2,2,28105,1,
+28109,3,28107,2,0,1,
+28109,4,2,23032,7,0,1,
+28111,1,28108,1,
+28111,2,3,28110,1,
+28111,3,28108,1,0,1,
+28111,4,3,19480,2,0,1,
+28123,1,28121,1,
+28123,2,2,28119,1,
+28123,3,28121,4,0,1,
+28123,4,2,23818,8,0,1,
+28151,1,28144,1,
+28151,2,7,28150,1,
+28151,3,28144,2,0,1,
+28151,4,7,22238,2,0,1,
+28163,1,28161,1,
+28163,2,2,28159,1,
+28163,3,28161,3,0,1,
+28163,4,2,23095,8,0,1,
+28181,1,28179,1,
+28181,2,2,28180,1,
+28181,3,28179,3,0,1,
+28181,4,2,23797,3,0,1,
+28183,1,28180,1,
+28183,2,3,28181,1,
+28183,3,28180,1,0,1,
+28183,4,3,28179,4,0,1,
+28201,1,28190,1,
+28201,2,11,28198,1,
+28201,3,28190,3,0,1,
+28201,4,11,19509,14,0,1,
+28211,1,28209,1,
+28211,2,2,28207,1,
+28211,3,28209,2,0,1,
+28211,4,2,18436,8,0,1,
+28219,1,28216,1,
+28219,2,3,28206,1,
+28219,3,28216,1,0,1,
+28219,4,3,21787,3,0,1,
+28229,1,28227,1,
+28229,2,2,28220,1,
+28229,3,28227,3,0,1,
+28229,4,2,24350,1,0,1,
+28277,1,28275,1,
+28277,2,2,28273,1,
+28277,3,28275,7,0,1,
+28277,4,2,18350,6,0,1,
+28279,1,28276,1,
+28279,2,3,28277,1,
+28279,3,28276,3,0,1,
+28279,4,3,18556,6,0,1,
+28283,1,28281,1,
+28283,2,2,28282,1,
+28283,3,28281,3,0,1,
+28283,4,2,25284,2,0,1,
+28289,1,28283,1,
+28289,2,6,28288,1,
+28289,3,28283,1,0,1,
+28289,4,6,17328,7,0,1,
+28297,1,28292,1,
+28297,2,5,28292,1,
+28297,3,28292,3,0,1,
+28297,4,5,21396,15,0,1,
+28307,1,28305,1,
+28307,2,2,28306,1,
+28307,3,28305,2,0,1,
+28307,4,2,20261,2,0,1,
+28309,1,28307,1,
+28309,2,2,28305,1,
+28309,3,28307,2,0,1,
+28309,4,2,27538,10,0,1,
+28319,1,28312,1,
+28319,2,7,28318,1,
+28319,3,28312,4,0,1,
+28319,4,7,23506,2,0,1,
+28349,1,28347,1,
+28349,2,2,28344,1,
+28349,3,28347,11,0,1,
+28349,4,2,25323,8,0,1,
+28351,1,28345,1,
+28351,2,6,28350,1,
+28351,3,28345,7,0,1,
+28351,4,6,26373,3,0,1,
+28387,1,28385,1,
+28387,2,2,28383,1,
+28387,3,28385,6,0,1,
+28387,4,2,18465,8,0,1,
+28393,1,28378,1,
+28393,2,15,28392,1,
+28393,3,28378,2,0,1,
+28393,4,15,14936,6,0,1,
+28403,1,28398,1,
+28403,2,5,28401,1,
+28403,3,28398,1,0,1,
+28403,4,5,28399,3,0,1,
+28409,1,28406,1,
+28409,2,3,28400,1,
+28409,3,28406,1,0,1,
+28409,4,3,25949,2,0,1,
+28411,1,28409,1,
+28411,2,2,28410,1,
+28411,3,28409,4,0,1,
+28411,4,2,19551,2,0,1,
+28429,1,28427,1,
+28429,2,2,28424,1,
+28429,3,28427,2,0,1,
+28429,4,2,19769,11,0,1,
+28433,1,28430,1,
+28433,2,3,28427,1,
+28433,3,28430,3,0,1,
+28433,4,3,24023,9,0,1,
+28439,1,28428,1,
+28439,2,11,28437,1,
+28439,3,28428,5,0,1,
+28439,4,11,16708,3,0,1,
+28447,1,28444,1,
+28447,2,3,28445,1,
+28447,3,28444,1,0,1,
+28447,4,3,28443,4,0,1,
+28463,1,28458,1,
+28463,2,5,28458,1,
+28463,3,28458,2,0,1,
+28463,4,5,19734,7,0,1,
+28477,1,28475,1,
+28477,2,2,28473,1,
+28477,3,28475,6,0,1,
+28477,4,2,14427,12,0,1,
+28493,1,28491,1,
+28493,2,2,28492,1,
+28493,3,28491,2,0,1,
+28493,4,2,23102,4,0,1,
+28499,1,28497,1,
+28499,2,2,28493,1,
+28499,3,28497,2,0,1,
+28499,4,2,24255,0,0,1,
+28513,1,28508,1,
+28513,2,5,28512,1,
+28513,3,28508,2,0,1,
+28513,4,5,28274,6,0,1,
+28517,1,28515,1,
+28517,2,2,28516,1,
+28517,3,28515,2,0,1,
+28517,4,2,27932,4,0,1,
+28537,1,28532,1,
+28537,2,5,28536,1,
+28537,3,28532,1,0,1,
+28537,4,5,19203,6,0,1,
+28541,1,28539,1,
+28541,2,2,28537,1,
+28541,3,28539,2,0,1,
+28541,4,2,22580,7,0,1,
+28547,1,28545,1,
+28547,2,2,28540,1,
+28547,3,28545,4,0,1,
+28547,4,2,18577,1,0,1,
+28549,1,28547,1,
+28549,2,2,28548,1,
+28549,3,28547,6,0,1,
+28549,4,2,21317,9,0,1,
+28559,1,28548,1,
+28559,2,11,28557,1,
+28559,3,28548,4,0,1,
+28559,4,11,21583,3,0,1,
+28571,1,28569,1,
+28571,2,2,28567,1,
+28571,3,28569,5,0,1,
+28571,4,2,24687,8,0,1,
+28573,1,28571,1,
+28573,2,2,28572,1,
+28573,3,28571,6,0,1,
+28573,4,2,20213,7,0,1,
+28579,1,28577,1,
+28579,2,2,28578,1,
+28579,3,28577,5,0,1,
+28579,4,2,21361,2,0,1,
+28591,1,28588,1,
+28591,2,3,28590,1,
+28591,3,28588,3,0,1,
+28591,4,3,19908,3,0,1,
+28597,1,28595,1,
+28597,2,2,28593,1,
+28597,3,28595,4,0,1,
+28597,4,2,18952,6,0,1,
+28603,1,28601,1,
+28603,2,2,28599,1,
+28603,3,28601,6,0,1,
+28603,4,2,18823,8,0,1,
+28607,1,28602,1,
+28607,2,5,28605,1,
+28607,3,28602,13,0,1,
+28607,4,5,28603,3,0,1,
+28619,1,28617,1,
+28619,2,2,28615,1,
+28619,3,28617,3,0,1,
+28619,4,2,26797,19,0,1,
+28621,1,28608,1,
+28621,2,13,28620,1,
+28621,3,28608,5,0,1,
+28621,4,13,27089,3,0,1,
+28627,1,28622,1,
+28627,2,5,28626,1,
+28627,3,28622,1,0,1,
+28627,4,5,24350,5,0,1,
+28631,1,28620,1,
+28631,2,11,28625,1,
+28631,3,28620,1,0,1,
+28631,4,11,17656,7,0,1,
+28643,1,28641,1,
+28643,2,2,28642,1,
+28643,3,28641,2,0,1,
+28643,4,2,28636,8,0,1,
+28649,1,28646,1,
+28649,2,3,28638,1,
+28649,3,28646,1,0,1,
+28649,4,3,17102,4,0,1,
+28657,1,28652,1,
+28657,2,5,28649,1,
+28657,3,28652,2,0,1,
+28657,4,5,17774,1,0,1,
+28661,1,28659,1,
+28661,2,2,28660,1,
+28661,3,28659,7,0,1,
+28661,4,2,24490,3,0,1,
+28663,1,28660,1,
+28663,2,3,28662,1,
+28663,3,28660,10,0,1,
+28663,4,3,17708,5,0,1,
+28669,1,28663,1,
+28669,2,6,28668,1,
+28669,3,28663,1,0,1,
+28669,4,6,19840,11,0,1,
+28687,1,28681,1,
+28687,2,6,28684,1,
+28687,3,28681,1,0,1,
+28687,4,6,22832,7,0,1,
+28697,1,28694,1,
+28697,2,3,28692,1,
+28697,3,28694,6,0,1,
+28697,4,3,14538,2,0,1,
+28703,1,28698,1,
+28703,2,5,28689,1,
+28703,3,28698,12,0,1,
+28703,4,5,28659,3,0,1,
+28711,1,28708,1,
+28711,2,3,28709,1,
+28711,3,28708,1,0,1,
+28711,4,3,27443,3,0,1,
+28723,1,28721,1,
+28723,2,2,28719,1,
+28723,3,28721,5,0,1,
+28723,4,2,22265,8,0,1,
+28729,1,28707,1,
+28729,2,22,28728,1,
+28729,3,28707,4,0,1,
+28729,4,22,16634,12,0,1,
+28751,1,28737,1,
+28751,2,14,28750,1,
+28751,3,28737,6,0,1,
+28751,4,14,15346,6,0,1,
+28753,1,28743,1,
+28753,2,10,28748,1,
+28753,3,28743,2,0,1,
+28753,4,10,24524,10,0,1,
+28759,1,28756,1,
+28759,2,3,28757,1,
+28759,3,28756,7,0,1,
+28759,4,3,23891,3,0,1,
+28771,1,28769,1,
+28771,2,2,28767,1,
+28771,3,28769,2,0,1,
+28771,4,2,23259,8,0,1,
+28789,1,28782,1,
+28789,2,7,28787,1,
+28789,3,28782,1,0,1,
+28789,4,7,20285,4,0,1,
+28793,1,28790,1,
+28793,2,3,28792,1,
+28793,3,28790,4,0,1,
+28793,4,3,19115,6,0,1,
+28807,1,28796,1,
+28807,2,11,28804,1,
+28807,3,28796,6,0,1,
+28807,4,11,19354,0,0,1,
+28813,1,28811,1,
+28813,2,2,28809,1,
+28813,3,28811,6,0,1,
+28813,4,2,19508,9,0,1,
+28817,1,28814,1,
+28817,2,3,28816,1,
+28817,3,28814,5,0,1,
+28817,4,3,18171,6,0,1,
+28837,1,28835,1,
+28837,2,2,28833,1,
+28837,3,28835,4,0,1,
+28837,4,2,20125,9,0,1,
+28843,1,28841,1,
+28843,2,2,28842,1,
+28843,3,28841,2,0,1,
+28843,4,2,22865,2,0,1,
+28859,1,28857,1,
+28859,2,2,28858,1,
+28859,3,28857,3,0,1,
+28859,4,2,17533,4,0,1,
+28867,1,28864,1,
+28867,2,3,28862,1,
+28867,3,28864,4,0,1,
+28867,4,3,18464,3,0,1,
+28871,1,28858,1,
+28871,2,13,28869,1,
+28871,3,28858,3,0,1,
+28871,4,13,14843,3,0,1,
+28879,1,28876,1,
+28879,2,3,28877,1,
+28879,3,28876,11,0,1,
+28879,4,3,28064,3,0,1,
+28901,1,28898,1,
+28901,2,3,28899,1,
+28901,3,28898,8,0,1,
+28901,4,3,17058,14,0,1,
+28909,1,28907,1,
+28909,2,2,28908,1,
+28909,3,28907,6,0,1,
+28909,4,2,15741,7,0,1,
+28921,1,28910,1,
+28921,2,11,28916,1,
+28921,3,28910,3,0,1,
+28921,4,11,15579,16,0,1,
+28927,1,28924,1,
+28927,2,3,28926,1,
+28927,3,28924,4,0,1,
+28927,4,3,28027,5,0,1,
+28933,1,28931,1,
+28933,2,2,28929,1,
+28933,3,28931,5,0,1,
+28933,4,2,19493,9,0,1,
+28949,1,28947,1,
+28949,2,2,28945,1,
+28949,3,28947,2,0,1,
+28949,4,2,27456,7,0,1,
+28961,1,28958,1,
+28961,2,3,28955,1,
+28961,3,28958,1,0,1,
+28961,4,3,28949,0,0,1,
+28979,1,28977,1,
+28979,2,2,28971,1,
+28979,3,28977,4,0,1,
+28979,4,2,18470,6,0,1,
+29009,1,29006,1,
+29009,2,3,29008,1,
+29009,3,29006,3,0,1,
+29009,4,3,26200,4,0,1,
+29017,1,29012,1,
+29017,2,5,29014,1,
+29017,3,29012,2,0,1,
+29017,4,5,14998,23,0,1,
+29021,1,29019,1,
+29021,2,2,29015,1,
+29021,3,29019,5,0,1,
+29021,4,2,28640,4,0,1,
+29023,1,29020,1,
+29023,2,3,29021,1,
+29023,3,29020,1,0,1,
+29023,4,3,18196,6,0,1,
+29027,1,29025,1,
+29027,2,2,29026,1,
+29027,3,29025,2,0,1,
+29027,4,2,15411,2,0,1,
+29033,1,29030,1,
+29033,2,3,29022,1,
+29033,3,29030,8,0,1,
+29033,4,3,18828,5,0,1,
+29059,1,29057,1,
+29059,2,2,29054,1,
+29059,3,29057,2,0,1,
+29059,4,2,22311,2,0,1,
+29063,1,29053,1,
+29063,2,10,29061,1,
+29063,3,29053,3,0,1,
+29063,4,10,18950,4,0,1,
+29077,1,29075,1,
+29077,2,2,29076,1,
+29077,3,29075,6,0,1,
+29077,4,2,14846,9,0,1,
+29101,1,29099,1,
+29101,2,2,29097,1,
+29101,3,29099,2,0,1,
+29101,4,2,21252,6,0,1,
+29123,1,29121,1,
+29123,2,2,29119,1,
+29123,3,29121,2,0,1,
+29123,4,2,28287,11,0,1,
+29129,1,29126,1,
+29129,2,3,29123,1,
+29129,3,29126,4,0,1,
+29129,4,3,29117,0,0,1,
+29131,1,29129,1,
+29131,2,2,29127,1,
+29131,3,29129,2,0,1,
+29131,4,2,26509,8,0,1,
+29137,1,29132,1,
+29137,2,5,29136,1,
+29137,3,29132,1,0,1,
+29137,4,5,16303,6,0,1,
+29147,1,29145,1,
+29147,2,2,29146,1,
+29147,3,29145,2,0,1,
+29147,4,2,19304,4,0,1,
+29153,1,29150,1,
+29153,2,3,29147,1,
+29153,3,29150,3,0,1,
+29153,4,3,17373,1,0,1,
+29167,1,29164,1,
+29167,2,3,29166,1,
+29167,3,29164,1,0,1,
+29167,4,3,17782,8,0,1,
+29173,1,29171,1,
+29173,2,2,29169,1,
+29173,3,29171,4,0,1,
+29173,4,2,21434,10,0,1,
+29179,1,29166,1,
+29179,2,13,29178,1,
+29179,3,29166,4,0,1,
+29179,4,13,28727,2,0,1,
+29191,1,29184,1,
+29191,2,7,29182,1,
+29191,3,29184,1,0,1,
+29191,4,7,22099,2,0,1,
+29201,1,29198,1,
+29201,2,3,29200,1,
+29201,3,29198,10,0,1,
+29201,4,3,28265,7,0,1,
+29207,1,29202,1,
+29207,2,5,29205,1,
+29207,3,29202,7,0,1,
+29207,4,5,29203,3,0,1,
+29209,1,29202,1,
+29209,2,7,29196,1,
+29209,3,29202,1,0,1,
+29209,4,7,25391,0,0,1,
+29221,1,29219,1,
+29221,2,2,29220,1,
+29221,3,29219,5,0,1,
+29221,4,2,23703,7,0,1,
+29231,1,29218,1,
+29231,2,13,29229,1,
+29231,3,29218,2,0,1,
+29231,4,13,15869,4,0,1,
+29243,1,29241,1,
+29243,2,2,29239,1,
+29243,3,29241,3,0,1,
+29243,4,2,27114,7,0,1,
+29251,1,29249,1,
+29251,2,2,29250,1,
+29251,3,29249,5,0,1,
+29251,4,2,27108,7,0,1,
+29269,1,29263,1,
+29269,2,6,29265,1,
+29269,3,29263,2,0,1,
+29269,4,6,20234,2,0,1,
+29287,1,29282,1,
+29287,2,5,29286,1,
+29287,3,29282,2,0,1,
+29287,4,5,23381,2,0,1,
+29297,1,29294,1,
+29297,2,3,29291,1,
+29297,3,29294,1,0,1,
+29297,4,3,16396,25,0,1,
+29303,1,29296,1,
+29303,2,7,29301,1,
+29303,3,29296,7,0,1,
+29303,4,7,23680,10,0,1,
+29311,1,29308,1,
+29311,2,3,29310,1,
+29311,3,29308,15,0,1,
+29311,4,3,20443,2,0,1,
+29327,1,29322,1,
+29327,2,5,29326,1,
+29327,3,29322,2,0,1,
+29327,4,5,19955,2,0,1,
+29333,1,29331,1,
+29333,2,2,29332,1,
+29333,3,29331,2,0,1,
+29333,4,2,26625,3,0,1,
+29339,1,29337,1,
+29339,2,2,29333,1,
+29339,3,29337,2,0,1,
+29339,4,2,26845,0,0,1,
+29347,1,29344,1,
+29347,2,3,29342,1,
+29347,3,29344,4,0,1,
+29347,4,3,22197,3,0,1,
+29363,1,29361,1,
+29363,2,2,29362,1,
+29363,3,29361,2,0,1,
+29363,4,2,22209,2,0,1,
+29383,1,29377,1,
+29383,2,6,29380,1,
+29383,3,29377,12,0,1,
+29383,4,6,14840,4,0,1,
+29387,1,29385,1,
+29387,2,2,29383,1,
+29387,3,29385,3,0,1,
+29387,4,2,17320,16,0,1,
+29389,1,29387,1,
+29389,2,2,29388,1,
+29389,3,29387,5,0,1,
+29389,4,2,29382,8,0,1,
+29399,1,29386,1,
+29399,2,13,29396,1,
+29399,3,29386,4,0,1,
+29399,4,13,28356,5,0,1,
+29401,1,29388,1,
+29401,2,13,29398,1,
+29401,3,29388,1,0,1,
+29401,4,13,24677,22,0,1,
+29411,1,29409,1,
+29411,2,2,29404,1,
+29411,3,29409,2,0,1,
+29411,4,2,14933,0,0,1,
+29423,1,29418,1,
+29423,2,5,29421,1,
+29423,3,29418,1,0,1,
+29423,4,5,19236,5,0,1,
+29429,1,29427,1,
+29429,2,2,29425,1,
+29429,3,29427,2,0,1,
+29429,4,2,25294,7,0,1,
+29437,1,29435,1,
+29437,2,2,29433,1,
+29437,3,29435,6,0,1,
+29437,4,2,25134,12,0,1,
+29443,1,29441,1,
+29443,2,2,29439,1,
+29443,3,29441,5,0,1,
+29443,4,2,18291,20,0,1,
+29453,1,29451,1,
+29453,2,2,29446,1,
+29453,3,29451,7,0,1,
+29453,4,2,15788,2,0,1,
+29473,1,29468,1,
+29473,2,5,29468,1,
+29473,3,29468,1,0,1,
+29473,4,5,21461,15,0,1,
+29483,1,29481,1,
+29483,2,2,29482,1,
+29483,3,29481,2,0,1,
+29483,4,2,25211,2,0,1,
+29501,1,29499,1,
+29501,2,2,29496,1,
+29501,3,29499,5,0,1,
+29501,4,2,20034,2,0,1,
+29527,1,29524,1,
+29527,2,3,29525,1,
+29527,3,29524,3,0,1,
+29527,4,3,21906,6,0,1,
+29531,1,29529,1,
+29531,2,2,29530,1,
+29531,3,29529,11,0,1,
+29531,4,2,21925,2,0,1,
+29537,1,29534,1,
+29537,2,3,29536,1,
+29537,3,29534,6,0,1,
+29537,4,3,25213,6,0,1,
+29567,1,29562,1,
+29567,2,5,29566,1,
+29567,3,29562,5,0,1,
+29567,4,5,20491,7,0,1,
+29569,1,29552,1,
+29569,2,17,29566,1,
+29569,3,29552,3,0,1,
+29569,4,17,18151,20,0,1,
+29573,1,29571,1,
+29573,2,2,29572,1,
+29573,3,29571,2,0,1,
+29573,4,2,26920,6,0,1,
+29581,1,29571,1,
+29581,2,10,29580,1,
+29581,3,29571,2,0,1,
+29581,4,10,17406,7,0,1,
+29587,1,29585,1,
+29587,2,2,29586,1,
+29587,3,29585,2,0,1,
+29587,4,2,26406,2,0,1,
+29599,1,29586,1,
+29599,2,13,29595,1,
+29599,3,29586,1,0,1,
+29599,4,13,19983,9,0,1,
+29611,1,29608,1,
+29611,2,3,29610,1,
+29611,3,29608,4,0,1,
+29611,4,3,26191,6,0,1,
+29629,1,29622,1,
+29629,2,7,29627,1,
+29629,3,29622,1,0,1,
+29629,4,7,23634,4,0,1,
+29633,1,29630,1,
+29633,2,3,29632,1,
+29633,3,29630,7,0,1,
+29633,4,3,25224,4,0,1,
+29641,1,29634,1,
+29641,2,7,29634,1,
+29641,3,29634,1,0,1,
+29641,4,7,24805,0,0,1,
+29663,1,29658,1,
+29663,2,5,29661,1,
+29663,3,29658,2,0,1,
+29663,4,5,29659,3,0,1,
+29669,1,29667,1,
+29669,2,2,29668,1,
+29669,3,29667,7,0,1,
+29669,4,2,27999,3,0,1,
+29671,1,29665,1,
+29671,2,6,29669,1,
+29671,3,29665,3,0,1,
+29671,4,6,26942,3,0,1,
+29683,1,29672,1,
+29683,2,11,29681,1,
+29683,3,29672,2,0,1,
+29683,4,11,15914,3,0,1,
+29717,1,29715,1,
+29717,2,2,29709,1,
+29717,3,29715,10,0,1,
+29717,4,2,24974,3,0,1,
+29723,1,29721,1,
+29723,2,2,29719,1,
+29723,3,29721,3,0,1,
+29723,4,2,16626,7,0,1,
+29741,1,29739,1,
+29741,2,2,29740,1,
+29741,3,29739,9,0,1,
+29741,4,2,16425,3,0,1,
+29753,1,29750,1,
+29753,2,3,29746,1,
+29753,3,29750,5,0,1,
+29753,4,3,26197,4,0,1,
+29759,1,29752,1,
+29759,2,7,29758,1,
+29759,3,29752,1,0,1,
+29759,4,7,22835,2,0,1,
+29761,1,29744,1,
+29761,2,17,29760,1,
+29761,3,29744,1,0,1,
+29761,4,17,21538,12,0,1,
+29789,1,29787,1,
+29789,2,2,29785,1,
+29789,3,29787,2,0,1,
+29789,4,2,16795,6,0,1,
+29803,1,29796,1,
+29803,2,7,29801,1,
+29803,3,29796,2,0,1,
+29803,4,7,20953,11,0,1,
+29819,1,29813,1,
+29819,2,6,29818,1,
+29819,3,29813,1,0,1,
+29819,4,6,22081,5,0,1,
+29833,1,29828,1,
+29833,2,5,29832,1,
+29833,3,29828,2,0,1,
+29833,4,5,21582,6,0,1,
+29837,1,29835,1,
+29837,2,2,29836,1,
+29837,3,29835,2,0,1,
+29837,4,2,20232,4,0,1,
+29851,1,29849,1,
+29851,2,2,29850,1,
+29851,3,29849,5,0,1,
+29851,4,2,19580,2,0,1,
+29863,1,29853,1,
+29863,2,10,29862,1,
+29863,3,29853,4,0,1,
+29863,4,10,24650,2,0,1,
+29867,1,29865,1,
+29867,2,2,29863,1,
+29867,3,29865,3,0,1,
+29867,4,2,27059,7,0,1,
+29873,1,29870,1,
+29873,2,3,29872,1,
+29873,3,29870,10,0,1,
+29873,4,3,20724,6,0,1,
+29879,1,29868,1,
+29879,2,11,29877,1,
+29879,3,29868,6,0,1,
+29879,4,11,25142,3,0,1,
+29881,1,29874,1,
+29881,2,7,29878,1,
+29881,3,29874,3,0,1,
+29881,4,7,22162,16,0,1,
+29917,1,29915,1,
+29917,2,2,29916,1,
+29917,3,29915,6,0,1,
+29917,4,2,26532,3,0,1,
+29921,1,29918,1,
+29921,2,3,29915,1,
+29921,3,29918,1,0,1,
+29921,4,3,29909,0,0,1,
+29927,1,29922,1,
+29927,2,5,29924,1,
+29927,3,29922,10,0,1,
+29927,4,5,28232,6,0,1,
+29947,1,29944,1,
+29947,2,3,29942,1,
+29947,3,29944,1,0,1,
+29947,4,3,27189,3,0,1,
+29959,1,29953,1,
+29959,2,6,29957,1,
+29959,3,29953,1,0,1,
+29959,4,6,23001,3,0,1,
+29983,1,29978,1,
+29983,2,5,29981,1,
+29983,3,29978,9,0,1,
+29983,4,5,20417,17,0,1,
+29989,1,29987,1,
+29989,2,2,29980,1,
+29989,3,29987,2,0,1,
+29989,4,2,27546,3,0,1,
+30011,1,30009,1,
+30011,2,2,30005,1,
+30011,3,30009,9,0,1,
+30011,4,2,26951,0,0,1,
+30013,1,30011,1,
+30013,2,2,30009,1,
+30013,3,30011,5,0,1,
+30013,4,2,28053,12,0,1,
+30029,1,30027,1,
+30029,2,2,30025,1,
+30029,3,30027,3,0,1,
+30029,4,2,17215,1,0,1,
+30047,1,30042,1,
+30047,2,5,30046,1,
+30047,3,30042,2,0,1,
+30047,4,5,22017,3,0,1,
+30059,1,30057,1,
+30059,2,2,30055,1,
+30059,3,30057,3,0,1,
+30059,4,2,29484,7,0,1,
+30071,1,30058,1,
+30071,2,13,30070,1,
+30071,3,30058,7,0,1,
+30071,4,13,27810,2,0,1,
+30089,1,30086,1,
+30089,2,3,30084,1,
+30089,3,30086,9,0,1,
+30089,4,3,15442,2,0,1,
+30091,1,30070,1,
+30091,2,21,30090,1,
+30091,3,30070,2,0,1,
+30091,4,21,18186,6,0,1,
+30097,1,30087,1,
+30097,2,10,30096,1,
+30097,3,30087,5,0,1,
+30097,4,10,18998,21,0,1,
+30103,1,30100,1,
+30103,2,3,30101,1,
+30103,3,30100,6,0,1,
+30103,4,3,22137,6,0,1,
+30109,1,30107,1,
+30109,2,2,30102,1,
+30109,3,30107,5,0,1,
+30109,4,2,19414,33,0,1,
+30113,1,30110,1,
+30113,2,3,30108,1,
+30113,3,30110,3,0,1,
+30113,4,3,22214,0,0,1,
+30119,1,30108,1,
+30119,2,11,30117,1,
+30119,3,30108,4,0,1,
+30119,4,11,22758,8,0,1,
+30133,1,30128,1,
+30133,2,5,30132,1,
+30133,3,30128,1,0,1,
+30133,4,5,23507,6,0,1,
+30137,1,30134,1,
+30137,2,3,30136,1,
+30137,3,30134,4,0,1,
+30137,4,3,17463,7,0,1,
+30139,1,30137,1,
+30139,2,2,30133,1,
+30139,3,30137,6,0,1,
+30139,4,2,20974,12,0,1,
+30161,1,30158,1,
+30161,2,3,30160,1,
+30161,3,30158,4,0,1,
+30161,4,3,21019,4,0,1,
+30169,1,30162,1,
+30169,2,7,30160,1,
+30169,3,30162,2,0,1,
+30169,4,7,19551,2,0,1,
+30181,1,30179,1,
+30181,2,2,30177,1,
+30181,3,30179,2,0,1,
+30181,4,2,18980,6,0,1,
+30187,1,30182,1,
+30187,2,5,30186,1,
+30187,3,30182,1,0,1,
+30187,4,5,19640,7,0,1,
+30197,1,30195,1,
+30197,2,2,30193,1,
+30197,3,30195,3,0,1,
+30197,4,2,21691,1,0,1,
+30203,1,30201,1,
+30203,2,2,30202,1,
+30203,3,30201,5,0,1,
+30203,4,2,30196,8,0,1,
+30211,1,30209,1,
+30211,2,2,30203,1,
+30211,3,30209,6,0,1,
+30211,4,2,16242,6,0,1,
+30223,1,30220,1,
+30223,2,3,30222,1,
+30223,3,30220,5,0,1,
+30223,4,3,27943,5,0,1,
+30241,1,30230,1,
+30241,2,11,30240,1,
+30241,3,30230,3,0,1,
+30241,4,11,16745,12,0,1,
+30253,1,30251,1,
+30253,2,2,30252,1,
+30253,3,30251,2,0,1,
+30253,4,2,21456,6,0,1,
+30259,1,30256,1,
+30259,2,3,30254,1,
+30259,3,30256,5,0,1,
+30259,4,3,29870,3,0,1,
+30269,1,30266,1,
+30269,2,3,30268,1,
+30269,3,30266,1,0,1,
+30269,4,3,21776,3,0,1,
+30271,1,30268,1,
+30271,2,3,30270,1,
+30271,3,30268,4,0,1,
+30271,4,3,16756,2,0,1,
+30293,1,30291,1,
+30293,2,2,30289,1,
+30293,3,30291,3,0,1,
+30293,4,2,21473,7,0,1,
+30307,1,30305,1,
+30307,2,2,30303,1,
+30307,3,30305,4,0,1,
+30307,4,2,26118,8,0,1,
+30313,1,30308,1,
+30313,2,5,30312,1,
+30313,3,30308,8,0,1,
+30313,4,5,18238,6,0,1,
+30319,1,30316,1,
+30319,2,3,30313,1,
+30319,3,30316,3,0,1,
+30319,4,3,15805,15,0,1,
+30323,1,30321,1,
+30323,2,2,30322,1,
+30323,3,30321,2,0,1,
+30323,4,2,28026,2,0,1,
+30341,1,30339,1,
+30341,2,2,30335,1,
+30341,3,30339,9,0,1,
+30341,4,2,28783,3,0,1,
+30347,1,30345,1,
+30347,2,2,30343,1,
+30347,3,30345,3,0,1,
+30347,4,2,17617,14,0,1,
+30367,1,30362,1,
+30367,2,5,30365,1,
+30367,3,30362,6,0,1,
+30367,4,5,30355,11,0,1,
+30389,1,30387,1,
+30389,2,2,30385,1,
+30389,3,30387,2,0,1,
+30389,4,2,23109,6,0,1,
+30391,1,30388,1,
+30391,2,3,30389,1,
+30391,3,30388,3,0,1,
+30391,4,3,24019,3,0,1,
+30403,1,30398,1,
+30403,2,5,30402,1,
+30403,3,30398,7,0,1,
+30403,4,5,19714,14,0,1,
+30427,1,30422,1,
+30427,2,5,30426,1,
+30427,3,30422,2,0,1,
+30427,4,5,16271,7,0,1,
+30431,1,30420,1,
+30431,2,11,30416,1,
+30431,3,30420,11,0,1,
+30431,4,11,16803,4,0,1,
+30449,1,30446,1,
+30449,2,3,30443,1,
+30449,3,30446,6,0,1,
+30449,4,3,30437,0,0,1,
+30467,1,30465,1,
+30467,2,2,30463,1,
+30467,3,30465,3,0,1,
+30467,4,2,23496,7,0,1,
+30469,1,30467,1,
+30469,2,2,30468,1,
+30469,3,30467,5,0,1,
+30469,4,2,29917,3,0,1,
+30491,1,30489,1,
+30491,2,2,30487,1,
+30491,3,30489,3,0,1,
+30491,4,2,29458,16,0,1,
+30493,1,30487,1,
+30493,2,6,30491,1,
+30493,3,30487,2,0,1,
+30493,4,6,23342,4,0,1,
+30497,1,30494,1,
+30497,2,3,30485,1,
+30497,3,30494,6,0,1,
+30497,4,3,25756,6,0,1,
+30509,1,30507,1,
+30509,2,2,30504,1,
+30509,3,30507,5,0,1,
+30509,4,2,27775,2,0,1,
+30517,1,30515,1,
+30517,2,2,30513,1,
+30517,3,30515,5,0,1,
+30517,4,2,26108,10,0,1,
+30529,1,30516,1,
+30529,2,13,30528,1,
+30529,3,30516,1,0,1,
+30529,4,13,19269,14,0,1,
+30539,1,30537,1,
+30539,2,2,30535,1,
+30539,3,30537,3,0,1,
+30539,4,2,17947,7,0,1,
+30553,1,30548,1,
+30553,2,5,30550,1,
+30553,3,30548,2,0,1,
+30553,4,5,19373,10,0,1,
+30557,1,30555,1,
+30557,2,2,30553,1,
+30557,3,30555,3,0,1,
+30557,4,2,15679,7,0,1,
+30559,1,30552,1,
+30559,2,7,30548,1,
+30559,3,30552,7,0,1,
+30559,4,7,27067,0,0,1,
+30577,1,30572,1,
+30577,2,5,30574,1,
+30577,3,30572,6,0,1,
+30577,4,5,30566,14,0,1,
+30593,1,30590,1,
+30593,2,3,30592,1,
+30593,3,30590,6,0,1,
+30593,4,3,17254,4,0,1,
+30631,1,30628,1,
+30631,2,3,30630,1,
+30631,3,30628,3,0,1,
+30631,4,3,19988,2,0,1,
+30637,1,30635,1,
+30637,2,2,30636,1,
+30637,3,30635,2,0,1,
+30637,4,2,23467,3,0,1,
+30643,1,30641,1,
+30643,2,2,30639,1,
+30643,3,30641,10,0,1,
+30643,4,2,20662,8,0,1,
+30649,1,30642,1,
+30649,2,7,30638,1,
+30649,3,30642,1,0,1,
+30649,4,7,22659,30,0,1,
+30661,1,30659,1,
+30661,2,2,30657,1,
+30661,3,30659,5,0,1,
+30661,4,2,20324,6,0,1,
+30671,1,30660,1,
+30671,2,11,30670,1,
+30671,3,30660,1,0,1,
+30671,4,11,17644,3,0,1,
+30677,1,30675,1,
+30677,2,2,30676,1,
+30677,3,30675,3,0,1,
+30677,4,2,23980,6,0,1,
+30689,1,30686,1,
+30689,2,3,30683,1,
+30689,3,30686,1,0,1,
+30689,4,3,30677,0,0,1,
+30697,1,30687,1,
+30697,2,10,30692,1,
+30697,3,30687,2,0,1,
+30697,4,10,28684,16,0,1,
+30703,1,30700,1,
+30703,2,3,30702,1,
+30703,3,30700,7,0,1,
+30703,4,3,22014,5,0,1,
+30707,1,30705,1,
+30707,2,2,30706,1,
+30707,3,30705,3,0,1,
+30707,4,2,23927,4,0,1,
+30713,1,30710,1,
+30713,2,3,30708,1,
+30713,3,30710,3,0,1,
+30713,4,3,27578,0,0,1,
+30727,1,30724,1,
+30727,2,3,30725,1,
+30727,3,30724,5,0,1,
+30727,4,3,24780,6,0,1,
+30757,1,30752,1,
+30757,2,5,30756,1,
+30757,3,30752,2,0,1,
+30757,4,5,26454,6,0,1,
+30763,1,30761,1,
+30763,2,2,30762,1,
+30763,3,30761,4,0,1,
+30763,4,2,25015,7,0,1,
+30773,1,30770,1,
+30773,2,3,30772,1,
+30773,3,30770,1,0,1,
+30773,4,3,30762,12,0,1,
+30781,1,30779,1,
+30781,2,2,30777,1,
+30781,3,30779,4,0,1,
+30781,4,2,19287,6,0,1,
+30803,1,30801,1,
+30803,2,2,30799,1,
+30803,3,30801,2,0,1,
+30803,4,2,16549,13,0,1,
+30809,1,30806,1,
+30809,2,3,30787,1,
+30809,3,30806,4,0,1,
+30809,4,3,27459,5,0,1,
+30817,1,30812,1,
+30817,2,5,30816,1,
+30817,3,30812,1,0,1,
+30817,4,5,24603,6,0,1,
+30829,1,30827,1,
+30829,2,2,30825,1,
+30829,3,30827,2,0,1,
+30829,4,2,16743,10,0,1,
+30839,1,30832,1,
+30839,2,7,30837,1,
+30839,3,30832,13,0,1,
+30839,4,7,25900,5,0,1,
+30841,1,30834,1,
+30841,2,7,30834,1,
+30841,3,30834,12,0,1,
+30841,4,7,25905,21,0,1,
+30851,1,30849,1,
+30851,2,2,30847,1,
+30851,3,30849,3,0,1,
+30851,4,2,26815,8,0,1,
+30853,1,30851,1,
+30853,2,2,30849,1,
+30853,3,30851,6,0,1,
+30853,4,2,18765,12,0,1,
+30859,1,30857,1,
+30859,2,2,30858,1,
+30859,3,30857,6,0,1,
+30859,4,2,17937,6,0,1,
+30869,1,30867,1,
+30869,2,2,30865,1,
+30869,3,30867,3,0,1,
+30869,4,2,22574,1,0,1,
+30871,1,30868,1,
+30871,2,3,30869,1,
+30871,3,30868,3,0,1,
+30871,4,3,23037,3,0,1,
+30881,1,30878,1,
+30881,2,3,30876,1,
+30881,3,30878,5,0,1,
+30881,4,3,23515,2,0,1,
+30893,1,30891,1,
+30893,2,2,30889,1,
+30893,3,30891,3,0,1,
+30893,4,2,30107,12,0,1,
+30911,1,30894,1,
+30911,2,17,30909,1,
+30911,3,30894,2,0,1,
+30911,4,17,21641,7,0,1,
+30931,1,30929,1,
+30931,2,2,30930,1,
+30931,3,30929,5,0,1,
+30931,4,2,20931,12,0,1,
+30937,1,30922,1,
+30937,2,15,30934,1,
+30937,3,30922,1,0,1,
+30937,4,15,16156,20,0,1,
+30941,1,30939,1,
+30941,2,2,30937,1,
+30941,3,30939,2,0,1,
+30941,4,2,18994,7,0,1,
+30949,1,30939,1,
+30949,2,10,30946,1,
+30949,3,30939,2,0,1,
+30949,4,10,20186,5,0,1,
+30971,1,30969,1,
+30971,2,2,30963,1,
+30971,3,30969,4,0,1,
+30971,4,2,30666,6,0,1,
+30977,1,30974,1,
+30977,2,3,30972,1,
+30977,3,30974,3,0,1,
+30977,4,3,20520,2,0,1,
+30983,1,30978,1,
+30983,2,5,30982,1,
+30983,3,30978,3,0,1,
+30983,4,5,15644,2,0,1,
+31013,1,31011,1,
+31013,2,2,31012,1,
+31013,3,31011,2,0,1,
+31013,4,2,23752,4,0,1,
+31019,1,31017,1,
+31019,2,2,31015,1,
+31019,3,31017,2,0,1,
+31019,4,2,30714,8,0,1,
+31033,1,31023,1,
+31033,2,10,31032,1,
+31033,3,31023,2,0,1,
+31033,4,10,26446,6,0,1,
+31039,1,31032,1,
+31039,2,7,31036,1,
+31039,3,31032,1,0,1,
+31039,4,7,19176,0,0,1,
+31051,1,31040,1,
+31051,2,11,31050,1,
+31051,3,31040,2,0,1,
+31051,4,11,23777,5,0,1,
+31063,1,31060,1,
+31063,2,3,31062,1,
+31063,3,31060,4,0,1,
+31063,4,3,26380,2,0,1,
+31069,1,31067,1,
+31069,2,2,31068,1,
+31069,3,31067,6,0,1,
+31069,4,2,25009,7,0,1,
+31079,1,31068,1,
+31079,2,11,31077,1,
+31079,3,31068,6,0,1,
+31079,4,11,29978,5,0,1,
+31081,1,31068,1,
+31081,2,13,31080,1,
+31081,3,31068,2,0,1,
+31081,4,13,19769,18,0,1,
+31091,1,31089,1,
+31091,2,2,31085,1,
+31091,3,31089,7,0,1,
+31091,4,2,18968,7,0,1,
+31121,1,31118,1,
+31121,2,3,31111,1,
+31121,3,31118,4,0,1,
+31121,4,3,29125,4,0,1,
+31123,1,31120,1,
+31123,2,3,31116,1,
+31123,3,31120,6,0,1,
+31123,4,3,18218,11,0,1,
+31139,1,31137,1,
+31139,2,2,31138,1,
+31139,3,31137,3,0,1,
+31139,4,2,17165,2,0,1,
+31147,1,31145,1,
+31147,2,2,31143,1,
+31147,3,31145,6,0,1,
+31147,4,2,22415,8,0,1,
+31151,1,31144,1,
+31151,2,7,31149,1,
+31151,3,31144,9,0,1,
+31151,4,7,26366,12,0,1,
+31153,1,31143,1,
+31153,2,10,31152,1,
+31153,3,31143,2,0,1,
+31153,4,10,30170,15,0,1,
+31159,1,31156,1,
+31159,2,3,31158,1,
+31159,3,31156,1,0,1,
+31159,4,3,27759,2,0,1,
+31177,1,31170,1,
+31177,2,7,31170,1,
+31177,3,31170,2,0,1,
+31177,4,7,19612,12,0,1,
+31181,1,31179,1,
+31181,2,2,31180,1,
+31181,3,31179,3,0,1,
+31181,4,2,28389,3,0,1,
+31183,1,31180,1,
+31183,2,3,31181,1,
+31183,3,31180,6,0,1,
+31183,4,3,31179,4,0,1,
+31189,1,31176,1,
+31189,2,13,31188,1,
+31189,3,31176,3,0,1,
+31189,4,13,20344,7,0,1,
+31193,1,31188,1,
+31193,2,5,31192,1,
+31193,3,31188,5,0,1,
+31193,4,5,20145,6,0,1,
+31219,1,31209,1,
+31219,2,10,31217,1,
+31219,3,31209,2,0,1,
+31219,4,10,31207,6,0,1,
+31223,1,31218,1,
+31223,2,5,31221,1,
+31223,3,31218,3,0,1,
+31223,4,5,27619,5,0,1,
+31231,1,31225,1,
+31231,2,6,31230,1,
+31231,3,31225,3,0,1,
+31231,4,6,24588,3,0,1,
+31237,1,31231,1,
+31237,2,6,31235,1,
+31237,3,31231,7,0,1,
+31237,4,6,31227,7,0,1,
+31247,1,31242,1,
+31247,2,5,31244,1,
+31247,3,31242,1,0,1,
+31247,4,5,28170,11,0,1,
+31249,1,31226,1,
+31249,2,23,31245,1,
+31249,3,31226,9,0,1,
+31249,4,23,26334,27,0,1,
+31253,1,31251,1,
+31253,2,2,31252,1,
+31253,3,31251,3,0,1,
+31253,4,2,29539,3,0,1,
+31259,1,31257,1,
+31259,2,2,31255,1,
+31259,3,31257,2,0,1,
+31259,4,2,20506,8,0,1,
+31267,1,31265,1,
+31267,2,2,31266,1,
+31267,3,31265,4,0,1,
+31267,4,2,27397,2,0,1,
+31271,1,31264,1,
+31271,2,7,31270,1,
+31271,3,31264,1,0,1,
+31271,4,7,19977,2,0,1,
+31277,1,31275,1,
+31277,2,2,31270,1,
+31277,3,31275,4,0,1,
+31277,4,2,30358,5,0,1,
+31307,1,31305,1,
+31307,2,2,31303,1,
+31307,3,31305,2,0,1,
+31307,4,2,27165,13,0,1,
+31319,1,31312,1,
+31319,2,7,31308,1,
+31319,3,31312,10,0,1,
+31319,4,7,25793,4,0,1,
+31321,1,31314,1,
+31321,2,7,31314,1,
+31321,3,31314,2,0,1,
+31321,4,7,25513,0,0,1,
+31327,1,31321,1,
+31327,2,6,31324,1,
+31327,3,31321,8,0,1,
+31327,4,6,21898,4,0,1,
+31333,1,31328,1,
+31333,2,5,31332,1,
+31333,3,31328,2,0,1,
+31333,4,5,25417,6,0,1,
+31337,1,31334,1,
+31337,2,3,31332,1,
+31337,3,31334,5,0,1,
+31337,4,3,27679,0,0,1,
+31357,1,31355,1,
+31357,2,2,31353,1,
+31357,3,31355,9,0,1,
+31357,4,2,24570,12,0,1,
+31379,1,31377,1,
+31379,2,2,31378,1,
+31379,3,31377,5,0,1,
+31379,4,2,27418,4,0,1,
+31387,1,31385,1,
+31387,2,2,31386,1,
+31387,3,31385,4,0,1,
+31387,4,2,15928,10,0,1,
+31391,1,31360,1,
+31391,2,31,31389,1,
+31391,3,31360,1,0,1,
+31391,4,31,16662,4,0,1,
+31393,1,31388,1,
+31393,2,5,31390,1,
+31393,3,31388,2,0,1,
+31393,4,5,26054,10,0,1,
+31397,1,31395,1,
+31397,2,2,31393,1,
+31397,3,31395,3,0,1,
+31397,4,2,28910,9,0,1,
+31469,1,31467,1,
+31469,2,2,31459,1,
+31469,3,31467,7,0,1,
+31469,4,2,19610,0,0,1,
+31477,1,31471,1,
+31477,2,6,31475,1,
+31477,3,31471,1,0,1,
+31477,4,6,16850,0,0,1,
+31481,1,31475,1,
+31481,2,6,31478,1,
+31481,3,31475,1,0,1,
+31481,4,6,30304,14,0,1,
+31489,1,31482,1,
+31489,2,7,31482,1,
+31489,3,31482,1,0,1,
+31489,4,7,28488,0,0,1,
+31511,1,31504,1,
+31511,2,7,31510,1,
+31511,3,31504,4,0,1,
+31511,4,7,17581,7,0,1,
+31513,1,31506,1,
+31513,2,7,31506,1,
+31513,3,31506,9,0,1,
+31513,4,7,25338,12,0,1,
+31517,1,31515,1,
+31517,2,2,31511,1,
+31517,3,31515,3,0,1,
+31517,4,2,30053,1,0,1,
+31531,1,31529,1,
+31531,2,2,31530,1,
+31531,3,31529,5,0,1,
+31531,4,2,20456,6,0,1,
+31541,1,31538,1,
+31541,2,3,31539,1,
+31541,3,31538,1,0,1,
+31541,4,3,31537,4,0,1,
+31543,1,31540,1,
+31543,2,3,31542,1,
+31543,3,31540,1,0,1,
+31543,4,3,20872,2,0,1,
+31547,1,31545,1,
+31547,2,2,31546,1,
+31547,3,31545,2,0,1,
+31547,4,2,17600,2,0,1,
+31567,1,31561,1,
+31567,2,6,31566,1,
+31567,3,31561,1,0,1,
+31567,4,6,24886,2,0,1,
+31573,1,31568,1,
+31573,2,5,31572,1,
+31573,3,31568,2,0,1,
+31573,4,5,18777,3,0,1,
+31583,1,31578,1,
+31583,2,5,31578,1,
+31583,3,31578,1,0,1,
+31583,4,5,30502,7,0,1,
+31601,1,31598,1,
+31601,2,3,31596,1,
+31601,3,31598,8,0,1,
+31601,4,3,20344,2,0,1,
+31607,1,31602,1,
+31607,2,5,31602,1,
+31607,3,31602,2,0,1,
+31607,4,5,30966,7,0,1,
+31627,1,31624,1,
+31627,2,3,31626,1,
+31627,3,31624,4,0,1,
+31627,4,3,21695,2,0,1,
+31643,1,31641,1,
+31643,2,2,31642,1,
+31643,3,31641,2,0,1,
+31643,4,2,21228,4,0,1,
+31649,1,31646,1,
+31649,2,3,31648,1,
+31649,3,31646,1,0,1,
+31649,4,3,27565,4,0,1,
+31657,1,31652,1,
+31657,2,5,31656,1,
+31657,3,31652,2,0,1,
+31657,4,5,23384,6,0,1,
+31663,1,31660,1,
+31663,2,3,31661,1,
+31663,3,31660,4,0,1,
+31663,4,3,25142,6,0,1,
+31667,1,31665,1,
+31667,2,2,31666,1,
+31667,3,31665,2,0,1,
+31667,4,2,21477,2,0,1,
+31687,1,31684,1,
+31687,2,3,31686,1,
+31687,3,31684,1,0,1,
+31687,4,3,21500,5,0,1,
+31699,1,31697,1,
+31699,2,2,31698,1,
+31699,3,31697,4,0,1,
+31699,4,2,16753,10,0,1,
+31721,1,31710,1,
+31721,2,11,31716,1,
+31721,3,31710,2,0,1,
+31721,4,11,29853,11,0,1,
+31723,1,31720,1,
+31723,2,3,31716,1,
+31723,3,31720,3,0,1,
+31723,4,3,27099,5,0,1,
+31727,1,31722,1,
+31727,2,5,31725,1,
+31727,3,31722,7,0,1,
+31727,4,5,31723,3,0,1,
+31729,1,31722,1,
+31729,2,7,31726,1,
+31729,3,31722,1,0,1,
+31729,4,7,23340,24,0,1,
+31741,1,31735,1,
+31741,2,6,31737,1,
+31741,3,31735,2,0,1,
+31741,4,6,31737,6,0,1,
+31751,1,31740,1,
+31751,2,11,31749,1,
+31751,3,31740,1,0,1,
+31751,4,11,21928,3,0,1,
+31769,1,31763,1,
+31769,2,6,31757,1,
+31769,3,31763,1,0,1,
+31769,4,6,17097,5,0,1,
+31771,1,31761,1,
+31771,2,10,31769,1,
+31771,3,31761,5,0,1,
+31771,4,10,27394,8,0,1,
+31793,1,31790,1,
+31793,2,3,31780,1,
+31793,3,31790,3,0,1,
+31793,4,3,25278,3,0,1,
+31799,1,31788,1,
+31799,2,11,31798,1,
+31799,3,31788,2,0,1,
+31799,4,11,28237,2,0,1,
+31817,1,31814,1,
+31817,2,3,31812,1,
+31817,3,31814,9,0,1,
+31817,4,3,31345,0,0,1,
+31847,1,31842,1,
+31847,2,5,31845,1,
+31847,3,31842,1,0,1,
+31847,4,5,31843,3,0,1,
+31849,1,31835,1,
+31849,2,14,31846,1,
+31849,3,31835,2,0,1,
+31849,4,14,25058,10,0,1,
+31859,1,31857,1,
+31859,2,2,31855,1,
+31859,3,31857,9,0,1,
+31859,4,2,16084,7,0,1,
+31873,1,31862,1,
+31873,2,11,31871,1,
+31873,3,31862,4,0,1,
+31873,4,11,16816,17,0,1,
+31883,1,31881,1,
+31883,2,2,31882,1,
+31883,3,31881,2,0,1,
+31883,4,2,20059,4,0,1,
+31891,1,31889,1,
+31891,2,2,31890,1,
+31891,3,31889,6,0,1,
+31891,4,2,25349,7,0,1,
+31907,1,31905,1,
+31907,2,2,31901,1,
+31907,3,31905,9,0,1,
+31907,4,2,20919,4,0,1,
+31957,1,31955,1,
+31957,2,2,31953,1,
+31957,3,31955,4,0,1,
+31957,4,2,24976,12,0,1,
+31963,1,31961,1,
+31963,2,2,31959,1,
+31963,3,31961,4,0,1,
+31963,4,2,31017,10,0,1,
+31973,1,31971,1,
+31973,2,2,31969,1,
+31973,3,31971,3,0,1,
+31973,4,2,16771,9,0,1,
+31981,1,31975,1,
+31981,2,6,31980,1,
+31981,3,31975,4,0,1,
+31981,4,6,22591,22,0,1,
+31991,1,31984,1,
+31991,2,7,31988,1,
+31991,3,31984,1,0,1,
+31991,4,7,24528,5,0,1,
+32003,1,32001,1,
+32003,2,2,31995,1,
+32003,3,32001,2,0,1,
+32003,4,2,17396,0,0,1,
+32009,1,32006,1,
+32009,2,3,32008,1,
+32009,3,32006,6,0,1,
+32009,4,3,19461,4,0,1,
+32027,1,32025,1,
+32027,2,2,32023,1,
+32027,3,32025,3,0,1,
+32027,4,2,21014,14,0,1,
+32029,1,32027,1,
+32029,2,2,32025,1,
+32029,3,32027,4,0,1,
+32029,4,2,23167,12,0,1,
+32051,1,32041,1,
+32051,2,10,32046,1,
+32051,3,32041,2,0,1,
+32051,4,10,25281,3,0,1,
+32057,1,32054,1,
+32057,2,3,32050,1,
+32057,3,32054,1,0,1,
+32057,4,3,20274,1,0,1,
+32059,1,32057,1,
+32059,2,2,32055,1,
+32059,3,32057,6,0,1,
+32059,4,2,18541,1,0,1,
+32063,1,32058,1,
+32063,2,5,32062,1,
+32063,3,32058,2,0,1,
+32063,4,5,18079,2,0,1,
+32069,1,32067,1,
+32069,2,2,32065,1,
+32069,3,32067,3,0,1,
+32069,4,2,16860,6,0,1,
+32077,1,32075,1,
+32077,2,2,32076,1,
+32077,3,32075,6,0,1,
+32077,4,2,21600,6,0,1,
+32083,1,32081,1,
+32083,2,2,32079,1,
+32083,3,32081,4,0,1,
+32083,4,2,22551,8,0,1,
+32089,1,32076,1,
+32089,2,13,32088,1,
+32089,3,32076,5,0,1,
+32089,4,13,20637,12,0,1,
+32099,1,32097,1,
+32099,2,2,32095,1,
+32099,3,32097,3,0,1,
+32099,4,2,24817,7,0,1,
+32117,1,32115,1,
+32117,2,2,32113,1,
+32117,3,32115,3,0,1,
+32117,4,2,20811,7,0,1,
+32119,1,32116,1,
+32119,2,3,32118,1,
+32119,3,32116,1,0,1,
+32119,4,3,26845,3,0,1,
+32141,1,32139,1,
+32141,2,2,32136,1,
+32141,3,32139,11,0,1,
+32141,4,2,17811,2,0,1,
+32143,1,32137,1,
+32143,2,6,32139,1,
+32143,3,32137,2,0,1,
+32143,4,6,24658,1,0,1,
+32159,1,32152,1,
+32159,2,7,32157,1,
+32159,3,32152,4,0,1,
+32159,4,7,27961,5,0,1,
+32173,1,32168,1,
+32173,2,5,32168,1,
+32173,3,32168,1,0,1,
+32173,4,5,24843,7,0,1,
+32183,1,32178,1,
+32183,2,5,32181,1,
+32183,3,32178,6,0,1,
+32183,4,5,32179,3,0,1,
+32189,1,32187,1,
+32189,2,2,32188,1,
+32189,3,32187,3,0,1,
+32189,4,2,18279,4,0,1,
+32191,1,32185,1,
+32191,2,6,32190,1,
+32191,3,32185,1,0,1,
+32191,4,6,23688,2,0,1,
+32203,1,32201,1,
+32203,2,2,32202,1,
+32203,3,32201,2,0,1,
+32203,4,2,24230,2,0,1,
+32213,1,32211,1,
+32213,2,2,32209,1,
+32213,3,32211,3,0,1,
+32213,4,2,23787,1,0,1,
+32233,1,32228,1,
+32233,2,5,32228,1,
+32233,3,32228,1,0,1,
+32233,4,5,28092,20,0,1,
+32237,1,32235,1,
+32237,2,2,32233,1,
+32237,3,32235,4,0,1,
+32237,4,2,18370,6,0,1,
+32251,1,32248,1,
+32251,2,3,32250,1,
+32251,3,32248,14,0,1,
+32251,4,3,25215,2,0,1,
+32257,1,32242,1,
+32257,2,15,32256,1,
+32257,3,32242,1,0,1,
+32257,4,15,22507,20,0,1,
+32261,1,32259,1,
+32261,2,2,32257,1,
+32261,3,32259,3,0,1,
+32261,4,2,29740,1,0,1,
+32297,1,32294,1,
+32297,2,3,32291,1,
+32297,3,32294,6,0,1,
+32297,4,3,23537,9,0,1,
+32299,1,32287,1,
+32299,2,12,32298,1,
+32299,3,32287,5,0,1,
+32299,4,12,20907,7,0,1,
+32303,1,32298,1,
+32303,2,5,32302,1,
+32303,3,32298,5,0,1,
+32303,4,5,20531,7,0,1,
+32309,1,32307,1,
+32309,2,2,32300,1,
+32309,3,32307,4,0,1,
+32309,4,2,25180,1,0,1,
+32321,1,32315,1,
+32321,2,6,32309,1,
+32321,3,32315,7,0,1,
+32321,4,6,20416,0,0,1,
+32323,1,32321,1,
+32323,2,2,32319,1,
+32323,3,32321,6,0,1,
+32323,4,2,30321,10,0,1,
+32327,1,32322,1,
+32327,2,5,32326,1,
+32327,3,32322,3,0,1,
+32327,4,5,19526,3,0,1,
+32341,1,32339,1,
+32341,2,2,32337,1,
+32341,3,32339,4,0,1,
+32341,4,2,18167,6,0,1,
+32353,1,32338,1,
+32353,2,15,32351,1,
+32353,3,32338,3,0,1,
+32353,4,15,32325,16,0,1,
+32359,1,32356,1,
+32359,2,3,32358,1,
+32359,3,32356,1,0,1,
+32359,4,3,26081,3,0,1,
+32363,1,32361,1,
+32363,2,2,32356,1,
+32363,3,32361,8,0,1,
+32363,4,2,27433,0,0,1,
+32369,1,32363,1,
+32369,2,6,32359,1,
+32369,3,32363,2,0,1,
+32369,4,6,25327,4,0,1,
+32371,1,32369,1,
+32371,2,2,32370,1,
+32371,3,32369,6,0,1,
+32371,4,2,30989,6,0,1,
+32377,1,32372,1,
+32377,2,5,32372,1,
+32377,3,32372,3,0,1,
+32377,4,5,25952,15,0,1,
+32381,1,32379,1,
+32381,2,2,32377,1,
+32381,3,32379,3,0,1,
+32381,4,2,30655,1,0,1,
+32401,1,32394,1,
+32401,2,7,32394,1,
+32401,3,32394,5,0,1,
+32401,4,7,20058,0,0,1,
+32411,1,32409,1,
+32411,2,2,32399,1,
+32411,3,32409,2,0,1,
+32411,4,2,30480,1,0,1,
+32413,1,32408,1,
+32413,2,5,32412,1,
+32413,3,32408,1,0,1,
+32413,4,5,20094,6,0,1,
+32423,1,32418,1,
+32423,2,5,32421,1,
+32423,3,32418,2,0,1,
+32423,4,5,19579,9,0,1,
+32429,1,32426,1,
+32429,2,3,32424,1,
+32429,3,32426,3,0,1,
+32429,4,3,17357,2,0,1,
+32441,1,32438,1,
+32441,2,3,32440,1,
+32441,3,32438,3,0,1,
+32441,4,3,29800,7,0,1,
+32443,1,32441,1,
+32443,2,2,32442,1,
+32443,3,32441,4,0,1,
+32443,4,2,23922,2,0,1,
+32467,1,32465,1,
+32467,2,2,32463,1,
+32467,3,32465,5,0,1,
+32467,4,2,29034,8,0,1,
+32479,1,32473,1,
+32479,2,6,32477,1,
+32479,3,32473,2,0,1,
+32479,4,6,28790,3,0,1,
+32491,1,32489,1,
+32491,2,2,32487,1,
+32491,3,32489,2,0,1,
+32491,4,2,18735,10,0,1,
+32497,1,32490,1,
+32497,2,7,32490,1,
+32497,3,32490,4,0,1,
+32497,4,7,16766,21,0,1,
+32503,1,32500,1,
+32503,2,3,32501,1,
+32503,3,32500,5,0,1,
+32503,4,3,32026,3,0,1,
+32507,1,32505,1,
+32507,2,2,32506,1,
+32507,3,32505,2,0,1,
+32507,4,2,22167,12,0,1,
+32531,1,32529,1,
+32531,2,2,32527,1,
+32531,3,32529,3,0,1,
+32531,4,2,16799,7,0,1,
+32533,1,32531,1,
+32533,2,2,32529,1,
+32533,3,32531,6,0,1,
+32533,4,2,25409,17,0,1,
+32537,1,32534,1,
+32537,2,3,32536,1,
+32537,3,32534,5,0,1,
+32537,4,3,28952,11,0,1,
+32561,1,32555,1,
+32561,2,6,32555,1,
+32561,3,32555,1,0,1,
+32561,4,6,19428,0,0,1,
+32563,1,32561,1,
+32563,2,2,32562,1,
+32563,3,32561,2,0,1,
+32563,4,2,24619,7,0,1,
+32569,1,32562,1,
+32569,2,7,32562,1,
+32569,3,32562,1,0,1,
+32569,4,7,20514,0,0,1,
+32573,1,32571,1,
+32573,2,2,32566,1,
+32573,3,32571,14,0,1,
+32573,4,2,29250,5,0,1,
+32579,1,32573,1,
+32579,2,6,32577,1,
+32579,3,32573,3,0,1,
+32579,4,6,23356,0,0,1,
+32587,1,32585,1,
+32587,2,2,32583,1,
+32587,3,32585,4,0,1,
+32587,4,2,28439,8,0,1,
+32603,1,32601,1,
+32603,2,2,32598,1,
+32603,3,32601,4,0,1,
+32603,4,2,24530,9,0,1,
+32609,1,32606,1,
+32609,2,3,32603,1,
+32609,3,32606,3,0,1,
+32609,4,3,19295,3,0,1,
+32611,1,32608,1,
+32611,2,3,32610,1,
+32611,3,32608,6,0,1,
+32611,4,3,28696,6,0,1,
+32621,1,32618,1,
+32621,2,3,32620,1,
+32621,3,32618,7,0,1,
+32621,4,3,29276,3,0,1,
+32633,1,32630,1,
+32633,2,3,32627,1,
+32633,3,32630,5,0,1,
+32633,4,3,28234,13,0,1,
+32647,1,32644,1,
+32647,2,3,32646,1,
+32647,3,32644,3,0,1,
+32647,4,3,17491,5,0,1,
+32653,1,32651,1,
+32653,2,2,32652,1,
+32653,3,32651,2,0,1,
+32653,4,2,22423,6,0,1,
+32687,1,32682,1,
+32687,2,5,32684,1,
+32687,3,32682,2,0,1,
+32687,4,5,30309,6,0,1,
+32693,1,32691,1,
+32693,2,2,32692,1,
+32693,3,32691,2,0,1,
+32693,4,2,23175,4,0,1,
+32707,1,32704,1,
+32707,2,3,32692,1,
+32707,3,32704,8,0,1,
+32707,4,3,23204,1,0,1,
+32713,1,32708,1,
+32713,2,5,32712,1,
+32713,3,32708,1,0,1,
+32713,4,5,18247,6,0,1,
+32717,1,32715,1,
+32717,2,2,32703,1,
+32717,3,32715,2,0,1,
+32717,4,2,29481,2,0,1,
+32719,1,32716,1,
+32719,2,3,32717,1,
+32719,3,32716,11,0,1,
+32719,4,3,32715,4,0,1,
+32749,1,32747,1,
+32749,2,2,32748,1,
+32749,3,32747,5,0,1,
+32749,4,2,30851,3,0,1,
+32771,1,32769,1,
+32771,2,2,32767,1,
+32771,3,32769,2,0,1,
+32771,4,2,32259,7,0,1,
+32779,1,32776,1,
+32779,2,3,32774,1,
+32779,3,32776,6,0,1,
+32779,4,3,26012,3,0,1,
+32783,1,32776,1,
+32783,2,7,32782,1,
+32783,3,32776,2,0,1,
+32783,4,7,28998,3,0,1,
+32789,1,32787,1,
+32789,2,2,32781,1,
+32789,3,32787,2,0,1,
+32789,4,2,32277,11,0,1,
+32797,1,32795,1,
+32797,2,2,32793,1,
+32797,3,32795,6,0,1,
+32797,4,2,28616,9,0,1,
+32801,1,32798,1,
+32801,2,3,32800,1,
+32801,3,32798,3,0,1,
+32801,4,3,22863,4,0,1,
+32803,1,32798,1,
+32803,2,5,32801,1,
+32803,3,32798,2,0,1,
+32803,4,5,25866,0,0,1,
+32831,1,32818,1,
+32831,2,13,32830,1,
+32831,3,32818,4,0,1,
+32831,4,13,18423,2,0,1,
+32833,1,32828,1,
+32833,2,5,32828,1,
+32833,3,32828,3,0,1,
+32833,4,5,29968,10,0,1,
+32839,1,32833,1,
+32839,2,6,32835,1,
+32839,3,32833,2,0,1,
+32839,4,6,21220,8,0,1,
+32843,1,32841,1,
+32843,2,2,32839,1,
+32843,3,32841,2,0,1,
+32843,4,2,17834,11,0,1,
+32869,1,32863,1,
+32869,2,6,32865,1,
+32869,3,32863,9,0,1,
+32869,4,6,27500,10,0,1,
+32887,1,32884,1,
+32887,2,3,32886,1,
+32887,3,32884,1,0,1,
+32887,4,3,26361,2,0,1,
+32909,1,32907,1,
+32909,2,2,32904,1,
+32909,3,32907,2,0,1,
+32909,4,2,18890,16,0,1,
+32911,1,32908,1,
+32911,2,3,32910,1,
+32911,3,32908,1,0,1,
+32911,4,3,18623,2,0,1,
+32917,1,32915,1,
+32917,2,2,32916,1,
+32917,3,32915,6,0,1,
+32917,4,2,21131,9,0,1,
+32933,1,32931,1,
+32933,2,2,32932,1,
+32933,3,32931,2,0,1,
+32933,4,2,20665,3,0,1,
+32939,1,32937,1,
+32939,2,2,32929,1,
+32939,3,32937,2,0,1,
+32939,4,2,21184,0,0,1,
+32941,1,32939,1,
+32941,2,2,32940,1,
+32941,3,32939,5,0,1,
+32941,4,2,22761,3,0,1,
+32957,1,32945,1,
+32957,2,12,32956,1,
+32957,3,32945,4,0,1,
+32957,4,12,18115,9,0,1,
+32969,1,32966,1,
+32969,2,3,32963,1,
+32969,3,32966,8,0,1,
+32969,4,3,32957,0,0,1,
+32971,1,32960,1,
+32971,2,11,32970,1,
+32971,3,32960,1,0,1,
+32971,4,11,24648,7,0,1,
+32983,1,32980,1,
+32983,2,3,32981,1,
+32983,3,32980,4,0,1,
+32983,4,3,16927,3,0,1,
+32987,1,32985,1,
+32987,2,2,32986,1,
+32987,3,32985,2,0,1,
+32987,4,2,28023,2,0,1,
+32993,1,32990,1,
+32993,2,3,32987,1,
+32993,3,32990,1,0,1,
+32993,4,3,32244,1,0,1,
+32999,1,32992,1,
+32999,2,7,32997,1,
+32999,3,32992,4,0,1,
+32999,4,7,31501,5,0,1,
+33013,1,33008,1,
+33013,2,5,33012,1,
+33013,3,33008,2,0,1,
+33013,4,5,17239,6,0,1,
+33023,1,33018,1,
+33023,2,5,33018,1,
+33023,3,33018,2,0,1,
+33023,4,5,27157,7,0,1,
+33029,1,33027,1,
+33029,2,2,33028,1,
+33029,3,33027,3,0,1,
+33029,4,2,27592,3,0,1,
+33037,1,33035,1,
+33037,2,2,33033,1,
+33037,3,33035,4,0,1,
+33037,4,2,26224,6,0,1,
+33049,1,33020,1,
+33049,2,29,33048,1,
+33049,3,33020,3,0,1,
+33049,4,29,17775,20,0,1,
+33053,1,33051,1,
+33053,2,2,33052,1,
+33053,3,33051,2,0,1,
+33053,4,2,23062,4,0,1,
+33071,1,33060,1,
+33071,2,11,33060,1,
+33071,3,33060,4,0,1,
+33071,4,11,30672,0,0,1,
+33073,1,33068,1,
+33073,2,5,33072,1,
+33073,3,33068,3,0,1,
+33073,4,5,18093,6,0,1,
+33083,1,33081,1,
+33083,2,2,33073,1,
+33083,3,33081,7,0,1,
+33083,4,2,29809,8,0,1,
+33091,1,33088,1,
+33091,2,3,33086,1,
+33091,3,33088,1,0,1,
+33091,4,3,27901,3,0,1,
+33107,1,33105,1,
+33107,2,2,33101,1,
+33107,3,33105,9,0,1,
+33107,4,2,19761,4,0,1,
+33113,1,33110,1,
+33113,2,3,33108,1,
+33113,3,33110,3,0,1,
+33113,4,3,22628,0,0,1,
+33119,1,33112,1,
+33119,2,7,33118,1,
+33119,3,33112,1,0,1,
+33119,4,7,33110,4,0,1,
+33149,1,33147,1,
+33149,2,2,33145,1,
+33149,3,33147,3,0,1,
+33149,4,2,16778,7,0,1,
+33151,1,33148,1,
+33151,2,3,33150,1,
+33151,3,33148,3,0,1,
+33151,4,3,26104,2,0,1,
+33161,1,33158,1,
+33161,2,3,33156,1,
+33161,3,33158,9,0,1,
+33161,4,3,20542,2,0,1,
+33179,1,33177,1,
+33179,2,2,33178,1,
+33179,3,33177,3,0,1,
+33179,4,2,32385,6,0,1,
+33181,1,33175,1,
+33181,2,6,33180,1,
+33181,3,33175,1,0,1,
+33181,4,6,22519,7,0,1,
+33191,1,33184,1,
+33191,2,7,33190,1,
+33191,3,33184,2,0,1,
+33191,4,7,20472,2,0,1,
+33199,1,33196,1,
+33199,2,3,33197,1,
+33199,3,33196,3,0,1,
+33199,4,3,20640,6,0,1,
+33203,1,33201,1,
+33203,2,2,33197,1,
+33203,3,33201,4,0,1,
+33203,4,2,21507,4,0,1,
+33211,1,33209,1,
+33211,2,2,33210,1,
+33211,3,33209,6,0,1,
+33211,4,2,25145,2,0,1,
+33223,1,33213,1,
+33223,2,10,33222,1,
+33223,3,33213,4,0,1,
+33223,4,10,23554,2,0,1,
+33247,1,33242,1,
+33247,2,5,33245,1,
+33247,3,33242,3,0,1,
+33247,4,5,27069,10,0,1,
+33287,1,33282,1,
+33287,2,5,33286,1,
+33287,3,33282,2,0,1,
+33287,4,5,23269,2,0,1,
+33289,1,33260,1,
+33289,2,29,33282,1,
+33289,3,33260,1,0,1,
+33289,4,29,17665,24,0,1,
+33301,1,33299,1,
+33301,2,2,33297,1,
+33301,3,33299,6,0,1,
+33301,4,2,29088,12,0,1,
+33311,1,33300,1,
+33311,2,11,33310,1,
+33311,3,33300,11,0,1,
+33311,4,11,20962,2,0,1,
+33317,1,33315,1,
+33317,2,2,33309,1,
+33317,3,33315,10,0,1,
+33317,4,2,32351,3,0,1,
+33329,1,33326,1,
+33329,2,3,33323,1,
+33329,3,33326,18,0,1,
+33329,4,3,33317,0,0,1,
+33331,1,33328,1,
+33331,2,3,33324,1,
+33331,3,33328,1,0,1,
+33331,4,3,19187,5,0,1,
+33343,1,33340,1,
+33343,2,3,33342,1,
+33343,3,33340,6,0,1,
+33343,4,3,33332,12,0,1,
+33347,1,33345,1,
+33347,2,2,33343,1,
+33347,3,33345,3,0,1,
+33347,4,2,27382,7,0,1,
+33349,1,33347,1,
+33349,2,2,33345,1,
+33349,3,33347,4,0,1,
+33349,4,2,28951,6,0,1,
+33353,1,33350,1,
+33353,2,3,33348,1,
+33353,3,33350,1,0,1,
+33353,4,3,17232,0,0,1,
+33359,1,33352,1,
+33359,2,7,33356,1,
+33359,3,33352,3,0,1,
+33359,4,7,32248,5,0,1,
+33377,1,33372,1,
+33377,2,5,33376,1,
+33377,3,33372,3,0,1,
+33377,4,5,17018,6,0,1,
+33391,1,33385,1,
+33391,2,6,33389,1,
+33391,3,33385,1,0,1,
+33391,4,6,26084,4,0,1,
+33403,1,33400,1,
+33403,2,3,33402,1,
+33403,3,33400,8,0,1,
+33403,4,3,26826,5,0,1,
+33409,1,33402,1,
+33409,2,7,33402,1,
+33409,3,33402,11,0,1,
+33409,4,7,26059,0,0,1,
+33413,1,33411,1,
+33413,2,2,33405,1,
+33413,3,33411,4,0,1,
+33413,4,2,24533,13,0,1,
+33427,1,33425,1,
+33427,2,2,33423,1,
+33427,3,33425,6,0,1,
+33427,4,2,23368,10,0,1,
+33457,1,33447,1,
+33457,2,10,33456,1,
+33457,3,33447,5,0,1,
+33457,4,10,25484,12,0,1,
+33461,1,33458,1,
+33461,2,3,33460,1,
+33461,3,33458,7,0,1,
+33461,4,3,32603,3,0,1,
+33469,1,33467,1,
+33469,2,2,33465,1,
+33469,3,33467,2,0,1,
+33469,4,2,22958,10,0,1,
+33479,1,33462,1,
+33479,2,17,33478,1,
+33479,3,33462,1,0,1,
+33479,4,17,26329,2,0,1,
+33487,1,33481,1,
+33487,2,6,33484,1,
+33487,3,33481,1,0,1,
+33487,4,6,26490,4,0,1,
+33493,1,33491,1,
+33493,2,2,33492,1,
+33493,3,33491,5,0,1,
+33493,4,2,33486,8,0,1,
+33503,1,33498,1,
+33503,2,5,33501,1,
+33503,3,33498,8,0,1,
+33503,4,5,20309,5,0,1,
+33521,1,33515,1,
+33521,2,6,33518,1,
+33521,3,33515,4,0,1,
+33521,4,6,32624,10,0,1,
+33529,1,33522,1,
+33529,2,7,33522,1,
+33529,3,33522,1,0,1,
+33529,4,7,25410,0,0,1,
+33533,1,33531,1,
+33533,2,2,33532,1,
+33533,3,33531,3,0,1,
+33533,4,2,18904,6,0,1,
+33547,1,33545,1,
+33547,2,2,33546,1,
+33547,3,33545,4,0,1,
+33547,4,2,32059,7,0,1,
+33563,1,33561,1,
+33563,2,2,33559,1,
+33563,3,33561,3,0,1,
+33563,4,2,22030,14,0,1,
+33569,1,33566,1,
+33569,2,3,33563,1,
+33569,3,33566,8,0,1,
+33569,4,3,33557,0,0,1,
+33577,1,33572,1,
+33577,2,5,33572,1,
+33577,3,33572,1,0,1,
+33577,4,5,32243,10,0,1,
+33581,1,33579,1,
+33581,2,2,33576,1,
+33581,3,33579,7,0,1,
+33581,4,2,31633,2,0,1,
+33587,1,33581,1,
+33587,2,6,33573,1,
+33587,3,33581,1,0,1,
+33587,4,6,26388,9,0,1,
+33589,1,33587,1,
+33589,2,2,33588,1,
+33589,3,33587,6,0,1,
+33589,4,2,26734,3,0,1,
+33599,1,33588,1,
+33599,2,11,33583,1,
+33599,3,33588,4,0,1,
+33599,4,11,26711,3,0,1,
+33601,1,33572,1,
+33601,2,29,33600,1,
+33601,3,33572,1,0,1,
+33601,4,29,29589,12,0,1,
+33613,1,33608,1,
+33613,2,5,33612,1,
+33613,3,33608,5,0,1,
+33613,4,5,18310,3,0,1,
+33617,1,33614,1,
+33617,2,3,33611,1,
+33617,3,33614,1,0,1,
+33617,4,3,31668,11,0,1,
+33619,1,33617,1,
+33619,2,2,33618,1,
+33619,3,33617,5,0,1,
+33619,4,2,28186,2,0,1,
+33623,1,33618,1,
+33623,2,5,33622,1,
+33623,3,33618,3,0,1,
+33623,4,5,20626,4,0,1,
+33629,1,33627,1,
+33629,2,2,33621,1,
+33629,3,33627,3,0,1,
+33629,4,2,20008,0,0,1,
+33637,1,33635,1,
+33637,2,2,33633,1,
+33637,3,33635,6,0,1,
+33637,4,2,23036,6,0,1,
+33641,1,33638,1,
+33641,2,3,33630,1,
+33641,3,33638,1,0,1,
+33641,4,3,32587,4,0,1,
+33647,1,33642,1,
+33647,2,5,33645,1,
+33647,3,33642,5,0,1,
+33647,4,5,21492,5,0,1,
+33679,1,33676,1,
+33679,2,3,33678,1,
+33679,3,33676,1,0,1,
+33679,4,3,32838,3,0,1,
+33703,1,33698,1,
+33703,2,5,33701,1,
+33703,3,33698,3,0,1,
+33703,4,5,33699,3,0,1,
+33713,1,33710,1,
+33713,2,3,33706,1,
+33713,3,33710,1,0,1,
+33713,4,3,25095,2,0,1,
+33721,1,33710,1,
+33721,2,11,33716,1,
+33721,3,33710,3,0,1,
+33721,4,11,33702,24,0,1,
+33739,1,33737,1,
+33739,2,2,33738,1,
+33739,3,33737,6,0,1,
+33739,4,2,28573,2,0,1,
+33749,1,33747,1,
+33749,2,2,33745,1,
+33749,3,33747,2,0,1,
+33749,4,2,25591,12,0,1,
+33751,1,33745,1,
+33751,2,6,33750,1,
+33751,3,33745,1,0,1,
+33751,4,6,22979,3,0,1,
+33757,1,33755,1,
+33757,2,2,33756,1,
+33757,3,33755,2,0,1,
+33757,4,2,27295,6,0,1,
+33767,1,33762,1,
+33767,2,5,33764,1,
+33767,3,33762,5,0,1,
+33767,4,5,17486,4,0,1,
+33769,1,33758,1,
+33769,2,11,33753,1,
+33769,3,33758,3,0,1,
+33769,4,11,33247,5,0,1,
+33773,1,33771,1,
+33773,2,2,33772,1,
+33773,3,33771,2,0,1,
+33773,4,2,24868,4,0,1,
+33791,1,33784,1,
+33791,2,7,33789,1,
+33791,3,33784,2,0,1,
+33791,4,7,22107,11,0,1,
+33797,1,33794,1,
+33797,2,3,33795,1,
+33797,3,33794,6,0,1,
+33797,4,3,32757,14,0,1,
+33809,1,33806,1,
+33809,2,3,33808,1,
+33809,3,33806,12,0,1,
+33809,4,3,27277,7,0,1,
+33811,1,33796,1,
+33811,2,15,33809,1,
+33811,3,33796,3,0,1,
+33811,4,15,24502,0,0,1,
+33827,1,33825,1,
+33827,2,2,33826,1,
+33827,3,33825,12,0,1,
+33827,4,2,33820,8,0,1,
+33829,1,33827,1,
+33829,2,2,33828,1,
+33829,3,33827,8,0,1,
+33829,4,2,29111,7,0,1,
+33851,1,33849,1,
+33851,2,2,33850,1,
+33851,3,33849,3,0,1,
+33851,4,2,33049,6,0,1,
+33857,1,33854,1,
+33857,2,3,33856,1,
+33857,3,33854,1,0,1,
+33857,4,3,30037,4,0,1,
+33863,1,33858,1,
+33863,2,5,33861,1,
+33863,3,33858,7,0,1,
+33863,4,5,24686,5,0,1,
+33871,1,33856,1,
+33871,2,15,33869,1,
+33871,3,33856,1,0,1,
+33871,4,15,26736,4,0,1,
+33889,1,33876,1,
+33889,2,13,33880,1,
+33889,3,33876,5,0,1,
+33889,4,13,24533,28,0,1,
+33893,1,33891,1,
+33893,2,2,33892,1,
+33893,3,33891,2,0,1,
+33893,4,2,17992,4,0,1,
+33911,1,33900,1,
+33911,2,11,33910,1,
+33911,3,33900,13,0,1,
+33911,4,11,26841,3,0,1,
+33923,1,33921,1,
+33923,2,2,33911,1,
+33923,3,33921,5,0,1,
+33923,4,2,20091,23,0,1,
+33931,1,33929,1,
+33931,2,2,33925,1,
+33931,3,33929,6,0,1,
+33931,4,2,17987,3,0,1,
+33937,1,33932,1,
+33937,2,5,33936,1,
+33937,3,33932,2,0,1,
+33937,4,5,20229,6,0,1,
+33941,1,33939,1,
+33941,2,2,33940,1,
+33941,3,33939,3,0,1,
+33941,4,2,26503,3,0,1,
+33961,1,33948,1,
+33961,2,13,33960,1,
+33961,3,33948,15,0,1,
+33961,4,13,24460,14,0,1,
+33967,1,33964,1,
+33967,2,3,33966,1,
+33967,3,33964,1,0,1,
+33967,4,3,20622,5,0,1,
+33997,1,33995,1,
+33997,2,2,33996,1,
+33997,3,33995,2,0,1,
+33997,4,2,28864,3,0,1,
+34019,1,34017,1,
+34019,2,2,34009,1,
+34019,3,34017,4,0,1,
+34019,4,2,21975,0,0,1,
+34031,1,34024,1,
+34031,2,7,34030,1,
+34031,3,34024,1,0,1,
+34031,4,7,34022,4,0,1,
+34033,1,34026,1,
+34033,2,7,34026,1,
+34033,3,34026,3,0,1,
+34033,4,7,19209,12,0,1,
+34039,1,34036,1,
+34039,2,3,34037,1,
+34039,3,34036,4,0,1,
+34039,4,3,29357,3,0,1,
+34057,1,34052,1,
+34057,2,5,34052,1,
+34057,3,34052,7,0,1,
+34057,4,5,24647,25,0,1,
+34061,1,34059,1,
+34061,2,2,34057,1,
+34061,3,34059,3,0,1,
+34061,4,2,28075,1,0,1,
+34123,1,34121,1,
+34123,2,2,34122,1,
+34123,3,34121,4,0,1,
+34123,4,2,34116,8,0,1,
+34127,1,34122,1,
+34127,2,5,34126,1,
+34127,3,34122,7,0,1,
+34127,4,5,33807,2,0,1,
+34129,1,34118,1,
+34129,2,11,34128,1,
+34129,3,34118,3,0,1,
+34129,4,11,27504,18,0,1,
+34141,1,34139,1,
+34141,2,2,34137,1,
+34141,3,34139,4,0,1,
+34141,4,2,17568,6,0,1,
+34147,1,34144,1,
+34147,2,3,34138,1,
+34147,3,34144,1,0,1,
+34147,4,3,22260,2,0,1,
+34157,1,34155,1,
+34157,2,2,34153,1,
+34157,3,34155,3,0,1,
+34157,4,2,19275,12,0,1,
+34159,1,34156,1,
+34159,2,3,34154,1,
+34159,3,34156,4,0,1,
+34159,4,3,20405,7,0,1,
+34171,1,34169,1,
+34171,2,2,34167,1,
+34171,3,34169,6,0,1,
+34171,4,2,23285,8,0,1,
+34183,1,34180,1,
+34183,2,3,34182,1,
+34183,3,34180,1,0,1,
+34183,4,3,26315,2,0,1,
+34211,1,34209,1,
+34211,2,2,34207,1,
+34211,3,34209,16,0,1,
+34211,4,2,30318,7,0,1,
+34213,1,34211,1,
+34213,2,2,34209,1,
+34213,3,34211,6,0,1,
+34213,4,2,21739,10,0,1,
+34217,1,34214,1,
+34217,2,3,34211,1,
+34217,3,34214,1,0,1,
+34217,4,3,30499,12,0,1,
+34231,1,34225,1,
+34231,2,6,34229,1,
+34231,3,34225,3,0,1,
+34231,4,6,18282,4,0,1,
+34253,1,34251,1,
+34253,2,2,34241,1,
+34253,3,34251,20,0,1,
+34253,4,2,22385,4,0,1,
+34259,1,34257,1,
+34259,2,2,34242,1,
+34259,3,34257,2,0,1,
+34259,4,2,27770,7,0,1,
+34261,1,34259,1,
+34261,2,2,34260,1,
+34261,3,34259,6,0,1,
+34261,4,2,27220,3,0,1,
+34267,1,34265,1,
+34267,2,2,34262,1,
+34267,3,34265,5,0,1,
+34267,4,2,22256,2,0,1,
+34273,1,34268,1,
+34273,2,5,34270,1,
+34273,3,34268,3,0,1,
+34273,4,5,20465,18,0,1,
+34283,1,34281,1,
+34283,2,2,34277,1,
+34283,3,34281,9,0,1,
+34283,4,2,30976,7,0,1,
+34297,1,34292,1,
+34297,2,5,34296,1,
+34297,3,34292,2,0,1,
+34297,4,5,24969,6,0,1,
+34301,1,34298,1,
+34301,2,3,34289,1,
+34301,3,34298,17,0,1,
+34301,4,3,30648,2,0,1,
+34303,1,34286,1,
+34303,2,17,34302,1,
+34303,3,34286,1,0,1,
+34303,4,17,20822,2,0,1,
+34313,1,34310,1,
+34313,2,3,34308,1,
+34313,3,34310,3,0,1,
+34313,4,3,25339,0,0,1,
+34319,1,34300,1,
+34319,2,19,34301,1,
+34319,3,34300,1,0,1,
+34319,4,19,29846,19,0,1,
+34327,1,34322,1,
+34327,2,5,34326,1,
+34327,3,34322,3,0,1,
+34327,4,5,31086,2,0,1,
+34337,1,34334,1,
+34337,2,3,34336,1,
+34337,3,34334,1,0,1,
+34337,4,3,22979,6,0,1,
+34351,1,34348,1,
+34351,2,3,34349,1,
+34351,3,34348,1,0,1,
+34351,4,3,32470,3,0,1,
+34361,1,34358,1,
+34361,2,3,34360,1,
+34361,3,34358,3,0,1,
+34361,4,3,30241,7,0,1,
+34367,1,34362,1,
+34367,2,5,34366,1,
+34367,3,34362,3,0,1,
+34367,4,5,19563,4,0,1,
+34369,1,34362,1,
+34369,2,7,34358,1,
+34369,3,34362,2,0,1,
+34369,4,7,21857,18,0,1,
+34381,1,34375,1,
+34381,2,6,34380,1,
+34381,3,34375,2,0,1,
+34381,4,6,18518,11,0,1,
+34403,1,34401,1,
+34403,2,2,34402,1,
+34403,3,34401,2,0,1,
+34403,4,2,18263,13,0,1,
+34421,1,34419,1,
+34421,2,2,34417,1,
+34421,3,34419,2,0,1,
+34421,4,2,32218,23,0,1,
+34429,1,34427,1,
+34429,2,2,34428,1,
+34429,3,34427,4,0,1,
+34429,4,2,21285,3,0,1,
+34439,1,34428,1,
+34439,2,11,34437,1,
+34439,3,34428,11,0,1,
+34439,4,11,17799,3,0,1,
+34457,1,34454,1,
+34457,2,3,34452,1,
+34457,3,34454,3,0,1,
+34457,4,3,25198,0,0,1,
+34469,1,34459,1,
+34469,2,10,34460,1,
+34469,3,34459,7,0,1,
+34469,4,10,24838,7,0,1,
+34471,1,34465,1,
+34471,2,6,34470,1,
+34471,3,34465,1,0,1,
+34471,4,6,19446,3,0,1,
+34483,1,34481,1,
+34483,2,2,34479,1,
+34483,3,34481,6,0,1,
+34483,4,2,24949,8,0,1,
+34487,1,34482,1,
+34487,2,5,34486,1,
+34487,3,34482,1,0,1,
+34487,4,5,28325,4,0,1,
+34499,1,34497,1,
+34499,2,2,34495,1,
+34499,3,34497,3,0,1,
+34499,4,2,18492,7,0,1,
+34501,1,34494,1,
+34501,2,7,34499,1,
+34501,3,34494,4,0,1,
+34501,4,7,28465,12,0,1,
+34511,1,34504,1,
+34511,2,7,34509,1,
+34511,3,34504,1,0,1,
+34511,4,7,24801,4,0,1,
+34513,1,34502,1,
+34513,2,11,34512,1,
+34513,3,34502,2,0,1,
+34513,4,11,33682,8,0,1,
+34519,1,34516,1,
+34519,2,3,34517,1,
+34519,3,34516,4,0,1,
+34519,4,3,25289,3,0,1,
+34537,1,34532,1,
+34537,2,5,34536,1,
+34537,3,34532,11,0,1,
+34537,4,5,34274,6,0,1,
+34543,1,34537,1,
+34543,2,6,34542,1,
+34543,3,34537,1,0,1,
+34543,4,6,28376,3,0,1,
+34549,1,34547,1,
+34549,2,2,34545,1,
+34549,3,34547,2,0,1,
+34549,4,2,19235,6,0,1,
+34583,1,34578,1,
+34583,2,5,34582,1,
+34583,3,34578,1,0,1,
+34583,4,5,32137,4,0,1,
+34589,1,34587,1,
+34589,2,2,34585,1,
+34589,3,34587,7,0,1,
+34589,4,2,23410,6,0,1,
+34591,1,34588,1,
+34591,2,3,34590,1,
+34591,3,34588,5,0,1,
+34591,4,3,24433,2,0,1,
+34603,1,34601,1,
+34603,2,2,34599,1,
+34603,3,34601,4,0,1,
+34603,4,2,21587,8,0,1,
+34607,1,34597,1,
+34607,2,10,34605,1,
+34607,3,34597,6,0,1,
+34607,4,10,24077,4,0,1,
+34613,1,34611,1,
+34613,2,2,34609,1,
+34613,3,34611,2,0,1,
+34613,4,2,30117,1,0,1,
+34631,1,34624,1,
+34631,2,7,34630,1,
+34631,3,34624,3,0,1,
+34631,4,7,20505,3,0,1,
+34649,1,34646,1,
+34649,2,3,34648,1,
+34649,3,34646,7,0,1,
+34649,4,3,25174,7,0,1,
+34651,1,34649,1,
+34651,2,2,34647,1,
+34651,3,34649,2,0,1,
+34651,4,2,27131,8,0,1,
+34667,1,34665,1,
+34667,2,2,34663,1,
+34667,3,34665,2,0,1,
+34667,4,2,22401,7,0,1,
+34673,1,34670,1,
+34673,2,3,34668,1,
+34673,3,34670,3,0,1,
+34673,4,3,29380,0,0,1,
+34679,1,34672,1,
+34679,2,7,34675,1,
+34679,3,34672,4,0,1,
+34679,4,7,28528,5,0,1,
+34687,1,34682,1,
+34687,2,5,34686,1,
+34687,3,34682,11,0,1,
+34687,4,5,20425,5,0,1,
+34693,1,34687,1,
+34693,2,6,34691,1,
+34693,3,34687,1,0,1,
+34693,4,6,26188,8,0,1,
+34703,1,34698,1,
+34703,2,5,34701,1,
+34703,3,34698,6,0,1,
+34703,4,5,24420,5,0,1,
+34721,1,34718,1,
+34721,2,3,34716,1,
+34721,3,34718,1,0,1,
+34721,4,3,34194,8,0,1,
+34729,1,34716,1,
+34729,2,13,34726,1,
+34729,3,34716,6,0,1,
+34729,4,13,22002,14,0,1,
+34739,1,34733,1,
+34739,2,6,34736,1,
+34739,3,34733,1,0,1,
+34739,4,6,29717,1,0,1,
+34747,1,34745,1,
+34747,2,2,34746,1,
+34747,3,34745,2,0,1,
+34747,4,2,34740,8,0,1,
+34757,1,34755,1,
+34757,2,2,34749,1,
+34757,3,34755,13,0,1,
+34757,4,2,18057,11,0,1,
+34759,1,34753,1,
+34759,2,6,34757,1,
+34759,3,34753,2,0,1,
+34759,4,6,25196,4,0,1,
+34763,1,34761,1,
+34763,2,2,34759,1,
+34763,3,34761,3,0,1,
+34763,4,2,26536,8,0,1,
+34781,1,34779,1,
+34781,2,2,34775,1,
+34781,3,34779,3,0,1,
+34781,4,2,34012,3,0,1,
+34807,1,34804,1,
+34807,2,3,34805,1,
+34807,3,34804,10,0,1,
+34807,4,3,30898,3,0,1,
+34819,1,34817,1,
+34819,2,2,34814,1,
+34819,3,34817,2,0,1,
+34819,4,2,20983,3,0,1,
+34841,1,34838,1,
+34841,2,3,34835,1,
+34841,3,34838,4,0,1,
+34841,4,3,34829,0,0,1,
+34843,1,34841,1,
+34843,2,2,34839,1,
+34843,3,34841,4,0,1,
+34843,4,2,21035,8,0,1,
+34847,1,34840,1,
+34847,2,7,34845,1,
+34847,3,34840,2,0,1,
+34847,4,7,33401,6,0,1,
+34849,1,34842,1,
+34849,2,7,34842,1,
+34849,3,34842,7,0,1,
+34849,4,7,28928,0,0,1,
+34871,1,34864,1,
+34871,2,7,34870,1,
+34871,3,34864,3,0,1,
+34871,4,7,22279,2,0,1,
+34877,1,34875,1,
+34877,2,2,34876,1,
+34877,3,34875,2,0,1,
+34877,4,2,18970,3,0,1,
+34883,1,34881,1,
+34883,2,2,34877,1,
+34883,3,34881,4,0,1,
+34883,4,2,24993,0,0,1,
+34897,1,34892,1,
+34897,2,5,34896,1,
+34897,3,34892,7,0,1,
+34897,4,5,25694,11,0,1,
+34913,1,34910,1,
+34913,2,3,34908,1,
+34913,3,34910,1,0,1,
+34913,4,3,21047,0,0,1,
+34919,1,34900,1,
+34919,2,19,34918,1,
+34919,3,34900,1,0,1,
+34919,4,19,27648,2,0,1,
+34939,1,34937,1,
+34939,2,2,34935,1,
+34939,3,34937,2,0,1,
+34939,4,2,22028,10,0,1,
+34949,1,34947,1,
+34949,2,2,34945,1,
+34949,3,34947,3,0,1,
+34949,4,2,33588,1,0,1,
+34961,1,34958,1,
+34961,2,3,34949,1,
+34961,3,34958,1,0,1,
+34961,4,3,21770,0,0,1,
+34963,1,34961,1,
+34963,2,2,34962,1,
+34963,3,34961,2,0,1,
+34963,4,2,32993,2,0,1,
+34981,1,34979,1,
+34981,2,2,34977,1,
+34981,3,34979,6,0,1,
+34981,4,2,21190,6,0,1,
+35023,1,35018,1,
+35023,2,5,35021,1,
+35023,3,35018,2,0,1,
+35023,4,5,35019,3,0,1,
+35027,1,35025,1,
+35027,2,2,35023,1,
+35027,3,35025,3,0,1,
+35027,4,2,33020,11,0,1,
+35051,1,35049,1,
+35051,2,2,35047,1,
+35051,3,35049,3,0,1,
+35051,4,2,31484,7,0,1,
+35053,1,35051,1,
+35053,2,2,35049,1,
+35053,3,35051,6,0,1,
+35053,4,2,34378,12,0,1,
+35059,1,35049,1,
+35059,2,10,35058,1,
+35059,3,35049,2,0,1,
+35059,4,10,24233,2,0,1,
+35069,1,35067,1,
+35069,2,2,35065,1,
+35069,3,35067,3,0,1,
+35069,4,2,23519,1,0,1,
+35081,1,35078,1,
+35081,2,3,35080,1,
+35081,3,35078,4,0,1,
+35081,4,3,24328,4,0,1,
+35083,1,35081,1,
+35083,2,2,35082,1,
+35083,3,35081,2,0,1,
+35083,4,2,30282,11,0,1,
+35089,1,35078,1,
+35089,2,11,35086,1,
+35089,3,35078,11,0,1,
+35089,4,11,23856,10,0,1,
+35099,1,35097,1,
+35099,2,2,35095,1,
+35099,3,35097,2,0,1,
+35099,4,2,30378,7,0,1,
+35107,1,35105,1,
+35107,2,2,35103,1,
+35107,3,35105,5,0,1,
+35107,4,2,33400,8,0,1,
+35111,1,35098,1,
+35111,2,13,35106,1,
+35111,3,35098,2,0,1,
+35111,4,13,34316,6,0,1,
+35117,1,35115,1,
+35117,2,2,35116,1,
+35117,3,35115,2,0,1,
+35117,4,2,29689,4,0,1,
+35129,1,35126,1,
+35129,2,3,35128,1,
+35129,3,35126,4,0,1,
+35129,4,3,30888,4,0,1,
+35141,1,35139,1,
+35141,2,2,35137,1,
+35141,3,35139,2,0,1,
+35141,4,2,22688,7,0,1,
+35149,1,35147,1,
+35149,2,2,35145,1,
+35149,3,35147,2,0,1,
+35149,4,2,33603,6,0,1,
+35153,1,35150,1,
+35153,2,3,35152,1,
+35153,3,35150,10,0,1,
+35153,4,3,30948,7,0,1,
+35159,1,35148,1,
+35159,2,11,35158,1,
+35159,3,35148,2,0,1,
+35159,4,11,27315,3,0,1,
+35171,1,35169,1,
+35171,2,2,35164,1,
+35171,3,35169,4,0,1,
+35171,4,2,30035,1,0,1,
+35201,1,35198,1,
+35201,2,3,35195,1,
+35201,3,35198,5,0,1,
+35201,4,3,35189,0,0,1,
+35221,1,35215,1,
+35221,2,6,35217,1,
+35221,3,35215,4,0,1,
+35221,4,6,19694,2,0,1,
+35227,1,35225,1,
+35227,2,2,35226,1,
+35227,3,35225,2,0,1,
+35227,4,2,21352,11,0,1,
+35251,1,35248,1,
+35251,2,3,35250,1,
+35251,3,35248,6,0,1,
+35251,4,3,34574,7,0,1,
+35257,1,35250,1,
+35257,2,7,35250,1,
+35257,3,35250,5,0,1,
+35257,4,7,22970,12,0,1,
+35267,1,35265,1,
+35267,2,2,35263,1,
+35267,3,35265,3,0,1,
+35267,4,2,34156,7,0,1,
+35279,1,35250,1,
+35279,2,29,35278,1,
+35279,3,35250,7,0,1,
+35279,4,29,18049,2,0,1,
+35281,1,35258,1,
+35281,2,23,35278,1,
+35281,3,35258,1,0,1,
+35281,4,23,25185,32,0,1,
+35291,1,35289,1,
+35291,2,2,35287,1,
+35291,3,35289,2,0,1,
+35291,4,2,23112,8,0,1,
+35311,1,35300,1,
+35311,2,11,35310,1,
+35311,3,35300,3,0,1,
+35311,4,11,20984,3,0,1,
+35317,1,35312,1,
+35317,2,5,35316,1,
+35317,3,35312,1,0,1,
+35317,4,5,23743,6,0,1,
+35323,1,35320,1,
+35323,2,3,35322,1,
+35323,3,35320,8,0,1,
+35323,4,3,20708,5,0,1,
+35327,1,35322,1,
+35327,2,5,35324,1,
+35327,3,35322,1,0,1,
+35327,4,5,23922,4,0,1,
+35339,1,35337,1,
+35339,2,2,35338,1,
+35339,3,35337,3,0,1,
+35339,4,2,20494,4,0,1,
+35353,1,35348,1,
+35353,2,5,35352,1,
+35353,3,35348,5,0,1,
+35353,4,5,21644,8,0,1,
+35363,1,35361,1,
+35363,2,2,35359,1,
+35363,3,35361,2,0,1,
+35363,4,2,29573,7,0,1,
+35381,1,35378,1,
+35381,2,3,35379,1,
+35381,3,35378,3,0,1,
+35381,4,3,28683,14,0,1,
+35393,1,35390,1,
+35393,2,3,35392,1,
+35393,3,35390,1,0,1,
+35393,4,3,20372,7,0,1,
+35401,1,35388,1,
+35401,2,13,35400,1,
+35401,3,35388,7,0,1,
+35401,4,13,24079,14,0,1,
+35407,1,35401,1,
+35407,2,6,35406,1,
+35407,3,35401,2,0,1,
+35407,4,6,22403,9,0,1,
+35419,1,35417,1,
+35419,2,2,35418,1,
+35419,3,35417,4,0,1,
+35419,4,2,35412,8,0,1,
+35423,1,35418,1,
+35423,2,5,35421,1,
+35423,3,35418,3,0,1,
+35423,4,5,31626,5,0,1,
+35437,1,35431,1,
+35437,2,6,35436,1,
+35437,3,35431,1,0,1,
+35437,4,6,25467,6,0,1,
+35447,1,35442,1,
+35447,2,5,35445,1,
+35447,3,35442,1,0,1,
+35447,4,5,20162,5,0,1,
+35449,1,35436,1,
+35449,2,13,35432,1,
+35449,3,35436,5,0,1,
+35449,4,13,30833,6,0,1,
+35461,1,35455,1,
+35461,2,6,35457,1,
+35461,3,35455,1,0,1,
+35461,4,6,35457,6,0,1,
+35491,1,35484,1,
+35491,2,7,35489,1,
+35491,3,35484,4,0,1,
+35491,4,7,24761,6,0,1,
+35507,1,35505,1,
+35507,2,2,35506,1,
+35507,3,35505,2,0,1,
+35507,4,2,32405,2,0,1,
+35509,1,35507,1,
+35509,2,2,35508,1,
+35509,3,35507,4,0,1,
+35509,4,2,19205,7,0,1,
+35521,1,35514,1,
+35521,2,7,35518,1,
+35521,3,35514,1,0,1,
+35521,4,7,33397,14,0,1,
+35527,1,35524,1,
+35527,2,3,35526,1,
+35527,3,35524,5,0,1,
+35527,4,3,20682,5,0,1,
+35531,1,35525,1,
+35531,2,6,35530,1,
+35531,3,35525,1,0,1,
+35531,4,6,27235,4,0,1,
+35533,1,35531,1,
+35533,2,2,35529,1,
+35533,3,35531,4,0,1,
+35533,4,2,33119,6,0,1,
+35537,1,35534,1,
+35537,2,3,35536,1,
+35537,3,35534,7,0,1,
+35537,4,3,30152,4,0,1,
+35543,1,35538,1,
+35543,2,5,35542,1,
+35543,3,35538,3,0,1,
+35543,4,5,29884,3,0,1,
+35569,1,35558,1,
+35569,2,11,35568,1,
+35569,3,35558,4,0,1,
+35569,4,11,31907,18,0,1,
+35573,1,35571,1,
+35573,2,2,35566,1,
+35573,3,35571,2,0,1,
+35573,4,2,22925,4,0,1,
+35591,1,35574,1,
+35591,2,17,35589,1,
+35591,3,35574,1,0,1,
+35591,4,17,35583,3,0,1,
+35593,1,35588,1,
+35593,2,5,35590,1,
+35593,3,35588,2,0,1,
+35593,4,5,32282,10,0,1,
+35597,1,35595,1,
+35597,2,2,35593,1,
+35597,3,35595,3,0,1,
+35597,4,2,32596,9,0,1,
+35603,1,35601,1,
+35603,2,2,35599,1,
+35603,3,35601,3,0,1,
+35603,4,2,34191,7,0,1,
+35617,1,35606,1,
+35617,2,11,35615,1,
+35617,3,35606,12,0,1,
+35617,4,11,31025,32,0,1,
+35671,1,35668,1,
+35671,2,3,35665,1,
+35671,3,35668,6,0,1,
+35671,4,3,33223,7,0,1,
+35677,1,35675,1,
+35677,2,2,35676,1,
+35677,3,35675,2,0,1,
+35677,4,2,33207,20,0,1,
+35729,1,35726,1,
+35729,2,3,35724,1,
+35729,3,35726,3,0,1,
+35729,4,3,22054,2,0,1,
+35731,1,35729,1,
+35731,2,2,35730,1,
+35731,3,35729,4,0,1,
+35731,4,2,20912,6,0,1,
+35747,1,35745,1,
+35747,2,2,35739,1,
+35747,3,35745,5,0,1,
+35747,4,2,20052,0,0,1,
+35753,1,35750,1,
+35753,2,3,35741,1,
+35753,3,35750,8,0,1,
+35753,4,3,24804,6,0,1,
+35759,1,35748,1,
+35759,2,11,35758,1,
+35759,3,35748,2,0,1,
+35759,4,11,31616,4,0,1,
+35771,1,35765,1,
+35771,2,6,35769,1,
+35771,3,35765,6,0,1,
+35771,4,6,23040,0,0,1,
+35797,1,35795,1,
+35797,2,2,35793,1,
+35797,3,35795,2,0,1,
+35797,4,2,21997,9,0,1,
+35801,1,35798,1,
+35801,2,3,35800,1,
+35801,3,35798,1,0,1,
+35801,4,3,18410,4,0,1,
+35803,1,35789,1,
+35803,2,14,35802,1,
+35803,3,35789,12,0,1,
+35803,4,14,28409,2,0,1,
+35809,1,35796,1,
+35809,2,13,35808,1,
+35809,3,35796,1,0,1,
+35809,4,13,20668,14,0,1,
+35831,1,35820,1,
+35831,2,11,35829,1,
+35831,3,35820,1,0,1,
+35831,4,11,27470,3,0,1,
+35837,1,35835,1,
+35837,2,2,35833,1,
+35837,3,35835,3,0,1,
+35837,4,2,27920,7,0,1,
+35839,1,35833,1,
+35839,2,6,35837,1,
+35839,3,35833,1,0,1,
+35839,4,6,20789,3,0,1,
+35851,1,35849,1,
+35851,2,2,35847,1,
+35851,3,35849,2,0,1,
+35851,4,2,32401,8,0,1,
+35863,1,35860,1,
+35863,2,3,35861,1,
+35863,3,35860,3,0,1,
+35863,4,3,25693,3,0,1,
+35869,1,35859,1,
+35869,2,10,35868,1,
+35869,3,35859,2,0,1,
+35869,4,10,25437,3,0,1,
+35879,1,35872,1,
+35879,2,7,35865,1,
+35879,3,35872,8,0,1,
+35879,4,7,26393,16,0,1,
+35897,1,35894,1,
+35897,2,3,35881,1,
+35897,3,35894,1,0,1,
+35897,4,3,24352,10,0,1,
+35899,1,35897,1,
+35899,2,2,35898,1,
+35899,3,35897,4,0,1,
+35899,4,2,34062,10,0,1,
+35911,1,35899,1,
+35911,2,12,35909,1,
+35911,3,35899,4,0,1,
+35911,4,12,30858,4,0,1,
+35923,1,35921,1,
+35923,2,2,35922,1,
+35923,3,35921,5,0,1,
+35923,4,2,35916,8,0,1,
+35933,1,35931,1,
+35933,2,2,35929,1,
+35933,3,35931,3,0,1,
+35933,4,2,26455,6,0,1,
+35951,1,35940,1,
+35951,2,11,35949,1,
+35951,3,35940,2,0,1,
+35951,4,11,20372,3,0,1,
+35963,1,35961,1,
+35963,2,2,35956,1,
+35963,3,35961,5,0,1,
+35963,4,2,21073,2,0,1,
+35969,1,35966,1,
+35969,2,3,35962,1,
+35969,3,35966,1,0,1,
+35969,4,3,35285,0,0,1,
+35977,1,35967,1,
+35977,2,10,35976,1,
+35977,3,35967,10,0,1,
+35977,4,10,29866,6,0,1,
+35983,1,35980,1,
+35983,2,3,35982,1,
+35983,3,35980,1,0,1,
+35983,4,3,32077,5,0,1,
+35993,1,35990,1,
+35993,2,3,35986,1,
+35993,3,35990,11,0,1,
+35993,4,3,21439,4,0,1,
+35999,1,35986,1,
+35999,2,13,35997,1,
+35999,3,35986,1,0,1,
+35999,4,13,19538,3,0,1,
+36007,1,36004,1,
+36007,2,3,36005,1,
+36007,3,36004,3,0,1,
+36007,4,3,33167,6,0,1,
+36011,1,36009,1,
+36011,2,2,36010,1,
+36011,3,36009,3,0,1,
+36011,4,2,36004,8,0,1,
+36013,1,36011,1,
+36013,2,2,36012,1,
+36013,3,36011,6,0,1,
+36013,4,2,30730,3,0,1,
+36017,1,36014,1,
+36017,2,3,36012,1,
+36017,3,36014,1,0,1,
+36017,4,3,25143,0,0,1,
+36037,1,36035,1,
+36037,2,2,36033,1,
+36037,3,36035,5,0,1,
+36037,4,2,31822,6,0,1,
+36061,1,36059,1,
+36061,2,2,36057,1,
+36061,3,36059,2,0,1,
+36061,4,2,24535,10,0,1,
+36067,1,36062,1,
+36067,2,5,36065,1,
+36067,3,36062,1,0,1,
+36067,4,5,29480,0,0,1,
+36073,1,36068,1,
+36073,2,5,36068,1,
+36073,3,36068,1,0,1,
+36073,4,5,30882,15,0,1,
+36083,1,36081,1,
+36083,2,2,36074,1,
+36083,3,36081,2,0,1,
+36083,4,2,34713,1,0,1,
+36097,1,36092,1,
+36097,2,5,36094,1,
+36097,3,36092,1,0,1,
+36097,4,5,36086,14,0,1,
+36107,1,36105,1,
+36107,2,2,36101,1,
+36107,3,36105,7,0,1,
+36107,4,2,31026,4,0,1,
+36109,1,36107,1,
+36109,2,2,36108,1,
+36109,3,36107,6,0,1,
+36109,4,2,25606,3,0,1,
+36131,1,36129,1,
+36131,2,2,36126,1,
+36131,3,36129,2,0,1,
+36131,4,2,29519,3,0,1,
+36137,1,36134,1,
+36137,2,3,36131,1,
+36137,3,36134,4,0,1,
+36137,4,3,19639,1,0,1,
+36151,1,36148,1,
+36151,2,3,36149,1,
+36151,3,36148,8,0,1,
+36151,4,3,32430,3,0,1,
+36161,1,36158,1,
+36161,2,3,36153,1,
+36161,3,36158,3,0,1,
+36161,4,3,31503,1,0,1,
+36187,1,36184,1,
+36187,2,3,36186,1,
+36187,3,36184,7,0,1,
+36187,4,3,33102,5,0,1,
+36191,1,36184,1,
+36191,2,7,36189,1,
+36191,3,36184,3,0,1,
+36191,4,7,34588,4,0,1,
+36209,1,36206,1,
+36209,2,3,36195,1,
+36209,3,36206,8,0,1,
+36209,4,3,33794,0,0,1,
+36217,1,36198,1,
+36217,2,19,36213,1,
+36217,3,36198,4,0,1,
+36217,4,19,30943,11,0,1,
+36229,1,36227,1,
+36229,2,2,36225,1,
+36229,3,36227,5,0,1,
+36229,4,2,23421,10,0,1,
+36241,1,36222,1,
+36241,2,19,36238,1,
+36241,3,36222,1,0,1,
+36241,4,19,30081,22,0,1,
+36251,1,36249,1,
+36251,2,2,36247,1,
+36251,3,36249,3,0,1,
+36251,4,2,29127,7,0,1,
+36263,1,36258,1,
+36263,2,5,36258,1,
+36263,3,36258,11,0,1,
+36263,4,5,29741,8,0,1,
+36269,1,36267,1,
+36269,2,2,36265,1,
+36269,3,36267,2,0,1,
+36269,4,2,25760,7,0,1,
+36277,1,36275,1,
+36277,2,2,36276,1,
+36277,3,36275,4,0,1,
+36277,4,2,20036,3,0,1,
+36293,1,36291,1,
+36293,2,2,36292,1,
+36293,3,36291,3,0,1,
+36293,4,2,19996,6,0,1,
+36299,1,36297,1,
+36299,2,2,36295,1,
+36299,3,36297,2,0,1,
+36299,4,2,28690,7,0,1,
+36307,1,36305,1,
+36307,2,2,36306,1,
+36307,3,36305,4,0,1,
+36307,4,2,34759,7,0,1,
+36313,1,36308,1,
+36313,2,5,36310,1,
+36313,3,36308,1,0,1,
+36313,4,5,32125,18,0,1,
+36319,1,36313,1,
+36319,2,6,36315,1,
+36319,3,36313,1,0,1,
+36319,4,6,26609,1,0,1,
+36341,1,36339,1,
+36341,2,2,36337,1,
+36341,3,36339,2,0,1,
+36341,4,2,33197,6,0,1,
+36343,1,36330,1,
+36343,2,13,36342,1,
+36343,3,36330,3,0,1,
+36343,4,13,23388,2,0,1,
+36353,1,36350,1,
+36353,2,3,36348,1,
+36353,3,36350,3,0,1,
+36353,4,3,33590,2,0,1,
+36373,1,36371,1,
+36373,2,2,36369,1,
+36373,3,36371,6,0,1,
+36373,4,2,29979,6,0,1,
+36383,1,36378,1,
+36383,2,5,36380,1,
+36383,3,36378,1,0,1,
+36383,4,5,30951,4,0,1,
+36389,1,36386,1,
+36389,2,3,36387,1,
+36389,3,36386,6,0,1,
+36389,4,3,29737,12,0,1,
+36433,1,36428,1,
+36433,2,5,36432,1,
+36433,3,36428,1,0,1,
+36433,4,5,32929,6,0,1,
+36451,1,36444,1,
+36451,2,7,36445,1,
+36451,3,36444,19,0,1,
+36451,4,7,36447,4,0,1,
+36457,1,36452,1,
+36457,2,5,36456,1,
+36457,3,36452,2,0,1,
+36457,4,5,20331,6,0,1,
+36467,1,36465,1,
+36467,2,2,36463,1,
+36467,3,36465,3,0,1,
+36467,4,2,35613,7,0,1,
+36469,1,36467,1,
+36469,2,2,36468,1,
+36469,3,36467,6,0,1,
+36469,4,2,23910,9,0,1,
+36473,1,36470,1,
+36473,2,3,36472,1,
+36473,3,36470,1,0,1,
+36473,4,3,19617,7,0,1,
+36479,1,36472,1,
+36479,2,7,36476,1,
+36479,3,36472,8,0,1,
+36479,4,7,29389,5,0,1,
+36493,1,36491,1,
+36493,2,2,36489,1,
+36493,3,36491,6,0,1,
+36493,4,2,26318,6,0,1,
+36497,1,36494,1,
+36497,2,3,36496,1,
+36497,3,36494,4,0,1,
+36497,4,3,24594,6,0,1,
+36523,1,36521,1,
+36523,2,2,36519,1,
+36523,3,36521,6,0,1,
+36523,4,2,21049,18,0,1,
+36527,1,36522,1,
+36527,2,5,36525,1,
+36527,3,36522,5,0,1,
+36527,4,5,36523,3,0,1,
+36529,1,36522,1,
+36529,2,7,36522,1,
+36529,3,36522,4,0,1,
+36529,4,7,35431,0,0,1,
+36541,1,36531,1,
+36541,2,10,36540,1,
+36541,3,36531,3,0,1,
+36541,4,10,29944,3,0,1,
+36551,1,36544,1,
+36551,2,7,36550,1,
+36551,3,36544,1,0,1,
+36551,4,7,21398,2,0,1,
+36559,1,36553,1,
+36559,2,6,36557,1,
+36559,3,36553,2,0,1,
+36559,4,6,20681,3,0,1,
+36563,1,36561,1,
+36563,2,2,36559,1,
+36563,3,36561,3,0,1,
+36563,4,2,22728,14,0,1,
+36571,1,36569,1,
+36571,2,2,36570,1,
+36571,3,36569,5,0,1,
+36571,4,2,31515,2,0,1,
+36583,1,36576,1,
+36583,2,7,36580,1,
+36583,3,36576,1,0,1,
+36583,4,7,34883,0,0,1,
+36587,1,36585,1,
+36587,2,2,36582,1,
+36587,3,36585,2,0,1,
+36587,4,2,30336,0,0,1,
+36599,1,36580,1,
+36599,2,19,36595,1,
+36599,3,36580,3,0,1,
+36599,4,19,28767,9,0,1,
+36607,1,36604,1,
+36607,2,3,36606,1,
+36607,3,36604,3,0,1,
+36607,4,3,19013,5,0,1,
+36629,1,36627,1,
+36629,2,2,36628,1,
+36629,3,36627,3,0,1,
+36629,4,2,32104,3,0,1,
+36637,1,36632,1,
+36637,2,5,36634,1,
+36637,3,36632,6,0,1,
+36637,4,5,33971,1,0,1,
+36643,1,36640,1,
+36643,2,3,36642,1,
+36643,3,36640,1,0,1,
+36643,4,3,34748,2,0,1,
+36653,1,36651,1,
+36653,2,2,36649,1,
+36653,3,36651,3,0,1,
+36653,4,2,32200,12,0,1,
+36671,1,36658,1,
+36671,2,13,36670,1,
+36671,3,36658,1,0,1,
+36671,4,13,28165,4,0,1,
+36677,1,36675,1,
+36677,2,2,36673,1,
+36677,3,36675,4,0,1,
+36677,4,2,26307,12,0,1,
+36683,1,36681,1,
+36683,2,2,36679,1,
+36683,3,36681,2,0,1,
+36683,4,2,19255,11,0,1,
+36691,1,36689,1,
+36691,2,2,36687,1,
+36691,3,36689,6,0,1,
+36691,4,2,27601,8,0,1,
+36697,1,36692,1,
+36697,2,5,36696,1,
+36697,3,36692,2,0,1,
+36697,4,5,31757,6,0,1,
+36709,1,36707,1,
+36709,2,2,36705,1,
+36709,3,36707,2,0,1,
+36709,4,2,32935,6,0,1,
+36713,1,36710,1,
+36713,2,3,36712,1,
+36713,3,36710,12,0,1,
+36713,4,3,21973,7,0,1,
+36721,1,36684,1,
+36721,2,37,36716,1,
+36721,3,36684,8,0,1,
+36721,4,37,30482,12,0,1,
+36739,1,36737,1,
+36739,2,2,36738,1,
+36739,3,36737,5,0,1,
+36739,4,2,36407,2,0,1,
+36749,1,36747,1,
+36749,2,2,36745,1,
+36749,3,36747,3,0,1,
+36749,4,2,28643,1,0,1,
+36761,1,36755,1,
+36761,2,6,36751,1,
+36761,3,36755,1,0,1,
+36761,4,6,26036,4,0,1,
+36767,1,36762,1,
+36767,2,5,36766,1,
+36767,3,36762,2,0,1,
+36767,4,5,22326,4,0,1,
+36779,1,36777,1,
+36779,2,2,36775,1,
+36779,3,36777,2,0,1,
+36779,4,2,20821,8,0,1,
+36781,1,36779,1,
+36781,2,2,36780,1,
+36781,3,36779,6,0,1,
+36781,4,2,25314,3,0,1,
+36787,1,36785,1,
+36787,2,2,36783,1,
+36787,3,36785,4,0,1,
+36787,4,2,22006,8,0,1,
+36791,1,36774,1,
+36791,2,17,36787,1,
+36791,3,36774,1,0,1,
+36791,4,17,22588,7,0,1,
+36793,1,36778,1,
+36793,2,15,36790,1,
+36793,3,36778,2,0,1,
+36793,4,15,36460,13,0,1,
+36809,1,36806,1,
+36809,2,3,36804,1,
+36809,3,36806,3,0,1,
+36809,4,3,27220,2,0,1,
+36821,1,36819,1,
+36821,2,2,36814,1,
+36821,3,36819,5,0,1,
+36821,4,2,20832,9,0,1,
+36833,1,36830,1,
+36833,2,3,36827,1,
+36833,3,36830,5,0,1,
+36833,4,3,31974,9,0,1,
+36847,1,36844,1,
+36847,2,3,36846,1,
+36847,3,36844,4,0,1,
+36847,4,3,19359,5,0,1,
+36857,1,36854,1,
+36857,2,3,36856,1,
+36857,3,36854,5,0,1,
+36857,4,3,32096,7,0,1,
+36871,1,36856,1,
+36871,2,15,36870,1,
+36871,3,36856,5,0,1,
+36871,4,15,31644,3,0,1,
+36877,1,36875,1,
+36877,2,2,36873,1,
+36877,3,36875,4,0,1,
+36877,4,2,23194,9,0,1,
+36887,1,36882,1,
+36887,2,5,36886,1,
+36887,3,36882,1,0,1,
+36887,4,5,31122,3,0,1,
+36899,1,36897,1,
+36899,2,2,36893,1,
+36899,3,36897,9,0,1,
+36899,4,2,29442,4,0,1,
+36901,1,36899,1,
+36901,2,2,36897,1,
+36901,3,36899,2,0,1,
+36901,4,2,25191,6,0,1,
+36913,1,36908,1,
+36913,2,5,36912,1,
+36913,3,36908,21,0,1,
+36913,4,5,18803,6,0,1,
+36919,1,36916,1,
+36919,2,3,36917,1,
+36919,3,36916,3,0,1,
+36919,4,3,20454,3,0,1,
+36923,1,36921,1,
+36923,2,2,36919,1,
+36923,3,36921,2,0,1,
+36923,4,2,34345,11,0,1,
+36929,1,36926,1,
+36929,2,3,36919,1,
+36929,3,36926,11,0,1,
+36929,4,3,21647,4,0,1,
+36931,1,36929,1,
+36931,2,2,36930,1,
+36931,3,36929,4,0,1,
+36931,4,2,30324,2,0,1,
+36943,1,36940,1,
+36943,2,3,36941,1,
+36943,3,36940,3,0,1,
+36943,4,3,36935,10,0,1,
+36947,1,36945,1,
+36947,2,2,36940,1,
+36947,3,36945,8,0,1,
+36947,4,2,24391,0,0,1,
+36973,1,36971,1,
+36973,2,2,36972,1,
+36973,3,36971,2,0,1,
+36973,4,2,23162,3,0,1,
+36979,1,36976,1,
+36979,2,3,36978,1,
+36979,3,36976,7,0,1,
+36979,4,3,19090,6,0,1,
+36997,1,36995,1,
+36997,2,2,36993,1,
+36997,3,36995,4,0,1,
+36997,4,2,21881,6,0,1,
+37003,1,37001,1,
+37003,2,2,36999,1,
+37003,3,37001,5,0,1,
+37003,4,2,26101,8,0,1,
+37013,1,37011,1,
+37013,2,2,37005,1,
+37013,3,37011,10,0,1,
+37013,4,2,29720,5,0,1,
+37019,1,37017,1,
+37019,2,2,37014,1,
+37019,3,37017,4,0,1,
+37019,4,2,22512,3,0,1,
+37021,1,37015,1,
+37021,2,6,37020,1,
+37021,3,37015,4,0,1,
+37021,4,6,32663,18,0,1,
+37039,1,37036,1,
+37039,2,3,37038,1,
+37039,3,37036,1,0,1,
+37039,4,3,25707,2,0,1,
+37049,1,37043,1,
+37049,2,6,37046,1,
+37049,3,37043,1,0,1,
+37049,4,6,23618,15,0,1,
+37057,1,37052,1,
+37057,2,5,37048,1,
+37057,3,37052,3,0,1,
+37057,4,5,34294,2,0,1,
+37061,1,37059,1,
+37061,2,2,37060,1,
+37061,3,37059,7,0,1,
+37061,4,2,26907,3,0,1,
+37087,1,37084,1,
+37087,2,3,37086,1,
+37087,3,37084,1,0,1,
+37087,4,3,35869,5,0,1,
+37097,1,37094,1,
+37097,2,3,37091,1,
+37097,3,37094,7,0,1,
+37097,4,3,26078,11,0,1,
+37117,1,37115,1,
+37117,2,2,37116,1,
+37117,3,37115,2,0,1,
+37117,4,2,35600,6,0,1,
+37123,1,37120,1,
+37123,2,3,37118,1,
+37123,3,37120,4,0,1,
+37123,4,3,29214,3,0,1,
+37139,1,37137,1,
+37139,2,2,37135,1,
+37139,3,37137,2,0,1,
+37139,4,2,21300,7,0,1,
+37159,1,37156,1,
+37159,2,3,37157,1,
+37159,3,37156,1,0,1,
+37159,4,3,33865,3,0,1,
+37171,1,37168,1,
+37171,2,3,37170,1,
+37171,3,37168,1,0,1,
+37171,4,3,24119,2,0,1,
+37181,1,37179,1,
+37181,2,2,37166,1,
+37181,3,37179,4,0,1,
+37181,4,2,25911,3,0,1,
+37189,1,37187,1,
+37189,2,2,37188,1,
+37189,3,37187,6,0,1,
+37189,4,2,30260,7,0,1,
+37199,1,37192,1,
+37199,2,7,37187,1,
+37199,3,37192,1,0,1,
+37199,4,7,19932,18,0,1,
+37201,1,37194,1,
+37201,2,7,37194,1,
+37201,3,37194,12,0,1,
+37201,4,7,27563,0,0,1,
+37217,1,37214,1,
+37217,2,3,37211,1,
+37217,3,37214,1,0,1,
+37217,4,3,25495,1,0,1,
+37223,1,37218,1,
+37223,2,5,37222,1,
+37223,3,37218,7,0,1,
+37223,4,5,29669,4,0,1,
+37243,1,37241,1,
+37243,2,2,37242,1,
+37243,3,37241,4,0,1,
+37243,4,2,19542,7,0,1,
+37253,1,37251,1,
+37253,2,2,37249,1,
+37253,3,37251,3,0,1,
+37253,4,2,28291,7,0,1,
+37273,1,37268,1,
+37273,2,5,37272,1,
+37273,3,37268,5,0,1,
+37273,4,5,34429,6,0,1,
+37277,1,37275,1,
+37277,2,2,37269,1,
+37277,3,37275,5,0,1,
+37277,4,2,33278,5,0,1,
+37307,1,37305,1,
+37307,2,2,37301,1,
+37307,3,37305,4,0,1,
+37307,4,2,25085,4,0,1,
+37309,1,37302,1,
+37309,2,7,37307,1,
+37309,3,37302,1,0,1,
+37309,4,7,19242,4,0,1,
+37313,1,37310,1,
+37313,2,3,37301,1,
+37313,3,37310,1,0,1,
+37313,4,3,30263,0,0,1,
+37321,1,37298,1,
+37321,2,23,37320,1,
+37321,3,37298,5,0,1,
+37321,4,23,20097,18,0,1,
+37337,1,37334,1,
+37337,2,3,37331,1,
+37337,3,37334,6,0,1,
+37337,4,3,19067,1,0,1,
+37339,1,37336,1,
+37339,2,3,37332,1,
+37339,3,37336,1,0,1,
+37339,4,3,20666,5,0,1,
+37357,1,37351,1,
+37357,2,6,37356,1,
+37357,3,37351,1,0,1,
+37357,4,6,25712,6,0,1,
+37361,1,37358,1,
+37361,2,3,37355,1,
+37361,3,37358,5,0,1,
+37361,4,3,37349,0,0,1,
+37363,1,37360,1,
+37363,2,3,37362,1,
+37363,3,37360,1,0,1,
+37363,4,3,21155,2,0,1,
+37369,1,37362,1,
+37369,2,7,37366,1,
+37369,3,37362,1,0,1,
+37369,4,7,33527,14,0,1,
+37379,1,37377,1,
+37379,2,2,37378,1,
+37379,3,37377,3,0,1,
+37379,4,2,29464,4,0,1,
+37397,1,37395,1,
+37397,2,2,37396,1,
+37397,3,37395,2,0,1,
+37397,4,2,26940,4,0,1,
+37409,1,37406,1,
+37409,2,3,37404,1,
+37409,3,37406,3,0,1,
+37409,4,3,21337,2,0,1,
+37423,1,37417,1,
+37423,2,6,37420,1,
+37423,3,37417,4,0,1,
+37423,4,6,37408,18,0,1,
+37441,1,37424,1,
+37441,2,17,37430,1,
+37441,3,37424,2,0,1,
+37441,4,17,33605,0,0,1,
+37447,1,37444,1,
+37447,2,3,37445,1,
+37447,3,37444,5,0,1,
+37447,4,3,19779,6,0,1,
+37463,1,37458,1,
+37463,2,5,37461,1,
+37463,3,37458,1,0,1,
+37463,4,5,37459,3,0,1,
+37483,1,37481,1,
+37483,2,2,37482,1,
+37483,3,37481,5,0,1,
+37483,4,2,27131,2,0,1,
+37489,1,37470,1,
+37489,2,19,37474,1,
+37489,3,37470,4,0,1,
+37489,4,19,33346,52,0,1,
+37493,1,37491,1,
+37493,2,2,37486,1,
+37493,3,37491,4,0,1,
+37493,4,2,27205,2,0,1,
+37501,1,37499,1,
+37501,2,2,37497,1,
+37501,3,37499,2,0,1,
+37501,4,2,34278,10,0,1,
+37507,1,37490,1,
+37507,2,17,37505,1,
+37507,3,37490,2,0,1,
+37507,4,17,37499,3,0,1,
+37511,1,37500,1,
+37511,2,11,37508,1,
+37511,3,37500,4,0,1,
+37511,4,11,31881,6,0,1,
+37517,1,37515,1,
+37517,2,2,37513,1,
+37517,3,37515,3,0,1,
+37517,4,2,18975,7,0,1,
+37529,1,37526,1,
+37529,2,3,37519,1,
+37529,3,37526,3,0,1,
+37529,4,3,26883,13,0,1,
+37537,1,37524,1,
+37537,2,13,37528,1,
+37537,3,37524,1,0,1,
+37537,4,13,30190,2,0,1,
+37547,1,37545,1,
+37547,2,2,37546,1,
+37547,3,37545,3,0,1,
+37547,4,2,32251,2,0,1,
+37549,1,37547,1,
+37549,2,2,37545,1,
+37549,3,37547,2,0,1,
+37549,4,2,18991,12,0,1,
+37561,1,37550,1,
+37561,2,11,37560,1,
+37561,3,37550,3,0,1,
+37561,4,11,19631,8,0,1,
+37567,1,37564,1,
+37567,2,3,37566,1,
+37567,3,37564,3,0,1,
+37567,4,3,24636,5,0,1,
+37571,1,37569,1,
+37571,2,2,37560,1,
+37571,3,37569,2,0,1,
+37571,4,2,32823,3,0,1,
+37573,1,37568,1,
+37573,2,5,37572,1,
+37573,3,37568,10,0,1,
+37573,4,5,19136,3,0,1,
+37579,1,37577,1,
+37579,2,2,37578,1,
+37579,3,37577,6,0,1,
+37579,4,2,19454,2,0,1,
+37589,1,37587,1,
+37589,2,2,37588,1,
+37589,3,37587,9,0,1,
+37589,4,2,34854,3,0,1,
+37591,1,37585,1,
+37591,2,6,37589,1,
+37591,3,37585,2,0,1,
+37591,4,6,33174,10,0,1,
+37607,1,37602,1,
+37607,2,5,37605,1,
+37607,3,37602,1,0,1,
+37607,4,5,29548,14,0,1,
+37619,1,37617,1,
+37619,2,2,37615,1,
+37619,3,37617,2,0,1,
+37619,4,2,34006,7,0,1,
+37633,1,37628,1,
+37633,2,5,37632,1,
+37633,3,37628,1,0,1,
+37633,4,5,36406,12,0,1,
+37643,1,37641,1,
+37643,2,2,37639,1,
+37643,3,37641,3,0,1,
+37643,4,2,26690,8,0,1,
+37649,1,37646,1,
+37649,2,3,37648,1,
+37649,3,37646,4,0,1,
+37649,4,3,31939,7,0,1,
+37657,1,37652,1,
+37657,2,5,37656,1,
+37657,3,37652,2,0,1,
+37657,4,5,28634,6,0,1,
+37663,1,37660,1,
+37663,2,3,37662,1,
+37663,3,37660,6,0,1,
+37663,4,3,22013,2,0,1,
+37691,1,37685,1,
+37691,2,6,37689,1,
+37691,3,37685,2,0,1,
+37691,4,6,24698,5,0,1,
+37693,1,37691,1,
+37693,2,2,37692,1,
+37693,3,37691,2,0,1,
+37693,4,2,22114,3,0,1,
+37699,1,37696,1,
+37699,2,3,37687,1,
+37699,3,37696,3,0,1,
+37699,4,3,34574,0,0,1,
+37717,1,37712,1,
+37717,2,5,37716,1,
+37717,3,37712,1,0,1,
+37717,4,5,32095,3,0,1,
+37747,1,37744,1,
+37747,2,3,37746,1,
+37747,3,37744,1,0,1,
+37747,4,3,25645,5,0,1,
+37781,1,37779,1,
+37781,2,2,37776,1,
+37781,3,37779,2,0,1,
+37781,4,2,25477,8,0,1,
+37783,1,37780,1,
+37783,2,3,37781,1,
+37783,3,37780,4,0,1,
+37783,4,3,37775,10,0,1,
+37799,1,37788,1,
+37799,2,11,37798,1,
+37799,3,37788,5,0,1,
+37799,4,11,19068,2,0,1,
+37811,1,37805,1,
+37811,2,6,37810,1,
+37811,3,37805,2,0,1,
+37811,4,6,35535,4,0,1,
+37813,1,37811,1,
+37813,2,2,37809,1,
+37813,3,37811,5,0,1,
+37813,4,2,19352,10,0,1,
+37831,1,37828,1,
+37831,2,3,37830,1,
+37831,3,37828,3,0,1,
+37831,4,3,31814,3,0,1,
+37847,1,37842,1,
+37847,2,5,37846,1,
+37847,3,37842,1,0,1,
+37847,4,5,23220,3,0,1,
+37853,1,37851,1,
+37853,2,2,37848,1,
+37853,3,37851,4,0,1,
+37853,4,2,22552,17,0,1,
+37861,1,37859,1,
+37861,2,2,37860,1,
+37861,3,37859,6,0,1,
+37861,4,2,22027,3,0,1,
+37871,1,37864,1,
+37871,2,7,37864,1,
+37871,3,37864,5,0,1,
+37871,4,7,33945,8,0,1,
+37879,1,37872,1,
+37879,2,7,37876,1,
+37879,3,37872,3,0,1,
+37879,4,7,28903,0,0,1,
+37889,1,37886,1,
+37889,2,3,37881,1,
+37889,3,37886,3,0,1,
+37889,4,3,25113,1,0,1,
+37897,1,37892,1,
+37897,2,5,37894,1,
+37897,3,37892,1,0,1,
+37897,4,5,37195,16,0,1,
+37907,1,37905,1,
+37907,2,2,37903,1,
+37907,3,37905,8,0,1,
+37907,4,2,33823,7,0,1,
+37951,1,37948,1,
+37951,2,3,37949,1,
+37951,3,37948,3,0,1,
+37951,4,3,29265,3,0,1,
+37957,1,37955,1,
+37957,2,2,37956,1,
+37957,3,37955,5,0,1,
+37957,4,2,30796,3,0,1,
+37963,1,37961,1,
+37963,2,2,37959,1,
+37963,3,37961,6,0,1,
+37963,4,2,21601,8,0,1,
+37967,1,37962,1,
+37967,2,5,37964,1,
+37967,3,37962,1,0,1,
+37967,4,5,35382,6,0,1,
+37987,1,37982,1,
+37987,2,5,37985,1,
+37987,3,37982,1,0,1,
+37987,4,5,34893,9,0,1,
+37991,1,37984,1,
+37991,2,7,37990,1,
+37991,3,37984,4,0,1,
+37991,4,7,28727,2,0,1,
+37993,1,37983,1,
+37993,2,10,37992,1,
+37993,3,37983,5,0,1,
+37993,4,10,35024,16,0,1,
+37997,1,37995,1,
+37997,2,2,37993,1,
+37997,3,37995,3,0,1,
+37997,4,2,29297,7,0,1,
+38011,1,38009,1,
+38011,2,2,38007,1,
+38011,3,38009,2,0,1,
+38011,4,2,19512,8,0,1,
+38039,1,38032,1,
+38039,2,7,38037,1,
+38039,3,38032,2,0,1,
+38039,4,7,33167,4,0,1,
+38047,1,38044,1,
+38047,2,3,38045,1,
+38047,3,38044,1,0,1,
+38047,4,3,38039,10,0,1,
+38053,1,38048,1,
+38053,2,5,38052,1,
+38053,3,38048,2,0,1,
+38053,4,5,33474,3,0,1,
+38069,1,38067,1,
+38069,2,2,38064,1,
+38069,3,38067,4,0,1,
+38069,4,2,21442,2,0,1,
+38083,1,38080,1,
+38083,2,3,38078,1,
+38083,3,38080,4,0,1,
+38083,4,3,19791,3,0,1,
+38113,1,38106,1,
+38113,2,7,38110,1,
+38113,3,38106,2,0,1,
+38113,4,7,30887,17,0,1,
+38119,1,38116,1,
+38119,2,3,38117,1,
+38119,3,38116,1,0,1,
+38119,4,3,38115,4,0,1,
+38149,1,38143,1,
+38149,2,6,38148,1,
+38149,3,38143,4,0,1,
+38149,4,6,28909,7,0,1,
+38153,1,38150,1,
+38153,2,3,38148,1,
+38153,3,38150,3,0,1,
+38153,4,3,25251,0,0,1,
+38167,1,38164,1,
+38167,2,3,38166,1,
+38167,3,38164,3,0,1,
+38167,4,3,32206,5,0,1,
+38177,1,38174,1,
+38177,2,3,38176,1,
+38177,3,38174,5,0,1,
+38177,4,3,35652,7,0,1,
+38183,1,38178,1,
+38183,2,5,38180,1,
+38183,3,38178,3,0,1,
+38183,4,5,31711,6,0,1,
+38189,1,38187,1,
+38189,2,2,38185,1,
+38189,3,38187,3,0,1,
+38189,4,2,27557,6,0,1,
+38197,1,38195,1,
+38197,2,2,38196,1,
+38197,3,38195,8,0,1,
+38197,4,2,26216,6,0,1,
+38201,1,38198,1,
+38201,2,3,38196,1,
+38201,3,38198,3,0,1,
+38201,4,3,35721,2,0,1,
+38219,1,38217,1,
+38219,2,2,38215,1,
+38219,3,38217,3,0,1,
+38219,4,2,26073,7,0,1,
+38231,1,38218,1,
+38231,2,13,38230,1,
+38231,3,38218,3,0,1,
+38231,4,13,32649,10,0,1,
+38237,1,38235,1,
+38237,2,2,38233,1,
+38237,3,38235,2,0,1,
+38237,4,2,25637,7,0,1,
+38239,1,38226,1,
+38239,2,13,38238,1,
+38239,3,38226,3,0,1,
+38239,4,13,19289,2,0,1,
+38261,1,38259,1,
+38261,2,2,38260,1,
+38261,3,38259,3,0,1,
+38261,4,2,36648,4,0,1,
+38273,1,38270,1,
+38273,2,3,38267,1,
+38273,3,38270,12,0,1,
+38273,4,3,21659,1,0,1,
+38281,1,38267,1,
+38281,2,14,38278,1,
+38281,3,38267,1,0,1,
+38281,4,14,24768,20,0,1,
+38287,1,38280,1,
+38287,2,7,38284,1,
+38287,3,38280,2,0,1,
+38287,4,7,19895,4,0,1,
+38299,1,38297,1,
+38299,2,2,38293,1,
+38299,3,38297,2,0,1,
+38299,4,2,36650,7,0,1,
+38303,1,38298,1,
+38303,2,5,38301,1,
+38303,3,38298,10,0,1,
+38303,4,5,26437,10,0,1,
+38317,1,38315,1,
+38317,2,2,38316,1,
+38317,3,38315,2,0,1,
+38317,4,2,31189,7,0,1,
+38321,1,38318,1,
+38321,2,3,38320,1,
+38321,3,38318,1,0,1,
+38321,4,3,36923,4,0,1,
+38327,1,38322,1,
+38327,2,5,38325,1,
+38327,3,38322,1,0,1,
+38327,4,5,30440,5,0,1,
+38329,1,38316,1,
+38329,2,13,38328,1,
+38329,3,38316,1,0,1,
+38329,4,13,25055,14,0,1,
+38333,1,38331,1,
+38333,2,2,38325,1,
+38333,3,38331,4,0,1,
+38333,4,2,30289,11,0,1,
+38351,1,38340,1,
+38351,2,11,38349,1,
+38351,3,38340,1,0,1,
+38351,4,11,37128,3,0,1,
+38371,1,38361,1,
+38371,2,10,38370,1,
+38371,3,38361,3,0,1,
+38371,4,10,24488,5,0,1,
+38377,1,38372,1,
+38377,2,5,38372,1,
+38377,3,38372,2,0,1,
+38377,4,5,38100,10,0,1,
+38393,1,38390,1,
+38393,2,3,38387,1,
+38393,3,38390,6,0,1,
+38393,4,3,20238,1,0,1,
+38431,1,38425,1,
+38431,2,6,38430,1,
+38431,3,38425,2,0,1,
+38431,4,6,36645,2,0,1,
+38447,1,38442,1,
+38447,2,5,38446,1,
+38447,3,38442,5,0,1,
+38447,4,5,23340,4,0,1,
+38449,1,38436,1,
+38449,2,13,38448,1,
+38449,3,38436,3,0,1,
+38449,4,13,29532,8,0,1,
+38453,1,38451,1,
+38453,2,2,38449,1,
+38453,3,38451,4,0,1,
+38453,4,2,30005,12,0,1,
+38459,1,38457,1,
+38459,2,2,38455,1,
+38459,3,38457,2,0,1,
+38459,4,2,37440,8,0,1,
+38461,1,38448,1,
+38461,2,13,38460,1,
+38461,3,38448,1,0,1,
+38461,4,13,33488,7,0,1,
+38501,1,38499,1,
+38501,2,2,38493,1,
+38501,3,38499,2,0,1,
+38501,4,2,20275,0,0,1,
+38543,1,38538,1,
+38543,2,5,38541,1,
+38543,3,38538,6,0,1,
+38543,4,5,38539,3,0,1,
+38557,1,38555,1,
+38557,2,2,38553,1,
+38557,3,38555,4,0,1,
+38557,4,2,22303,10,0,1,
+38561,1,38558,1,
+38561,2,3,38555,1,
+38561,3,38558,7,0,1,
+38561,4,3,38549,0,0,1,
+38567,1,38562,1,
+38567,2,5,38562,1,
+38567,3,38562,6,0,1,
+38567,4,5,34251,6,0,1,
+38569,1,38555,1,
+38569,2,14,38567,1,
+38569,3,38555,1,0,1,
+38569,4,14,38543,15,0,1,
+38593,1,38588,1,
+38593,2,5,38588,1,
+38593,3,38588,3,0,1,
+38593,4,5,22172,15,0,1,
+38603,1,38601,1,
+38603,2,2,38602,1,
+38603,3,38601,2,0,1,
+38603,4,2,23298,4,0,1,
+38609,1,38606,1,
+38609,2,3,38608,1,
+38609,3,38606,6,0,1,
+38609,4,3,38331,7,0,1,
+38611,1,38608,1,
+38611,2,3,38604,1,
+38611,3,38608,3,0,1,
+38611,4,3,29249,5,0,1,
+38629,1,38627,1,
+38629,2,2,38628,1,
+38629,3,38627,4,0,1,
+38629,4,2,32309,3,0,1,
+38639,1,38610,1,
+38639,2,29,38638,1,
+38639,3,38610,5,0,1,
+38639,4,29,29599,2,0,1,
+38651,1,38649,1,
+38651,2,2,38645,1,
+38651,3,38649,9,0,1,
+38651,4,2,36685,4,0,1,
+38653,1,38651,1,
+38653,2,2,38652,1,
+38653,3,38651,2,0,1,
+38653,4,2,36591,3,0,1,
+38669,1,38667,1,
+38669,2,2,38664,1,
+38669,3,38667,2,0,1,
+38669,4,2,33671,15,0,1,
+38671,1,38665,1,
+38671,2,6,38669,1,
+38671,3,38665,2,0,1,
+38671,4,6,21972,3,0,1,
+38677,1,38672,1,
+38677,2,5,38676,1,
+38677,3,38672,3,0,1,
+38677,4,5,37582,3,0,1,
+38693,1,38691,1,
+38693,2,2,38683,1,
+38693,3,38691,7,0,1,
+38693,4,2,32166,2,0,1,
+38699,1,38697,1,
+38699,2,2,38698,1,
+38699,3,38697,3,0,1,
+38699,4,2,33472,6,0,1,
+38707,1,38705,1,
+38707,2,2,38703,1,
+38707,3,38705,6,0,1,
+38707,4,2,37302,8,0,1,
+38711,1,38704,1,
+38711,2,7,38708,1,
+38711,3,38704,1,0,1,
+38711,4,7,34674,5,0,1,
+38713,1,38708,1,
+38713,2,5,38712,1,
+38713,3,38708,5,0,1,
+38713,4,5,23934,6,0,1,
+38723,1,38721,1,
+38723,2,2,38719,1,
+38723,3,38721,3,0,1,
+38723,4,2,37759,11,0,1,
+38729,1,38726,1,
+38729,2,3,38724,1,
+38729,3,38726,3,0,1,
+38729,4,3,29906,2,0,1,
+38737,1,38732,1,
+38737,2,5,38736,1,
+38737,3,38732,3,0,1,
+38737,4,5,23632,6,0,1,
+38747,1,38745,1,
+38747,2,2,38736,1,
+38747,3,38745,10,0,1,
+38747,4,2,20734,4,0,1,
+38749,1,38747,1,
+38749,2,2,38745,1,
+38749,3,38747,2,0,1,
+38749,4,2,24273,6,0,1,
+38767,1,38762,1,
+38767,2,5,38765,1,
+38767,3,38762,1,0,1,
+38767,4,5,24075,15,0,1,
+38783,1,38778,1,
+38783,2,5,38780,1,
+38783,3,38778,1,0,1,
+38783,4,5,23214,4,0,1,
+38791,1,38785,1,
+38791,2,6,38789,1,
+38791,3,38785,10,0,1,
+38791,4,6,30215,4,0,1,
+38803,1,38798,1,
+38803,2,5,38801,1,
+38803,3,38798,1,0,1,
+38803,4,5,38795,6,0,1,
+38821,1,38819,1,
+38821,2,2,38817,1,
+38821,3,38819,7,0,1,
+38821,4,2,30471,6,0,1,
+38833,1,38828,1,
+38833,2,5,38828,1,
+38833,3,38828,2,0,1,
+38833,4,5,37701,18,0,1,
+38839,1,38833,1,
+38839,2,6,38838,1,
+38839,3,38833,1,0,1,
+38839,4,6,24569,2,0,1,
+38851,1,38848,1,
+38851,2,3,38850,1,
+38851,3,38848,1,0,1,
+38851,4,3,23661,2,0,1,
+38861,1,38847,1,
+38861,2,14,38838,1,
+38861,3,38847,2,0,1,
+38861,4,14,23356,0,0,1,
+38867,1,38865,1,
+38867,2,2,38866,1,
+38867,3,38865,2,0,1,
+38867,4,2,27407,2,0,1,
+38873,1,38870,1,
+38873,2,3,38872,1,
+38873,3,38870,10,0,1,
+38873,4,3,33001,4,0,1,
+38891,1,38889,1,
+38891,2,2,38890,1,
+38891,3,38889,4,0,1,
+38891,4,2,26445,10,0,1,
+38903,1,38898,1,
+38903,2,5,38902,1,
+38903,3,38898,1,0,1,
+38903,4,5,26815,5,0,1,
+38917,1,38912,1,
+38917,2,5,38914,1,
+38917,3,38912,8,0,1,
+38917,4,5,24190,11,0,1,
+38921,1,38915,1,
+38921,2,6,38920,1,
+38921,3,38915,2,0,1,
+38921,4,6,25186,7,0,1,
+38923,1,38921,1,
+38923,2,2,38922,1,
+38923,3,38921,6,0,1,
+38923,4,2,38916,8,0,1,
+38933,1,38931,1,
+38933,2,2,38932,1,
+38933,3,38931,3,0,1,
+38933,4,2,33245,4,0,1,
+38953,1,38948,1,
+38953,2,5,38952,1,
+38953,3,38948,1,0,1,
+38953,4,5,35439,6,0,1,
+38959,1,38956,1,
+38959,2,3,38954,1,
+38959,3,38956,6,0,1,
+38959,4,3,30864,6,0,1,
+38971,1,38969,1,
+38971,2,2,38967,1,
+38971,3,38969,6,0,1,
+38971,4,2,21563,8,0,1,
+38977,1,38972,1,
+38977,2,5,38976,1,
+38977,3,38972,2,0,1,
+38977,4,5,26193,6,0,1,
+38993,1,38990,1,
+38993,2,3,38987,1,
+38993,3,38990,3,0,1,
+38993,4,3,35395,9,0,1,
+39019,1,39017,1,
+39019,2,2,39013,1,
+39019,3,39017,2,0,1,
+39019,4,2,33763,3,0,1,
+39023,1,39018,1,
+39023,2,5,39021,1,
+39023,3,39018,1,0,1,
+39023,4,5,24508,5,0,1,
+39041,1,39038,1,
+39041,2,3,39040,1,
+39041,3,39038,1,0,1,
+39041,4,3,26546,7,0,1,
+39043,1,39041,1,
+39043,2,2,39039,1,
+39043,3,39041,4,0,1,
+39043,4,2,22536,10,0,1,
+39047,1,39042,1,
+39047,2,5,39046,1,
+39047,3,39042,5,0,1,
+39047,4,5,33621,3,0,1,
+39079,1,39076,1,
+39079,2,3,39077,1,
+39079,3,39076,3,0,1,
+39079,4,3,28472,3,0,1,
+39089,1,39086,1,
+39089,2,3,39083,1,
+39089,3,39086,4,0,1,
+39089,4,3,39077,0,0,1,
+39097,1,39092,1,
+39097,2,5,39096,1,
+39097,3,39092,1,0,1,
+39097,4,5,30051,6,0,1,
+39103,1,39098,1,
+39103,2,5,39101,1,
+39103,3,39098,2,0,1,
+39103,4,5,36150,17,0,1,
+39107,1,39105,1,
+39107,2,2,39106,1,
+39107,3,39105,3,0,1,
+39107,4,2,20557,2,0,1,
+39113,1,39110,1,
+39113,2,3,39112,1,
+39113,3,39110,1,0,1,
+39113,4,3,30930,4,0,1,
+39119,1,39108,1,
+39119,2,11,39118,1,
+39119,3,39108,1,0,1,
+39119,4,11,25086,2,0,1,
+39133,1,39128,1,
+39133,2,5,39132,1,
+39133,3,39128,1,0,1,
+39133,4,5,24278,3,0,1,
+39139,1,39132,1,
+39139,2,7,39137,1,
+39139,3,39132,10,0,1,
+39139,4,7,34512,6,0,1,
+39157,1,39151,1,
+39157,2,6,39156,1,
+39157,3,39151,1,0,1,
+39157,4,6,25232,8,0,1,
+39161,1,39158,1,
+39161,2,3,39156,1,
+39161,3,39158,1,0,1,
+39161,4,3,35010,8,0,1,
+39163,1,39161,1,
+39163,2,2,39162,1,
+39163,3,39161,2,0,1,
+39163,4,2,39156,8,0,1,
+39181,1,39175,1,
+39181,2,6,39177,1,
+39181,3,39175,2,0,1,
+39181,4,6,39177,6,0,1,
+39191,1,39180,1,
+39191,2,11,39190,1,
+39191,3,39180,1,0,1,
+39191,4,11,35745,2,0,1,
+39199,1,39182,1,
+39199,2,17,39195,1,
+39199,3,39182,7,0,1,
+39199,4,17,36081,15,0,1,
+39209,1,39206,1,
+39209,2,3,39203,1,
+39209,3,39206,4,0,1,
+39209,4,3,39197,0,0,1,
+39217,1,39210,1,
+39217,2,7,39210,1,
+39217,3,39210,4,0,1,
+39217,4,7,26512,14,0,1,
+39227,1,39225,1,
+39227,2,2,39226,1,
+39227,3,39225,2,0,1,
+39227,4,2,39220,8,0,1,
+39229,1,39227,1,
+39229,2,2,39225,1,
+39229,3,39227,5,0,1,
+39229,4,2,23379,6,0,1,
+39233,1,39230,1,
+39233,2,3,39232,1,
+39233,3,39230,1,0,1,
+39233,4,3,29629,4,0,1,
+39239,1,39232,1,
+39239,2,7,39238,1,
+39239,3,39232,1,0,1,
+39239,4,7,36389,2,0,1,
+39241,1,39234,1,
+39241,2,7,39234,1,
+39241,3,39234,2,0,1,
+39241,4,7,31295,0,0,1,
+39251,1,39249,1,
+39251,2,2,39247,1,
+39251,3,39249,3,0,1,
+39251,4,2,22058,8,0,1,
+39293,1,39291,1,
+39293,2,2,39289,1,
+39293,3,39291,3,0,1,
+39293,4,2,33034,9,0,1,
+39301,1,39294,1,
+39301,2,7,39299,1,
+39301,3,39294,1,0,1,
+39301,4,7,38586,15,0,1,
+39313,1,39303,1,
+39313,2,10,39308,1,
+39313,3,39303,3,0,1,
+39313,4,10,32642,0,0,1,
+39317,1,39315,1,
+39317,2,2,39316,1,
+39317,3,39315,2,0,1,
+39317,4,2,36258,6,0,1,
+39323,1,39321,1,
+39323,2,2,39319,1,
+39323,3,39321,5,0,1,
+39323,4,2,22160,7,0,1,
+39341,1,39339,1,
+39341,2,2,39337,1,
+39341,3,39339,2,0,1,
+39341,4,2,31163,6,0,1,
+39343,1,39340,1,
+39343,2,3,39342,1,
+39343,3,39340,13,0,1,
+39343,4,3,23892,8,0,1,
+39359,1,39348,1,
+39359,2,11,39356,1,
+39359,3,39348,2,0,1,
+39359,4,11,27324,6,0,1,
+39367,1,39364,1,
+39367,2,3,39365,1,
+39367,3,39364,9,0,1,
+39367,4,3,30496,3,0,1,
+39371,1,39369,1,
+39371,2,2,39370,1,
+39371,3,39369,4,0,1,
+39371,4,2,35643,4,0,1,
+39373,1,39351,1,
+39373,2,22,39371,1,
+39373,3,39351,3,0,1,
+39373,4,22,38401,0,0,1,
+39383,1,39378,1,
+39383,2,5,39382,1,
+39383,3,39378,1,0,1,
+39383,4,5,38278,9,0,1,
+39397,1,39395,1,
+39397,2,2,39393,1,
+39397,3,39395,5,0,1,
+39397,4,2,36507,12,0,1,
+39409,1,39402,1,
+39409,2,7,39406,1,
+39409,3,39402,1,0,1,
+39409,4,7,32961,14,0,1,
+39419,1,39417,1,
+39419,2,2,39415,1,
+39419,3,39417,3,0,1,
+39419,4,2,21067,8,0,1,
+39439,1,39436,1,
+39439,2,3,39429,1,
+39439,3,39436,3,0,1,
+39439,4,3,23903,3,0,1,
+39443,1,39441,1,
+39443,2,2,39442,1,
+39443,3,39441,2,0,1,
+39443,4,2,30777,13,0,1,
+39451,1,39449,1,
+39451,2,2,39450,1,
+39451,3,39449,6,0,1,
+39451,4,2,37321,6,0,1,
+39461,1,39459,1,
+39461,2,2,39457,1,
+39461,3,39459,2,0,1,
+39461,4,2,20975,12,0,1,
+39499,1,39497,1,
+39499,2,2,39498,1,
+39499,3,39497,6,0,1,
+39499,4,2,23602,2,0,1,
+39503,1,39498,1,
+39503,2,5,39502,1,
+39503,3,39498,1,0,1,
+39503,4,5,30046,4,0,1,
+39509,1,39506,1,
+39509,2,3,39507,1,
+39509,3,39506,1,0,1,
+39509,4,3,39501,10,0,1,
+39511,1,39508,1,
+39511,2,3,39510,1,
+39511,3,39508,5,0,1,
+39511,4,3,26516,2,0,1,
+39521,1,39518,1,
+39521,2,3,39515,1,
+39521,3,39518,1,0,1,
+39521,4,3,39509,0,0,1,
+39541,1,39539,1,
+39541,2,2,39540,1,
+39541,3,39539,4,0,1,
+39541,4,2,20129,3,0,1,
+39551,1,39544,1,
+39551,2,7,39548,1,
+39551,3,39544,5,0,1,
+39551,4,7,26926,8,0,1,
+39563,1,39561,1,
+39563,2,2,39562,1,
+39563,3,39561,3,0,1,
+39563,4,2,25866,10,0,1,
+39569,1,39566,1,
+39569,2,3,39559,1,
+39569,3,39566,1,0,1,
+39569,4,3,21015,3,0,1,
+39581,1,39579,1,
+39581,2,2,39580,1,
+39581,3,39579,3,0,1,
+39581,4,2,39574,8,0,1,
+39607,1,39604,1,
+39607,2,3,39606,1,
+39607,3,39604,3,0,1,
+39607,4,3,21811,5,0,1,
+39619,1,39617,1,
+39619,2,2,39618,1,
+39619,3,39617,6,0,1,
+39619,4,2,19982,7,0,1,
+39623,1,39618,1,
+39623,2,5,39622,1,
+39623,3,39618,5,0,1,
+39623,4,5,21113,2,0,1,
+39631,1,39628,1,
+39631,2,3,39629,1,
+39631,3,39628,6,0,1,
+39631,4,3,29962,6,0,1,
+39659,1,39657,1,
+39659,2,2,39655,1,
+39659,3,39657,3,0,1,
+39659,4,2,30533,7,0,1,
+39667,1,39664,1,
+39667,2,3,39658,1,
+39667,3,39664,5,0,1,
+39667,4,3,34504,4,0,1,
+39671,1,39664,1,
+39671,2,7,39670,1,
+39671,3,39664,5,0,1,
+39671,4,7,20353,2,0,1,
+39679,1,39673,1,
+39679,2,6,39677,1,
+39679,3,39673,2,0,1,
+39679,4,6,29071,3,0,1,
+39703,1,39698,1,
+39703,2,5,39702,1,
+39703,3,39698,1,0,1,
+39703,4,5,20563,2,0,1,
+39709,1,39703,1,
+39709,2,6,39708,1,
+39709,3,39703,2,0,1,
+39709,4,6,38547,7,0,1,
+39719,1,39712,1,
+39719,2,7,39717,1,
+39719,3,39712,1,0,1,
+39719,4,7,38397,4,0,1,
+39727,1,39724,1,
+39727,2,3,39726,1,
+39727,3,39724,3,0,1,
+39727,4,3,35383,2,0,1,
+39733,1,39731,1,
+39733,2,2,39729,1,
+39733,3,39731,6,0,1,
+39733,4,2,29299,12,0,1,
+39749,1,39747,1,
+39749,2,2,39748,1,
+39749,3,39747,3,0,1,
+39749,4,2,29632,3,0,1,
+39761,1,39758,1,
+39761,2,3,39756,1,
+39761,3,39758,8,0,1,
+39761,4,3,20842,2,0,1,
+39769,1,39756,1,
+39769,2,13,39768,1,
+39769,3,39756,3,0,1,
+39769,4,13,31398,14,0,1,
+39779,1,39777,1,
+39779,2,2,39775,1,
+39779,3,39777,3,0,1,
+39779,4,2,26299,13,0,1,
+39791,1,39780,1,
+39791,2,11,39789,1,
+39791,3,39780,6,0,1,
+39791,4,11,20451,7,0,1,
+39799,1,39796,1,
+39799,2,3,39797,1,
+39799,3,39796,1,0,1,
+39799,4,3,20740,3,0,1,
+39821,1,39819,1,
+39821,2,2,39815,1,
+39821,3,39819,4,0,1,
+39821,4,2,23010,3,0,1,
+39827,1,39825,1,
+39827,2,2,39823,1,
+39827,3,39825,3,0,1,
+39827,4,2,27913,8,0,1,
+39829,1,39823,1,
+39829,2,6,39825,1,
+39829,3,39823,1,0,1,
+39829,4,6,35544,11,0,1,
+39839,1,39832,1,
+39839,2,7,39838,1,
+39839,3,39832,1,0,1,
+39839,4,7,34688,2,0,1,
+39841,1,39810,1,
+39841,2,31,39840,1,
+39841,3,39810,8,0,1,
+39841,4,31,37627,12,0,1,
+39847,1,39842,1,
+39847,2,5,39845,1,
+39847,3,39842,1,0,1,
+39847,4,5,36920,16,0,1,
+39857,1,39854,1,
+39857,2,3,39850,1,
+39857,3,39854,5,0,1,
+39857,4,3,32268,19,0,1,
+39863,1,39858,1,
+39863,2,5,39861,1,
+39863,3,39858,2,0,1,
+39863,4,5,32102,10,0,1,
+39869,1,39867,1,
+39869,2,2,39861,1,
+39869,3,39867,2,0,1,
+39869,4,2,35127,0,0,1,
+39877,1,39875,1,
+39877,2,2,39876,1,
+39877,3,39875,2,0,1,
+39877,4,2,27572,9,0,1,
+39883,1,39880,1,
+39883,2,3,39882,1,
+39883,3,39880,3,0,1,
+39883,4,3,27660,2,0,1,
+39887,1,39880,1,
+39887,2,7,39885,1,
+39887,3,39880,3,0,1,
+39887,4,7,28653,14,0,1,
+39901,1,39899,1,
+39901,2,2,39897,1,
+39901,3,39899,4,0,1,
+39901,4,2,32944,12,0,1,
+39929,1,39926,1,
+39929,2,3,39921,1,
+39929,3,39926,3,0,1,
+39929,4,3,23450,2,0,1,
+39937,1,39932,1,
+39937,2,5,39934,1,
+39937,3,39932,1,0,1,
+39937,4,5,20329,18,0,1,
+39953,1,39950,1,
+39953,2,3,39944,1,
+39953,3,39950,4,0,1,
+39953,4,3,21336,3,0,1,
+39971,1,39969,1,
+39971,2,2,39967,1,
+39971,3,39969,2,0,1,
+39971,4,2,38660,8,0,1,
+39979,1,39976,1,
+39979,2,3,39970,1,
+39979,3,39976,3,0,1,
+39979,4,3,28841,6,0,1,
+39983,1,39978,1,
+39983,2,5,39981,1,
+39983,3,39978,6,0,1,
+39983,4,5,39971,11,0,1,
+39989,1,39987,1,
+39989,2,2,39985,1,
+39989,3,39987,3,0,1,
+39989,4,2,36619,1,0,1,
+40009,1,39998,1,
+40009,2,11,40008,1,
+40009,3,39998,3,0,1,
+40009,4,11,30730,12,0,1,
+40013,1,40011,1,
+40013,2,2,40009,1,
+40013,3,40011,3,0,1,
+40013,4,2,29898,6,0,1,
+40031,1,40012,1,
+40031,2,19,40030,1,
+40031,3,40012,5,0,1,
+40031,4,19,40001,13,0,1,
+40037,1,40035,1,
+40037,2,2,40029,1,
+40037,3,40035,12,0,1,
+40037,4,2,35214,11,0,1,
+40039,1,40033,1,
+40039,2,6,40038,1,
+40039,3,40033,1,0,1,
+40039,4,6,38943,3,0,1,
+40063,1,40060,1,
+40063,2,3,40061,1,
+40063,3,40060,1,0,1,
+40063,4,3,40059,4,0,1,
+40087,1,40084,1,
+40087,2,3,40085,1,
+40087,3,40084,4,0,1,
+40087,4,3,21667,6,0,1,
+40093,1,40091,1,
+40093,2,2,40089,1,
+40093,3,40091,5,0,1,
+40093,4,2,30961,6,0,1,
+40099,1,40096,1,
+40099,2,3,40094,1,
+40099,3,40096,6,0,1,
+40099,4,3,23464,3,0,1,
+40111,1,40108,1,
+40111,2,3,40109,1,
+40111,3,40108,1,0,1,
+40111,4,3,29259,3,0,1,
+40123,1,40121,1,
+40123,2,2,40122,1,
+40123,3,40121,2,0,1,
+40123,4,2,34321,2,0,1,
+40127,1,40122,1,
+40127,2,5,40124,1,
+40127,3,40122,7,0,1,
+40127,4,5,25313,6,0,1,
+40129,1,40122,1,
+40129,2,7,40122,1,
+40129,3,40122,1,0,1,
+40129,4,7,37548,0,0,1,
+40151,1,40140,1,
+40151,2,11,40149,1,
+40151,3,40140,4,0,1,
+40151,4,11,24171,3,0,1,
+40153,1,40148,1,
+40153,2,5,40148,1,
+40153,3,40148,2,0,1,
+40153,4,5,34765,20,0,1,
+40163,1,40161,1,
+40163,2,2,40157,1,
+40163,3,40161,7,0,1,
+40163,4,2,38283,4,0,1,
+40169,1,40166,1,
+40169,2,3,40159,1,
+40169,3,40166,4,0,1,
+40169,4,3,29838,4,0,1,
+40177,1,40167,1,
+40177,2,10,40176,1,
+40177,3,40167,5,0,1,
+40177,4,10,23176,18,0,1,
+40189,1,40187,1,
+40189,2,2,40185,1,
+40189,3,40187,6,0,1,
+40189,4,2,33230,12,0,1,
+40193,1,40190,1,
+40193,2,3,40192,1,
+40193,3,40190,5,0,1,
+40193,4,3,25310,7,0,1,
+40213,1,40207,1,
+40213,2,6,40211,1,
+40213,3,40207,3,0,1,
+40213,4,6,39490,0,0,1,
+40231,1,40228,1,
+40231,2,3,40229,1,
+40231,3,40228,3,0,1,
+40231,4,3,38577,3,0,1,
+40237,1,40231,1,
+40237,2,6,40236,1,
+40237,3,40231,3,0,1,
+40237,4,6,21847,6,0,1,
+40241,1,40238,1,
+40241,2,3,40236,1,
+40241,3,40238,3,0,1,
+40241,4,3,37334,2,0,1,
+40253,1,40251,1,
+40253,2,2,40249,1,
+40253,3,40251,2,0,1,
+40253,4,2,33918,6,0,1,
+40277,1,40275,1,
+40277,2,2,40276,1,
+40277,3,40275,3,0,1,
+40277,4,2,36883,3,0,1,
+40283,1,40281,1,
+40283,2,2,40282,1,
+40283,3,40281,3,0,1,
+40283,4,2,40276,8,0,1,
+40289,1,40286,1,
+40289,2,3,40283,1,
+40289,3,40286,3,0,1,
+40289,4,3,40277,0,0,1,
+40343,1,40338,1,
+40343,2,5,40341,1,
+40343,3,40338,1,0,1,
+40343,4,5,40331,11,0,1,
+40351,1,40348,1,
+40351,2,3,40349,1,
+40351,3,40348,4,0,1,
+40351,4,3,24291,3,0,1,
+40357,1,40352,1,
+40357,2,5,40352,1,
+40357,3,40352,2,0,1,
+40357,4,5,28961,7,0,1,
+40361,1,40358,1,
+40361,2,3,40345,1,
+40361,3,40358,1,0,1,
+40361,4,3,27273,1,0,1,
+40387,1,40385,1,
+40387,2,2,40383,1,
+40387,3,40385,6,0,1,
+40387,4,2,25780,13,0,1,
+40423,1,40420,1,
+40423,2,3,40421,1,
+40423,3,40420,1,0,1,
+40423,4,3,32670,3,0,1,
+40427,1,40425,1,
+40427,2,2,40423,1,
+40427,3,40425,4,0,1,
+40427,4,2,25846,8,0,1,
+40429,1,40415,1,
+40429,2,14,40425,1,
+40429,3,40415,5,0,1,
+40429,4,14,24419,10,0,1,
+40433,1,40428,1,
+40433,2,5,40430,1,
+40433,3,40428,1,0,1,
+40433,4,5,27145,6,0,1,
+40459,1,40457,1,
+40459,2,2,40458,1,
+40459,3,40457,5,0,1,
+40459,4,2,27701,2,0,1,
+40471,1,40468,1,
+40471,2,3,40470,1,
+40471,3,40468,6,0,1,
+40471,4,3,21751,2,0,1,
+40483,1,40481,1,
+40483,2,2,40479,1,
+40483,3,40481,4,0,1,
+40483,4,2,25023,8,0,1,
+40487,1,40482,1,
+40487,2,5,40482,1,
+40487,3,40482,1,0,1,
+40487,4,5,32754,7,0,1,
+40493,1,40491,1,
+40493,2,2,40492,1,
+40493,3,40491,3,0,1,
+40493,4,2,37633,3,0,1,
+40499,1,40497,1,
+40499,2,2,40494,1,
+40499,3,40497,2,0,1,
+40499,4,2,22620,3,0,1,
+40507,1,40505,1,
+40507,2,2,40506,1,
+40507,3,40505,5,0,1,
+40507,4,2,36181,7,0,1,
+40519,1,40513,1,
+40519,2,6,40509,1,
+40519,3,40513,3,0,1,
+40519,4,6,33044,11,0,1,
+40529,1,40526,1,
+40529,2,3,40523,1,
+40529,3,40526,3,0,1,
+40529,4,3,40517,0,0,1,
+40531,1,40529,1,
+40531,2,2,40527,1,
+40531,3,40529,2,0,1,
+40531,4,2,26103,8,0,1,
+40543,1,40540,1,
+40543,2,3,40537,1,
+40543,3,40540,1,0,1,
+40543,4,3,20538,3,0,1,
+40559,1,40552,1,
+40559,2,7,40556,1,
+40559,3,40552,3,0,1,
+40559,4,7,28279,5,0,1,
+40577,1,40574,1,
+40577,2,3,40571,1,
+40577,3,40574,4,0,1,
+40577,4,3,23305,11,0,1,
+40583,1,40578,1,
+40583,2,5,40581,1,
+40583,3,40578,3,0,1,
+40583,4,5,36766,14,0,1,
+40591,1,40578,1,
+40591,2,13,40590,1,
+40591,3,40578,6,0,1,
+40591,4,13,23143,5,0,1,
+40597,1,40595,1,
+40597,2,2,40593,1,
+40597,3,40595,5,0,1,
+40597,4,2,27420,9,0,1,
+40609,1,40587,1,
+40609,2,22,40606,1,
+40609,3,40587,5,0,1,
+40609,4,22,32138,25,0,1,
+40627,1,40625,1,
+40627,2,2,40623,1,
+40627,3,40625,4,0,1,
+40627,4,2,30140,19,0,1,
+40637,1,40635,1,
+40637,2,2,40626,1,
+40637,3,40635,7,0,1,
+40637,4,2,20898,6,0,1,
+40639,1,40632,1,
+40639,2,7,40630,1,
+40639,3,40632,1,0,1,
+40639,4,7,24068,3,0,1,
+40693,1,40691,1,
+40693,2,2,40689,1,
+40693,3,40691,7,0,1,
+40693,4,2,40242,12,0,1,
+40697,1,40694,1,
+40697,2,3,40692,1,
+40697,3,40694,1,0,1,
+40697,4,3,32615,2,0,1,
+40699,1,40697,1,
+40699,2,2,40693,1,
+40699,3,40697,2,0,1,
+40699,4,2,22810,3,0,1,
+40709,1,40707,1,
+40709,2,2,40705,1,
+40709,3,40707,2,0,1,
+40709,4,2,26989,6,0,1,
+40739,1,40737,1,
+40739,2,2,40734,1,
+40739,3,40737,11,0,1,
+40739,4,2,26215,3,0,1,
+40751,1,40737,1,
+40751,2,14,40750,1,
+40751,3,40737,5,0,1,
+40751,4,14,26491,3,0,1,
+40759,1,40756,1,
+40759,2,3,40757,1,
+40759,3,40756,1,0,1,
+40759,4,3,40755,4,0,1,
+40763,1,40761,1,
+40763,2,2,40758,1,
+40763,3,40761,9,0,1,
+40763,4,2,25783,0,0,1,
+40771,1,40761,1,
+40771,2,10,40769,1,
+40771,3,40761,2,0,1,
+40771,4,10,34197,8,0,1,
+40787,1,40785,1,
+40787,2,2,40783,1,
+40787,3,40785,2,0,1,
+40787,4,2,21438,13,0,1,
+40801,1,40788,1,
+40801,2,13,40798,1,
+40801,3,40788,1,0,1,
+40801,4,13,20627,10,0,1,
+40813,1,40811,1,
+40813,2,2,40812,1,
+40813,3,40811,2,0,1,
+40813,4,2,24806,6,0,1,
+40819,1,40816,1,
+40819,2,3,40810,1,
+40819,3,40816,3,0,1,
+40819,4,3,24908,2,0,1,
+40823,1,40818,1,
+40823,2,5,40821,1,
+40823,3,40818,5,0,1,
+40823,4,5,40819,3,0,1,
+40829,1,40827,1,
+40829,2,2,40828,1,
+40829,3,40827,7,0,1,
+40829,4,2,23012,3,0,1,
+40841,1,40838,1,
+40841,2,3,40836,1,
+40841,3,40838,7,0,1,
+40841,4,3,29237,2,0,1,
+40847,1,40842,1,
+40847,2,5,40842,1,
+40847,3,40842,3,0,1,
+40847,4,5,29258,8,0,1,
+40849,1,40838,1,
+40849,2,11,40848,1,
+40849,3,40838,2,0,1,
+40849,4,11,31508,20,0,1,
+40853,1,40851,1,
+40853,2,2,40849,1,
+40853,3,40851,3,0,1,
+40853,4,2,25624,9,0,1,
+40867,1,40865,1,
+40867,2,2,40863,1,
+40867,3,40865,6,0,1,
+40867,4,2,24590,8,0,1,
+40879,1,40873,1,
+40879,2,6,40877,1,
+40879,3,40873,3,0,1,
+40879,4,6,23940,3,0,1,
+40883,1,40881,1,
+40883,2,2,40882,1,
+40883,3,40881,2,0,1,
+40883,4,2,24907,2,0,1,
+40897,1,40892,1,
+40897,2,5,40894,1,
+40897,3,40892,1,0,1,
+40897,4,5,37119,24,0,1,
+40903,1,40900,1,
+40903,2,3,40901,1,
+40903,3,40900,1,0,1,
+40903,4,3,38313,3,0,1,
+40927,1,40924,1,
+40927,2,3,40926,1,
+40927,3,40924,1,0,1,
+40927,4,3,40256,5,0,1,
+40933,1,40931,1,
+40933,2,2,40929,1,
+40933,3,40931,10,0,1,
+40933,4,2,39591,15,0,1,
+40939,1,40937,1,
+40939,2,2,40938,1,
+40939,3,40937,4,0,1,
+40939,4,2,33285,2,0,1,
+40949,1,40947,1,
+40949,2,2,40937,1,
+40949,3,40947,3,0,1,
+40949,4,2,27494,1,0,1,
+40961,1,40958,1,
+40961,2,3,40960,1,
+40961,3,40958,3,0,1,
+40961,4,3,36045,7,0,1,
+40973,1,40971,1,
+40973,2,2,40969,1,
+40973,3,40971,3,0,1,
+40973,4,2,25152,6,0,1,
+40993,1,40988,1,
+40993,2,5,40992,1,
+40993,3,40988,10,0,1,
+40993,4,5,36660,6,0,1,
+41011,1,41009,1,
+41011,2,2,41010,1,
+41011,3,41009,6,0,1,
+41011,4,2,30297,2,0,1,
+41017,1,41012,1,
+41017,2,5,41016,1,
+41017,3,41012,11,0,1,
+41017,4,5,38780,6,0,1,
+41023,1,41018,1,
+41023,2,5,41022,1,
+41023,3,41018,7,0,1,
+41023,4,5,25426,2,0,1,
+41039,1,41028,1,
+41039,2,11,41034,1,
+41039,3,41028,1,0,1,
+41039,4,11,35768,7,0,1,
+41047,1,41042,1,
+41047,2,5,41045,1,
+41047,3,41042,2,0,1,
+41047,4,5,31745,10,0,1,
+41051,1,41049,1,
+41051,2,2,41050,1,
+41051,3,41049,3,0,1,
+41051,4,2,26951,2,0,1,
+41057,1,41054,1,
+41057,2,3,41050,1,
+41057,3,41054,4,0,1,
+41057,4,3,25119,2,0,1,
+41077,1,41075,1,
+41077,2,2,41073,1,
+41077,3,41075,4,0,1,
+41077,4,2,28407,6,0,1,
+41081,1,41078,1,
+41081,2,3,41072,1,
+41081,3,41078,14,0,1,
+41081,4,3,40794,6,0,1,
+41113,1,41108,1,
+41113,2,5,41110,1,
+41113,3,41108,2,0,1,
+41113,4,5,40826,16,0,1,
+41117,1,41115,1,
+41117,2,2,41112,1,
+41117,3,41115,2,0,1,
+41117,4,2,36922,8,0,1,
+41131,1,41121,1,
+41131,2,10,41127,1,
+41131,3,41121,5,0,1,
+41131,4,10,20741,2,0,1,
+41141,1,41139,1,
+41141,2,2,41133,1,
+41141,3,41139,2,0,1,
+41141,4,2,25057,0,0,1,
+41143,1,41140,1,
+41143,2,3,41141,1,
+41143,3,41140,1,0,1,
+41143,4,3,25489,3,0,1,
+41149,1,41147,1,
+41149,2,2,41148,1,
+41149,3,41147,6,0,1,
+41149,4,2,41142,8,0,1,
+41161,1,41139,1,
+41161,2,22,41150,1,
+41161,3,41139,6,0,1,
+41161,4,22,31429,0,0,1,
+41177,1,41174,1,
+41177,2,3,41171,1,
+41177,3,41174,3,0,1,
+41177,4,3,32635,1,0,1,
+41179,1,41176,1,
+41179,2,3,41174,1,
+41179,3,41176,5,0,1,
+41179,4,3,37566,3,0,1,
+41183,1,41178,1,
+41183,2,5,41182,1,
+41183,3,41178,17,0,1,
+41183,4,5,34579,2,0,1,
+41189,1,41187,1,
+41189,2,2,41179,1,
+41189,3,41187,7,0,1,
+41189,4,2,26633,0,0,1,
+41201,1,41198,1,
+41201,2,3,41200,1,
+41201,3,41198,12,0,1,
+41201,4,3,32563,4,0,1,
+41203,1,41200,1,
+41203,2,3,41202,1,
+41203,3,41200,6,0,1,
+41203,4,3,29148,5,0,1,
+41213,1,41211,1,
+41213,2,2,41209,1,
+41213,3,41211,12,0,1,
+41213,4,2,40807,6,0,1,
+41221,1,41219,1,
+41221,2,2,41220,1,
+41221,3,41219,4,0,1,
+41221,4,2,22592,7,0,1,
+41227,1,41225,1,
+41227,2,2,41221,1,
+41227,3,41225,6,0,1,
+41227,4,2,24158,22,0,1,
+41231,1,41224,1,
+41231,2,7,41229,1,
+41231,3,41224,1,0,1,
+41231,4,7,39520,7,0,1,
+41233,1,41228,1,
+41233,2,5,41228,1,
+41233,3,41228,3,0,1,
+41233,4,5,39339,12,0,1,
+41243,1,41241,1,
+41243,2,2,41239,1,
+41243,3,41241,3,0,1,
+41243,4,2,29410,16,0,1,
+41257,1,41252,1,
+41257,2,5,41256,1,
+41257,3,41252,7,0,1,
+41257,4,5,40905,8,0,1,
+41263,1,41258,1,
+41263,2,5,41262,1,
+41263,3,41258,1,0,1,
+41263,4,5,21896,2,0,1,
+41269,1,41267,1,
+41269,2,2,41264,1,
+41269,3,41267,6,0,1,
+41269,4,2,25657,15,0,1,
+41281,1,41264,1,
+41281,2,17,41278,1,
+41281,3,41264,4,0,1,
+41281,4,17,34193,16,0,1,
+41299,1,41297,1,
+41299,2,2,41298,1,
+41299,3,41297,4,0,1,
+41299,4,2,27828,6,0,1,
+41333,1,41331,1,
+41333,2,2,41329,1,
+41333,3,41331,3,0,1,
+41333,4,2,40337,1,0,1,
+41341,1,41339,1,
+41341,2,2,41340,1,
+41341,3,41339,6,0,1,
+41341,4,2,31592,7,0,1,
+41351,1,41344,1,
+41351,2,7,41350,1,
+41351,3,41344,1,0,1,
+41351,4,7,27913,2,0,1,
+41357,1,41355,1,
+41357,2,2,41353,1,
+41357,3,41355,3,0,1,
+41357,4,2,38481,7,0,1,
+41381,1,41378,1,
+41381,2,3,41380,1,
+41381,3,41378,5,0,1,
+41381,4,3,28687,3,0,1,
+41387,1,41385,1,
+41387,2,2,41386,1,
+41387,3,41385,2,0,1,
+41387,4,2,39457,11,0,1,
+41389,1,41383,1,
+41389,2,6,41385,1,
+41389,3,41383,4,0,1,
+41389,4,6,31412,2,0,1,
+41399,1,41392,1,
+41399,2,7,41397,1,
+41399,3,41392,1,0,1,
+41399,4,7,21094,18,0,1,
+41411,1,41409,1,
+41411,2,2,41410,1,
+41411,3,41409,3,0,1,
+41411,4,2,38845,2,0,1,
+41413,1,41407,1,
+41413,2,6,41411,1,
+41413,3,41407,2,0,1,
+41413,4,6,21880,8,0,1,
+41443,1,41441,1,
+41443,2,2,41442,1,
+41443,3,41441,6,0,1,
+41443,4,2,41436,8,0,1,
+41453,1,41451,1,
+41453,2,2,41448,1,
+41453,3,41451,2,0,1,
+41453,4,2,23622,2,0,1,
+41467,1,41453,1,
+41467,2,14,41465,1,
+41467,3,41453,4,0,1,
+41467,4,14,24950,0,0,1,
+41479,1,41476,1,
+41479,2,3,41477,1,
+41479,3,41476,9,0,1,
+41479,4,3,36172,3,0,1,
+41491,1,41478,1,
+41491,2,13,41490,1,
+41491,3,41478,1,0,1,
+41491,4,13,34900,5,0,1,
+41507,1,41505,1,
+41507,2,2,41503,1,
+41507,3,41505,3,0,1,
+41507,4,2,22418,8,0,1,
+41513,1,41510,1,
+41513,2,3,41512,1,
+41513,3,41510,1,0,1,
+41513,4,3,27579,6,0,1,
+41519,1,41512,1,
+41519,2,7,41517,1,
+41519,3,41512,2,0,1,
+41519,4,7,26294,4,0,1,
+41521,1,41499,1,
+41521,2,22,41510,1,
+41521,3,41499,3,0,1,
+41521,4,22,26353,0,0,1,
+41539,1,41536,1,
+41539,2,3,41528,1,
+41539,3,41536,1,0,1,
+41539,4,3,21498,1,0,1,
+41543,1,41538,1,
+41543,2,5,41541,1,
+41543,3,41538,2,0,1,
+41543,4,5,29025,10,0,1,
+41549,1,41546,1,
+41549,2,3,41548,1,
+41549,3,41546,4,0,1,
+41549,4,3,21142,3,0,1,
+41579,1,41577,1,
+41579,2,2,41578,1,
+41579,3,41577,12,0,1,
+41579,4,2,33637,4,0,1,
+41593,1,41588,1,
+41593,2,5,41590,1,
+41593,3,41588,9,0,1,
+41593,4,5,41582,14,0,1,
+41597,1,41595,1,
+41597,2,2,41596,1,
+41597,3,41595,2,0,1,
+41597,4,2,25029,4,0,1,
+41603,1,41601,1,
+41603,2,2,41597,1,
+41603,3,41601,4,0,1,
+41603,4,2,28645,4,0,1,
+41609,1,41606,1,
+41609,2,3,41608,1,
+41609,3,41606,6,0,1,
+41609,4,3,22146,4,0,1,
+41611,1,41609,1,
+41611,2,2,41610,1,
+41611,3,41609,6,0,1,
+41611,4,2,40112,2,0,1,
+41617,1,41612,1,
+41617,2,5,41612,1,
+41617,3,41612,1,0,1,
+41617,4,5,40597,10,0,1,
+41621,1,41618,1,
+41621,2,3,41613,1,
+41621,3,41618,3,0,1,
+41621,4,3,39277,1,0,1,
+41627,1,41625,1,
+41627,2,2,41626,1,
+41627,3,41625,3,0,1,
+41627,4,2,38959,2,0,1,
+41641,1,41628,1,
+41641,2,13,41632,1,
+41641,3,41628,1,0,1,
+41641,4,13,34077,31,0,1,
+41647,1,41644,1,
+41647,2,3,41645,1,
+41647,3,41644,1,0,1,
+41647,4,3,24249,3,0,1,
+41651,1,41649,1,
+41651,2,2,41645,1,
+41651,3,41649,4,0,1,
+41651,4,2,40974,0,0,1,
+41659,1,41656,1,
+41659,2,3,41658,1,
+41659,3,41656,11,0,1,
+41659,4,3,27113,6,0,1,
+41669,1,41667,1,
+41669,2,2,41665,1,
+41669,3,41667,3,0,1,
+41669,4,2,28432,1,0,1,
+41681,1,41678,1,
+41681,2,3,41680,1,
+41681,3,41678,7,0,1,
+41681,4,3,40406,7,0,1,
+41687,1,41682,1,
+41687,2,5,41685,1,
+41687,3,41682,3,0,1,
+41687,4,5,41683,3,0,1,
+41719,1,41713,1,
+41719,2,6,41718,1,
+41719,3,41713,4,0,1,
+41719,4,6,28988,3,0,1,
+41729,1,41726,1,
+41729,2,3,41728,1,
+41729,3,41726,5,0,1,
+41729,4,3,32489,7,0,1,
+41737,1,41732,1,
+41737,2,5,41736,1,
+41737,3,41732,3,0,1,
+41737,4,5,33331,6,0,1,
+41759,1,41752,1,
+41759,2,7,41758,1,
+41759,3,41752,2,0,1,
+41759,4,7,41302,3,0,1,
+41761,1,41742,1,
+41761,2,19,41758,1,
+41761,3,41742,2,0,1,
+41761,4,19,21110,10,0,1,
+41771,1,41769,1,
+41771,2,2,41767,1,
+41771,3,41769,3,0,1,
+41771,4,2,40857,7,0,1,
+41777,1,41774,1,
+41777,2,3,41776,1,
+41777,3,41774,3,0,1,
+41777,4,3,28975,4,0,1,
+41801,1,41798,1,
+41801,2,3,41796,1,
+41801,3,41798,4,0,1,
+41801,4,3,37527,2,0,1,
+41809,1,41788,1,
+41809,2,21,41805,1,
+41809,3,41788,3,0,1,
+41809,4,21,25666,18,0,1,
+41813,1,41811,1,
+41813,2,2,41809,1,
+41813,3,41811,3,0,1,
+41813,4,2,33303,6,0,1,
+41843,1,41841,1,
+41843,2,2,41839,1,
+41843,3,41841,3,0,1,
+41843,4,2,37269,7,0,1,
+41849,1,41846,1,
+41849,2,3,41843,1,
+41849,3,41846,3,0,1,
+41849,4,3,41837,0,0,1,
+41851,1,41836,1,
+41851,2,15,41848,1,
+41851,3,41836,5,0,1,
+41851,4,15,29500,9,0,1,
+41863,1,41860,1,
+41863,2,3,41862,1,
+41863,3,41860,5,0,1,
+41863,4,3,35189,5,0,1,
+41879,1,41866,1,
+41879,2,13,41878,1,
+41879,3,41866,6,0,1,
+41879,4,13,32276,2,0,1,
+41887,1,41884,1,
+41887,2,3,41886,1,
+41887,3,41884,5,0,1,
+41887,4,3,30353,5,0,1,
+41893,1,41891,1,
+41893,2,2,41892,1,
+41893,3,41891,2,0,1,
+41893,4,2,41155,6,0,1,
+41897,1,41894,1,
+41897,2,3,41892,1,
+41897,3,41894,1,0,1,
+41897,4,3,38726,8,0,1,
+41903,1,41898,1,
+41903,2,5,41901,1,
+41903,3,41898,1,0,1,
+41903,4,5,27030,14,0,1,
+41911,1,41908,1,
+41911,2,3,41909,1,
+41911,3,41908,3,0,1,
+41911,4,3,41907,4,0,1,
+41927,1,41922,1,
+41927,2,5,41926,1,
+41927,3,41922,5,0,1,
+41927,4,5,33194,5,0,1,
+41941,1,41939,1,
+41941,2,2,41937,1,
+41941,3,41939,2,0,1,
+41941,4,2,33233,12,0,1,
+41947,1,41942,1,
+41947,2,5,41946,1,
+41947,3,41942,3,0,1,
+41947,4,5,40004,2,0,1,
+41953,1,41948,1,
+41953,2,5,41950,1,
+41953,3,41948,6,0,1,
+41953,4,5,41942,14,0,1,
+41957,1,41955,1,
+41957,2,2,41956,1,
+41957,3,41955,2,0,1,
+41957,4,2,35105,4,0,1,
+41959,1,41953,1,
+41959,2,6,41958,1,
+41959,3,41953,3,0,1,
+41959,4,6,38417,2,0,1,
+41969,1,41966,1,
+41969,2,3,41963,1,
+41969,3,41966,5,0,1,
+41969,4,3,41957,0,0,1,
+41981,1,41979,1,
+41981,2,2,41977,1,
+41981,3,41979,3,0,1,
+41981,4,2,33173,7,0,1,
+41983,1,41977,1,
+41983,2,6,41980,1,
+41983,3,41977,2,0,1,
+41983,4,6,39620,5,0,1,
+41999,1,41988,1,
+41999,2,11,41997,1,
+41999,3,41988,4,0,1,
+41999,4,11,30341,7,0,1,
+42013,1,42007,1,
+42013,2,6,42012,1,
+42013,3,42007,1,0,1,
+42013,4,6,25317,8,0,1,
+42017,1,42014,1,
+42017,2,3,42016,1,
+42017,3,42014,4,0,1,
+42017,4,3,41727,7,0,1,
+42019,1,42017,1,
+42019,2,2,42018,1,
+42019,3,42017,5,0,1,
+42019,4,2,22334,2,0,1,
+42023,1,42018,1,
+42023,2,5,42021,1,
+42023,3,42018,8,0,1,
+42023,4,5,42019,3,0,1,
+42043,1,42038,1,
+42043,2,5,42042,1,
+42043,3,42038,5,0,1,
+42043,4,5,35790,2,0,1,
+42061,1,42055,1,
+42061,2,6,42060,1,
+42061,3,42055,2,0,1,
+42061,4,6,32864,7,0,1,
+42071,1,42064,1,
+42071,2,7,42067,1,
+42071,3,42064,9,0,1,
+42071,4,7,31233,5,0,1,
+42073,1,42068,1,
+42073,2,5,42068,1,
+42073,3,42068,2,0,1,
+42073,4,5,38165,12,0,1,
+42083,1,42081,1,
+42083,2,2,42079,1,
+42083,3,42081,3,0,1,
+42083,4,2,36671,7,0,1,
+42089,1,42086,1,
+42089,2,3,42083,1,
+42089,3,42086,3,0,1,
+42089,4,3,42077,0,0,1,
+42101,1,42099,1,
+42101,2,2,42100,1,
+42101,3,42099,4,0,1,
+42101,4,2,26708,4,0,1,
+42131,1,42129,1,
+42131,2,2,42130,1,
+42131,3,42129,4,0,1,
+42131,4,2,22755,6,0,1,
+42139,1,42137,1,
+42139,2,2,42135,1,
+42139,3,42137,4,0,1,
+42139,4,2,31828,1,0,1,
+42157,1,42155,1,
+42157,2,2,42156,1,
+42157,3,42155,2,0,1,
+42157,4,2,41262,7,0,1,
+42169,1,42158,1,
+42169,2,11,42168,1,
+42169,3,42158,3,0,1,
+42169,4,11,39075,12,0,1,
+42179,1,42177,1,
+42179,2,2,42161,1,
+42179,3,42177,2,0,1,
+42179,4,2,35470,0,0,1,
+42181,1,42171,1,
+42181,2,10,42178,1,
+42181,3,42171,4,0,1,
+42181,4,10,35274,1,0,1,
+42187,1,42174,1,
+42187,2,13,42186,1,
+42187,3,42174,1,0,1,
+42187,4,13,35833,8,0,1,
+42193,1,42178,1,
+42193,2,15,42192,1,
+42193,3,42178,3,0,1,
+42193,4,15,39181,12,0,1,
+42197,1,42195,1,
+42197,2,2,42192,1,
+42197,3,42195,3,0,1,
+42197,4,2,33616,17,0,1,
+42209,1,42206,1,
+42209,2,3,42208,1,
+42209,3,42206,1,0,1,
+42209,4,3,25189,4,0,1,
+42221,1,42219,1,
+42221,2,2,42216,1,
+42221,3,42219,4,0,1,
+42221,4,2,26446,2,0,1,
+42223,1,42218,1,
+42223,2,5,42218,1,
+42223,3,42218,5,0,1,
+42223,4,5,24675,12,0,1,
+42227,1,42225,1,
+42227,2,2,42226,1,
+42227,3,42225,2,0,1,
+42227,4,2,41308,4,0,1,
+42239,1,42232,1,
+42239,2,7,42235,1,
+42239,3,42232,3,0,1,
+42239,4,7,21824,5,0,1,
+42257,1,42254,1,
+42257,2,3,42256,1,
+42257,3,42254,3,0,1,
+42257,4,3,27944,4,0,1,
+42281,1,42270,1,
+42281,2,11,42270,1,
+42281,3,42270,13,0,1,
+42281,4,11,35421,0,0,1,
+42283,1,42281,1,
+42283,2,2,42282,1,
+42283,3,42281,2,0,1,
+42283,4,2,38525,7,0,1,
+42293,1,42291,1,
+42293,2,2,42292,1,
+42293,3,42291,2,0,1,
+42293,4,2,26526,6,0,1,
+42299,1,42297,1,
+42299,2,2,42298,1,
+42299,3,42297,3,0,1,
+42299,4,2,29826,2,0,1,
+42307,1,42304,1,
+42307,2,3,42302,1,
+42307,3,42304,4,0,1,
+42307,4,3,29452,14,0,1,
+42323,1,42321,1,
+42323,2,2,42318,1,
+42323,3,42321,7,0,1,
+42323,4,2,37569,3,0,1,
+42331,1,42328,1,
+42331,2,3,42322,1,
+42331,3,42328,3,0,1,
+42331,4,3,35501,7,0,1,
+42337,1,42332,1,
+42337,2,5,42332,1,
+42337,3,42332,6,0,1,
+42337,4,5,33700,10,0,1,
+42349,1,42347,1,
+42349,2,2,42348,1,
+42349,3,42347,6,0,1,
+42349,4,2,41579,3,0,1,
+42359,1,42352,1,
+42359,2,7,42358,1,
+42359,3,42352,1,0,1,
+42359,4,7,30711,2,0,1,
+42373,1,42368,1,
+42373,2,5,42372,1,
+42373,3,42368,1,0,1,
+42373,4,5,25617,3,0,1,
+42379,1,42377,1,
+42379,2,2,42375,1,
+42379,3,42377,2,0,1,
+42379,4,2,33587,8,0,1,
+42391,1,42385,1,
+42391,2,6,42387,1,
+42391,3,42385,3,0,1,
+42391,4,6,29306,1,0,1,
+42397,1,42395,1,
+42397,2,2,42396,1,
+42397,3,42395,2,0,1,
+42397,4,2,33251,6,0,1,
+42403,1,42401,1,
+42403,2,2,42399,1,
+42403,3,42401,4,0,1,
+42403,4,2,26121,8,0,1,
+42407,1,42402,1,
+42407,2,5,42406,1,
+42407,3,42402,1,0,1,
+42407,4,5,30921,2,0,1,
+42409,1,42395,1,
+42409,2,14,42406,1,
+42409,3,42395,4,0,1,
+42409,4,14,34944,20,0,1,
+42433,1,42423,1,
+42433,2,10,42428,1,
+42433,3,42423,2,0,1,
+42433,4,10,24349,0,0,1,
+42437,1,42435,1,
+42437,2,2,42436,1,
+42437,3,42435,2,0,1,
+42437,4,2,32230,3,0,1,
+42443,1,42441,1,
+42443,2,2,42439,1,
+42443,3,42441,3,0,1,
+42443,4,2,29817,8,0,1,
+42451,1,42448,1,
+42451,2,3,42450,1,
+42451,3,42448,4,0,1,
+42451,4,3,32143,2,0,1,
+42457,1,42446,1,
+42457,2,11,42455,1,
+42457,3,42446,5,0,1,
+42457,4,11,36096,22,0,1,
+42461,1,42459,1,
+42461,2,2,42457,1,
+42461,3,42459,3,0,1,
+42461,4,2,28461,1,0,1,
+42463,1,42460,1,
+42463,2,3,42461,1,
+42463,3,42460,8,0,1,
+42463,4,3,42459,4,0,1,
+42467,1,42462,1,
+42467,2,5,42466,1,
+42467,3,42462,1,0,1,
+42467,4,5,33449,2,0,1,
+42473,1,42470,1,
+42473,2,3,42472,1,
+42473,3,42470,1,0,1,
+42473,4,3,39182,7,0,1,
+42487,1,42482,1,
+42487,2,5,42486,1,
+42487,3,42482,7,0,1,
+42487,4,5,33118,2,0,1,
+42491,1,42489,1,
+42491,2,2,42487,1,
+42491,3,42489,3,0,1,
+42491,4,2,42134,7,0,1,
+42499,1,42497,1,
+42499,2,2,42495,1,
+42499,3,42497,2,0,1,
+42499,4,2,33589,8,0,1,
+42509,1,42507,1,
+42509,2,2,42503,1,
+42509,3,42507,9,0,1,
+42509,4,2,41205,4,0,1,
+42533,1,42531,1,
+42533,2,2,42529,1,
+42533,3,42531,3,0,1,
+42533,4,2,28048,12,0,1,
+42557,1,42555,1,
+42557,2,2,42553,1,
+42557,3,42555,3,0,1,
+42557,4,2,23138,6,0,1,
+42569,1,42566,1,
+42569,2,3,42568,1,
+42569,3,42566,3,0,1,
+42569,4,3,40558,7,0,1,
+42571,1,42569,1,
+42571,2,2,42567,1,
+42571,3,42569,6,0,1,
+42571,4,2,32911,8,0,1,
+42577,1,42570,1,
+42577,2,7,42570,1,
+42577,3,42570,2,0,1,
+42577,4,7,32664,14,0,1,
+42589,1,42587,1,
+42589,2,2,42585,1,
+42589,3,42587,2,0,1,
+42589,4,2,26561,12,0,1,
+42611,1,42609,1,
+42611,2,2,42607,1,
+42611,3,42609,3,0,1,
+42611,4,2,35865,8,0,1,
+42641,1,42638,1,
+42641,2,3,42635,1,
+42641,3,42638,4,0,1,
+42641,4,3,42629,0,0,1,
+42643,1,42641,1,
+42643,2,2,42642,1,
+42643,3,42641,2,0,1,
+42643,4,2,27387,7,0,1,
+42649,1,42638,1,
+42649,2,11,42646,1,
+42649,3,42638,3,0,1,
+42649,4,11,24225,14,0,1,
+42667,1,42660,1,
+42667,2,7,42665,1,
+42667,3,42660,2,0,1,
+42667,4,7,29827,15,0,1,
+42677,1,42675,1,
+42677,2,2,42676,1,
+42677,3,42675,2,0,1,
+42677,4,2,38324,4,0,1,
+42683,1,42681,1,
+42683,2,2,42679,1,
+42683,3,42681,3,0,1,
+42683,4,2,34075,7,0,1,
+42689,1,42686,1,
+42689,2,3,42678,1,
+42689,3,42686,20,0,1,
+42689,4,3,21718,4,0,1,
+42697,1,42692,1,
+42697,2,5,42694,1,
+42697,3,42692,3,0,1,
+42697,4,5,29768,29,0,1,
+42701,1,42698,1,
+42701,2,3,42700,1,
+42701,3,42698,7,0,1,
+42701,4,3,21824,3,0,1,
+42703,1,42698,1,
+42703,2,5,42702,1,
+42703,3,42698,1,0,1,
+42703,4,5,33987,2,0,1,
+42709,1,42703,1,
+42709,2,6,42708,1,
+42709,3,42703,2,0,1,
+42709,4,6,26009,11,0,1,
+42719,1,42700,1,
+42719,2,19,42718,1,
+42719,3,42700,9,0,1,
+42719,4,19,24773,6,0,1,
+42727,1,42724,1,
+42727,2,3,42725,1,
+42727,3,42724,5,0,1,
+42727,4,3,37668,3,0,1,
+42737,1,42734,1,
+42737,2,3,42736,1,
+42737,3,42734,9,0,1,
+42737,4,3,39247,6,0,1,
+42743,1,42736,1,
+42743,2,7,42741,1,
+42743,3,42736,7,0,1,
+42743,4,7,26987,10,0,1,
+42751,1,42745,1,
+42751,2,6,42750,1,
+42751,3,42745,1,0,1,
+42751,4,6,37845,2,0,1,
+42767,1,42762,1,
+42767,2,5,42765,1,
+42767,3,42762,3,0,1,
+42767,4,5,37821,14,0,1,
+42773,1,42770,1,
+42773,2,3,42771,1,
+42773,3,42770,4,0,1,
+42773,4,3,24335,7,0,1,
+42787,1,42782,1,
+42787,2,5,42786,1,
+42787,3,42782,1,0,1,
+42787,4,5,34696,10,0,1,
+42793,1,42788,1,
+42793,2,5,42788,1,
+42793,3,42788,1,0,1,
+42793,4,5,26894,15,0,1,
+42797,1,42795,1,
+42797,2,2,42796,1,
+42797,3,42795,2,0,1,
+42797,4,2,42790,8,0,1,
+42821,1,42819,1,
+42821,2,2,42817,1,
+42821,3,42819,2,0,1,
+42821,4,2,39582,7,0,1,
+42829,1,42827,1,
+42829,2,2,42828,1,
+42829,3,42827,5,0,1,
+42829,4,2,32006,3,0,1,
+42839,1,42828,1,
+42839,2,11,42837,1,
+42839,3,42828,7,0,1,
+42839,4,11,23627,5,0,1,
+42841,1,42818,1,
+42841,2,23,42840,1,
+42841,3,42818,1,0,1,
+42841,4,23,39641,12,0,1,
+42853,1,42851,1,
+42853,2,2,42852,1,
+42853,3,42851,2,0,1,
+42853,4,2,38687,14,0,1,
+42859,1,42849,1,
+42859,2,10,42858,1,
+42859,3,42849,2,0,1,
+42859,4,10,38482,5,0,1,
+42863,1,42858,1,
+42863,2,5,42862,1,
+42863,3,42858,1,0,1,
+42863,4,5,39068,4,0,1,
+42899,1,42897,1,
+42899,2,2,42898,1,
+42899,3,42897,3,0,1,
+42899,4,2,22968,4,0,1,
+42901,1,42895,1,
+42901,2,6,42897,1,
+42901,3,42895,8,0,1,
+42901,4,6,39485,2,0,1,
+42923,1,42921,1,
+42923,2,2,42911,1,
+42923,3,42921,2,0,1,
+42923,4,2,27243,16,0,1,
+42929,1,42926,1,
+42929,2,3,42919,1,
+42929,3,42926,5,0,1,
+42929,4,3,38061,3,0,1,
+42937,1,42932,1,
+42937,2,5,42932,1,
+42937,3,42932,1,0,1,
+42937,4,5,42644,10,0,1,
+42943,1,42940,1,
+42943,2,3,42942,1,
+42943,3,42940,3,0,1,
+42943,4,3,26521,5,0,1,
+42953,1,42950,1,
+42953,2,3,42947,1,
+42953,3,42950,6,0,1,
+42953,4,3,35469,25,0,1,
+42961,1,42950,1,
+42961,2,11,42956,1,
+42961,3,42950,2,0,1,
+42961,4,11,24271,16,0,1,
+42967,1,42964,1,
+42967,2,3,42965,1,
+42967,3,42964,1,0,1,
+42967,4,3,29612,3,0,1,
+42979,1,42976,1,
+42979,2,3,42978,1,
+42979,3,42976,1,0,1,
+42979,4,3,31641,6,0,1,
+42989,1,42987,1,
+42989,2,2,42981,1,
+42989,3,42987,8,0,1,
+42989,4,2,29404,0,0,1,
+43003,1,42998,1,
+43003,2,5,43001,1,
+43003,3,42998,1,0,1,
+43003,4,5,42995,6,0,1,
+43013,1,43011,1,
+43013,2,2,43012,1,
+43013,3,43011,2,0,1,
+43013,4,2,25052,4,0,1,
+43019,1,43017,1,
+43019,2,2,43015,1,
+43019,3,43017,3,0,1,
+43019,4,2,25405,8,0,1,
+43037,1,43035,1,
+43037,2,2,43033,1,
+43037,3,43035,3,0,1,
+43037,4,2,40246,6,0,1,
+43049,1,43046,1,
+43049,2,3,43048,1,
+43049,3,43046,18,0,1,
+43049,4,3,25533,4,0,1,
+43051,1,43049,1,
+43051,2,2,43047,1,
+43051,3,43049,2,0,1,
+43051,4,2,39322,8,0,1,
+43063,1,43060,1,
+43063,2,3,43058,1,
+43063,3,43060,12,0,1,
+43063,4,3,40513,6,0,1,
+43067,1,43065,1,
+43067,2,2,43066,1,
+43067,3,43065,2,0,1,
+43067,4,2,38385,4,0,1,
+43093,1,43088,1,
+43093,2,5,43090,1,
+43093,3,43088,1,0,1,
+43093,4,5,38709,1,0,1,
+43103,1,43098,1,
+43103,2,5,43101,1,
+43103,3,43098,1,0,1,
+43103,4,5,43099,3,0,1,
+43117,1,43115,1,
+43117,2,2,43113,1,
+43117,3,43115,6,0,1,
+43117,4,2,33081,6,0,1,
+43133,1,43131,1,
+43133,2,2,43127,1,
+43133,3,43131,3,0,1,
+43133,4,2,35076,3,0,1,
+43151,1,43140,1,
+43151,2,11,43150,1,
+43151,3,43140,4,0,1,
+43151,4,11,28114,4,0,1,
+43159,1,43156,1,
+43159,2,3,43158,1,
+43159,3,43156,4,0,1,
+43159,4,3,34751,3,0,1,
+43177,1,43172,1,
+43177,2,5,43174,1,
+43177,3,43172,1,0,1,
+43177,4,5,43166,14,0,1,
+43189,1,43187,1,
+43189,2,2,43183,1,
+43189,3,43187,6,0,1,
+43189,4,2,36760,0,0,1,
+43201,1,43178,1,
+43201,2,23,43200,1,
+43201,3,43178,1,0,1,
+43201,4,23,29702,14,0,1,
+43207,1,43204,1,
+43207,2,3,43206,1,
+43207,3,43204,4,0,1,
+43207,4,3,39155,5,0,1,
+43223,1,43218,1,
+43223,2,5,43221,1,
+43223,3,43218,9,0,1,
+43223,4,5,39112,10,0,1,
+43237,1,43235,1,
+43237,2,2,43236,1,
+43237,3,43235,2,0,1,
+43237,4,2,24655,7,0,1,
+43261,1,43259,1,
+43261,2,2,43257,1,
+43261,3,43259,2,0,1,
+43261,4,2,28419,10,0,1,
+43271,1,43258,1,
+43271,2,13,43269,1,
+43271,3,43258,1,0,1,
+43271,4,13,43259,5,0,1,
+43283,1,43281,1,
+43283,2,2,43279,1,
+43283,3,43281,3,0,1,
+43283,4,2,38919,7,0,1,
+43291,1,43288,1,
+43291,2,3,43290,1,
+43291,3,43288,1,0,1,
+43291,4,3,34735,6,0,1,
+43313,1,43310,1,
+43313,2,3,43312,1,
+43313,3,43310,8,0,1,
+43313,4,3,40552,4,0,1,
+43319,1,43308,1,
+43319,2,11,43317,1,
+43319,3,43308,1,0,1,
+43319,4,11,38802,3,0,1,
+43321,1,43308,1,
+43321,2,13,43320,1,
+43321,3,43308,1,0,1,
+43321,4,13,29474,14,0,1,
+43331,1,43329,1,
+43331,2,2,43327,1,
+43331,3,43329,3,0,1,
+43331,4,2,40546,7,0,1,
+43391,1,43374,1,
+43391,2,17,43390,1,
+43391,3,43374,1,0,1,
+43391,4,17,27050,2,0,1,
+43397,1,43395,1,
+43397,2,2,43393,1,
+43397,3,43395,3,0,1,
+43397,4,2,33130,7,0,1,
+43399,1,43386,1,
+43399,2,13,43396,1,
+43399,3,43386,1,0,1,
+43399,4,13,41165,0,0,1,
+43403,1,43401,1,
+43403,2,2,43402,1,
+43403,3,43401,2,0,1,
+43403,4,2,32462,2,0,1,
+43411,1,43408,1,
+43411,2,3,43402,1,
+43411,3,43408,3,0,1,
+43411,4,3,21982,2,0,1,
+43427,1,43425,1,
+43427,2,2,43426,1,
+43427,3,43425,2,0,1,
+43427,4,2,42961,4,0,1,
+43441,1,43430,1,
+43441,2,11,43438,1,
+43441,3,43430,1,0,1,
+43441,4,11,34169,10,0,1,
+43451,1,43449,1,
+43451,2,2,43447,1,
+43451,3,43449,3,0,1,
+43451,4,2,23733,7,0,1,
+43457,1,43454,1,
+43457,2,3,43452,1,
+43457,3,43454,3,0,1,
+43457,4,3,25956,0,0,1,
+43481,1,43475,1,
+43481,2,6,43480,1,
+43481,3,43475,8,0,1,
+43481,4,6,32217,7,0,1,
+43487,1,43482,1,
+43487,2,5,43485,1,
+43487,3,43482,5,0,1,
+43487,4,5,38995,8,0,1,
+43499,1,43497,1,
+43499,2,2,43495,1,
+43499,3,43497,2,0,1,
+43499,4,2,24344,9,0,1,
+43517,1,43515,1,
+43517,2,2,43516,1,
+43517,3,43515,8,0,1,
+43517,4,2,29167,9,0,1,
+43541,1,43539,1,
+43541,2,2,43537,1,
+43541,3,43539,3,0,1,
+43541,4,2,33814,12,0,1,
+43543,1,43540,1,
+43543,2,3,43541,1,
+43543,3,43540,1,0,1,
+43543,4,3,37975,3,0,1,
+43573,1,43571,1,
+43573,2,2,43572,1,
+43573,3,43571,2,0,1,
+43573,4,2,32563,3,0,1,
+43577,1,43574,1,
+43577,2,3,43576,1,
+43577,3,43574,8,0,1,
+43577,4,3,39567,18,0,1,
+43579,1,43577,1,
+43579,2,2,43575,1,
+43579,3,43577,6,0,1,
+43579,4,2,36760,8,0,1,
+43591,1,43580,1,
+43591,2,11,43590,1,
+43591,3,43580,2,0,1,
+43591,4,11,39505,2,0,1,
+43597,1,43595,1,
+43597,2,2,43593,1,
+43597,3,43595,6,0,1,
+43597,4,2,25494,9,0,1,
+43607,1,43602,1,
+43607,2,5,43606,1,
+43607,3,43602,7,0,1,
+43607,4,5,33614,2,0,1,
+43609,1,43595,1,
+43609,2,14,43607,1,
+43609,3,43595,5,0,1,
+43609,4,14,43583,15,0,1,
+43613,1,43611,1,
+43613,2,2,43612,1,
+43613,3,43611,2,0,1,
+43613,4,2,33869,6,0,1,
+43627,1,43625,1,
+43627,2,2,43626,1,
+43627,3,43625,2,0,1,
+43627,4,2,23387,11,0,1,
+43633,1,43628,1,
+43633,2,5,43630,1,
+43633,3,43628,2,0,1,
+43633,4,5,42940,29,0,1,
+43649,1,43646,1,
+43649,2,3,43644,1,
+43649,3,43646,3,0,1,
+43649,4,3,39029,2,0,1,
+43651,1,43649,1,
+43651,2,2,43650,1,
+43651,3,43649,5,0,1,
+43651,4,2,31013,6,0,1,
+43661,1,43659,1,
+43661,2,2,43657,1,
+43661,3,43659,3,0,1,
+43661,4,2,42390,6,0,1,
+43669,1,43667,1,
+43669,2,2,43665,1,
+43669,3,43667,4,0,1,
+43669,4,2,31089,11,0,1,
+43691,1,43685,1,
+43691,2,6,43688,1,
+43691,3,43685,2,0,1,
+43691,4,6,25082,4,0,1,
+43711,1,43698,1,
+43711,2,13,43707,1,
+43711,3,43698,1,0,1,
+43711,4,13,40875,6,0,1,
+43717,1,43712,1,
+43717,2,5,43712,1,
+43717,3,43712,2,0,1,
+43717,4,5,25396,22,0,1,
+43721,1,43718,1,
+43721,2,3,43716,1,
+43721,3,43718,1,0,1,
+43721,4,3,24256,2,0,1,
+43753,1,43746,1,
+43753,2,7,43750,1,
+43753,3,43746,3,0,1,
+43753,4,7,34502,10,0,1,
+43759,1,43756,1,
+43759,2,3,43757,1,
+43759,3,43756,4,0,1,
+43759,4,3,31341,3,0,1,
+43777,1,43772,1,
+43777,2,5,43774,1,
+43777,3,43772,2,0,1,
+43777,4,5,33589,10,0,1,
+43781,1,43779,1,
+43781,2,2,43780,1,
+43781,3,43779,3,0,1,
+43781,4,2,28286,4,0,1,
+43783,1,43780,1,
+43783,2,3,43781,1,
+43783,3,43780,1,0,1,
+43783,4,3,26033,6,0,1,
+43787,1,43785,1,
+43787,2,2,43782,1,
+43787,3,43785,4,0,1,
+43787,4,2,29567,3,0,1,
+43789,1,43783,1,
+43789,2,6,43788,1,
+43789,3,43783,2,0,1,
+43789,4,6,26852,11,0,1,
+43793,1,43790,1,
+43793,2,3,43792,1,
+43793,3,43790,1,0,1,
+43793,4,3,22460,4,0,1,
+43801,1,43770,1,
+43801,2,31,43800,1,
+43801,3,43770,10,0,1,
+43801,4,31,38713,12,0,1,
+43853,1,43851,1,
+43853,2,2,43852,1,
+43853,3,43851,2,0,1,
+43853,4,2,33682,3,0,1,
+43867,1,43864,1,
+43867,2,3,43866,1,
+43867,3,43864,1,0,1,
+43867,4,3,40905,5,0,1,
+43889,1,43886,1,
+43889,2,3,43888,1,
+43889,3,43886,4,0,1,
+43889,4,3,35759,7,0,1,
+43891,1,43888,1,
+43891,2,3,43882,1,
+43891,3,43888,1,0,1,
+43891,4,3,27605,2,0,1,
+43913,1,43910,1,
+43913,2,3,43906,1,
+43913,3,43910,1,0,1,
+43913,4,3,40419,1,0,1,
+43933,1,43931,1,
+43933,2,2,43929,1,
+43933,3,43931,6,0,1,
+43933,4,2,28743,6,0,1,
+43943,1,43938,1,
+43943,2,5,43942,1,
+43943,3,43938,9,0,1,
+43943,4,5,26709,2,0,1,
+43951,1,43945,1,
+43951,2,6,43950,1,
+43951,3,43945,1,0,1,
+43951,4,6,37226,3,0,1,
+43961,1,43955,1,
+43961,2,6,43958,1,
+43961,3,43955,2,0,1,
+43961,4,6,41983,0,0,1,
+43963,1,43951,1,
+43963,2,12,43961,1,
+43963,3,43951,5,0,1,
+43963,4,12,31920,0,0,1,
+43969,1,43958,1,
+43969,2,11,43964,1,
+43969,3,43958,1,0,1,
+43969,4,11,36514,16,0,1,
+43973,1,43971,1,
+43973,2,2,43972,1,
+43973,3,43971,2,0,1,
+43973,4,2,39500,3,0,1,
+43987,1,43985,1,
+43987,2,2,43986,1,
+43987,3,43985,2,0,1,
+43987,4,2,25031,20,0,1,
+43991,1,43974,1,
+43991,2,17,43989,1,
+43991,3,43974,2,0,1,
+43991,4,17,25746,4,0,1,
+43997,1,43995,1,
+43997,2,2,43985,1,
+43997,3,43995,5,0,1,
+43997,4,2,43240,4,0,1,
+44017,1,44006,1,
+44017,2,11,44016,1,
+44017,3,44006,8,0,1,
+44017,4,11,27001,11,0,1,
+44021,1,44019,1,
+44021,2,2,44020,1,
+44021,3,44019,3,0,1,
+44021,4,2,25060,3,0,1,
+44027,1,44025,1,
+44027,2,2,44022,1,
+44027,3,44025,8,0,1,
+44027,4,2,43513,3,0,1,
+44029,1,44023,1,
+44029,2,6,44025,1,
+44029,3,44023,1,0,1,
+44029,4,6,44025,6,0,1,
+44041,1,44030,1,
+44041,2,11,44030,1,
+44041,3,44030,1,0,1,
+44041,4,11,40183,33,0,1,
+44053,1,44051,1,
+44053,2,2,44049,1,
+44053,3,44051,6,0,1,
+44053,4,2,34020,6,0,1,
+44059,1,44057,1,
+44059,2,2,44055,1,
+44059,3,44057,2,0,1,
+44059,4,2,41061,8,0,1,
+44071,1,44068,1,
+44071,2,3,44069,1,
+44071,3,44068,6,0,1,
+44071,4,3,38223,3,0,1,
+44087,1,44082,1,
+44087,2,5,44084,1,
+44087,3,44082,6,0,1,
+44087,4,5,35704,4,0,1,
+44089,1,44076,1,
+44089,2,13,44077,1,
+44089,3,44076,5,0,1,
+44089,4,13,37163,5,0,1,
+44101,1,44095,1,
+44101,2,6,44100,1,
+44101,3,44095,9,0,1,
+44101,4,6,27234,7,0,1,
+44111,1,44104,1,
+44111,2,7,44110,1,
+44111,3,44104,5,0,1,
+44111,4,7,34808,2,0,1,
+44119,1,44113,1,
+44119,2,6,44118,1,
+44119,3,44113,2,0,1,
+44119,4,6,24852,2,0,1,
+44123,1,44121,1,
+44123,2,2,44119,1,
+44123,3,44121,4,0,1,
+44123,4,2,27622,8,0,1,
+44129,1,44126,1,
+44129,2,3,44128,1,
+44129,3,44126,6,0,1,
+44129,4,3,25052,7,0,1,
+44131,1,44129,1,
+44131,2,2,44130,1,
+44131,3,44129,5,0,1,
+44131,4,2,44124,8,0,1,
+44159,1,44148,1,
+44159,2,11,44157,1,
+44159,3,44148,1,0,1,
+44159,4,11,24048,3,0,1,
+44171,1,44169,1,
+44171,2,2,44167,1,
+44171,3,44169,3,0,1,
+44171,4,2,28055,7,0,1,
+44179,1,44177,1,
+44179,2,2,44175,1,
+44179,3,44177,2,0,1,
+44179,4,2,22840,8,0,1,
+44189,1,44187,1,
+44189,2,2,44184,1,
+44189,3,44187,3,0,1,
+44189,4,2,24361,2,0,1,
+44201,1,44195,1,
+44201,2,6,44198,1,
+44201,3,44195,2,0,1,
+44201,4,6,29090,0,0,1,
+44203,1,44198,1,
+44203,2,5,44201,1,
+44203,3,44198,1,0,1,
+44203,4,5,30833,0,0,1,
+44207,1,44202,1,
+44207,2,5,44206,1,
+44207,3,44202,1,0,1,
+44207,4,5,42981,3,0,1,
+44221,1,44219,1,
+44221,2,2,44217,1,
+44221,3,44219,2,0,1,
+44221,4,2,32008,12,0,1,
+44249,1,44246,1,
+44249,2,3,44248,1,
+44249,3,44246,1,0,1,
+44249,4,3,30476,7,0,1,
+44257,1,44252,1,
+44257,2,5,44252,1,
+44257,3,44252,7,0,1,
+44257,4,5,23929,10,0,1,
+44263,1,44260,1,
+44263,2,3,44262,1,
+44263,3,44260,1,0,1,
+44263,4,3,41855,2,0,1,
+44267,1,44265,1,
+44267,2,2,44266,1,
+44267,3,44265,8,0,1,
+44267,4,2,29079,2,0,1,
+44269,1,44267,1,
+44269,2,2,44265,1,
+44269,3,44267,5,0,1,
+44269,4,2,31561,10,0,1,
+44273,1,44270,1,
+44273,2,3,44267,1,
+44273,3,44270,1,0,1,
+44273,4,3,34723,1,0,1,
+44279,1,44272,1,
+44279,2,7,44278,1,
+44279,3,44272,1,0,1,
+44279,4,7,43581,6,0,1,
+44281,1,44274,1,
+44281,2,7,44274,1,
+44281,3,44274,5,0,1,
+44281,4,7,35321,0,0,1,
+44293,1,44291,1,
+44293,2,2,44289,1,
+44293,3,44291,6,0,1,
+44293,4,2,32613,9,0,1,
+44351,1,44332,1,
+44351,2,19,44350,1,
+44351,3,44332,3,0,1,
+44351,4,19,27884,2,0,1,
+44357,1,44355,1,
+44357,2,2,44356,1,
+44357,3,44355,2,0,1,
+44357,4,2,33875,6,0,1,
+44371,1,44369,1,
+44371,2,2,44370,1,
+44371,3,44369,4,0,1,
+44371,4,2,33187,2,0,1,
+44381,1,44379,1,
+44381,2,2,44377,1,
+44381,3,44379,2,0,1,
+44381,4,2,22426,6,0,1,
+44383,1,44380,1,
+44383,2,3,44381,1,
+44383,3,44380,4,0,1,
+44383,4,3,38428,3,0,1,
+44389,1,44387,1,
+44389,2,2,44385,1,
+44389,3,44387,2,0,1,
+44389,4,2,30976,10,0,1,
+44417,1,44414,1,
+44417,2,3,44416,1,
+44417,3,44414,4,0,1,
+44417,4,3,22776,4,0,1,
+44449,1,44436,1,
+44449,2,13,44448,1,
+44449,3,44436,1,0,1,
+44449,4,13,43275,8,0,1,
+44453,1,44451,1,
+44453,2,2,44452,1,
+44453,3,44451,2,0,1,
+44453,4,2,32208,9,0,1,
+44483,1,44481,1,
+44483,2,2,44482,1,
+44483,3,44481,2,0,1,
+44483,4,2,44476,8,0,1,
+44491,1,44478,1,
+44491,2,13,44487,1,
+44491,3,44478,5,0,1,
+44491,4,13,44479,8,0,1,
+44497,1,44492,1,
+44497,2,5,44496,1,
+44497,3,44492,8,0,1,
+44497,4,5,40423,6,0,1,
+44501,1,44499,1,
+44501,2,2,44497,1,
+44501,3,44499,2,0,1,
+44501,4,2,40698,6,0,1,
+44507,1,44505,1,
+44507,2,2,44503,1,
+44507,3,44505,3,0,1,
+44507,4,2,23167,7,0,1,
+44519,1,44506,1,
+44519,2,13,44518,1,
+44519,3,44506,9,0,1,
+44519,4,13,36891,2,0,1,
+44531,1,44529,1,
+44531,2,2,44527,1,
+44531,3,44529,2,0,1,
+44531,4,2,25071,7,0,1,
+44533,1,44531,1,
+44533,2,2,44532,1,
+44533,3,44531,2,0,1,
+44533,4,2,40441,9,0,1,
+44537,1,44534,1,
+44537,2,3,44526,1,
+44537,3,44534,1,0,1,
+44537,4,3,34804,1,0,1,
+44543,1,44538,1,
+44543,2,5,44541,1,
+44543,3,44538,13,0,1,
+44543,4,5,30983,8,0,1,
+44549,1,44547,1,
+44549,2,2,44541,1,
+44549,3,44547,2,0,1,
+44549,4,2,26924,0,0,1,
+44563,1,44560,1,
+44563,2,3,44562,1,
+44563,3,44560,3,0,1,
+44563,4,3,29486,7,0,1,
+44579,1,44577,1,
+44579,2,2,44578,1,
+44579,3,44577,3,0,1,
+44579,4,2,32744,2,0,1,
+44587,1,44584,1,
+44587,2,3,44580,1,
+44587,3,44584,7,0,1,
+44587,4,3,42198,2,0,1,
+44617,1,44612,1,
+44617,2,5,44610,1,
+44617,3,44612,6,0,1,
+44617,4,5,36621,12,0,1,
+44621,1,44619,1,
+44621,2,2,44617,1,
+44621,3,44619,3,0,1,
+44621,4,2,25247,1,0,1,
+44623,1,44618,1,
+44623,2,5,44621,1,
+44623,3,44618,6,0,1,
+44623,4,5,38712,9,0,1,
+44633,1,44630,1,
+44633,2,3,44627,1,
+44633,3,44630,5,0,1,
+44633,4,3,25261,1,0,1,
+44641,1,44622,1,
+44641,2,19,44626,1,
+44641,3,44622,1,0,1,
+44641,4,19,29082,53,0,1,
+44647,1,44642,1,
+44647,2,5,44645,1,
+44647,3,44642,3,0,1,
+44647,4,5,44643,3,0,1,
+44651,1,44649,1,
+44651,2,2,44639,1,
+44651,3,44649,10,0,1,
+44651,4,2,29349,2,0,1,
+44657,1,44654,1,
+44657,2,3,44650,1,
+44657,3,44654,3,0,1,
+44657,4,3,35664,1,0,1,
+44683,1,44681,1,
+44683,2,2,44679,1,
+44683,3,44681,6,0,1,
+44683,4,2,39812,8,0,1,
+44687,1,44682,1,
+44687,2,5,44686,1,
+44687,3,44682,5,0,1,
+44687,4,5,22753,7,0,1,
+44699,1,44697,1,
+44699,2,2,44695,1,
+44699,3,44697,3,0,1,
+44699,4,2,22700,13,0,1,
+44701,1,44699,1,
+44701,2,2,44700,1,
+44701,3,44699,4,0,1,
+44701,4,2,33644,3,0,1,
+44711,1,44704,1,
+44711,2,7,44710,1,
+44711,3,44704,3,0,1,
+44711,4,7,32919,3,0,1,
+44729,1,44726,1,
+44729,2,3,44718,1,
+44729,3,44726,12,0,1,
+44729,4,3,33328,8,0,1,
+44741,1,44739,1,
+44741,2,2,44737,1,
+44741,3,44739,2,0,1,
+44741,4,2,24989,6,0,1,
+44753,1,44750,1,
+44753,2,3,44748,1,
+44753,3,44750,1,0,1,
+44753,4,3,40201,0,0,1,
+44771,1,44765,1,
+44771,2,6,44768,1,
+44771,3,44765,3,0,1,
+44771,4,6,37426,1,0,1,
+44773,1,44768,1,
+44773,2,5,44768,1,
+44773,3,44768,7,0,1,
+44773,4,5,31254,10,0,1,
+44777,1,44774,1,
+44777,2,3,44776,1,
+44777,3,44774,1,0,1,
+44777,4,3,35882,7,0,1,
+44789,1,44787,1,
+44789,2,2,44788,1,
+44789,3,44787,3,0,1,
+44789,4,2,25164,3,0,1,
+44797,1,44795,1,
+44797,2,2,44793,1,
+44797,3,44795,4,0,1,
+44797,4,2,38114,19,0,1,
+44809,1,44798,1,
+44809,2,11,44808,1,
+44809,3,44798,3,0,1,
+44809,4,11,42414,12,0,1,
+44819,1,44817,1,
+44819,2,2,44818,1,
+44819,3,44817,8,0,1,
+44819,4,2,39060,4,0,1,
+44839,1,44833,1,
+44839,2,6,44837,1,
+44839,3,44833,2,0,1,
+44839,4,6,23972,10,0,1,
+44843,1,44838,1,
+44843,2,5,44842,1,
+44843,3,44838,2,0,1,
+44843,4,5,40321,5,0,1,
+44851,1,44841,1,
+44851,2,10,44849,1,
+44851,3,44841,6,0,1,
+44851,4,10,44833,11,0,1,
+44867,1,44865,1,
+44867,2,2,44863,1,
+44867,3,44865,3,0,1,
+44867,4,2,29181,8,0,1,
+44879,1,44872,1,
+44879,2,7,44872,1,
+44879,3,44872,1,0,1,
+44879,4,7,35745,12,0,1,
+44887,1,44882,1,
+44887,2,5,44885,1,
+44887,3,44882,3,0,1,
+44887,4,5,22724,10,0,1,
+44893,1,44888,1,
+44893,2,5,44892,1,
+44893,3,44888,2,0,1,
+44893,4,5,35048,3,0,1,
+44909,1,44907,1,
+44909,2,2,44905,1,
+44909,3,44907,2,0,1,
+44909,4,2,41382,12,0,1,
+44917,1,44912,1,
+44917,2,5,44912,1,
+44917,3,44912,12,0,1,
+44917,4,5,36869,7,0,1,
+44927,1,44920,1,
+44927,2,7,44920,1,
+44927,3,44920,11,0,1,
+44927,4,7,24924,0,0,1,
+44939,1,44937,1,
+44939,2,2,44932,1,
+44939,3,44937,4,0,1,
+44939,4,2,36433,1,0,1,
+44953,1,44948,1,
+44953,2,5,44950,1,
+44953,3,44948,1,0,1,
+44953,4,5,23277,23,0,1,
+44959,1,44956,1,
+44959,2,3,44958,1,
+44959,3,44956,4,0,1,
+44959,4,3,31149,3,0,1,
+44963,1,44961,1,
+44963,2,2,44959,1,
+44963,3,44961,3,0,1,
+44963,4,2,26831,8,0,1,
+44971,1,44968,1,
+44971,2,3,44958,1,
+44971,3,44968,9,0,1,
+44971,4,3,24561,2,0,1,
+44983,1,44980,1,
+44983,2,3,44981,1,
+44983,3,44980,3,0,1,
+44983,4,3,37289,3,0,1,
+44987,1,44985,1,
+44987,2,2,44986,1,
+44987,3,44985,2,0,1,
+44987,4,2,37946,2,0,1,
+45007,1,45004,1,
+45007,2,3,45006,1,
+45007,3,45004,3,0,1,
+45007,4,3,39082,16,0,1,
+45013,1,45011,1,
+45013,2,2,45012,1,
+45013,3,45011,6,0,1,
+45013,4,2,44248,9,0,1,
+45053,1,45051,1,
+45053,2,2,45049,1,
+45053,3,45051,3,0,1,
+45053,4,2,28099,7,0,1,
+45061,1,45059,1,
+45061,2,2,45057,1,
+45061,3,45059,2,0,1,
+45061,4,2,37766,6,0,1,
+45077,1,45075,1,
+45077,2,2,45072,1,
+45077,3,45075,7,0,1,
+45077,4,2,42647,16,0,1,
+45083,1,45081,1,
+45083,2,2,45082,1,
+45083,3,45081,2,0,1,
+45083,4,2,36140,2,0,1,
+45119,1,45112,1,
+45119,2,7,45118,1,
+45119,3,45112,1,0,1,
+45119,4,7,43617,3,0,1,
+45121,1,45114,1,
+45121,2,7,45118,1,
+45121,3,45114,4,0,1,
+45121,4,7,31700,14,0,1,
+45127,1,45115,1,
+45127,2,12,45123,1,
+45127,3,45115,1,0,1,
+45127,4,12,41102,5,0,1,
+45131,1,45129,1,
+45131,2,2,45125,1,
+45131,3,45129,2,0,1,
+45131,4,2,28913,4,0,1,
+45137,1,45134,1,
+45137,2,3,45124,1,
+45137,3,45134,4,0,1,
+45137,4,3,40344,25,0,1,
+45139,1,45137,1,
+45139,2,2,45138,1,
+45139,3,45137,5,0,1,
+45139,4,2,30734,7,0,1,
+45161,1,45158,1,
+45161,2,3,45160,1,
+45161,3,45158,11,0,1,
+45161,4,3,34176,4,0,1,
+45179,1,45173,1,
+45179,2,6,45171,1,
+45179,3,45173,10,0,1,
+45179,4,6,41353,1,0,1,
+45181,1,45179,1,
+45181,2,2,45180,1,
+45181,3,45179,4,0,1,
+45181,4,2,45174,8,0,1,
+45191,1,45180,1,
+45191,2,11,45187,1,
+45191,3,45180,1,0,1,
+45191,4,11,27300,5,0,1,
+45197,1,45195,1,
+45197,2,2,45196,1,
+45197,3,45195,5,0,1,
+45197,4,2,31103,4,0,1,
+45233,1,45230,1,
+45233,2,3,45227,1,
+45233,3,45230,7,0,1,
+45233,4,3,30727,1,0,1,
+45247,1,45242,1,
+45247,2,5,45246,1,
+45247,3,45242,1,0,1,
+45247,4,5,38021,3,0,1,
+45259,1,45256,1,
+45259,2,3,45254,1,
+45259,3,45256,11,0,1,
+45259,4,3,41101,3,0,1,
+45263,1,45258,1,
+45263,2,5,45261,1,
+45263,3,45258,6,0,1,
+45263,4,5,45259,3,0,1,
+45281,1,45278,1,
+45281,2,3,45276,1,
+45281,3,45278,3,0,1,
+45281,4,3,44980,2,0,1,
+45289,1,45275,1,
+45289,2,14,45284,1,
+45289,3,45275,4,0,1,
+45289,4,14,34625,12,0,1,
+45293,1,45291,1,
+45293,2,2,45292,1,
+45293,3,45291,2,0,1,
+45293,4,2,29347,3,0,1,
+45307,1,45305,1,
+45307,2,2,45306,1,
+45307,3,45305,6,0,1,
+45307,4,2,45300,8,0,1,
+45317,1,45315,1,
+45317,2,2,45316,1,
+45317,3,45315,2,0,1,
+45317,4,2,27826,3,0,1,
+45319,1,45316,1,
+45319,2,3,45317,1,
+45319,3,45316,1,0,1,
+45319,4,3,45315,4,0,1,
+45329,1,45326,1,
+45329,2,3,45315,1,
+45329,3,45326,5,0,1,
+45329,4,3,26229,2,0,1,
+45337,1,45332,1,
+45337,2,5,45336,1,
+45337,3,45332,1,0,1,
+45337,4,5,32816,6,0,1,
+45341,1,45339,1,
+45341,2,2,45329,1,
+45341,3,45339,2,0,1,
+45341,4,2,42292,1,0,1,
+45343,1,45337,1,
+45343,2,6,45342,1,
+45343,3,45337,6,0,1,
+45343,4,6,34743,3,0,1,
+45361,1,45350,1,
+45361,2,11,45360,1,
+45361,3,45350,1,0,1,
+45361,4,11,44156,12,0,1,
+45377,1,45374,1,
+45377,2,3,45372,1,
+45377,3,45374,3,0,1,
+45377,4,3,37182,0,0,1,
+45389,1,45387,1,
+45389,2,2,45379,1,
+45389,3,45387,2,0,1,
+45389,4,2,30421,0,0,1,
+45403,1,45400,1,
+45403,2,3,45402,1,
+45403,3,45400,1,0,1,
+45403,4,3,27129,2,0,1,
+45413,1,45411,1,
+45413,2,2,45406,1,
+45413,3,45411,5,0,1,
+45413,4,2,42709,4,0,1,
+45427,1,45424,1,
+45427,2,3,45426,1,
+45427,3,45424,6,0,1,
+45427,4,3,23344,5,0,1,
+45433,1,45426,1,
+45433,2,7,45426,1,
+45433,3,45426,1,0,1,
+45433,4,7,26654,12,0,1,
+45439,1,45436,1,
+45439,2,3,45433,1,
+45439,3,45436,4,0,1,
+45439,4,3,36560,7,0,1,
+45481,1,45468,1,
+45481,2,13,45480,1,
+45481,3,45468,1,0,1,
+45481,4,13,35722,18,0,1,
+45491,1,45489,1,
+45491,2,2,45487,1,
+45491,3,45489,3,0,1,
+45491,4,2,35717,7,0,1,
+45497,1,45494,1,
+45497,2,3,45491,1,
+45497,3,45494,1,0,1,
+45497,4,3,33499,27,0,1,
+45503,1,45498,1,
+45503,2,5,45501,1,
+45503,3,45498,1,0,1,
+45503,4,5,45499,3,0,1,
+45523,1,45521,1,
+45523,2,2,45519,1,
+45523,3,45521,4,0,1,
+45523,4,2,30815,8,0,1,
+45533,1,45531,1,
+45533,2,2,45532,1,
+45533,3,45531,4,0,1,
+45533,4,2,41057,9,0,1,
+45541,1,45531,1,
+45541,2,10,45540,1,
+45541,3,45531,3,0,1,
+45541,4,10,26200,14,0,1,
+45553,1,45548,1,
+45553,2,5,45552,1,
+45553,3,45548,3,0,1,
+45553,4,5,44878,6,0,1,
+45557,1,45554,1,
+45557,2,3,45556,1,
+45557,3,45554,3,0,1,
+45557,4,3,44882,6,0,1,
+45569,1,45566,1,
+45569,2,3,45568,1,
+45569,3,45566,1,0,1,
+45569,4,3,40897,4,0,1,
+45587,1,45585,1,
+45587,2,2,45586,1,
+45587,3,45585,10,0,1,
+45587,4,2,31949,13,0,1,
+45589,1,45587,1,
+45589,2,2,45588,1,
+45589,3,45587,5,0,1,
+45589,4,2,28142,9,0,1,
+45599,1,45592,1,
+45599,2,7,45595,1,
+45599,3,45592,4,0,1,
+45599,4,7,44995,6,0,1,
+45613,1,45611,1,
+45613,2,2,45609,1,
+45613,3,45611,6,0,1,
+45613,4,2,29096,12,0,1,
+45631,1,45619,1,
+45631,2,12,45630,1,
+45631,3,45619,3,0,1,
+45631,4,12,26884,2,0,1,
+45641,1,45630,1,
+45641,2,11,45632,1,
+45641,3,45630,1,0,1,
+45641,4,11,36166,15,0,1,
+45659,1,45657,1,
+45659,2,2,45650,1,
+45659,3,45657,5,0,1,
+45659,4,2,41259,1,0,1,
+45667,1,45665,1,
+45667,2,2,45663,1,
+45667,3,45665,2,0,1,
+45667,4,2,29332,11,0,1,
+45673,1,45668,1,
+45673,2,5,45668,1,
+45673,3,45668,5,0,1,
+45673,4,5,32101,10,0,1,
+45677,1,45675,1,
+45677,2,2,45673,1,
+45677,3,45675,3,0,1,
+45677,4,2,37666,12,0,1,
+45691,1,45684,1,
+45691,2,7,45689,1,
+45691,3,45684,5,0,1,
+45691,4,7,25859,6,0,1,
+45697,1,45687,1,
+45697,2,10,45696,1,
+45697,3,45687,6,0,1,
+45697,4,10,38298,6,0,1,
+45707,1,45705,1,
+45707,2,2,45702,1,
+45707,3,45705,5,0,1,
+45707,4,2,25083,3,0,1,
+45737,1,45734,1,
+45737,2,3,45730,1,
+45737,3,45734,5,0,1,
+45737,4,3,38513,0,0,1,
+45751,1,45748,1,
+45751,2,3,45750,1,
+45751,3,45748,4,0,1,
+45751,4,3,30312,2,0,1,
+45757,1,45755,1,
+45757,2,2,45756,1,
+45757,3,45755,6,0,1,
+45757,4,2,40134,7,0,1,
+45763,1,45758,1,
+45763,2,5,45761,1,
+45763,3,45758,6,0,1,
+45763,4,5,45755,6,0,1,
+45767,1,45762,1,
+45767,2,5,45766,1,
+45767,3,45762,2,0,1,
+45767,4,5,26371,5,0,1,
+45779,1,45777,1,
+45779,2,2,45767,1,
+45779,3,45777,4,0,1,
+45779,4,2,24414,6,0,1,
+45817,1,45812,1,
+45817,2,5,45816,1,
+45817,3,45812,7,0,1,
+45817,4,5,43698,6,0,1,
+45821,1,45819,1,
+45821,2,2,45817,1,
+45821,3,45819,3,0,1,
+45821,4,2,27262,1,0,1,
+45823,1,45820,1,
+45823,2,3,45822,1,
+45823,3,45820,1,0,1,
+45823,4,3,30323,2,0,1,
+45827,1,45825,1,
+45827,2,2,45826,1,
+45827,3,45825,3,0,1,
+45827,4,2,40257,4,0,1,
+45833,1,45828,1,
+45833,2,5,45825,1,
+45833,3,45828,5,0,1,
+45833,4,5,44852,11,0,1,
+45841,1,45834,1,
+45841,2,7,45838,1,
+45841,3,45834,3,0,1,
+45841,4,7,31158,17,0,1,
+45853,1,45848,1,
+45853,2,5,45848,1,
+45853,3,45848,1,0,1,
+45853,4,5,27311,11,0,1,
+45863,1,45853,1,
+45863,2,10,45862,1,
+45863,3,45853,2,0,1,
+45863,4,10,24212,3,0,1,
+45869,1,45867,1,
+45869,2,2,45868,1,
+45869,3,45867,4,0,1,
+45869,4,2,26797,3,0,1,
+45887,1,45882,1,
+45887,2,5,45886,1,
+45887,3,45882,9,0,1,
+45887,4,5,39288,3,0,1,
+45893,1,45891,1,
+45893,2,2,45889,1,
+45893,3,45891,3,0,1,
+45893,4,2,39520,26,0,1,
+45943,1,45937,1,
+45943,2,6,45940,1,
+45943,3,45937,6,0,1,
+45943,4,6,30371,5,0,1,
+45949,1,45947,1,
+45949,2,2,45945,1,
+45949,3,45947,2,0,1,
+45949,4,2,33945,10,0,1,
+45953,1,45950,1,
+45953,2,3,45952,1,
+45953,3,45950,9,0,1,
+45953,4,3,37935,8,0,1,
+45959,1,45952,1,
+45959,2,7,45958,1,
+45959,3,45952,3,0,1,
+45959,4,7,32873,7,0,1,
+45971,1,45969,1,
+45971,2,2,45967,1,
+45971,3,45969,2,0,1,
+45971,4,2,44216,8,0,1,
+45979,1,45977,1,
+45979,2,2,45978,1,
+45979,3,45977,5,0,1,
+45979,4,2,28690,7,0,1,
+45989,1,45987,1,
+45989,2,2,45988,1,
+45989,3,45987,3,0,1,
+45989,4,2,35560,9,0,1,
+46021,1,46019,1,
+46021,2,2,46020,1,
+46021,3,46019,6,0,1,
+46021,4,2,31211,3,0,1,
+46027,1,46025,1,
+46027,2,2,46023,1,
+46027,3,46025,6,0,1,
+46027,4,2,30373,8,0,1,
+46049,1,46046,1,
+46049,2,3,46038,1,
+46049,3,46046,5,0,1,
+46049,4,3,26786,8,0,1,
+46051,1,46048,1,
+46051,2,3,46046,1,
+46051,3,46048,1,0,1,
+46051,4,3,25364,3,0,1,
+46061,1,46059,1,
+46061,2,2,46057,1,
+46061,3,46059,2,0,1,
+46061,4,2,38464,7,0,1,
+46073,1,46068,1,
+46073,2,5,46068,1,
+46073,3,46068,6,0,1,
+46073,4,5,33248,2,0,1,
+46091,1,46089,1,
+46091,2,2,46087,1,
+46091,3,46089,3,0,1,
+46091,4,2,38291,19,0,1,
+46093,1,46091,1,
+46093,2,2,46092,1,
+46093,3,46091,2,0,1,
+46093,4,2,32682,6,0,1,
+46099,1,46097,1,
+46099,2,2,46095,1,
+46099,3,46097,4,0,1,
+46099,4,2,39615,8,0,1,
+46103,1,46093,1,
+46103,2,10,46101,1,
+46103,3,46093,4,0,1,
+46103,4,10,46085,11,0,1,
+46133,1,46131,1,
+46133,2,2,46132,1,
+46133,3,46131,9,0,1,
+46133,4,2,28930,3,0,1,
+46141,1,46131,1,
+46141,2,10,46138,1,
+46141,3,46131,11,0,1,
+46141,4,10,39758,9,0,1,
+46147,1,46145,1,
+46147,2,2,46146,1,
+46147,3,46145,5,0,1,
+46147,4,2,25219,2,0,1,
+46153,1,46148,1,
+46153,2,5,46152,1,
+46153,3,46148,7,0,1,
+46153,4,5,35048,12,0,1,
+46171,1,46168,1,
+46171,2,3,46166,1,
+46171,3,46168,4,0,1,
+46171,4,3,27178,3,0,1,
+46181,1,46179,1,
+46181,2,2,46177,1,
+46181,3,46179,3,0,1,
+46181,4,2,35131,12,0,1,
+46183,1,46180,1,
+46183,2,3,46181,1,
+46183,3,46180,8,0,1,
+46183,4,3,46179,4,0,1,
+46187,1,46185,1,
+46187,2,2,46177,1,
+46187,3,46185,8,0,1,
+46187,4,2,36061,2,0,1,
+46199,1,46182,1,
+46199,2,17,46197,1,
+46199,3,46182,7,0,1,
+46199,4,17,46191,3,0,1,
+46219,1,46216,1,
+46219,2,3,46218,1,
+46219,3,46216,1,0,1,
+46219,4,3,43375,2,0,1,
+46229,1,46227,1,
+46229,2,2,46224,1,
+46229,3,46227,2,0,1,
+46229,4,2,44536,2,0,1,
+46237,1,46235,1,
+46237,2,2,46233,1,
+46237,3,46235,4,0,1,
+46237,4,2,41915,12,0,1,
+46261,1,46259,1,
+46261,2,2,46260,1,
+46261,3,46259,5,0,1,
+46261,4,2,23371,3,0,1,
+46271,1,46264,1,
+46271,2,7,46269,1,
+46271,3,46264,3,0,1,
+46271,4,7,38257,4,0,1,
+46273,1,46268,1,
+46273,2,5,46272,1,
+46273,3,46268,5,0,1,
+46273,4,5,34133,6,0,1,
+46279,1,46276,1,
+46279,2,3,46278,1,
+46279,3,46276,3,0,1,
+46279,4,3,39624,3,0,1,
+46301,1,46299,1,
+46301,2,2,46297,1,
+46301,3,46299,3,0,1,
+46301,4,2,29134,1,0,1,
+46307,1,46305,1,
+46307,2,2,46303,1,
+46307,3,46305,9,0,1,
+46307,4,2,28139,13,0,1,
+46309,1,46307,1,
+46309,2,2,46305,1,
+46309,3,46307,4,0,1,
+46309,4,2,25582,12,0,1,
+46327,1,46324,1,
+46327,2,3,46326,1,
+46327,3,46324,8,0,1,
+46327,4,3,32791,2,0,1,
+46337,1,46334,1,
+46337,2,3,46332,1,
+46337,3,46334,1,0,1,
+46337,4,3,44575,0,0,1,
+46349,1,46347,1,
+46349,2,2,46342,1,
+46349,3,46347,5,0,1,
+46349,4,2,42092,17,0,1,
+46351,1,46348,1,
+46351,2,3,46350,1,
+46351,3,46348,6,0,1,
+46351,4,3,39860,3,0,1,
+46381,1,46374,1,
+46381,2,7,46378,1,
+46381,3,46374,2,0,1,
+46381,4,7,35780,5,0,1,
+46399,1,46396,1,
+46399,2,3,46397,1,
+46399,3,46396,4,0,1,
+46399,4,3,46395,4,0,1,
+46411,1,46408,1,
+46411,2,3,46410,1,
+46411,3,46408,4,0,1,
+46411,4,3,39497,7,0,1,
+46439,1,46432,1,
+46439,2,7,46437,1,
+46439,3,46432,1,0,1,
+46439,4,7,42373,5,0,1,
+46441,1,46434,1,
+46441,2,7,46434,1,
+46441,3,46434,2,0,1,
+46441,4,7,27654,18,0,1,
+46447,1,46444,1,
+46447,2,3,46445,1,
+46447,3,46444,5,0,1,
+46447,4,3,46443,4,0,1,
+46451,1,46445,1,
+46451,2,6,46449,1,
+46451,3,46445,2,0,1,
+46451,4,6,41734,5,0,1,
+46457,1,46454,1,
+46457,2,3,46452,1,
+46457,3,46454,1,0,1,
+46457,4,3,43174,0,0,1,
+46471,1,46468,1,
+46471,2,3,46470,1,
+46471,3,46468,1,0,1,
+46471,4,3,41420,3,0,1,
+46477,1,46475,1,
+46477,2,2,46473,1,
+46477,3,46475,5,0,1,
+46477,4,2,26312,10,0,1,
+46489,1,46460,1,
+46489,2,29,46486,1,
+46489,3,46460,3,0,1,
+46489,4,29,44904,20,0,1,
+46499,1,46497,1,
+46499,2,2,46495,1,
+46499,3,46497,3,0,1,
+46499,4,2,24692,7,0,1,
+46507,1,46505,1,
+46507,2,2,46503,1,
+46507,3,46505,2,0,1,
+46507,4,2,30550,1,0,1,
+46511,1,46500,1,
+46511,2,11,46507,1,
+46511,3,46500,2,0,1,
+46511,4,11,45147,6,0,1,
+46523,1,46518,1,
+46523,2,5,46521,1,
+46523,3,46518,6,0,1,
+46523,4,5,43829,5,0,1,
+46549,1,46547,1,
+46549,2,2,46545,1,
+46549,3,46547,5,0,1,
+46549,4,2,36157,6,0,1,
+46559,1,46552,1,
+46559,2,7,46558,1,
+46559,3,46552,9,0,1,
+46559,4,7,24905,2,0,1,
+46567,1,46564,1,
+46567,2,3,46565,1,
+46567,3,46564,1,0,1,
+46567,4,3,30664,6,0,1,
+46573,1,46571,1,
+46573,2,2,46569,1,
+46573,3,46571,9,0,1,
+46573,4,2,42450,6,0,1,
+46589,1,46587,1,
+46589,2,2,46582,1,
+46589,3,46587,2,0,1,
+46589,4,2,42838,4,0,1,
+46591,1,46585,1,
+46591,2,6,46587,1,
+46591,3,46585,2,0,1,
+46591,4,6,23581,1,0,1,
+46601,1,46598,1,
+46601,2,3,46594,1,
+46601,3,46598,5,0,1,
+46601,4,3,37174,1,0,1,
+46619,1,46613,1,
+46619,2,6,46617,1,
+46619,3,46613,3,0,1,
+46619,4,6,44101,9,0,1,
+46633,1,46628,1,
+46633,2,5,46628,1,
+46633,3,46628,3,0,1,
+46633,4,5,41892,10,0,1,
+46639,1,46633,1,
+46639,2,6,46637,1,
+46639,3,46633,3,0,1,
+46639,4,6,34453,3,0,1,
+46643,1,46641,1,
+46643,2,2,46637,1,
+46643,3,46641,4,0,1,
+46643,4,2,37192,4,0,1,
+46649,1,46634,1,
+46649,2,15,46648,1,
+46649,3,46634,1,0,1,
+46649,4,15,26508,4,0,1,
+46663,1,46658,1,
+46663,2,5,46662,1,
+46663,3,46658,1,0,1,
+46663,4,5,38255,2,0,1,
+46679,1,46662,1,
+46679,2,17,46677,1,
+46679,3,46662,3,0,1,
+46679,4,17,45842,8,0,1,
+46681,1,46670,1,
+46681,2,11,46680,1,
+46681,3,46670,2,0,1,
+46681,4,11,38568,14,0,1,
+46687,1,46684,1,
+46687,2,3,46685,1,
+46687,3,46684,1,0,1,
+46687,4,3,46683,4,0,1,
+46691,1,46689,1,
+46691,2,2,46687,1,
+46691,3,46689,3,0,1,
+46691,4,2,39580,8,0,1,
+46703,1,46698,1,
+46703,2,5,46700,1,
+46703,3,46698,1,0,1,
+46703,4,5,25022,9,0,1,
+46723,1,46721,1,
+46723,2,2,46722,1,
+46723,3,46721,2,0,1,
+46723,4,2,40260,2,0,1,
+46727,1,46722,1,
+46727,2,5,46725,1,
+46727,3,46722,2,0,1,
+46727,4,5,46715,11,0,1,
+46747,1,46745,1,
+46747,2,2,46743,1,
+46747,3,46745,6,0,1,
+46747,4,2,23732,8,0,1,
+46751,1,46740,1,
+46751,2,11,46749,1,
+46751,3,46740,1,0,1,
+46751,4,11,38211,3,0,1,
+46757,1,46755,1,
+46757,2,2,46753,1,
+46757,3,46755,3,0,1,
+46757,4,2,33210,6,0,1,
+46769,1,46766,1,
+46769,2,3,46763,1,
+46769,3,46766,1,0,1,
+46769,4,3,46757,0,0,1,
+46771,1,46769,1,
+46771,2,2,46767,1,
+46771,3,46769,2,0,1,
+46771,4,2,33203,8,0,1,
+46807,1,46804,1,
+46807,2,3,46806,1,
+46807,3,46804,1,0,1,
+46807,4,3,24365,5,0,1,
+46811,1,46809,1,
+46811,2,2,46805,1,
+46811,3,46809,2,0,1,
+46811,4,2,41529,0,0,1,
+46817,1,46814,1,
+46817,2,3,46811,1,
+46817,3,46814,1,0,1,
+46817,4,3,41548,11,0,1,
+46819,1,46817,1,
+46819,2,2,46812,1,
+46819,3,46817,6,0,1,
+46819,4,2,24486,5,0,1,
+46829,1,46827,1,
+46829,2,2,46828,1,
+46829,3,46827,3,0,1,
+46829,4,2,29540,3,0,1,
+46831,1,46828,1,
+46831,2,3,46829,1,
+46831,3,46828,4,0,1,
+46831,4,3,29341,3,0,1,
+46853,1,46851,1,
+46853,2,2,46845,1,
+46853,3,46851,7,0,1,
+46853,4,2,25849,5,0,1,
+46861,1,46855,1,
+46861,2,6,46860,1,
+46861,3,46855,7,0,1,
+46861,4,6,35569,22,0,1,
+46867,1,46865,1,
+46867,2,2,46863,1,
+46867,3,46865,5,0,1,
+46867,4,2,26956,8,0,1,
+46877,1,46875,1,
+46877,2,2,46873,1,
+46877,3,46875,2,0,1,
+46877,4,2,34515,1,0,1,
+46889,1,46886,1,
+46889,2,3,46884,1,
+46889,3,46886,3,0,1,
+46889,4,3,33650,2,0,1,
+46901,1,46890,1,
+46901,2,11,46899,1,
+46901,3,46890,4,0,1,
+46901,4,11,26924,0,0,1,
+46919,1,46908,1,
+46919,2,11,46917,1,
+46919,3,46908,1,0,1,
+46919,4,11,37138,5,0,1,
+46933,1,46931,1,
+46933,2,2,46932,1,
+46933,3,46931,2,0,1,
+46933,4,2,36682,3,0,1,
+46957,1,46952,1,
+46957,2,5,46956,1,
+46957,3,46952,1,0,1,
+46957,4,5,37504,3,0,1,
+46993,1,46988,1,
+46993,2,5,46988,1,
+46993,3,46988,6,0,1,
+46993,4,5,32806,15,0,1,
+46997,1,46995,1,
+46997,2,2,46996,1,
+46997,3,46995,2,0,1,
+46997,4,2,40850,4,0,1,
+47017,1,47010,1,
+47017,2,7,47010,1,
+47017,3,47010,3,0,1,
+47017,4,7,31573,12,0,1,
+47041,1,47012,1,
+47041,2,29,47038,1,
+47041,3,47012,2,0,1,
+47041,4,29,26628,16,0,1,
+47051,1,47049,1,
+47051,2,2,47046,1,
+47051,3,47049,2,0,1,
+47051,4,2,40653,3,0,1,
+47057,1,47054,1,
+47057,2,3,47056,1,
+47057,3,47054,4,0,1,
+47057,4,3,35069,7,0,1,
+47059,1,47057,1,
+47059,2,2,47058,1,
+47059,3,47057,6,0,1,
+47059,4,2,31564,2,0,1,
+47087,1,47082,1,
+47087,2,5,47085,1,
+47087,3,47082,6,0,1,
+47087,4,5,47083,3,0,1,
+47093,1,47091,1,
+47093,2,2,47089,1,
+47093,3,47091,3,0,1,
+47093,4,2,46659,6,0,1,
+47111,1,47104,1,
+47111,2,7,47107,1,
+47111,3,47104,2,0,1,
+47111,4,7,46497,13,0,1,
+47119,1,47116,1,
+47119,2,3,47117,1,
+47119,3,47116,1,0,1,
+47119,4,3,45329,3,0,1,
+47123,1,47121,1,
+47123,2,2,47119,1,
+47123,3,47121,2,0,1,
+47123,4,2,30269,20,0,1,
+47129,1,47126,1,
+47129,2,3,47117,1,
+47129,3,47126,1,0,1,
+47129,4,3,37567,0,0,1,
+47137,1,47132,1,
+47137,2,5,47134,1,
+47137,3,47132,1,0,1,
+47137,4,5,41132,23,0,1,
+47143,1,47137,1,
+47143,2,6,47140,1,
+47143,3,47137,1,0,1,
+47143,4,6,36780,4,0,1,
+47147,1,47145,1,
+47147,2,2,47143,1,
+47147,3,47145,3,0,1,
+47147,4,2,30463,8,0,1,
+47149,1,47147,1,
+47149,2,2,47141,1,
+47149,3,47147,2,0,1,
+47149,4,2,43332,0,0,1,
+47161,1,47144,1,
+47161,2,17,47156,1,
+47161,3,47144,2,0,1,
+47161,4,17,26737,22,0,1,
+47189,1,47187,1,
+47189,2,2,47181,1,
+47189,3,47187,2,0,1,
+47189,4,2,45094,0,0,1,
+47207,1,47202,1,
+47207,2,5,47204,1,
+47207,3,47202,2,0,1,
+47207,4,5,35549,4,0,1,
+47221,1,47215,1,
+47221,2,6,47217,1,
+47221,3,47215,7,0,1,
+47221,4,6,40587,2,0,1,
+47237,1,47235,1,
+47237,2,2,47233,1,
+47237,3,47235,3,0,1,
+47237,4,2,44006,6,0,1,
+47251,1,47241,1,
+47251,2,10,47249,1,
+47251,3,47241,5,0,1,
+47251,4,10,31356,0,0,1,
+47269,1,47263,1,
+47269,2,6,47261,1,
+47269,3,47263,2,0,1,
+47269,4,6,34884,0,0,1,
+47279,1,47272,1,
+47279,2,7,47277,1,
+47279,3,47272,2,0,1,
+47279,4,7,31867,4,0,1,
+47287,1,47282,1,
+47287,2,5,47286,1,
+47287,3,47282,1,0,1,
+47287,4,5,30338,5,0,1,
+47293,1,47287,1,
+47293,2,6,47292,1,
+47293,3,47287,2,0,1,
+47293,4,6,29331,27,0,1,
+47297,1,47294,1,
+47297,2,3,47291,1,
+47297,3,47294,1,0,1,
+47297,4,3,31326,1,0,1,
+47303,1,47298,1,
+47303,2,5,47302,1,
+47303,3,47298,1,0,1,
+47303,4,5,24970,4,0,1,
+47309,1,47307,1,
+47309,2,2,47300,1,
+47309,3,47307,5,0,1,
+47309,4,2,36347,1,0,1,
+47317,1,47311,1,
+47317,2,6,47315,1,
+47317,3,47311,4,0,1,
+47317,4,6,36456,4,0,1,
+47339,1,47337,1,
+47339,2,2,47338,1,
+47339,3,47337,4,0,1,
+47339,4,2,47332,8,0,1,
+47351,1,47338,1,
+47351,2,13,47349,1,
+47351,3,47338,1,0,1,
+47351,4,13,24355,3,0,1,
+47353,1,47348,1,
+47353,2,5,47348,1,
+47353,3,47348,1,0,1,
+47353,4,5,42696,10,0,1,
+47363,1,47361,1,
+47363,2,2,47359,1,
+47363,3,47361,3,0,1,
+47363,4,2,36657,7,0,1,
+47381,1,47379,1,
+47381,2,2,47380,1,
+47381,3,47379,5,0,1,
+47381,4,2,29852,9,0,1,
+47387,1,47385,1,
+47387,2,2,47383,1,
+47387,3,47385,3,0,1,
+47387,4,2,47010,8,0,1,
+47389,1,47387,1,
+47389,2,2,47388,1,
+47389,3,47387,5,0,1,
+47389,4,2,23938,9,0,1,
+47407,1,47404,1,
+47407,2,3,47406,1,
+47407,3,47404,3,0,1,
+47407,4,3,41033,8,0,1,
+47417,1,47414,1,
+47417,2,3,47416,1,
+47417,3,47414,1,0,1,
+47417,4,3,30547,7,0,1,
+47419,1,47417,1,
+47419,2,2,47415,1,
+47419,3,47417,6,0,1,
+47419,4,2,23898,8,0,1,
+47431,1,47419,1,
+47431,2,12,47428,1,
+47431,3,47419,6,0,1,
+47431,4,12,36693,0,0,1,
+47441,1,47438,1,
+47441,2,3,47435,1,
+47441,3,47438,1,0,1,
+47441,4,3,47429,0,0,1,
+47459,1,47457,1,
+47459,2,2,47458,1,
+47459,3,47457,15,0,1,
+47459,4,2,24336,6,0,1,
+47491,1,47489,1,
+47491,2,2,47490,1,
+47491,3,47489,5,0,1,
+47491,4,2,44244,2,0,1,
+47497,1,47492,1,
+47497,2,5,47494,1,
+47497,3,47492,1,0,1,
+47497,4,5,26516,18,0,1,
+47501,1,47498,1,
+47501,2,3,47499,1,
+47501,3,47498,4,0,1,
+47501,4,3,47497,4,0,1,
+47507,1,47505,1,
+47507,2,2,47503,1,
+47507,3,47505,2,0,1,
+47507,4,2,38252,16,0,1,
+47513,1,47510,1,
+47513,2,3,47508,1,
+47513,3,47510,3,0,1,
+47513,4,3,31881,0,0,1,
+47521,1,47504,1,
+47521,2,17,47520,1,
+47521,3,47504,3,0,1,
+47521,4,17,29097,20,0,1,
+47527,1,47524,1,
+47527,2,3,47526,1,
+47527,3,47524,3,0,1,
+47527,4,3,35241,5,0,1,
+47533,1,47531,1,
+47533,2,2,47532,1,
+47533,3,47531,2,0,1,
+47533,4,2,34111,3,0,1,
+47543,1,47538,1,
+47543,2,5,47535,1,
+47543,3,47538,1,0,1,
+47543,4,5,24194,3,0,1,
+47563,1,47561,1,
+47563,2,2,47562,1,
+47563,3,47561,2,0,1,
+47563,4,2,30316,2,0,1,
+47569,1,47552,1,
+47569,2,17,47568,1,
+47569,3,47552,6,0,1,
+47569,4,17,44979,14,0,1,
+47581,1,47579,1,
+47581,2,2,47577,1,
+47581,3,47579,2,0,1,
+47581,4,2,29004,12,0,1,
+47591,1,47580,1,
+47591,2,11,47590,1,
+47591,3,47580,8,0,1,
+47591,4,11,25303,3,0,1,
+47599,1,47596,1,
+47599,2,3,47598,1,
+47599,3,47596,4,0,1,
+47599,4,3,42246,2,0,1,
+47609,1,47603,1,
+47609,2,6,47608,1,
+47609,3,47603,4,0,1,
+47609,4,6,42600,7,0,1,
+47623,1,47620,1,
+47623,2,3,47621,1,
+47623,3,47620,1,0,1,
+47623,4,3,47619,4,0,1,
+47629,1,47619,1,
+47629,2,10,47626,1,
+47629,3,47619,2,0,1,
+47629,4,10,36643,13,0,1,
+47639,1,47632,1,
+47639,2,7,47638,1,
+47639,3,47632,8,0,1,
+47639,4,7,26912,2,0,1,
+47653,1,47640,1,
+47653,2,13,47642,1,
+47653,3,47640,3,0,1,
+47653,4,13,40519,3,0,1,
+47657,1,47654,1,
+47657,2,3,47651,1,
+47657,3,47654,1,0,1,
+47657,4,3,28471,9,0,1,
+47659,1,47657,1,
+47659,2,2,47658,1,
+47659,3,47657,6,0,1,
+47659,4,2,29906,7,0,1,
+47681,1,47678,1,
+47681,2,3,47680,1,
+47681,3,47678,11,0,1,
+47681,4,3,26764,4,0,1,
+47699,1,47697,1,
+47699,2,2,47694,1,
+47699,3,47697,2,0,1,
+47699,4,2,35869,3,0,1,
+47701,1,47699,1,
+47701,2,2,47700,1,
+47701,3,47699,6,0,1,
+47701,4,2,40941,7,0,1,
+47711,1,47700,1,
+47711,2,11,47709,1,
+47711,3,47700,2,0,1,
+47711,4,11,28539,3,0,1,
+47713,1,47703,1,
+47713,2,10,47708,1,
+47713,3,47703,4,0,1,
+47713,4,10,31546,10,0,1,
+47717,1,47715,1,
+47717,2,2,47716,1,
+47717,3,47715,2,0,1,
+47717,4,2,43442,3,0,1,
+47737,1,47732,1,
+47737,2,5,47734,1,
+47737,3,47732,2,0,1,
+47737,4,5,37040,23,0,1,
+47741,1,47738,1,
+47741,2,3,47733,1,
+47741,3,47738,1,0,1,
+47741,4,3,28355,11,0,1,
+47743,1,47740,1,
+47743,2,3,47741,1,
+47743,3,47740,1,0,1,
+47743,4,3,47739,4,0,1,
+47777,1,47774,1,
+47777,2,3,47769,1,
+47777,3,47774,3,0,1,
+47777,4,3,46327,2,0,1,
+47779,1,47776,1,
+47779,2,3,47778,1,
+47779,3,47776,3,0,1,
+47779,4,3,44214,2,0,1,
+47791,1,47784,1,
+47791,2,7,47778,1,
+47791,3,47784,3,0,1,
+47791,4,7,25128,1,0,1,
+47797,1,47792,1,
+47797,2,5,47796,1,
+47797,3,47792,2,0,1,
+47797,4,5,38175,6,0,1,
+47807,1,47802,1,
+47807,2,5,47806,1,
+47807,3,47802,5,0,1,
+47807,4,5,32752,3,0,1,
+47809,1,47802,1,
+47809,2,7,47800,1,
+47809,3,47802,4,0,1,
+47809,4,7,36600,16,0,1,
+47819,1,47817,1,
+47819,2,2,47813,1,
+47819,3,47817,2,0,1,
+47819,4,2,29004,0,0,1,
+47837,1,47835,1,
+47837,2,2,47831,1,
+47837,3,47835,2,0,1,
+47837,4,2,26959,1,0,1,
+47843,1,47841,1,
+47843,2,2,47842,1,
+47843,3,47841,2,0,1,
+47843,4,2,35977,2,0,1,
+47857,1,47850,1,
+47857,2,7,47854,1,
+47857,3,47850,2,0,1,
+47857,4,7,24323,8,0,1,
+47869,1,47867,1,
+47869,2,2,47868,1,
+47869,3,47867,6,0,1,
+47869,4,2,36099,3,0,1,
+47881,1,47852,1,
+47881,2,29,47876,1,
+47881,3,47852,2,0,1,
+47881,4,29,46952,18,0,1,
+47903,1,47896,1,
+47903,2,7,47902,1,
+47903,3,47896,2,0,1,
+47903,4,7,36964,2,0,1,
+47911,1,47908,1,
+47911,2,3,47910,1,
+47911,3,47908,1,0,1,
+47911,4,3,44831,3,0,1,
+47917,1,47912,1,
+47917,2,5,47916,1,
+47917,3,47912,2,0,1,
+47917,4,5,41117,6,0,1,
+47933,1,47931,1,
+47933,2,2,47929,1,
+47933,3,47931,3,0,1,
+47933,4,2,46754,6,0,1,
+47939,1,47937,1,
+47939,2,2,47938,1,
+47939,3,47937,3,0,1,
+47939,4,2,38673,2,0,1,
+47947,1,47945,1,
+47947,2,2,47943,1,
+47947,3,47945,5,0,1,
+47947,4,2,38585,13,0,1,
+47951,1,47944,1,
+47951,2,7,47949,1,
+47951,3,47944,5,0,1,
+47951,4,7,35366,5,0,1,
+47963,1,47961,1,
+47963,2,2,47962,1,
+47963,3,47961,2,0,1,
+47963,4,2,28626,4,0,1,
+47969,1,47966,1,
+47969,2,3,47963,1,
+47969,3,47966,5,0,1,
+47969,4,3,47957,0,0,1,
+47977,1,47970,1,
+47977,2,7,47970,1,
+47977,3,47970,1,0,1,
+47977,4,7,35515,12,0,1,
+47981,1,47979,1,
+47981,2,2,47974,1,
+47981,3,47979,3,0,1,
+47981,4,2,27256,14,0,1,
+48017,1,48014,1,
+48017,2,3,48016,1,
+48017,3,48014,3,0,1,
+48017,4,3,39230,4,0,1,
+48023,1,48018,1,
+48023,2,5,48006,1,
+48023,3,48018,5,0,1,
+48023,4,5,39800,12,0,1,
+48029,1,48027,1,
+48029,2,2,48021,1,
+48029,3,48027,11,0,1,
+48029,4,2,40222,0,0,1,
+48049,1,48032,1,
+48049,2,17,48046,1,
+48049,3,48032,1,0,1,
+48049,4,17,30905,20,0,1,
+48073,1,48068,1,
+48073,2,5,48072,1,
+48073,3,48068,3,0,1,
+48073,4,5,31604,6,0,1,
+48079,1,48073,1,
+48079,2,6,48077,1,
+48079,3,48073,3,0,1,
+48079,4,6,31403,4,0,1,
+48091,1,48084,1,
+48091,2,7,48089,1,
+48091,3,48084,1,0,1,
+48091,4,7,30351,6,0,1,
+48109,1,48107,1,
+48109,2,2,48105,1,
+48109,3,48107,6,0,1,
+48109,4,2,41128,11,0,1,
+48119,1,48112,1,
+48119,2,7,48117,1,
+48119,3,48112,3,0,1,
+48119,4,7,41509,4,0,1,
+48121,1,48108,1,
+48121,2,13,48120,1,
+48121,3,48108,8,0,1,
+48121,4,13,28355,8,0,1,
+48131,1,48125,1,
+48131,2,6,48129,1,
+48131,3,48125,3,0,1,
+48131,4,6,38135,5,0,1,
+48157,1,48152,1,
+48157,2,5,48154,1,
+48157,3,48152,2,0,1,
+48157,4,5,41490,1,0,1,
+48163,1,48160,1,
+48163,2,3,48158,1,
+48163,3,48160,8,0,1,
+48163,4,3,34731,3,0,1,
+48179,1,48173,1,
+48179,2,6,48177,1,
+48179,3,48173,3,0,1,
+48179,4,6,44807,9,0,1,
+48187,1,48185,1,
+48187,2,2,48186,1,
+48187,3,48185,6,0,1,
+48187,4,2,40059,2,0,1,
+48193,1,48186,1,
+48193,2,7,48186,1,
+48193,3,48186,1,0,1,
+48193,4,7,30606,12,0,1,
+48197,1,48195,1,
+48197,2,2,48193,1,
+48197,3,48195,3,0,1,
+48197,4,2,34515,7,0,1,
+48221,1,48219,1,
+48221,2,2,48215,1,
+48221,3,48219,9,0,1,
+48221,4,2,47059,4,0,1,
+48239,1,48232,1,
+48239,2,7,48232,1,
+48239,3,48232,2,0,1,
+48239,4,7,33840,8,0,1,
+48247,1,48244,1,
+48247,2,3,48245,1,
+48247,3,48244,1,0,1,
+48247,4,3,32980,6,0,1,
+48259,1,48257,1,
+48259,2,2,48255,1,
+48259,3,48257,2,0,1,
+48259,4,2,38080,8,0,1,
+48271,1,48265,1,
+48271,2,6,48270,1,
+48271,3,48265,2,0,1,
+48271,4,6,40466,2,0,1,
+48281,1,48278,1,
+48281,2,3,48280,1,
+48281,3,48278,12,0,1,
+48281,4,3,43232,4,0,1,
+48299,1,48297,1,
+48299,2,2,48295,1,
+48299,3,48297,3,0,1,
+48299,4,2,42653,7,0,1,
+48311,1,48304,1,
+48311,2,7,48310,1,
+48311,3,48304,1,0,1,
+48311,4,7,48302,4,0,1,
+48313,1,48308,1,
+48313,2,5,48312,1,
+48313,3,48308,1,0,1,
+48313,4,5,48002,6,0,1,
+48337,1,48327,1,
+48337,2,10,48332,1,
+48337,3,48327,3,0,1,
+48337,4,10,34674,10,0,1,
+48341,1,48338,1,
+48341,2,3,48340,1,
+48341,3,48338,3,0,1,
+48341,4,3,29790,3,0,1,
+48353,1,48350,1,
+48353,2,3,48352,1,
+48353,3,48350,3,0,1,
+48353,4,3,25766,7,0,1,
+48371,1,48369,1,
+48371,2,2,48366,1,
+48371,3,48369,7,0,1,
+48371,4,2,33067,3,0,1,
+48383,1,48378,1,
+48383,2,5,48381,1,
+48383,3,48378,7,0,1,
+48383,4,5,48379,3,0,1,
+48397,1,48392,1,
+48397,2,5,48394,1,
+48397,3,48392,2,0,1,
+48397,4,5,39035,10,0,1,
+48407,1,48402,1,
+48407,2,5,48406,1,
+48407,3,48402,1,0,1,
+48407,4,5,26131,2,0,1,
+48409,1,48392,1,
+48409,2,17,48398,1,
+48409,3,48392,1,0,1,
+48409,4,17,39919,28,0,1,
+48413,1,48411,1,
+48413,2,2,48409,1,
+48413,3,48411,3,0,1,
+48413,4,2,46445,6,0,1,
+48437,1,48435,1,
+48437,2,2,48433,1,
+48437,3,48435,7,0,1,
+48437,4,2,29367,16,0,1,
+48449,1,48446,1,
+48449,2,3,48444,1,
+48449,3,48446,3,0,1,
+48449,4,3,46270,2,0,1,
+48463,1,48458,1,
+48463,2,5,48462,1,
+48463,3,48458,5,0,1,
+48463,4,5,44000,5,0,1,
+48473,1,48470,1,
+48473,2,3,48472,1,
+48473,3,48470,7,0,1,
+48473,4,3,42834,4,0,1,
+48479,1,48472,1,
+48479,2,7,48478,1,
+48479,3,48472,9,0,1,
+48479,4,7,29312,2,0,1,
+48481,1,48464,1,
+48481,2,17,48478,1,
+48481,3,48464,2,0,1,
+48481,4,17,33727,17,0,1,
+48487,1,48482,1,
+48487,2,5,48486,1,
+48487,3,48482,1,0,1,
+48487,4,5,47077,8,0,1,
+48491,1,48489,1,
+48491,2,2,48487,1,
+48491,3,48489,3,0,1,
+48491,4,2,34981,7,0,1,
+48497,1,48494,1,
+48497,2,3,48492,1,
+48497,3,48494,3,0,1,
+48497,4,3,44812,0,0,1,
+48523,1,48520,1,
+48523,2,3,48522,1,
+48523,3,48520,4,0,1,
+48523,4,3,40596,5,0,1,
+48527,1,48522,1,
+48527,2,5,48525,1,
+48527,3,48522,3,0,1,
+48527,4,5,34075,8,0,1,
+48533,1,48531,1,
+48533,2,2,48529,1,
+48533,3,48531,7,0,1,
+48533,4,2,31450,9,0,1,
+48539,1,48537,1,
+48539,2,2,48535,1,
+48539,3,48537,2,0,1,
+48539,4,2,42777,8,0,1,
+48541,1,48539,1,
+48541,2,2,48540,1,
+48541,3,48539,5,0,1,
+48541,4,2,37897,7,0,1,
+48563,1,48561,1,
+48563,2,2,48557,1,
+48563,3,48561,5,0,1,
+48563,4,2,47832,0,0,1,
+48571,1,48569,1,
+48571,2,2,48570,1,
+48571,3,48569,6,0,1,
+48571,4,2,36188,7,0,1,
+48589,1,48579,1,
+48589,2,10,48588,1,
+48589,3,48579,10,0,1,
+48589,4,10,44652,3,0,1,
+48593,1,48590,1,
+48593,2,3,48587,1,
+48593,3,48590,4,0,1,
+48593,4,3,45796,17,0,1,
+48611,1,48609,1,
+48611,2,2,48610,1,
+48611,3,48609,7,0,1,
+48611,4,2,32878,12,0,1,
+48619,1,48617,1,
+48619,2,2,48613,1,
+48619,3,48617,4,0,1,
+48619,4,2,26111,3,0,1,
+48623,1,48618,1,
+48623,2,5,48615,1,
+48623,3,48618,3,0,1,
+48623,4,5,47859,3,0,1,
+48647,1,48642,1,
+48647,2,5,48642,1,
+48647,3,48642,6,0,1,
+48647,4,5,46056,6,0,1,
+48649,1,48642,1,
+48649,2,7,48640,1,
+48649,3,48642,2,0,1,
+48649,4,7,37237,2,0,1,
+48661,1,48659,1,
+48661,2,2,48657,1,
+48661,3,48659,7,0,1,
+48661,4,2,36619,6,0,1,
+48673,1,48658,1,
+48673,2,15,48668,1,
+48673,3,48658,2,0,1,
+48673,4,15,31069,0,0,1,
+48677,1,48675,1,
+48677,2,2,48676,1,
+48677,3,48675,3,0,1,
+48677,4,2,40064,4,0,1,
+48679,1,48676,1,
+48679,2,3,48677,1,
+48679,3,48676,4,0,1,
+48679,4,3,43172,6,0,1,
+48731,1,48725,1,
+48731,2,6,48730,1,
+48731,3,48725,1,0,1,
+48731,4,6,30965,4,0,1,
+48733,1,48731,1,
+48733,2,2,48729,1,
+48733,3,48731,6,0,1,
+48733,4,2,38665,6,0,1,
+48751,1,48748,1,
+48751,2,3,48749,1,
+48751,3,48748,1,0,1,
+48751,4,3,48747,4,0,1,
+48757,1,48755,1,
+48757,2,2,48753,1,
+48757,3,48755,5,0,1,
+48757,4,2,45082,12,0,1,
+48761,1,48758,1,
+48761,2,3,48756,1,
+48761,3,48758,4,0,1,
+48761,4,3,30253,2,0,1,
+48767,1,48762,1,
+48767,2,5,48766,1,
+48767,3,48762,3,0,1,
+48767,4,5,38128,7,0,1,
+48779,1,48777,1,
+48779,2,2,48775,1,
+48779,3,48777,11,0,1,
+48779,4,2,41865,7,0,1,
+48781,1,48775,1,
+48781,2,6,48780,1,
+48781,3,48775,1,0,1,
+48781,4,6,43730,7,0,1,
+48787,1,48785,1,
+48787,2,2,48783,1,
+48787,3,48785,5,0,1,
+48787,4,2,33906,8,0,1,
+48799,1,48796,1,
+48799,2,3,48797,1,
+48799,3,48796,6,0,1,
+48799,4,3,37818,6,0,1,
+48809,1,48806,1,
+48809,2,3,48803,1,
+48809,3,48806,3,0,1,
+48809,4,3,48797,0,0,1,
+48817,1,48812,1,
+48817,2,5,48814,1,
+48817,3,48812,1,0,1,
+48817,4,5,45035,16,0,1,
+48821,1,48819,1,
+48821,2,2,48820,1,
+48821,3,48819,5,0,1,
+48821,4,2,37862,4,0,1,
+48823,1,48818,1,
+48823,2,5,48822,1,
+48823,3,48818,2,0,1,
+48823,4,5,43255,2,0,1,
+48847,1,48844,1,
+48847,2,3,48846,1,
+48847,3,48844,4,0,1,
+48847,4,3,29183,5,0,1,
+48857,1,48854,1,
+48857,2,3,48851,1,
+48857,3,48854,5,0,1,
+48857,4,3,32875,9,0,1,
+48859,1,48857,1,
+48859,2,2,48855,1,
+48859,3,48857,4,0,1,
+48859,4,2,44505,1,0,1,
+48869,1,48867,1,
+48869,2,2,48864,1,
+48869,3,48867,7,0,1,
+48869,4,2,42699,8,0,1,
+48871,1,48868,1,
+48871,2,3,48869,1,
+48871,3,48868,6,0,1,
+48871,4,3,24728,6,0,1,
+48883,1,48881,1,
+48883,2,2,48879,1,
+48883,3,48881,4,0,1,
+48883,4,2,38356,8,0,1,
+48889,1,48855,1,
+48889,2,34,48872,1,
+48889,3,48855,2,0,1,
+48889,4,34,46792,34,0,1,
+48907,1,48905,1,
+48907,2,2,48906,1,
+48907,3,48905,2,0,1,
+48907,4,2,46136,7,0,1,
+48947,1,48945,1,
+48947,2,2,48946,1,
+48947,3,48945,2,0,1,
+48947,4,2,48940,8,0,1,
+48953,1,48950,1,
+48953,2,3,48948,1,
+48953,3,48950,4,0,1,
+48953,4,3,40344,2,0,1,
+48973,1,48968,1,
+48973,2,5,48972,1,
+48973,3,48968,8,0,1,
+48973,4,5,45963,6,0,1,
+48989,1,48987,1,
+48989,2,2,48988,1,
+48989,3,48987,3,0,1,
+48989,4,2,38762,3,0,1,
+48991,1,48985,1,
+48991,2,6,48989,1,
+48991,3,48985,3,0,1,
+48991,4,6,38716,3,0,1,
+49003,1,48990,1,
+49003,2,13,49000,1,
+49003,3,48990,2,0,1,
+49003,4,13,40738,4,0,1,
+49009,1,48990,1,
+49009,2,19,48996,1,
+49009,3,48990,6,0,1,
+49009,4,19,25010,32,0,1,
+49019,1,49017,1,
+49019,2,2,49015,1,
+49019,3,49017,3,0,1,
+49019,4,2,45449,9,0,1,
+49031,1,49018,1,
+49031,2,13,49022,1,
+49031,3,49018,2,0,1,
+49031,4,13,46127,13,0,1,
+49033,1,49023,1,
+49033,2,10,49030,1,
+49033,3,49023,5,0,1,
+49033,4,10,40636,8,0,1,
+49037,1,49035,1,
+49037,2,2,49033,1,
+49037,3,49035,3,0,1,
+49037,4,2,44789,18,0,1,
+49043,1,49041,1,
+49043,2,2,49039,1,
+49043,3,49041,3,0,1,
+49043,4,2,43188,8,0,1,
+49057,1,49052,1,
+49057,2,5,49056,1,
+49057,3,49052,1,0,1,
+49057,4,5,39309,6,0,1,
+49069,1,49067,1,
+49069,2,2,49068,1,
+49069,3,49067,4,0,1,
+49069,4,2,32044,7,0,1,
+49081,1,49070,1,
+49081,2,11,49080,1,
+49081,3,49070,2,0,1,
+49081,4,11,34628,12,0,1,
+49103,1,49098,1,
+49103,2,5,49098,1,
+49103,3,49098,9,0,1,
+49103,4,5,37207,11,0,1,
+49109,1,49107,1,
+49109,2,2,49105,1,
+49109,3,49107,5,0,1,
+49109,4,2,33641,7,0,1,
+49117,1,49115,1,
+49117,2,2,49116,1,
+49117,3,49115,6,0,1,
+49117,4,2,25424,9,0,1,
+49121,1,49118,1,
+49121,2,3,49120,1,
+49121,3,49118,3,0,1,
+49121,4,3,43733,4,0,1,
+49123,1,49121,1,
+49123,2,2,49119,1,
+49123,3,49121,4,0,1,
+49123,4,2,37322,17,0,1,
+49139,1,49137,1,
+49139,2,2,49138,1,
+49139,3,49137,3,0,1,
+49139,4,2,38377,4,0,1,
+49157,1,49155,1,
+49157,2,2,49152,1,
+49157,3,49155,7,0,1,
+49157,4,2,34802,12,0,1,
+49169,1,49166,1,
+49169,2,3,49168,1,
+49169,3,49166,1,0,1,
+49169,4,3,35300,4,0,1,
+49171,1,49169,1,
+49171,2,2,49170,1,
+49171,3,49169,4,0,1,
+49171,4,2,33733,2,0,1,
+49177,1,49172,1,
+49177,2,5,49174,1,
+49177,3,49172,1,0,1,
+49177,4,5,47757,16,0,1,
+49193,1,49190,1,
+49193,2,3,49186,1,
+49193,3,49190,12,0,1,
+49193,4,3,46513,1,0,1,
+49199,1,49186,1,
+49199,2,13,49196,1,
+49199,3,49186,2,0,1,
+49199,4,13,45713,4,0,1,
+49201,1,49194,1,
+49201,2,7,49198,1,
+49201,3,49194,3,0,1,
+49201,4,7,33068,24,0,1,
+49207,1,49204,1,
+49207,2,3,49205,1,
+49207,3,49204,5,0,1,
+49207,4,3,45887,6,0,1,
+49211,1,49209,1,
+49211,2,2,49207,1,
+49211,3,49209,3,0,1,
+49211,4,2,32254,7,0,1,
+49223,1,49218,1,
+49223,2,5,49222,1,
+49223,3,49218,3,0,1,
+49223,4,5,38606,2,0,1,
+49253,1,49251,1,
+49253,2,2,49249,1,
+49253,3,49251,3,0,1,
+49253,4,2,43835,12,0,1,
+49261,1,49259,1,
+49261,2,2,49257,1,
+49261,3,49259,2,0,1,
+49261,4,2,46480,6,0,1,
+49277,1,49275,1,
+49277,2,2,49273,1,
+49277,3,49275,3,0,1,
+49277,4,2,26712,6,0,1,
+49279,1,49276,1,
+49279,2,3,49272,1,
+49279,3,49276,3,0,1,
+49279,4,3,43012,9,0,1,
+49297,1,49292,1,
+49297,2,5,49294,1,
+49297,3,49292,1,0,1,
+49297,4,5,36111,10,0,1,
+49307,1,49305,1,
+49307,2,2,49293,1,
+49307,3,49305,3,0,1,
+49307,4,2,45416,0,0,1,
+49331,1,49329,1,
+49331,2,2,49327,1,
+49331,3,49329,2,0,1,
+49331,4,2,39900,8,0,1,
+49333,1,49331,1,
+49333,2,2,49329,1,
+49333,3,49331,6,0,1,
+49333,4,2,28444,12,0,1,
+49339,1,49328,1,
+49339,2,11,49330,1,
+49339,3,49328,1,0,1,
+49339,4,11,43354,6,0,1,
+49363,1,49361,1,
+49363,2,2,49362,1,
+49363,3,49361,2,0,1,
+49363,4,2,44925,2,0,1,
+49367,1,49362,1,
+49367,2,5,49365,1,
+49367,3,49362,6,0,1,
+49367,4,5,39079,8,0,1,
+49369,1,49356,1,
+49369,2,13,49366,1,
+49369,3,49356,1,0,1,
+49369,4,13,44953,10,0,1,
+49391,1,49380,1,
+49391,2,11,49390,1,
+49391,3,49380,1,0,1,
+49391,4,11,28511,2,0,1,
+49393,1,49388,1,
+49393,2,5,49392,1,
+49393,3,49388,2,0,1,
+49393,4,5,25335,11,0,1,
+49409,1,49406,1,
+49409,2,3,49403,1,
+49409,3,49406,1,0,1,
+49409,4,3,49397,0,0,1,
+49411,1,49409,1,
+49411,2,2,49410,1,
+49411,3,49409,4,0,1,
+49411,4,2,43356,10,0,1,
+49417,1,49412,1,
+49417,2,5,49412,1,
+49417,3,49412,1,0,1,
+49417,4,5,38659,15,0,1,
+49429,1,49427,1,
+49429,2,2,49425,1,
+49429,3,49427,4,0,1,
+49429,4,2,27773,6,0,1,
+49433,1,49430,1,
+49433,2,3,49427,1,
+49433,3,49430,1,0,1,
+49433,4,3,26127,13,0,1,
+49451,1,49441,1,
+49451,2,10,49450,1,
+49451,3,49441,5,0,1,
+49451,4,10,28037,8,0,1,
+49459,1,49456,1,
+49459,2,3,49451,1,
+49459,3,49456,5,0,1,
+49459,4,3,30359,0,0,1,
+49463,1,49458,1,
+49463,2,5,49461,1,
+49463,3,49458,3,0,1,
+49463,4,5,32467,8,0,1,
+49477,1,49466,1,
+49477,2,11,49476,1,
+49477,3,49466,1,0,1,
+49477,4,11,33940,3,0,1,
+49481,1,49478,1,
+49481,2,3,49475,1,
+49481,3,49478,1,0,1,
+49481,4,3,49469,0,0,1,
+49499,1,49497,1,
+49499,2,2,49495,1,
+49499,3,49497,3,0,1,
+49499,4,2,27389,7,0,1,
+49523,1,49521,1,
+49523,2,2,49522,1,
+49523,3,49521,2,0,1,
+49523,4,2,44113,2,0,1,
+49529,1,49526,1,
+49529,2,3,49528,1,
+49529,3,49526,5,0,1,
+49529,4,3,44829,7,0,1,
+49531,1,49521,1,
+49531,2,10,49529,1,
+49531,3,49521,5,0,1,
+49531,4,10,49513,11,0,1,
+49537,1,49527,1,
+49537,2,10,49536,1,
+49537,3,49527,2,0,1,
+49537,4,10,31783,16,0,1,
+49547,1,49545,1,
+49547,2,2,49543,1,
+49547,3,49545,3,0,1,
+49547,4,2,27116,7,0,1,
+49549,1,49543,1,
+49549,2,6,49548,1,
+49549,3,49543,4,0,1,
+49549,4,6,48251,7,0,1,
+49559,1,49548,1,
+49559,2,11,49557,1,
+49559,3,49548,7,0,1,
+49559,4,11,33849,9,0,1,
+49597,1,49592,1,
+49597,2,5,49592,1,
+49597,3,49592,2,0,1,
+49597,4,5,40614,11,0,1,
+49603,1,49600,1,
+49603,2,3,49598,1,
+49603,3,49600,1,0,1,
+49603,4,3,29825,3,0,1,
+49613,1,49611,1,
+49613,2,2,49609,1,
+49613,3,49611,3,0,1,
+49613,4,2,48353,6,0,1,
+49627,1,49624,1,
+49627,2,3,49626,1,
+49627,3,49624,4,0,1,
+49627,4,3,30852,5,0,1,
+49633,1,49628,1,
+49633,2,5,49628,1,
+49633,3,49628,5,0,1,
+49633,4,5,27663,10,0,1,
+49639,1,49636,1,
+49639,2,3,49637,1,
+49639,3,49636,13,0,1,
+49639,4,3,32045,6,0,1,
+49663,1,49660,1,
+49663,2,3,49661,1,
+49663,3,49660,1,0,1,
+49663,4,3,49659,4,0,1,
+49667,1,49665,1,
+49667,2,2,49663,1,
+49667,3,49665,3,0,1,
+49667,4,2,35014,8,0,1,
+49669,1,49667,1,
+49669,2,2,49665,1,
+49669,3,49667,2,0,1,
+49669,4,2,40306,6,0,1,
+49681,1,49664,1,
+49681,2,17,49680,1,
+49681,3,49664,2,0,1,
+49681,4,17,26405,14,0,1,
+49697,1,49694,1,
+49697,2,3,49692,1,
+49697,3,49694,4,0,1,
+49697,4,3,32921,0,0,1,
+49711,1,49704,1,
+49711,2,7,49702,1,
+49711,3,49704,1,0,1,
+49711,4,7,28138,10,0,1,
+49727,1,49722,1,
+49727,2,5,49725,1,
+49727,3,49722,1,0,1,
+49727,4,5,49723,3,0,1,
+49739,1,49737,1,
+49739,2,2,49732,1,
+49739,3,49737,3,0,1,
+49739,4,2,44053,1,0,1,
+49741,1,49739,1,
+49741,2,2,49740,1,
+49741,3,49739,5,0,1,
+49741,4,2,48212,3,0,1,
+49747,1,49744,1,
+49747,2,3,49740,1,
+49747,3,49744,4,0,1,
+49747,4,3,34505,5,0,1,
+49757,1,49755,1,
+49757,2,2,49753,1,
+49757,3,49755,3,0,1,
+49757,4,2,29424,7,0,1,
+49783,1,49780,1,
+49783,2,3,49782,1,
+49783,3,49780,13,0,1,
+49783,4,3,40233,5,0,1,
+49787,1,49785,1,
+49787,2,2,49783,1,
+49787,3,49785,2,0,1,
+49787,4,2,45577,13,0,1,
+49789,1,49783,1,
+49789,2,6,49788,1,
+49789,3,49783,8,0,1,
+49789,4,6,25766,11,0,1,
+49801,1,49788,1,
+49801,2,13,49798,1,
+49801,3,49788,1,0,1,
+49801,4,13,31480,10,0,1,
+49807,1,49804,1,
+49807,2,3,49806,1,
+49807,3,49804,4,0,1,
+49807,4,3,32124,14,0,1,
+49811,1,49805,1,
+49811,2,6,49809,1,
+49811,3,49805,1,0,1,
+49811,4,6,34569,5,0,1,
+49823,1,49818,1,
+49823,2,5,49818,1,
+49823,3,49818,1,0,1,
+49823,4,5,28121,8,0,1,
+49831,1,49819,1,
+49831,2,12,49830,1,
+49831,3,49819,1,0,1,
+49831,4,12,28689,3,0,1,
+49843,1,49841,1,
+49843,2,2,49842,1,
+49843,3,49841,6,0,1,
+49843,4,2,26448,7,0,1,
+49853,1,49851,1,
+49853,2,2,49852,1,
+49853,3,49851,2,0,1,
+49853,4,2,27228,4,0,1,
+49871,1,49854,1,
+49871,2,17,49869,1,
+49871,3,49854,1,0,1,
+49871,4,17,49863,3,0,1,
+49877,1,49875,1,
+49877,2,2,49873,1,
+49877,3,49875,7,0,1,
+49877,4,2,37283,7,0,1,
+49891,1,49889,1,
+49891,2,2,49887,1,
+49891,3,49889,2,0,1,
+49891,4,2,38705,8,0,1,
+49919,1,49912,1,
+49919,2,7,49918,1,
+49919,3,49912,1,0,1,
+49919,4,7,38692,3,0,1,
+49921,1,49898,1,
+49921,2,23,49917,1,
+49921,3,49898,2,0,1,
+49921,4,23,49883,23,0,1,
+49927,1,49924,1,
+49927,2,3,49925,1,
+49927,3,49924,1,0,1,
+49927,4,3,49919,10,0,1,
+49937,1,49934,1,
+49937,2,3,49931,1,
+49937,3,49934,1,0,1,
+49937,4,3,39765,1,0,1,
+49939,1,49932,1,
+49939,2,7,49937,1,
+49939,3,49932,3,0,1,
+49939,4,7,45043,6,0,1,
+49943,1,49938,1,
+49943,2,5,49941,1,
+49943,3,49938,7,0,1,
+49943,4,5,49939,3,0,1,
+49957,1,49952,1,
+49957,2,5,49954,1,
+49957,3,49952,2,0,1,
+49957,4,5,38964,9,0,1,
+49991,1,49984,1,
+49991,2,7,49990,1,
+49991,3,49984,11,0,1,
+49991,4,7,34536,2,0,1,
+49993,1,49988,1,
+49993,2,5,49988,1,
+49993,3,49988,1,0,1,
+49993,4,5,36062,18,0,1,
+49999,1,49996,1,
+49999,2,3,49993,1,
+49999,3,49996,5,0,1,
+49999,4,3,36978,13,0,1,
+50021,1,50019,1,
+50021,2,2,50020,1,
+50021,3,50019,5,0,1,
+50021,4,2,50014,8,0,1,
+50023,1,50020,1,
+50023,2,3,50022,1,
+50023,3,50020,3,0,1,
+50023,4,3,39725,5,0,1,
+50033,1,50028,1,
+50033,2,5,50026,1,
+50033,3,50028,3,0,1,
+50033,4,5,35784,4,0,1,
+50047,1,50041,1,
+50047,2,6,50046,1,
+50047,3,50041,4,0,1,
+50047,4,6,39163,10,0,1,
+50051,1,50049,1,
+50051,2,2,50046,1,
+50051,3,50049,2,0,1,
+50051,4,2,27862,3,0,1,
+50053,1,50051,1,
+50053,2,2,50052,1,
+50053,3,50051,2,0,1,
+50053,4,2,37338,6,0,1,
+50069,1,50067,1,
+50069,2,2,50068,1,
+50069,3,50067,3,0,1,
+50069,4,2,34473,3,0,1,
+50077,1,50075,1,
+50077,2,2,50076,1,
+50077,3,50075,6,0,1,
+50077,4,2,45399,6,0,1,
+50087,1,50082,1,
+50087,2,5,50086,1,
+50087,3,50082,5,0,1,
+50087,4,5,40006,3,0,1,
+50093,1,50091,1,
+50093,2,2,50088,1,
+50093,3,50091,3,0,1,
+50093,4,2,33148,8,0,1,
+50101,1,50099,1,
+50101,2,2,50097,1,
+50101,3,50099,4,0,1,
+50101,4,2,49294,12,0,1,
+50111,1,50094,1,
+50111,2,17,50109,1,
+50111,3,50094,4,0,1,
+50111,4,17,50103,3,0,1,
+50119,1,50116,1,
+50119,2,3,50117,1,
+50119,3,50116,1,0,1,
+50119,4,3,50115,4,0,1,
+50123,1,50121,1,
+50123,2,2,50122,1,
+50123,3,50121,4,0,1,
+50123,4,2,29841,10,0,1,
+50129,1,50126,1,
+50129,2,3,50128,1,
+50129,3,50126,1,0,1,
+50129,4,3,43702,4,0,1,
+50131,1,50129,1,
+50131,2,2,50127,1,
+50131,3,50129,2,0,1,
+50131,4,2,32113,8,0,1,
+50147,1,50145,1,
+50147,2,2,50146,1,
+50147,3,50145,10,0,1,
+50147,4,2,29812,10,0,1,
+50153,1,50150,1,
+50153,2,3,50147,1,
+50153,3,50150,11,0,1,
+50153,4,3,39996,9,0,1,
+50159,1,50152,1,
+50159,2,7,50158,1,
+50159,3,50152,1,0,1,
+50159,4,7,45366,2,0,1,
+50177,1,50174,1,
+50177,2,3,50176,1,
+50177,3,50174,4,0,1,
+50177,4,3,26300,6,0,1,
+50207,1,50202,1,
+50207,2,5,50205,1,
+50207,3,50202,1,0,1,
+50207,4,5,37343,16,0,1,
+50221,1,50208,1,
+50221,2,13,50220,1,
+50221,3,50208,3,0,1,
+50221,4,13,45023,7,0,1,
+50227,1,50225,1,
+50227,2,2,50223,1,
+50227,3,50225,6,0,1,
+50227,4,2,37029,8,0,1,
+50231,1,50220,1,
+50231,2,11,50228,1,
+50231,3,50220,2,0,1,
+50231,4,11,27812,8,0,1,
+50261,1,50258,1,
+50261,2,3,50259,1,
+50261,3,50258,7,0,1,
+50261,4,3,50253,10,0,1,
+50263,1,50260,1,
+50263,2,3,50261,1,
+50263,3,50260,1,0,1,
+50263,4,3,48726,3,0,1,
+50273,1,50270,1,
+50273,2,3,50267,1,
+50273,3,50270,3,0,1,
+50273,4,3,41061,1,0,1,
+50287,1,50284,1,
+50287,2,3,50286,1,
+50287,3,50284,3,0,1,
+50287,4,3,45318,5,0,1,
+50291,1,50289,1,
+50291,2,2,50290,1,
+50291,3,50289,3,0,1,
+50291,4,2,43956,2,0,1,
+50311,1,50308,1,
+50311,2,3,50310,1,
+50311,3,50308,3,0,1,
+50311,4,3,25819,2,0,1,
+50321,1,50315,1,
+50321,2,6,50312,1,
+50321,3,50315,2,0,1,
+50321,4,6,49819,2,0,1,
+50329,1,50322,1,
+50329,2,7,50322,1,
+50329,3,50322,7,0,1,
+50329,4,7,47892,0,0,1,
+50333,1,50331,1,
+50333,2,2,50332,1,
+50333,3,50331,3,0,1,
+50333,4,2,31976,3,0,1,
+50341,1,50339,1,
+50341,2,2,50337,1,
+50341,3,50339,2,0,1,
+50341,4,2,42673,12,0,1,
+50359,1,50356,1,
+50359,2,3,50357,1,
+50359,3,50356,1,0,1,
+50359,4,3,50355,4,0,1,
+50363,1,50361,1,
+50363,2,2,50362,1,
+50363,3,50361,2,0,1,
+50363,4,2,34649,2,0,1,
+50377,1,50372,1,
+50377,2,5,50376,1,
+50377,3,50372,1,0,1,
+50377,4,5,44870,6,0,1,
+50383,1,50380,1,
+50383,2,3,50381,1,
+50383,3,50380,1,0,1,
+50383,4,3,32021,3,0,1,
+50387,1,50385,1,
+50387,2,2,50381,1,
+50387,3,50385,4,0,1,
+50387,4,2,30105,4,0,1,
+50411,1,50409,1,
+50411,2,2,50406,1,
+50411,3,50409,4,0,1,
+50411,4,2,49861,3,0,1,
+50417,1,50414,1,
+50417,2,3,50411,1,
+50417,3,50414,5,0,1,
+50417,4,3,47117,9,0,1,
+50423,1,50418,1,
+50423,2,5,50421,1,
+50423,3,50418,2,0,1,
+50423,4,5,37270,8,0,1,
+50441,1,50435,1,
+50441,2,6,50431,1,
+50441,3,50435,2,0,1,
+50441,4,6,25866,3,0,1,
+50459,1,50457,1,
+50459,2,2,50458,1,
+50459,3,50457,3,0,1,
+50459,4,2,42533,4,0,1,
+50461,1,50454,1,
+50461,2,7,50459,1,
+50461,3,50454,1,0,1,
+50461,4,7,41484,15,0,1,
+50497,1,50492,1,
+50497,2,5,50496,1,
+50497,3,50492,2,0,1,
+50497,4,5,36424,6,0,1,
+50503,1,50498,1,
+50503,2,5,50501,1,
+50503,3,50498,2,0,1,
+50503,4,5,34429,10,0,1,
+50513,1,50510,1,
+50513,2,3,50508,1,
+50513,3,50510,3,0,1,
+50513,4,3,30427,0,0,1,
+50527,1,50524,1,
+50527,2,3,50525,1,
+50527,3,50524,1,0,1,
+50527,4,3,50519,10,0,1,
+50539,1,50537,1,
+50539,2,2,50535,1,
+50539,3,50537,5,0,1,
+50539,4,2,38391,1,0,1,
+50543,1,50538,1,
+50543,2,5,50542,1,
+50543,3,50538,5,0,1,
+50543,4,5,35497,2,0,1,
+50549,1,50547,1,
+50549,2,2,50541,1,
+50549,3,50547,8,0,1,
+50549,4,2,27326,0,0,1,
+50551,1,50548,1,
+50551,2,3,50550,1,
+50551,3,50548,4,0,1,
+50551,4,3,50233,3,0,1,
+50581,1,50579,1,
+50581,2,2,50580,1,
+50581,3,50579,4,0,1,
+50581,4,2,39499,9,0,1,
+50587,1,50573,1,
+50587,2,14,50586,1,
+50587,3,50573,6,0,1,
+50587,4,14,41596,2,0,1,
+50591,1,50584,1,
+50591,2,7,50589,1,
+50591,3,50584,1,0,1,
+50591,4,7,34087,5,0,1,
+50593,1,50588,1,
+50593,2,5,50592,1,
+50593,3,50588,5,0,1,
+50593,4,5,26449,11,0,1,
+50599,1,50596,1,
+50599,2,3,50598,1,
+50599,3,50596,3,0,1,
+50599,4,3,41000,3,0,1,
+50627,1,50625,1,
+50627,2,2,50623,1,
+50627,3,50625,2,0,1,
+50627,4,2,25979,16,0,1,
+50647,1,50644,1,
+50647,2,3,50645,1,
+50647,3,50644,5,0,1,
+50647,4,3,26551,3,0,1,
+50651,1,50649,1,
+50651,2,2,50650,1,
+50651,3,50649,3,0,1,
+50651,4,2,41952,2,0,1,
+50671,1,50660,1,
+50671,2,11,50669,1,
+50671,3,50660,1,0,1,
+50671,4,11,26891,3,0,1,
+50683,1,50681,1,
+50683,2,2,50682,1,
+50683,3,50681,2,0,1,
+50683,4,2,50676,8,0,1,
+50707,1,50704,1,
+50707,2,3,50706,1,
+50707,3,50704,1,0,1,
+50707,4,3,45182,2,0,1,
+50723,1,50721,1,
+50723,2,2,50718,1,
+50723,3,50721,5,0,1,
+50723,4,2,49068,6,0,1,
+50741,1,50739,1,
+50741,2,2,50740,1,
+50741,3,50739,7,0,1,
+50741,4,2,28510,4,0,1,
+50753,1,50750,1,
+50753,2,3,50752,1,
+50753,3,50750,1,0,1,
+50753,4,3,39774,7,0,1,
+50767,1,50762,1,
+50767,2,5,50766,1,
+50767,3,50762,10,0,1,
+50767,4,5,38749,12,0,1,
+50773,1,50762,1,
+50773,2,11,50772,1,
+50773,3,50762,1,0,1,
+50773,4,11,27150,3,0,1,
+50777,1,50774,1,
+50777,2,3,50771,1,
+50777,3,50774,5,0,1,
+50777,4,3,36989,12,0,1,
+50789,1,50787,1,
+50789,2,2,50785,1,
+50789,3,50787,2,0,1,
+50789,4,2,40054,6,0,1,
+50821,1,50819,1,
+50821,2,2,50817,1,
+50821,3,50819,4,0,1,
+50821,4,2,41439,10,0,1,
+50833,1,50826,1,
+50833,2,7,50826,1,
+50833,3,50826,7,0,1,
+50833,4,7,30908,12,0,1,
+50839,1,50836,1,
+50839,2,3,50838,1,
+50839,3,50836,3,0,1,
+50839,4,3,30653,2,0,1,
+50849,1,50846,1,
+50849,2,3,50844,1,
+50849,3,50846,7,0,1,
+50849,4,3,48200,2,0,1,
+50857,1,50838,1,
+50857,2,19,50853,1,
+50857,3,50838,7,0,1,
+50857,4,19,32990,9,0,1,
+50867,1,50865,1,
+50867,2,2,50866,1,
+50867,3,50865,2,0,1,
+50867,4,2,40928,2,0,1,
+50873,1,50870,1,
+50873,2,3,50866,1,
+50873,3,50870,5,0,1,
+50873,4,3,29597,1,0,1,
+50891,1,50889,1,
+50891,2,2,50885,1,
+50891,3,50889,9,0,1,
+50891,4,2,47150,4,0,1,
+50893,1,50891,1,
+50893,2,2,50892,1,
+50893,3,50891,2,0,1,
+50893,4,2,43160,3,0,1,
+50909,1,50907,1,
+50909,2,2,50908,1,
+50909,3,50907,3,0,1,
+50909,4,2,50902,8,0,1,
+50923,1,50921,1,
+50923,2,2,50922,1,
+50923,3,50921,2,0,1,
+50923,4,2,31950,7,0,1,
+50929,1,50918,1,
+50929,2,11,50920,1,
+50929,3,50918,2,0,1,
+50929,4,11,42833,20,0,1,
+50951,1,50928,1,
+50951,2,23,50947,1,
+50951,3,50928,1,0,1,
+50951,4,23,44911,13,0,1,
+50957,1,50955,1,
+50957,2,2,50953,1,
+50957,3,50955,3,0,1,
+50957,4,2,44272,12,0,1,
+50969,1,50966,1,
+50969,2,3,50963,1,
+50969,3,50966,1,0,1,
+50969,4,3,50957,0,0,1,
+50971,1,50969,1,
+50971,2,2,50967,1,
+50971,3,50969,2,0,1,
+50971,4,2,50580,8,0,1,
+50989,1,50987,1,
+50989,2,2,50985,1,
+50989,3,50987,5,0,1,
+50989,4,2,41764,6,0,1,
+50993,1,50990,1,
+50993,2,3,50992,1,
+50993,3,50990,3,0,1,
+50993,4,3,29297,4,0,1,
+51001,1,50994,1,
+51001,2,7,50994,1,
+51001,3,50994,3,0,1,
+51001,4,7,30917,0,0,1,
+51031,1,51028,1,
+51031,2,3,51030,1,
+51031,3,51028,4,0,1,
+51031,4,3,29818,2,0,1,
+51043,1,51041,1,
+51043,2,2,51042,1,
+51043,3,51041,2,0,1,
+51043,4,2,30270,2,0,1,
+51047,1,51042,1,
+51047,2,5,51046,1,
+51047,3,51042,18,0,1,
+51047,4,5,43008,2,0,1,
+51059,1,51057,1,
+51059,2,2,51055,1,
+51059,3,51057,3,0,1,
+51059,4,2,43363,7,0,1,
+51061,1,51059,1,
+51061,2,2,51060,1,
+51061,3,51059,5,0,1,
+51061,4,2,42845,3,0,1,
+51071,1,51060,1,
+51071,2,11,51070,1,
+51071,3,51060,4,0,1,
+51071,4,11,33195,4,0,1,
+51109,1,51099,1,
+51109,2,10,51108,1,
+51109,3,51099,3,0,1,
+51109,4,10,39597,14,0,1,
+51131,1,51125,1,
+51131,2,6,51129,1,
+51131,3,51125,3,0,1,
+51131,4,6,31172,5,0,1,
+51133,1,51131,1,
+51133,2,2,51132,1,
+51133,3,51131,2,0,1,
+51133,4,2,36778,6,0,1,
+51137,1,51134,1,
+51137,2,3,51129,1,
+51137,3,51134,3,0,1,
+51137,4,3,35927,2,0,1,
+51151,1,51148,1,
+51151,2,3,51149,1,
+51151,3,51148,3,0,1,
+51151,4,3,36445,3,0,1,
+51157,1,51152,1,
+51157,2,5,51154,1,
+51157,3,51152,3,0,1,
+51157,4,5,47246,1,0,1,
+51169,1,51155,1,
+51169,2,14,51166,1,
+51169,3,51155,1,0,1,
+51169,4,14,43076,10,0,1,
+51193,1,51188,1,
+51193,2,5,51190,1,
+51193,3,51188,2,0,1,
+51193,4,5,47089,32,0,1,
+51197,1,51195,1,
+51197,2,2,51187,1,
+51197,3,51195,8,0,1,
+51197,4,2,30959,3,0,1,
+51199,1,51187,1,
+51199,2,12,51189,1,
+51199,3,51187,3,0,1,
+51199,4,12,33515,3,0,1,
+51203,1,51201,1,
+51203,2,2,51199,1,
+51203,3,51201,2,0,1,
+51203,4,2,50563,7,0,1,
+51217,1,51212,1,
+51217,2,5,51216,1,
+51217,3,51212,11,0,1,
+51217,4,5,38869,6,0,1,
+51229,1,51227,1,
+51229,2,2,51228,1,
+51229,3,51227,6,0,1,
+51229,4,2,36253,3,0,1,
+51239,1,51216,1,
+51239,2,23,51233,1,
+51239,3,51216,1,0,1,
+51239,4,23,37381,13,0,1,
+51241,1,51224,1,
+51241,2,17,51240,1,
+51241,3,51224,1,0,1,
+51241,4,17,41348,18,0,1,
+51257,1,51254,1,
+51257,2,3,51256,1,
+51257,3,51254,3,0,1,
+51257,4,3,30626,4,0,1,
+51263,1,51258,1,
+51263,2,5,51261,1,
+51263,3,51258,1,0,1,
+51263,4,5,34676,5,0,1,
+51283,1,51281,1,
+51283,2,2,51279,1,
+51283,3,51281,5,0,1,
+51283,4,2,46692,8,0,1,
+51287,1,51282,1,
+51287,2,5,51285,1,
+51287,3,51282,1,0,1,
+51287,4,5,51283,3,0,1,
+51307,1,51302,1,
+51307,2,5,51305,1,
+51307,3,51302,6,0,1,
+51307,4,5,51303,3,0,1,
+51329,1,51326,1,
+51329,2,3,51324,1,
+51329,3,51326,1,0,1,
+51329,4,3,28338,2,0,1,
+51341,1,51339,1,
+51341,2,2,51340,1,
+51341,3,51339,3,0,1,
+51341,4,2,51334,8,0,1,
+51343,1,51338,1,
+51343,2,5,51341,1,
+51343,3,51338,3,0,1,
+51343,4,5,51331,11,0,1,
+51347,1,51345,1,
+51347,2,2,51343,1,
+51347,3,51345,3,0,1,
+51347,4,2,37882,8,0,1,
+51349,1,51339,1,
+51349,2,10,51346,1,
+51349,3,51339,6,0,1,
+51349,4,10,29555,9,0,1,
+51361,1,51324,1,
+51361,2,37,51358,1,
+51361,3,51324,1,0,1,
+51361,4,37,36924,32,0,1,
+51383,1,51378,1,
+51383,2,5,51381,1,
+51383,3,51378,2,0,1,
+51383,4,5,51379,3,0,1,
+51407,1,51402,1,
+51407,2,5,51406,1,
+51407,3,51402,2,0,1,
+51407,4,5,50690,2,0,1,
+51413,1,51411,1,
+51413,2,2,51412,1,
+51413,3,51411,4,0,1,
+51413,4,2,47171,3,0,1,
+51419,1,51417,1,
+51419,2,2,51415,1,
+51419,3,51417,2,0,1,
+51419,4,2,48935,7,0,1,
+51421,1,51419,1,
+51421,2,2,51420,1,
+51421,3,51419,4,0,1,
+51421,4,2,46584,3,0,1,
+51427,1,51425,1,
+51427,2,2,51426,1,
+51427,3,51425,2,0,1,
+51427,4,2,33403,32,0,1,
+51431,1,51424,1,
+51431,2,7,51430,1,
+51431,3,51424,2,0,1,
+51431,4,7,47569,3,0,1,
+51437,1,51435,1,
+51437,2,2,51432,1,
+51437,3,51435,4,0,1,
+51437,4,2,50502,17,0,1,
+51439,1,51436,1,
+51439,2,3,51433,1,
+51439,3,51436,6,0,1,
+51439,4,3,30174,7,0,1,
+51449,1,51446,1,
+51449,2,3,51444,1,
+51449,3,51446,3,0,1,
+51449,4,3,30638,2,0,1,
+51461,1,51459,1,
+51461,2,2,51457,1,
+51461,3,51459,3,0,1,
+51461,4,2,37625,7,0,1,
+51473,1,51470,1,
+51473,2,3,51467,1,
+51473,3,51470,3,0,1,
+51473,4,3,35766,16,0,1,
+51479,1,51472,1,
+51479,2,7,51477,1,
+51479,3,51472,1,0,1,
+51479,4,7,28324,12,0,1,
+51481,1,51464,1,
+51481,2,17,51478,1,
+51481,3,51464,6,0,1,
+51481,4,17,36296,17,0,1,
+51487,1,51484,1,
+51487,2,3,51486,1,
+51487,3,51484,8,0,1,
+51487,4,3,39036,5,0,1,
+51503,1,51498,1,
+51503,2,5,51502,1,
+51503,3,51498,1,0,1,
+51503,4,5,27446,3,0,1,
+51511,1,51505,1,
+51511,2,6,51510,1,
+51511,3,51505,3,0,1,
+51511,4,6,34580,3,0,1,
+51517,1,51511,1,
+51517,2,6,51516,1,
+51517,3,51511,3,0,1,
+51517,4,6,45268,6,0,1,
+51521,1,51518,1,
+51521,2,3,51520,1,
+51521,3,51518,1,0,1,
+51521,4,3,45198,4,0,1,
+51539,1,51537,1,
+51539,2,2,51538,1,
+51539,3,51537,3,0,1,
+51539,4,2,42061,2,0,1,
+51551,1,51540,1,
+51551,2,11,51549,1,
+51551,3,51540,1,0,1,
+51551,4,11,36288,7,0,1,
+51563,1,51561,1,
+51563,2,2,51559,1,
+51563,3,51561,3,0,1,
+51563,4,2,33015,8,0,1,
+51577,1,51567,1,
+51577,2,10,51576,1,
+51577,3,51567,5,0,1,
+51577,4,10,47092,6,0,1,
+51581,1,51579,1,
+51581,2,2,51577,1,
+51581,3,51579,3,0,1,
+51581,4,2,44285,1,0,1,
+51593,1,51590,1,
+51593,2,3,51586,1,
+51593,3,51590,4,0,1,
+51593,4,3,27603,2,0,1,
+51599,1,51592,1,
+51599,2,7,51598,1,
+51599,3,51592,7,0,1,
+51599,4,7,44072,2,0,1,
+51607,1,51604,1,
+51607,2,3,51606,1,
+51607,3,51604,3,0,1,
+51607,4,3,32990,8,0,1,
+51613,1,51611,1,
+51613,2,2,51609,1,
+51613,3,51611,6,0,1,
+51613,4,2,26327,10,0,1,
+51631,1,51616,1,
+51631,2,15,51629,1,
+51631,3,51616,7,0,1,
+51631,4,15,39763,3,0,1,
+51637,1,51632,1,
+51637,2,5,51636,1,
+51637,3,51632,7,0,1,
+51637,4,5,50571,19,0,1,
+51647,1,51640,1,
+51647,2,7,51645,1,
+51647,3,51640,1,0,1,
+51647,4,7,30770,6,0,1,
+51659,1,51657,1,
+51659,2,2,51649,1,
+51659,3,51657,10,0,1,
+51659,4,2,35307,0,0,1,
+51673,1,51666,1,
+51673,2,7,51670,1,
+51673,3,51666,1,0,1,
+51673,4,7,39291,10,0,1,
+51679,1,51673,1,
+51679,2,6,51678,1,
+51679,3,51673,3,0,1,
+51679,4,6,30497,3,0,1,
+51683,1,51681,1,
+51683,2,2,51679,1,
+51683,3,51681,3,0,1,
+51683,4,2,41425,7,0,1,
+51691,1,51681,1,
+51691,2,10,51689,1,
+51691,3,51681,5,0,1,
+51691,4,10,34612,0,0,1,
+51713,1,51710,1,
+51713,2,3,51706,1,
+51713,3,51710,12,0,1,
+51713,4,3,42691,1,0,1,
+51719,1,51706,1,
+51719,2,13,51717,1,
+51719,3,51706,3,0,1,
+51719,4,13,35614,7,0,1,
+51721,1,51714,1,
+51721,2,7,51718,1,
+51721,3,51714,3,0,1,
+51721,4,7,47016,26,0,1,
+51749,1,51747,1,
+51749,2,2,51745,1,
+51749,3,51747,3,0,1,
+51749,4,2,33772,1,0,1,
+51767,1,51762,1,
+51767,2,5,51762,1,
+51767,3,51762,3,0,1,
+51767,4,5,39984,6,0,1,
+51769,1,51750,1,
+51769,2,19,51766,1,
+51769,3,51750,1,0,1,
+51769,4,19,28683,26,0,1,
+51787,1,51784,1,
+51787,2,3,51786,1,
+51787,3,51784,5,0,1,
+51787,4,3,41309,5,0,1,
+51797,1,51794,1,
+51797,2,3,51795,1,
+51797,3,51794,1,0,1,
+51797,4,3,34746,7,0,1,
+51803,1,51801,1,
+51803,2,2,51802,1,
+51803,3,51801,3,0,1,
+51803,4,2,41067,4,0,1,
+51817,1,51807,1,
+51817,2,10,51812,1,
+51817,3,51807,4,0,1,
+51817,4,10,29040,0,0,1,
+51827,1,51825,1,
+51827,2,2,51823,1,
+51827,3,51825,3,0,1,
+51827,4,2,34212,7,0,1,
+51829,1,51827,1,
+51829,2,2,51825,1,
+51829,3,51827,2,0,1,
+51829,4,2,51320,12,0,1,
+51839,1,51832,1,
+51839,2,7,51838,1,
+51839,3,51832,1,0,1,
+51839,4,7,27888,2,0,1,
+51853,1,51842,1,
+51853,2,11,51850,1,
+51853,3,51842,8,0,1,
+51853,4,11,45646,5,0,1,
+51859,1,51856,1,
+51859,2,3,51851,1,
+51859,3,51856,1,0,1,
+51859,4,3,41790,0,0,1,
+51869,1,51867,1,
+51869,2,2,51857,1,
+51869,3,51867,8,0,1,
+51869,4,2,44581,4,0,1,
+51871,1,51864,1,
+51871,2,7,51859,1,
+51871,3,51864,2,0,1,
+51871,4,7,35005,0,0,1,
+51893,1,51891,1,
+51893,2,2,51886,1,
+51893,3,51891,18,0,1,
+51893,4,2,31509,2,0,1,
+51899,1,51897,1,
+51899,2,2,51895,1,
+51899,3,51897,3,0,1,
+51899,4,2,43375,7,0,1,
+51907,1,51896,1,
+51907,2,11,51905,1,
+51907,3,51896,1,0,1,
+51907,4,11,42771,3,0,1,
+51913,1,51903,1,
+51913,2,10,51908,1,
+51913,3,51903,3,0,1,
+51913,4,10,34965,10,0,1,
+51929,1,51926,1,
+51929,2,3,51921,1,
+51929,3,51926,1,0,1,
+51929,4,3,45104,2,0,1,
+51941,1,51938,1,
+51941,2,3,51936,1,
+51941,3,51938,1,0,1,
+51941,4,3,33200,2,0,1,
+51949,1,51947,1,
+51949,2,2,51945,1,
+51949,3,51947,5,0,1,
+51949,4,2,40496,6,0,1,
+51971,1,51969,1,
+51971,2,2,51970,1,
+51971,3,51969,13,0,1,
+51971,4,2,39077,2,0,1,
+51973,1,51971,1,
+51973,2,2,51972,1,
+51973,3,51971,2,0,1,
+51973,4,2,51151,6,0,1,
+51977,1,51974,1,
+51977,2,3,51976,1,
+51977,3,51974,4,0,1,
+51977,4,3,33537,7,0,1,
+51991,1,51984,1,
+51991,2,7,51982,1,
+51991,3,51984,8,0,1,
+51991,4,7,35432,10,0,1,
+52009,1,51992,1,
+52009,2,17,52006,1,
+52009,3,51992,12,0,1,
+52009,4,17,44665,20,0,1,
+52021,1,52019,1,
+52021,2,2,52017,1,
+52021,3,52019,5,0,1,
+52021,4,2,39143,12,0,1,
+52027,1,52025,1,
+52027,2,2,52026,1,
+52027,3,52025,6,0,1,
+52027,4,2,35108,2,0,1,
+52051,1,52049,1,
+52051,2,2,52047,1,
+52051,3,52049,5,0,1,
+52051,4,2,40756,1,0,1,
+52057,1,52050,1,
+52057,2,7,52050,1,
+52057,3,52050,3,0,1,
+52057,4,7,49013,17,0,1,
+52067,1,52065,1,
+52067,2,2,52063,1,
+52067,3,52065,3,0,1,
+52067,4,2,42954,16,0,1,
+52069,1,52067,1,
+52069,2,2,52068,1,
+52069,3,52067,6,0,1,
+52069,4,2,41826,3,0,1,
+52081,1,52064,1,
+52081,2,17,52078,1,
+52081,3,52064,3,0,1,
+52081,4,17,41781,20,0,1,
+52103,1,52098,1,
+52103,2,5,52101,1,
+52103,3,52098,2,0,1,
+52103,4,5,52099,3,0,1,
+52121,1,52118,1,
+52121,2,3,52115,1,
+52121,3,52118,1,0,1,
+52121,4,3,52109,0,0,1,
+52127,1,52122,1,
+52127,2,5,52126,1,
+52127,3,52122,2,0,1,
+52127,4,5,49124,3,0,1,
+52147,1,52145,1,
+52147,2,2,52143,1,
+52147,3,52145,4,0,1,
+52147,4,2,44306,8,0,1,
+52153,1,52148,1,
+52153,2,5,52150,1,
+52153,3,52148,6,0,1,
+52153,4,5,40698,10,0,1,
+52163,1,52161,1,
+52163,2,2,52162,1,
+52163,3,52161,2,0,1,
+52163,4,2,39023,11,0,1,
+52177,1,52172,1,
+52177,2,5,52176,1,
+52177,3,52172,3,0,1,
+52177,4,5,28122,6,0,1,
+52181,1,52178,1,
+52181,2,3,52180,1,
+52181,3,52178,6,0,1,
+52181,4,3,28647,3,0,1,
+52183,1,52180,1,
+52183,2,3,52182,1,
+52183,3,52180,1,0,1,
+52183,4,3,44586,2,0,1,
+52189,1,52176,1,
+52189,2,13,52180,1,
+52189,3,52176,5,0,1,
+52189,4,13,40268,23,0,1,
+52201,1,52184,1,
+52201,2,17,52200,1,
+52201,3,52184,7,0,1,
+52201,4,17,46708,14,0,1,
+52223,1,52218,1,
+52223,2,5,52221,1,
+52223,3,52218,5,0,1,
+52223,4,5,34293,9,0,1,
+52237,1,52231,1,
+52237,2,6,52235,1,
+52237,3,52231,3,0,1,
+52237,4,6,48847,0,0,1,
+52249,1,52236,1,
+52249,2,13,52236,1,
+52249,3,52236,5,0,1,
+52249,4,13,52210,0,0,1,
+52253,1,52251,1,
+52253,2,2,52252,1,
+52253,3,52251,4,0,1,
+52253,4,2,46552,6,0,1,
+52259,1,52257,1,
+52259,2,2,52245,1,
+52259,3,52257,2,0,1,
+52259,4,2,43253,3,0,1,
+52267,1,52265,1,
+52267,2,2,52266,1,
+52267,3,52265,4,0,1,
+52267,4,2,52260,8,0,1,
+52289,1,52286,1,
+52289,2,3,52288,1,
+52289,3,52286,8,0,1,
+52289,4,3,43330,7,0,1,
+52291,1,52284,1,
+52291,2,7,52289,1,
+52291,3,52284,9,0,1,
+52291,4,7,42016,6,0,1,
+52301,1,52299,1,
+52301,2,2,52294,1,
+52301,3,52299,2,0,1,
+52301,4,2,51696,9,0,1,
+52313,1,52310,1,
+52313,2,3,52307,1,
+52313,3,52310,1,0,1,
+52313,4,3,30146,11,0,1,
+52321,1,52304,1,
+52321,2,17,52320,1,
+52321,3,52304,1,0,1,
+52321,4,17,47622,18,0,1,
+52361,1,52355,1,
+52361,2,6,52358,1,
+52361,3,52355,2,0,1,
+52361,4,6,28483,0,0,1,
+52363,1,52358,1,
+52363,2,5,52362,1,
+52363,3,52358,1,0,1,
+52363,4,5,52344,20,0,1,
+52369,1,52356,1,
+52369,2,13,52358,1,
+52369,3,52356,5,0,1,
+52369,4,13,50272,34,0,1,
+52379,1,52377,1,
+52379,2,2,52378,1,
+52379,3,52377,4,0,1,
+52379,4,2,49810,2,0,1,
+52387,1,52385,1,
+52387,2,2,52386,1,
+52387,3,52385,2,0,1,
+52387,4,2,45789,2,0,1,
+52391,1,52380,1,
+52391,2,11,52388,1,
+52391,3,52380,4,0,1,
+52391,4,11,40163,5,0,1,
+52433,1,52430,1,
+52433,2,3,52432,1,
+52433,3,52430,4,0,1,
+52433,4,3,31887,4,0,1,
+52453,1,52451,1,
+52453,2,2,52449,1,
+52453,3,52451,5,0,1,
+52453,4,2,51995,10,0,1,
+52457,1,52454,1,
+52457,2,3,52451,1,
+52457,3,52454,3,0,1,
+52457,4,3,49747,1,0,1,
+52489,1,52482,1,
+52489,2,7,52482,1,
+52489,3,52482,8,0,1,
+52489,4,7,39696,0,0,1,
+52501,1,52491,1,
+52501,2,10,52500,1,
+52501,3,52491,3,0,1,
+52501,4,10,27307,15,0,1,
+52511,1,52504,1,
+52511,2,7,52510,1,
+52511,3,52504,1,0,1,
+52511,4,7,28612,3,0,1,
+52517,1,52515,1,
+52517,2,2,52511,1,
+52517,3,52515,9,0,1,
+52517,4,2,32464,1,0,1,
+52529,1,52526,1,
+52529,2,3,52523,1,
+52529,3,52526,17,0,1,
+52529,4,3,52517,0,0,1,
+52541,1,52539,1,
+52541,2,2,52540,1,
+52541,3,52539,3,0,1,
+52541,4,2,45653,4,0,1,
+52543,1,52540,1,
+52543,2,3,52542,1,
+52543,3,52540,9,0,1,
+52543,4,3,30071,2,0,1,
+52553,1,52550,1,
+52553,2,3,52548,1,
+52553,3,52550,1,0,1,
+52553,4,3,49860,10,0,1,
+52561,1,52554,1,
+52561,2,7,52554,1,
+52561,3,52554,3,0,1,
+52561,4,7,50303,0,0,1,
+52567,1,52564,1,
+52567,2,3,52565,1,
+52567,3,52564,1,0,1,
+52567,4,3,52563,4,0,1,
+52571,1,52569,1,
+52571,2,2,52566,1,
+52571,3,52569,3,0,1,
+52571,4,2,42415,3,0,1,
+52579,1,52577,1,
+52579,2,2,52572,1,
+52579,3,52577,6,0,1,
+52579,4,2,49320,4,0,1,
+52583,1,52578,1,
+52583,2,5,52582,1,
+52583,3,52578,2,0,1,
+52583,4,5,44395,2,0,1,
+52609,1,52598,1,
+52609,2,11,52608,1,
+52609,3,52598,2,0,1,
+52609,4,11,28702,12,0,1,
+52627,1,52624,1,
+52627,2,3,52620,1,
+52627,3,52624,1,0,1,
+52627,4,3,51978,2,0,1,
+52631,1,52618,1,
+52631,2,13,52630,1,
+52631,3,52618,5,0,1,
+52631,4,13,41479,2,0,1,
+52639,1,52636,1,
+52639,2,3,52637,1,
+52639,3,52636,8,0,1,
+52639,4,3,52635,4,0,1,
+52667,1,52665,1,
+52667,2,2,52663,1,
+52667,3,52665,2,0,1,
+52667,4,2,32868,14,0,1,
+52673,1,52670,1,
+52673,2,3,52666,1,
+52673,3,52670,1,0,1,
+52673,4,3,50520,2,0,1,
+52691,1,52689,1,
+52691,2,2,52687,1,
+52691,3,52689,2,0,1,
+52691,4,2,31262,7,0,1,
+52697,1,52694,1,
+52697,2,3,52696,1,
+52697,3,52694,5,0,1,
+52697,4,3,30819,4,0,1,
+52709,1,52707,1,
+52709,2,2,52708,1,
+52709,3,52707,3,0,1,
+52709,4,2,45603,3,0,1,
+52711,1,52688,1,
+52711,2,23,52709,1,
+52711,3,52688,6,0,1,
+52711,4,23,27839,3,0,1,
+52721,1,52718,1,
+52721,2,3,52716,1,
+52721,3,52718,3,0,1,
+52721,4,3,28804,2,0,1,
+52727,1,52722,1,
+52727,2,5,52722,1,
+52727,3,52722,14,0,1,
+52727,4,5,28078,9,0,1,
+52733,1,52731,1,
+52733,2,2,52729,1,
+52733,3,52731,3,0,1,
+52733,4,2,37759,9,0,1,
+52747,1,52744,1,
+52747,2,3,52746,1,
+52747,3,52744,6,0,1,
+52747,4,3,30461,5,0,1,
+52757,1,52755,1,
+52757,2,2,52753,1,
+52757,3,52755,2,0,1,
+52757,4,2,34759,1,0,1,
+52769,1,52766,1,
+52769,2,3,52761,1,
+52769,3,52766,3,0,1,
+52769,4,3,51298,2,0,1,
+52783,1,52778,1,
+52783,2,5,52781,1,
+52783,3,52778,1,0,1,
+52783,4,5,52779,3,0,1,
+52807,1,52802,1,
+52807,2,5,52804,1,
+52807,3,52802,1,0,1,
+52807,4,5,49469,0,0,1,
+52813,1,52811,1,
+52813,2,2,52812,1,
+52813,3,52811,2,0,1,
+52813,4,2,39817,7,0,1,
+52817,1,52814,1,
+52817,2,3,52816,1,
+52817,3,52814,11,0,1,
+52817,4,3,44518,4,0,1,
+52837,1,52835,1,
+52837,2,2,52833,1,
+52837,3,52835,6,0,1,
+52837,4,2,39891,10,0,1,
+52859,1,52853,1,
+52859,2,6,52858,1,
+52859,3,52853,1,0,1,
+52859,4,6,30636,5,0,1,
+52861,1,52850,1,
+52861,2,11,52859,1,
+52861,3,52850,1,0,1,
+52861,4,11,38349,0,0,1,
+52879,1,52876,1,
+52879,2,3,52878,1,
+52879,3,52876,1,0,1,
+52879,4,3,30897,3,0,1,
+52883,1,52881,1,
+52883,2,2,52879,1,
+52883,3,52881,2,0,1,
+52883,4,2,38001,14,0,1,
+52889,1,52886,1,
+52889,2,3,52880,1,
+52889,3,52886,1,0,1,
+52889,4,3,29129,3,0,1,
+52901,1,52898,1,
+52901,2,3,52899,1,
+52901,3,52898,5,0,1,
+52901,4,3,52897,4,0,1,
+52903,1,52900,1,
+52903,2,3,52901,1,
+52903,3,52900,4,0,1,
+52903,4,3,38242,6,0,1,
+52919,1,52908,1,
+52919,2,11,52918,1,
+52919,3,52908,2,0,1,
+52919,4,11,34050,4,0,1,
+52937,1,52932,1,
+52937,2,5,52936,1,
+52937,3,52932,3,0,1,
+52937,4,5,29372,6,0,1,
+52951,1,52948,1,
+52951,2,3,52950,1,
+52951,3,52948,4,0,1,
+52951,4,3,29695,3,0,1,
+52957,1,52952,1,
+52957,2,5,52952,1,
+52957,3,52952,2,0,1,
+52957,4,5,41398,11,0,1,
+52963,1,52960,1,
+52963,2,3,52954,1,
+52963,3,52960,3,0,1,
+52963,4,3,45941,10,0,1,
+52967,1,52962,1,
+52967,2,5,52965,1,
+52967,3,52962,1,0,1,
+52967,4,5,52963,3,0,1,
+52973,1,52971,1,
+52973,2,2,52969,1,
+52973,3,52971,3,0,1,
+52973,4,2,46099,9,0,1,
+52981,1,52979,1,
+52981,2,2,52980,1,
+52981,3,52979,4,0,1,
+52981,4,2,51763,9,0,1,
+52999,1,52996,1,
+52999,2,3,52994,1,
+52999,3,52996,1,0,1,
+52999,4,3,40493,6,0,1,
+53003,1,53001,1,
+53003,2,2,52999,1,
+53003,3,53001,3,0,1,
+53003,4,2,44042,7,0,1,
+53017,1,53012,1,
+53017,2,5,53014,1,
+53017,3,53012,1,0,1,
+53017,4,5,35010,10,0,1,
+53047,1,53044,1,
+53047,2,3,53045,1,
+53047,3,53044,1,0,1,
+53047,4,3,27313,3,0,1,
+53051,1,53045,1,
+53051,2,6,53048,1,
+53051,3,53045,3,0,1,
+53051,4,6,35622,4,0,1,
+53069,1,53067,1,
+53069,2,2,53065,1,
+53069,3,53067,3,0,1,
+53069,4,2,48916,6,0,1,
+53077,1,53075,1,
+53077,2,2,53076,1,
+53077,3,53075,2,0,1,
+53077,4,2,50322,3,0,1,
+53087,1,53082,1,
+53087,2,5,53085,1,
+53087,3,53082,1,0,1,
+53087,4,5,53083,3,0,1,
+53089,1,53058,1,
+53089,2,31,53088,1,
+53089,3,53058,3,0,1,
+53089,4,31,34721,24,0,1,
+53093,1,53091,1,
+53093,2,2,53092,1,
+53093,3,53091,2,0,1,
+53093,4,2,50859,3,0,1,
+53101,1,53099,1,
+53101,2,2,53100,1,
+53101,3,53099,5,0,1,
+53101,4,2,32404,7,0,1,
+53113,1,53108,1,
+53113,2,5,53112,1,
+53113,3,53108,1,0,1,
+53113,4,5,47333,18,0,1,
+53117,1,53115,1,
+53117,2,2,53113,1,
+53117,3,53115,3,0,1,
+53117,4,2,28531,12,0,1,
+53129,1,53126,1,
+53129,2,3,53128,1,
+53129,3,53126,3,0,1,
+53129,4,3,38670,7,0,1,
+53147,1,53145,1,
+53147,2,2,53146,1,
+53147,3,53145,3,0,1,
+53147,4,2,30289,2,0,1,
+53149,1,53143,1,
+53149,2,6,53148,1,
+53149,3,53143,7,0,1,
+53149,4,6,35954,7,0,1,
+53161,1,53147,1,
+53161,2,14,53156,1,
+53161,3,53147,2,0,1,
+53161,4,14,46763,19,0,1,
+53171,1,53169,1,
+53171,2,2,53170,1,
+53171,3,53169,3,0,1,
+53171,4,2,48565,2,0,1,
+53173,1,53155,1,
+53173,2,18,53171,1,
+53173,3,53155,1,0,1,
+53173,4,18,49287,0,0,1,
+53189,1,53187,1,
+53189,2,2,53188,1,
+53189,3,53187,3,0,1,
+53189,4,2,46605,4,0,1,
+53197,1,53195,1,
+53197,2,2,53193,1,
+53197,3,53195,4,0,1,
+53197,4,2,31752,9,0,1,
+53201,1,53198,1,
+53201,2,3,53195,1,
+53201,3,53198,4,0,1,
+53201,4,3,53189,0,0,1,
+53231,1,53208,1,
+53231,2,23,53230,1,
+53231,3,53208,1,0,1,
+53231,4,23,37258,7,0,1,
+53233,1,53228,1,
+53233,2,5,53232,1,
+53233,3,53228,8,0,1,
+53233,4,5,34161,6,0,1,
+53239,1,53236,1,
+53239,2,3,53238,1,
+53239,3,53236,1,0,1,
+53239,4,3,45917,2,0,1,
+53267,1,53265,1,
+53267,2,2,53263,1,
+53267,3,53265,3,0,1,
+53267,4,2,46483,8,0,1,
+53269,1,53262,1,
+53269,2,7,53266,1,
+53269,3,53262,4,0,1,
+53269,4,7,50668,5,0,1,
+53279,1,53272,1,
+53279,2,7,53278,1,
+53279,3,53272,1,0,1,
+53279,4,7,41917,2,0,1,
+53281,1,53270,1,
+53281,2,11,53270,1,
+53281,3,53270,1,0,1,
+53281,4,11,34812,24,0,1,
+53299,1,53297,1,
+53299,2,2,53295,1,
+53299,3,53297,4,0,1,
+53299,4,2,38727,8,0,1,
+53309,1,53307,1,
+53309,2,2,53301,1,
+53309,3,53307,2,0,1,
+53309,4,2,27768,0,0,1,
+53323,1,53321,1,
+53323,2,2,53319,1,
+53323,3,53321,6,0,1,
+53323,4,2,30154,14,0,1,
+53327,1,53322,1,
+53327,2,5,53324,1,
+53327,3,53322,2,0,1,
+53327,4,5,42727,4,0,1,
+53353,1,53346,1,
+53353,2,7,53346,1,
+53353,3,53346,1,0,1,
+53353,4,7,38054,17,0,1,
+53359,1,53356,1,
+53359,2,3,53357,1,
+53359,3,53356,5,0,1,
+53359,4,3,52435,6,0,1,
+53377,1,53372,1,
+53377,2,5,53372,1,
+53377,3,53372,2,0,1,
+53377,4,5,39744,10,0,1,
+53381,1,53379,1,
+53381,2,2,53380,1,
+53381,3,53379,8,0,1,
+53381,4,2,29714,9,0,1,
+53401,1,53394,1,
+53401,2,7,53394,1,
+53401,3,53394,2,0,1,
+53401,4,7,39557,0,0,1,
+53407,1,53402,1,
+53407,2,5,53405,1,
+53407,3,53402,2,0,1,
+53407,4,5,53403,3,0,1,
+53411,1,53409,1,
+53411,2,2,53407,1,
+53411,3,53409,2,0,1,
+53411,4,2,42544,8,0,1,
+53419,1,53417,1,
+53419,2,2,53415,1,
+53419,3,53417,6,0,1,
+53419,4,2,30159,8,0,1,
+53437,1,53435,1,
+53437,2,2,53436,1,
+53437,3,53435,6,0,1,
+53437,4,2,30309,3,0,1,
+53441,1,53438,1,
+53441,2,3,53436,1,
+53441,3,53438,1,0,1,
+53441,4,3,32629,2,0,1,
+53453,1,53451,1,
+53453,2,2,53449,1,
+53453,3,53451,3,0,1,
+53453,4,2,36781,6,0,1,
+53479,1,53476,1,
+53479,2,3,53478,1,
+53479,3,53476,5,0,1,
+53479,4,3,51225,2,0,1,
+53503,1,53500,1,
+53503,2,3,53501,1,
+53503,3,53500,4,0,1,
+53503,4,3,34581,3,0,1,
+53507,1,53505,1,
+53507,2,2,53506,1,
+53507,3,53505,2,0,1,
+53507,4,2,47738,2,0,1,
+53527,1,53524,1,
+53527,2,3,53525,1,
+53527,3,53524,7,0,1,
+53527,4,3,53523,4,0,1,
+53549,1,53547,1,
+53549,2,2,53548,1,
+53549,3,53547,4,0,1,
+53549,4,2,42415,4,0,1,
+53551,1,53548,1,
+53551,2,3,53549,1,
+53551,3,53548,1,0,1,
+53551,4,3,33763,6,0,1,
+53569,1,53550,1,
+53569,2,19,53550,1,
+53569,3,53550,5,0,1,
+53569,4,19,30483,0,0,1,
+53591,1,53578,1,
+53591,2,13,53589,1,
+53591,3,53578,4,0,1,
+53591,4,13,33693,4,0,1,
+53593,1,53588,1,
+53593,2,5,53592,1,
+53593,3,53588,10,0,1,
+53593,4,5,32222,6,0,1,
+53597,1,53595,1,
+53597,2,2,53593,1,
+53597,3,53595,3,0,1,
+53597,4,2,52044,11,0,1,
+53609,1,53606,1,
+53609,2,3,53608,1,
+53609,3,53606,6,0,1,
+53609,4,3,47985,7,0,1,
+53611,1,53601,1,
+53611,2,10,53609,1,
+53611,3,53601,8,0,1,
+53611,4,10,27407,0,0,1,
+53617,1,53612,1,
+53617,2,5,53616,1,
+53617,3,53612,2,0,1,
+53617,4,5,31561,6,0,1,
+53623,1,53620,1,
+53623,2,3,53621,1,
+53623,3,53620,4,0,1,
+53623,4,3,53619,4,0,1,
+53629,1,53623,1,
+53629,2,6,53621,1,
+53629,3,53623,9,0,1,
+53629,4,6,30991,0,0,1,
+53633,1,53630,1,
+53633,2,3,53632,1,
+53633,3,53630,1,0,1,
+53633,4,3,27294,7,0,1,
+53639,1,53628,1,
+53639,2,11,53638,1,
+53639,3,53628,4,0,1,
+53639,4,11,47011,2,0,1,
+53653,1,53651,1,
+53653,2,2,53652,1,
+53653,3,53651,2,0,1,
+53653,4,2,47442,3,0,1,
+53657,1,53654,1,
+53657,2,3,53652,1,
+53657,3,53654,6,0,1,
+53657,4,3,31526,0,0,1,
+53681,1,53678,1,
+53681,2,3,53675,1,
+53681,3,53678,6,0,1,
+53681,4,3,53669,0,0,1,
+53693,1,53691,1,
+53693,2,2,53692,1,
+53693,3,53691,3,0,1,
+53693,4,2,33623,3,0,1,
+53699,1,53697,1,
+53699,2,2,53695,1,
+53699,3,53697,9,0,1,
+53699,4,2,28092,9,0,1,
+53717,1,53715,1,
+53717,2,2,53716,1,
+53717,3,53715,2,0,1,
+53717,4,2,36983,6,0,1,
+53719,1,53713,1,
+53719,2,6,53718,1,
+53719,3,53713,2,0,1,
+53719,4,6,28206,3,0,1,
+53731,1,53719,1,
+53731,2,12,53729,1,
+53731,3,53719,1,0,1,
+53731,4,12,29169,6,0,1,
+53759,1,53742,1,
+53759,2,17,53757,1,
+53759,3,53742,2,0,1,
+53759,4,17,53751,3,0,1,
+53773,1,53771,1,
+53773,2,2,53772,1,
+53773,3,53771,2,0,1,
+53773,4,2,34710,6,0,1,
+53777,1,53774,1,
+53777,2,3,53771,1,
+53777,3,53774,1,0,1,
+53777,4,3,42831,16,0,1,
+53783,1,53778,1,
+53783,2,5,53782,1,
+53783,3,53778,9,0,1,
+53783,4,5,32552,3,0,1,
+53791,1,53785,1,
+53791,2,6,53790,1,
+53791,3,53785,3,0,1,
+53791,4,6,27401,2,0,1,
+53813,1,53811,1,
+53813,2,2,53805,1,
+53813,3,53811,8,0,1,
+53813,4,2,28837,3,0,1,
+53819,1,53817,1,
+53819,2,2,53814,1,
+53819,3,53817,7,0,1,
+53819,4,2,48668,3,0,1,
+53831,1,53824,1,
+53831,2,7,53827,1,
+53831,3,53824,4,0,1,
+53831,4,7,40011,5,0,1,
+53849,1,53846,1,
+53849,2,3,53843,1,
+53849,3,53846,8,0,1,
+53849,4,3,53837,0,0,1,
+53857,1,53852,1,
+53857,2,5,53852,1,
+53857,3,53852,3,0,1,
+53857,4,5,49534,15,0,1,
+53861,1,53859,1,
+53861,2,2,53860,1,
+53861,3,53859,5,0,1,
+53861,4,2,53342,9,0,1,
+53881,1,53850,1,
+53881,2,31,53880,1,
+53881,3,53850,1,0,1,
+53881,4,31,43513,24,0,1,
+53887,1,53884,1,
+53887,2,3,53885,1,
+53887,3,53884,8,0,1,
+53887,4,3,41551,3,0,1,
+53891,1,53889,1,
+53891,2,2,53883,1,
+53891,3,53889,4,0,1,
+53891,4,2,42377,2,0,1,
+53897,1,53894,1,
+53897,2,3,53896,1,
+53897,3,53894,4,0,1,
+53897,4,3,53127,4,0,1,
+53899,1,53897,1,
+53899,2,2,53895,1,
+53899,3,53897,5,0,1,
+53899,4,2,37119,1,0,1,
+53917,1,53915,1,
+53917,2,2,53916,1,
+53917,3,53915,2,0,1,
+53917,4,2,34912,7,0,1,
+53923,1,53918,1,
+53923,2,5,53921,1,
+53923,3,53918,5,0,1,
+53923,4,5,53915,6,0,1,
+53927,1,53922,1,
+53927,2,5,53925,1,
+53927,3,53922,1,0,1,
+53927,4,5,53923,3,0,1,
+53939,1,53937,1,
+53939,2,2,53933,1,
+53939,3,53937,2,0,1,
+53939,4,2,43058,4,0,1,
+53951,1,53944,1,
+53951,2,7,53950,1,
+53951,3,53944,3,0,1,
+53951,4,7,53942,4,0,1,
+53959,1,53956,1,
+53959,2,3,53957,1,
+53959,3,53956,4,0,1,
+53959,4,3,47291,3,0,1,
+53987,1,53985,1,
+53987,2,2,53986,1,
+53987,3,53985,2,0,1,
+53987,4,2,51795,4,0,1,
+53993,1,53990,1,
+53993,2,3,53984,1,
+53993,3,53990,4,0,1,
+53993,4,3,32327,3,0,1,
+54001,1,53990,1,
+54001,2,11,53998,1,
+54001,3,53990,4,0,1,
+54001,4,11,38898,14,0,1,
+54011,1,54009,1,
+54011,2,2,54004,1,
+54011,3,54009,5,0,1,
+54011,4,2,47801,1,0,1,
+54013,1,54008,1,
+54013,2,5,54012,1,
+54013,3,54008,1,0,1,
+54013,4,5,53278,6,0,1,
+54037,1,54035,1,
+54037,2,2,54033,1,
+54037,3,54035,4,0,1,
+54037,4,2,33218,6,0,1,
+54049,1,54038,1,
+54049,2,11,54044,1,
+54049,3,54038,2,0,1,
+54049,4,11,34837,22,0,1,
+54059,1,54057,1,
+54059,2,2,54058,1,
+54059,3,54057,3,0,1,
+54059,4,2,35508,2,0,1,
+54083,1,54081,1,
+54083,2,2,54079,1,
+54083,3,54081,3,0,1,
+54083,4,2,33127,7,0,1,
+54091,1,54088,1,
+54091,2,3,54086,1,
+54091,3,54088,8,0,1,
+54091,4,3,31288,3,0,1,
+54101,1,54098,1,
+54101,2,3,54099,1,
+54101,3,54098,1,0,1,
+54101,4,3,54097,4,0,1,
+54121,1,54108,1,
+54121,2,13,54120,1,
+54121,3,54108,9,0,1,
+54121,4,13,41494,14,0,1,
+54133,1,54128,1,
+54133,2,5,54132,1,
+54133,3,54128,5,0,1,
+54133,4,5,31507,6,0,1,
+54139,1,54137,1,
+54139,2,2,54135,1,
+54139,3,54137,6,0,1,
+54139,4,2,53333,8,0,1,
+54151,1,54145,1,
+54151,2,6,54149,1,
+54151,3,54145,3,0,1,
+54151,4,6,39340,3,0,1,
+54163,1,54161,1,
+54163,2,2,54159,1,
+54163,3,54161,6,0,1,
+54163,4,2,49878,8,0,1,
+54167,1,54162,1,
+54167,2,5,54165,1,
+54167,3,54162,2,0,1,
+54167,4,5,39230,8,0,1,
+54181,1,54179,1,
+54181,2,2,54177,1,
+54181,3,54179,2,0,1,
+54181,4,2,29314,12,0,1,
+54193,1,54183,1,
+54193,2,10,54188,1,
+54193,3,54183,2,0,1,
+54193,4,10,53577,12,0,1,
+54217,1,54212,1,
+54217,2,5,54216,1,
+54217,3,54212,1,0,1,
+54217,4,5,41596,6,0,1,
+54251,1,54249,1,
+54251,2,2,54247,1,
+54251,3,54249,3,0,1,
+54251,4,2,35571,8,0,1,
+54269,1,54267,1,
+54269,2,2,54264,1,
+54269,3,54267,4,0,1,
+54269,4,2,52348,8,0,1,
+54277,1,54272,1,
+54277,2,5,54276,1,
+54277,3,54272,2,0,1,
+54277,4,5,46093,3,0,1,
+54287,1,54282,1,
+54287,2,5,54285,1,
+54287,3,54282,5,0,1,
+54287,4,5,54283,3,0,1,
+54293,1,54291,1,
+54293,2,2,54288,1,
+54293,3,54291,5,0,1,
+54293,4,2,52801,2,0,1,
+54311,1,54300,1,
+54311,2,11,54310,1,
+54311,3,54300,2,0,1,
+54311,4,11,35318,10,0,1,
+54319,1,54316,1,
+54319,2,3,54317,1,
+54319,3,54316,4,0,1,
+54319,4,3,46010,6,0,1,
+54323,1,54321,1,
+54323,2,2,54319,1,
+54323,3,54321,2,0,1,
+54323,4,2,53550,7,0,1,
+54331,1,54329,1,
+54331,2,2,54327,1,
+54331,3,54329,2,0,1,
+54331,4,2,48975,8,0,1,
+54347,1,54345,1,
+54347,2,2,54343,1,
+54347,3,54345,2,0,1,
+54347,4,2,36691,11,0,1,
+54361,1,54354,1,
+54361,2,7,54358,1,
+54361,3,54354,1,0,1,
+54361,4,7,51839,16,0,1,
+54367,1,54362,1,
+54367,2,5,54366,1,
+54367,3,54362,10,0,1,
+54367,4,5,43976,2,0,1,
+54371,1,54365,1,
+54371,2,6,54370,1,
+54371,3,54365,10,0,1,
+54371,4,6,51692,4,0,1,
+54377,1,54372,1,
+54377,2,5,54370,1,
+54377,3,54372,9,0,1,
+54377,4,5,51708,1,0,1,
+54401,1,54398,1,
+54401,2,3,54400,1,
+54401,3,54398,1,0,1,
+54401,4,3,32412,4,0,1,
+54403,1,54401,1,
+54403,2,2,54399,1,
+54403,3,54401,2,0,1,
+54403,4,2,42818,1,0,1,
+54409,1,54402,1,
+54409,2,7,54406,1,
+54409,3,54402,7,0,1,
+54409,4,7,40433,17,0,1,
+54413,1,54411,1,
+54413,2,2,54406,1,
+54413,3,54411,10,0,1,
+54413,4,2,37262,4,0,1,
+54419,1,54417,1,
+54419,2,2,54415,1,
+54419,3,54417,2,0,1,
+54419,4,2,44995,8,0,1,
+54421,1,54419,1,
+54421,2,2,54420,1,
+54421,3,54419,6,0,1,
+54421,4,2,54414,8,0,1,
+54437,1,54435,1,
+54437,2,2,54432,1,
+54437,3,54435,2,0,1,
+54437,4,2,40155,0,0,1,
+54443,1,54441,1,
+54443,2,2,54439,1,
+54443,3,54441,3,0,1,
+54443,4,2,27730,8,0,1,
+54449,1,54446,1,
+54449,2,3,54442,1,
+54449,3,54446,3,0,1,
+54449,4,3,36474,0,0,1,
+54469,1,54467,1,
+54469,2,2,54465,1,
+54469,3,54467,2,0,1,
+54469,4,2,28084,12,0,1,
+54493,1,54491,1,
+54493,2,2,54492,1,
+54493,3,54491,6,0,1,
+54493,4,2,28709,9,0,1,
+54497,1,54494,1,
+54497,2,3,54483,1,
+54497,3,54494,1,0,1,
+54497,4,3,52734,4,0,1,
+54499,1,54496,1,
+54499,2,3,54492,1,
+54499,3,54496,1,0,1,
+54499,4,3,37260,5,0,1,
+54503,1,54496,1,
+54503,2,7,54501,1,
+54503,3,54496,10,0,1,
+54503,4,7,47550,4,0,1,
+54517,1,54512,1,
+54517,2,5,54512,1,
+54517,3,54512,6,0,1,
+54517,4,5,41098,23,0,1,
+54521,1,54518,1,
+54521,2,3,54514,1,
+54521,3,54518,4,0,1,
+54521,4,3,31723,4,0,1,
+54539,1,54537,1,
+54539,2,2,54533,1,
+54539,3,54537,7,0,1,
+54539,4,2,31098,4,0,1,
+54541,1,54539,1,
+54541,2,2,54537,1,
+54541,3,54539,2,0,1,
+54541,4,2,45092,6,0,1,
+54547,1,54544,1,
+54547,2,3,54538,1,
+54547,3,54544,1,0,1,
+54547,4,3,52356,4,0,1,
+54559,1,54556,1,
+54559,2,3,54558,1,
+54559,3,54556,1,0,1,
+54559,4,3,53941,2,0,1,
+54563,1,54561,1,
+54563,2,2,54559,1,
+54563,3,54561,2,0,1,
+54563,4,2,52815,7,0,1,
+54577,1,54572,1,
+54577,2,5,54574,1,
+54577,3,54572,1,0,1,
+54577,4,5,54566,14,0,1,
+54581,1,54571,1,
+54581,2,10,54578,1,
+54581,3,54571,8,0,1,
+54581,4,10,52377,0,0,1,
+54583,1,54578,1,
+54583,2,5,54582,1,
+54583,3,54578,2,0,1,
+54583,4,5,41655,3,0,1,
+54601,1,54579,1,
+54601,2,22,54598,1,
+54601,3,54579,2,0,1,
+54601,4,22,52577,22,0,1,
+54617,1,54614,1,
+54617,2,3,54616,1,
+54617,3,54614,4,0,1,
+54617,4,3,49252,7,0,1,
+54623,1,54618,1,
+54623,2,5,54620,1,
+54623,3,54618,1,0,1,
+54623,4,5,35656,4,0,1,
+54629,1,54626,1,
+54629,2,3,54627,1,
+54629,3,54626,7,0,1,
+54629,4,3,38672,12,0,1,
+54631,1,54625,1,
+54631,2,6,54629,1,
+54631,3,54625,2,0,1,
+54631,4,6,32685,3,0,1,
+54647,1,54642,1,
+54647,2,5,54642,1,
+54647,3,54642,3,0,1,
+54647,4,5,48318,7,0,1,
+54667,1,54665,1,
+54667,2,2,54663,1,
+54667,3,54665,6,0,1,
+54667,4,2,30127,13,0,1,
+54673,1,54668,1,
+54673,2,5,54672,1,
+54673,3,54668,2,0,1,
+54673,4,5,48898,6,0,1,
+54679,1,54672,1,
+54679,2,7,54667,1,
+54679,3,54672,1,0,1,
+54679,4,7,48374,0,0,1,
+54709,1,54707,1,
+54709,2,2,54705,1,
+54709,3,54707,2,0,1,
+54709,4,2,54186,6,0,1,
+54713,1,54708,1,
+54713,2,5,54712,1,
+54713,3,54708,3,0,1,
+54713,4,5,44310,6,0,1,
+54721,1,54710,1,
+54721,2,11,54712,1,
+54721,3,54710,1,0,1,
+54721,4,11,45297,20,0,1,
+54727,1,54724,1,
+54727,2,3,54726,1,
+54727,3,54724,1,0,1,
+54727,4,3,51959,5,0,1,
+54751,1,54745,1,
+54751,2,6,54749,1,
+54751,3,54745,3,0,1,
+54751,4,6,54741,7,0,1,
+54767,1,54762,1,
+54767,2,5,54765,1,
+54767,3,54762,1,0,1,
+54767,4,5,36070,5,0,1,
+54773,1,54771,1,
+54773,2,2,54766,1,
+54773,3,54771,2,0,1,
+54773,4,2,49710,2,0,1,
+54779,1,54777,1,
+54779,2,2,54775,1,
+54779,3,54777,2,0,1,
+54779,4,2,37806,8,0,1,
+54787,1,54785,1,
+54787,2,2,54786,1,
+54787,3,54785,6,0,1,
+54787,4,2,40532,7,0,1,
+54799,1,54796,1,
+54799,2,3,54798,1,
+54799,3,54796,3,0,1,
+54799,4,3,31708,2,0,1,
+54829,1,54827,1,
+54829,2,2,54828,1,
+54829,3,54827,4,0,1,
+54829,4,2,54822,8,0,1,
+54833,1,54830,1,
+54833,2,3,54827,1,
+54833,3,54830,11,0,1,
+54833,4,3,51648,1,0,1,
+54851,1,54845,1,
+54851,2,6,54849,1,
+54851,3,54845,3,0,1,
+54851,4,6,44707,15,0,1,
+54869,1,54867,1,
+54869,2,2,54868,1,
+54869,3,54867,3,0,1,
+54869,4,2,49807,4,0,1,
+54877,1,54875,1,
+54877,2,2,54873,1,
+54877,3,54875,4,0,1,
+54877,4,2,49718,12,0,1,
+54881,1,54878,1,
+54881,2,3,54880,1,
+54881,3,54878,9,0,1,
+54881,4,3,47900,4,0,1,
+54907,1,54905,1,
+54907,2,2,54906,1,
+54907,3,54905,2,0,1,
+54907,4,2,38476,7,0,1,
+54917,1,54915,1,
+54917,2,2,54909,1,
+54917,3,54915,8,0,1,
+54917,4,2,41903,5,0,1,
+54919,1,54916,1,
+54919,2,3,54918,1,
+54919,3,54916,4,0,1,
+54919,4,3,42837,3,0,1,
+54941,1,54939,1,
+54941,2,2,54940,1,
+54941,3,54939,5,0,1,
+54941,4,2,50581,3,0,1,
+54949,1,54947,1,
+54949,2,2,54948,1,
+54949,3,54947,4,0,1,
+54949,4,2,54942,8,0,1,
+54959,1,54952,1,
+54959,2,7,54958,1,
+54959,3,54952,1,0,1,
+54959,4,7,31117,2,0,1,
+54973,1,54959,1,
+54973,2,14,54970,1,
+54973,3,54959,5,0,1,
+54973,4,14,30370,1,0,1,
+54979,1,54976,1,
+54979,2,3,54974,1,
+54979,3,54976,1,0,1,
+54979,4,3,42920,3,0,1,
+54983,1,54978,1,
+54983,2,5,54978,1,
+54983,3,54978,2,0,1,
+54983,4,5,48837,6,0,1,
+55001,1,54998,1,
+55001,2,3,54996,1,
+55001,3,54998,4,0,1,
+55001,4,3,40914,8,0,1,
+55009,1,55002,1,
+55009,2,7,54998,1,
+55009,3,55002,11,0,1,
+55009,4,7,38608,24,0,1,
+55021,1,55015,1,
+55021,2,6,55020,1,
+55021,3,55015,2,0,1,
+55021,4,6,28224,7,0,1,
+55049,1,55043,1,
+55049,2,6,55048,1,
+55049,3,55043,2,0,1,
+55049,4,6,45962,4,0,1,
+55051,1,55049,1,
+55051,2,2,55050,1,
+55051,3,55049,6,0,1,
+55051,4,2,35693,2,0,1,
+55057,1,55047,1,
+55057,2,10,55056,1,
+55057,3,55047,5,0,1,
+55057,4,10,38627,12,0,1,
+55061,1,55059,1,
+55061,2,2,55060,1,
+55061,3,55059,4,0,1,
+55061,4,2,33619,3,0,1,
+55073,1,55070,1,
+55073,2,3,55072,1,
+55073,3,55070,3,0,1,
+55073,4,3,38454,7,0,1,
+55079,1,55066,1,
+55079,2,13,55078,1,
+55079,3,55066,1,0,1,
+55079,4,13,37766,2,0,1,
+55103,1,55098,1,
+55103,2,5,55102,1,
+55103,3,55098,1,0,1,
+55103,4,5,48476,3,0,1,
+55109,1,55107,1,
+55109,2,2,55098,1,
+55109,3,55107,4,0,1,
+55109,4,2,35765,9,0,1,
+55117,1,55112,1,
+55117,2,5,55114,1,
+55117,3,55112,10,0,1,
+55117,4,5,40725,1,0,1,
+55127,1,55122,1,
+55127,2,5,55125,1,
+55127,3,55122,1,0,1,
+55127,4,5,40534,5,0,1,
+55147,1,55142,1,
+55147,2,5,55145,1,
+55147,3,55142,2,0,1,
+55147,4,5,55143,3,0,1,
+55163,1,55161,1,
+55163,2,2,55162,1,
+55163,3,55161,3,0,1,
+55163,4,2,49605,13,0,1,
+55171,1,55161,1,
+55171,2,10,55169,1,
+55171,3,55161,2,0,1,
+55171,4,10,38724,13,0,1,
+55201,1,55194,1,
+55201,2,7,55194,1,
+55201,3,55194,1,0,1,
+55201,4,7,51398,0,0,1,
+55207,1,55202,1,
+55207,2,5,55206,1,
+55207,3,55202,1,0,1,
+55207,4,5,44099,2,0,1,
+55213,1,55211,1,
+55213,2,2,55209,1,
+55213,3,55211,5,0,1,
+55213,4,2,48748,6,0,1,
+55217,1,55214,1,
+55217,2,3,55216,1,
+55217,3,55214,1,0,1,
+55217,4,3,50697,11,0,1,
+55219,1,55217,1,
+55219,2,2,55218,1,
+55219,3,55217,4,0,1,
+55219,4,2,28415,2,0,1,
+55229,1,55227,1,
+55229,2,2,55223,1,
+55229,3,55227,4,0,1,
+55229,4,2,38844,4,0,1,
+55243,1,55241,1,
+55243,2,2,55242,1,
+55243,3,55241,2,0,1,
+55243,4,2,50554,2,0,1,
+55249,1,55238,1,
+55249,2,11,55248,1,
+55249,3,55238,2,0,1,
+55249,4,11,51344,8,0,1,
+55259,1,55253,1,
+55259,2,6,55249,1,
+55259,3,55253,2,0,1,
+55259,4,6,46182,0,0,1,
+55291,1,55280,1,
+55291,2,11,55288,1,
+55291,3,55280,1,0,1,
+55291,4,11,29304,0,0,1,
+55313,1,55310,1,
+55313,2,3,55308,1,
+55313,3,55310,4,0,1,
+55313,4,3,52824,0,0,1,
+55331,1,55329,1,
+55331,2,2,55330,1,
+55331,3,55329,7,0,1,
+55331,4,2,47533,6,0,1,
+55333,1,55327,1,
+55333,2,6,55331,1,
+55333,3,55327,2,0,1,
+55333,4,6,37793,8,0,1,
+55337,1,55334,1,
+55337,2,3,55336,1,
+55337,3,55334,1,0,1,
+55337,4,3,38163,7,0,1,
+55339,1,55337,1,
+55339,2,2,55335,1,
+55339,3,55337,2,0,1,
+55339,4,2,31052,8,0,1,
+55343,1,55336,1,
+55343,2,7,55339,1,
+55343,3,55336,1,0,1,
+55343,4,7,55331,16,0,1,
+55351,1,55344,1,
+55351,2,7,55342,1,
+55351,3,55344,13,0,1,
+55351,4,7,46608,3,0,1,
+55373,1,55371,1,
+55373,2,2,55372,1,
+55373,3,55371,2,0,1,
+55373,4,2,45800,3,0,1,
+55381,1,55375,1,
+55381,2,6,55380,1,
+55381,3,55375,2,0,1,
+55381,4,6,41076,11,0,1,
+55399,1,55393,1,
+55399,2,6,55398,1,
+55399,3,55393,2,0,1,
+55399,4,6,44143,2,0,1,
+55411,1,55409,1,
+55411,2,2,55410,1,
+55411,3,55409,4,0,1,
+55411,4,2,46072,2,0,1,
+55439,1,55426,1,
+55439,2,13,55437,1,
+55439,3,55426,2,0,1,
+55439,4,13,42340,4,0,1,
+55441,1,55403,1,
+55441,2,38,55440,1,
+55441,3,55403,1,0,1,
+55441,4,38,47380,20,0,1,
+55457,1,55454,1,
+55457,2,3,55451,1,
+55457,3,55454,10,0,1,
+55457,4,3,51566,1,0,1,
+55469,1,55467,1,
+55469,2,2,55460,1,
+55469,3,55467,2,0,1,
+55469,4,2,34598,1,0,1,
+55487,1,55482,1,
+55487,2,5,55482,1,
+55487,3,55482,2,0,1,
+55487,4,5,47865,6,0,1,
+55501,1,55495,1,
+55501,2,6,55497,1,
+55501,3,55495,1,0,1,
+55501,4,6,55497,6,0,1,
+55511,1,55500,1,
+55511,2,11,55509,1,
+55511,3,55500,6,0,1,
+55511,4,11,45652,5,0,1,
+55529,1,55526,1,
+55529,2,3,55524,1,
+55529,3,55526,3,0,1,
+55529,4,3,42741,2,0,1,
+55541,1,55539,1,
+55541,2,2,55535,1,
+55541,3,55539,9,0,1,
+55541,4,2,44080,4,0,1,
+55547,1,55545,1,
+55547,2,2,55541,1,
+55547,3,55545,9,0,1,
+55547,4,2,29580,4,0,1,
+55579,1,55577,1,
+55579,2,2,55578,1,
+55579,3,55577,6,0,1,
+55579,4,2,45669,2,0,1,
+55589,1,55587,1,
+55589,2,2,55585,1,
+55589,3,55587,3,0,1,
+55589,4,2,39396,12,0,1,
+55603,1,55601,1,
+55603,2,2,55599,1,
+55603,3,55601,6,0,1,
+55603,4,2,32874,8,0,1,
+55609,1,55596,1,
+55609,2,13,55596,1,
+55609,3,55596,1,0,1,
+55609,4,13,55570,0,0,1,
+55619,1,55617,1,
+55619,2,2,55615,1,
+55619,3,55617,2,0,1,
+55619,4,2,34176,7,0,1,
+55621,1,55619,1,
+55621,2,2,55620,1,
+55621,3,55619,4,0,1,
+55621,4,2,39788,7,0,1,
+55631,1,55624,1,
+55631,2,7,55629,1,
+55631,3,55624,1,0,1,
+55631,4,7,38577,4,0,1,
+55633,1,55628,1,
+55633,2,5,55630,1,
+55633,3,55628,5,0,1,
+55633,4,5,35265,16,0,1,
+55639,1,55636,1,
+55639,2,3,55637,1,
+55639,3,55636,6,0,1,
+55639,4,3,46470,6,0,1,
+55661,1,55659,1,
+55661,2,2,55657,1,
+55661,3,55659,5,0,1,
+55661,4,2,37283,12,0,1,
+55663,1,55660,1,
+55663,2,3,55661,1,
+55663,3,55660,3,0,1,
+55663,4,3,28880,3,0,1,
+55667,1,55665,1,
+55667,2,2,55663,1,
+55667,3,55665,2,0,1,
+55667,4,2,51291,13,0,1,
+55673,1,55670,1,
+55673,2,3,55672,1,
+55673,3,55670,1,0,1,
+55673,4,3,41377,4,0,1,
+55681,1,55670,1,
+55681,2,11,55680,1,
+55681,3,55670,5,0,1,
+55681,4,11,30307,12,0,1,
+55691,1,55689,1,
+55691,2,2,55690,1,
+55691,3,55689,3,0,1,
+55691,4,2,44290,2,0,1,
+55697,1,55694,1,
+55697,2,3,55692,1,
+55697,3,55694,1,0,1,
+55697,4,3,35089,2,0,1,
+55711,1,55708,1,
+55711,2,3,55710,1,
+55711,3,55708,5,0,1,
+55711,4,3,54042,2,0,1,
+55717,1,55715,1,
+55717,2,2,55713,1,
+55717,3,55715,6,0,1,
+55717,4,2,45647,9,0,1,
+55721,1,55718,1,
+55721,2,3,55720,1,
+55721,3,55718,13,0,1,
+55721,4,3,35341,7,0,1,
+55733,1,55731,1,
+55733,2,2,55727,1,
+55733,3,55731,7,0,1,
+55733,4,2,41119,1,0,1,
+55763,1,55761,1,
+55763,2,2,55757,1,
+55763,3,55761,8,0,1,
+55763,4,2,32202,4,0,1,
+55787,1,55785,1,
+55787,2,2,55782,1,
+55787,3,55785,5,0,1,
+55787,4,2,44917,3,0,1,
+55793,1,55790,1,
+55793,2,3,55787,1,
+55793,3,55790,1,0,1,
+55793,4,3,29668,12,0,1,
+55799,1,55792,1,
+55799,2,7,55797,1,
+55799,3,55792,19,0,1,
+55799,4,7,28837,5,0,1,
+55807,1,55804,1,
+55807,2,3,55805,1,
+55807,3,55804,5,0,1,
+55807,4,3,28470,6,0,1,
+55813,1,55811,1,
+55813,2,2,55809,1,
+55813,3,55811,4,0,1,
+55813,4,2,31826,10,0,1,
+55817,1,55814,1,
+55817,2,3,55805,1,
+55817,3,55814,1,0,1,
+55817,4,3,48937,0,0,1,
+55819,1,55817,1,
+55819,2,2,55815,1,
+55819,3,55817,2,0,1,
+55819,4,2,33154,8,0,1,
+55823,1,55818,1,
+55823,2,5,55821,1,
+55823,3,55818,3,0,1,
+55823,4,5,45481,8,0,1,
+55829,1,55827,1,
+55829,2,2,55825,1,
+55829,3,55827,2,0,1,
+55829,4,2,33851,7,0,1,
+55837,1,55832,1,
+55837,2,5,55836,1,
+55837,3,55832,14,0,1,
+55837,4,5,49246,6,0,1,
+55843,1,55841,1,
+55843,2,2,55839,1,
+55843,3,55841,6,0,1,
+55843,4,2,42336,8,0,1,
+55849,1,55835,1,
+55849,2,14,55846,1,
+55849,3,55835,1,0,1,
+55849,4,14,46684,10,0,1,
+55871,1,55864,1,
+55871,2,7,55870,1,
+55871,3,55864,4,0,1,
+55871,4,7,37071,3,0,1,
+55889,1,55886,1,
+55889,2,3,55883,1,
+55889,3,55886,1,0,1,
+55889,4,3,55877,0,0,1,
+55897,1,55892,1,
+55897,2,5,55896,1,
+55897,3,55892,1,0,1,
+55897,4,5,41446,12,0,1,
+55901,1,55899,1,
+55901,2,2,55900,1,
+55901,3,55899,3,0,1,
+55901,4,2,49020,3,0,1,
+55903,1,55892,1,
+55903,2,11,55902,1,
+55903,3,55892,4,0,1,
+55903,4,11,43803,2,0,1,
+55921,1,55900,1,
+55921,2,21,55920,1,
+55921,3,55900,4,0,1,
+55921,4,21,43101,8,0,1,
+55927,1,55924,1,
+55927,2,3,55925,1,
+55927,3,55924,4,0,1,
+55927,4,3,35633,3,0,1,
+55931,1,55925,1,
+55931,2,6,55929,1,
+55931,3,55925,1,0,1,
+55931,4,6,52723,0,0,1,
+55933,1,55931,1,
+55933,2,2,55932,1,
+55933,3,55931,2,0,1,
+55933,4,2,48082,6,0,1,
+55949,1,55947,1,
+55949,2,2,55945,1,
+55949,3,55947,3,0,1,
+55949,4,2,28239,1,0,1,
+55967,1,55962,1,
+55967,2,5,55966,1,
+55967,3,55962,1,0,1,
+55967,4,5,42501,5,0,1,
+55987,1,55985,1,
+55987,2,2,55983,1,
+55987,3,55985,6,0,1,
+55987,4,2,36179,8,0,1,
+55997,1,55995,1,
+55997,2,2,55993,1,
+55997,3,55995,3,0,1,
+55997,4,2,37684,12,0,1,
+56003,1,56001,1,
+56003,2,2,56002,1,
+56003,3,56001,2,0,1,
+56003,4,2,43720,2,0,1,
+56009,1,56006,1,
+56009,2,3,56001,1,
+56009,3,56006,3,0,1,
+56009,4,3,43639,2,0,1,
+56039,1,56032,1,
+56039,2,7,56038,1,
+56039,3,56032,3,0,1,
+56039,4,7,56030,4,0,1,
+56041,1,56034,1,
+56041,2,7,56034,1,
+56041,3,56034,5,0,1,
+56041,4,7,40523,0,0,1,
+56053,1,56051,1,
+56053,2,2,56049,1,
+56053,3,56051,6,0,1,
+56053,4,2,49665,9,0,1,
+56081,1,56078,1,
+56081,2,3,56069,1,
+56081,3,56078,6,0,1,
+56081,4,3,49974,0,0,1,
+56087,1,56082,1,
+56087,2,5,56085,1,
+56087,3,56082,1,0,1,
+56087,4,5,54608,5,0,1,
+56093,1,56091,1,
+56093,2,2,56089,1,
+56093,3,56091,3,0,1,
+56093,4,2,50569,6,0,1,
+56099,1,56097,1,
+56099,2,2,56093,1,
+56099,3,56097,2,0,1,
+56099,4,2,42982,4,0,1,
+56101,1,56094,1,
+56101,2,7,56099,1,
+56101,3,56094,4,0,1,
+56101,4,7,44663,15,0,1,
+56113,1,56108,1,
+56113,2,5,56110,1,
+56113,3,56108,8,0,1,
+56113,4,5,51606,16,0,1,
+56123,1,56121,1,
+56123,2,2,56119,1,
+56123,3,56121,3,0,1,
+56123,4,2,43350,8,0,1,
+56131,1,56129,1,
+56131,2,2,56130,1,
+56131,3,56129,6,0,1,
+56131,4,2,54390,2,0,1,
+56149,1,56143,1,
+56149,2,6,56141,1,
+56149,3,56143,4,0,1,
+56149,4,6,55201,0,0,1,
+56167,1,56164,1,
+56167,2,3,56165,1,
+56167,3,56164,4,0,1,
+56167,4,3,55693,3,0,1,
+56171,1,56169,1,
+56171,2,2,56170,1,
+56171,3,56169,4,0,1,
+56171,4,2,29334,2,0,1,
+56179,1,56176,1,
+56179,2,3,56174,1,
+56179,3,56176,1,0,1,
+56179,4,3,54503,3,0,1,
+56197,1,56184,1,
+56197,2,13,56196,1,
+56197,3,56184,2,0,1,
+56197,4,13,52594,3,0,1,
+56207,1,56202,1,
+56207,2,5,56205,1,
+56207,3,56202,1,0,1,
+56207,4,5,56203,3,0,1,
+56209,1,56202,1,
+56209,2,7,56202,1,
+56209,3,56202,3,0,1,
+56209,4,7,54847,0,0,1,
+56237,1,56235,1,
+56237,2,2,56236,1,
+56237,3,56235,3,0,1,
+56237,4,2,51506,6,0,1,
+56239,1,56236,1,
+56239,2,3,56237,1,
+56239,3,56236,3,0,1,
+56239,4,3,42826,3,0,1,
+56249,1,56246,1,
+56249,2,3,56244,1,
+56249,3,56246,3,0,1,
+56249,4,3,51793,2,0,1,
+56263,1,56260,1,
+56263,2,3,56261,1,
+56263,3,56260,1,0,1,
+56263,4,3,56259,4,0,1,
+56267,1,56265,1,
+56267,2,2,56263,1,
+56267,3,56265,3,0,1,
+56267,4,2,47807,7,0,1,
+56269,1,56267,1,
+56269,2,2,56268,1,
+56269,3,56267,6,0,1,
+56269,4,2,40885,7,0,1,
+56299,1,56289,1,
+56299,2,10,56297,1,
+56299,3,56289,6,0,1,
+56299,4,10,47088,0,0,1,
+56311,1,56305,1,
+56311,2,6,56310,1,
+56311,3,56305,3,0,1,
+56311,4,6,48710,6,0,1,
+56333,1,56331,1,
+56333,2,2,56328,1,
+56333,3,56331,13,0,1,
+56333,4,2,44573,0,0,1,
+56359,1,56356,1,
+56359,2,3,56358,1,
+56359,3,56356,3,0,1,
+56359,4,3,41399,2,0,1,
+56369,1,56366,1,
+56369,2,3,56363,1,
+56369,3,56366,4,0,1,
+56369,4,3,56357,0,0,1,
+56377,1,56372,1,
+56377,2,5,56374,1,
+56377,3,56372,1,0,1,
+56377,4,5,53649,23,0,1,
+56383,1,56380,1,
+56383,2,3,56382,1,
+56383,3,56380,1,0,1,
+56383,4,3,43205,5,0,1,
+56393,1,56390,1,
+56393,2,3,56392,1,
+56393,3,56390,4,0,1,
+56393,4,3,48024,6,0,1,
+56401,1,56388,1,
+56401,2,13,56400,1,
+56401,3,56388,6,0,1,
+56401,4,13,31874,14,0,1,
+56417,1,56414,1,
+56417,2,3,56411,1,
+56417,3,56414,1,0,1,
+56417,4,3,37285,9,0,1,
+56431,1,56428,1,
+56431,2,3,56429,1,
+56431,3,56428,13,0,1,
+56431,4,3,30540,6,0,1,
+56437,1,56435,1,
+56437,2,2,56436,1,
+56437,3,56435,2,0,1,
+56437,4,2,43979,3,0,1,
+56443,1,56438,1,
+56443,2,5,56442,1,
+56443,3,56438,3,0,1,
+56443,4,5,41908,5,0,1,
+56453,1,56451,1,
+56453,2,2,56447,1,
+56453,3,56451,2,0,1,
+56453,4,2,28655,1,0,1,
+56467,1,56465,1,
+56467,2,2,56466,1,
+56467,3,56465,4,0,1,
+56467,4,2,32208,2,0,1,
+56473,1,56468,1,
+56473,2,5,56470,1,
+56473,3,56468,2,0,1,
+56473,4,5,41277,32,0,1,
+56477,1,56475,1,
+56477,2,2,56473,1,
+56477,3,56475,3,0,1,
+56477,4,2,28783,7,0,1,
+56479,1,56473,1,
+56479,2,6,56478,1,
+56479,3,56473,8,0,1,
+56479,4,6,31461,3,0,1,
+56489,1,56486,1,
+56489,2,3,56480,1,
+56489,3,56486,10,0,1,
+56489,4,3,30320,3,0,1,
+56501,1,56498,1,
+56501,2,3,56499,1,
+56501,3,56498,6,0,1,
+56501,4,3,56497,4,0,1,
+56503,1,56500,1,
+56503,2,3,56502,1,
+56503,3,56500,4,0,1,
+56503,4,3,35604,2,0,1,
+56509,1,56507,1,
+56509,2,2,56508,1,
+56509,3,56507,4,0,1,
+56509,4,2,39742,3,0,1,
+56519,1,56506,1,
+56519,2,13,56510,1,
+56519,3,56506,2,0,1,
+56519,4,13,29316,11,0,1,
+56527,1,56524,1,
+56527,2,3,56525,1,
+56527,3,56524,3,0,1,
+56527,4,3,47508,3,0,1,
+56531,1,56529,1,
+56531,2,2,56527,1,
+56531,3,56529,3,0,1,
+56531,4,2,29045,15,0,1,
+56533,1,56528,1,
+56533,2,5,56532,1,
+56533,3,56528,1,0,1,
+56533,4,5,35775,3,0,1,
+56543,1,56538,1,
+56543,2,5,56541,1,
+56543,3,56538,1,0,1,
+56543,4,5,56539,3,0,1,
+56569,1,56558,1,
+56569,2,11,56558,1,
+56569,3,56558,1,0,1,
+56569,4,11,44961,33,0,1,
+56591,1,56572,1,
+56591,2,19,56590,1,
+56591,3,56572,15,0,1,
+56591,4,19,56576,4,0,1,
+56597,1,56595,1,
+56597,2,2,56590,1,
+56597,3,56595,5,0,1,
+56597,4,2,45525,5,0,1,
+56599,1,56596,1,
+56599,2,3,56597,1,
+56599,3,56596,3,0,1,
+56599,4,3,56595,4,0,1,
+56611,1,56585,1,
+56611,2,26,56609,1,
+56611,3,56585,1,0,1,
+56611,4,26,55822,0,0,1,
+56629,1,56627,1,
+56629,2,2,56628,1,
+56629,3,56627,6,0,1,
+56629,4,2,56622,8,0,1,
+56633,1,56630,1,
+56633,2,3,56628,1,
+56633,3,56630,1,0,1,
+56633,4,3,31538,0,0,1,
+56659,1,56657,1,
+56659,2,2,56655,1,
+56659,3,56657,6,0,1,
+56659,4,2,47043,8,0,1,
+56663,1,56658,1,
+56663,2,5,56661,1,
+56663,3,56658,1,0,1,
+56663,4,5,56659,3,0,1,
+56671,1,56668,1,
+56671,2,3,56670,1,
+56671,3,56668,3,0,1,
+56671,4,3,45827,2,0,1,
+56681,1,56678,1,
+56681,2,3,56675,1,
+56681,3,56678,4,0,1,
+56681,4,3,56669,0,0,1,
+56687,1,56682,1,
+56687,2,5,56686,1,
+56687,3,56682,3,0,1,
+56687,4,5,44288,4,0,1,
+56701,1,56699,1,
+56701,2,2,56697,1,
+56701,3,56699,2,0,1,
+56701,4,2,53689,6,0,1,
+56711,1,56704,1,
+56711,2,7,56710,1,
+56711,3,56704,1,0,1,
+56711,4,7,48465,2,0,1,
+56713,1,56708,1,
+56713,2,5,56710,1,
+56713,3,56708,6,0,1,
+56713,4,5,41674,10,0,1,
+56731,1,56729,1,
+56731,2,2,56730,1,
+56731,3,56729,6,0,1,
+56731,4,2,30326,6,0,1,
+56737,1,56727,1,
+56737,2,10,56736,1,
+56737,3,56727,10,0,1,
+56737,4,10,51769,12,0,1,
+56747,1,56745,1,
+56747,2,2,56743,1,
+56747,3,56745,3,0,1,
+56747,4,2,47524,7,0,1,
+56767,1,56764,1,
+56767,2,3,56766,1,
+56767,3,56764,3,0,1,
+56767,4,3,31734,17,0,1,
+56773,1,56771,1,
+56773,2,2,56772,1,
+56773,3,56771,4,0,1,
+56773,4,2,42713,3,0,1,
+56779,1,56777,1,
+56779,2,2,56775,1,
+56779,3,56777,2,0,1,
+56779,4,2,49583,8,0,1,
+56783,1,56778,1,
+56783,2,5,56781,1,
+56783,3,56778,5,0,1,
+56783,4,5,36408,9,0,1,
+56807,1,56802,1,
+56807,2,5,56802,1,
+56807,3,56802,2,0,1,
+56807,4,5,39806,8,0,1,
+56809,1,56792,1,
+56809,2,17,56802,1,
+56809,3,56792,1,0,1,
+56809,4,17,56790,26,0,1,
+56813,1,56810,1,
+56813,2,3,56811,1,
+56813,3,56810,6,0,1,
+56813,4,3,55747,14,0,1,
+56821,1,56815,1,
+56821,2,6,56820,1,
+56821,3,56815,4,0,1,
+56821,4,6,49900,7,0,1,
+56827,1,56825,1,
+56827,2,2,56823,1,
+56827,3,56825,4,0,1,
+56827,4,2,39738,8,0,1,
+56843,1,56841,1,
+56843,2,2,56839,1,
+56843,3,56841,2,0,1,
+56843,4,2,48461,7,0,1,
+56857,1,56850,1,
+56857,2,7,56850,1,
+56857,3,56850,1,0,1,
+56857,4,7,35829,12,0,1,
+56873,1,56870,1,
+56873,2,3,56868,1,
+56873,3,56870,3,0,1,
+56873,4,3,31446,0,0,1,
+56891,1,56889,1,
+56891,2,2,56887,1,
+56891,3,56889,2,0,1,
+56891,4,2,32887,8,0,1,
+56893,1,56891,1,
+56893,2,2,56889,1,
+56893,3,56891,8,0,1,
+56893,4,2,36782,6,0,1,
+56897,1,56892,1,
+56897,2,5,56892,1,
+56897,3,56892,6,0,1,
+56897,4,5,49662,8,0,1,
+56909,1,56907,1,
+56909,2,2,56908,1,
+56909,3,56907,4,0,1,
+56909,4,2,56902,8,0,1,
+56911,1,56908,1,
+56911,2,3,56910,1,
+56911,3,56908,1,0,1,
+56911,4,3,31894,3,0,1,
+56921,1,56918,1,
+56921,2,3,56920,1,
+56921,3,56918,13,0,1,
+56921,4,3,40471,7,0,1,
+56923,1,56920,1,
+56923,2,3,56914,1,
+56923,3,56920,3,0,1,
+56923,4,3,47329,4,0,1,
+56929,1,56915,1,
+56929,2,14,56924,1,
+56929,3,56915,1,0,1,
+56929,4,14,29755,12,0,1,
+56941,1,56939,1,
+56941,2,2,56940,1,
+56941,3,56939,6,0,1,
+56941,4,2,31538,9,0,1,
+56951,1,56938,1,
+56951,2,13,56950,1,
+56951,3,56938,1,0,1,
+56951,4,13,38438,2,0,1,
+56957,1,56955,1,
+56957,2,2,56953,1,
+56957,3,56955,2,0,1,
+56957,4,2,30493,1,0,1,
+56963,1,56961,1,
+56963,2,2,56951,1,
+56963,3,56961,4,0,1,
+56963,4,2,52095,6,0,1,
+56983,1,56980,1,
+56983,2,3,56981,1,
+56983,3,56980,8,0,1,
+56983,4,3,36515,3,0,1,
+56989,1,56983,1,
+56989,2,6,56985,1,
+56989,3,56983,2,0,1,
+56989,4,6,29829,2,0,1,
+56993,1,56990,1,
+56993,2,3,56987,1,
+56993,3,56990,6,0,1,
+56993,4,3,38637,1,0,1,
+56999,1,56986,1,
+56999,2,13,56995,1,
+56999,3,56986,1,0,1,
+56999,4,13,56981,13,0,1,
+57037,1,57032,1,
+57037,2,5,57034,1,
+57037,3,57032,1,0,1,
+57037,4,5,55996,1,0,1,
+57041,1,57030,1,
+57041,2,11,57038,1,
+57041,3,57030,12,0,1,
+57041,4,11,34827,6,0,1,
+57047,1,57040,1,
+57047,2,7,57046,1,
+57047,3,57040,1,0,1,
+57047,4,7,34431,3,0,1,
+57059,1,57057,1,
+57059,2,2,57054,1,
+57059,3,57057,2,0,1,
+57059,4,2,39457,3,0,1,
+57073,1,57068,1,
+57073,2,5,57068,1,
+57073,3,57068,3,0,1,
+57073,4,5,44036,10,0,1,
+57077,1,57075,1,
+57077,2,2,57076,1,
+57077,3,57075,3,0,1,
+57077,4,2,29715,6,0,1,
+57089,1,57086,1,
+57089,2,3,57088,1,
+57089,3,57086,1,0,1,
+57089,4,3,56751,7,0,1,
+57097,1,57090,1,
+57097,2,7,57094,1,
+57097,3,57090,1,0,1,
+57097,4,7,39494,13,0,1,
+57107,1,57105,1,
+57107,2,2,57103,1,
+57107,3,57105,3,0,1,
+57107,4,2,40016,7,0,1,
+57119,1,57100,1,
+57119,2,19,57117,1,
+57119,3,57100,5,0,1,
+57119,4,19,55685,3,0,1,
+57131,1,57129,1,
+57131,2,2,57127,1,
+57131,3,57129,7,0,1,
+57131,4,2,36157,7,0,1,
+57139,1,57137,1,
+57139,2,2,57138,1,
+57139,3,57137,6,0,1,
+57139,4,2,30322,6,0,1,
+57143,1,57138,1,
+57143,2,5,57135,1,
+57143,3,57138,9,0,1,
+57143,4,5,36287,3,0,1,
+57149,1,57147,1,
+57149,2,2,57141,1,
+57149,3,57147,4,0,1,
+57149,4,2,47915,0,0,1,
+57163,1,57161,1,
+57163,2,2,57159,1,
+57163,3,57161,6,0,1,
+57163,4,2,36804,8,0,1,
+57173,1,57171,1,
+57173,2,2,57169,1,
+57173,3,57171,4,0,1,
+57173,4,2,38644,7,0,1,
+57179,1,57177,1,
+57179,2,2,57178,1,
+57179,3,57177,4,0,1,
+57179,4,2,52261,2,0,1,
+57191,1,57184,1,
+57191,2,7,57189,1,
+57191,3,57184,4,0,1,
+57191,4,7,42241,5,0,1,
+57193,1,57188,1,
+57193,2,5,57192,1,
+57193,3,57188,2,0,1,
+57193,4,5,39799,15,0,1,
+57203,1,57201,1,
+57203,2,2,57202,1,
+57203,3,57201,2,0,1,
+57203,4,2,52152,10,0,1,
+57221,1,57219,1,
+57221,2,2,57215,1,
+57221,3,57219,4,0,1,
+57221,4,2,31351,3,0,1,
+57223,1,57220,1,
+57223,2,3,57221,1,
+57223,3,57220,7,0,1,
+57223,4,3,42759,3,0,1,
+57241,1,57230,1,
+57241,2,11,57240,1,
+57241,3,57230,3,0,1,
+57241,4,11,46815,20,0,1,
+57251,1,57249,1,
+57251,2,2,57246,1,
+57251,3,57249,7,0,1,
+57251,4,2,45427,3,0,1,
+57259,1,57257,1,
+57259,2,2,57258,1,
+57259,3,57257,4,0,1,
+57259,4,2,35735,2,0,1,
+57269,1,57267,1,
+57269,2,2,57265,1,
+57269,3,57267,2,0,1,
+57269,4,2,36576,12,0,1,
+57271,1,57268,1,
+57271,2,3,57269,1,
+57271,3,57268,7,0,1,
+57271,4,3,49860,6,0,1,
+57283,1,57281,1,
+57283,2,2,57279,1,
+57283,3,57281,6,0,1,
+57283,4,2,50812,8,0,1,
+57287,1,57282,1,
+57287,2,5,57286,1,
+57287,3,57282,1,0,1,
+57287,4,5,38078,7,0,1,
+57301,1,57295,1,
+57301,2,6,57297,1,
+57301,3,57295,2,0,1,
+57301,4,6,37913,2,0,1,
+57329,1,57326,1,
+57329,2,3,57323,1,
+57329,3,57326,1,0,1,
+57329,4,3,57317,0,0,1,
+57331,1,57329,1,
+57331,2,2,57327,1,
+57331,3,57329,4,0,1,
+57331,4,2,51427,8,0,1,
+57347,1,57345,1,
+57347,2,2,57346,1,
+57347,3,57345,2,0,1,
+57347,4,2,57340,8,0,1,
+57349,1,57347,1,
+57349,2,2,57343,1,
+57349,3,57347,6,0,1,
+57349,4,2,49578,8,0,1,
+57367,1,57364,1,
+57367,2,3,57366,1,
+57367,3,57364,6,0,1,
+57367,4,3,55950,5,0,1,
+57373,1,57371,1,
+57373,2,2,57369,1,
+57373,3,57371,5,0,1,
+57373,4,2,31513,15,0,1,
+57383,1,57378,1,
+57383,2,5,57382,1,
+57383,3,57378,15,0,1,
+57383,4,5,37502,4,0,1,
+57389,1,57387,1,
+57389,2,2,57388,1,
+57389,3,57387,3,0,1,
+57389,4,2,47299,3,0,1,
+57397,1,57395,1,
+57397,2,2,57393,1,
+57397,3,57395,6,0,1,
+57397,4,2,47519,6,0,1,
+57413,1,57411,1,
+57413,2,2,57407,1,
+57413,3,57411,4,0,1,
+57413,4,2,55753,14,0,1,
+57427,1,57425,1,
+57427,2,2,57426,1,
+57427,3,57425,4,0,1,
+57427,4,2,55666,10,0,1,
+57457,1,57452,1,
+57457,2,5,57452,1,
+57457,3,57452,13,0,1,
+57457,4,5,45768,10,0,1,
+57467,1,57465,1,
+57467,2,2,57463,1,
+57467,3,57465,3,0,1,
+57467,4,2,52560,7,0,1,
+57487,1,57481,1,
+57487,2,6,57486,1,
+57487,3,57481,8,0,1,
+57487,4,6,42883,3,0,1,
+57493,1,57488,1,
+57493,2,5,57492,1,
+57493,3,57488,5,0,1,
+57493,4,5,44338,6,0,1,
+57503,1,57498,1,
+57503,2,5,57501,1,
+57503,3,57498,2,0,1,
+57503,4,5,57491,11,0,1,
+57527,1,57522,1,
+57527,2,5,57526,1,
+57527,3,57522,1,0,1,
+57527,4,5,34433,2,0,1,
+57529,1,57522,1,
+57529,2,7,57518,1,
+57529,3,57522,1,0,1,
+57529,4,7,29315,0,0,1,
+57557,1,57555,1,
+57557,2,2,57553,1,
+57557,3,57555,2,0,1,
+57557,4,2,44691,1,0,1,
+57559,1,57553,1,
+57559,2,6,57550,1,
+57559,3,57553,3,0,1,
+57559,4,6,38120,11,0,1,
+57571,1,57558,1,
+57571,2,13,57568,1,
+57571,3,57558,2,0,1,
+57571,4,13,56016,4,0,1,
+57587,1,57585,1,
+57587,2,2,57586,1,
+57587,3,57585,2,0,1,
+57587,4,2,48928,2,0,1,
+57593,1,57590,1,
+57593,2,3,57587,1,
+57593,3,57590,1,0,1,
+57593,4,3,50111,9,0,1,
+57601,1,57594,1,
+57601,2,7,57598,1,
+57601,3,57594,5,0,1,
+57601,4,7,51952,16,0,1,
+57637,1,57635,1,
+57637,2,2,57633,1,
+57637,3,57635,2,0,1,
+57637,4,2,54068,6,0,1,
+57641,1,57638,1,
+57641,2,3,57629,1,
+57641,3,57638,10,0,1,
+57641,4,3,50846,0,0,1,
+57649,1,57636,1,
+57649,2,13,57640,1,
+57649,3,57636,2,0,1,
+57649,4,13,47197,28,0,1,
+57653,1,57651,1,
+57653,2,2,57649,1,
+57653,3,57651,3,0,1,
+57653,4,2,43843,7,0,1,
+57667,1,57664,1,
+57667,2,3,57650,1,
+57667,3,57664,3,0,1,
+57667,4,3,41653,6,0,1,
+57679,1,57676,1,
+57679,2,3,57678,1,
+57679,3,57676,1,0,1,
+57679,4,3,54439,3,0,1,
+57689,1,57686,1,
+57689,2,3,57683,1,
+57689,3,57686,5,0,1,
+57689,4,3,57677,0,0,1,
+57697,1,57692,1,
+57697,2,5,57696,1,
+57697,3,57692,2,0,1,
+57697,4,5,50189,6,0,1,
+57709,1,57707,1,
+57709,2,2,57705,1,
+57709,3,57707,2,0,1,
+57709,4,2,51030,6,0,1,
+57713,1,57710,1,
+57713,2,3,57712,1,
+57713,3,57710,1,0,1,
+57713,4,3,39774,4,0,1,
+57719,1,57712,1,
+57719,2,7,57717,1,
+57719,3,57712,10,0,1,
+57719,4,7,39353,7,0,1,
+57727,1,57724,1,
+57727,2,3,57726,1,
+57727,3,57724,4,0,1,
+57727,4,3,33496,5,0,1,
+57731,1,57729,1,
+57731,2,2,57724,1,
+57731,3,57729,2,0,1,
+57731,4,2,50693,1,0,1,
+57737,1,57734,1,
+57737,2,3,57731,1,
+57737,3,57734,5,0,1,
+57737,4,3,53953,11,0,1,
+57751,1,57745,1,
+57751,2,6,57750,1,
+57751,3,57745,2,0,1,
+57751,4,6,52885,3,0,1,
+57773,1,57770,1,
+57773,2,3,57771,1,
+57773,3,57770,11,0,1,
+57773,4,3,57769,4,0,1,
+57781,1,57775,1,
+57781,2,6,57780,1,
+57781,3,57775,1,0,1,
+57781,4,6,54988,19,0,1,
+57787,1,57785,1,
+57787,2,2,57783,1,
+57787,3,57785,6,0,1,
+57787,4,2,31258,8,0,1,
+57791,1,57765,1,
+57791,2,26,57784,1,
+57791,3,57765,2,0,1,
+57791,4,26,45332,8,0,1,
+57793,1,57788,1,
+57793,2,5,57792,1,
+57793,3,57788,2,0,1,
+57793,4,5,29330,6,0,1,
+57803,1,57801,1,
+57803,2,2,57799,1,
+57803,3,57801,3,0,1,
+57803,4,2,35996,8,0,1,
+57809,1,57806,1,
+57809,2,3,57804,1,
+57809,3,57806,3,0,1,
+57809,4,3,47249,2,0,1,
+57829,1,57819,1,
+57829,2,10,57828,1,
+57829,3,57819,7,0,1,
+57829,4,10,39378,3,0,1,
+57839,1,57828,1,
+57839,2,11,57837,1,
+57839,3,57828,4,0,1,
+57839,4,11,47367,3,0,1,
+57847,1,57844,1,
+57847,2,3,57845,1,
+57847,3,57844,6,0,1,
+57847,4,3,49112,6,0,1,
+57853,1,57848,1,
+57853,2,5,57848,1,
+57853,3,57848,1,0,1,
+57853,4,5,43173,10,0,1,
+57859,1,57857,1,
+57859,2,2,57855,1,
+57859,3,57857,6,0,1,
+57859,4,2,31091,8,0,1,
+57881,1,57878,1,
+57881,2,3,57876,1,
+57881,3,57878,4,0,1,
+57881,4,3,57343,2,0,1,
+57899,1,57897,1,
+57899,2,2,57895,1,
+57899,3,57897,11,0,1,
+57899,4,2,36940,8,0,1,
+57901,1,57899,1,
+57901,2,2,57897,1,
+57901,3,57899,2,0,1,
+57901,4,2,43209,12,0,1,
+57917,1,57915,1,
+57917,2,2,57911,1,
+57917,3,57915,2,0,1,
+57917,4,2,43655,1,0,1,
+57923,1,57921,1,
+57923,2,2,57922,1,
+57923,3,57921,3,0,1,
+57923,4,2,57916,8,0,1,
+57943,1,57938,1,
+57943,2,5,57942,1,
+57943,3,57938,3,0,1,
+57943,4,5,48885,5,0,1,
+57947,1,57942,1,
+57947,2,5,57935,1,
+57947,3,57942,6,0,1,
+57947,4,5,56021,5,0,1,
+57973,1,57968,1,
+57973,2,5,57968,1,
+57973,3,57968,6,0,1,
+57973,4,5,53894,7,0,1,
+57977,1,57974,1,
+57977,2,3,57976,1,
+57977,3,57974,5,0,1,
+57977,4,3,32248,6,0,1,
+57991,1,57985,1,
+57991,2,6,57989,1,
+57991,3,57985,3,0,1,
+57991,4,6,46233,3,0,1,
+58013,1,58011,1,
+58013,2,2,58009,1,
+58013,3,58011,3,0,1,
+58013,4,2,34641,7,0,1,
+58027,1,58025,1,
+58027,2,2,58023,1,
+58027,3,58025,6,0,1,
+58027,4,2,53939,8,0,1,
+58031,1,58024,1,
+58031,2,7,58029,1,
+58031,3,58024,2,0,1,
+58031,4,7,46714,5,0,1,
+58043,1,58041,1,
+58043,2,2,58042,1,
+58043,3,58041,2,0,1,
+58043,4,2,49155,4,0,1,
+58049,1,58046,1,
+58049,2,3,58043,1,
+58049,3,58046,1,0,1,
+58049,4,3,58037,0,0,1,
+58057,1,58050,1,
+58057,2,7,58050,1,
+58057,3,58050,7,0,1,
+58057,4,7,30538,14,0,1,
+58061,1,58058,1,
+58061,2,3,58054,1,
+58061,3,58058,1,0,1,
+58061,4,3,38376,4,0,1,
+58067,1,58065,1,
+58067,2,2,58063,1,
+58067,3,58065,3,0,1,
+58067,4,2,55226,8,0,1,
+58073,1,58068,1,
+58073,2,5,58068,1,
+58073,3,58068,3,0,1,
+58073,4,5,38829,2,0,1,
+58099,1,58089,1,
+58099,2,10,58098,1,
+58099,3,58089,3,0,1,
+58099,4,10,38520,2,0,1,
+58109,1,58107,1,
+58109,2,2,58104,1,
+58109,3,58107,3,0,1,
+58109,4,2,48748,8,0,1,
+58111,1,58099,1,
+58111,2,12,58110,1,
+58111,3,58099,3,0,1,
+58111,4,12,34656,5,0,1,
+58129,1,58116,1,
+58129,2,13,58116,1,
+58129,3,58116,2,0,1,
+58129,4,13,58090,0,0,1,
+58147,1,58144,1,
+58147,2,3,58142,1,
+58147,3,58144,4,0,1,
+58147,4,3,46811,3,0,1,
+58151,1,58144,1,
+58151,2,7,58150,1,
+58151,3,58144,1,0,1,
+58151,4,7,40891,2,0,1,
+58153,1,58143,1,
+58153,2,10,58148,1,
+58153,3,58143,5,0,1,
+58153,4,10,39832,0,0,1,
+58169,1,58163,1,
+58169,2,6,58163,1,
+58169,3,58163,4,0,1,
+58169,4,6,43378,0,0,1,
+58171,1,58169,1,
+58171,2,2,58167,1,
+58171,3,58169,2,0,1,
+58171,4,2,51474,8,0,1,
+58189,1,58183,1,
+58189,2,6,58188,1,
+58189,3,58183,1,0,1,
+58189,4,6,48887,8,0,1,
+58193,1,58190,1,
+58193,2,3,58186,1,
+58193,3,58190,1,0,1,
+58193,4,3,56340,1,0,1,
+58199,1,58192,1,
+58199,2,7,58197,1,
+58199,3,58192,2,0,1,
+58199,4,7,42928,4,0,1,
+58207,1,58202,1,
+58207,2,5,58206,1,
+58207,3,58202,3,0,1,
+58207,4,5,32800,2,0,1,
+58211,1,58209,1,
+58211,2,2,58207,1,
+58211,3,58209,3,0,1,
+58211,4,2,43921,15,0,1,
+58217,1,58214,1,
+58217,2,3,58211,1,
+58217,3,58214,1,0,1,
+58217,4,3,48348,1,0,1,
+58229,1,58227,1,
+58229,2,2,58225,1,
+58229,3,58227,3,0,1,
+58229,4,2,51018,1,0,1,
+58231,1,58225,1,
+58231,2,6,58229,1,
+58231,3,58225,1,0,1,
+58231,4,6,53033,3,0,1,
+58237,1,58222,1,
+58237,2,15,58235,1,
+58237,3,58222,3,0,1,
+58237,4,15,31925,0,0,1,
+58243,1,58241,1,
+58243,2,2,58242,1,
+58243,3,58241,2,0,1,
+58243,4,2,57340,2,0,1,
+58271,1,58260,1,
+58271,2,11,58267,1,
+58271,3,58260,2,0,1,
+58271,4,11,37635,5,0,1,
+58309,1,58303,1,
+58309,2,6,58305,1,
+58309,3,58303,4,0,1,
+58309,4,6,58301,12,0,1,
+58313,1,58310,1,
+58313,2,3,58308,1,
+58313,3,58310,1,0,1,
+58313,4,3,35319,0,0,1,
+58321,1,58310,1,
+58321,2,11,58316,1,
+58321,3,58310,2,0,1,
+58321,4,11,58302,24,0,1,
+58337,1,58334,1,
+58337,2,3,58332,1,
+58337,3,58334,3,0,1,
+58337,4,3,29604,0,0,1,
+58363,1,58361,1,
+58363,2,2,58359,1,
+58363,3,58361,5,0,1,
+58363,4,2,41459,8,0,1,
+58367,1,58360,1,
+58367,2,7,58365,1,
+58367,3,58360,2,0,1,
+58367,4,7,43398,4,0,1,
+58369,1,58362,1,
+58369,2,7,58362,1,
+58369,3,58362,1,0,1,
+58369,4,7,30188,0,0,1,
+58379,1,58377,1,
+58379,2,2,58378,1,
+58379,3,58377,7,0,1,
+58379,4,2,57542,4,0,1,
+58391,1,58380,1,
+58391,2,11,58389,1,
+58391,3,58380,11,0,1,
+58391,4,11,55344,3,0,1,
+58393,1,58388,1,
+58393,2,5,58388,1,
+58393,3,58388,2,0,1,
+58393,4,5,44634,10,0,1,
+58403,1,58401,1,
+58403,2,2,58399,1,
+58403,3,58401,3,0,1,
+58403,4,2,35770,7,0,1,
+58411,1,58409,1,
+58411,2,2,58410,1,
+58411,3,58409,4,0,1,
+58411,4,2,31595,6,0,1,
+58417,1,58412,1,
+58417,2,5,58414,1,
+58417,3,58412,6,0,1,
+58417,4,5,58406,14,0,1,
+58427,1,58425,1,
+58427,2,2,58423,1,
+58427,3,58425,3,0,1,
+58427,4,2,47674,7,0,1,
+58439,1,58422,1,
+58439,2,17,58435,1,
+58439,3,58422,2,0,1,
+58439,4,17,33992,7,0,1,
+58441,1,58428,1,
+58441,2,13,58440,1,
+58441,3,58428,1,0,1,
+58441,4,13,40655,14,0,1,
+58451,1,58441,1,
+58451,2,10,58449,1,
+58451,3,58441,3,0,1,
+58451,4,10,58433,11,0,1,
+58453,1,58451,1,
+58453,2,2,58452,1,
+58453,3,58451,2,0,1,
+58453,4,2,53853,3,0,1,
+58477,1,58472,1,
+58477,2,5,58476,1,
+58477,3,58472,1,0,1,
+58477,4,5,42959,3,0,1,
+58481,1,58475,1,
+58481,2,6,58480,1,
+58481,3,58475,2,0,1,
+58481,4,6,29511,4,0,1,
+58511,1,58498,1,
+58511,2,13,58506,1,
+58511,3,58498,13,0,1,
+58511,4,13,41376,6,0,1,
+58537,1,58530,1,
+58537,2,7,58530,1,
+58537,3,58530,3,0,1,
+58537,4,7,48187,17,0,1,
+58543,1,58537,1,
+58543,2,6,58540,1,
+58543,3,58537,2,0,1,
+58543,4,6,53814,4,0,1,
+58549,1,58547,1,
+58549,2,2,58545,1,
+58549,3,58547,2,0,1,
+58549,4,2,58008,12,0,1,
+58567,1,58561,1,
+58567,2,6,58564,1,
+58567,3,58561,1,0,1,
+58567,4,6,34218,7,0,1,
+58573,1,58571,1,
+58573,2,2,58569,1,
+58573,3,58571,6,0,1,
+58573,4,2,54611,19,0,1,
+58579,1,58577,1,
+58579,2,2,58578,1,
+58579,3,58577,5,0,1,
+58579,4,2,35266,2,0,1,
+58601,1,58598,1,
+58601,2,3,58595,1,
+58601,3,58598,6,0,1,
+58601,4,3,58589,0,0,1,
+58603,1,58601,1,
+58603,2,2,58602,1,
+58603,3,58601,2,0,1,
+58603,4,2,38029,2,0,1,
+58613,1,58611,1,
+58613,2,2,58606,1,
+58613,3,58611,4,0,1,
+58613,4,2,37260,5,0,1,
+58631,1,58612,1,
+58631,2,19,58627,1,
+58631,3,58612,1,0,1,
+58631,4,19,53136,5,0,1,
+58657,1,58652,1,
+58657,2,5,58652,1,
+58657,3,58652,2,0,1,
+58657,4,5,43645,15,0,1,
+58661,1,58659,1,
+58661,2,2,58657,1,
+58661,3,58659,2,0,1,
+58661,4,2,56239,6,0,1,
+58679,1,58668,1,
+58679,2,11,58678,1,
+58679,3,58668,14,0,1,
+58679,4,11,43631,2,0,1,
+58687,1,58681,1,
+58687,2,6,58686,1,
+58687,3,58681,2,0,1,
+58687,4,6,46188,10,0,1,
+58693,1,58691,1,
+58693,2,2,58692,1,
+58693,3,58691,2,0,1,
+58693,4,2,35548,3,0,1,
+58699,1,58697,1,
+58699,2,2,58693,1,
+58699,3,58697,5,0,1,
+58699,4,2,46234,7,0,1,
+58711,1,58705,1,
+58711,2,6,58710,1,
+58711,3,58705,1,0,1,
+58711,4,6,50134,3,0,1,
+58727,1,58722,1,
+58727,2,5,58725,1,
+58727,3,58722,3,0,1,
+58727,4,5,58723,3,0,1,
+58733,1,58731,1,
+58733,2,2,58732,1,
+58733,3,58731,3,0,1,
+58733,4,2,51995,6,0,1,
+58741,1,58739,1,
+58741,2,2,58737,1,
+58741,3,58739,6,0,1,
+58741,4,2,51466,6,0,1,
+58757,1,58755,1,
+58757,2,2,58756,1,
+58757,3,58755,2,0,1,
+58757,4,2,57521,3,0,1,
+58763,1,58761,1,
+58763,2,2,58762,1,
+58763,3,58761,3,0,1,
+58763,4,2,33436,4,0,1,
+58771,1,58760,1,
+58771,2,11,58770,1,
+58771,3,58760,1,0,1,
+58771,4,11,31439,2,0,1,
+58787,1,58785,1,
+58787,2,2,58783,1,
+58787,3,58785,3,0,1,
+58787,4,2,53034,13,0,1,
+58789,1,58787,1,
+58789,2,2,58788,1,
+58789,3,58787,5,0,1,
+58789,4,2,43414,9,0,1,
+58831,1,58820,1,
+58831,2,11,58830,1,
+58831,3,58820,1,0,1,
+58831,4,11,49291,2,0,1,
+58889,1,58886,1,
+58889,2,3,58888,1,
+58889,3,58886,5,0,1,
+58889,4,3,55753,4,0,1,
+58897,1,58892,1,
+58897,2,5,58892,1,
+58897,3,58892,6,0,1,
+58897,4,5,42970,15,0,1,
+58901,1,58899,1,
+58901,2,2,58900,1,
+58901,3,58899,9,0,1,
+58901,4,2,44936,3,0,1,
+58907,1,58905,1,
+58907,2,2,58901,1,
+58907,3,58905,4,0,1,
+58907,4,2,33592,7,0,1,
+58909,1,58907,1,
+58909,2,2,58905,1,
+58909,3,58907,2,0,1,
+58909,4,2,49635,12,0,1,
+58913,1,58910,1,
+58913,2,3,58912,1,
+58913,3,58910,5,0,1,
+58913,4,3,31211,7,0,1,
+58921,1,58908,1,
+58921,2,13,58908,1,
+58921,3,58908,15,0,1,
+58921,4,13,58882,0,0,1,
+58937,1,58934,1,
+58937,2,3,58936,1,
+58937,3,58934,1,0,1,
+58937,4,3,33022,11,0,1,
+58943,1,58938,1,
+58943,2,5,58938,1,
+58943,3,58938,2,0,1,
+58943,4,5,44689,6,0,1,
+58963,1,58960,1,
+58963,2,3,58958,1,
+58963,3,58960,6,0,1,
+58963,4,3,52617,6,0,1,
+58967,1,58962,1,
+58967,2,5,58966,1,
+58967,3,58962,3,0,1,
+58967,4,5,57572,7,0,1,
+58979,1,58977,1,
+58979,2,2,58975,1,
+58979,3,58977,3,0,1,
+58979,4,2,37095,7,0,1,
+58991,1,58984,1,
+58991,2,7,58990,1,
+58991,3,58984,8,0,1,
+58991,4,7,58982,4,0,1,
+58997,1,58994,1,
+58997,2,3,58995,1,
+58997,3,58994,5,0,1,
+58997,4,3,41475,14,0,1,
+59009,1,59006,1,
+59009,2,3,59002,1,
+59009,3,59006,1,0,1,
+59009,4,3,41755,4,0,1,
+59011,1,59009,1,
+59011,2,2,59007,1,
+59011,3,59009,4,0,1,
+59011,4,2,46242,8,0,1,
+59021,1,59019,1,
+59021,2,2,59017,1,
+59021,3,59019,2,0,1,
+59021,4,2,44130,6,0,1,
+59023,1,59018,1,
+59023,2,5,59021,1,
+59023,3,59018,6,0,1,
+59023,4,5,59007,18,0,1,
+59029,1,59027,1,
+59029,2,2,59028,1,
+59029,3,59027,5,0,1,
+59029,4,2,52110,7,0,1,
+59051,1,59041,1,
+59051,2,10,59049,1,
+59051,3,59041,5,0,1,
+59051,4,10,59039,6,0,1,
+59053,1,59038,1,
+59053,2,15,59051,1,
+59053,3,59038,4,0,1,
+59053,4,15,42434,7,0,1,
+59063,1,59058,1,
+59063,2,5,59061,1,
+59063,3,59058,2,0,1,
+59063,4,5,59059,3,0,1,
+59069,1,59067,1,
+59069,2,2,59065,1,
+59069,3,59067,3,0,1,
+59069,4,2,47659,1,0,1,
+59077,1,59072,1,
+59077,2,5,59074,1,
+59077,3,59072,1,0,1,
+59077,4,5,32079,1,0,1,
+59083,1,59081,1,
+59083,2,2,59082,1,
+59083,3,59081,5,0,1,
+59083,4,2,31074,2,0,1,
+59093,1,59090,1,
+59093,2,3,59091,1,
+59093,3,59090,1,0,1,
+59093,4,3,35731,14,0,1,
+59107,1,59105,1,
+59107,2,2,59103,1,
+59107,3,59105,2,0,1,
+59107,4,2,45262,1,0,1,
+59113,1,59106,1,
+59113,2,7,59106,1,
+59113,3,59106,1,0,1,
+59113,4,7,49406,20,0,1,
+59119,1,59116,1,
+59119,2,3,59114,1,
+59119,3,59116,1,0,1,
+59119,4,3,42179,7,0,1,
+59123,1,59121,1,
+59123,2,2,59118,1,
+59123,3,59121,4,0,1,
+59123,4,2,56145,3,0,1,
+59141,1,59138,1,
+59141,2,3,59139,1,
+59141,3,59138,4,0,1,
+59141,4,3,39886,14,0,1,
+59149,1,59147,1,
+59149,2,2,59148,1,
+59149,3,59147,5,0,1,
+59149,4,2,58239,3,0,1,
+59159,1,59152,1,
+59159,2,7,59158,1,
+59159,3,59152,2,0,1,
+59159,4,7,59150,4,0,1,
+59167,1,59164,1,
+59167,2,3,59165,1,
+59167,3,59164,3,0,1,
+59167,4,3,59163,4,0,1,
+59183,1,59178,1,
+59183,2,5,59178,1,
+59183,3,59178,1,0,1,
+59183,4,5,47171,7,0,1,
+59197,1,59195,1,
+59197,2,2,59196,1,
+59197,3,59195,2,0,1,
+59197,4,2,30666,3,0,1,
+59207,1,59202,1,
+59207,2,5,59206,1,
+59207,3,59202,2,0,1,
+59207,4,5,44946,5,0,1,
+59209,1,59198,1,
+59209,2,11,59206,1,
+59209,3,59198,1,0,1,
+59209,4,11,29877,10,0,1,
+59219,1,59217,1,
+59219,2,2,59207,1,
+59219,3,59217,3,0,1,
+59219,4,2,51679,2,0,1,
+59221,1,59219,1,
+59221,2,2,59217,1,
+59221,3,59219,2,0,1,
+59221,4,2,45722,6,0,1,
+59233,1,59228,1,
+59233,2,5,59232,1,
+59233,3,59228,1,0,1,
+59233,4,5,39196,6,0,1,
+59239,1,59236,1,
+59239,2,3,59234,1,
+59239,3,59236,5,0,1,
+59239,4,3,36481,6,0,1,
+59243,1,59241,1,
+59243,2,2,59239,1,
+59243,3,59241,3,0,1,
+59243,4,2,54074,8,0,1,
+59263,1,59260,1,
+59263,2,3,59262,1,
+59263,3,59260,3,0,1,
+59263,4,3,55226,5,0,1,
+59273,1,59270,1,
+59273,2,3,59267,1,
+59273,3,59270,1,0,1,
+59273,4,3,40628,11,0,1,
+59281,1,59274,1,
+59281,2,7,59274,1,
+59281,3,59274,10,0,1,
+59281,4,7,56883,0,0,1,
+59333,1,59331,1,
+59333,2,2,59329,1,
+59333,3,59331,4,0,1,
+59333,4,2,48426,6,0,1,
+59341,1,59327,1,
+59341,2,14,59340,1,
+59341,3,59327,7,0,1,
+59341,4,14,53520,7,0,1,
+59351,1,59338,1,
+59351,2,13,59347,1,
+59351,3,59338,1,0,1,
+59351,4,13,38445,6,0,1,
+59357,1,59355,1,
+59357,2,2,59353,1,
+59357,3,59355,3,0,1,
+59357,4,2,41315,7,0,1,
+59359,1,59353,1,
+59359,2,6,59358,1,
+59359,3,59353,3,0,1,
+59359,4,6,58297,2,0,1,
+59369,1,59366,1,
+59369,2,3,59368,1,
+59369,3,59366,1,0,1,
+59369,4,3,48940,4,0,1,
+59377,1,59372,1,
+59377,2,5,59376,1,
+59377,3,59372,1,0,1,
+59377,4,5,57603,6,0,1,
+59387,1,59385,1,
+59387,2,2,59383,1,
+59387,3,59385,2,0,1,
+59387,4,2,33537,7,0,1,
+59393,1,59388,1,
+59393,2,5,59388,1,
+59393,3,59388,1,0,1,
+59393,4,5,32290,8,0,1,
+59399,1,59392,1,
+59399,2,7,59398,1,
+59399,3,59392,2,0,1,
+59399,4,7,35888,2,0,1,
+59407,1,59404,1,
+59407,2,3,59406,1,
+59407,3,59404,4,0,1,
+59407,4,3,30026,5,0,1,
+59417,1,59414,1,
+59417,2,3,59416,1,
+59417,3,59414,9,0,1,
+59417,4,3,40071,4,0,1,
+59419,1,59417,1,
+59419,2,2,59418,1,
+59419,3,59417,6,0,1,
+59419,4,2,59412,8,0,1,
+59441,1,59438,1,
+59441,2,3,59440,1,
+59441,3,59438,3,0,1,
+59441,4,3,40468,4,0,1,
+59443,1,59441,1,
+59443,2,2,59442,1,
+59443,3,59441,2,0,1,
+59443,4,2,34764,10,0,1,
+59447,1,59442,1,
+59447,2,5,59445,1,
+59447,3,59442,1,0,1,
+59447,4,5,54195,8,0,1,
+59453,1,59451,1,
+59453,2,2,59449,1,
+59453,3,59451,3,0,1,
+59453,4,2,51754,9,0,1,
+59467,1,59465,1,
+59467,2,2,59463,1,
+59467,3,59465,6,0,1,
+59467,4,2,40603,8,0,1,
+59471,1,59460,1,
+59471,2,11,59469,1,
+59471,3,59460,1,0,1,
+59471,4,11,56163,7,0,1,
+59473,1,59463,1,
+59473,2,10,59472,1,
+59473,3,59463,7,0,1,
+59473,4,10,39154,6,0,1,
+59497,1,59482,1,
+59497,2,15,59494,1,
+59497,3,59482,3,0,1,
+59497,4,15,49261,32,0,1,
+59509,1,59499,1,
+59509,2,10,59505,1,
+59509,3,59499,2,0,1,
+59509,4,10,49122,2,0,1,
+59513,1,59510,1,
+59513,2,3,59507,1,
+59513,3,59510,1,0,1,
+59513,4,3,40979,1,0,1,
+59539,1,59537,1,
+59539,2,2,59534,1,
+59539,3,59537,4,0,1,
+59539,4,2,49508,2,0,1,
+59557,1,59555,1,
+59557,2,2,59553,1,
+59557,3,59555,4,0,1,
+59557,4,2,41602,6,0,1,
+59561,1,59558,1,
+59561,2,3,59560,1,
+59561,3,59558,1,0,1,
+59561,4,3,39592,7,0,1,
+59567,1,59562,1,
+59567,2,5,59566,1,
+59567,3,59562,1,0,1,
+59567,4,5,45015,2,0,1,
+59581,1,59575,1,
+59581,2,6,59580,1,
+59581,3,59575,6,0,1,
+59581,4,6,44209,7,0,1,
+59611,1,59609,1,
+59611,2,2,59610,1,
+59611,3,59609,4,0,1,
+59611,4,2,39105,7,0,1,
+59617,1,59610,1,
+59617,2,7,59614,1,
+59617,3,59610,7,0,1,
+59617,4,7,54965,10,0,1,
+59621,1,59618,1,
+59621,2,3,59614,1,
+59621,3,59618,16,0,1,
+59621,4,3,56091,4,0,1,
+59627,1,59625,1,
+59627,2,2,59623,1,
+59627,3,59625,3,0,1,
+59627,4,2,57389,7,0,1,
+59629,1,59627,1,
+59629,2,2,59625,1,
+59629,3,59627,4,0,1,
+59629,4,2,58314,6,0,1,
+59651,1,59649,1,
+59651,2,2,59642,1,
+59651,3,59649,2,0,1,
+59651,4,2,47557,1,0,1,
+59659,1,59656,1,
+59659,2,3,59652,1,
+59659,3,59656,1,0,1,
+59659,4,3,54020,5,0,1,
+59663,1,59658,1,
+59663,2,5,59661,1,
+59663,3,59658,13,0,1,
+59663,4,5,43156,10,0,1,
+59669,1,59667,1,
+59669,2,2,59665,1,
+59669,3,59667,3,0,1,
+59669,4,2,33597,12,0,1,
+59671,1,59659,1,
+59671,2,12,59669,1,
+59671,3,59659,5,0,1,
+59671,4,12,38104,3,0,1,
+59693,1,59691,1,
+59693,2,2,59688,1,
+59693,3,59691,12,0,1,
+59693,4,2,34867,2,0,1,
+59699,1,59697,1,
+59699,2,2,59698,1,
+59699,3,59697,16,0,1,
+59699,4,2,30989,2,0,1,
+59707,1,59704,1,
+59707,2,3,59706,1,
+59707,3,59704,13,0,1,
+59707,4,3,46798,5,0,1,
+59723,1,59721,1,
+59723,2,2,59716,1,
+59723,3,59721,7,0,1,
+59723,4,2,54408,1,0,1,
+59729,1,59726,1,
+59729,2,3,59724,1,
+59729,3,59726,1,0,1,
+59729,4,3,56858,2,0,1,
+59743,1,59740,1,
+59743,2,3,59742,1,
+59743,3,59740,5,0,1,
+59743,4,3,40344,5,0,1,
+59747,1,59745,1,
+59747,2,2,59737,1,
+59747,3,59745,7,0,1,
+59747,4,2,51354,2,0,1,
+59753,1,59748,1,
+59753,2,5,59742,1,
+59753,3,59748,1,0,1,
+59753,4,5,57333,5,0,1,
+59771,1,59769,1,
+59771,2,2,59770,1,
+59771,3,59769,7,0,1,
+59771,4,2,59764,8,0,1,
+59779,1,59769,1,
+59779,2,10,59778,1,
+59779,3,59769,2,0,1,
+59779,4,10,59132,5,0,1,
+59791,1,59788,1,
+59791,2,3,59790,1,
+59791,3,59788,1,0,1,
+59791,4,3,36138,3,0,1,
+59797,1,59795,1,
+59797,2,2,59796,1,
+59797,3,59795,6,0,1,
+59797,4,2,40340,7,0,1,
+59809,1,59792,1,
+59809,2,17,59808,1,
+59809,3,59792,2,0,1,
+59809,4,17,42116,30,0,1,
+59833,1,59828,1,
+59833,2,5,59832,1,
+59833,3,59828,1,0,1,
+59833,4,5,46665,11,0,1,
+59863,1,59858,1,
+59863,2,5,59862,1,
+59863,3,59858,3,0,1,
+59863,4,5,33091,16,0,1,
+59879,1,59865,1,
+59879,2,14,59878,1,
+59879,3,59865,1,0,1,
+59879,4,14,45363,2,0,1,
+59887,1,59884,1,
+59887,2,3,59885,1,
+59887,3,59884,7,0,1,
+59887,4,3,57869,3,0,1,
+59921,1,59918,1,
+59921,2,3,59914,1,
+59921,3,59918,10,0,1,
+59921,4,3,55013,1,0,1,
+59929,1,59910,1,
+59929,2,19,59926,1,
+59929,3,59910,7,0,1,
+59929,4,19,51620,22,0,1,
+59951,1,59940,1,
+59951,2,11,59948,1,
+59951,3,59940,4,0,1,
+59951,4,11,57454,6,0,1,
+59957,1,59955,1,
+59957,2,2,59950,1,
+59957,3,59955,4,0,1,
+59957,4,2,49111,5,0,1,
+59971,1,59968,1,
+59971,2,3,59970,1,
+59971,3,59968,4,0,1,
+59971,4,3,59088,7,0,1,
+59981,1,59979,1,
+59981,2,2,59976,1,
+59981,3,59979,8,0,1,
+59981,4,2,47505,12,0,1,
+59999,1,59992,1,
+59999,2,7,59998,1,
+59999,3,59992,3,0,1,
+59999,4,7,58199,3,0,1,
+60013,1,60007,1,
+60013,2,6,60011,1,
+60013,3,60007,7,0,1,
+60013,4,6,52216,4,0,1,
+60017,1,60014,1,
+60017,2,3,60006,1,
+60017,3,60014,4,0,1,
+60017,4,3,31524,1,0,1,
+60029,1,60027,1,
+60029,2,2,60025,1,
+60029,3,60027,2,0,1,
+60029,4,2,51903,7,0,1,
+60037,1,60035,1,
+60037,2,2,60036,1,
+60037,3,60035,2,0,1,
+60037,4,2,38532,3,0,1,
+60041,1,60038,1,
+60041,2,3,60036,1,
+60041,3,60038,6,0,1,
+60041,4,3,51746,2,0,1,
+60077,1,60075,1,
+60077,2,2,60076,1,
+60077,3,60075,3,0,1,
+60077,4,2,39408,3,0,1,
+60083,1,60081,1,
+60083,2,2,60078,1,
+60083,3,60081,4,0,1,
+60083,4,2,46956,0,0,1,
+60089,1,60086,1,
+60089,2,3,60088,1,
+60089,3,60086,1,0,1,
+60089,4,3,43037,4,0,1,
+60091,1,60089,1,
+60091,2,2,60090,1,
+60091,3,60089,4,0,1,
+60091,4,2,43323,6,0,1,
+60101,1,60098,1,
+60101,2,3,60099,1,
+60101,3,60098,3,0,1,
+60101,4,3,60097,4,0,1,
+60103,1,60098,1,
+60103,2,5,60101,1,
+60103,3,60098,9,0,1,
+60103,4,5,60091,11,0,1,
+60107,1,60105,1,
+60107,2,2,60106,1,
+60107,3,60105,2,0,1,
+60107,4,2,57860,4,0,1,
+60127,1,60124,1,
+60127,2,3,60125,1,
+60127,3,60124,5,0,1,
+60127,4,3,45764,6,0,1,
+60133,1,60127,1,
+60133,2,6,60132,1,
+60133,3,60127,1,0,1,
+60133,4,6,55618,7,0,1,
+60139,1,60136,1,
+60139,2,3,60138,1,
+60139,3,60136,4,0,1,
+60139,4,3,38015,6,0,1,
+60149,1,60147,1,
+60149,2,2,60148,1,
+60149,3,60147,3,0,1,
+60149,4,2,60142,8,0,1,
+60161,1,60158,1,
+60161,2,3,60155,1,
+60161,3,60158,1,0,1,
+60161,4,3,60149,0,0,1,
+60167,1,60162,1,
+60167,2,5,60166,1,
+60167,3,60162,5,0,1,
+60167,4,5,44146,2,0,1,
+60169,1,60158,1,
+60169,2,11,60168,1,
+60169,3,60158,5,0,1,
+60169,4,11,41275,14,0,1,
+60209,1,60206,1,
+60209,2,3,60208,1,
+60209,3,60206,13,0,1,
+60209,4,3,39868,4,0,1,
+60217,1,60212,1,
+60217,2,5,60212,1,
+60217,3,60212,3,0,1,
+60217,4,5,36215,12,0,1,
+60223,1,60220,1,
+60223,2,3,60221,1,
+60223,3,60220,1,0,1,
+60223,4,3,60215,10,0,1,
+60251,1,60245,1,
+60251,2,6,60250,1,
+60251,3,60245,1,0,1,
+60251,4,6,55705,2,0,1,
+60257,1,60254,1,
+60257,2,3,60256,1,
+60257,3,60254,3,0,1,
+60257,4,3,58724,7,0,1,
+60259,1,60256,1,
+60259,2,3,60250,1,
+60259,3,60256,3,0,1,
+60259,4,3,31861,6,0,1,
+60271,1,60268,1,
+60271,2,3,60270,1,
+60271,3,60268,3,0,1,
+60271,4,3,36772,10,0,1,
+60289,1,60282,1,
+60289,2,7,60286,1,
+60289,3,60282,1,0,1,
+60289,4,7,56173,16,0,1,
+60293,1,60291,1,
+60293,2,2,60288,1,
+60293,3,60291,4,0,1,
+60293,4,2,55589,0,0,1,
+60317,1,60315,1,
+60317,2,2,60316,1,
+60317,3,60315,2,0,1,
+60317,4,2,36105,4,0,1,
+60331,1,60319,1,
+60331,2,12,60330,1,
+60331,3,60319,1,0,1,
+60331,4,12,30701,5,0,1,
+60337,1,60332,1,
+60337,2,5,60336,1,
+60337,3,60332,5,0,1,
+60337,4,5,53239,12,0,1,
+60343,1,60340,1,
+60343,2,3,60342,1,
+60343,3,60340,9,0,1,
+60343,4,3,40662,5,0,1,
+60353,1,60350,1,
+60353,2,3,60352,1,
+60353,3,60350,5,0,1,
+60353,4,3,43662,4,0,1,
+60373,1,60371,1,
+60373,2,2,60372,1,
+60373,3,60371,5,0,1,
+60373,4,2,51163,6,0,1,
+60383,1,60378,1,
+60383,2,5,60378,1,
+60383,3,60378,1,0,1,
+60383,4,5,56436,6,0,1,
+60397,1,60392,1,
+60397,2,5,60396,1,
+60397,3,60392,5,0,1,
+60397,4,5,36324,7,0,1,
+60413,1,60411,1,
+60413,2,2,60412,1,
+60413,3,60411,3,0,1,
+60413,4,2,42023,19,0,1,
+60427,1,60424,1,
+60427,2,3,60420,1,
+60427,3,60424,9,0,1,
+60427,4,3,34137,5,0,1,
+60443,1,60441,1,
+60443,2,2,60442,1,
+60443,3,60441,2,0,1,
+60443,4,2,32304,4,0,1,
+60449,1,60446,1,
+60449,2,3,60435,1,
+60449,3,60446,4,0,1,
+60449,4,3,45079,2,0,1,
+60457,1,60444,1,
+60457,2,13,60456,1,
+60457,3,60444,6,0,1,
+60457,4,13,44255,11,0,1,
+60493,1,60491,1,
+60493,2,2,60492,1,
+60493,3,60491,6,0,1,
+60493,4,2,59943,6,0,1,
+60497,1,60494,1,
+60497,2,3,60496,1,
+60497,3,60494,5,0,1,
+60497,4,3,55621,6,0,1,
+60509,1,60507,1,
+60509,2,2,60505,1,
+60509,3,60507,2,0,1,
+60509,4,2,43962,6,0,1,
+60521,1,60518,1,
+60521,2,3,60520,1,
+60521,3,60518,4,0,1,
+60521,4,3,49677,4,0,1,
+60527,1,60522,1,
+60527,2,5,60526,1,
+60527,3,60522,2,0,1,
+60527,4,5,55656,4,0,1,
+60539,1,60537,1,
+60539,2,2,60535,1,
+60539,3,60537,3,0,1,
+60539,4,2,57889,7,0,1,
+60589,1,60587,1,
+60589,2,2,60579,1,
+60589,3,60587,2,0,1,
+60589,4,2,45582,2,0,1,
+60601,1,60590,1,
+60601,2,11,60596,1,
+60601,3,60590,4,0,1,
+60601,4,11,59044,16,0,1,
+60607,1,60604,1,
+60607,2,3,60606,1,
+60607,3,60604,1,0,1,
+60607,4,3,46733,5,0,1,
+60611,1,60601,1,
+60611,2,10,60608,1,
+60611,3,60601,2,0,1,
+60611,4,10,45565,4,0,1,
+60617,1,60614,1,
+60617,2,3,60612,1,
+60617,3,60614,7,0,1,
+60617,4,3,37458,0,0,1,
+60623,1,60618,1,
+60623,2,5,60622,1,
+60623,3,60618,8,0,1,
+60623,4,5,38247,2,0,1,
+60631,1,60625,1,
+60631,2,6,60629,1,
+60631,3,60625,6,0,1,
+60631,4,6,37775,4,0,1,
+60637,1,60635,1,
+60637,2,2,60636,1,
+60637,3,60635,2,0,1,
+60637,4,2,42535,9,0,1,
+60647,1,60642,1,
+60647,2,5,60642,1,
+60647,3,60642,3,0,1,
+60647,4,5,31472,9,0,1,
+60649,1,60638,1,
+60649,2,11,60648,1,
+60649,3,60638,1,0,1,
+60649,4,11,57391,24,0,1,
+60659,1,60657,1,
+60659,2,2,60655,1,
+60659,3,60657,2,0,1,
+60659,4,2,37394,8,0,1,
+60661,1,60659,1,
+60661,2,2,60660,1,
+60661,3,60659,5,0,1,
+60661,4,2,48780,3,0,1,
+60679,1,60676,1,
+60679,2,3,60677,1,
+60679,3,60676,1,0,1,
+60679,4,3,35802,3,0,1,
+60689,1,60686,1,
+60689,2,3,60688,1,
+60689,3,60686,1,0,1,
+60689,4,3,48859,7,0,1,
+60703,1,60700,1,
+60703,2,3,60701,1,
+60703,3,60700,6,0,1,
+60703,4,3,42426,17,0,1,
+60719,1,60712,1,
+60719,2,7,60715,1,
+60719,3,60712,1,0,1,
+60719,4,7,59617,6,0,1,
+60727,1,60722,1,
+60727,2,5,60726,1,
+60727,3,60722,3,0,1,
+60727,4,5,41599,12,0,1,
+60733,1,60731,1,
+60733,2,2,60729,1,
+60733,3,60731,4,0,1,
+60733,4,2,41358,10,0,1,
+60737,1,60734,1,
+60737,2,3,60736,1,
+60737,3,60734,4,0,1,
+60737,4,3,49217,6,0,1,
+60757,1,60755,1,
+60757,2,2,60753,1,
+60757,3,60755,6,0,1,
+60757,4,2,37347,9,0,1,
+60761,1,60755,1,
+60761,2,6,60758,1,
+60761,3,60755,1,0,1,
+60761,4,6,34826,0,0,1,
+60763,1,60760,1,
+60763,2,3,60762,1,
+60763,3,60760,4,0,1,
+60763,4,3,48750,5,0,1,
+60773,1,60771,1,
+60773,2,2,60769,1,
+60773,3,60771,2,0,1,
+60773,4,2,53959,1,0,1,
+60779,1,60777,1,
+60779,2,2,60778,1,
+60779,3,60777,3,0,1,
+60779,4,2,43256,4,0,1,
+60793,1,60788,1,
+60793,2,5,60792,1,
+60793,3,60788,1,0,1,
+60793,4,5,42116,6,0,1,
+60811,1,60809,1,
+60811,2,2,60807,1,
+60811,3,60809,4,0,1,
+60811,4,2,49132,8,0,1,
+60821,1,60819,1,
+60821,2,2,60820,1,
+60821,3,60819,3,0,1,
+60821,4,2,58097,3,0,1,
+60859,1,60856,1,
+60859,2,3,60854,1,
+60859,3,60856,8,0,1,
+60859,4,3,32881,3,0,1,
+60869,1,60867,1,
+60869,2,2,60865,1,
+60869,3,60867,2,0,1,
+60869,4,2,43138,7,0,1,
+60887,1,60880,1,
+60887,2,7,60885,1,
+60887,3,60880,2,0,1,
+60887,4,7,41522,10,0,1,
+60889,1,60868,1,
+60889,2,21,60888,1,
+60889,3,60868,6,0,1,
+60889,4,21,30890,8,0,1,
+60899,1,60897,1,
+60899,2,2,60890,1,
+60899,3,60897,3,0,1,
+60899,4,2,40968,1,0,1,
+60901,1,60899,1,
+60901,2,2,60897,1,
+60901,3,60899,2,0,1,
+60901,4,2,59505,6,0,1,
+60913,1,60908,1,
+60913,2,5,60912,1,
+60913,3,60908,2,0,1,
+60913,4,5,37275,6,0,1,
+60917,1,60915,1,
+60917,2,2,60916,1,
+60917,3,60915,2,0,1,
+60917,4,2,56743,3,0,1,
+60919,1,60916,1,
+60919,2,3,60917,1,
+60919,3,60916,1,0,1,
+60919,4,3,54223,6,0,1,
+60923,1,60921,1,
+60923,2,2,60918,1,
+60923,3,60921,10,0,1,
+60923,4,2,44157,3,0,1,
+60937,1,60927,1,
+60937,2,10,60936,1,
+60937,3,60927,5,0,1,
+60937,4,10,51187,21,0,1,
+60943,1,60938,1,
+60943,2,5,60942,1,
+60943,3,60938,1,0,1,
+60943,4,5,31353,2,0,1,
+60953,1,60950,1,
+60953,2,3,60952,1,
+60953,3,60950,5,0,1,
+60953,4,3,38273,4,0,1,
+60961,1,60954,1,
+60961,2,7,60954,1,
+60961,3,60954,3,0,1,
+60961,4,7,46153,0,0,1,
+61001,1,60998,1,
+61001,2,3,61000,1,
+61001,3,60998,3,0,1,
+61001,4,3,55315,7,0,1,
+61007,1,61002,1,
+61007,2,5,61005,1,
+61007,3,61002,1,0,1,
+61007,4,5,49699,14,0,1,
+61027,1,61025,1,
+61027,2,2,61023,1,
+61027,3,61025,6,0,1,
+61027,4,2,41014,8,0,1,
+61031,1,61009,1,
+61031,2,22,61028,1,
+61031,3,61009,4,0,1,
+61031,4,22,49802,8,0,1,
+61043,1,61041,1,
+61043,2,2,61042,1,
+61043,3,61041,3,0,1,
+61043,4,2,41886,20,0,1,
+61051,1,61048,1,
+61051,2,3,61040,1,
+61051,3,61048,9,0,1,
+61051,4,3,53312,1,0,1,
+61057,1,61052,1,
+61057,2,5,61056,1,
+61057,3,61052,5,0,1,
+61057,4,5,31428,6,0,1,
+61091,1,61089,1,
+61091,2,2,61087,1,
+61091,3,61089,2,0,1,
+61091,4,2,44076,7,0,1,
+61099,1,61097,1,
+61099,2,2,61098,1,
+61099,3,61097,5,0,1,
+61099,4,2,34487,6,0,1,
+61121,1,61118,1,
+61121,2,3,61116,1,
+61121,3,61118,9,0,1,
+61121,4,3,49149,2,0,1,
+61129,1,61122,1,
+61129,2,7,61120,1,
+61129,3,61122,2,0,1,
+61129,4,7,46243,2,0,1,
+61141,1,61135,1,
+61141,2,6,61140,1,
+61141,3,61135,8,0,1,
+61141,4,6,53310,7,0,1,
+61151,1,61120,1,
+61151,2,31,61150,1,
+61151,3,61120,1,0,1,
+61151,4,31,59965,2,0,1,
+61153,1,61143,1,
+61153,2,10,61150,1,
+61153,3,61143,3,0,1,
+61153,4,10,37800,8,0,1,
+61169,1,61166,1,
+61169,2,3,61163,1,
+61169,3,61166,4,0,1,
+61169,4,3,61157,0,0,1,
+61211,1,61209,1,
+61211,2,2,61203,1,
+61211,3,61209,4,0,1,
+61211,4,2,49876,2,0,1,
+61223,1,61218,1,
+61223,2,5,61221,1,
+61223,3,61218,1,0,1,
+61223,4,5,34750,5,0,1,
+61231,1,61224,1,
+61231,2,7,61228,1,
+61231,3,61224,1,0,1,
+61231,4,7,40021,0,0,1,
+61253,1,61251,1,
+61253,2,2,61249,1,
+61253,3,61251,3,0,1,
+61253,4,2,43674,22,0,1,
+61261,1,61259,1,
+61261,2,2,61257,1,
+61261,3,61259,2,0,1,
+61261,4,2,41485,10,0,1,
+61283,1,61281,1,
+61283,2,2,61282,1,
+61283,3,61281,3,0,1,
+61283,4,2,43068,10,0,1,
+61291,1,61288,1,
+61291,2,3,61290,1,
+61291,3,61288,1,0,1,
+61291,4,3,57988,2,0,1,
+61297,1,61290,1,
+61297,2,7,61294,1,
+61297,3,61290,2,0,1,
+61297,4,7,36957,8,0,1,
+61331,1,61329,1,
+61331,2,2,61327,1,
+61331,3,61329,2,0,1,
+61331,4,2,54672,8,0,1,
+61333,1,61331,1,
+61333,2,2,61332,1,
+61333,3,61331,2,0,1,
+61333,4,2,34465,3,0,1,
+61339,1,61337,1,
+61339,2,2,61338,1,
+61339,3,61337,4,0,1,
+61339,4,2,33990,6,0,1,
+61343,1,61338,1,
+61343,2,5,61341,1,
+61343,3,61338,3,0,1,
+61343,4,5,39504,8,0,1,
+61357,1,61351,1,
+61357,2,6,61355,1,
+61357,3,61351,2,0,1,
+61357,4,6,33171,10,0,1,
+61363,1,61360,1,
+61363,2,3,61356,1,
+61363,3,61360,3,0,1,
+61363,4,3,33832,2,0,1,
+61379,1,61377,1,
+61379,2,2,61378,1,
+61379,3,61377,3,0,1,
+61379,4,2,60825,4,0,1,
+61381,1,61375,1,
+61381,2,6,61380,1,
+61381,3,61375,1,0,1,
+61381,4,6,40379,7,0,1,
+61403,1,61401,1,
+61403,2,2,61402,1,
+61403,3,61401,5,0,1,
+61403,4,2,42392,10,0,1,
+61409,1,61406,1,
+61409,2,3,61408,1,
+61409,3,61406,1,0,1,
+61409,4,3,54546,7,0,1,
+61417,1,61412,1,
+61417,2,5,61408,1,
+61417,3,61412,6,0,1,
+61417,4,5,42540,14,0,1,
+61441,1,61424,1,
+61441,2,17,61440,1,
+61441,3,61424,2,0,1,
+61441,4,17,34907,12,0,1,
+61463,1,61458,1,
+61463,2,5,61461,1,
+61463,3,61458,9,0,1,
+61463,4,5,57285,14,0,1,
+61469,1,61467,1,
+61469,2,2,61464,1,
+61469,3,61467,10,0,1,
+61469,4,2,55713,20,0,1,
+61471,1,61468,1,
+61471,2,3,61469,1,
+61471,3,61468,7,0,1,
+61471,4,3,52115,6,0,1,
+61483,1,61481,1,
+61483,2,2,61478,1,
+61483,3,61481,6,0,1,
+61483,4,2,40254,2,0,1,
+61487,1,61482,1,
+61487,2,5,61485,1,
+61487,3,61482,11,0,1,
+61487,4,5,61483,3,0,1,
+61493,1,61491,1,
+61493,2,2,61492,1,
+61493,3,61491,7,0,1,
+61493,4,2,31024,21,0,1,
+61507,1,61505,1,
+61507,2,2,61506,1,
+61507,3,61505,2,0,1,
+61507,4,2,45654,2,0,1,
+61511,1,61504,1,
+61511,2,7,61510,1,
+61511,3,61504,1,0,1,
+61511,4,7,59211,3,0,1,
+61519,1,61516,1,
+61519,2,3,61518,1,
+61519,3,61516,1,0,1,
+61519,4,3,42703,2,0,1,
+61543,1,61540,1,
+61543,2,3,61541,1,
+61543,3,61540,3,0,1,
+61543,4,3,45606,3,0,1,
+61547,1,61545,1,
+61547,2,2,61543,1,
+61547,3,61545,2,0,1,
+61547,4,2,37014,7,0,1,
+61553,1,61550,1,
+61553,2,3,61548,1,
+61553,3,61550,1,0,1,
+61553,4,3,31054,0,0,1,
+61559,1,61552,1,
+61559,2,7,61557,1,
+61559,3,61552,3,0,1,
+61559,4,7,55248,4,0,1,
+61561,1,61554,1,
+61561,2,7,61554,1,
+61561,3,61554,2,0,1,
+61561,4,7,37994,0,0,1,
+61583,1,61578,1,
+61583,2,5,61578,1,
+61583,3,61578,1,0,1,
+61583,4,5,41969,6,0,1,
+61603,1,61601,1,
+61603,2,2,61602,1,
+61603,3,61601,6,0,1,
+61603,4,2,50916,2,0,1,
+61609,1,61596,1,
+61609,2,13,61606,1,
+61609,3,61596,3,0,1,
+61609,4,13,46793,26,0,1,
+61613,1,61611,1,
+61613,2,2,61597,1,
+61613,3,61611,2,0,1,
+61613,4,2,50836,3,0,1,
+61627,1,61624,1,
+61627,2,3,61622,1,
+61627,3,61624,6,0,1,
+61627,4,3,49372,3,0,1,
+61631,1,61620,1,
+61631,2,11,61630,1,
+61631,3,61620,6,0,1,
+61631,4,11,50465,2,0,1,
+61637,1,61635,1,
+61637,2,2,61632,1,
+61637,3,61635,8,0,1,
+61637,4,2,44458,0,0,1,
+61643,1,61641,1,
+61643,2,2,61639,1,
+61643,3,61641,3,0,1,
+61643,4,2,41731,8,0,1,
+61651,1,61649,1,
+61651,2,2,61647,1,
+61651,3,61649,5,0,1,
+61651,4,2,44616,8,0,1,
+61657,1,61652,1,
+61657,2,5,61656,1,
+61657,3,61652,1,0,1,
+61657,4,5,58391,6,0,1,
+61667,1,61665,1,
+61667,2,2,61663,1,
+61667,3,61665,3,0,1,
+61667,4,2,38136,8,0,1,
+61673,1,61668,1,
+61673,2,5,61670,1,
+61673,3,61668,2,0,1,
+61673,4,5,47605,0,0,1,
+61681,1,61652,1,
+61681,2,29,61674,1,
+61681,3,61652,3,0,1,
+61681,4,29,59222,36,0,1,
+61687,1,61681,1,
+61687,2,6,61684,1,
+61687,3,61681,2,0,1,
+61687,4,6,45338,5,0,1,
+61703,1,61698,1,
+61703,2,5,61702,1,
+61703,3,61698,2,0,1,
+61703,4,5,41755,4,0,1,
+61717,1,61715,1,
+61717,2,2,61716,1,
+61717,3,61715,6,0,1,
+61717,4,2,57170,3,0,1,
+61723,1,61718,1,
+61723,2,5,61721,1,
+61723,3,61718,5,0,1,
+61723,4,5,61719,3,0,1,
+61729,1,61722,1,
+61729,2,7,61722,1,
+61729,3,61722,2,0,1,
+61729,4,7,38315,0,0,1,
+61751,1,61744,1,
+61751,2,7,61750,1,
+61751,3,61744,8,0,1,
+61751,4,7,37416,6,0,1,
+61757,1,61755,1,
+61757,2,2,61756,1,
+61757,3,61755,2,0,1,
+61757,4,2,51635,4,0,1,
+61781,1,61779,1,
+61781,2,2,61774,1,
+61781,3,61779,4,0,1,
+61781,4,2,51262,17,0,1,
+61813,1,61811,1,
+61813,2,2,61812,1,
+61813,3,61811,4,0,1,
+61813,4,2,47977,6,0,1,
+61819,1,61816,1,
+61819,2,3,61812,1,
+61819,3,61816,5,0,1,
+61819,4,3,39500,0,0,1,
+61837,1,61831,1,
+61837,2,6,61835,1,
+61837,3,61831,2,0,1,
+61837,4,6,56096,0,0,1,
+61843,1,61841,1,
+61843,2,2,61842,1,
+61843,3,61841,6,0,1,
+61843,4,2,61836,8,0,1,
+61861,1,61859,1,
+61861,2,2,61857,1,
+61861,3,61859,6,0,1,
+61861,4,2,43169,12,0,1,
+61871,1,61852,1,
+61871,2,19,61870,1,
+61871,3,61852,3,0,1,
+61871,4,19,59775,6,0,1,
+61879,1,61876,1,
+61879,2,3,61877,1,
+61879,3,61876,5,0,1,
+61879,4,3,31536,3,0,1,
+61909,1,61903,1,
+61909,2,6,61905,1,
+61909,3,61903,7,0,1,
+61909,4,6,45367,2,0,1,
+61927,1,61924,1,
+61927,2,3,61926,1,
+61927,3,61924,4,0,1,
+61927,4,3,40760,5,0,1,
+61933,1,61928,1,
+61933,2,5,61932,1,
+61933,3,61928,1,0,1,
+61933,4,5,61581,3,0,1,
+61949,1,61947,1,
+61949,2,2,61943,1,
+61949,3,61947,9,0,1,
+61949,4,2,53327,3,0,1,
+61961,1,61958,1,
+61961,2,3,61955,1,
+61961,3,61958,14,0,1,
+61961,4,3,61949,0,0,1,
+61967,1,61962,1,
+61967,2,5,61966,1,
+61967,3,61962,5,0,1,
+61967,4,5,60581,2,0,1,
+61979,1,61977,1,
+61979,2,2,61973,1,
+61979,3,61977,2,0,1,
+61979,4,2,43937,4,0,1,
+61981,1,61974,1,
+61981,2,7,61979,1,
+61981,3,61974,3,0,1,
+61981,4,7,42871,4,0,1,
+61987,1,61985,1,
+61987,2,2,61983,1,
+61987,3,61985,4,0,1,
+61987,4,2,45800,14,0,1,
+61991,1,61978,1,
+61991,2,13,61989,1,
+61991,3,61978,1,0,1,
+61991,4,13,48932,7,0,1,
+62003,1,62001,1,
+62003,2,2,61999,1,
+62003,3,62001,3,0,1,
+62003,4,2,61007,8,0,1,
+62011,1,62009,1,
+62011,2,2,62010,1,
+62011,3,62009,5,0,1,
+62011,4,2,34612,6,0,1,
+62017,1,62007,1,
+62017,2,10,62016,1,
+62017,3,62007,5,0,1,
+62017,4,10,53517,6,0,1,
+62039,1,62022,1,
+62039,2,17,62037,1,
+62039,3,62022,1,0,1,
+62039,4,17,59403,4,0,1,
+62047,1,62044,1,
+62047,2,3,62046,1,
+62047,3,62044,1,0,1,
+62047,4,3,59196,5,0,1,
+62053,1,62051,1,
+62053,2,2,62052,1,
+62053,3,62051,5,0,1,
+62053,4,2,51561,7,0,1,
+62057,1,62054,1,
+62057,2,3,62050,1,
+62057,3,62054,4,0,1,
+62057,4,3,51886,1,0,1,
+62071,1,62064,1,
+62071,2,7,62062,1,
+62071,3,62064,1,0,1,
+62071,4,7,38517,3,0,1,
+62081,1,62075,1,
+62081,2,6,62078,1,
+62081,3,62075,6,0,1,
+62081,4,6,46374,0,0,1,
+62099,1,62097,1,
+62099,2,2,62095,1,
+62099,3,62097,3,0,1,
+62099,4,2,44457,7,0,1,
+62119,1,62112,1,
+62119,2,7,62116,1,
+62119,3,62112,10,0,1,
+62119,4,7,52234,5,0,1,
+62129,1,62126,1,
+62129,2,3,62124,1,
+62129,3,62126,1,0,1,
+62129,4,3,41537,2,0,1,
+62131,1,62129,1,
+62131,2,2,62127,1,
+62131,3,62129,6,0,1,
+62131,4,2,51020,1,0,1,
+62137,1,62130,1,
+62137,2,7,62130,1,
+62137,3,62130,4,0,1,
+62137,4,7,47863,14,0,1,
+62141,1,62139,1,
+62141,2,2,62137,1,
+62141,3,62139,3,0,1,
+62141,4,2,45909,6,0,1,
+62143,1,62140,1,
+62143,2,3,62141,1,
+62143,3,62140,9,0,1,
+62143,4,3,42592,3,0,1,
+62171,1,62169,1,
+62171,2,2,62165,1,
+62171,3,62169,2,0,1,
+62171,4,2,45467,0,0,1,
+62189,1,62187,1,
+62189,2,2,62185,1,
+62189,3,62187,2,0,1,
+62189,4,2,46417,6,0,1,
+62191,1,62188,1,
+62191,2,3,62190,1,
+62191,3,62188,1,0,1,
+62191,4,3,36223,2,0,1,
+62201,1,62198,1,
+62201,2,3,62195,1,
+62201,3,62198,11,0,1,
+62201,4,3,62189,0,0,1,
+62207,1,62202,1,
+62207,2,5,62205,1,
+62207,3,62202,3,0,1,
+62207,4,5,59062,9,0,1,
+62213,1,62211,1,
+62213,2,2,62209,1,
+62213,3,62211,15,0,1,
+62213,4,2,33853,12,0,1,
+62219,1,62217,1,
+62219,2,2,62218,1,
+62219,3,62217,3,0,1,
+62219,4,2,61608,2,0,1,
+62233,1,62226,1,
+62233,2,7,62230,1,
+62233,3,62226,3,0,1,
+62233,4,7,42282,10,0,1,
+62273,1,62270,1,
+62273,2,3,62272,1,
+62273,3,62270,10,0,1,
+62273,4,3,34964,4,0,1,
+62297,1,62294,1,
+62297,2,3,62291,1,
+62297,3,62294,4,0,1,
+62297,4,3,42663,1,0,1,
+62299,1,62297,1,
+62299,2,2,62298,1,
+62299,3,62297,6,0,1,
+62299,4,2,40082,17,0,1,
+62303,1,62298,1,
+62303,2,5,62302,1,
+62303,3,62298,1,0,1,
+62303,4,5,53972,2,0,1,
+62311,1,62305,1,
+62311,2,6,62309,1,
+62311,3,62305,1,0,1,
+62311,4,6,55233,4,0,1,
+62323,1,62321,1,
+62323,2,2,62319,1,
+62323,3,62321,6,0,1,
+62323,4,2,46418,8,0,1,
+62327,1,62322,1,
+62327,2,5,62322,1,
+62327,3,62322,2,0,1,
+62327,4,5,41669,6,0,1,
+62347,1,62344,1,
+62347,2,3,62346,1,
+62347,3,62344,3,0,1,
+62347,4,3,45311,2,0,1,
+62351,1,62344,1,
+62351,2,7,62350,1,
+62351,3,62344,3,0,1,
+62351,4,7,50862,3,0,1,
+62383,1,62378,1,
+62383,2,5,62381,1,
+62383,3,62378,6,0,1,
+62383,4,5,62379,3,0,1,
+62401,1,62384,1,
+62401,2,17,62398,1,
+62401,3,62384,1,0,1,
+62401,4,17,33894,17,0,1,
+62417,1,62414,1,
+62417,2,3,62411,1,
+62417,3,62414,6,0,1,
+62417,4,3,55883,9,0,1,
+62423,1,62418,1,
+62423,2,5,62422,1,
+62423,3,62418,5,0,1,
+62423,4,5,47543,2,0,1,
+62459,1,62453,1,
+62459,2,6,62458,1,
+62459,3,62453,2,0,1,
+62459,4,6,33256,2,0,1,
+62467,1,62464,1,
+62467,2,3,62462,1,
+62467,3,62464,7,0,1,
+62467,4,3,55812,11,0,1,
+62473,1,62468,1,
+62473,2,5,62468,1,
+62473,3,62468,1,0,1,
+62473,4,5,38917,15,0,1,
+62477,1,62475,1,
+62477,2,2,62469,1,
+62477,3,62475,10,0,1,
+62477,4,2,37627,11,0,1,
+62483,1,62481,1,
+62483,2,2,62479,1,
+62483,3,62481,3,0,1,
+62483,4,2,42208,8,0,1,
+62497,1,62487,1,
+62497,2,10,62496,1,
+62497,3,62487,2,0,1,
+62497,4,10,57867,12,0,1,
+62501,1,62499,1,
+62501,2,2,62500,1,
+62501,3,62499,5,0,1,
+62501,4,2,45749,3,0,1,
+62507,1,62505,1,
+62507,2,2,62503,1,
+62507,3,62505,3,0,1,
+62507,4,2,42044,7,0,1,
+62533,1,62531,1,
+62533,2,2,62529,1,
+62533,3,62531,4,0,1,
+62533,4,2,49614,6,0,1,
+62539,1,62537,1,
+62539,2,2,62535,1,
+62539,3,62537,2,0,1,
+62539,4,2,31486,8,0,1,
+62549,1,62547,1,
+62549,2,2,62545,1,
+62549,3,62547,3,0,1,
+62549,4,2,44535,6,0,1,
+62563,1,62560,1,
+62563,2,3,62562,1,
+62563,3,62560,4,0,1,
+62563,4,3,36586,2,0,1,
+62581,1,62579,1,
+62581,2,2,62577,1,
+62581,3,62579,4,0,1,
+62581,4,2,59696,10,0,1,
+62591,1,62584,1,
+62591,2,7,62590,1,
+62591,3,62584,7,0,1,
+62591,4,7,47670,3,0,1,
+62597,1,62595,1,
+62597,2,2,62596,1,
+62597,3,62595,2,0,1,
+62597,4,2,44147,3,0,1,
+62603,1,62601,1,
+62603,2,2,62599,1,
+62603,3,62601,9,0,1,
+62603,4,2,39073,8,0,1,
+62617,1,62612,1,
+62617,2,5,62616,1,
+62617,3,62612,3,0,1,
+62617,4,5,54329,6,0,1,
+62627,1,62625,1,
+62627,2,2,62626,1,
+62627,3,62625,2,0,1,
+62627,4,2,62014,2,0,1,
+62633,1,62630,1,
+62633,2,3,62632,1,
+62633,3,62630,1,0,1,
+62633,4,3,35689,4,0,1,
+62639,1,62628,1,
+62639,2,11,62636,1,
+62639,3,62628,4,0,1,
+62639,4,11,39672,5,0,1,
+62653,1,62651,1,
+62653,2,2,62652,1,
+62653,3,62651,2,0,1,
+62653,4,2,59122,3,0,1,
+62659,1,62656,1,
+62659,2,3,62652,1,
+62659,3,62656,1,0,1,
+62659,4,3,32070,5,0,1,
+62683,1,62680,1,
+62683,2,3,62676,1,
+62683,3,62680,7,0,1,
+62683,4,3,62123,2,0,1,
+62687,1,62682,1,
+62687,2,5,62685,1,
+62687,3,62682,1,0,1,
+62687,4,5,55913,14,0,1,
+62701,1,62699,1,
+62701,2,2,62697,1,
+62701,3,62699,6,0,1,
+62701,4,2,39258,6,0,1,
+62723,1,62721,1,
+62723,2,2,62722,1,
+62723,3,62721,2,0,1,
+62723,4,2,59565,2,0,1,
+62731,1,62721,1,
+62731,2,10,62730,1,
+62731,3,62721,6,0,1,
+62731,4,10,36959,5,0,1,
+62743,1,62736,1,
+62743,2,7,62732,1,
+62743,3,62736,1,0,1,
+62743,4,7,33771,1,0,1,
+62753,1,62750,1,
+62753,2,3,62747,1,
+62753,3,62750,1,0,1,
+62753,4,3,48144,9,0,1,
+62761,1,62754,1,
+62761,2,7,62754,1,
+62761,3,62754,2,0,1,
+62761,4,7,42142,0,0,1,
+62773,1,62768,1,
+62773,2,5,62770,1,
+62773,3,62768,8,0,1,
+62773,4,5,60647,23,0,1,
+62791,1,62788,1,
+62791,2,3,62789,1,
+62791,3,62788,3,0,1,
+62791,4,3,31727,3,0,1,
+62801,1,62798,1,
+62801,2,3,62796,1,
+62801,3,62798,3,0,1,
+62801,4,3,57059,2,0,1,
+62819,1,62817,1,
+62819,2,2,62815,1,
+62819,3,62817,2,0,1,
+62819,4,2,40689,7,0,1,
+62827,1,62824,1,
+62827,2,3,62826,1,
+62827,3,62824,8,0,1,
+62827,4,3,52046,2,0,1,
+62851,1,62849,1,
+62851,2,2,62850,1,
+62851,3,62849,6,0,1,
+62851,4,2,62844,8,0,1,
+62861,1,62858,1,
+62861,2,3,62860,1,
+62861,3,62858,3,0,1,
+62861,4,3,50905,3,0,1,
+62869,1,62867,1,
+62869,2,2,62865,1,
+62869,3,62867,4,0,1,
+62869,4,2,35329,6,0,1,
+62873,1,62870,1,
+62873,2,3,62867,1,
+62873,3,62870,1,0,1,
+62873,4,3,44762,11,0,1,
+62897,1,62894,1,
+62897,2,3,62896,1,
+62897,3,62894,6,0,1,
+62897,4,3,54782,7,0,1,
+62903,1,62898,1,
+62903,2,5,62902,1,
+62903,3,62898,1,0,1,
+62903,4,5,34079,9,0,1,
+62921,1,62907,1,
+62921,2,14,62916,1,
+62921,3,62907,2,0,1,
+62921,4,14,62089,8,0,1,
+62927,1,62922,1,
+62927,2,5,62920,1,
+62927,3,62922,10,0,1,
+62927,4,5,38104,2,0,1,
+62929,1,62915,1,
+62929,2,14,62926,1,
+62929,3,62915,2,0,1,
+62929,4,14,46660,24,0,1,
+62939,1,62937,1,
+62939,2,2,62933,1,
+62939,3,62937,2,0,1,
+62939,4,2,43142,4,0,1,
+62969,1,62966,1,
+62969,2,3,62963,1,
+62969,3,62966,14,0,1,
+62969,4,3,62957,0,0,1,
+62971,1,62961,1,
+62971,2,10,62967,1,
+62971,3,62961,4,0,1,
+62971,4,10,52750,2,0,1,
+62981,1,62979,1,
+62981,2,2,62977,1,
+62981,3,62979,2,0,1,
+62981,4,2,56568,7,0,1,
+62983,1,62978,1,
+62983,2,5,62981,1,
+62983,3,62978,3,0,1,
+62983,4,5,62979,3,0,1,
+62987,1,62985,1,
+62987,2,2,62983,1,
+62987,3,62985,3,0,1,
+62987,4,2,44134,8,0,1,
+62989,1,62987,1,
+62989,2,2,62985,1,
+62989,3,62987,6,0,1,
+62989,4,2,42878,10,0,1,
+63029,1,63027,1,
+63029,2,2,63025,1,
+63029,3,63027,3,0,1,
+63029,4,2,38322,6,0,1,
+63031,1,63028,1,
+63031,2,3,63029,1,
+63031,3,63028,7,0,1,
+63031,4,3,51837,3,0,1,
+63059,1,63057,1,
+63059,2,2,63049,1,
+63059,3,63057,11,0,1,
+63059,4,2,42683,0,0,1,
+63067,1,63065,1,
+63067,2,2,63063,1,
+63067,3,63065,6,0,1,
+63067,4,2,45304,8,0,1,
+63073,1,63068,1,
+63073,2,5,63072,1,
+63073,3,63068,1,0,1,
+63073,4,5,45905,6,0,1,
+63079,1,63076,1,
+63079,2,3,63073,1,
+63079,3,63076,3,0,1,
+63079,4,3,42838,7,0,1,
+63097,1,63092,1,
+63097,2,5,63092,1,
+63097,3,63092,2,0,1,
+63097,4,5,43546,10,0,1,
+63103,1,63100,1,
+63103,2,3,63102,1,
+63103,3,63100,1,0,1,
+63103,4,3,59006,2,0,1,
+63113,1,63110,1,
+63113,2,3,63107,1,
+63113,3,63110,1,0,1,
+63113,4,3,38456,1,0,1,
+63127,1,63124,1,
+63127,2,3,63125,1,
+63127,3,63124,1,0,1,
+63127,4,3,51151,6,0,1,
+63131,1,63129,1,
+63131,2,2,63130,1,
+63131,3,63129,3,0,1,
+63131,4,2,41900,4,0,1,
+63149,1,63147,1,
+63149,2,2,63141,1,
+63149,3,63147,3,0,1,
+63149,4,2,36683,0,0,1,
+63179,1,63177,1,
+63179,2,2,63175,1,
+63179,3,63177,2,0,1,
+63179,4,2,39541,8,0,1,
+63197,1,63195,1,
+63197,2,2,63188,1,
+63197,3,63195,10,0,1,
+63197,4,2,34917,4,0,1,
+63199,1,63196,1,
+63199,2,3,63194,1,
+63199,3,63196,5,0,1,
+63199,4,3,45062,7,0,1,
+63211,1,63204,1,
+63211,2,7,63209,1,
+63211,3,63204,1,0,1,
+63211,4,7,38146,6,0,1,
+63241,1,63234,1,
+63241,2,7,63234,1,
+63241,3,63234,4,0,1,
+63241,4,7,51494,0,0,1,
+63247,1,63242,1,
+63247,2,5,63246,1,
+63247,3,63242,1,0,1,
+63247,4,5,59655,5,0,1,
+63277,1,63275,1,
+63277,2,2,63273,1,
+63277,3,63275,6,0,1,
+63277,4,2,35827,6,0,1,
+63281,1,63275,1,
+63281,2,6,63278,1,
+63281,3,63275,4,0,1,
+63281,4,6,43459,0,0,1,
+63299,1,63297,1,
+63299,2,2,63298,1,
+63299,3,63297,3,0,1,
+63299,4,2,60566,2,0,1,
+63311,1,63294,1,
+63311,2,17,63310,1,
+63311,3,63294,1,0,1,
+63311,4,17,51397,3,0,1,
+63313,1,63308,1,
+63313,2,5,63310,1,
+63313,3,63308,1,0,1,
+63313,4,5,34930,10,0,1,
+63317,1,63315,1,
+63317,2,2,63313,1,
+63317,3,63315,7,0,1,
+63317,4,2,57640,7,0,1,
+63331,1,63329,1,
+63331,2,2,63327,1,
+63331,3,63329,2,0,1,
+63331,4,2,60540,8,0,1,
+63337,1,63332,1,
+63337,2,5,63336,1,
+63337,3,63332,5,0,1,
+63337,4,5,38091,16,0,1,
+63347,1,63345,1,
+63347,2,2,63343,1,
+63347,3,63345,3,0,1,
+63347,4,2,53866,8,0,1,
+63353,1,63350,1,
+63353,2,3,63347,1,
+63353,3,63350,11,0,1,
+63353,4,3,62641,1,0,1,
+63361,1,63324,1,
+63361,2,37,63344,1,
+63361,3,63324,7,0,1,
+63361,4,37,46878,36,0,1,
+63367,1,63364,1,
+63367,2,3,63366,1,
+63367,3,63364,1,0,1,
+63367,4,3,34185,2,0,1,
+63377,1,63374,1,
+63377,2,3,63372,1,
+63377,3,63374,1,0,1,
+63377,4,3,52720,0,0,1,
+63389,1,63387,1,
+63389,2,2,63385,1,
+63389,3,63387,2,0,1,
+63389,4,2,48122,12,0,1,
+63391,1,63388,1,
+63391,2,3,63389,1,
+63391,3,63388,1,0,1,
+63391,4,3,52937,6,0,1,
+63397,1,63395,1,
+63397,2,2,63396,1,
+63397,3,63395,5,0,1,
+63397,4,2,55543,6,0,1,
+63409,1,63402,1,
+63409,2,7,63402,1,
+63409,3,63402,7,0,1,
+63409,4,7,62501,0,0,1,
+63419,1,63417,1,
+63419,2,2,63418,1,
+63419,3,63417,3,0,1,
+63419,4,2,47019,4,0,1,
+63421,1,63419,1,
+63421,2,2,63417,1,
+63421,3,63419,5,0,1,
+63421,4,2,41070,6,0,1,
+63439,1,63436,1,
+63439,2,3,63438,1,
+63439,3,63436,1,0,1,
+63439,4,3,61658,2,0,1,
+63443,1,63441,1,
+63443,2,2,63439,1,
+63443,3,63441,3,0,1,
+63443,4,2,50612,7,0,1,
+63463,1,63458,1,
+63463,2,5,63462,1,
+63463,3,63458,10,0,1,
+63463,4,5,59293,3,0,1,
+63467,1,63465,1,
+63467,2,2,63466,1,
+63467,3,63465,2,0,1,
+63467,4,2,50599,4,0,1,
+63473,1,63470,1,
+63473,2,3,63468,1,
+63473,3,63470,1,0,1,
+63473,4,3,42553,0,0,1,
+63487,1,63484,1,
+63487,2,3,63486,1,
+63487,3,63484,7,0,1,
+63487,4,3,45109,5,0,1,
+63493,1,63491,1,
+63493,2,2,63492,1,
+63493,3,63491,2,0,1,
+63493,4,2,32266,6,0,1,
+63499,1,63496,1,
+63499,2,3,63498,1,
+63499,3,63496,4,0,1,
+63499,4,3,53027,2,0,1,
+63521,1,63518,1,
+63521,2,3,63520,1,
+63521,3,63518,7,0,1,
+63521,4,3,44157,4,0,1,
+63527,1,63522,1,
+63527,2,5,63526,1,
+63527,3,63522,1,0,1,
+63527,4,5,59118,2,0,1,
+63533,1,63530,1,
+63533,2,3,63531,1,
+63533,3,63530,3,0,1,
+63533,4,3,45853,7,0,1,
+63541,1,63539,1,
+63541,2,2,63537,1,
+63541,3,63539,6,0,1,
+63541,4,2,39262,6,0,1,
+63559,1,63556,1,
+63559,2,3,63557,1,
+63559,3,63556,4,0,1,
+63559,4,3,55017,6,0,1,
+63577,1,63572,1,
+63577,2,5,63576,1,
+63577,3,63572,1,0,1,
+63577,4,5,52829,6,0,1,
+63587,1,63585,1,
+63587,2,2,63583,1,
+63587,3,63585,3,0,1,
+63587,4,2,50506,11,0,1,
+63589,1,63587,1,
+63589,2,2,63585,1,
+63589,3,63587,6,0,1,
+63589,4,2,44259,12,0,1,
+63599,1,63592,1,
+63599,2,7,63598,1,
+63599,3,63592,2,0,1,
+63599,4,7,49293,3,0,1,
+63601,1,63594,1,
+63601,2,7,63598,1,
+63601,3,63594,2,0,1,
+63601,4,7,63244,16,0,1,
+63607,1,63604,1,
+63607,2,3,63605,1,
+63607,3,63604,1,0,1,
+63607,4,3,63603,4,0,1,
+63611,1,63609,1,
+63611,2,2,63606,1,
+63611,3,63609,5,0,1,
+63611,4,2,32024,3,0,1,
+63617,1,63614,1,
+63617,2,3,63612,1,
+63617,3,63614,3,0,1,
+63617,4,3,42887,0,0,1,
+63629,1,63627,1,
+63629,2,2,63628,1,
+63629,3,63627,3,0,1,
+63629,4,2,54409,9,0,1,
+63647,1,63642,1,
+63647,2,5,63642,1,
+63647,3,63642,1,0,1,
+63647,4,5,39696,7,0,1,
+63649,1,63642,1,
+63649,2,7,63646,1,
+63649,3,63642,3,0,1,
+63649,4,7,48666,17,0,1,
+63659,1,63657,1,
+63659,2,2,63655,1,
+63659,3,63657,2,0,1,
+63659,4,2,44961,7,0,1,
+63667,1,63665,1,
+63667,2,2,63663,1,
+63667,3,63665,6,0,1,
+63667,4,2,61260,10,0,1,
+63671,1,63660,1,
+63671,2,11,63669,1,
+63671,3,63660,5,0,1,
+63671,4,11,62157,3,0,1,
+63689,1,63686,1,
+63689,2,3,63683,1,
+63689,3,63686,3,0,1,
+63689,4,3,63677,0,0,1,
+63691,1,63676,1,
+63691,2,15,63690,1,
+63691,3,63676,1,0,1,
+63691,4,15,34653,6,0,1,
+63697,1,63692,1,
+63697,2,5,63694,1,
+63697,3,63692,1,0,1,
+63697,4,5,63686,14,0,1,
+63703,1,63700,1,
+63703,2,3,63702,1,
+63703,3,63700,3,0,1,
+63703,4,3,44331,2,0,1,
+63709,1,63703,1,
+63709,2,6,63708,1,
+63709,3,63703,1,0,1,
+63709,4,6,52134,27,0,1,
+63719,1,63706,1,
+63719,2,13,63715,1,
+63719,3,63706,1,0,1,
+63719,4,13,49694,6,0,1,
+63727,1,63721,1,
+63727,2,6,63726,1,
+63727,3,63721,1,0,1,
+63727,4,6,60312,9,0,1,
+63737,1,63734,1,
+63737,2,3,63729,1,
+63737,3,63734,3,0,1,
+63737,4,3,44762,2,0,1,
+63743,1,63738,1,
+63743,2,5,63738,1,
+63743,3,63738,7,0,1,
+63743,4,5,44314,6,0,1,
+63761,1,63758,1,
+63761,2,3,63755,1,
+63761,3,63758,5,0,1,
+63761,4,3,63749,0,0,1,
+63773,1,63771,1,
+63773,2,2,63772,1,
+63773,3,63771,2,0,1,
+63773,4,2,51531,3,0,1,
+63781,1,63779,1,
+63781,2,2,63777,1,
+63781,3,63779,4,0,1,
+63781,4,2,46335,6,0,1,
+63793,1,63788,1,
+63793,2,5,63792,1,
+63793,3,63788,1,0,1,
+63793,4,5,46437,11,0,1,
+63799,1,63793,1,
+63799,2,6,63798,1,
+63799,3,63793,3,0,1,
+63799,4,6,33492,3,0,1,
+63803,1,63801,1,
+63803,2,2,63802,1,
+63803,3,63801,3,0,1,
+63803,4,2,45662,2,0,1,
+63809,1,63806,1,
+63809,2,3,63804,1,
+63809,3,63806,4,0,1,
+63809,4,3,38517,2,0,1,
+63823,1,63820,1,
+63823,2,3,63821,1,
+63823,3,63820,10,0,1,
+63823,4,3,44743,3,0,1,
+63839,1,63810,1,
+63839,2,29,63836,1,
+63839,3,63810,6,0,1,
+63839,4,29,52266,4,0,1,
+63841,1,63824,1,
+63841,2,17,63840,1,
+63841,3,63824,1,0,1,
+63841,4,17,32205,18,0,1,
+63853,1,63851,1,
+63853,2,2,63852,1,
+63853,3,63851,2,0,1,
+63853,4,2,60444,6,0,1,
+63857,1,63854,1,
+63857,2,3,63856,1,
+63857,3,63854,4,0,1,
+63857,4,3,41700,4,0,1,
+63863,1,63858,1,
+63863,2,5,63860,1,
+63863,3,63858,5,0,1,
+63863,4,5,50800,6,0,1,
+63901,1,63894,1,
+63901,2,7,63899,1,
+63901,3,63894,3,0,1,
+63901,4,7,42432,4,0,1,
+63907,1,63905,1,
+63907,2,2,63903,1,
+63907,3,63905,4,0,1,
+63907,4,2,36755,10,0,1,
+63913,1,63900,1,
+63913,2,13,63912,1,
+63913,3,63900,4,0,1,
+63913,4,13,50745,6,0,1,
+63929,1,63926,1,
+63929,2,3,63928,1,
+63929,3,63926,3,0,1,
+63929,4,3,51391,4,0,1,
+63949,1,63947,1,
+63949,2,2,63945,1,
+63949,3,63947,5,0,1,
+63949,4,2,62108,6,0,1,
+63977,1,63974,1,
+63977,2,3,63966,1,
+63977,3,63974,15,0,1,
+63977,4,3,47618,1,0,1,
+63997,1,63995,1,
+63997,2,2,63996,1,
+63997,3,63995,2,0,1,
+63997,4,2,49095,3,0,1,
+64007,1,64002,1,
+64007,2,5,64005,1,
+64007,3,64002,1,0,1,
+64007,4,5,51492,8,0,1,
+64013,1,64011,1,
+64013,2,2,64012,1,
+64013,3,64011,2,0,1,
+64013,4,2,36728,6,0,1,
+64019,1,64017,1,
+64019,2,2,64015,1,
+64019,3,64017,3,0,1,
+64019,4,2,55357,7,0,1,
+64033,1,64028,1,
+64033,2,5,64032,1,
+64033,3,64028,2,0,1,
+64033,4,5,42155,12,0,1,
+64037,1,64035,1,
+64037,2,2,64033,1,
+64037,3,64035,3,0,1,
+64037,4,2,40137,9,0,1,
+64063,1,64060,1,
+64063,2,3,64062,1,
+64063,3,64060,3,0,1,
+64063,4,3,56576,5,0,1,
+64067,1,64062,1,
+64067,2,5,64066,1,
+64067,3,64062,5,0,1,
+64067,4,5,33568,13,0,1,
+64081,1,64070,1,
+64081,2,11,64078,1,
+64081,3,64070,2,0,1,
+64081,4,11,55613,14,0,1,
+64091,1,64089,1,
+64091,2,2,64090,1,
+64091,3,64089,3,0,1,
+64091,4,2,39373,4,0,1,
+64109,1,64107,1,
+64109,2,2,64108,1,
+64109,3,64107,4,0,1,
+64109,4,2,42240,4,0,1,
+64123,1,64121,1,
+64123,2,2,64122,1,
+64123,3,64121,2,0,1,
+64123,4,2,55300,2,0,1,
+64151,1,64134,1,
+64151,2,17,64150,1,
+64151,3,64134,10,0,1,
+64151,4,17,38195,3,0,1,
+64153,1,64148,1,
+64153,2,5,64148,1,
+64153,3,64148,2,0,1,
+64153,4,5,45494,15,0,1,
+64157,1,64155,1,
+64157,2,2,64153,1,
+64157,3,64155,3,0,1,
+64157,4,2,38351,7,0,1,
+64171,1,64164,1,
+64171,2,7,64169,1,
+64171,3,64164,4,0,1,
+64171,4,7,39100,6,0,1,
+64187,1,64185,1,
+64187,2,2,64183,1,
+64187,3,64185,3,0,1,
+64187,4,2,57561,8,0,1,
+64189,1,64187,1,
+64189,2,2,64188,1,
+64189,3,64187,6,0,1,
+64189,4,2,54808,7,0,1,
+64217,1,64214,1,
+64217,2,3,64216,1,
+64217,3,64214,1,0,1,
+64217,4,3,46207,4,0,1,
+64223,1,64218,1,
+64223,2,5,64221,1,
+64223,3,64218,3,0,1,
+64223,4,5,64219,3,0,1,
+64231,1,64219,1,
+64231,2,12,64230,1,
+64231,3,64219,1,0,1,
+64231,4,12,48608,8,0,1,
+64237,1,64235,1,
+64237,2,2,64236,1,
+64237,3,64235,6,0,1,
+64237,4,2,56727,3,0,1,
+64271,1,64264,1,
+64271,2,7,64270,1,
+64271,3,64264,4,0,1,
+64271,4,7,46350,3,0,1,
+64279,1,64250,1,
+64279,2,29,64278,1,
+64279,3,64250,1,0,1,
+64279,4,29,62098,2,0,1,
+64283,1,64281,1,
+64283,2,2,64279,1,
+64283,3,64281,3,0,1,
+64283,4,2,32361,8,0,1,
+64301,1,64299,1,
+64301,2,2,64297,1,
+64301,3,64299,3,0,1,
+64301,4,2,37355,1,0,1,
+64303,1,64297,1,
+64303,2,6,64300,1,
+64303,3,64297,10,0,1,
+64303,4,6,32487,5,0,1,
+64319,1,64306,1,
+64319,2,13,64315,1,
+64319,3,64306,1,0,1,
+64319,4,13,42640,7,0,1,
+64327,1,64324,1,
+64327,2,3,64326,1,
+64327,3,64324,3,0,1,
+64327,4,3,33104,5,0,1,
+64333,1,64331,1,
+64333,2,2,64329,1,
+64333,3,64331,5,0,1,
+64333,4,2,50093,6,0,1,
+64373,1,64371,1,
+64373,2,2,64368,1,
+64373,3,64371,7,0,1,
+64373,4,2,42537,0,0,1,
+64381,1,64379,1,
+64381,2,2,64377,1,
+64381,3,64379,2,0,1,
+64381,4,2,54656,12,0,1,
+64399,1,64396,1,
+64399,2,3,64397,1,
+64399,3,64396,3,0,1,
+64399,4,3,38922,3,0,1,
+64403,1,64398,1,
+64403,2,5,64401,1,
+64403,3,64398,1,0,1,
+64403,4,5,53529,0,0,1,
+64433,1,64430,1,
+64433,2,3,64428,1,
+64433,3,64430,3,0,1,
+64433,4,3,55938,0,0,1,
+64439,1,64432,1,
+64439,2,7,64437,1,
+64439,3,64432,2,0,1,
+64439,4,7,63003,4,0,1,
+64451,1,64449,1,
+64451,2,2,64447,1,
+64451,3,64449,2,0,1,
+64451,4,2,54312,7,0,1,
+64453,1,64451,1,
+64453,2,2,64449,1,
+64453,3,64451,6,0,1,
+64453,4,2,38959,6,0,1,
+64483,1,64481,1,
+64483,2,2,64479,1,
+64483,3,64481,2,0,1,
+64483,4,2,50586,1,0,1,
+64489,1,64482,1,
+64489,2,7,64486,1,
+64489,3,64482,1,0,1,
+64489,4,7,54347,14,0,1,
+64499,1,64497,1,
+64499,2,2,64495,1,
+64499,3,64497,2,0,1,
+64499,4,2,50377,7,0,1,
+64513,1,64508,1,
+64513,2,5,64512,1,
+64513,3,64508,1,0,1,
+64513,4,5,50578,6,0,1,
+64553,1,64550,1,
+64553,2,3,64548,1,
+64553,3,64550,3,0,1,
+64553,4,3,60008,0,0,1,
+64567,1,64564,1,
+64567,2,3,64566,1,
+64567,3,64564,1,0,1,
+64567,4,3,50465,5,0,1,
+64577,1,64574,1,
+64577,2,3,64571,1,
+64577,3,64574,1,0,1,
+64577,4,3,36260,11,0,1,
+64579,1,64577,1,
+64579,2,2,64573,1,
+64579,3,64577,2,0,1,
+64579,4,2,59371,3,0,1,
+64591,1,64588,1,
+64591,2,3,64590,1,
+64591,3,64588,1,0,1,
+64591,4,3,53938,3,0,1,
+64601,1,64598,1,
+64601,2,3,64595,1,
+64601,3,64598,6,0,1,
+64601,4,3,64589,0,0,1,
+64609,1,64574,1,
+64609,2,35,64596,1,
+64609,3,64574,1,0,1,
+64609,4,35,37869,20,0,1,
+64613,1,64611,1,
+64613,2,2,64612,1,
+64613,3,64611,3,0,1,
+64613,4,2,43964,3,0,1,
+64621,1,64615,1,
+64621,2,6,64620,1,
+64621,3,64615,1,0,1,
+64621,4,6,41431,7,0,1,
+64627,1,64622,1,
+64627,2,5,64626,1,
+64627,3,64622,5,0,1,
+64627,4,5,57281,10,0,1,
+64633,1,64628,1,
+64633,2,5,64632,1,
+64633,3,64628,5,0,1,
+64633,4,5,57835,12,0,1,
+64661,1,64659,1,
+64661,2,2,64657,1,
+64661,3,64659,2,0,1,
+64661,4,2,52413,6,0,1,
+64663,1,64657,1,
+64663,2,6,64662,1,
+64663,3,64657,2,0,1,
+64663,4,6,57699,3,0,1,
+64667,1,64665,1,
+64667,2,2,64663,1,
+64667,3,64665,3,0,1,
+64667,4,2,58548,8,0,1,
+64679,1,64662,1,
+64679,2,17,64674,1,
+64679,3,64662,5,0,1,
+64679,4,17,60594,6,0,1,
+64693,1,64691,1,
+64693,2,2,64692,1,
+64693,3,64691,6,0,1,
+64693,4,2,62227,3,0,1,
+64709,1,64706,1,
+64709,2,3,64704,1,
+64709,3,64706,6,0,1,
+64709,4,3,56549,2,0,1,
+64717,1,64715,1,
+64717,2,2,64713,1,
+64717,3,64715,4,0,1,
+64717,4,2,42839,10,0,1,
+64747,1,64742,1,
+64747,2,5,64746,1,
+64747,3,64742,1,0,1,
+64747,4,5,36222,5,0,1,
+64763,1,64761,1,
+64763,2,2,64759,1,
+64763,3,64761,3,0,1,
+64763,4,2,43934,16,0,1,
+64781,1,64779,1,
+64781,2,2,64776,1,
+64781,3,64779,4,0,1,
+64781,4,2,38678,2,0,1,
+64783,1,64778,1,
+64783,2,5,64782,1,
+64783,3,64778,1,0,1,
+64783,4,5,58349,2,0,1,
+64793,1,64790,1,
+64793,2,3,64787,1,
+64793,3,64790,6,0,1,
+64793,4,3,41440,9,0,1,
+64811,1,64809,1,
+64811,2,2,64810,1,
+64811,3,64809,12,0,1,
+64811,4,2,58749,2,0,1,
+64817,1,64814,1,
+64817,2,3,64811,1,
+64817,3,64814,4,0,1,
+64817,4,3,59280,9,0,1,
+64849,1,64836,1,
+64849,2,13,64848,1,
+64849,3,64836,4,0,1,
+64849,4,13,41497,14,0,1,
+64853,1,64851,1,
+64853,2,2,64849,1,
+64853,3,64851,3,0,1,
+64853,4,2,57996,1,0,1,
+64871,1,64864,1,
+64871,2,7,64870,1,
+64871,3,64864,7,0,1,
+64871,4,7,39297,3,0,1,
+64877,1,64874,1,
+64877,2,3,64876,1,
+64877,3,64874,7,0,1,
+64877,4,3,60577,6,0,1,
+64879,1,64873,1,
+64879,2,6,64878,1,
+64879,3,64873,3,0,1,
+64879,4,6,42037,3,0,1,
+64891,1,64881,1,
+64891,2,10,64890,1,
+64891,3,64881,5,0,1,
+64891,4,10,64217,2,0,1,
+64901,1,64899,1,
+64901,2,2,64897,1,
+64901,3,64899,3,0,1,
+64901,4,2,52960,6,0,1,
+64919,1,64912,1,
+64919,2,7,64917,1,
+64919,3,64912,9,0,1,
+64919,4,7,54303,5,0,1,
+64921,1,64914,1,
+64921,2,7,64914,1,
+64921,3,64914,1,0,1,
+64921,4,7,32920,0,0,1,
+64927,1,64924,1,
+64927,2,3,64925,1,
+64927,3,64924,4,0,1,
+64927,4,3,55506,6,0,1,
+64937,1,64934,1,
+64937,2,3,64932,1,
+64937,3,64934,1,0,1,
+64937,4,3,53518,0,0,1,
+64951,1,64948,1,
+64951,2,3,64950,1,
+64951,3,64948,4,0,1,
+64951,4,3,56365,2,0,1,
+64969,1,64956,1,
+64969,2,13,64968,1,
+64969,3,64956,1,0,1,
+64969,4,13,53294,14,0,1,
+64997,1,64995,1,
+64997,2,2,64993,1,
+64997,3,64995,3,0,1,
+64997,4,2,52445,7,0,1,
+65003,1,64998,1,
+65003,2,5,65001,1,
+65003,3,64998,3,0,1,
+65003,4,5,34388,0,0,1,
+65011,1,65009,1,
+65011,2,2,65007,1,
+65011,3,65009,5,0,1,
+65011,4,2,57311,8,0,1,
+65027,1,65025,1,
+65027,2,2,65021,1,
+65027,3,65025,4,0,1,
+65027,4,2,54894,4,0,1,
+65029,1,65027,1,
+65029,2,2,65028,1,
+65029,3,65027,6,0,1,
+65029,4,2,56829,3,0,1,
+65033,1,65030,1,
+65033,2,3,65028,1,
+65033,3,65030,1,0,1,
+65033,4,3,58622,0,0,1,
+65053,1,65048,1,
+65053,2,5,65050,1,
+65053,3,65048,9,0,1,
+65053,4,5,57093,1,0,1,
+65063,1,65058,1,
+65063,2,5,65061,1,
+65063,3,65058,6,0,1,
+65063,4,5,51223,10,0,1,
+65071,1,65068,1,
+65071,2,3,65070,1,
+65071,3,65068,6,0,1,
+65071,4,3,40238,3,0,1,
+65089,1,65082,1,
+65089,2,7,65086,1,
+65089,3,65082,2,0,1,
+65089,4,7,65070,22,0,1,
+65099,1,65097,1,
+65099,2,2,65090,1,
+65099,3,65097,3,0,1,
+65099,4,2,53861,1,0,1,
+65101,1,65099,1,
+65101,2,2,65097,1,
+65101,3,65099,2,0,1,
+65101,4,2,61904,10,0,1,
+65111,1,65104,1,
+65111,2,7,65110,1,
+65111,3,65104,1,0,1,
+65111,4,7,58892,2,0,1,
+65119,1,65116,1,
+65119,2,3,65114,1,
+65119,3,65116,4,0,1,
+65119,4,3,47853,7,0,1,
+65123,1,65121,1,
+65123,2,2,65119,1,
+65123,3,65121,3,0,1,
+65123,4,2,55674,8,0,1,
+65129,1,65126,1,
+65129,2,3,65120,1,
+65129,3,65126,1,0,1,
+65129,4,3,37272,3,0,1,
+65141,1,65139,1,
+65141,2,2,65136,1,
+65141,3,65139,3,0,1,
+65141,4,2,64516,18,0,1,
+65147,1,65145,1,
+65147,2,2,65146,1,
+65147,3,65145,5,0,1,
+65147,4,2,41370,10,0,1,
+65167,1,65162,1,
+65167,2,5,65165,1,
+65167,3,65162,3,0,1,
+65167,4,5,65163,3,0,1,
+65171,1,65169,1,
+65171,2,2,65167,1,
+65171,3,65169,3,0,1,
+65171,4,2,35802,7,0,1,
+65173,1,65171,1,
+65173,2,2,65172,1,
+65173,3,65171,5,0,1,
+65173,4,2,58034,6,0,1,
+65179,1,65177,1,
+65179,2,2,65175,1,
+65179,3,65177,2,0,1,
+65179,4,2,39472,8,0,1,
+65183,1,65178,1,
+65183,2,5,65181,1,
+65183,3,65178,2,0,1,
+65183,4,5,65179,3,0,1,
+65203,1,65201,1,
+65203,2,2,65202,1,
+65203,3,65201,2,0,1,
+65203,4,2,56555,10,0,1,
+65213,1,65211,1,
+65213,2,2,65209,1,
+65213,3,65211,3,0,1,
+65213,4,2,64642,7,0,1,
+65239,1,65236,1,
+65239,2,3,65234,1,
+65239,3,65236,7,0,1,
+65239,4,3,38859,6,0,1,
+65257,1,65252,1,
+65257,2,5,65252,1,
+65257,3,65252,2,0,1,
+65257,4,5,49206,12,0,1,
+65267,1,65265,1,
+65267,2,2,65266,1,
+65267,3,65265,2,0,1,
+65267,4,2,65260,8,0,1,
+65269,1,65267,1,
+65269,2,2,65265,1,
+65269,3,65267,6,0,1,
+65269,4,2,49182,6,0,1,
+65287,1,65284,1,
+65287,2,3,65286,1,
+65287,3,65284,3,0,1,
+65287,4,3,40493,5,0,1,
+65293,1,65291,1,
+65293,2,2,65289,1,
+65293,3,65291,6,0,1,
+65293,4,2,61269,15,0,1,
+65309,1,65307,1,
+65309,2,2,65308,1,
+65309,3,65307,3,0,1,
+65309,4,2,39470,3,0,1,
+65323,1,65321,1,
+65323,2,2,65322,1,
+65323,3,65321,4,0,1,
+65323,4,2,51095,2,0,1,
+65327,1,65322,1,
+65327,2,5,65320,1,
+65327,3,65322,1,0,1,
+65327,4,5,41871,9,0,1,
+65353,1,65348,1,
+65353,2,5,65352,1,
+65353,3,65348,1,0,1,
+65353,4,5,41358,6,0,1,
+65357,1,65355,1,
+65357,2,2,65356,1,
+65357,3,65355,3,0,1,
+65357,4,2,58240,3,0,1,
+65371,1,65369,1,
+65371,2,2,65370,1,
+65371,3,65369,4,0,1,
+65371,4,2,58383,2,0,1,
+65381,1,65378,1,
+65381,2,3,65379,1,
+65381,3,65378,6,0,1,
+65381,4,3,65373,10,0,1,
+65393,1,65390,1,
+65393,2,3,65386,1,
+65393,3,65390,13,0,1,
+65393,4,3,40335,13,0,1,
+65407,1,65404,1,
+65407,2,3,65405,1,
+65407,3,65404,1,0,1,
+65407,4,3,33781,6,0,1,
+65413,1,65408,1,
+65413,2,5,65412,1,
+65413,3,65408,5,0,1,
+65413,4,5,43090,6,0,1,
+65419,1,65416,1,
+65419,2,3,65418,1,
+65419,3,65416,5,0,1,
+65419,4,3,33267,7,0,1,
+65423,1,65418,1,
+65423,2,5,65420,1,
+65423,3,65418,2,0,1,
+65423,4,5,55880,6,0,1,
+65437,1,65431,1,
+65437,2,6,65435,1,
+65437,3,65431,1,0,1,
+65437,4,6,35512,16,0,1,
+65447,1,65442,1,
+65447,2,5,65445,1,
+65447,3,65442,7,0,1,
+65447,4,5,34701,5,0,1,
+65449,1,65438,1,
+65449,2,11,65445,1,
+65449,3,65438,1,0,1,
+65449,4,11,65435,11,0,1,
+65479,1,65472,1,
+65479,2,7,65467,1,
+65479,3,65472,3,0,1,
+65479,4,7,58767,0,0,1,
+65497,1,65490,1,
+65497,2,7,65490,1,
+65497,3,65490,11,0,1,
+65497,4,7,42170,14,0,1,
+65519,1,65508,1,
+65519,2,11,65518,1,
+65519,3,65508,2,0,1,
+65519,4,11,41499,3,0,1,
+65521,1,65504,1,
+65521,2,17,65518,1,
+65521,3,65504,1,0,1,
+65521,4,17,42121,20,0,1,
+65537,4,3,48035,7,0,1,
+65539,4,2,53504,6,0,1,
+65543,4,5,44768,11,0,1,
+65551,4,6,65547,6,0,1,
+65557,4,5,60449,1,0,1,
+65563,4,3,59509,0,0,1,
+65579,4,2,39899,7,0,1,
+65581,4,2,56596,3,0,1,
+65587,4,2,39688,10,0,1,
+65599,4,3,48691,3,0,1,
+65609,4,3,65597,0,0,1,
+65617,4,13,46802,11,0,1,
+65629,4,2,64483,2,0,1,
+65633,4,3,53051,9,0,1,
+65647,4,3,54892,2,0,1,
+65651,4,2,58463,2,0,1,
+65657,4,3,54810,0,0,1,
+65677,4,2,52138,3,0,1,
+65687,4,5,39057,5,0,1,
+65699,4,2,58874,3,0,1,
+65701,4,6,35742,0,0,1,
+65707,4,2,62355,2,0,1,
+65713,4,10,63124,6,0,1,
+65717,4,2,56730,7,0,1,
+65719,4,3,65715,4,0,1,
+65729,4,3,37642,4,0,1,
+65731,4,10,61963,0,0,1,
+65761,4,7,65398,16,0,1,
+65777,4,3,51201,7,0,1,
+65789,4,2,52108,4,0,1,
+65809,4,11,36642,23,0,1,
+65827,4,2,41666,0,0,1,
+65831,4,31,64129,4,0,1,
+65837,4,2,56209,18,0,1,
+65839,4,3,38189,6,0,1,
+65843,4,2,36484,0,0,1,
+65851,4,3,44421,3,0,1,
+65867,4,2,60917,7,0,1,
+65881,4,11,46761,18,0,1,
+65899,4,3,56823,3,0,1,
+65921,4,3,54248,1,0,1,
+65927,4,5,65915,11,0,1,
+65929,4,7,45196,14,0,1,
+65951,4,13,64135,7,0,1,
+65957,4,2,62325,1,0,1,
+65963,4,2,38212,7,0,1,
+65981,4,2,62459,9,0,1,
+65983,4,3,52265,3,0,1,
+65993,4,3,37433,1,0,1,
+66029,4,2,42133,1,0,1,
+66037,4,2,47483,6,0,1,
+66041,4,3,51490,2,0,1,
+66047,4,5,49893,2,0,1,
+66067,4,3,41503,2,0,1,
+66071,4,22,33376,7,0,1,
+66083,4,2,43702,4,0,1,
+66089,4,3,66077,0,0,1,
+66103,4,3,64179,3,0,1,
+66107,4,2,59363,14,0,1,
+66109,4,2,47832,10,0,1,
+66137,4,3,36824,0,0,1,
+66161,4,3,36306,4,0,1,
+66169,4,14,34612,20,0,1,
+66173,4,2,48656,4,0,1,
+66179,4,2,46239,0,0,1,
+66191,4,11,40036,3,0,1,
+66221,4,2,43440,6,0,1,
+66239,4,17,38430,7,0,1,
+66271,4,3,33897,2,0,1,
+66293,4,2,36555,1,0,1,
+66301,4,22,66277,12,0,1,
+66337,4,5,63257,12,0,1,
+66343,4,5,53293,2,0,1,
+66347,4,2,52402,8,0,1,
+66359,4,13,40724,3,0,1,
+66361,4,17,54358,35,0,1,
+66373,4,2,64893,14,0,1,
+66377,4,3,37215,1,0,1,
+66383,4,5,46399,10,0,1,
+66403,4,2,46989,8,0,1,
+66413,4,2,39202,6,0,1,
+66431,4,7,43779,9,0,1,
+66449,4,3,49019,3,0,1,
+66457,4,5,35848,6,0,1,
+66463,4,10,47564,2,0,1,
+66467,4,2,38103,13,0,1,
+66491,4,2,47685,2,0,1,
+66499,4,2,46693,6,0,1,
+66509,4,2,42163,19,0,1,
+66523,4,2,46700,8,0,1,
+66529,4,19,34453,26,0,1,
+66533,4,2,49134,2,0,1,
+66541,4,6,50298,2,0,1,
+66553,4,10,57958,6,0,1,
+66569,4,3,61968,0,0,1,
+66571,4,7,66124,6,0,1,
+66587,4,2,46349,2,0,1,
+66593,4,3,47462,4,0,1,
+66601,4,7,42297,0,0,1,
+66617,4,3,37334,0,0,1,
+66629,4,2,45627,1,0,1,
+66643,4,2,37302,2,0,1,
+66653,4,2,37184,1,0,1,
+66683,4,5,66675,6,0,1,
+66697,4,5,51165,10,0,1,
+66701,4,3,39641,3,0,1,
+66713,4,3,51248,1,0,1,
+66721,4,13,51624,14,0,1,
+66733,4,2,49817,10,0,1,
+66739,4,2,51010,8,0,1,
+66749,4,3,41570,2,0,1,
+66751,4,3,61431,7,0,1,
+66763,4,3,34439,3,0,1,
+66791,4,7,63890,6,0,1,
+66797,4,2,46537,6,0,1,
+66809,4,6,59124,4,0,1,
+66821,4,2,49306,3,0,1,
+66841,4,7,35751,24,0,1,
+66851,4,2,53354,3,0,1,
+66853,4,2,60261,3,0,1,
+66863,4,5,61991,2,0,1,
+66877,4,5,57414,9,0,1,
+66883,4,2,34328,2,0,1,
+66889,4,17,40264,20,0,1,
+66919,4,6,63458,3,0,1,
+66923,4,2,41480,11,0,1,
+66931,4,3,49609,2,0,1,
+66943,4,3,42749,5,0,1,
+66947,4,2,52267,2,0,1,
+66949,4,10,59718,12,0,1,
+66959,4,7,66950,4,0,1,
+66973,4,2,60937,6,0,1,
+66977,4,5,47327,6,0,1,
+67003,4,2,60348,7,0,1,
+67021,4,7,66503,12,0,1,
+67033,4,5,40294,16,0,1,
+67043,4,2,45952,7,0,1,
+67049,4,3,36231,2,0,1,
+67057,4,5,66160,20,0,1,
+67061,4,2,66482,12,0,1,
+67073,4,3,46520,6,0,1,
+67079,4,11,59667,2,0,1,
+67103,4,5,40335,7,0,1,
+67121,4,6,44101,10,0,1,
+67129,4,7,47157,17,0,1,
+67139,4,2,35718,1,0,1,
+67141,4,2,42216,10,0,1,
+67153,4,5,60531,10,0,1,
+67157,4,2,64015,0,0,1,
+67169,4,3,44657,2,0,1,
+67181,4,2,40205,6,0,1,
+67187,4,2,39121,8,0,1,
+67189,4,6,34897,2,0,1,
+67211,4,2,66762,8,0,1,
+67213,4,2,34141,6,0,1,
+67217,4,3,63758,6,0,1,
+67219,4,11,52068,1,0,1,
+67231,4,3,47479,2,0,1,
+67247,4,5,63238,5,0,1,
+67261,4,2,54686,3,0,1,
+67271,4,14,36213,10,0,1,
+67273,4,7,62964,10,0,1,
+67289,4,3,60185,7,0,1,
+67307,4,2,38062,7,0,1,
+67339,4,3,39869,7,0,1,
+67343,4,5,67339,3,0,1,
+67349,4,2,50278,9,0,1,
+67369,4,19,38219,42,0,1,
+67391,4,7,40053,3,0,1,
+67399,4,3,37548,3,0,1,
+67409,4,3,67397,0,0,1,
+67411,4,2,40791,8,0,1,
+67421,4,2,39383,1,0,1,
+67427,4,2,54909,7,0,1,
+67429,4,2,62571,3,0,1,
+67433,4,3,62067,0,0,1,
+67447,4,3,60311,2,0,1,
+67453,4,2,45967,21,0,1,
+67477,4,2,54738,12,0,1,
+67481,4,3,34031,2,0,1,
+67489,4,23,65362,27,0,1,
+67493,4,2,34037,1,0,1,
+67499,4,2,34518,7,0,1,
+67511,4,11,52043,3,0,1,
+67523,4,2,44628,7,0,1,
+67531,4,10,40415,0,0,1,
+67537,4,5,46327,16,0,1,
+67547,4,2,37219,0,0,1,
+67559,4,7,65191,2,0,1,
+67567,4,3,36628,6,0,1,
+67577,4,3,66797,6,0,1,
+67579,4,7,65404,8,0,1,
+67589,4,2,58765,0,0,1,
+67601,4,3,67233,1,0,1,
+67607,4,5,66360,5,0,1,
+67619,4,2,44755,2,0,1,
+67631,4,7,51169,2,0,1,
+67651,4,11,40363,10,0,1,
+67679,4,19,66816,9,0,1,
+67699,4,2,59915,2,0,1,
+67709,4,2,50938,0,0,1,
+67723,4,5,38763,0,0,1,
+67733,4,2,36882,0,0,1,
+67741,4,6,67733,12,0,1,
+67751,4,13,39889,5,0,1,
+67757,4,3,67753,4,0,1,
+67759,4,6,60346,3,0,1,
+67763,4,2,50484,10,0,1,
+67777,4,5,54147,16,0,1,
+67783,4,3,57395,3,0,1,
+67789,4,6,62008,2,0,1,
+67801,4,11,44970,12,0,1,
+67807,4,3,44975,3,0,1,
+67819,4,10,46696,0,0,1,
+67829,4,2,64028,1,0,1,
+67843,4,14,60029,0,0,1,
+67853,4,2,41571,6,0,1,
+67867,4,2,54474,8,0,1,
+67883,4,2,42483,8,0,1,
+67891,4,3,47030,2,0,1,
+67901,4,3,67897,4,0,1,
+67927,4,3,53290,2,0,1,
+67931,4,6,67921,7,0,1,
+67933,4,2,50804,3,0,1,
+67939,4,3,56500,6,0,1,
+67943,4,5,41694,3,0,1,
+67957,4,2,58354,9,0,1,
+67961,4,3,67949,0,0,1,
+67967,4,5,67963,3,0,1,
+67979,4,2,65282,4,0,1,
+67987,4,2,58210,2,0,1,
+67993,4,5,67982,14,0,1,
+68023,4,3,66480,5,0,1,
+68041,4,22,53027,0,0,1,
+68053,4,5,50643,3,0,1,
+68059,4,2,61367,7,0,1,
+68071,4,6,63651,2,0,1,
+68087,4,5,61008,12,0,1,
+68099,4,2,56605,7,0,1,
+68111,4,7,56197,5,0,1,
+68113,4,5,58986,19,0,1,
+68141,4,3,56253,11,0,1,
+68147,4,2,50319,7,0,1,
+68161,4,13,61180,35,0,1,
+68171,4,2,53531,7,0,1,
+68207,4,5,57650,4,0,1,
+68209,4,13,66709,24,0,1,
+68213,4,2,34705,3,0,1,
+68219,4,2,48877,8,0,1,
+68227,4,2,67030,7,0,1,
+68239,4,3,42806,3,0,1,
+68261,4,2,64746,6,0,1,
+68279,4,7,54053,7,0,1,
+68281,4,7,62806,17,0,1,
+68311,4,6,35999,3,0,1,
+68329,4,11,44735,12,0,1,
+68351,4,17,39570,5,0,1,
+68371,4,7,67918,6,0,1,
+68389,4,2,43445,3,0,1,
+68399,4,7,67493,4,0,1,
+68437,4,2,65782,3,0,1,
+68443,4,5,68435,6,0,1,
+68447,4,5,68443,3,0,1,
+68449,4,7,61208,0,0,1,
+68473,4,10,59060,14,0,1,
+68477,4,2,64640,3,0,1,
+68483,4,2,35912,18,0,1,
+68489,4,3,44684,2,0,1,
+68491,4,10,64941,5,0,1,
+68501,4,3,59518,4,0,1,
+68507,4,2,46230,4,0,1,
+68521,4,7,44205,0,0,1,
+68531,4,6,36372,0,0,1,
+68539,4,2,48277,3,0,1,
+68543,4,5,67315,3,0,1,
+68567,4,5,63503,3,0,1,
+68581,4,6,39927,2,0,1,
+68597,4,2,43600,12,0,1,
+68611,4,2,35758,8,0,1,
+68633,4,3,61618,1,0,1,
+68639,4,7,39801,7,0,1,
+68659,4,2,57459,2,0,1,
+68669,4,2,48273,3,0,1,
+68683,4,2,68676,8,0,1,
+68687,4,5,50345,3,0,1,
+68699,4,2,44701,0,0,1,
+68711,4,11,43127,5,0,1,
+68713,4,5,48329,16,0,1,
+68729,4,3,68717,0,0,1,
+68737,4,5,56637,11,0,1,
+68743,4,3,68739,4,0,1,
+68749,4,6,52637,0,0,1,
+68767,4,3,36909,2,0,1,
+68771,4,10,54749,6,0,1,
+68777,4,3,48049,0,0,1,
+68791,4,3,46092,2,0,1,
+68813,4,2,57442,3,0,1,
+68819,4,2,65671,8,0,1,
+68821,4,14,58139,1,0,1,
+68863,4,3,68855,10,0,1,
+68879,4,13,60045,16,0,1,
+68881,4,22,68855,19,0,1,
+68891,4,2,43114,3,0,1,
+68897,4,3,47010,9,0,1,
+68899,4,2,59615,2,0,1,
+68903,4,5,36021,5,0,1,
+68909,4,2,65803,7,0,1,
+68917,4,5,38485,1,0,1,
+68927,4,5,52010,8,0,1,
+68947,4,2,60274,35,0,1,
+68963,4,2,53458,2,0,1,
+68993,4,3,64207,1,0,1,
+69001,4,19,67000,32,0,1,
+69011,4,6,63999,9,0,1,
+69019,4,2,47422,2,0,1,
+69029,4,2,52075,2,0,1,
+69031,4,3,55096,3,0,1,
+69061,4,2,59670,6,0,1,
+69067,4,2,69060,8,0,1,
+69073,4,10,41305,0,0,1,
+69109,4,2,53659,3,0,1,
+69119,4,13,35190,4,0,1,
+69127,4,5,69123,3,0,1,
+69143,4,5,43087,2,0,1,
+69149,4,2,56221,2,0,1,
+69151,4,11,57951,3,0,1,
+69163,4,2,69156,8,0,1,
+69191,4,11,53053,5,0,1,
+69193,4,10,35071,8,0,1,
+69197,4,2,68453,9,0,1,
+69203,4,2,68459,15,0,1,
+69221,4,2,45363,12,0,1,
+69233,4,3,35325,4,0,1,
+69239,4,7,50195,3,0,1,
+69247,4,3,59921,5,0,1,
+69257,4,3,68051,2,0,1,
+69259,4,2,39845,8,0,1,
+69263,4,5,59152,8,0,1,
+69313,4,10,67033,0,0,1,
+69317,4,3,51122,4,0,1,
+69337,4,5,48687,15,0,1,
+69341,4,3,69333,10,0,1,
+69371,4,2,38806,8,0,1,
+69379,4,2,53834,8,0,1,
+69383,4,5,69379,3,0,1,
+69389,4,2,45620,4,0,1,
+69401,4,6,58645,4,0,1,
+69403,4,14,66102,7,0,1,
+69427,4,2,49466,8,0,1,
+69431,4,13,60664,7,0,1,
+69439,4,3,68321,3,0,1,
+69457,4,5,66848,6,0,1,
+69463,4,6,47263,4,0,1,
+69467,4,2,43474,2,0,1,
+69473,4,3,44504,0,0,1,
+69481,4,7,56254,2,0,1,
+69491,4,2,35320,8,0,1,
+69493,4,2,61830,6,0,1,
+69497,4,3,56279,7,0,1,
+69499,4,3,49301,5,0,1,
+69539,4,2,36956,7,0,1,
+69557,4,2,37857,4,0,1,
+69593,4,3,61280,1,0,1,
+69623,4,5,35040,6,0,1,
+69653,4,2,40852,1,0,1,
+69661,4,6,46057,7,0,1,
+69677,4,2,67391,4,0,1,
+69691,4,2,54995,2,0,1,
+69697,4,5,38932,12,0,1,
+69709,4,11,59497,11,0,1,
+69737,4,3,40589,4,0,1,
+69739,4,2,41714,2,0,1,
+69761,4,3,54923,4,0,1,
+69763,4,2,43287,10,0,1,
+69767,4,5,60380,5,0,1,
+69779,4,2,62123,7,0,1,
+69809,4,3,50037,0,0,1,
+69821,4,7,45311,9,0,1,
+69827,4,2,66053,24,0,1,
+69829,4,10,41766,14,0,1,
+69833,4,5,62115,10,0,1,
+69847,4,10,57258,3,0,1,
+69857,4,3,43449,4,0,1,
+69859,4,10,54267,1,0,1,
+69877,4,2,40066,6,0,1,
+69899,4,2,65475,4,0,1,
+69911,4,7,69902,4,0,1,
+69929,4,3,51163,2,0,1,
+69931,4,3,69231,2,0,1,
+69941,4,2,43594,6,0,1,
+69959,4,7,54329,5,0,1,
+69991,4,3,68518,3,0,1,
+69997,4,2,67197,2,0,1,
+70001,4,3,63569,4,0,1,
+70003,4,2,42929,10,0,1,
+70009,4,19,60077,32,0,1,
+70019,4,6,38012,5,0,1,
+70039,4,3,51654,2,0,1,
+70051,4,7,37283,6,0,1,
+70061,4,2,68098,3,0,1,
+70067,4,2,69150,0,0,1,
+70079,4,7,40728,3,0,1,
+70099,4,3,45248,2,0,1,
+70111,4,6,57088,3,0,1,
+70117,4,2,47614,6,0,1,
+70121,4,6,36468,7,0,1,
+70123,4,2,50832,14,0,1,
+70139,4,2,42365,1,0,1,
+70141,4,10,69186,12,0,1,
+70157,4,2,42002,5,0,1,
+70163,4,2,43249,1,0,1,
+70177,4,5,51571,6,0,1,
+70181,4,7,65289,0,0,1,
+70183,4,3,70179,4,0,1,
+70199,4,17,53238,8,0,1,
+70201,4,14,54788,8,0,1,
+70207,4,5,42032,5,0,1,
+70223,4,5,37478,3,0,1,
+70229,4,2,47017,4,0,1,
+70237,4,2,56553,3,0,1,
+70241,4,6,53215,4,0,1,
+70249,4,23,41688,34,0,1,
+70271,4,11,68323,5,0,1,
+70289,4,3,64290,4,0,1,
+70297,4,5,47250,10,0,1,
+70309,4,6,53424,11,0,1,
+70313,4,3,56400,11,0,1,
+70321,4,7,36964,17,0,1,
+70327,4,11,68433,14,0,1,
+70351,4,6,63404,2,0,1,
+70373,4,2,51044,6,0,1,
+70379,4,6,57535,0,0,1,
+70381,4,10,56129,1,0,1,
+70393,4,5,48327,10,0,1,
+70423,4,5,70419,3,0,1,
+70429,4,10,59245,2,0,1,
+70439,4,13,36995,6,0,1,
+70451,4,6,57297,5,0,1,
+70457,4,3,60784,4,0,1,
+70459,4,3,51996,2,0,1,
+70481,4,3,48650,2,0,1,
+70487,4,5,44704,14,0,1,
+70489,4,17,45627,20,0,1,
+70501,4,2,64881,10,0,1,
+70507,4,2,44678,2,0,1,
+70529,4,3,56755,7,0,1,
+70537,4,5,62941,15,0,1,
+70549,4,2,56638,3,0,1,
+70571,4,2,54714,7,0,1,
+70573,4,2,70566,8,0,1,
+70583,4,5,70579,3,0,1,
+70589,4,2,49075,4,0,1,
+70607,4,5,58381,4,0,1,
+70619,4,2,61619,2,0,1,
+70621,4,6,41805,7,0,1,
+70627,4,7,53445,13,0,1,
+70639,4,3,61082,3,0,1,
+70657,4,7,36137,8,0,1,
+70663,4,3,54656,2,0,1,
+70667,4,2,59153,3,0,1,
+70687,4,5,70671,18,0,1,
+70709,4,2,57901,6,0,1,
+70717,4,2,39997,6,0,1,
+70729,4,22,48128,0,0,1,
+70753,4,5,63030,15,0,1,
+70769,4,3,53835,4,0,1,
+70783,4,3,36793,7,0,1,
+70793,4,3,53597,6,0,1,
+70823,4,5,63787,2,0,1,
+70841,4,3,48633,1,0,1,
+70843,4,2,69291,7,0,1,
+70849,4,17,38090,35,0,1,
+70853,4,2,66950,3,0,1,
+70867,4,3,68822,3,0,1,
+70877,4,2,54683,2,0,1,
+70879,4,3,43553,2,0,1,
+70891,4,3,65467,2,0,1,
+70901,4,2,67460,3,0,1,
+70913,4,3,42051,4,0,1,
+70919,4,7,39710,6,0,1,
+70921,4,13,54135,14,0,1,
+70937,4,3,56041,11,0,1,
+70949,4,2,62905,0,0,1,
+70951,4,6,57780,3,0,1,
+70957,4,2,51988,3,0,1,
+70969,4,11,61783,16,0,1,
+70979,4,2,57757,2,0,1,
+70981,4,6,66178,2,0,1,
+70991,4,7,61011,2,0,1,
+70997,4,2,38359,9,0,1,
+70999,4,11,66744,9,0,1,
+71011,4,15,49875,6,0,1,
+71023,4,6,58735,3,0,1,
+71039,4,11,68825,6,0,1,
+71059,4,7,41189,6,0,1,
+71069,4,2,43626,9,0,1,
+71081,4,3,69416,7,0,1,
+71089,4,11,39634,22,0,1,
+71119,4,3,67357,8,0,1,
+71129,4,3,43019,2,0,1,
+71143,4,6,70219,7,0,1,
+71147,4,2,46222,4,0,1,
+71153,4,3,42472,9,0,1,
+71161,4,11,66960,12,0,1,
+71167,4,3,59112,2,0,1,
+71171,4,2,51451,4,0,1,
+71191,4,3,47696,2,0,1,
+71209,4,7,45847,0,0,1,
+71233,4,11,55561,7,0,1,
+71237,4,2,65919,6,0,1,
+71249,4,3,70494,4,0,1,
+71257,4,5,71246,14,0,1,
+71261,4,3,66274,12,0,1,
+71263,4,5,54562,2,0,1,
+71287,4,3,41172,2,0,1,
+71293,4,5,67279,1,0,1,
+71317,4,2,52171,12,0,1,
+71327,4,5,71323,3,0,1,
+71329,4,7,42666,0,0,1,
+71333,4,2,49522,11,0,1,
+71339,4,2,42483,13,0,1,
+71341,4,6,71337,6,0,1,
+71347,4,2,55724,7,0,1,
+71353,4,5,41313,12,0,1,
+71359,4,6,44808,4,0,1,
+71363,4,2,52079,10,0,1,
+71387,4,2,44921,15,0,1,
+71389,4,11,46466,8,0,1,
+71399,4,11,35931,2,0,1,
+71411,4,2,40070,7,0,1,
+71413,4,2,71406,8,0,1,
+71419,4,2,68999,7,0,1,
+71429,4,2,50209,6,0,1,
+71437,4,2,54737,10,0,1,
+71443,4,11,36676,5,0,1,
+71453,4,2,37951,3,0,1,
+71471,4,7,41094,4,0,1,
+71473,4,5,45163,6,0,1,
+71479,4,6,56282,10,0,1,
+71483,4,2,47456,4,0,1,
+71503,4,3,68586,6,0,1,
+71527,4,3,39248,6,0,1,
+71537,4,3,36582,0,0,1,
+71549,4,2,70584,4,0,1,
+71551,4,6,64114,3,0,1,
+71563,4,2,58689,8,0,1,
+71569,4,19,60317,32,0,1,
+71593,4,5,36565,15,0,1,
+71597,4,2,70889,0,0,1,
+71633,4,3,38013,4,0,1,
+71647,4,3,59824,6,0,1,
+71663,4,5,51461,2,0,1,
+71671,4,15,43839,3,0,1,
+71693,4,2,55090,1,0,1,
+71699,4,2,67291,6,0,1,
+71707,4,2,63239,1,0,1,
+71711,4,17,38247,7,0,1,
+71713,4,5,47165,12,0,1,
+71719,4,3,63829,3,0,1,
+71741,4,2,65142,3,0,1,
+71761,4,44,51693,13,0,1,
+71777,4,3,58795,9,0,1,
+71789,4,2,48870,0,0,1,
+71807,4,5,71795,11,0,1,
+71809,4,7,68346,17,0,1,
+71821,4,2,47183,10,0,1,
+71837,4,2,41955,3,0,1,
+71843,4,2,37674,8,0,1,
+71849,4,3,43545,7,0,1,
+71861,4,7,57037,5,0,1,
+71867,4,2,55662,2,0,1,
+71879,4,11,58652,2,0,1,
+71881,4,7,51859,0,0,1,
+71887,4,3,55991,2,0,1,
+71899,4,2,65761,8,0,1,
+71909,4,2,71061,3,0,1,
+71917,4,2,41181,6,0,1,
+71933,4,2,62443,6,0,1,
+71941,4,2,48283,6,0,1,
+71947,4,2,67395,8,0,1,
+71963,4,2,71956,8,0,1,
+71971,4,2,40745,8,0,1,
+71983,4,3,64115,5,0,1,
+71987,4,2,47287,26,0,1,
+71993,4,3,53608,1,0,1,
+71999,4,7,57398,7,0,1,
+72019,4,2,62742,1,0,1,
+72031,4,3,55350,3,0,1,
+72043,4,5,41388,8,0,1,
+72047,4,5,62811,5,0,1,
+72053,4,2,59135,7,0,1,
+72073,4,5,48859,10,0,1,
+72077,4,2,42757,4,0,1,
+72089,4,3,72077,0,0,1,
+72091,4,2,60530,2,0,1,
+72101,4,2,63163,12,0,1,
+72103,4,6,57940,2,0,1,
+72109,4,2,46459,6,0,1,
+72139,4,2,45029,8,0,1,
+72161,4,6,44064,4,0,1,
+72167,4,5,72163,3,0,1,
+72169,4,7,37026,0,0,1,
+72173,4,2,47862,1,0,1,
+72211,4,2,62661,2,0,1,
+72221,4,2,42079,6,0,1,
+72223,4,3,63494,17,0,1,
+72227,4,2,60882,2,0,1,
+72229,4,2,71628,9,0,1,
+72251,4,7,72242,4,0,1,
+72253,4,2,36427,6,0,1,
+72269,4,3,58151,3,0,1,
+72271,4,3,65518,3,0,1,
+72277,4,5,66880,1,0,1,
+72287,4,5,72283,3,0,1,
+72307,4,3,64560,0,0,1,
+72313,4,5,62407,6,0,1,
+72337,4,7,39917,17,0,1,
+72341,4,2,58293,9,0,1,
+72353,4,3,55199,0,0,1,
+72367,4,3,62623,6,0,1,
+72379,4,2,51422,12,0,1,
+72383,4,5,71622,4,0,1,
+72421,4,6,66249,7,0,1,
+72431,4,13,58708,6,0,1,
+72461,4,2,43369,6,0,1,
+72467,4,2,61622,13,0,1,
+72469,4,6,60664,7,0,1,
+72481,4,11,36542,8,0,1,
+72493,4,2,69682,6,0,1,
+72497,4,5,36734,6,0,1,
+72503,4,5,54638,2,0,1,
+72533,4,2,64635,1,0,1,
+72547,4,2,72540,8,0,1,
+72551,4,13,41107,9,0,1,
+72559,4,3,46343,14,0,1,
+72577,4,5,72566,14,0,1,
+72613,4,2,57646,6,0,1,
+72617,4,3,69042,4,0,1,
+72623,4,5,59960,8,0,1,
+72643,4,2,49227,17,0,1,
+72647,4,5,72643,3,0,1,
+72649,4,7,47012,17,0,1,
+72661,4,11,62100,3,0,1,
+72671,4,7,61218,3,0,1,
+72673,4,5,72662,14,0,1,
+72679,4,6,41235,3,0,1,
+72689,4,3,69268,2,0,1,
+72701,4,2,72694,8,0,1,
+72707,4,2,55870,7,0,1,
+72719,4,11,63204,5,0,1,
+72727,4,7,64380,0,0,1,
+72733,4,2,62105,6,0,1,
+72739,4,2,52065,15,0,1,
+72763,4,2,50862,16,0,1,
+72767,4,5,44380,4,0,1,
+72797,4,2,68786,6,0,1,
+72817,4,5,40745,25,0,1,
+72823,4,5,39509,5,0,1,
+72859,4,2,42403,2,0,1,
+72869,4,2,72862,8,0,1,
+72871,4,6,49897,2,0,1,
+72883,4,3,40725,8,0,1,
+72889,4,7,59320,0,0,1,
+72893,4,2,52422,6,0,1,
+72901,4,2,65487,7,0,1,
+72907,4,2,42627,8,0,1,
+72911,4,11,39056,6,0,1,
+72923,4,2,55043,8,0,1,
+72931,4,10,60579,9,0,1,
+72937,4,5,39982,6,0,1,
+72949,4,2,52415,12,0,1,
+72953,4,3,65046,9,0,1,
+72959,4,17,72933,17,0,1,
+72973,4,2,45763,7,0,1,
+72977,4,3,45322,0,0,1,
+72997,4,2,60557,9,0,1,
+73009,4,7,61290,1,0,1,
+73013,4,2,38041,4,0,1,
+73019,4,2,47919,3,0,1,
+73037,4,2,44880,3,0,1,
+73039,4,3,59389,2,0,1,
+73043,4,2,66445,7,0,1,
+73061,4,2,58871,6,0,1,
+73063,4,3,48207,3,0,1,
+73079,4,13,40351,4,0,1,
+73091,4,2,43963,4,0,1,
+73121,4,3,42292,2,0,1,
+73127,4,5,73123,3,0,1,
+73133,4,2,72158,17,0,1,
+73141,4,7,43993,4,0,1,
+73181,4,2,47002,7,0,1,
+73189,4,2,55841,12,0,1,
+73237,4,6,65241,6,0,1,
+73243,4,3,71712,2,0,1,
+73259,4,2,61316,7,0,1,
+73277,4,3,73273,4,0,1,
+73291,4,3,69472,11,0,1,
+73303,4,5,62926,5,0,1,
+73309,4,2,66589,9,0,1,
+73327,4,3,73323,4,0,1,
+73331,4,2,42910,4,0,1,
+73351,4,3,65865,6,0,1,
+73361,4,11,51499,4,0,1,
+73363,4,5,73359,3,0,1,
+73369,4,11,70828,16,0,1,
+73379,4,2,72262,1,0,1,
+73387,4,2,73380,8,0,1,
+73417,4,10,53155,21,0,1,
+73421,4,2,37199,3,0,1,
+73433,4,3,48227,1,0,1,
+73453,4,2,72911,10,0,1,
+73459,4,2,49334,8,0,1,
+73471,4,3,73467,4,0,1,
+73477,4,6,68628,8,0,1,
+73483,4,2,70827,8,0,1,
+73517,4,2,53158,6,0,1,
+73523,4,2,46328,0,0,1,
+73529,4,3,42582,0,0,1,
+73547,4,2,66601,13,0,1,
+73553,4,3,64744,7,0,1,
+73561,4,13,42718,16,0,1,
+73571,4,2,68944,8,0,1,
+73583,4,5,63211,3,0,1,
+73589,4,2,41254,14,0,1,
+73597,4,2,51616,9,0,1,
+73607,4,5,66527,6,0,1,
+73609,4,19,72074,14,0,1,
+73613,4,2,37537,12,0,1,
+73637,4,2,56357,4,0,1,
+73643,4,2,51879,14,0,1,
+73651,4,2,67415,8,0,1,
+73673,4,3,57691,4,0,1,
+73679,4,14,64280,6,0,1,
+73681,4,14,57935,0,0,1,
+73693,4,2,58210,9,0,1,
+73699,4,2,67161,1,0,1,
+73709,4,2,39653,4,0,1,
+73721,4,6,53276,0,0,1,
+73727,4,5,73715,11,0,1,
+73751,4,13,42278,3,0,1,
+73757,4,2,53235,3,0,1,
+73771,4,2,43300,6,0,1,
+73783,4,3,72176,5,0,1,
+73819,4,3,46285,3,0,1,
+73823,4,5,38688,2,0,1,
+73847,4,5,73843,3,0,1,
+73849,4,7,54332,0,0,1,
+73859,4,2,68126,3,0,1,
+73867,4,2,51175,2,0,1,
+73877,4,2,51052,4,0,1,
+73883,4,2,72698,0,0,1,
+73897,4,5,62054,16,0,1,
+73907,4,2,38461,9,0,1,
+73939,4,2,73468,1,0,1,
+73943,4,5,67134,3,0,1,
+73951,4,3,65283,3,0,1,
+73961,4,3,73949,0,0,1,
+73973,4,2,69985,8,0,1,
+73999,4,6,37849,10,0,1,
+74017,4,7,60515,10,0,1,
+74021,4,2,66942,1,0,1,
+74027,4,2,60175,14,0,1,
+74047,4,3,66570,5,0,1,
+74051,4,6,59760,2,0,1,
+74071,4,14,65525,3,0,1,
+74077,4,5,69539,3,0,1,
+74093,4,2,48470,9,0,1,
+74099,4,2,56842,0,0,1,
+74101,4,2,74094,8,0,1,
+74131,4,2,73228,8,0,1,
+74143,4,5,74139,3,0,1,
+74149,4,2,60624,7,0,1,
+74159,4,13,74147,5,0,1,
+74161,4,7,61232,0,0,1,
+74167,4,5,46898,2,0,1,
+74177,4,3,73054,1,0,1,
+74189,4,2,74182,8,0,1,
+74197,4,5,61162,6,0,1,
+74201,4,6,46682,0,0,1,
+74203,4,2,59268,2,0,1,
+74209,4,19,72874,0,0,1,
+74219,4,2,45079,4,0,1,
+74231,4,11,64699,9,0,1,
+74257,4,5,62236,32,0,1,
+74279,4,7,74270,4,0,1,
+74287,4,3,74283,4,0,1,
+74293,4,5,45178,6,0,1,
+74297,4,3,43437,5,0,1,
+74311,4,12,69621,3,0,1,
+74317,4,2,42707,6,0,1,
+74323,4,5,65969,2,0,1,
+74353,4,5,44387,10,0,1,
+74357,4,2,64986,1,0,1,
+74363,4,2,53504,8,0,1,
+74377,4,5,58041,23,0,1,
+74381,4,2,60053,1,0,1,
+74383,4,5,74367,18,0,1,
+74411,4,2,63354,7,0,1,
+74413,4,5,52255,7,0,1,
+74419,4,2,52003,8,0,1,
+74441,4,3,74429,0,0,1,
+74449,4,13,43654,14,0,1,
+74453,4,2,67106,6,0,1,
+74471,4,11,38724,5,0,1,
+74489,4,3,70962,7,0,1,
+74507,4,2,45482,7,0,1,
+74509,4,2,66467,10,0,1,
+74521,4,13,71684,10,0,1,
+74527,4,3,56896,5,0,1,
+74531,4,2,45219,7,0,1,
+74551,4,11,67291,2,0,1,
+74561,4,3,74549,0,0,1,
+74567,4,5,74563,3,0,1,
+74573,4,2,55217,6,0,1,
+74587,4,2,74114,8,0,1,
+74597,4,2,50072,3,0,1,
+74609,4,3,48007,2,0,1,
+74611,4,2,41939,2,0,1,
+74623,4,3,39560,5,0,1,
+74653,4,2,37632,3,0,1,
+74687,4,5,48383,5,0,1,
+74699,4,2,61778,7,0,1,
+74707,4,2,72057,7,0,1,
+74713,4,10,47033,16,0,1,
+74717,4,2,67732,1,0,1,
+74719,4,7,52460,0,0,1,
+74729,4,3,65169,4,0,1,
+74731,4,2,46647,5,0,1,
+74747,4,2,52370,7,0,1,
+74759,4,11,68112,3,0,1,
+74761,4,19,57690,18,0,1,
+74771,4,2,53812,4,0,1,
+74779,4,2,65169,6,0,1,
+74797,4,5,67484,7,0,1,
+74821,4,6,74817,6,0,1,
+74827,4,3,53210,5,0,1,
+74831,4,7,46151,4,0,1,
+74843,4,2,65225,7,0,1,
+74857,4,5,42453,10,0,1,
+74861,4,2,59239,1,0,1,
+74869,4,2,43349,37,0,1,
+74873,4,3,52027,4,0,1,
+74887,4,3,62207,2,0,1,
+74891,4,2,45677,9,0,1,
+74897,4,3,44783,1,0,1,
+74903,4,5,74899,3,0,1,
+74923,4,5,74919,3,0,1,
+74929,4,17,74910,26,0,1,
+74933,4,2,56989,6,0,1,
+74941,4,6,38035,8,0,1,
+74959,4,3,74955,4,0,1,
+75011,4,6,75001,7,0,1,
+75013,4,2,68366,10,0,1,
+75017,4,3,45462,8,0,1,
+75029,4,2,43015,4,0,1,
+75037,4,2,55138,10,0,1,
+75041,4,3,60728,2,0,1,
+75079,4,3,49811,3,0,1,
+75083,4,2,38728,7,0,1,
+75109,4,2,70881,7,0,1,
+75133,4,2,63032,6,0,1,
+75149,4,2,57023,0,0,1,
+75161,4,3,57173,2,0,1,
+75167,4,5,73433,5,0,1,
+75169,4,7,59133,0,0,1,
+75181,4,2,61827,6,0,1,
+75193,4,7,45746,10,0,1,
+75209,4,3,75197,0,0,1,
+75211,4,2,53922,6,0,1,
+75217,4,5,65957,23,0,1,
+75223,4,3,64366,3,0,1,
+75227,4,2,38702,2,0,1,
+75239,4,13,74289,16,0,1,
+75253,4,2,43719,3,0,1,
+75269,4,2,61218,3,0,1,
+75277,4,2,53931,6,0,1,
+75289,4,13,63503,40,0,1,
+75307,4,3,66690,6,0,1,
+75323,4,2,39729,7,0,1,
+75329,4,3,75317,0,0,1,
+75337,4,5,59122,6,0,1,
+75347,4,2,55916,11,0,1,
+75353,4,3,49497,9,0,1,
+75367,4,3,54296,5,0,1,
+75377,4,3,47702,9,0,1,
+75389,4,2,50980,3,0,1,
+75391,4,3,62947,3,0,1,
+75401,4,3,64247,7,0,1,
+75403,4,3,47857,2,0,1,
+75407,4,5,75403,3,0,1,
+75431,4,19,64329,3,0,1,
+75437,4,2,52905,3,0,1,
+75479,4,19,54717,2,0,1,
+75503,4,5,75499,3,0,1,
+75511,4,3,63924,2,0,1,
+75521,4,3,58652,4,0,1,
+75527,4,5,39797,2,0,1,
+75533,4,2,55610,3,0,1,
+75539,4,2,71048,0,0,1,
+75541,4,2,61862,6,0,1,
+75553,4,5,49539,10,0,1,
+75557,4,2,41269,1,0,1,
+75571,4,2,41127,2,0,1,
+75577,4,17,75551,17,0,1,
+75583,4,5,57532,20,0,1,
+75611,4,2,56351,3,0,1,
+75617,4,3,49824,2,0,1,
+75619,4,2,38524,5,0,1,
+75629,4,2,74529,12,0,1,
+75641,4,3,75252,2,0,1,
+75653,4,2,63291,6,0,1,
+75659,4,2,66607,2,0,1,
+75679,4,6,61237,4,0,1,
+75683,4,2,44590,2,0,1,
+75689,4,3,75677,0,0,1,
+75703,4,5,49498,9,0,1,
+75707,4,2,44851,6,0,1,
+75709,4,2,62812,12,0,1,
+75721,4,11,68593,20,0,1,
+75731,4,2,47760,19,0,1,
+75743,4,5,62967,4,0,1,
+75767,4,5,48472,7,0,1,
+75773,4,2,42560,6,0,1,
+75781,4,6,74581,8,0,1,
+75787,4,5,73821,2,0,1,
+75793,4,10,53297,8,0,1,
+75797,4,2,39226,7,0,1,
+75821,4,2,46250,0,0,1,
+75833,4,3,38658,4,0,1,
+75853,4,5,48073,1,0,1,
+75869,4,2,57594,0,0,1,
+75883,4,2,39825,7,0,1,
+75913,4,5,49747,12,0,1,
+75931,4,3,46134,3,0,1,
+75937,4,10,42999,0,0,1,
+75941,4,2,58727,3,0,1,
+75967,4,3,75963,4,0,1,
+75979,4,2,49107,8,0,1,
+75983,4,5,66619,7,0,1,
+75989,4,2,72681,0,0,1,
+75991,4,11,61459,4,0,1,
+75997,4,2,67184,6,0,1,
+76001,4,3,53826,2,0,1,
+76003,4,5,45793,5,0,1,
+76031,4,7,61858,2,0,1,
+76039,4,12,48240,3,0,1,
+76079,4,11,67672,7,0,1,
+76081,4,7,46107,0,0,1,
+76091,4,2,48161,8,0,1,
+76099,4,7,66436,6,0,1,
+76103,4,5,71301,6,0,1,
+76123,4,3,67204,3,0,1,
+76129,4,17,76086,48,0,1,
+76147,4,2,43774,8,0,1,
+76157,4,2,75162,6,0,1,
+76159,4,3,68242,6,0,1,
+76163,4,2,64513,3,0,1,
+76207,4,3,73692,5,0,1,
+76213,4,5,65965,7,0,1,
+76231,4,6,56446,4,0,1,
+76243,4,3,42989,5,0,1,
+76249,4,7,56790,0,0,1,
+76253,4,2,59618,4,0,1,
+76259,4,2,58288,7,0,1,
+76261,4,2,76254,8,0,1,
+76283,4,2,57665,7,0,1,
+76289,4,3,54581,4,0,1,
+76303,4,3,75307,8,0,1,
+76333,4,5,62666,3,0,1,
+76343,4,5,58212,0,0,1,
+76367,4,5,68296,7,0,1,
+76369,4,11,76355,11,0,1,
+76379,4,2,40673,0,0,1,
+76387,4,3,67788,2,0,1,
+76403,4,2,67684,7,0,1,
+76421,4,3,74011,6,0,1,
+76423,4,5,76407,18,0,1,
+76441,4,11,48662,23,0,1,
+76463,4,5,54082,5,0,1,
+76471,4,6,47297,3,0,1,
+76481,4,3,39574,2,0,1,
+76487,4,5,53589,2,0,1,
+76493,4,2,42860,2,0,1,
+76507,4,2,69273,8,0,1,
+76511,4,7,54082,11,0,1,
+76519,4,3,59686,6,0,1,
+76537,4,5,42941,10,0,1,
+76541,4,2,76534,8,0,1,
+76543,4,3,40615,6,0,1,
+76561,4,17,46886,20,0,1,
+76579,4,14,50427,2,0,1,
+76597,4,7,43441,10,0,1,
+76603,4,2,58855,8,0,1,
+76607,4,5,73867,7,0,1,
+76631,4,7,70497,6,0,1,
+76649,4,6,56278,0,0,1,
+76651,4,3,52165,5,0,1,
+76667,4,2,62005,7,0,1,
+76673,4,3,66368,9,0,1,
+76679,4,7,55592,4,0,1,
+76697,4,3,50870,1,0,1,
+76717,4,2,45082,9,0,1,
+76733,4,2,56050,3,0,1,
+76753,4,5,39385,6,0,1,
+76757,4,2,49527,3,0,1,
+76771,4,2,71492,8,0,1,
+76777,4,5,76766,14,0,1,
+76781,4,2,67454,9,0,1,
+76801,4,17,48804,20,0,1,
+76819,4,7,66753,8,0,1,
+76829,4,2,61574,6,0,1,
+76831,4,29,58581,2,0,1,
+76837,4,5,60173,1,0,1,
+76847,4,5,50138,9,0,1,
+76871,4,7,58549,2,0,1,
+76873,4,10,60065,22,0,1,
+76883,4,2,41684,4,0,1,
+76907,4,2,55765,7,0,1,
+76913,4,3,52470,0,0,1,
+76919,4,13,48489,3,0,1,
+76943,4,10,69382,4,0,1,
+76949,4,2,72266,1,0,1,
+76961,4,3,76949,0,0,1,
+76963,4,3,67494,7,0,1,
+76991,4,13,55398,4,0,1,
+77003,4,2,55719,2,0,1,
+77017,4,7,64348,10,0,1,
+77023,4,3,75692,6,0,1,
+77029,4,2,58146,0,0,1,
+77041,4,7,60137,0,0,1,
+77047,4,3,61257,3,0,1,
+77069,4,2,75574,1,0,1,
+77081,4,3,77069,0,0,1,
+77093,4,2,72956,4,0,1,
+77101,4,7,40000,4,0,1,
+77137,4,13,71265,4,0,1,
+77141,4,3,77137,4,0,1,
+77153,4,3,46439,0,0,1,
+77167,4,21,39536,12,0,1,
+77171,4,2,55211,4,0,1,
+77191,4,6,70075,10,0,1,
+77201,4,3,60243,2,0,1,
+77213,4,2,41850,4,0,1,
+77237,4,2,56993,3,0,1,
+77239,4,3,61017,2,0,1,
+77243,4,2,52825,2,0,1,
+77249,4,3,52093,4,0,1,
+77261,4,2,59385,19,0,1,
+77263,4,5,77251,11,0,1,
+77267,4,2,60416,7,0,1,
+77269,4,2,73786,9,0,1,
+77279,4,11,56247,5,0,1,
+77291,4,2,65473,0,0,1,
+77317,4,2,67074,19,0,1,
+77323,4,2,59021,8,0,1,
+77339,4,2,51352,4,0,1,
+77347,4,3,63248,2,0,1,
+77351,4,14,39544,7,0,1,
+77359,4,3,55517,2,0,1,
+77369,4,3,42002,7,0,1,
+77377,4,5,74267,10,0,1,
+77383,4,3,66656,3,0,1,
+77417,4,3,57001,9,0,1,
+77419,4,2,48070,2,0,1,
+77431,4,3,43837,2,0,1,
+77447,4,5,65461,4,0,1,
+77471,4,7,44438,3,0,1,
+77477,4,2,69614,4,0,1,
+77479,4,6,64095,5,0,1,
+77489,4,3,68695,3,0,1,
+77491,4,3,47151,2,0,1,
+77509,4,2,46053,7,0,1,
+77513,4,3,70285,1,0,1,
+77521,4,7,61075,0,0,1,
+77527,4,5,39718,10,0,1,
+77543,4,5,77539,3,0,1,
+77549,4,2,58006,1,0,1,
+77551,4,6,52072,3,0,1,
+77557,4,5,42053,6,0,1,
+77563,4,2,56342,10,0,1,
+77569,4,13,77530,0,0,1,
+77573,4,2,52860,1,0,1,
+77587,4,2,50630,2,0,1,
+77591,4,13,39037,6,0,1,
+77611,4,2,73968,8,0,1,
+77617,4,10,58808,6,0,1,
+77621,4,2,77614,8,0,1,
+77641,4,13,76166,42,0,1,
+77647,4,3,60310,6,0,1,
+77659,4,2,73063,8,0,1,
+77681,4,3,77669,0,0,1,
+77687,4,5,53507,3,0,1,
+77689,4,14,62425,8,0,1,
+77699,4,2,52513,9,0,1,
+77711,4,14,66066,7,0,1,
+77713,4,7,43614,12,0,1,
+77719,4,6,76382,8,0,1,
+77723,4,2,58596,8,0,1,
+77731,4,2,53946,2,0,1,
+77743,4,3,44481,2,0,1,
+77747,4,2,77740,8,0,1,
+77761,4,11,39193,16,0,1,
+77773,4,2,65208,6,0,1,
+77783,4,5,75933,5,0,1,
+77797,4,5,43634,10,0,1,
+77801,4,7,77783,13,0,1,
+77813,4,2,46881,7,0,1,
+77839,4,3,39991,6,0,1,
+77849,4,3,53594,13,0,1,
+77863,4,5,77859,3,0,1,
+77867,4,2,41264,2,0,1,
+77893,4,2,40695,10,0,1,
+77899,4,14,75848,2,0,1,
+77929,4,14,47811,9,0,1,
+77933,4,2,67619,2,0,1,
+77951,4,11,55967,6,0,1,
+77969,4,3,70513,2,0,1,
+77977,4,5,42830,10,0,1,
+77983,4,3,54514,6,0,1,
+77999,4,11,59423,7,0,1,
+78007,4,3,77217,5,0,1,
+78017,4,3,54087,1,0,1,
+78031,4,7,61180,0,0,1,
+78041,4,3,69721,4,0,1,
+78049,4,7,46692,0,0,1,
+78059,4,2,44202,3,0,1,
+78079,4,12,40845,5,0,1,
+78101,4,2,72401,6,0,1,
+78121,4,11,66847,16,0,1,
+78137,4,3,73578,2,0,1,
+78139,4,3,77255,7,0,1,
+78157,4,6,47619,8,0,1,
+78163,4,3,76509,2,0,1,
+78167,4,5,44736,6,0,1,
+78173,4,2,57237,0,0,1,
+78179,4,2,54881,2,0,1,
+78191,4,11,59080,6,0,1,
+78193,4,5,46298,6,0,1,
+78203,4,2,77518,2,0,1,
+78229,4,2,46801,15,0,1,
+78233,4,3,72963,2,0,1,
+78241,4,19,75215,40,0,1,
+78259,4,2,57170,1,0,1,
+78277,4,6,78267,7,0,1,
+78283,4,3,47118,5,0,1,
+78301,4,6,49151,10,0,1,
+78307,4,2,64618,11,0,1,
+78311,4,14,46637,2,0,1,
+78317,4,2,45633,7,0,1,
+78341,4,2,57293,8,0,1,
+78347,4,2,65609,2,0,1,
+78367,4,5,78355,11,0,1,
+78401,4,13,77775,0,0,1,
+78427,4,3,49267,7,0,1,
+78437,4,2,46740,7,0,1,
+78439,4,6,39762,10,0,1,
+78467,4,2,65667,3,0,1,
+78479,4,7,68429,2,0,1,
+78487,4,3,74525,5,0,1,
+78497,4,3,53802,13,0,1,
+78509,4,3,78505,4,0,1,
+78511,4,3,41910,3,0,1,
+78517,4,2,78510,8,0,1,
+78539,4,2,78532,8,0,1,
+78541,4,2,64106,10,0,1,
+78553,4,5,78542,14,0,1,
+78569,4,3,52115,4,0,1,
+78571,4,2,74274,1,0,1,
+78577,4,5,67410,11,0,1,
+78583,4,3,40331,5,0,1,
+78593,4,3,64531,12,0,1,
+78607,4,3,68027,6,0,1,
+78623,4,5,72708,7,0,1,
+78643,4,11,65412,2,0,1,
+78649,4,11,61309,12,0,1,
+78653,4,3,45000,11,0,1,
+78691,4,7,63442,6,0,1,
+78697,4,5,71814,6,0,1,
+78707,4,2,40959,7,0,1,
+78713,4,3,50674,8,0,1,
+78721,4,7,45214,0,0,1,
+78737,4,3,60761,9,0,1,
+78779,4,2,60950,7,0,1,
+78781,4,10,44740,2,0,1,
+78787,4,2,75674,8,0,1,
+78791,4,11,40272,3,0,1,
+78797,4,2,67871,4,0,1,
+78803,4,2,70667,7,0,1,
+78809,4,3,64605,0,0,1,
+78823,4,3,56477,2,0,1,
+78839,4,13,43368,7,0,1,
+78853,4,5,50889,6,0,1,
+78857,4,3,76077,3,0,1,
+78877,4,2,76365,6,0,1,
+78887,4,5,57880,10,0,1,
+78889,4,11,60182,10,0,1,
+78893,4,2,59423,6,0,1,
+78901,4,10,60797,5,0,1,
+78919,4,3,74576,3,0,1,
+78929,4,3,74478,1,0,1,
+78941,4,2,72076,0,0,1,
+78977,4,3,74142,4,0,1,
+78979,4,3,60274,6,0,1,
+78989,4,2,65252,0,0,1,
+79031,4,7,52820,5,0,1,
+79039,4,6,46887,2,0,1,
+79043,4,2,75219,4,0,1,
+79063,4,5,79059,3,0,1,
+79087,4,3,47249,16,0,1,
+79103,4,5,53185,5,0,1,
+79111,4,6,58142,2,0,1,
+79133,4,2,41941,1,0,1,
+79139,4,2,75121,8,0,1,
+79147,4,2,79140,8,0,1,
+79151,4,13,67901,2,0,1,
+79153,4,10,67468,25,0,1,
+79159,4,3,79155,4,0,1,
+79181,4,2,69094,6,0,1,
+79187,4,5,57992,1,0,1,
+79193,4,3,72932,15,0,1,
+79201,4,13,57322,16,0,1,
+79229,4,2,57924,3,0,1,
+79231,4,3,79227,4,0,1,
+79241,4,3,77951,2,0,1,
+79259,4,2,44765,13,0,1,
+79273,4,5,79262,14,0,1,
+79279,4,3,52356,6,0,1,
+79283,4,2,60361,4,0,1,
+79301,4,2,54740,3,0,1,
+79309,4,2,46121,10,0,1,
+79319,4,7,44979,2,0,1,
+79333,4,5,61604,6,0,1,
+79337,4,3,60327,0,0,1,
+79349,4,2,60161,6,0,1,
+79357,4,7,65224,7,0,1,
+79367,4,5,79355,11,0,1,
+79379,4,2,78891,2,0,1,
+79393,4,5,76492,16,0,1,
+79397,4,2,72098,3,0,1,
+79399,4,3,67608,6,0,1,
+79411,4,2,79404,8,0,1,
+79423,4,3,49546,6,0,1,
+79427,4,2,76844,4,0,1,
+79433,4,3,58499,46,0,1,
+79451,4,6,44750,6,0,1,
+79481,4,6,46790,0,0,1,
+79493,4,5,56334,3,0,1,
+79531,4,2,44457,8,0,1,
+79537,4,7,76539,20,0,1,
+79549,4,2,74949,7,0,1,
+79559,4,7,68022,7,0,1,
+79561,4,7,77151,0,0,1,
+79579,4,10,60920,5,0,1,
+79589,4,2,52849,1,0,1,
+79601,4,3,40116,2,0,1,
+79609,4,14,72499,8,0,1,
+79613,4,2,63052,12,0,1,
+79621,4,2,78990,9,0,1,
+79627,4,3,78996,3,0,1,
+79631,4,13,79619,5,0,1,
+79633,4,13,44968,6,0,1,
+79657,4,5,44055,23,0,1,
+79669,4,10,44344,3,0,1,
+79687,4,3,48111,6,0,1,
+79691,4,10,49652,1,0,1,
+79693,4,5,42715,7,0,1,
+79697,4,3,47978,4,0,1,
+79699,4,2,58007,8,0,1,
+79757,4,2,51791,3,0,1,
+79769,4,3,79757,0,0,1,
+79777,4,5,75249,6,0,1,
+79801,4,23,45329,24,0,1,
+79811,4,2,77043,8,0,1,
+79813,4,2,41146,9,0,1,
+79817,4,3,77684,1,0,1,
+79823,4,5,58590,8,0,1,
+79829,4,2,48036,2,0,1,
+79841,4,3,59475,8,0,1,
+79843,4,2,41769,8,0,1,
+79847,4,5,73592,6,0,1,
+79861,4,2,40440,7,0,1,
+79867,4,2,48936,8,0,1,
+79873,4,7,59499,12,0,1,
+79889,4,3,59347,7,0,1,
+79901,4,2,50778,3,0,1,
+79903,4,3,46371,3,0,1,
+79907,4,2,70669,8,0,1,
+79939,4,3,42155,6,0,1,
+79943,4,5,46832,2,0,1,
+79967,4,5,41208,2,0,1,
+79973,4,2,65729,6,0,1,
+79979,4,2,67881,3,0,1,
+79987,4,2,54593,7,0,1,
+79997,4,2,55896,6,0,1,
+79999,4,3,64502,2,0,1,
+80021,4,2,63575,12,0,1,
+80039,4,11,51580,3,0,1,
+80051,4,2,72344,2,0,1,
+80071,4,3,50443,2,0,1,
+80077,4,2,49161,6,0,1,
+80107,4,2,40428,10,0,1,
+80111,4,11,45203,2,0,1,
+80141,4,2,79392,3,0,1,
+80147,4,2,40809,8,0,1,
+80149,4,6,70486,2,0,1,
+80153,4,3,53569,6,0,1,
+80167,4,3,65523,2,0,1,
+80173,4,6,43355,4,0,1,
+80177,4,3,71491,2,0,1,
+80191,4,11,51587,2,0,1,
+80207,4,5,59881,2,0,1,
+80209,4,14,48958,12,0,1,
+80221,4,2,56865,12,0,1,
+80231,4,7,61268,2,0,1,
+80233,4,7,72373,13,0,1,
+80239,4,3,56406,3,0,1,
+80251,4,2,78779,2,0,1,
+80263,4,3,48238,2,0,1,
+80273,4,3,66155,0,0,1,
+80279,4,11,50740,5,0,1,
+80287,4,3,60988,3,0,1,
+80309,4,2,43863,4,0,1,
+80317,4,2,63865,3,0,1,
+80329,4,11,51392,12,0,1,
+80341,4,2,59368,13,0,1,
+80347,4,2,52202,10,0,1,
+80363,4,2,80356,8,0,1,
+80369,4,3,80357,0,0,1,
+80387,4,2,57221,11,0,1,
+80407,4,3,68664,5,0,1,
+80429,4,2,41322,3,0,1,
+80447,4,5,52770,6,0,1,
+80449,4,7,67212,16,0,1,
+80471,4,17,71746,4,0,1,
+80473,4,5,74835,12,0,1,
+80489,4,3,71800,2,0,1,
+80491,4,2,76331,6,0,1,
+80513,4,3,65304,13,0,1,
+80527,4,3,63782,2,0,1,
+80537,4,3,67798,7,0,1,
+80557,4,2,52088,6,0,1,
+80567,4,5,79065,10,0,1,
+80599,4,3,45384,2,0,1,
+80603,4,2,42304,2,0,1,
+80611,4,2,75776,6,0,1,
+80621,4,2,65341,6,0,1,
+80627,4,2,44131,7,0,1,
+80629,4,2,48667,3,0,1,
+80651,4,2,58369,8,0,1,
+80657,4,3,77638,1,0,1,
+80669,4,2,79013,17,0,1,
+80671,4,3,72929,2,0,1,
+80677,4,2,69647,6,0,1,
+80681,4,3,62240,7,0,1,
+80683,4,3,59236,3,0,1,
+80687,4,5,66673,3,0,1,
+80701,4,2,67080,7,0,1,
+80713,4,5,68049,18,0,1,
+80737,4,7,63594,18,0,1,
+80747,4,2,60140,7,0,1,
+80749,4,2,71585,12,0,1,
+80761,4,11,56384,28,0,1,
+80777,4,3,57078,1,0,1,
+80779,4,2,41715,2,0,1,
+80783,4,5,75803,2,0,1,
+80789,4,2,59014,6,0,1,
+80803,4,2,78391,13,0,1,
+80809,4,19,71007,42,0,1,
+80819,4,2,73319,7,0,1,
+80831,4,7,63312,3,0,1,
+80833,4,5,76540,20,0,1,
+80849,4,3,80837,0,0,1,
+80863,4,3,59199,5,0,1,
+80897,4,3,44553,1,0,1,
+80909,4,2,72495,4,0,1,
+80911,4,3,65970,6,0,1,
+80917,4,6,47894,8,0,1,
+80923,4,2,75107,7,0,1,
+80929,4,19,56800,0,0,1,
+80933,4,2,52283,3,0,1,
+80953,4,7,73436,8,0,1,
+80963,4,5,74575,5,0,1,
+80989,4,2,56470,3,0,1,
+81001,4,11,70314,14,0,1,
+81013,4,6,62924,19,0,1,
+81017,4,3,69703,17,0,1,
+81019,4,2,73095,2,0,1,
+81023,4,5,75713,8,0,1,
+81031,4,6,66505,10,0,1,
+81041,4,6,75738,5,0,1,
+81043,4,5,79030,2,0,1,
+81047,4,5,63890,16,0,1,
+81049,4,7,81030,22,0,1,
+81071,4,7,44123,6,0,1,
+81077,4,2,77672,3,0,1,
+81083,4,2,59721,14,0,1,
+81097,4,5,42547,10,0,1,
+81101,4,2,56209,1,0,1,
+81119,4,11,69730,3,0,1,
+81131,4,2,44016,7,0,1,
+81157,4,6,76125,9,0,1,
+81163,4,2,46963,2,0,1,
+81173,4,2,75089,5,0,1,
+81181,4,6,64088,11,0,1,
+81197,4,2,62182,6,0,1,
+81199,4,6,58312,3,0,1,
+81203,4,2,81196,8,0,1,
+81223,4,5,81211,11,0,1,
+81233,4,3,72077,11,0,1,
+81239,4,7,51287,2,0,1,
+81281,4,3,62754,7,0,1,
+81283,4,2,61273,7,0,1,
+81293,4,2,72331,9,0,1,
+81299,4,2,69876,3,0,1,
+81307,4,2,75198,8,0,1,
+81331,4,12,64308,6,0,1,
+81343,4,6,80036,3,0,1,
+81349,4,2,48042,12,0,1,
+81353,4,3,66025,1,0,1,
+81359,4,11,42040,2,0,1,
+81371,4,2,47683,2,0,1,
+81373,4,2,49604,7,0,1,
+81401,4,3,80763,2,0,1,
+81409,4,7,78971,6,0,1,
+81421,4,11,68224,31,0,1,
+81439,4,3,57820,2,0,1,
+81457,4,5,81446,14,0,1,
+81463,4,5,44020,2,0,1,
+81509,4,2,41409,0,0,1,
+81517,4,2,71606,12,0,1,
+81527,4,5,81523,3,0,1,
+81533,4,3,66135,5,0,1,
+81547,4,3,66662,3,0,1,
+81551,4,7,79472,5,0,1,
+81553,4,5,81542,14,0,1,
+81559,4,6,63371,4,0,1,
+81563,4,2,56504,11,0,1,
+81569,4,3,59997,2,0,1,
+81611,4,2,81604,8,0,1,
+81619,4,3,51777,6,0,1,
+81629,4,2,55990,6,0,1,
+81637,4,2,55131,3,0,1,
+81647,4,5,50077,8,0,1,
+81649,4,11,75177,0,0,1,
+81667,4,3,56420,5,0,1,
+81671,4,7,41578,2,0,1,
+81677,4,3,75110,4,0,1,
+81689,4,3,67242,3,0,1,
+81701,4,2,73754,12,0,1,
+81703,4,3,76131,5,0,1,
+81707,4,2,74069,1,0,1,
+81727,4,3,70729,5,0,1,
+81737,4,3,43365,7,0,1,
+81749,4,2,52507,1,0,1,
+81761,4,12,63911,0,0,1,
+81769,4,11,48137,0,0,1,
+81773,4,2,44810,0,0,1,
+81799,4,3,59239,1,0,1,
+81817,4,5,54243,6,0,1,
+81839,4,7,78131,15,0,1,
+81847,4,3,55689,5,0,1,
+81853,4,11,74376,1,0,1,
+81869,4,2,74007,8,0,1,
+81883,4,3,72549,5,0,1,
+81899,4,2,72373,1,0,1,
+81901,4,2,69257,6,0,1,
+81919,4,3,76496,3,0,1,
+81929,4,3,51057,8,0,1,
+81931,4,3,79907,3,0,1,
+81937,4,5,62686,15,0,1,
+81943,4,5,59549,5,0,1,
+81953,4,3,58809,9,0,1,
+81967,4,5,77324,10,0,1,
+81971,4,2,51046,8,0,1,
+81973,4,2,56121,6,0,1,
+82003,4,2,65809,7,0,1,
+82007,4,5,62385,2,0,1,
+82009,4,13,72624,16,0,1,
+82013,4,11,62069,3,0,1,
+82021,4,22,82009,6,0,1,
+82031,4,11,54552,3,0,1,
+82037,4,2,70086,6,0,1,
+82039,4,15,63270,2,0,1,
+82051,4,2,62947,8,0,1,
+82067,4,2,65454,0,0,1,
+82073,4,3,63700,0,0,1,
+82129,4,13,63046,24,0,1,
+82139,4,6,44113,4,0,1,
+82141,4,6,55716,2,0,1,
+82153,4,5,46076,15,0,1,
+82163,4,2,75805,8,0,1,
+82171,4,2,44300,2,0,1,
+82183,4,21,74480,2,0,1,
+82189,4,10,76121,2,0,1,
+82193,4,5,50705,8,0,1,
+82207,4,3,82203,4,0,1,
+82217,4,3,80903,2,0,1,
+82219,4,2,69126,3,0,1,
+82223,4,5,71062,5,0,1,
+82231,4,7,44407,5,0,1,
+82237,4,5,74473,10,0,1,
+82241,4,3,82229,0,0,1,
+82261,4,6,55032,10,0,1,
+82267,4,2,67823,1,0,1,
+82279,4,6,82275,6,0,1,
+82301,4,2,49980,0,0,1,
+82307,4,2,52422,8,0,1,
+82339,4,2,49544,2,0,1,
+82349,4,3,51170,14,0,1,
+82351,4,3,82347,4,0,1,
+82361,4,3,56310,8,0,1,
+82373,4,2,67086,5,0,1,
+82387,4,2,54542,8,0,1,
+82393,4,5,55968,15,0,1,
+82421,4,2,46757,1,0,1,
+82457,4,3,77652,0,0,1,
+82463,4,5,78808,2,0,1,
+82469,4,2,49032,2,0,1,
+82471,4,3,48843,6,0,1,
+82483,4,2,80432,8,0,1,
+82487,4,5,78103,8,0,1,
+82493,4,2,77844,6,0,1,
+82499,4,6,53676,2,0,1,
+82507,4,2,76333,7,0,1,
+82529,4,3,71002,2,0,1,
+82531,4,3,75326,3,0,1,
+82549,4,2,46110,9,0,1,
+82559,4,7,63452,2,0,1,
+82561,4,7,75309,0,0,1,
+82567,4,3,68679,6,0,1,
+82571,4,6,80871,4,0,1,
+82591,4,6,75332,2,0,1,
+82601,4,3,82589,0,0,1,
+82609,4,11,58894,22,0,1,
+82613,4,2,47546,6,0,1,
+82619,4,2,69694,2,0,1,
+82633,4,5,58355,6,0,1,
+82651,4,2,59623,8,0,1,
+82657,4,10,48337,15,0,1,
+82699,4,3,75912,3,0,1,
+82721,4,6,72837,0,0,1,
+82723,4,2,61102,8,0,1,
+82727,4,5,62324,2,0,1,
+82729,4,7,82710,22,0,1,
+82757,4,2,72493,6,0,1,
+82759,4,3,45072,2,0,1,
+82763,4,2,52949,7,0,1,
+82781,4,2,64996,1,0,1,
+82787,4,2,42141,11,0,1,
+82793,4,3,72993,1,0,1,
+82799,4,13,46750,4,0,1,
+82811,4,2,43150,7,0,1,
+82813,4,2,66458,6,0,1,
+82837,4,2,77577,7,0,1,
+82847,4,5,61464,8,0,1,
+82883,4,2,55847,18,0,1,
+82889,4,3,82877,0,0,1,
+82891,4,2,72806,8,0,1,
+82903,4,3,73894,5,0,1,
+82913,4,3,68256,7,0,1,
+82939,4,2,44621,2,0,1,
+82963,4,3,52130,3,0,1,
+82981,4,2,49573,3,0,1,
+82997,4,2,54972,3,0,1,
+83003,4,2,46629,4,0,1,
+83009,4,3,82997,0,0,1,
+83023,4,3,47178,8,0,1,
+83047,4,3,47635,5,0,1,
+83059,4,2,53800,8,0,1,
+83063,4,5,78249,2,0,1,
+83071,4,14,43185,6,0,1,
+83077,4,14,57821,7,0,1,
+83089,4,7,48300,0,0,1,
+83093,4,2,58833,12,0,1,
+83101,4,2,78175,6,0,1,
+83117,4,2,60873,6,0,1,
+83137,4,5,73266,10,0,1,
+83177,4,3,61245,4,0,1,
+83203,4,2,67888,8,0,1,
+83207,4,5,80501,3,0,1,
+83219,4,2,71402,2,0,1,
+83221,4,7,73515,13,0,1,
+83227,4,5,42363,0,0,1,
+83231,4,7,49723,13,0,1,
+83233,4,7,79225,8,0,1,
+83243,4,2,42837,10,0,1,
+83257,4,5,59600,6,0,1,
+83267,4,2,77915,4,0,1,
+83269,4,2,74469,15,0,1,
+83273,4,3,70147,2,0,1,
+83299,4,2,44145,0,0,1,
+83311,4,12,67642,3,0,1,
+83339,4,2,77318,7,0,1,
+83341,4,10,81383,3,0,1,
+83357,4,2,55141,8,0,1,
+83383,4,3,83375,10,0,1,
+83389,4,2,81043,7,0,1,
+83399,4,7,45528,5,0,1,
+83401,4,7,60294,16,0,1,
+83407,4,5,83403,3,0,1,
+83417,4,3,60180,9,0,1,
+83423,4,5,63381,2,0,1,
+83431,4,12,76750,6,0,1,
+83437,4,2,80169,18,0,1,
+83443,4,2,44134,2,0,1,
+83449,4,13,42049,26,0,1,
+83459,4,2,71233,2,0,1,
+83471,4,11,69008,2,0,1,
+83477,4,2,75305,6,0,1,
+83497,4,10,46830,6,0,1,
+83537,4,3,55121,3,0,1,
+83557,4,2,66055,7,0,1,
+83561,4,3,83549,0,0,1,
+83563,4,2,58344,8,0,1,
+83579,4,2,44355,11,0,1,
+83591,4,7,83582,4,0,1,
+83597,4,2,71004,1,0,1,
+83609,4,3,75159,3,0,1,
+83617,4,5,45680,18,0,1,
+83621,4,2,69792,3,0,1,
+83639,4,19,43072,8,0,1,
+83641,4,7,61860,14,0,1,
+83653,4,5,80330,8,0,1,
+83663,4,5,49846,9,0,1,
+83689,4,13,73739,34,0,1,
+83701,4,6,53413,2,0,1,
+83717,4,2,73333,9,0,1,
+83719,4,6,65689,2,0,1,
+83737,4,5,43562,15,0,1,
+83761,4,11,65650,10,0,1,
+83773,4,5,51690,3,0,1,
+83777,4,3,61569,0,0,1,
+83791,4,3,73069,6,0,1,
+83813,4,2,63896,9,0,1,
+83833,4,5,46024,18,0,1,
+83843,4,2,48028,0,0,1,
+83857,4,5,62309,6,0,1,
+83869,4,6,63809,7,0,1,
+83873,4,3,70093,9,0,1,
+83891,4,2,47157,4,0,1,
+83903,4,5,83899,3,0,1,
+83911,4,3,67617,6,0,1,
+83921,4,3,42888,7,0,1,
+83933,4,2,65209,6,0,1,
+83939,4,2,43773,7,0,1,
+83969,4,3,53813,7,0,1,
+83983,4,5,65906,5,0,1,
+83987,4,2,75739,3,0,1,
+84011,4,6,68532,4,0,1,
+84017,4,3,68671,0,0,1,
+84047,4,5,51858,4,0,1,
+84053,4,2,44102,6,0,1,
+84059,4,2,66685,2,0,1,
+84061,4,7,52237,4,0,1,
+84067,4,2,58797,8,0,1,
+84089,4,3,57127,2,0,1,
+84121,4,13,81912,14,0,1,
+84127,4,3,62032,5,0,1,
+84131,4,2,78301,7,0,1,
+84137,4,3,48372,3,0,1,
+84143,4,5,84139,3,0,1,
+84163,4,2,70983,8,0,1,
+84179,4,2,73594,7,0,1,
+84181,4,2,84174,8,0,1,
+84191,4,7,84182,4,0,1,
+84199,4,11,46401,5,0,1,
+84211,4,3,54952,6,0,1,
+84221,4,2,82432,4,0,1,
+84223,4,6,53831,2,0,1,
+84229,4,2,42439,3,0,1,
+84239,4,11,68558,5,0,1,
+84247,4,5,60526,10,0,1,
+84263,4,5,71886,6,0,1,
+84299,4,2,63350,2,0,1,
+84307,4,3,58693,11,0,1,
+84313,4,5,53362,6,0,1,
+84317,4,2,42483,16,0,1,
+84319,4,6,54492,10,0,1,
+84347,4,2,83844,8,0,1,
+84349,4,2,66228,6,0,1,
+84377,4,3,67026,0,0,1,
+84389,4,2,44813,12,0,1,
+84391,4,3,65740,10,0,1,
+84401,4,3,72744,2,0,1,
+84407,4,5,79795,9,0,1,
+84421,4,2,78870,12,0,1,
+84431,4,7,53302,3,0,1,
+84437,4,2,59837,4,0,1,
+84443,4,2,75808,4,0,1,
+84449,4,3,78305,4,0,1,
+84457,4,5,78551,6,0,1,
+84463,4,5,60009,5,0,1,
+84467,4,2,74475,11,0,1,
+84481,4,7,60446,0,0,1,
+84499,4,2,51269,8,0,1,
+84503,4,15,43248,5,0,1,
+84509,4,2,55675,3,0,1,
+84521,4,3,61147,13,0,1,
+84523,4,2,57944,2,0,1,
+84533,4,2,61937,17,0,1,
+84551,4,19,68949,2,0,1,
+84559,4,3,55918,3,0,1,
+84589,4,2,60868,16,0,1,
+84629,4,2,74132,2,0,1,
+84631,4,6,61193,2,0,1,
+84649,4,13,62937,14,0,1,
+84653,4,2,78406,7,0,1,
+84659,4,2,57484,0,0,1,
+84673,4,10,61794,8,0,1,
+84691,4,2,56204,2,0,1,
+84697,4,11,75971,12,0,1,
+84701,4,2,49463,6,0,1,
+84713,4,3,74698,4,0,1,
+84719,4,13,45992,6,0,1,
+84731,4,2,46079,6,0,1,
+84737,4,3,56766,1,0,1,
+84751,4,6,43010,2,0,1,
+84761,4,7,64891,7,0,1,
+84787,4,2,47901,2,0,1,
+84793,4,5,75166,21,0,1,
+84809,4,3,71505,4,0,1,
+84811,4,3,47337,7,0,1,
+84827,4,2,63494,3,0,1,
+84857,4,3,84033,1,0,1,
+84859,4,2,59239,6,0,1,
+84869,4,3,59778,2,0,1,
+84871,4,3,66439,2,0,1,
+84913,4,5,73940,6,0,1,
+84919,4,3,70169,3,0,1,
+84947,4,2,77330,18,0,1,
+84961,4,11,81274,16,0,1,
+84967,4,3,68727,6,0,1,
+84977,4,3,65886,9,0,1,
+84979,4,2,48347,6,0,1,
+84991,4,3,66190,6,0,1,
+85009,4,13,46408,28,0,1,
+85021,4,7,75704,4,0,1,
+85027,4,2,57937,10,0,1,
+85037,4,2,47435,2,0,1,
+85049,4,3,51697,4,0,1,
+85061,4,2,68635,6,0,1,
+85081,4,7,73852,24,0,1,
+85087,4,3,69501,2,0,1,
+85091,4,6,52263,4,0,1,
+85093,4,2,57947,12,0,1,
+85103,4,5,69098,6,0,1,
+85109,4,2,71033,1,0,1,
+85121,4,6,71135,7,0,1,
+85133,4,2,71810,1,0,1,
+85147,4,2,69923,7,0,1,
+85159,4,3,51289,2,0,1,
+85193,4,3,60997,1,0,1,
+85199,4,7,85190,4,0,1,
+85201,4,22,63597,25,0,1,
+85213,4,6,71391,7,0,1,
+85223,4,5,65949,2,0,1,
+85229,4,3,84816,4,0,1,
+85237,4,2,47471,6,0,1,
+85243,4,3,68405,3,0,1,
+85247,4,5,85243,3,0,1,
+85259,4,2,63812,6,0,1,
+85297,4,15,57173,6,0,1,
+85303,4,5,71357,5,0,1,
+85313,4,3,77832,4,0,1,
+85331,4,2,46636,8,0,1,
+85333,4,5,72738,1,0,1,
+85361,4,3,44557,4,0,1,
+85363,4,3,61217,3,0,1,
+85369,4,17,64954,16,0,1,
+85381,4,6,67497,11,0,1,
+85411,4,2,48210,8,0,1,
+85427,4,2,79618,6,0,1,
+85429,4,6,50139,7,0,1,
+85439,4,7,85430,4,0,1,
+85447,4,3,46532,5,0,1,
+85451,4,2,67788,8,0,1,
+85453,4,2,72121,6,0,1,
+85469,4,3,85465,4,0,1,
+85487,4,5,61207,5,0,1,
+85513,4,5,75894,6,0,1,
+85517,4,2,55533,6,0,1,
+85523,4,2,50514,8,0,1,
+85531,4,14,77821,2,0,1,
+85549,4,2,55721,6,0,1,
+85571,4,2,85564,8,0,1,
+85577,4,3,70921,7,0,1,
+85597,4,2,43941,10,0,1,
+85601,4,3,57286,0,0,1,
+85607,4,5,43057,4,0,1,
+85619,4,6,84127,1,0,1,
+85621,4,10,64858,17,0,1,
+85627,4,2,85620,8,0,1,
+85639,4,3,85635,4,0,1,
+85643,4,2,66957,0,0,1,
+85661,4,2,68797,7,0,1,
+85667,4,5,70694,11,0,1,
+85669,4,2,54576,6,0,1,
+85691,4,2,53620,8,0,1,
+85703,4,5,72072,4,0,1,
+85711,4,6,84740,3,0,1,
+85717,4,2,73875,10,0,1,
+85733,4,2,51237,7,0,1,
+85751,4,14,57604,7,0,1,
+85781,4,2,61366,4,0,1,
+85793,4,3,78800,2,0,1,
+85817,4,3,63942,4,0,1,
+85819,4,2,43548,7,0,1,
+85829,4,2,62106,7,0,1,
+85831,4,3,57416,3,0,1,
+85837,4,2,85830,8,0,1,
+85843,4,3,61435,5,0,1,
+85847,4,5,85843,3,0,1,
+85853,4,2,76113,6,0,1,
+85889,4,3,49293,2,0,1,
+85903,4,3,44603,6,0,1,
+85909,4,2,73309,0,0,1,
+85931,4,2,64320,2,0,1,
+85933,4,5,54460,3,0,1,
+85991,4,11,69614,7,0,1,
+85999,4,3,71115,6,0,1,
+86011,4,7,79304,6,0,1,
+86017,4,5,86006,14,0,1,
+86027,4,2,77272,8,0,1,
+86029,4,2,56318,10,0,1,
+86069,4,2,83006,0,0,1,
+86077,4,5,82618,1,0,1,
+86083,4,2,45544,8,0,1,
+86111,4,11,60598,5,0,1,
+86113,4,5,75500,12,0,1,
+86117,4,2,65408,4,0,1,
+86131,4,2,68761,2,0,1,
+86137,4,5,67832,6,0,1,
+86143,4,3,78747,2,0,1,
+86161,4,14,48931,22,0,1,
+86171,4,7,48630,2,0,1,
+86179,4,2,58736,8,0,1,
+86183,4,5,62841,3,0,1,
+86197,4,2,66956,7,0,1,
+86201,4,3,47936,2,0,1,
+86209,4,11,61514,14,0,1,
+86239,4,3,81264,6,0,1,
+86243,4,2,66854,13,0,1,
+86249,4,3,86237,0,0,1,
+86257,4,5,45060,10,0,1,
+86263,4,3,68526,3,0,1,
+86269,4,6,85210,2,0,1,
+86287,4,11,67760,2,0,1,
+86291,4,2,45154,8,0,1,
+86293,4,2,76062,10,0,1,
+86297,4,3,71712,1,0,1,
+86311,4,3,64381,3,0,1,
+86323,4,2,77742,7,0,1,
+86341,4,2,64182,3,0,1,
+86351,4,13,72249,2,0,1,
+86353,4,10,52875,24,0,1,
+86357,4,2,45402,3,0,1,
+86369,4,3,86357,0,0,1,
+86371,4,3,46150,2,0,1,
+86381,4,3,66569,12,0,1,
+86389,4,2,74249,7,0,1,
+86399,4,11,83534,10,0,1,
+86413,4,2,55786,3,0,1,
+86423,4,5,86006,6,0,1,
+86441,4,3,86429,0,0,1,
+86453,4,2,68996,1,0,1,
+86461,4,2,52347,12,0,1,
+86467,4,2,68868,2,0,1,
+86477,4,2,81636,3,0,1,
+86491,4,2,65433,2,0,1,
+86501,4,2,81054,7,0,1,
+86509,4,6,81483,10,0,1,
+86531,4,2,85699,7,0,1,
+86533,4,2,66465,7,0,1,
+86539,4,3,49584,7,0,1,
+86561,4,3,72627,4,0,1,
+86573,4,2,54557,12,0,1,
+86579,4,2,73124,2,0,1,
+86587,4,3,67004,7,0,1,
+86599,4,3,44640,2,0,1,
+86627,4,2,57171,16,0,1,
+86629,4,2,85044,6,0,1,
+86677,4,2,64843,9,0,1,
+86689,4,13,84972,14,0,1,
+86693,4,2,55253,3,0,1,
+86711,4,7,55000,3,0,1,
+86719,4,6,57420,3,0,1,
+86729,4,3,71675,2,0,1,
+86743,4,3,49384,2,0,1,
+86753,4,3,75157,7,0,1,
+86767,4,3,48986,5,0,1,
+86771,4,6,71195,5,0,1,
+86783,4,5,56575,2,0,1,
+86813,4,2,68698,0,0,1,
+86837,4,2,82049,7,0,1,
+86843,4,2,52412,8,0,1,
+86851,4,2,54827,8,0,1,
+86857,4,10,74284,22,0,1,
+86861,4,2,84997,9,0,1,
+86869,4,2,53726,11,0,1,
+86923,4,2,54590,8,0,1,
+86927,4,5,59244,4,0,1,
+86929,4,14,70834,12,0,1,
+86939,4,2,53450,4,0,1,
+86951,4,7,83694,2,0,1,
+86959,4,3,55630,3,0,1,
+86969,4,3,73143,3,0,1,
+86981,4,2,69207,3,0,1,
+86993,4,3,51121,9,0,1,
+87011,4,2,48638,7,0,1,
+87013,4,5,82915,6,0,1,
+87037,4,2,84714,6,0,1,
+87041,4,3,77323,2,0,1,
+87049,4,19,82393,8,0,1,
+87071,4,17,84135,2,0,1,
+87083,4,2,59950,2,0,1,
+87103,4,3,74077,6,0,1,
+87107,4,2,82394,13,0,1,
+87119,4,7,58638,0,0,1,
+87121,4,7,82060,0,0,1,
+87133,4,6,79783,4,0,1,
+87149,4,2,49705,1,0,1,
+87151,4,3,79521,6,0,1,
+87179,4,2,56367,3,0,1,
+87181,4,2,73538,3,0,1,
+87187,4,3,46572,2,0,1,
+87211,4,13,43996,0,0,1,
+87221,4,10,70413,8,0,1,
+87223,4,3,84598,3,0,1,
+87251,4,2,81055,7,0,1,
+87253,4,2,78421,7,0,1,
+87257,4,3,69139,1,0,1,
+87277,4,5,70778,3,0,1,
+87281,4,3,85436,7,0,1,
+87293,4,2,71729,4,0,1,
+87299,4,2,65226,3,0,1,
+87313,4,5,64889,12,0,1,
+87317,4,2,77751,1,0,1,
+87323,4,2,60246,4,0,1,
+87337,4,5,57913,6,0,1,
+87359,4,19,71352,7,0,1,
+87383,4,5,75760,4,0,1,
+87403,4,2,79194,8,0,1,
+87407,4,5,55107,5,0,1,
+87421,4,6,81011,11,0,1,
+87427,4,2,61148,8,0,1,
+87433,4,5,52544,6,0,1,
+87443,4,2,62593,3,0,1,
+87473,4,5,44636,10,0,1,
+87481,4,29,48219,36,0,1,
+87491,4,2,65234,2,0,1,
+87509,4,2,80161,2,0,1,
+87511,4,3,62448,2,0,1,
+87517,4,2,80313,6,0,1,
+87523,4,2,75300,8,0,1,
+87539,4,2,47703,16,0,1,
+87541,4,18,63377,7,0,1,
+87547,4,2,61089,10,0,1,
+87553,4,5,81453,10,0,1,
+87557,4,3,64239,15,0,1,
+87559,4,3,62832,6,0,1,
+87583,4,3,73976,6,0,1,
+87587,4,2,84795,4,0,1,
+87589,4,2,45093,3,0,1,
+87613,4,2,81843,9,0,1,
+87623,4,5,69085,3,0,1,
+87629,4,2,69345,4,0,1,
+87631,4,6,81868,3,0,1,
+87641,4,3,86979,2,0,1,
+87643,4,3,52502,2,0,1,
+87649,4,17,73497,18,0,1,
+87671,4,11,84308,9,0,1,
+87679,4,3,80235,3,0,1,
+87683,4,2,76787,3,0,1,
+87691,4,7,87178,6,0,1,
+87697,4,17,52724,11,0,1,
+87701,4,2,85003,4,0,1,
+87719,4,7,86693,4,0,1,
+87721,4,11,72924,20,0,1,
+87739,4,7,58923,11,0,1,
+87743,4,5,47423,8,0,1,
+87751,4,3,87747,4,0,1,
+87767,4,5,87763,3,0,1,
+87793,4,5,81599,6,0,1,
+87797,4,2,61351,3,0,1,
+87803,4,5,83146,1,0,1,
+87811,4,2,86300,6,0,1,
+87833,4,3,55388,26,0,1,
+87853,4,2,72141,3,0,1,
+87869,4,2,47212,4,0,1,
+87877,4,2,67457,6,0,1,
+87881,4,3,63538,7,0,1,
+87887,4,5,47133,7,0,1,
+87911,4,29,80044,4,0,1,
+87917,4,2,87254,6,0,1,
+87931,4,10,83876,0,0,1,
+87943,4,3,81473,6,0,1,
+87959,4,7,87950,4,0,1,
+87961,4,14,64659,0,0,1,
+87973,4,2,68687,10,0,1,
+87977,4,3,74554,4,0,1,
+87991,4,6,50810,10,0,1,
+88001,4,6,73068,0,0,1,
+88003,4,2,45385,2,0,1,
+88007,4,5,55334,2,0,1,
+88019,4,2,53516,3,0,1,
+88037,4,2,69629,2,0,1,
+88069,4,2,55880,12,0,1,
+88079,4,31,49692,6,0,1,
+88093,4,2,65214,6,0,1,
+88117,4,5,65820,6,0,1,
+88129,4,11,76899,8,0,1,
+88169,4,3,82590,0,0,1,
+88177,4,5,47824,15,0,1,
+88211,4,2,44598,7,0,1,
+88223,4,5,66757,2,0,1,
+88237,4,2,72822,6,0,1,
+88241,4,3,61281,2,0,1,
+88259,4,2,77291,2,0,1,
+88261,4,2,82703,3,0,1,
+88289,4,3,55821,1,0,1,
+88301,4,2,76602,2,0,1,
+88321,4,34,74290,13,0,1,
+88327,4,5,60040,5,0,1,
+88337,4,3,87076,6,0,1,
+88339,4,3,55904,5,0,1,
+88379,4,2,78778,16,0,1,
+88397,4,2,75084,6,0,1,
+88411,4,2,69314,3,0,1,
+88423,4,6,79157,2,0,1,
+88427,4,2,82450,4,0,1,
+88463,4,5,88459,3,0,1,
+88469,4,2,55759,3,0,1,
+88471,4,11,46755,3,0,1,
+88493,4,2,57070,6,0,1,
+88499,4,2,77171,3,0,1,
+88513,4,10,73337,15,0,1,
+88523,4,2,69774,0,0,1,
+88547,4,2,77053,15,0,1,
+88589,4,2,61714,19,0,1,
+88591,4,15,65659,10,0,1,
+88607,4,5,88595,11,0,1,
+88609,4,17,64549,20,0,1,
+88643,4,2,60879,0,0,1,
+88651,4,3,54690,2,0,1,
+88657,4,5,61668,12,0,1,
+88661,4,2,77749,4,0,1,
+88663,4,3,88655,10,0,1,
+88667,4,2,69703,11,0,1,
+88681,4,7,79580,0,0,1,
+88721,4,3,85597,7,0,1,
+88729,4,17,76589,22,0,1,
+88741,4,2,69371,10,0,1,
+88747,4,7,60687,11,0,1,
+88771,4,11,68103,5,0,1,
+88789,4,2,52808,10,0,1,
+88793,4,3,45894,2,0,1,
+88799,4,7,88790,4,0,1,
+88801,4,7,60014,26,0,1,
+88807,4,5,88803,3,0,1,
+88811,4,2,86213,8,0,1,
+88813,4,5,45904,1,0,1,
+88817,4,3,70968,1,0,1,
+88819,4,2,56474,1,0,1,
+88843,4,2,88836,8,0,1,
+88853,4,2,58554,2,0,1,
+88861,4,2,85821,9,0,1,
+88867,4,2,85769,8,0,1,
+88873,4,15,58644,8,0,1,
+88883,4,2,48911,7,0,1,
+88897,4,11,88877,12,0,1,
+88903,4,3,53184,3,0,1,
+88919,4,23,66274,6,0,1,
+88937,4,3,79818,7,0,1,
+88951,4,3,88947,4,0,1,
+88969,4,7,52073,0,0,1,
+88993,4,5,72906,20,0,1,
+88997,4,2,83220,11,0,1,
+89003,4,2,63678,2,0,1,
+89009,4,3,88587,7,0,1,
+89017,4,5,48720,6,0,1,
+89021,4,2,85906,12,0,1,
+89041,4,29,49844,25,0,1,
+89051,4,2,52231,7,0,1,
+89057,4,3,62232,0,0,1,
+89069,4,2,65186,16,0,1,
+89071,4,6,80263,2,0,1,
+89083,4,2,84206,8,0,1,
+89087,4,5,60314,3,0,1,
+89101,4,2,50989,7,0,1,
+89107,4,2,88590,8,0,1,
+89113,4,7,57056,10,0,1,
+89119,4,6,79322,3,0,1,
+89123,4,5,60119,2,0,1,
+89137,4,5,73978,6,0,1,
+89153,4,3,76538,1,0,1,
+89189,4,2,82558,6,0,1,
+89203,4,2,83761,8,0,1,
+89209,4,22,78469,0,0,1,
+89213,4,2,83322,1,0,1,
+89227,4,3,82947,7,0,1,
+89231,4,14,54243,2,0,1,
+89237,4,2,78562,7,0,1,
+89261,4,2,47531,2,0,1,
+89269,4,2,89262,8,0,1,
+89273,4,3,82440,11,0,1,
+89293,4,5,73019,3,0,1,
+89303,4,5,70612,2,0,1,
+89317,4,2,47251,10,0,1,
+89329,4,13,80083,14,0,1,
+89363,4,5,71387,0,0,1,
+89371,4,2,75314,8,0,1,
+89381,4,2,48063,1,0,1,
+89387,4,2,76759,7,0,1,
+89393,4,3,70160,6,0,1,
+89399,4,7,53441,2,0,1,
+89413,4,2,78153,7,0,1,
+89417,4,3,66268,1,0,1,
+89431,4,11,63805,2,0,1,
+89443,4,2,65879,10,0,1,
+89449,4,11,72948,10,0,1,
+89459,4,2,48498,7,0,1,
+89477,4,2,67764,9,0,1,
+89491,4,2,89484,8,0,1,
+89501,4,2,88832,9,0,1,
+89513,4,3,49461,22,0,1,
+89519,4,11,66672,5,0,1,
+89521,4,14,77349,10,0,1,
+89527,4,3,56588,3,0,1,
+89533,4,2,50430,6,0,1,
+89561,4,3,58735,7,0,1,
+89563,4,2,67302,7,0,1,
+89567,4,5,56806,4,0,1,
+89591,4,13,79892,2,0,1,
+89597,4,2,76712,6,0,1,
+89599,4,3,68467,3,0,1,
+89603,4,2,78467,11,0,1,
+89611,4,2,51932,8,0,1,
+89627,4,2,74306,13,0,1,
+89633,4,3,87516,2,0,1,
+89653,4,17,47869,3,0,1,
+89657,4,3,46656,4,0,1,
+89659,4,10,66021,5,0,1,
+89669,4,2,77196,3,0,1,
+89671,4,6,83849,3,0,1,
+89681,4,3,88834,8,0,1,
+89689,4,7,73283,0,0,1,
+89753,4,3,72351,1,0,1,
+89759,4,13,50779,3,0,1,
+89767,4,3,61326,5,0,1,
+89779,4,2,78492,8,0,1,
+89783,4,5,68963,5,0,1,
+89797,4,5,87272,3,0,1,
+89809,4,7,50080,17,0,1,
+89819,4,2,62438,8,0,1,
+89821,4,2,53125,6,0,1,
+89833,4,5,61199,18,0,1,
+89839,4,7,48463,0,0,1,
+89849,4,3,74019,2,0,1,
+89867,4,2,86502,6,0,1,
+89891,4,7,89882,4,0,1,
+89897,4,3,54108,0,0,1,
+89899,4,2,83993,1,0,1,
+89909,4,2,52838,7,0,1,
+89917,4,2,71569,22,0,1,
+89923,4,3,77197,24,0,1,
+89939,4,2,79281,2,0,1,
+89959,4,3,58162,3,0,1,
+89963,4,2,66614,4,0,1,
+89977,4,5,72067,6,0,1,
+89983,4,3,50744,3,0,1,
+89989,4,2,77048,10,0,1,
+90001,4,13,58023,23,0,1,
+90007,4,6,70111,5,0,1,
+90011,4,2,51361,11,0,1,
+90017,4,3,65711,0,0,1,
+90019,4,14,59043,2,0,1,
+90023,4,5,45731,5,0,1,
+90031,4,3,80184,3,0,1,
+90053,4,2,86329,3,0,1,
+90059,4,2,72422,6,0,1,
+90067,4,2,46751,17,0,1,
+90071,4,7,49992,2,0,1,
+90073,4,10,48964,22,0,1,
+90089,4,3,88445,7,0,1,
+90107,4,2,46823,15,0,1,
+90121,4,23,87998,16,0,1,
+90127,4,3,55920,3,0,1,
+90149,4,2,86484,1,0,1,
+90163,4,2,88312,2,0,1,
+90173,4,2,60563,4,0,1,
+90187,4,2,53565,2,0,1,
+90191,4,17,72994,14,0,1,
+90197,4,2,67144,0,0,1,
+90199,4,3,90195,4,0,1,
+90203,4,2,87602,7,0,1,
+90217,4,22,86753,6,0,1,
+90227,4,2,82857,1,0,1,
+90239,4,7,51383,2,0,1,
+90247,4,5,72406,9,0,1,
+90263,4,5,52953,7,0,1,
+90271,4,3,67902,3,0,1,
+90281,4,3,70020,3,0,1,
+90289,4,23,69885,8,0,1,
+90313,4,5,88188,10,0,1,
+90353,4,3,79362,1,0,1,
+90359,4,11,76295,10,0,1,
+90371,4,2,65545,4,0,1,
+90373,4,5,49256,1,0,1,
+90379,4,2,79573,8,0,1,
+90397,4,2,84894,3,0,1,
+90401,4,6,54060,0,0,1,
+90403,4,3,51970,3,0,1,
+90407,4,5,90395,11,0,1,
+90437,4,2,79758,6,0,1,
+90439,4,13,60092,2,0,1,
+90469,4,2,71719,7,0,1,
+90473,4,3,74211,0,0,1,
+90481,4,14,45930,8,0,1,
+90499,4,2,71957,10,0,1,
+90511,4,3,80865,3,0,1,
+90523,4,2,85970,7,0,1,
+90527,4,5,61759,7,0,1,
+90529,4,7,52506,24,0,1,
+90533,4,2,87647,9,0,1,
+90547,4,2,52710,10,0,1,
+90583,4,5,90579,3,0,1,
+90599,4,11,57709,3,0,1,
+90617,4,3,54153,6,0,1,
+90619,4,3,46200,5,0,1,
+90631,4,3,75393,3,0,1,
+90641,4,3,77187,2,0,1,
+90647,4,5,52402,6,0,1,
+90659,4,2,76125,11,0,1,
+90677,4,2,90670,8,0,1,
+90679,4,3,78993,3,0,1,
+90697,4,5,85335,6,0,1,
+90703,4,3,75915,2,0,1,
+90709,4,6,64890,0,0,1,
+90731,4,2,67657,8,0,1,
+90749,4,2,49247,6,0,1,
+90787,4,3,55921,3,0,1,
+90793,4,5,61253,10,0,1,
+90803,4,2,51188,7,0,1,
+90821,4,3,90817,4,0,1,
+90823,4,6,90149,8,0,1,
+90833,4,3,51966,7,0,1,
+90841,4,17,51367,20,0,1,
+90847,4,5,84626,2,0,1,
+90863,4,5,90859,3,0,1,
+90887,4,5,80344,5,0,1,
+90901,4,2,65844,7,0,1,
+90907,4,5,90903,3,0,1,
+90911,4,7,69833,2,0,1,
+90917,4,2,65494,7,0,1,
+90931,4,11,70813,2,0,1,
+90947,4,2,69616,1,0,1,
+90971,4,2,65157,4,0,1,
+90977,4,3,77733,11,0,1,
+90989,4,2,58819,3,0,1,
+90997,4,5,84198,20,0,1,
+91009,4,11,81745,16,0,1,
+91019,4,2,79315,4,0,1,
+91033,4,5,91022,14,0,1,
+91079,4,7,73240,12,0,1,
+91081,4,17,49467,30,0,1,
+91097,4,3,57390,0,0,1,
+91099,4,2,86394,8,0,1,
+91121,4,6,74214,0,0,1,
+91127,4,5,50315,3,0,1,
+91129,4,7,73326,0,0,1,
+91139,4,2,73038,1,0,1,
+91141,4,6,74979,7,0,1,
+91151,4,7,90724,2,0,1,
+91153,4,7,88955,8,0,1,
+91159,4,6,81521,2,0,1,
+91163,4,2,53788,7,0,1,
+91183,4,3,76981,3,0,1,
+91193,4,3,69107,2,0,1,
+91199,4,11,57553,4,0,1,
+91229,4,2,74540,1,0,1,
+91237,4,6,54395,6,0,1,
+91243,4,5,91235,6,0,1,
+91249,4,17,88547,21,0,1,
+91253,4,2,78562,12,0,1,
+91283,4,2,52796,13,0,1,
+91291,4,2,46882,28,0,1,
+91297,4,5,75899,6,0,1,
+91303,4,3,53758,3,0,1,
+91309,4,10,91297,10,0,1,
+91331,4,2,81982,3,0,1,
+91367,4,11,78831,6,0,1,
+91369,4,7,58816,0,0,1,
+91373,4,3,63406,20,0,1,
+91381,4,17,85807,4,0,1,
+91387,4,2,67182,8,0,1,
+91393,4,23,79072,47,0,1,
+91397,4,2,49266,1,0,1,
+91411,4,2,61380,6,0,1,
+91423,4,3,82479,2,0,1,
+91433,4,3,60385,2,0,1,
+91453,4,6,62412,6,0,1,
+91457,4,3,85056,0,0,1,
+91459,4,2,84182,8,0,1,
+91463,4,5,86817,5,0,1,
+91493,4,2,53089,9,0,1,
+91499,4,2,50634,7,0,1,
+91513,4,10,65693,6,0,1,
+91529,4,3,91517,0,0,1,
+91541,4,2,57756,1,0,1,
+91571,4,2,55807,8,0,1,
+91573,4,5,91145,3,0,1,
+91577,4,3,55670,7,0,1,
+91583,4,5,90626,2,0,1,
+91591,4,3,91587,4,0,1,
+91621,4,2,68885,3,0,1,
+91631,4,7,74108,4,0,1,
+91639,4,3,68529,3,0,1,
+91673,4,3,83024,4,0,1,
+91691,4,2,73690,2,0,1,
+91703,4,5,91699,3,0,1,
+91711,4,11,69581,6,0,1,
+91733,4,2,69673,6,0,1,
+91753,4,10,85710,8,0,1,
+91757,4,2,50197,11,0,1,
+91771,4,2,75038,8,0,1,
+91781,4,2,61413,12,0,1,
+91801,4,13,89177,10,0,1,
+91807,4,3,91803,4,0,1,
+91811,4,2,74995,7,0,1,
+91813,4,2,61823,10,0,1,
+91823,4,5,78435,5,0,1,
+91837,4,2,48907,6,0,1,
+91841,4,3,64452,4,0,1,
+91867,4,2,67015,10,0,1,
+91873,4,5,79986,6,0,1,
+91909,4,2,54536,9,0,1,
+91921,4,13,62926,16,0,1,
+91939,4,2,53264,3,0,1,
+91943,4,5,60751,3,0,1,
+91951,4,3,82295,3,0,1,
+91957,4,7,70115,4,0,1,
+91961,4,15,78886,3,0,1,
+91967,4,5,91963,3,0,1,
+91969,4,13,69462,16,0,1,
+91997,4,2,55417,6,0,1,
+92003,4,2,86036,13,0,1,
+92009,4,3,54896,2,0,1,
+92033,4,3,50748,0,0,1,
+92041,4,7,64681,0,0,1,
+92051,4,6,74667,2,0,1,
+92077,4,2,60404,3,0,1,
+92083,4,2,67601,12,0,1,
+92107,4,2,52323,8,0,1,
+92111,4,13,83816,7,0,1,
+92119,4,3,67374,6,0,1,
+92143,4,5,65197,5,0,1,
+92153,4,3,61292,7,0,1,
+92173,4,2,80029,12,0,1,
+92177,4,6,73491,8,0,1,
+92179,4,3,85229,2,0,1,
+92189,4,2,56701,2,0,1,
+92203,4,2,69284,11,0,1,
+92219,4,2,61932,7,0,1,
+92221,4,6,47606,8,0,1,
+92227,4,3,88520,3,0,1,
+92233,4,5,74044,15,0,1,
+92237,4,2,66244,1,0,1,
+92243,4,2,83218,4,0,1,
+92251,4,2,73491,6,0,1,
+92269,4,10,77657,3,0,1,
+92297,4,3,57158,6,0,1,
+92311,4,7,89997,5,0,1,
+92317,4,6,76088,4,0,1,
+92333,4,2,75472,3,0,1,
+92347,4,5,46963,0,0,1,
+92353,4,5,59252,12,0,1,
+92357,4,3,52873,14,0,1,
+92363,4,2,68580,12,0,1,
+92369,4,3,84567,4,0,1,
+92377,4,7,46885,10,0,1,
+92381,4,2,64984,6,0,1,
+92383,4,3,92379,4,0,1,
+92387,4,2,54274,8,0,1,
+92399,4,13,91487,4,0,1,
+92401,4,34,72727,32,0,1,
+92413,4,2,51430,3,0,1,
+92419,4,2,92412,8,0,1,
+92431,4,6,75729,3,0,1,
+92459,4,2,54438,7,0,1,
+92461,4,2,76655,3,0,1,
+92467,4,2,50389,8,0,1,
+92479,4,6,62711,3,0,1,
+92489,4,3,92477,0,0,1,
+92503,4,5,83399,10,0,1,
+92507,4,2,88006,8,0,1,
+92551,4,7,62292,5,0,1,
+92557,4,2,86841,6,0,1,
+92567,4,5,72826,4,0,1,
+92569,4,31,85427,26,0,1,
+92581,4,6,72794,0,0,1,
+92593,4,5,92582,14,0,1,
+92623,4,11,68484,5,0,1,
+92627,4,2,56687,0,0,1,
+92639,4,7,70281,7,0,1,
+92641,4,11,47585,22,0,1,
+92647,4,3,75648,3,0,1,
+92657,4,3,91796,0,0,1,
+92669,4,2,60388,9,0,1,
+92671,4,3,71451,2,0,1,
+92681,4,3,53959,7,0,1,
+92683,4,3,79305,2,0,1,
+92693,4,2,57116,3,0,1,
+92699,4,2,51708,2,0,1,
+92707,4,2,51068,2,0,1,
+92717,4,2,84707,12,0,1,
+92723,4,2,63648,3,0,1,
+92737,4,5,72599,16,0,1,
+92753,4,3,57683,1,0,1,
+92761,4,26,56897,29,0,1,
+92767,4,3,67277,6,0,1,
+92779,4,2,90004,8,0,1,
+92789,4,2,66713,6,0,1,
+92791,4,6,64287,3,0,1,
+92801,4,3,49917,2,0,1,
+92809,4,14,70472,8,0,1,
+92821,4,6,92813,12,0,1,
+92831,4,7,51923,2,0,1,
+92849,4,3,79914,8,0,1,
+92857,4,5,92846,14,0,1,
+92861,4,2,89454,1,0,1,
+92863,4,6,63894,5,0,1,
+92867,4,2,63074,10,0,1,
+92893,4,5,68537,3,0,1,
+92899,4,7,86070,0,0,1,
+92921,4,3,92909,0,0,1,
+92927,4,5,92915,11,0,1,
+92941,4,2,62327,10,0,1,
+92951,4,11,47140,2,0,1,
+92957,4,2,64421,7,0,1,
+92959,4,6,60236,5,0,1,
+92987,4,2,61611,2,0,1,
+92993,4,3,74567,4,0,1,
+93001,4,14,81131,8,0,1,
+93047,4,5,52220,8,0,1,
+93053,4,2,84425,6,0,1,
+93059,4,2,60438,7,0,1,
+93077,4,2,82908,3,0,1,
+93083,4,2,48340,8,0,1,
+93089,4,3,67299,0,0,1,
+93097,4,10,54524,10,0,1,
+93103,4,5,46816,8,0,1,
+93113,4,3,82056,11,0,1,
+93131,4,6,50691,5,0,1,
+93133,4,6,86194,0,0,1,
+93139,4,2,81769,8,0,1,
+93151,4,3,74064,3,0,1,
+93169,4,11,89770,10,0,1,
+93179,4,2,79311,8,0,1,
+93187,4,3,54248,5,0,1,
+93199,4,7,61765,5,0,1,
+93229,4,6,83093,7,0,1,
+93239,4,11,66356,7,0,1,
+93241,4,13,55403,30,0,1,
+93251,4,2,90259,8,0,1,
+93253,4,2,69769,3,0,1,
+93257,4,3,92449,0,0,1,
+93263,4,5,78965,1,0,1,
+93281,4,3,84093,2,0,1,
+93283,4,2,92225,8,0,1,
+93287,4,5,93283,3,0,1,
+93307,4,2,92778,14,0,1,
+93319,4,3,58537,3,0,1,
+93323,4,2,69739,7,0,1,
+93329,4,3,58619,2,0,1,
+93337,4,5,93326,14,0,1,
+93371,4,2,89104,11,0,1,
+93377,4,3,77700,0,0,1,
+93383,4,5,61397,5,0,1,
+93407,4,5,62820,4,0,1,
+93419,4,2,52904,7,0,1,
+93427,4,2,52093,2,0,1,
+93463,4,3,71770,5,0,1,
+93479,4,7,64398,4,0,1,
+93481,4,35,62766,8,0,1,
+93487,4,6,85764,2,0,1,
+93491,4,2,51730,2,0,1,
+93493,4,2,64208,12,0,1,
+93497,4,3,73856,0,0,1,
+93503,4,5,56264,10,0,1,
+93523,4,2,52065,11,0,1,
+93529,4,11,50187,24,0,1,
+93553,4,5,58144,10,0,1,
+93557,4,2,52052,6,0,1,
+93559,4,3,87503,3,0,1,
+93563,4,5,49564,0,0,1,
+93581,4,3,87932,12,0,1,
+93601,4,22,81215,12,0,1,
+93607,4,3,55991,5,0,1,
+93629,4,2,66153,8,0,1,
+93637,4,5,85296,7,0,1,
+93683,4,2,60736,18,0,1,
+93701,4,2,65243,4,0,1,
+93703,4,5,48177,2,0,1,
+93719,4,13,67929,8,0,1,
+93739,4,3,60347,0,0,1,
+93761,4,6,56073,0,0,1,
+93763,4,2,51543,2,0,1,
+93787,4,7,58891,19,0,1,
+93809,4,3,93797,0,0,1,
+93811,4,2,61705,8,0,1,
+93827,4,2,53937,2,0,1,
+93851,4,2,53104,8,0,1,
+93871,4,3,59140,2,0,1,
+93887,4,5,73264,2,0,1,
+93889,4,14,69762,10,0,1,
+93893,4,2,75439,2,0,1,
+93901,4,2,88746,7,0,1,
+93911,4,11,87317,2,0,1,
+93913,4,5,68389,6,0,1,
+93923,4,2,88020,7,0,1,
+93937,4,15,48278,14,0,1,
+93941,4,2,88961,7,0,1,
+93949,4,2,60276,0,0,1,
+93967,4,11,85776,2,0,1,
+93971,4,2,62226,4,0,1,
+93979,4,3,54012,3,0,1,
+93983,4,5,92921,5,0,1,
+93997,4,11,68986,3,0,1,
+94007,4,5,49707,11,0,1,
+94009,4,13,93970,0,0,1,
+94033,4,15,75335,13,0,1,
+94049,4,3,58138,4,0,1,
+94057,4,7,80469,14,0,1,
+94063,4,3,61800,2,0,1,
+94079,4,13,57861,6,0,1,
+94099,4,2,52964,2,0,1,
+94109,4,2,81390,17,0,1,
+94111,4,3,90076,3,0,1,
+94117,4,2,86182,10,0,1,
+94121,4,3,94109,0,0,1,
+94151,4,7,69112,5,0,1,
+94153,4,5,66094,6,0,1,
+94169,4,3,94157,0,0,1,
+94201,4,11,53642,27,0,1,
+94207,4,6,92735,2,0,1,
+94219,4,3,56115,3,0,1,
+94229,4,2,53294,9,0,1,
+94253,4,2,70338,4,0,1,
+94261,4,6,66238,7,0,1,
+94273,4,5,91249,6,0,1,
+94291,4,2,51158,8,0,1,
+94307,4,2,51537,4,0,1,
+94309,4,6,60382,2,0,1,
+94321,4,7,64258,0,0,1,
+94327,4,3,92510,5,0,1,
+94331,4,2,57050,2,0,1,
+94343,4,5,90761,5,0,1,
+94349,4,2,70590,3,0,1,
+94351,4,3,70560,6,0,1,
+94379,4,2,62113,2,0,1,
+94397,4,2,75264,4,0,1,
+94399,4,3,76959,3,0,1,
+94421,4,2,67118,3,0,1,
+94427,4,2,47481,2,0,1,
+94433,4,5,57405,4,0,1,
+94439,4,7,74611,2,0,1,
+94441,4,11,61560,20,0,1,
+94447,4,5,94435,11,0,1,
+94463,4,5,73343,7,0,1,
+94477,4,2,92533,9,0,1,
+94483,4,2,48946,8,0,1,
+94513,4,5,74549,10,0,1,
+94529,4,3,70277,7,0,1,
+94531,4,10,73810,2,0,1,
+94541,4,2,86720,3,0,1,
+94543,4,3,54415,3,0,1,
+94547,4,2,75384,4,0,1,
+94559,4,11,66411,2,0,1,
+94561,4,14,57069,20,0,1,
+94573,4,2,83257,3,0,1,
+94583,4,5,94579,3,0,1,
+94597,4,5,67430,6,0,1,
+94603,4,5,89653,18,0,1,
+94613,4,3,81968,6,0,1,
+94621,4,2,47865,10,0,1,
+94649,4,3,79805,10,0,1,
+94651,4,2,54714,8,0,1,
+94687,4,5,77788,12,0,1,
+94693,4,5,54942,23,0,1,
+94709,4,2,82155,7,0,1,
+94723,4,2,94716,8,0,1,
+94727,4,5,61647,8,0,1,
+94747,4,2,80561,8,0,1,
+94771,4,10,68212,0,0,1,
+94777,4,10,61064,16,0,1,
+94781,4,2,86227,6,0,1,
+94789,4,2,76763,6,0,1,
+94793,4,3,61930,1,0,1,
+94811,4,2,65216,2,0,1,
+94819,4,2,71968,8,0,1,
+94823,4,5,94819,3,0,1,
+94837,4,2,55689,6,0,1,
+94841,4,3,79982,4,0,1,
+94847,4,5,79653,3,0,1,
+94849,4,7,64470,6,0,1,
+94873,4,5,63762,10,0,1,
+94889,4,3,63113,8,0,1,
+94903,4,3,72731,5,0,1,
+94907,4,2,83172,0,0,1,
+94933,4,2,94926,8,0,1,
+94949,4,2,93796,4,0,1,
+94951,4,6,93929,2,0,1,
+94961,4,3,73412,4,0,1,
+94993,4,10,72892,6,0,1,
+94999,4,3,67981,3,0,1,
+95003,4,2,88963,0,0,1,
+95009,4,3,94997,0,0,1,
+95021,4,2,93750,3,0,1,
+95027,4,2,69054,4,0,1,
+95063,4,5,86191,3,0,1,
+95071,4,3,85185,3,0,1,
+95083,4,2,65786,8,0,1,
+95087,4,5,67780,6,0,1,
+95089,4,13,62743,28,0,1,
+95093,4,2,79129,9,0,1,
+95101,4,2,65026,3,0,1,
+95107,4,5,59108,2,0,1,
+95111,4,11,57452,6,0,1,
+95131,4,7,71012,6,0,1,
+95143,4,3,95139,4,0,1,
+95153,4,3,74243,0,0,1,
+95177,4,3,60159,12,0,1,
+95189,4,2,83204,1,0,1,
+95191,4,13,93882,4,0,1,
+95203,4,2,48274,7,0,1,
+95213,4,3,87737,6,0,1,
+95219,4,2,49786,2,0,1,
+95231,4,11,61498,5,0,1,
+95233,4,5,68408,10,0,1,
+95239,4,7,49752,11,0,1,
+95257,4,5,75830,6,0,1,
+95261,4,2,62802,4,0,1,
+95267,4,2,48970,7,0,1,
+95273,4,3,83479,12,0,1,
+95279,4,7,80857,2,0,1,
+95287,4,3,85970,6,0,1,
+95311,4,3,69780,6,0,1,
+95317,4,5,48647,8,0,1,
+95327,4,5,81502,7,0,1,
+95339,4,2,79802,4,0,1,
+95369,4,3,76681,7,0,1,
+95383,4,3,73155,5,0,1,
+95393,4,3,74291,11,0,1,
+95401,4,7,48825,26,0,1,
+95413,4,2,68600,3,0,1,
+95419,4,3,93540,7,0,1,
+95429,4,2,75302,1,0,1,
+95441,4,3,91825,2,0,1,
+95443,4,3,64280,5,0,1,
+95461,4,2,84420,6,0,1,
+95467,4,5,89914,0,0,1,
+95471,4,43,78567,4,0,1,
+95479,4,17,72918,9,0,1,
+95483,4,2,86754,2,0,1,
+95507,4,2,93236,10,0,1,
+95527,4,3,82183,3,0,1,
+95531,4,2,76672,8,0,1,
+95539,4,3,67779,3,0,1,
+95549,4,2,95542,8,0,1,
+95561,4,3,78911,2,0,1,
+95569,4,14,92540,12,0,1,
+95581,4,2,69439,3,0,1,
+95597,4,2,77240,1,0,1,
+95603,4,5,53811,4,0,1,
+95617,4,5,74245,10,0,1,
+95621,4,3,89689,14,0,1,
+95629,4,2,51163,10,0,1,
+95633,4,3,75190,2,0,1,
+95651,4,2,81910,2,0,1,
+95701,4,2,78245,10,0,1,
+95707,4,2,64406,7,0,1,
+95713,4,5,79947,6,0,1,
+95717,4,2,81045,2,0,1,
+95723,4,2,66923,2,0,1,
+95731,4,2,69479,6,0,1,
+95737,4,5,79467,6,0,1,
+95747,4,5,74356,0,0,1,
+95773,4,7,89150,8,0,1,
+95783,4,5,95779,3,0,1,
+95789,4,2,74195,6,0,1,
+95791,4,3,84161,3,0,1,
+95801,4,3,59716,4,0,1,
+95803,4,3,55773,11,0,1,
+95813,4,2,58590,12,0,1,
+95819,4,2,52328,4,0,1,
+95857,4,10,66217,6,0,1,
+95869,4,6,70183,7,0,1,
+95873,4,3,61085,0,0,1,
+95881,4,13,80960,16,0,1,
+95891,4,2,80263,2,0,1,
+95911,4,3,77739,2,0,1,
+95917,4,2,75116,3,0,1,
+95923,4,3,52044,2,0,1,
+95929,4,26,48312,0,0,1,
+95947,4,2,93508,2,0,1,
+95957,4,2,84588,5,0,1,
+95959,4,3,55515,3,0,1,
+95971,4,3,53167,6,0,1,
+95987,4,2,85476,13,0,1,
+95989,4,6,68967,8,0,1,
+96001,4,7,75790,17,0,1,
+96013,4,2,93294,9,0,1,
+96017,4,3,67724,1,0,1,
+96043,4,2,74901,7,0,1,
+96053,4,2,93405,6,0,1,
+96059,4,2,77432,4,0,1,
+96079,4,3,81412,3,0,1,
+96097,4,5,81898,6,0,1,
+96137,4,3,78031,7,0,1,
+96149,4,2,68855,6,0,1,
+96157,4,5,85623,1,0,1,
+96167,4,5,87206,5,0,1,
+96179,4,2,79292,3,0,1,
+96181,4,6,96177,6,0,1,
+96199,4,3,62765,7,0,1,
+96211,4,2,59834,6,0,1,
+96221,4,2,75652,1,0,1,
+96223,4,5,96219,3,0,1,
+96233,4,3,94954,11,0,1,
+96259,4,2,94201,8,0,1,
+96263,4,5,71103,9,0,1,
+96269,4,2,55930,3,0,1,
+96281,4,3,96269,0,0,1,
+96289,4,11,55587,14,0,1,
+96293,4,2,71802,6,0,1,
+96323,4,2,58808,20,0,1,
+96329,4,3,51241,4,0,1,
+96331,4,10,67123,0,0,1,
+96337,4,5,74628,10,0,1,
+96353,4,3,71768,12,0,1,
+96377,4,3,93121,7,0,1,
+96401,4,3,67648,4,0,1,
+96419,4,6,51814,0,0,1,
+96431,4,11,68311,7,0,1,
+96443,4,2,94119,0,0,1,
+96451,4,2,75576,2,0,1,
+96457,4,5,84928,6,0,1,
+96461,4,2,60988,6,0,1,
+96469,4,10,90351,2,0,1,
+96479,4,11,56985,2,0,1,
+96487,4,3,96483,4,0,1,
+96493,4,5,62411,7,0,1,
+96497,4,3,62856,0,0,1,
+96517,4,2,88676,10,0,1,
+96527,4,5,67420,11,0,1,
+96553,4,5,80776,6,0,1,
+96557,4,2,67702,3,0,1,
+96581,4,2,59621,12,0,1,
+96587,4,2,76978,3,0,1,
+96589,4,6,67855,2,0,1,
+96601,4,11,63429,20,0,1,
+96643,4,2,79925,8,0,1,
+96661,4,7,59902,1,0,1,
+96667,4,2,54005,8,0,1,
+96671,4,7,92488,5,0,1,
+96697,4,7,48909,12,0,1,
+96703,4,3,49867,5,0,1,
+96731,4,2,61297,7,0,1,
+96737,4,3,52379,0,0,1,
+96739,4,2,75132,6,0,1,
+96749,4,2,49212,7,0,1,
+96757,4,5,79768,7,0,1,
+96763,4,5,65086,2,0,1,
+96769,4,22,78211,26,0,1,
+96779,4,2,92856,3,0,1,
+96787,4,2,86895,2,0,1,
+96797,4,2,92267,12,0,1,
+96799,4,6,67656,2,0,1,
+96821,4,2,53675,8,0,1,
+96823,4,5,68098,2,0,1,
+96827,4,2,87707,2,0,1,
+96847,4,3,83225,6,0,1,
+96851,4,2,62054,2,0,1,
+96857,4,3,73630,2,0,1,
+96893,4,2,94442,6,0,1,
+96907,4,2,65057,1,0,1,
+96911,4,11,52910,2,0,1,
+96931,4,2,60283,8,0,1,
+96953,4,3,94602,0,0,1,
+96959,4,7,81272,2,0,1,
+96973,4,2,49922,6,0,1,
+96979,4,3,77350,5,0,1,
+96989,4,2,71391,14,0,1,
+96997,4,2,50855,3,0,1,
+97001,4,3,75690,2,0,1,
+97003,4,7,56471,11,0,1,
+97007,4,5,73660,5,0,1,
+97021,4,2,58337,10,0,1,
+97039,4,3,89245,3,0,1,
+97073,4,3,64947,13,0,1,
+97081,4,7,90865,25,0,1,
+97103,4,5,68961,8,0,1,
+97117,4,2,59869,7,0,1,
+97127,4,5,97123,3,0,1,
+97151,4,13,89716,7,0,1,
+97157,4,2,86477,5,0,1,
+97159,4,3,59421,3,0,1,
+97169,4,3,97157,0,0,1,
+97171,4,10,65438,8,0,1,
+97177,4,5,65272,15,0,1,
+97187,4,2,87090,1,0,1,
+97213,4,5,91750,1,0,1,
+97231,4,6,56787,2,0,1,
+97241,4,3,97229,0,0,1,
+97259,4,6,83125,1,0,1,
+97283,4,2,56145,7,0,1,
+97301,4,2,56394,2,0,1,
+97303,4,3,70350,2,0,1,
+97327,4,5,82939,2,0,1,
+97367,4,5,81613,6,0,1,
+97369,4,7,87306,14,0,1,
+97373,4,2,86367,1,0,1,
+97379,4,2,66311,7,0,1,
+97381,4,2,73755,6,0,1,
+97387,4,2,65200,10,0,1,
+97397,4,2,74074,3,0,1,
+97423,4,3,57360,5,0,1,
+97429,4,6,97425,6,0,1,
+97441,4,37,66484,29,0,1,
+97453,4,2,68677,6,0,1,
+97459,4,2,89451,7,0,1,
+97463,4,5,63961,8,0,1,
+97499,4,2,61863,4,0,1,
+97501,4,7,80183,4,0,1,
+97511,4,7,90201,10,0,1,
+97523,4,2,97516,8,0,1,
+97547,4,2,79551,7,0,1,
+97549,4,2,93801,0,0,1,
+97553,4,3,54418,12,0,1,
+97561,4,11,81708,12,0,1,
+97571,4,2,54336,2,0,1,
+97577,4,3,89843,6,0,1,
+97579,4,2,63825,6,0,1,
+97583,4,5,53026,7,0,1,
+97607,4,5,97603,3,0,1,
+97609,4,17,53535,16,0,1,
+97613,4,2,96625,3,0,1,
+97649,4,3,97207,7,0,1,
+97651,4,2,84145,8,0,1,
+97673,4,3,73017,0,0,1,
+97687,4,5,62987,3,0,1,
+97711,4,11,88700,9,0,1,
+97729,4,13,51717,22,0,1,
+97771,4,3,90080,3,0,1,
+97777,4,17,92452,8,0,1,
+97787,4,2,65537,8,0,1,
+97789,4,2,88523,3,0,1,
+97813,4,2,63890,6,0,1,
+97829,4,2,90608,6,0,1,
+97841,4,6,52449,6,0,1,
+97843,4,2,54813,8,0,1,
+97847,4,5,85087,14,0,1,
+97849,4,13,64418,4,0,1,
+97859,4,2,69466,2,0,1,
+97861,4,2,92362,10,0,1,
+97871,4,7,52802,2,0,1,
+97879,4,6,81139,2,0,1,
+97883,4,2,71286,8,0,1,
+97919,4,23,83099,4,0,1,
+97927,4,3,69330,6,0,1,
+97931,4,2,91641,7,0,1,
+97943,4,5,72877,4,0,1,
+97961,4,3,51177,4,0,1,
+97967,4,5,71612,6,0,1,
+97973,4,2,89220,4,0,1,
+97987,4,2,65742,8,0,1,
+98009,4,3,80745,8,0,1,
+98011,4,10,52900,0,0,1,
+98017,4,7,66882,8,0,1,
+98041,4,13,86782,33,0,1,
+98047,4,5,98043,3,0,1,
+98057,4,3,66944,0,0,1,
+98081,4,6,65154,0,0,1,
+98101,4,2,73751,9,0,1,
+98123,4,2,75528,4,0,1,
+98129,4,3,90198,3,0,1,
+98143,4,5,79362,2,0,1,
+98179,4,2,69135,8,0,1,
+98207,4,5,75019,2,0,1,
+98213,4,2,68474,9,0,1,
+98221,4,2,64436,6,0,1,
+98227,4,3,60233,5,0,1,
+98251,4,2,58585,7,0,1,
+98257,4,10,94292,12,0,1,
+98269,4,2,49485,3,0,1,
+98297,4,3,60788,1,0,1,
+98299,4,2,57555,1,0,1,
+98317,4,6,49805,6,0,1,
+98321,4,3,98309,0,0,1,
+98323,4,3,97436,2,0,1,
+98327,4,5,64582,3,0,1,
+98347,4,2,49445,10,0,1,
+98369,4,3,55675,7,0,1,
+98377,4,5,81792,8,0,1,
+98387,4,2,94623,8,0,1,
+98389,4,2,59966,6,0,1,
+98407,4,6,85397,7,0,1,
+98411,4,2,52914,6,0,1,
+98419,4,2,88714,7,0,1,
+98429,4,2,56713,12,0,1,
+98443,4,2,85043,8,0,1,
+98453,4,2,75524,4,0,1,
+98459,4,2,88983,8,0,1,
+98467,4,3,60098,5,0,1,
+98473,4,10,50191,6,0,1,
+98479,4,3,96260,2,0,1,
+98491,4,7,66517,6,0,1,
+98507,4,2,87406,11,0,1,
+98519,4,7,54357,7,0,1,
+98533,4,2,87373,18,0,1,
+98543,4,5,84185,15,0,1,
+98561,4,3,82017,2,0,1,
+98563,4,2,88061,2,0,1,
+98573,4,2,97685,9,0,1,
+98597,4,2,97828,18,0,1,
+98621,4,7,98612,4,0,1,
+98627,4,2,51821,0,0,1,
+98639,4,7,88232,2,0,1,
+98641,4,17,78207,20,0,1,
+98663,4,5,77646,3,0,1,
+98669,4,2,59692,12,0,1,
+98689,4,7,91235,14,0,1,
+98711,4,13,83300,6,0,1,
+98713,4,5,88728,6,0,1,
+98717,4,2,64223,6,0,1,
+98729,4,3,85831,2,0,1,
+98731,4,2,96422,2,0,1,
+98737,4,5,59469,6,0,1,
+98773,4,2,77188,6,0,1,
+98779,4,2,59519,3,0,1,
+98801,4,3,77245,4,0,1,
+98807,4,5,96652,8,0,1,
+98809,4,17,64705,32,0,1,
+98837,4,2,64513,12,0,1,
+98849,4,3,98837,0,0,1,
+98867,4,2,89513,4,0,1,
+98869,4,2,92236,6,0,1,
+98873,4,3,86974,0,0,1,
+98887,4,3,98876,12,0,1,
+98893,4,2,91158,9,0,1,
+98897,4,3,84197,6,0,1,
+98899,4,2,78657,2,0,1,
+98909,4,2,88337,3,0,1,
+98911,4,12,57552,2,0,1,
+98927,4,5,98923,3,0,1,
+98929,4,11,95329,8,0,1,
+98939,4,2,89466,4,0,1,
+98947,4,3,57547,7,0,1,
+98953,4,10,82272,0,0,1,
+98963,4,2,54403,8,0,1,
+98981,4,3,98977,4,0,1,
+98993,4,3,83315,0,0,1,
+98999,4,19,66741,2,0,1,
+99013,4,6,53070,6,0,1,
+99017,4,3,86521,6,0,1,
+99023,4,5,83330,5,0,1,
+99041,4,6,95398,0,0,1,
+99053,4,2,69467,6,0,1,
+99079,4,3,63619,2,0,1,
+99083,4,2,89229,7,0,1,
+99089,4,3,69977,8,0,1,
+99103,4,3,99099,4,0,1,
+99109,4,6,99105,6,0,1,
+99119,4,11,55145,6,0,1,
+99131,4,6,78401,4,0,1,
+99133,4,2,94358,6,0,1,
+99137,4,3,83228,26,0,1,
+99139,4,2,51038,6,0,1,
+99149,4,2,90254,4,0,1,
+99173,4,2,62125,6,0,1,
+99181,4,7,83135,12,0,1,
+99191,4,11,65978,7,0,1,
+99223,4,3,99219,4,0,1,
+99233,4,3,94614,7,0,1,
+99241,4,11,58571,22,0,1,
+99251,4,10,60280,2,0,1,
+99257,4,3,87776,0,0,1,
+99259,4,2,99252,8,0,1,
+99277,4,2,75149,9,0,1,
+99289,4,26,50603,22,0,1,
+99317,4,2,71690,6,0,1,
+99347,4,2,66879,2,0,1,
+99349,4,11,56004,3,0,1,
+99367,4,3,87376,6,0,1,
+99371,4,2,90073,3,0,1,
+99377,4,3,59447,2,0,1,
+99391,4,6,95466,3,0,1,
+99397,4,2,60075,10,0,1,
+99401,4,3,99389,0,0,1,
+99409,4,11,55067,2,0,1,
+99431,4,13,96774,3,0,1,
+99439,4,3,91222,3,0,1,
+99469,4,2,56284,8,0,1,
+99487,4,3,81536,3,0,1,
+99497,4,3,60273,0,0,1,
+99523,4,5,59386,0,0,1,
+99527,4,5,50890,6,0,1,
+99529,4,7,72102,0,0,1,
+99551,4,7,92660,3,0,1,
+99559,4,3,97156,6,0,1,
+99563,4,2,54616,7,0,1,
+99571,4,2,87056,7,0,1,
+99577,4,5,63318,15,0,1,
+99581,4,2,76108,4,0,1,
+99607,4,3,52843,2,0,1,
+99611,4,2,66058,0,0,1,
+99623,4,5,88069,8,0,1,
+99643,4,3,72041,3,0,1,
+99661,4,2,68473,6,0,1,
+99667,4,2,50357,8,0,1,
+99679,4,6,58807,2,0,1,
+99689,4,3,99678,12,0,1,
+99707,4,2,81678,4,0,1,
+99709,4,10,59397,5,0,1,
+99713,4,3,82670,11,0,1,
+99719,4,7,52361,6,0,1,
+99721,4,11,67218,24,0,1,
+99733,4,2,94954,6,0,1,
+99761,4,3,75746,1,0,1,
+99767,4,5,76539,5,0,1,
+99787,4,2,55326,2,0,1,
+99793,4,5,86930,10,0,1,
+99809,4,3,74403,4,0,1,
+99817,4,5,91887,11,0,1,
+99823,4,21,63356,2,0,1,
+99829,4,2,58958,6,0,1,
+99833,4,3,76290,4,0,1,
+99839,4,11,83927,3,0,1,
+99859,4,2,57571,7,0,1,
+99871,4,3,69176,2,0,1,
+99877,4,2,80944,12,0,1,
+99881,4,6,94555,0,0,1,
+99901,4,2,76750,12,0,1,
+99907,4,2,81363,7,0,1,
+99923,4,2,88689,2,0,1,
+99929,4,3,68784,1,0,1,
+99961,4,31,95999,30,0,1,
+99971,4,2,80658,0,0,1,
+99989,4,2,65733,0,0,1,
+99991,4,6,63566,3,0,1,
+100003,4,2,98003,19,0,1,
+100019,4,2,94727,11,0,1,
+100043,4,2,80144,2,0,1,
+100049,4,6,60696,7,0,1,
+100057,4,10,50599,24,0,1,
+100069,4,10,65117,2,0,1,
+100103,4,5,84148,8,0,1,
+100109,4,2,87453,12,0,1,
+100129,4,11,85213,27,0,1,
+100151,4,7,100142,4,0,1,
+100153,4,5,85065,10,0,1,
+100169,4,3,100157,0,0,1,
+100183,4,3,61963,8,0,1,
+100189,4,2,100182,8,0,1,
+100193,4,3,54015,0,0,1,
+100207,4,3,79012,5,0,1,
+100213,4,2,52584,9,0,1,
+100237,4,5,61791,7,0,1,
+100267,4,5,100259,6,0,1,
+100271,4,13,57533,7,0,1,
+100279,4,3,51225,6,0,1,
+100291,4,3,76569,2,0,1,
+100297,4,13,80672,4,0,1,
+100313,4,3,54952,0,0,1,
+100333,4,2,82356,12,0,1,
+100343,4,5,86579,9,0,1,
+100357,4,2,54408,6,0,1,
+100361,4,3,62889,4,0,1,
+100363,4,2,97259,8,0,1,
+100379,4,2,60895,2,0,1,
+100391,4,7,70589,2,0,1,
+100393,4,5,63844,16,0,1,
+100403,4,2,80213,14,0,1,
+100411,4,2,53510,1,0,1,
+100417,4,5,78734,6,0,1,
+100447,4,3,74631,2,0,1,
+100459,4,2,76639,8,0,1,
+100469,4,2,57663,3,0,1,
+100483,4,3,88247,3,0,1,
+100493,4,2,92806,0,0,1,
+100501,4,2,50822,6,0,1,
+100511,4,11,50675,3,0,1,
+100517,4,2,55941,13,0,1,
+100519,4,6,82185,3,0,1,
+100523,4,2,62593,13,0,1,
+100537,4,7,86031,8,0,1,
+100547,4,2,56101,2,0,1,
+100549,4,2,50629,6,0,1,
+100559,4,7,79981,6,0,1,
+100591,4,6,94786,4,0,1,
+100609,4,7,87081,20,0,1,
+100613,4,2,81955,6,0,1,
+100621,4,18,96659,9,0,1,
+100649,4,3,78430,3,0,1,
+100669,4,6,55740,12,0,1,
+100673,4,3,65991,1,0,1,
+100693,4,2,55534,10,0,1,
+100699,4,2,58357,8,0,1,
+100703,4,5,81421,5,0,1,
+100733,4,2,60875,4,0,1,
+100741,4,6,52359,10,0,1,
+100747,4,2,63140,10,0,1,
+100769,4,3,58892,1,0,1,
+100787,4,2,72686,4,0,1,
+100799,4,17,67707,4,0,1,
+100801,4,11,56231,20,0,1,
+100811,4,2,68525,4,0,1,
+100823,4,5,71888,6,0,1,
+100829,4,2,86843,12,0,1,
+100847,4,5,77189,7,0,1,
+100853,4,3,66999,12,0,1,
+100907,4,2,98156,7,0,1,
+100913,4,3,95347,0,0,1,
+100927,4,3,53940,5,0,1,
+100931,4,2,77774,1,0,1,
+100937,4,3,95053,0,0,1,
+100943,4,5,74933,7,0,1,
+100957,4,2,54986,9,0,1,
+100981,4,7,91700,9,0,1,
+100987,4,2,60984,2,0,1,
+100999,4,3,84306,3,0,1,
+101009,4,3,74909,1,0,1,
+101021,4,2,96296,6,0,1,
+101027,4,2,53688,2,0,1,
+101051,4,2,96739,9,0,1,
+101063,4,7,101054,4,0,1,
+101081,4,6,79352,9,0,1,
+101089,4,31,63437,17,0,1,
+101107,4,3,83486,5,0,1,
+101111,4,17,61375,7,0,1,
+101113,4,5,90770,6,0,1,
+101117,4,2,91989,7,0,1,
+101119,4,3,69572,2,0,1,
+101141,4,3,92023,3,0,1,
+101149,4,2,50930,11,0,1,
+101159,4,7,76253,3,0,1,
+101161,4,13,92503,14,0,1,
+101173,4,2,86538,6,0,1,
+101183,4,5,99691,3,0,1,
+101197,4,2,54187,3,0,1,
+101203,4,7,59682,16,0,1,
+101207,4,5,88094,5,0,1,
+101209,4,7,65889,17,0,1,
+101221,4,6,61316,12,0,1,
+101267,4,2,74117,2,0,1,
+101273,4,3,72475,6,0,1,
+101279,4,17,53259,4,0,1,
+101281,4,14,82421,16,0,1,
+101287,4,3,101276,12,0,1,
+101293,4,2,92263,6,0,1,
+101323,4,2,65516,2,0,1,
+101333,4,2,97244,7,0,1,
+101341,4,2,61994,10,0,1,
+101347,4,2,71845,8,0,1,
+101359,4,3,97886,3,0,1,
+101363,4,2,74202,2,0,1,
+101377,4,5,70545,6,0,1,
+101383,4,3,61665,5,0,1,
+101399,4,7,101390,4,0,1,
+101411,4,2,69358,8,0,1,
+101419,4,2,96674,2,0,1,
+101429,4,2,101422,8,0,1,
+101449,4,11,85031,18,0,1,
+101467,4,2,60770,8,0,1,
+101477,4,2,86313,3,0,1,
+101483,4,2,96436,7,0,1,
+101489,4,3,101477,0,0,1,
+101501,4,2,58912,2,0,1,
+101503,4,5,84290,9,0,1,
+101513,4,3,68932,1,0,1,
+101527,4,5,92918,10,0,1,
+101531,4,2,88370,6,0,1,
+101533,4,5,83362,20,0,1,
+101537,4,3,74293,7,0,1,
+101561,4,3,99936,2,0,1,
+101573,4,2,84763,3,0,1,
+101581,4,2,65628,6,0,1,
+101599,4,11,77791,2,0,1,
+101603,4,2,92932,4,0,1,
+101611,4,2,64823,6,0,1,
+101627,4,2,90570,8,0,1,
+101641,4,13,97121,16,0,1,
+101653,4,5,101202,6,0,1,
+101663,4,5,98655,4,0,1,
+101681,4,6,89200,4,0,1,
+101693,4,2,93804,2,0,1,
+101701,4,2,77077,3,0,1,
+101719,4,3,90529,2,0,1,
+101723,4,2,70235,10,0,1,
+101737,4,7,59738,12,0,1,
+101741,4,2,78441,1,0,1,
+101747,4,2,92827,1,0,1,
+101749,4,2,57004,10,0,1,
+101771,4,2,76676,12,0,1,
+101789,4,2,84943,6,0,1,
+101797,4,2,88983,6,0,1,
+101807,4,5,97809,4,0,1,
+101833,4,5,93760,12,0,1,
+101837,4,5,64541,6,0,1,
+101839,4,15,91279,2,0,1,
+101863,4,3,65805,6,0,1,
+101869,4,6,95574,2,0,1,
+101873,4,3,86526,4,0,1,
+101879,4,7,78537,5,0,1,
+101891,4,2,54719,6,0,1,
+101917,4,5,101906,14,0,1,
+101921,4,11,58319,4,0,1,
+101929,4,17,54509,22,0,1,
+101939,4,2,88833,4,0,1,
+101957,4,2,80402,7,0,1,
+101963,4,2,76000,7,0,1,
+101977,4,5,88974,16,0,1,
+101987,4,2,99534,7,0,1,
+101999,4,7,75721,3,0,1,
+102001,4,31,83535,32,0,1,
+102013,4,5,87162,6,0,1,
+102019,4,2,97457,8,0,1,
+102023,4,5,52974,3,0,1,
+102031,4,3,66420,3,0,1,
+102043,4,5,86820,5,0,1,
+102059,4,2,100399,2,0,1,
+102061,4,2,74291,6,0,1,
+102071,4,7,59223,2,0,1,
+102077,4,2,102070,8,0,1,
+102079,4,3,59246,3,0,1,
+102101,4,2,93738,1,0,1,
+102103,4,5,88550,34,0,1,
+102107,4,2,52675,2,0,1,
+102121,4,7,96083,16,0,1,
+102139,4,3,101687,3,0,1,
+102149,4,2,54873,4,0,1,
+102161,4,6,67310,0,0,1,
+102181,4,6,89499,11,0,1,
+102191,4,11,79839,6,0,1,
+102197,4,2,85632,3,0,1,
+102199,4,11,101416,0,0,1,
+102203,4,2,97058,0,0,1,
+102217,4,5,72290,10,0,1,
+102229,4,2,62288,12,0,1,
+102233,4,3,61249,7,0,1,
+102241,4,11,98918,8,0,1,
+102251,4,2,59922,8,0,1,
+102253,4,2,101538,9,0,1,
+102259,4,3,100725,0,0,1,
+102293,4,2,57489,1,0,1,
+102299,4,2,63103,3,0,1,
+102301,4,7,77648,9,0,1,
+102317,4,2,81415,3,0,1,
+102329,4,3,83518,2,0,1,
+102337,4,5,52333,6,0,1,
+102359,4,11,92323,3,0,1,
+102367,4,3,66798,3,0,1,
+102397,4,5,69176,10,0,1,
+102407,4,5,85977,5,0,1,
+102409,4,7,55943,14,0,1,
+102433,4,5,61943,18,0,1,
+102437,4,2,57934,2,0,1,
+102451,4,3,85850,2,0,1,
+102461,4,2,57706,12,0,1,
+102481,4,13,57206,14,0,1,
+102497,4,3,64317,7,0,1,
+102499,4,3,56652,0,0,1,
+102503,4,5,54038,9,0,1,
+102523,4,2,65832,8,0,1,
+102533,4,2,69310,6,0,1,
+102539,4,2,102532,8,0,1,
+102547,4,2,92126,8,0,1,
+102551,4,13,58879,5,0,1,
+102559,4,3,81057,6,0,1,
+102563,4,2,93025,10,0,1,
+102587,4,2,87605,8,0,1,
+102593,4,3,55795,4,0,1,
+102607,4,5,70761,10,0,1,
+102611,4,2,54237,4,0,1,
+102643,4,7,59656,12,0,1,
+102647,4,5,102643,3,0,1,
+102653,4,2,53146,4,0,1,
+102667,4,3,100718,11,0,1,
+102673,4,5,102662,14,0,1,
+102677,4,3,87685,4,0,1,
+102679,4,3,65776,13,0,1,
+102701,4,2,63466,12,0,1,
+102761,4,6,79754,7,0,1,
+102763,4,2,102756,8,0,1,
+102769,4,11,57972,23,0,1,
+102793,4,5,73589,6,0,1,
+102797,4,2,66448,9,0,1,
+102811,4,2,75581,8,0,1,
+102829,4,2,72698,14,0,1,
+102841,4,13,66555,14,0,1,
+102859,4,3,86290,1,0,1,
+102871,4,12,91554,3,0,1,
+102877,4,2,89490,6,0,1,
+102881,4,3,86668,3,0,1,
+102911,4,7,84244,10,0,1,
+102913,4,5,55630,10,0,1,
+102929,4,6,65058,0,0,1,
+102931,4,3,87941,2,0,1,
+102953,4,3,52055,0,0,1,
+102967,4,3,102956,12,0,1,
+102983,4,5,100007,3,0,1,
+103001,4,7,92108,12,0,1,
+103007,4,5,63251,10,0,1,
+103043,4,2,102487,2,0,1,
+103049,4,3,97745,2,0,1,
+103067,4,2,86256,2,0,1,
+103069,4,2,79836,12,0,1,
+103079,4,7,60715,2,0,1,
+103087,4,3,85764,11,0,1,
+103091,4,6,72821,5,0,1,
+103093,4,2,77752,6,0,1,
+103099,4,10,83855,0,0,1,
+103123,4,3,100945,3,0,1,
+103141,4,6,103133,12,0,1,
+103171,4,14,95700,7,0,1,
+103177,4,10,55642,0,0,1,
+103183,4,3,84641,3,0,1,
+103217,4,3,69497,9,0,1,
+103231,4,3,93689,3,0,1,
+103237,4,5,55872,1,0,1,
+103289,4,3,103277,0,0,1,
+103291,4,2,96681,2,0,1,
+103307,4,2,55036,4,0,1,
+103319,4,13,66378,6,0,1,
+103333,4,2,72051,3,0,1,
+103349,4,3,89966,3,0,1,
+103357,4,6,74250,8,0,1,
+103387,4,5,75077,5,0,1,
+103391,4,7,99077,11,0,1,
+103393,4,5,65275,6,0,1,
+103399,4,3,103395,4,0,1,
+103409,4,3,79050,2,0,1,
+103421,4,10,65431,8,0,1,
+103423,4,5,84181,16,0,1,
+103451,4,2,65555,3,0,1,
+103457,4,3,95339,12,0,1,
+103471,4,3,99962,6,0,1,
+103483,4,2,61867,8,0,1,
+103511,4,7,102146,2,0,1,
+103529,4,3,103517,0,0,1,
+103549,4,2,61041,3,0,1,
+103553,4,3,58725,7,0,1,
+103561,4,21,101657,8,0,1,
+103567,4,7,72790,10,0,1,
+103573,4,5,60321,1,0,1,
+103577,4,3,92578,0,0,1,
+103583,4,5,86987,2,0,1,
+103591,4,3,83774,3,0,1,
+103613,4,2,88297,1,0,1,
+103619,4,2,53087,2,0,1,
+103643,4,2,88180,8,0,1,
+103651,4,2,82461,8,0,1,
+103657,4,5,101984,11,0,1,
+103669,4,6,76248,2,0,1,
+103681,4,11,79708,23,0,1,
+103687,4,3,55186,6,0,1,
+103699,4,2,95277,8,0,1,
+103703,4,5,78562,8,0,1,
+103723,4,3,83164,5,0,1,
+103769,4,3,103757,0,0,1,
+103787,4,2,97037,2,0,1,
+103801,4,14,86695,12,0,1,
+103811,4,2,73655,7,0,1,
+103813,4,6,79788,16,0,1,
+103837,4,5,92499,3,0,1,
+103841,4,3,103829,0,0,1,
+103843,4,2,93165,11,0,1,
+103867,4,2,79812,8,0,1,
+103889,4,3,79879,2,0,1,
+103903,4,3,52905,2,0,1,
+103913,4,3,87325,1,0,1,
+103919,4,7,103910,4,0,1,
+103951,4,6,77651,3,0,1,
+103963,4,2,83403,7,0,1,
+103967,4,5,90166,4,0,1,
+103969,4,7,75541,0,0,1,
+103979,4,2,69800,7,0,1,
+103981,4,6,61321,7,0,1,
+103991,4,19,73271,2,0,1,
+103993,4,5,103982,14,0,1,
+103997,4,2,75815,6,0,1,
+104003,4,2,57229,8,0,1,
+104009,4,3,103997,0,0,1,
+104021,4,2,64314,16,0,1,
+104033,4,3,70317,0,0,1,
+104047,4,5,82234,3,0,1,
+104053,4,6,100959,0,0,1,
+104059,4,2,72611,8,0,1,
+104087,4,5,87326,1,0,1,
+104089,4,7,65453,0,0,1,
+104107,4,5,100195,2,0,1,
+104113,4,5,68904,11,0,1,
+104119,4,6,101251,2,0,1,
+104123,4,2,78232,2,0,1,
+104147,4,2,67667,3,0,1,
+104149,4,6,98807,7,0,1,
+104161,4,19,86605,14,0,1,
+104173,4,2,86281,6,0,1,
+104179,4,2,69168,2,0,1,
+104183,4,5,53198,14,0,1,
+104207,4,5,104203,3,0,1,
+104231,4,7,64988,6,0,1,
+104233,4,7,68462,10,0,1,
+104239,4,6,69062,10,0,1,
+104243,4,2,70322,2,0,1,
+104281,4,26,99646,14,0,1,
+104287,4,5,63999,5,0,1,
+104297,4,3,56603,7,0,1,
+104309,4,2,75154,6,0,1,
+104311,4,6,69756,5,0,1,
+104323,4,5,53402,5,0,1,
+104327,4,5,104323,3,0,1,
+104347,4,11,100898,2,0,1,
+104369,4,3,96656,2,0,1,
+104381,4,2,69007,0,0,1,
+104383,4,5,104379,3,0,1,
+104393,4,3,59113,11,0,1,
+104399,4,7,98018,2,0,1,
+104417,4,6,98691,7,0,1,
+104459,4,2,101660,7,0,1,
+104471,4,11,71148,5,0,1,
+104473,4,5,80426,17,0,1,
+104479,4,7,68011,0,0,1,
+104491,4,3,85947,6,0,1,
+104513,4,3,62342,4,0,1,
+104527,4,3,60643,3,0,1,
+104537,4,3,76572,9,0,1,
+104543,4,5,77726,14,0,1,
+104549,4,2,60922,1,0,1,
+104551,4,3,70500,2,0,1,
+104561,4,6,61988,0,0,1,
+104579,4,2,85884,2,0,1,
+104593,4,5,92312,12,0,1,
+104597,4,2,78156,20,0,1,
+104623,4,7,75045,5,0,1,
+104639,4,13,83282,3,0,1,
+104651,4,6,55441,0,0,1,
+104659,4,2,102978,8,0,1,
+104677,4,2,91683,6,0,1,
+104681,4,6,91337,0,0,1,
+104683,4,2,74335,11,0,1,
+104693,4,3,90701,15,0,1,
+104701,4,2,93197,10,0,1,
+104707,4,2,85720,8,0,1,
+104711,4,43,92145,3,0,1,
+104717,4,2,98245,6,0,1,
+104723,4,2,99515,2,0,1,
+104729,4,12,86801,0,0,1,
+104743,4,3,84761,3,0,1,
+104759,4,7,101184,2,0,1,
+104761,4,7,96846,0,0,1,
+104773,4,2,101520,12,0,1,
+104779,4,3,54828,5,0,1,
+104789,4,2,85032,1,0,1,
+104801,4,13,104789,5,0,1,
+104803,4,3,57748,5,0,1,
+104827,4,3,81090,5,0,1,
+104831,4,22,96444,4,0,1,
+104849,4,3,104391,7,0,1,
+104851,4,13,61997,2,0,1,
+104869,4,2,81114,12,0,1,
+104879,4,11,73074,5,0,1,
+104891,4,2,104884,8,0,1,
+104911,4,6,62542,4,0,1,
+104917,4,2,65257,12,0,1,
+104933,4,2,90338,6,0,1,
+104947,4,5,87971,7,0,1,
+104953,4,5,81890,18,0,1,
+104959,4,3,72421,2,0,1,
+104971,4,2,101949,2,0,1,
+104987,4,2,55614,7,0,1,
+104999,4,11,79633,7,0,1,
+105019,4,2,94135,1,0,1,
+105023,4,5,84131,5,0,1,
+105031,4,3,74231,3,0,1,
+105037,4,5,90097,10,0,1,
+105071,4,7,69564,7,0,1,
+105097,4,7,55342,13,0,1,
+105107,4,2,98222,8,0,1,
+105137,4,3,103361,7,0,1,
+105143,4,5,95356,8,0,1,
+105167,4,5,105155,11,0,1,
+105173,4,2,77550,3,0,1,
+105199,4,6,103097,3,0,1,
+105211,4,2,55049,8,0,1,
+105227,4,5,57345,5,0,1,
+105229,4,2,105222,8,0,1,
+105239,4,14,93426,2,0,1,
+105251,4,2,82405,2,0,1,
+105253,4,6,54633,6,0,1,
+105263,4,5,105259,3,0,1,
+105269,4,2,60321,9,0,1,
+105277,4,6,86590,10,0,1,
+105319,4,3,58606,3,0,1,
+105323,4,2,95205,8,0,1,
+105331,4,2,96671,13,0,1,
+105337,4,10,79802,6,0,1,
+105341,4,2,56459,4,0,1,
+105359,4,7,78705,8,0,1,
+105361,4,17,91628,28,0,1,
+105367,4,3,101826,3,0,1,
+105373,4,2,84771,9,0,1,
+105379,4,2,70643,7,0,1,
+105389,4,2,102396,6,0,1,
+105397,4,2,80564,7,0,1,
+105401,4,3,58077,4,0,1,
+105407,4,5,84794,9,0,1,
+105437,4,2,64232,3,0,1,
+105449,4,6,54933,4,0,1,
+105467,4,2,104342,4,0,1,
+105491,4,2,82262,7,0,1,
+105499,4,2,78421,3,0,1,
+105503,4,10,57033,8,0,1,
+105509,4,2,86419,3,0,1,
+105517,4,2,60399,9,0,1,
+105527,4,5,74025,8,0,1,
+105529,4,11,75095,22,0,1,
+105533,4,2,74680,8,0,1,
+105541,4,2,54907,6,0,1,
+105557,4,3,81753,5,0,1,
+105563,4,2,73255,14,0,1,
+105601,4,17,61332,20,0,1,
+105607,4,3,80280,2,0,1,
+105613,4,2,88206,10,0,1,
+105619,4,3,70070,7,0,1,
+105649,4,7,104477,0,0,1,
+105653,4,2,101280,12,0,1,
+105667,4,3,84802,2,0,1,
+105673,4,5,94445,6,0,1,
+105683,4,2,54090,13,0,1,
+105691,4,2,103302,2,0,1,
+105701,4,3,70314,3,0,1,
+105727,4,6,56762,3,0,1,
+105733,4,6,77423,0,0,1,
+105751,4,7,78035,0,0,1,
+105761,4,3,89313,7,0,1,
+105767,4,5,68554,3,0,1,
+105769,4,7,105750,22,0,1,
+105817,4,5,80975,23,0,1,
+105829,4,2,105822,8,0,1,
+105863,4,5,83676,2,0,1,
+105871,4,17,68994,3,0,1,
+105883,4,2,58528,8,0,1,
+105899,4,2,53380,2,0,1,
+105907,4,5,102525,0,0,1,
+105913,4,10,64189,6,0,1,
+105929,4,3,105917,0,0,1,
+105943,4,3,96487,5,0,1,
+105953,4,3,67076,0,0,1,
+105967,4,3,74907,6,0,1,
+105971,4,2,105964,8,0,1,
+105977,4,5,64467,4,0,1,
+105983,4,5,98453,6,0,1,
+105997,4,5,84705,6,0,1,
+106013,4,2,54278,3,0,1,
+106019,4,2,85099,8,0,1,
+106031,4,19,94445,3,0,1,
+106033,4,5,101451,11,0,1,
+106087,4,3,106083,4,0,1,
+106103,4,5,106099,3,0,1,
+106109,4,2,84568,1,0,1,
+106121,4,3,55610,2,0,1,
+106123,4,2,94890,7,0,1,
+106129,4,23,64933,22,0,1,
+106163,4,2,86777,7,0,1,
+106181,4,2,92499,4,0,1,
+106187,4,2,91731,14,0,1,
+106189,4,6,62156,7,0,1,
+106207,4,6,104422,4,0,1,
+106213,4,2,70417,6,0,1,
+106217,4,3,65895,0,0,1,
+106219,4,7,106215,4,0,1,
+106243,4,3,96651,3,0,1,
+106261,4,2,97618,7,0,1,
+106273,4,5,62225,16,0,1,
+106277,4,2,53503,3,0,1,
+106279,4,3,62704,2,0,1,
+106291,4,2,82469,6,0,1,
+106297,4,5,96101,15,0,1,
+106303,4,3,59249,6,0,1,
+106307,4,2,73928,2,0,1,
+106319,4,11,91359,6,0,1,
+106321,4,13,95182,15,0,1,
+106331,4,7,78048,2,0,1,
+106349,4,2,85621,1,0,1,
+106357,4,2,69834,6,0,1,
+106363,4,2,66299,10,0,1,
+106367,4,5,57873,6,0,1,
+106373,4,5,89495,7,0,1,
+106391,4,23,90435,4,0,1,
+106397,4,2,104671,9,0,1,
+106411,4,2,105281,8,0,1,
+106417,4,7,82086,17,0,1,
+106427,4,2,95480,2,0,1,
+106433,4,3,102699,4,0,1,
+106441,4,7,75881,17,0,1,
+106451,4,2,95914,7,0,1,
+106453,4,6,78899,8,0,1,
+106487,4,5,106483,3,0,1,
+106501,4,2,106494,8,0,1,
+106531,4,3,73172,6,0,1,
+106537,4,5,80739,18,0,1,
+106541,4,3,86225,3,0,1,
+106543,4,5,72749,2,0,1,
+106591,4,3,90293,6,0,1,
+106619,4,2,68024,7,0,1,
+106621,4,10,100239,19,0,1,
+106627,4,2,71429,14,0,1,
+106637,4,2,99105,1,0,1,
+106649,4,3,106637,0,0,1,
+106657,4,5,60799,6,0,1,
+106661,4,2,54836,6,0,1,
+106663,4,5,106659,3,0,1,
+106669,4,19,104118,13,0,1,
+106681,4,23,79142,21,0,1,
+106693,4,2,100556,1,0,1,
+106699,4,3,82384,7,0,1,
+106703,4,7,68234,3,0,1,
+106721,4,3,65440,4,0,1,
+106727,4,10,81877,3,0,1,
+106739,4,2,91828,1,0,1,
+106747,4,2,69594,10,0,1,
+106751,4,13,86007,6,0,1,
+106753,4,5,90199,12,0,1,
+106759,4,6,105192,8,0,1,
+106781,4,2,104271,4,0,1,
+106783,4,5,99744,12,0,1,
+106787,4,2,76629,0,0,1,
+106801,4,11,75438,14,0,1,
+106823,4,5,106819,3,0,1,
+106853,4,2,53792,1,0,1,
+106859,4,2,58647,7,0,1,
+106861,4,7,92657,4,0,1,
+106867,4,3,104933,2,0,1,
+106871,4,7,71803,2,0,1,
+106877,4,2,84310,1,0,1,
+106903,4,5,106899,3,0,1,
+106907,4,2,81631,11,0,1,
+106921,4,14,79667,10,0,1,
+106937,4,3,71137,6,0,1,
+106949,4,2,89521,1,0,1,
+106957,4,5,100199,20,0,1,
+106961,4,3,61054,7,0,1,
+106963,4,3,57105,5,0,1,
+106979,4,2,85298,6,0,1,
+106993,4,5,68696,18,0,1,
+107021,4,7,62999,9,0,1,
+107033,4,3,87292,9,0,1,
+107053,4,5,88582,19,0,1,
+107057,4,3,57579,0,0,1,
+107069,4,2,100051,1,0,1,
+107071,4,3,87186,3,0,1,
+107077,4,2,107070,8,0,1,
+107089,4,7,96108,0,0,1,
+107099,4,2,87849,9,0,1,
+107101,4,6,107093,12,0,1,
+107119,4,3,97885,6,0,1,
+107123,4,2,77610,4,0,1,
+107137,4,10,59087,15,0,1,
+107171,4,10,101625,2,0,1,
+107183,4,5,65923,4,0,1,
+107197,4,2,87303,15,0,1,
+107201,4,7,78916,7,0,1,
+107209,4,13,73503,14,0,1,
+107227,4,20,62810,5,0,1,
+107243,4,2,66189,13,0,1,
+107251,4,3,79808,2,0,1,
+107269,4,6,84140,7,0,1,
+107273,4,3,86004,1,0,1,
+107279,4,7,69237,3,0,1,
+107309,4,2,80777,6,0,1,
+107323,4,13,77205,2,0,1,
+107339,4,6,54304,4,0,1,
+107347,4,2,68776,8,0,1,
+107351,4,19,87143,5,0,1,
+107357,4,2,89342,3,0,1,
+107377,4,10,97492,8,0,1,
+107441,4,3,107429,0,0,1,
+107449,4,7,87184,0,0,1,
+107453,4,2,100577,9,0,1,
+107467,4,2,106664,2,0,1,
+107473,4,5,93041,15,0,1,
+107507,4,2,101260,8,0,1,
+107509,4,6,107505,6,0,1,
+107563,4,11,91516,10,0,1,
+107581,4,2,57281,7,0,1,
+107599,4,3,76989,3,0,1,
+107603,4,2,94082,11,0,1,
+107609,4,3,73896,4,0,1,
+107621,4,2,65807,15,0,1,
+107641,4,11,91733,12,0,1,
+107647,4,5,92136,5,0,1,
+107671,4,6,90840,10,0,1,
+107687,4,5,62234,7,0,1,
+107693,4,2,60379,2,0,1,
+107699,4,2,88066,8,0,1,
+107713,4,10,100860,20,0,1,
+107717,4,2,95667,6,0,1,
+107719,4,3,96804,2,0,1,
+107741,4,3,107737,4,0,1,
+107747,4,2,107740,8,0,1,
+107761,4,14,107027,0,0,1,
+107773,4,2,101928,6,0,1,
+107777,4,3,95854,7,0,1,
+107791,4,3,72374,3,0,1,
+107827,4,5,60617,3,0,1,
+107837,4,2,63755,6,0,1,
+107839,4,15,77835,5,0,1,
+107843,4,2,99620,0,0,1,
+107857,4,5,89097,12,0,1,
+107867,4,2,60541,18,0,1,
+107873,4,3,67841,17,0,1,
+107881,4,23,105401,14,0,1,
+107897,4,3,54316,2,0,1,
+107903,4,5,70956,9,0,1,
+107923,4,2,106785,8,0,1,
+107927,4,5,107923,3,0,1,
+107941,4,6,64633,10,0,1,
+107951,4,7,103981,3,0,1,
+107971,4,3,98229,6,0,1,
+107981,4,2,96717,4,0,1,
+107999,4,13,59088,6,0,1,
+108007,4,11,86064,2,0,1,
+108011,4,7,55179,1,0,1,
+108013,4,6,75473,8,0,1,
+108023,4,5,77798,7,0,1,
+108037,4,2,80139,22,0,1,
+108041,4,6,103451,10,0,1,
+108061,4,2,70777,10,0,1,
+108079,4,3,108075,4,0,1,
+108089,4,6,75930,2,0,1,
+108107,4,2,105736,12,0,1,
+108109,4,2,62811,6,0,1,
+108127,4,6,87299,7,0,1,
+108131,4,6,64592,0,0,1,
+108139,4,2,77447,6,0,1,
+108161,4,3,108149,0,0,1,
+108179,4,2,99577,8,0,1,
+108187,4,5,71686,8,0,1,
+108191,4,13,105936,3,0,1,
+108193,4,13,69944,6,0,1,
+108203,4,2,64580,8,0,1,
+108211,4,3,58404,5,0,1,
+108217,4,5,71451,12,0,1,
+108223,4,3,72368,3,0,1,
+108233,4,3,58932,1,0,1,
+108247,4,3,102791,2,0,1,
+108263,4,5,92442,8,0,1,
+108271,4,3,65980,6,0,1,
+108287,4,5,87705,9,0,1,
+108289,4,7,75051,17,0,1,
+108293,4,2,107723,4,0,1,
+108301,4,6,103015,7,0,1,
+108343,4,3,99766,6,0,1,
+108347,4,2,100204,0,0,1,
+108359,4,11,106815,7,0,1,
+108377,4,3,104358,7,0,1,
+108379,4,2,65781,2,0,1,
+108401,4,3,73509,4,0,1,
+108413,4,2,61123,2,0,1,
+108421,4,17,78239,1,0,1,
+108439,4,3,83691,6,0,1,
+108457,4,5,66705,16,0,1,
+108461,4,2,59975,4,0,1,
+108463,4,5,108459,3,0,1,
+108497,4,3,81126,12,0,1,
+108499,4,14,92342,2,0,1,
+108503,4,5,63561,2,0,1,
+108517,4,5,89622,6,0,1,
+108529,4,23,80774,14,0,1,
+108533,4,2,90567,3,0,1,
+108541,4,2,64993,10,0,1,
+108553,4,5,88115,25,0,1,
+108557,4,2,102067,6,0,1,
+108571,4,3,92412,3,0,1,
+108587,4,2,81296,0,0,1,
+108631,4,6,92907,3,0,1,
+108637,4,15,59747,15,0,1,
+108643,4,5,108635,6,0,1,
+108649,4,11,87737,22,0,1,
+108677,4,2,82009,12,0,1,
+108707,4,2,80616,0,0,1,
+108709,4,6,81347,8,0,1,
+108727,4,3,108723,4,0,1,
+108739,4,2,63931,8,0,1,
+108751,4,3,79316,3,0,1,
+108761,4,3,108749,0,0,1,
+108769,4,7,73877,16,0,1,
+108791,4,7,58472,2,0,1,
+108793,4,5,70431,8,0,1,
+108799,4,6,94170,5,0,1,
+108803,4,2,57904,8,0,1,
+108821,4,2,68836,0,0,1,
+108827,4,2,97718,10,0,1,
+108863,4,5,57378,3,0,1,
+108869,4,2,106422,3,0,1,
+108877,4,2,103058,3,0,1,
+108881,4,3,70048,2,0,1,
+108883,4,2,92194,2,0,1,
+108887,4,5,68489,5,0,1,
+108893,4,3,95872,7,0,1,
+108907,4,12,62872,0,0,1,
+108917,4,2,81187,28,0,1,
+108923,4,2,57198,7,0,1,
+108929,4,3,70698,2,0,1,
+108943,4,3,59113,5,0,1,
+108947,4,2,77901,2,0,1,
+108949,4,2,80916,10,0,1,
+108959,4,11,71732,7,0,1,
+108961,4,7,90013,14,0,1,
+108967,4,3,80825,3,0,1,
+108971,4,2,55462,4,0,1,
+108991,4,6,70144,2,0,1,
+109001,4,3,108989,0,0,1,
+109013,4,2,102916,7,0,1,
+109037,4,2,105116,1,0,1,
+109049,4,3,109037,0,0,1,
+109063,4,6,67465,3,0,1,
+109073,4,3,83169,1,0,1,
+109097,4,3,93654,6,0,1,
+109103,4,5,85353,7,0,1,
+109111,4,3,55735,6,0,1,
+109121,4,3,109109,0,0,1,
+109133,4,2,59368,9,0,1,
+109139,4,2,61426,8,0,1,
+109141,4,2,79949,12,0,1,
+109147,4,3,100589,2,0,1,
+109159,4,6,98795,4,0,1,
+109169,4,3,100843,8,0,1,
+109171,4,2,83228,3,0,1,
+109199,4,19,95952,5,0,1,
+109201,4,17,55710,38,0,1,
+109211,4,6,61645,4,0,1,
+109229,4,2,83105,1,0,1,
+109253,4,3,68506,23,0,1,
+109267,4,2,97367,8,0,1,
+109279,4,11,58405,3,0,1,
+109297,4,5,99462,17,0,1,
+109303,4,3,95106,8,0,1,
+109313,4,3,102362,6,0,1,
+109321,4,19,67002,20,0,1,
+109331,4,2,81855,4,0,1,
+109357,4,11,61625,3,0,1,
+109363,4,3,108266,0,0,1,
+109367,4,5,83980,3,0,1,
+109379,4,2,83806,5,0,1,
+109387,4,2,62657,6,0,1,
+109391,4,7,109382,4,0,1,
+109397,4,2,74657,17,0,1,
+109423,4,3,105318,14,0,1,
+109433,4,3,90967,9,0,1,
+109441,4,14,57513,8,0,1,
+109451,4,2,72099,2,0,1,
+109453,4,2,75295,6,0,1,
+109469,4,2,58496,3,0,1,
+109471,4,3,95240,2,0,1,
+109481,4,3,97234,2,0,1,
+109507,4,2,64343,2,0,1,
+109517,4,2,76379,0,0,1,
+109519,4,3,99769,3,0,1,
+109537,4,5,109526,14,0,1,
+109541,4,2,56063,9,0,1,
+109547,4,2,67604,7,0,1,
+109567,4,5,108285,2,0,1,
+109579,4,2,73494,8,0,1,
+109583,4,5,90581,2,0,1,
+109589,4,2,105548,0,0,1,
+109597,4,5,61160,7,0,1,
+109609,4,14,76940,16,0,1,
+109619,4,2,76843,7,0,1,
+109621,4,10,74602,7,0,1,
+109639,4,3,109635,4,0,1,
+109661,4,3,109657,4,0,1,
+109663,4,11,103620,5,0,1,
+109673,4,3,72803,0,0,1,
+109717,4,5,56797,10,0,1,
+109721,4,3,90989,7,0,1,
+109741,4,2,98434,6,0,1,
+109751,4,11,108128,6,0,1,
+109789,4,10,55492,12,0,1,
+109793,4,3,79253,0,0,1,
+109807,4,5,109803,3,0,1,
+109819,4,3,89809,3,0,1,
+109829,4,2,105285,3,0,1,
+109831,4,3,103096,3,0,1,
+109841,4,3,81116,4,0,1,
+109843,4,2,77866,7,0,1,
+109847,4,5,65590,14,0,1,
+109849,4,7,91741,24,0,1,
+109859,4,2,97735,3,0,1,
+109873,4,15,56143,0,0,1,
+109883,4,2,105350,8,0,1,
+109891,4,2,83307,6,0,1,
+109897,4,10,79199,12,0,1,
+109903,4,3,81212,2,0,1,
+109913,4,3,103200,2,0,1,
+109919,4,17,109911,3,0,1,
+109937,4,3,96530,5,0,1,
+109943,4,5,109939,3,0,1,
+109961,4,3,109949,0,0,1,
+109987,4,3,100525,3,0,1,
@@ -0,0 +1,7 @@
+int main(int argc, char ** argv) { 
+#if defined(_WIN64)
+return __builtin_popcountll(argc) == 100;
+#else
+return __builtin_popcountl(argc) == 100;
+#endif 
+}
@@ -0,0 +1 @@
+__thread int x = 42; int main(int argc, char ** argv) { return x != 42; }
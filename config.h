@@ -0,0 +1,12 @@
+/* This file is autogenerated by ./configure -- do not edit! */
+#define POPCNT_INTRINSICS
+#define HAVE_BLAS 0
+#define HAVE_TLS 1
+#define HAVE_FENV 1
+#define HAVE_PTHREAD 1
+#define HAVE_GC 0
+#define FLINT_REENTRANT 0
+#define FLINT_FMPZ_INLINE 0
+#define WANT_ASSERT 0
+#define WANT_STATS 0
+#define FLINT_DLL
@@ -57,6 +57,7 @@ static char * docsin[] = {
     "../../fq_nmod/doc/fq_nmod.txt",
     "../../fq_nmod_vec/doc/fq_nmod_vec.txt",
     "../../fq_nmod_mat/doc/fq_nmod_mat.txt",
+    "../../fq_nmod_packed/doc/fq_nmod_packed.txt",
     "../../fq_nmod_poly/doc/fq_nmod_poly.txt",
     "../../fq_nmod_poly_factor/doc/fq_nmod_poly_factor.txt",
     "../../fq_zech/doc/fq_zech.txt",
@@ -74,6 +75,9 @@ static char * docsin[] = {
     "../../doc/longlong.txt",
     "../../mpn_extras/doc/mpn_extras.txt",
     "../../doc/profiler.txt", 
+    "../../doc/tuning.txt",
+    "../../doc/stats.txt",
+    "../../thread_pool/doc/thread_pool.txt",
     "../../interfaces/doc/interfaces.txt",
     "../../fft/doc/fft.txt",
     "../../qsieve/doc/qsieve.txt",
@@ -110,6 +114,7 @@ static char * docsout[] = {
     "input/fq_nmod.tex",
     "input/fq_nmod_vec.tex",
     "input/fq_nmod_mat.tex",
+    "input/fq_nmod_packed.tex",
     "input/fq_nmod_poly.tex",
     "input/fq_nmod_poly_factor.tex",
     "input/fq_zech.tex",
@@ -127,6 +132,9 @@ static char * docsout[] = {
     "input/longlong.tex", 
     "input/mpn_extras.tex",
     "input/profiler.tex", 
+    "input/tuning.tex",
+    "input/stats.tex",
+    "input/thread_pool.tex",
     "input/interfaces.tex",
     "input/fft.tex",
     "input/qsieve.tex",
@@ -253,10 +253,49 @@ FLINT_DLL void fft_mfa_truncate_sqrt2_inner(mp_limb_t ** ii, mp_limb_t ** jj,
             mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
                 mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, mp_limb_t * tt);
 
+FLINT_DLL void fft_mfa_truncate_sqrt2_precache(mp_limb_t ** jj, mp_size_t n, 
+                      mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                                mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc);
+
+FLINT_DLL void fft_mfa_truncate_sqrt2_inner_precache(mp_limb_t ** ii, 
+            mp_limb_t ** jj, mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, 
+                   mp_limb_t ** t2, mp_limb_t ** temp, mp_size_t n1, 
+                                               mp_size_t trunc, mp_limb_t * tt);
+
 FLINT_DLL void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, 
                         mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
                                 mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc);
 
+/*
+   Arguments of a pass of the matrix Fourier algorithm over the range
+   [start, stop) of its independent rows or columns, ii and jj being the
+   full arrays of 4n coefficients
+*/
+typedef struct
+{
+   mp_limb_t ** ii;
+   mp_limb_t ** jj;
+   mp_size_t n;
+   mp_bitcnt_t w;
+   mp_limb_t ** t1;
+   mp_limb_t ** t2;
+   mp_limb_t ** temp;
+   mp_limb_t * tt;
+   mp_size_t n1;
+   mp_size_t trunc;
+   mp_size_t start;
+   mp_size_t stop;
+   int precache; /* nonzero if the rows of jj are already transformed */
+} fft_mfa_arg_struct;
+
+typedef void (* fft_mfa_pass_func)(fft_mfa_arg_struct * arg);
+
+FLINT_DLL void _fft_mfa_threaded(fft_mfa_pass_func pass, 
+                                    fft_mfa_arg_struct * arg, mp_size_t len);
+
+/* Smallest number of words in a transform split over threads */
+#define FFT_MFA_THREADED_CUTOFF 32768
+
 FLINT_DLL void fft_negacyclic(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w, 
                              mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp);
 
@@ -281,6 +320,13 @@ FLINT_DLL void fft_convolution(mp_limb_t ** ii, mp_limb_t ** jj, slong depth,
                                  slong limbs, slong trunc, mp_limb_t ** t1, 
                                 mp_limb_t ** t2, mp_limb_t ** s1, mp_limb_t * tt);
 
+FLINT_DLL void fft_precache(mp_limb_t ** jj, slong depth, slong limbs, 
+              slong trunc, mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** s1);
+
+FLINT_DLL void fft_convolution_precache(mp_limb_t ** ii, mp_limb_t ** jj, 
+                  slong depth, slong limbs, slong trunc, mp_limb_t ** t1, 
+                          mp_limb_t ** t2, mp_limb_t ** s1, mp_limb_t * tt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,59 +33,152 @@ or implied, of William Hart.
 #include "ulong_extras.h"
 #include "fft.h"
 
-void fft_mfa_truncate_sqrt2_inner(mp_limb_t ** ii, mp_limb_t ** jj, mp_size_t n, 
-                   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
-                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, mp_limb_t * tt)
+/*
+   Convolutions on the rows of the matrix Fourier FFT with index in the
+   range [start, stop), the first trunc2 being the relevant rows of the
+   second half and the remaining n2 the rows of the first half. If
+   arg->precache is set, the rows of jj are already transformed and
+   normalised and jj is not modified.
+*/
+static void _fft_mfa_truncate_sqrt2_inner_rows(fft_mfa_arg_struct * arg)
 {
+   mp_limb_t ** ii = arg->ii, ** jj = arg->jj;
+   mp_size_t n = arg->n;
+   mp_bitcnt_t w = arg->w;
+   mp_limb_t ** t1 = arg->t1, ** t2 = arg->t2, * tt = arg->tt;
+   mp_size_t n1 = arg->n1, trunc = arg->trunc;
    mp_size_t i, j, s;
    mp_size_t n2 = (2*n)/n1;
    mp_size_t trunc2 = (trunc - 2*n)/n1;
    mp_size_t limbs = (n*w)/FLINT_BITS;
    mp_bitcnt_t depth = 0;
-   mp_bitcnt_t depth2 = 0;
    
    while ((UWORD(1)<<depth) < n2) depth++;
-   while ((UWORD(1)<<depth2) < n1) depth2++;
 
-   ii += 2*n;
-   jj += 2*n;
-
-   /* convolutions on relevant rows */
-   for (s = 0; s < trunc2; s++)
+   for (s = arg->start; s < arg->stop; s++)
    {
-      i = n_revbin(s, depth);
-      fft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
-      if (ii != jj) fft_radix2(jj + i*n1, n1/2, w*n2, t1, t2);
+      /* relevant rows of the second half, then the rows of the first */
+      if (s < trunc2)
+         i = 2*n + n_revbin(s, depth)*n1;
+      else
+         i = (s - trunc2)*n1;
+
+      fft_radix2(ii + i, n1/2, w*n2, t1, t2);
+      if (ii != jj && !arg->precache) 
+         fft_radix2(jj + i, n1/2, w*n2, t1, t2);
       
       for (j = 0; j < n1; j++)
       {
-         mp_size_t t = i*n1 + j;
+         mp_size_t t = i + j;
          mpn_normmod_2expp1(ii[t], limbs);
-         if (ii != jj) mpn_normmod_2expp1(jj[t], limbs);
+         if (ii != jj && !arg->precache) mpn_normmod_2expp1(jj[t], limbs);
          fft_mulmod_2expp1(ii[t], ii[t], jj[t], n, w, tt);
       }      
       
-      ifft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
+      ifft_radix2(ii + i, n1/2, w*n2, t1, t2);
    }
+}
 
-   ii -= 2*n;
-   jj -= 2*n;
+void fft_mfa_truncate_sqrt2_inner(mp_limb_t ** ii, mp_limb_t ** jj, mp_size_t n, 
+                   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, mp_limb_t * tt)
+{
+   fft_mfa_arg_struct arg;
+   mp_size_t n2 = (2*n)/n1;
+   mp_size_t trunc2 = (trunc - 2*n)/n1;
 
-   /* convolutions on rows */
-   for (i = 0; i < n2; i++)
+   arg.ii = ii;
+   arg.jj = jj;
+   arg.n = n;
+   arg.w = w;
+   arg.t1 = t1;
+   arg.t2 = t2;
+   arg.temp = temp;
+   arg.tt = tt;
+   arg.n1 = n1;
+   arg.trunc = trunc;
+   arg.precache = 0;
+
+   _fft_mfa_threaded(_fft_mfa_truncate_sqrt2_inner_rows, &arg, trunc2 + n2);
+}
+
+void fft_mfa_truncate_sqrt2_inner_precache(mp_limb_t ** ii, mp_limb_t ** jj, 
+         mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, mp_limb_t * tt)
+{
+   fft_mfa_arg_struct arg;
+   mp_size_t n2 = (2*n)/n1;
+   mp_size_t trunc2 = (trunc - 2*n)/n1;
+
+   arg.ii = ii;
+   arg.jj = jj;
+   arg.n = n;
+   arg.w = w;
+   arg.t1 = t1;
+   arg.t2 = t2;
+   arg.temp = temp;
+   arg.tt = tt;
+   arg.n1 = n1;
+   arg.trunc = trunc;
+   arg.precache = 1;
+
+   _fft_mfa_threaded(_fft_mfa_truncate_sqrt2_inner_rows, &arg, trunc2 + n2);
+}
+
+/* 
+   Row FFTs of the matrix Fourier FFT with index in the range [start, stop),
+   indexed as for the convolutions, followed by normalisation.
+*/
+static void _fft_mfa_truncate_sqrt2_precache_rows(fft_mfa_arg_struct * arg)
+{
+   mp_limb_t ** jj = arg->jj;
+   mp_size_t n = arg->n;
+   mp_bitcnt_t w = arg->w;
+   mp_size_t n1 = arg->n1, trunc = arg->trunc;
+   mp_size_t i, j, s;
+   mp_size_t n2 = (2*n)/n1;
+   mp_size_t trunc2 = (trunc - 2*n)/n1;
+   mp_size_t limbs = (n*w)/FLINT_BITS;
+   mp_bitcnt_t depth = 0;
+   
+   while ((UWORD(1)<<depth) < n2) depth++;
+
+   for (s = arg->start; s < arg->stop; s++)
    {
-      fft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
-      if (ii != jj) fft_radix2(jj + i*n1, n1/2, w*n2, t1, t2);
+      if (s < trunc2)
+         i = 2*n + n_revbin(s, depth)*n1;
+      else
+         i = (s - trunc2)*n1;
 
-      for (j = 0; j < n1; j++)
-      {
-         mp_size_t t = i*n1 + j;
-         mpn_normmod_2expp1(ii[t], limbs);
-         if (ii != jj) mpn_normmod_2expp1(jj[t], limbs);
-         fft_mulmod_2expp1(ii[t], ii[t], jj[t], n, w, tt);
-      }      
+      fft_radix2(jj + i, n1/2, w*n2, arg->t1, arg->t2);
       
-      ifft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
+      for (j = 0; j < n1; j++)
+         mpn_normmod_2expp1(jj[i + j], limbs);
    }
 }
 
+void fft_mfa_truncate_sqrt2_precache(mp_limb_t ** jj, mp_size_t n, 
+                   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+{
+   fft_mfa_arg_struct arg;
+   mp_size_t n2 = (2*n)/n1;
+   mp_size_t trunc2 = (trunc - 2*n)/n1;
+
+   fft_mfa_truncate_sqrt2_outer(jj, n, w, t1, t2, temp, n1, trunc);
+
+   arg.ii = jj;
+   arg.jj = jj;
+   arg.n = n;
+   arg.w = w;
+   arg.t1 = t1;
+   arg.t2 = t2;
+   arg.temp = temp;
+   arg.tt = NULL;
+   arg.n1 = n1;
+   arg.trunc = trunc;
+   arg.precache = 0;
+
+   _fft_mfa_threaded(_fft_mfa_truncate_sqrt2_precache_rows, &arg, 
+                                                               trunc2 + n2);
+}
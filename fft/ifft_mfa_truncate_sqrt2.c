@@ -264,9 +264,18 @@ void ifft_mfa_truncate_sqrt2(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w,
    }
 }
 
-void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w, 
-   mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+/*
+   Outer layers of the inverse matrix Fourier FFT on the columns in the
+   range [start, stop). The second half of each column only depends on
+   the same column of the first half, so both are done together.
+*/
+static void _ifft_mfa_truncate_sqrt2_outer_columns(fft_mfa_arg_struct * arg)
 {
+   mp_limb_t ** ii = arg->ii + 2*arg->n;
+   mp_size_t n = arg->n;
+   mp_bitcnt_t w = arg->w;
+   mp_limb_t ** t1 = arg->t1, ** t2 = arg->t2, ** temp = arg->temp;
+   mp_size_t n1 = arg->n1, trunc = arg->trunc;
    mp_size_t i, j;
    mp_size_t n2 = (2*n)/n1;
    mp_size_t trunc2 = (trunc - 2*n)/n1;
@@ -277,30 +286,25 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w,
    while ((UWORD(1)<<depth) < n2) depth++;
    while ((UWORD(1)<<depth2) < n1) depth2++;
 
-   /* first half mfa IFFT : n2 rows, n1 cols */
-   
-   /* column IFFTs */
-   for (i = 0; i < n1; i++)
+   for (i = arg->start; i < arg->stop; i++)
    {   
+      /* first half mfa IFFT : n2 rows, n1 cols */
+
       for (j = 0; j < n2; j++)
       {
          mp_size_t s = n_revbin(j, depth);
-         if (j < s) SWAP_PTRS(ii[i+j*n1], ii[i+s*n1]);
+         if (j < s) SWAP_PTRS(ii[i+j*n1-2*n], ii[i+s*n1-2*n]);
       }
       
       /*
          IFFT of length n2 on column i, applying z^{r*i} for rows going up in steps 
          of 1 starting at row 0, where z => w bits
       */
-      ifft_radix2_twiddle(ii + i, n1, n2/2, w*n1, t1, t2, w, 0, i, 1);
-   }
-   
-   /* second half IFFT : n2 rows, n1 cols */
-   ii += 2*n;
+      ifft_radix2_twiddle(ii + i - 2*n, n1, n2/2, w*n1, t1, t2, w, 0, i, 1);
 
-   /* column IFFTs with relevant sqrt2 layer butterflies combined */
-   for (i = 0; i < n1; i++)
-   {   
+      /* second half IFFT : n2 rows, n1 cols */
+
+      /* column IFFTs with relevant sqrt2 layer butterflies combined */
       for (j = 0; j < trunc2; j++)
       {
          mp_size_t s = n_revbin(j, depth);
@@ -368,3 +372,23 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w,
       }
    }
 }
+
+void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w, 
+   mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+{
+   fft_mfa_arg_struct arg;
+
+   arg.ii = ii;
+   arg.jj = ii;
+   arg.n = n;
+   arg.w = w;
+   arg.t1 = t1;
+   arg.t2 = t2;
+   arg.temp = temp;
+   arg.tt = NULL;
+   arg.n1 = n1;
+   arg.trunc = trunc;
+   arg.precache = 0;
+
+   _fft_mfa_threaded(_ifft_mfa_truncate_sqrt2_outer_columns, &arg, n1);
+}
@@ -0,0 +1,163 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "thread_pool.h"
+#include "fft.h"
+
+typedef struct
+{
+   fft_mfa_pass_func pass;
+   fft_mfa_arg_struct * arg;
+} fft_mfa_thread_arg_t;
+
+static void
+_fft_mfa_worker(void * arg_ptr)
+{
+   fft_mfa_thread_arg_t * arg = (fft_mfa_thread_arg_t *) arg_ptr;
+
+   arg->pass(arg->arg);
+}
+
+/*
+   The butterflies swap coefficients with the scratch space t1 and t2,
+   so after a pass the scratch of a worker may have been exchanged for
+   coefficients of ii or jj. Moves the data so that t1 and t2 are the
+   buffers a and b again, in some order, and ii and jj only point to
+   their own coefficients.
+*/
+static void
+_fft_mfa_restore(mp_limb_t ** ii, mp_limb_t ** jj, mp_size_t len,
+                  mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t * a,
+                                           mp_limb_t * b, mp_size_t limbs)
+{
+   mp_limb_t * orig[2];
+   mp_limb_t ** slot, ** p;
+   mp_size_t i, k;
+
+   orig[0] = a;
+   orig[1] = b;
+
+   for (k = 0; k < 2; k++)
+   {
+      if (*t1 == orig[k] || *t2 == orig[k])
+         continue;
+
+      slot = (*t1 != a && *t1 != b) ? t1 : t2;
+
+      p = NULL;
+      for (i = 0; i < len && p == NULL; i++)
+      {
+         if (ii[i] == orig[k])
+            p = ii + i;
+         else if (jj[i] == orig[k])
+            p = jj + i;
+      }
+
+      FLINT_ASSERT(p != NULL);
+
+      flint_mpn_copyi(*slot, orig[k], limbs + 1);
+      *p = *slot;
+      *slot = orig[k];
+   }
+}
+
+/*
+   Applies pass to the len independent rows or columns described by arg,
+   splitting them over the available threads if the transform is large
+   enough. The calling thread uses the scratch space of arg and the other
+   threads are given their own.
+*/
+void _fft_mfa_threaded(fft_mfa_pass_func pass,
+                                     fft_mfa_arg_struct * arg, mp_size_t len)
+{
+   mp_size_t limbs = (arg->n*arg->w)/FLINT_BITS;
+   mp_size_t size = limbs + 1;
+   slong i, num_threads, num_workers = 0;
+   fft_mfa_arg_struct * args;
+   fft_mfa_thread_arg_t * targs;
+   thread_pool_handle * threads = NULL;
+   mp_limb_t ** ptrs, * scratch;
+
+   if (4*arg->n*size >= FFT_MFA_THREADED_CUTOFF)
+      num_workers = flint_request_threads(&threads, len);
+
+   num_threads = num_workers + 1;
+
+   if (num_threads <= 1)
+   {
+      flint_give_back_threads(threads, num_workers);
+      arg->start = 0;
+      arg->stop = len;
+      pass(arg);
+      return;
+   }
+
+   args = flint_malloc(num_threads*sizeof(fft_mfa_arg_struct));
+   targs = flint_malloc(num_threads*sizeof(fft_mfa_thread_arg_t));
+   ptrs = flint_malloc(3*num_threads*sizeof(mp_limb_t *));
+   scratch = flint_malloc(5*(num_threads - 1)*size*sizeof(mp_limb_t));
+
+   for (i = 0; i < num_threads; i++)
+   {
+      args[i] = *arg;
+      args[i].start = (i*len)/num_threads;
+      args[i].stop = ((i + 1)*len)/num_threads;
+
+      if (i > 0)
+      {
+         ptrs[3*i] = scratch + 5*(i - 1)*size;
+         ptrs[3*i + 1] = ptrs[3*i] + size;
+         ptrs[3*i + 2] = ptrs[3*i + 1] + size;
+         args[i].t1 = ptrs + 3*i;
+         args[i].t2 = ptrs + 3*i + 1;
+         args[i].temp = ptrs + 3*i + 2;
+         args[i].tt = ptrs[3*i + 2] + size;
+      }
+
+      targs[i].pass = pass;
+      targs[i].arg = args + i;
+   }
+
+   for (i = 1; i < num_threads; i++)
+      thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                                                 _fft_mfa_worker, &targs[i]);
+
+   pass(args);
+
+   for (i = 1; i < num_threads; i++)
+      thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+   flint_give_back_threads(threads, num_workers);
+
+   for (i = 1; i < num_threads; i++)
+   {
+      mp_limb_t * a = scratch + 5*(i - 1)*size;
+
+      _fft_mfa_restore(arg->ii, arg->jj, 4*arg->n,
+                       args[i].t1, args[i].t2, a, a + size, limbs);
+   }
+
+   flint_free(args);
+   flint_free(targs);
+   flint_free(ptrs);
+   flint_free(scratch);
+}
@@ -0,0 +1,46 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fft.h"
+
+void fft_precache(mp_limb_t ** jj, slong depth, slong limbs, slong trunc, 
+                        mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** s1)
+{
+   slong n = (WORD(1)<<depth), j;
+   slong w = (limbs*FLINT_BITS)/n;
+   slong sqrt = (WORD(1)<<(depth/2));
+
+   if (depth <= 6)
+   {
+      trunc = 2*((trunc + 1)/2);
+      
+      fft_truncate_sqrt2(jj, n, w, t1, t2, s1, trunc);
+
+      for (j = 0; j < trunc; j++)
+         mpn_normmod_2expp1(jj[j], limbs);
+   } else
+   {
+      trunc = 2*sqrt*((trunc + 2*sqrt - 1)/(2*sqrt));
+      
+      fft_mfa_truncate_sqrt2_precache(jj, n, w, t1, t2, s1, sqrt, trunc);
+   }
+}
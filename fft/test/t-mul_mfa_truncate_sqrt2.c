@@ -60,6 +60,8 @@ main(void)
             mp_size_t j;
             mp_limb_t * i1, *i2, *r1, *r2;
         
+            flint_set_num_threads(n_randint(state, 4) + 1);
+
             i1 = flint_malloc(6*int_limbs*sizeof(mp_limb_t));
             i2 = i1 + int_limbs;
             r1 = i2 + int_limbs;
@@ -97,6 +99,8 @@ main(void)
             mp_size_t j;
             mp_limb_t * i1, *r1, *r2;
         
+            flint_set_num_threads(n_randint(state, 4) + 1);
+
             i1 = flint_malloc(5*int_limbs*sizeof(mp_limb_t));
             r1 = i1 + int_limbs;
             r2 = r1 + 2*int_limbs;
@@ -119,6 +123,8 @@ main(void)
         }
     }
 
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
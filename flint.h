@@ -144,9 +144,114 @@ FLINT_DLL void flint_cleanup(void);
 
 FLINT_DLL int flint_get_num_threads(void);
 FLINT_DLL void flint_set_num_threads(int num_threads);
+FLINT_DLL void _flint_set_num_workers(int num_workers);
 
 FLINT_DLL int flint_test_multiplier(void);
 
+/*
+   Crossover points between algorithms which can be changed at runtime,
+   see tuning.c. The tuning macros of the module headers read this table.
+*/
+typedef enum
+{
+   FLINT_TUNE_NMOD_MAT_MUL_STRASSEN = 0,
+   FLINT_TUNE_FMPZ_MAT_MUL_CLASSICAL,
+   FLINT_TUNE_FMPZ_MAT_MUL_MULTI_MOD,
+   FLINT_TUNE_NMOD_POLY_MUL_NTT,
+   FLINT_TUNE_NMOD_POLY_HGCD,
+   FLINT_TUNE_NMOD_POLY_GCD,
+   FLINT_TUNE_NMOD_POLY_SMALL_GCD,
+   FLINT_TUNE_FMPZ_MOD_POLY_HGCD,
+   FLINT_TUNE_FMPZ_MOD_POLY_GCD,
+   FLINT_TUNE_FQ_MUL_CLASSICAL,
+   FLINT_TUNE_FQ_POLY_HGCD,
+   FLINT_TUNE_FQ_POLY_GCD,
+   FLINT_TUNE_FQ_POLY_SMALL_GCD,
+   FLINT_TUNE_FQ_NMOD_MUL_CLASSICAL,
+   FLINT_TUNE_FQ_NMOD_POLY_HGCD,
+   FLINT_TUNE_FQ_NMOD_POLY_GCD,
+   FLINT_TUNE_FQ_NMOD_POLY_SMALL_GCD,
+   FLINT_TUNE_FQ_ZECH_MUL_CLASSICAL,
+   FLINT_TUNE_FQ_ZECH_POLY_HGCD,
+   FLINT_TUNE_FQ_ZECH_POLY_GCD,
+   FLINT_TUNE_FQ_ZECH_POLY_SMALL_GCD,
+   FLINT_TUNE_NUM
+} flint_tune_param;
+
+FLINT_DLL extern slong flint_tune_tab[FLINT_TUNE_NUM];
+
+#define flint_tune_get(param) (flint_tune_tab[param])
+
+FLINT_DLL void flint_tune_set(flint_tune_param param, slong value);
+FLINT_DLL slong flint_tune_default(flint_tune_param param);
+FLINT_DLL slong flint_tune_min(flint_tune_param param);
+FLINT_DLL const char * flint_tune_name(flint_tune_param param);
+FLINT_DLL int flint_tune_lookup(const char * name);
+FLINT_DLL void flint_tune_reset(void);
+FLINT_DLL int flint_tune_load(const char * filename);
+FLINT_DLL int flint_tune_save(const char * filename);
+
+/*
+   Statistics on the algorithms chosen by the dispatchers, see stats.c.
+   They are only recorded if FLINT is configured with --enable-stats.
+*/
+typedef enum
+{
+   FLINT_STATS_FMPZ_POLY_MUL_TINY = 0,
+   FLINT_STATS_FMPZ_POLY_MUL_CLASSICAL,
+   FLINT_STATS_FMPZ_POLY_MUL_KARATSUBA,
+   FLINT_STATS_FMPZ_POLY_MUL_KS,
+   FLINT_STATS_FMPZ_POLY_MUL_SS,
+   FLINT_STATS_NMOD_POLY_MUL_CLASSICAL,
+   FLINT_STATS_NMOD_POLY_MUL_KS,
+   FLINT_STATS_NMOD_POLY_MUL_KS2,
+   FLINT_STATS_NMOD_POLY_MUL_KS4,
+   FLINT_STATS_NMOD_POLY_MUL_NTT,
+   FLINT_STATS_NMOD_POLY_GCD_EUCLIDEAN,
+   FLINT_STATS_NMOD_POLY_GCD_HGCD,
+   FLINT_STATS_FMPZ_MAT_MUL_CLASSICAL,
+   FLINT_STATS_FMPZ_MAT_MUL_CLASSICAL_INLINE,
+   FLINT_STATS_FMPZ_MAT_MUL_MULTI_MOD,
+   FLINT_STATS_NMOD_MAT_MUL_CLASSICAL,
+   FLINT_STATS_NMOD_MAT_MUL_STRASSEN,
+   FLINT_STATS_NMOD_MAT_MUL_THREADED,
+   FLINT_STATS_NUM
+} flint_stats_algo;
+
+/* Entry i of a histogram counts the calls with FLINT_BIT_COUNT(x) == i */
+typedef struct
+{
+   ulong calls;
+   ulong ticks;
+   ulong len_hist[FLINT_BITS + 1];
+   ulong bits_hist[FLINT_BITS + 1];
+} flint_stats_struct;
+
+typedef flint_stats_struct flint_stats_t[1];
+
+FLINT_DLL ulong _flint_stats_ticks(void);
+FLINT_DLL ulong _flint_stats_nested_ticks(void);
+FLINT_DLL void _flint_stats_record(flint_stats_algo algo, ulong len,
+                               ulong bits, ulong ticks, ulong nested0);
+FLINT_DLL void _flint_stats_flush(void);
+FLINT_DLL void flint_stats_get(flint_stats_t stats, flint_stats_algo algo);
+FLINT_DLL void flint_stats_reset(void);
+FLINT_DLL const char * flint_stats_name(flint_stats_algo algo);
+FLINT_DLL void flint_stats_fprint(FILE * file);
+
+#if WANT_STATS
+#define FLINT_STATS_CALL(algo, len, bits, call)                      \
+   do {                                                              \
+      ulong _flint_stats_n0 = _flint_stats_nested_ticks();           \
+      ulong _flint_stats_t0 = _flint_stats_ticks();                  \
+      call;                                                          \
+      _flint_stats_record(algo, len, bits,                           \
+         _flint_stats_ticks() - _flint_stats_t0, _flint_stats_n0);   \
+   } while (0)
+#else
+#define FLINT_STATS_CALL(algo, len, bits, call) do { call; } while (0)
+#endif
+
 typedef struct
 {
     gmp_randstate_t gmp_state;
@@ -322,6 +322,15 @@ FLINT_DLL int _fmpq_reconstruct_fmpz_2(fmpz_t n, fmpz_t d,
 FLINT_DLL int fmpq_reconstruct_fmpz_2(fmpq_t res, const fmpz_t a, const fmpz_t m,
                                         const fmpz_t N, const fmpz_t D);
 
+FLINT_DLL int _fmpq_reconstruct_fmpz_2_naive(fmpz_t n, fmpz_t d,
+    const fmpz_t a, const fmpz_t m, const fmpz_t N, const fmpz_t D);
+
+FLINT_DLL int _fmpq_reconstruct_fmpz_2_hgcd(fmpz_t n, fmpz_t d,
+    const fmpz_t a, const fmpz_t m, const fmpz_t N, const fmpz_t D);
+
+/* Bits of the modulus from which rational reconstruction uses half-gcd */
+#define FMPQ_RECONSTRUCT_HGCD_CUTOFF 1000
+
 FLINT_DLL mp_bitcnt_t fmpq_height_bits(const fmpq_t x);
 
 FLINT_DLL void fmpq_height(fmpz_t height, const fmpq_t x);
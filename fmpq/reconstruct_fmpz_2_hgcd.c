@@ -0,0 +1,279 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fmpq.h"
+
+/*
+   A product M = Q(q_1) ... Q(q_k) of the matrices Q(q) = [[q, 1], [1, 0]]
+   of a run of the Euclidean algorithm, together with the quotients, so
+   that the last steps can be undone. If (a, b) = M (x, y) with x > y > 0
+   and all q_i >= 1, then q_1, ..., q_k are the first quotients of a/b
+   and x, y are the remainders following them.
+*/
+typedef struct
+{
+    fmpz_t m11, m12, m21, m22;
+    int sign;   /* determinant of M */
+    fmpz * q;
+    slong len;
+    slong alloc;
+}
+_cf_mat_struct;
+
+typedef _cf_mat_struct _cf_mat_t[1];
+
+static void
+_cf_mat_init(_cf_mat_t M)
+{
+    fmpz_init_set_ui(M->m11, 1);
+    fmpz_init(M->m12);
+    fmpz_init(M->m21);
+    fmpz_init_set_ui(M->m22, 1);
+    M->sign = 1;
+    M->q = NULL;
+    M->len = 0;
+    M->alloc = 0;
+}
+
+static void
+_cf_mat_clear(_cf_mat_t M)
+{
+    fmpz_clear(M->m11);
+    fmpz_clear(M->m12);
+    fmpz_clear(M->m21);
+    fmpz_clear(M->m22);
+    if (M->q != NULL)
+        _fmpz_vec_clear(M->q, M->alloc);
+}
+
+static void
+_cf_mat_fit_length(_cf_mat_t M, slong len)
+{
+    slong i;
+
+    if (len > M->alloc)
+    {
+        slong alloc = FLINT_MAX(len, 2 * M->alloc);
+
+        M->q = flint_realloc(M->q, alloc * sizeof(fmpz));
+        for (i = M->alloc; i < alloc; i++)
+            fmpz_init(M->q + i);
+        M->alloc = alloc;
+    }
+}
+
+/* M = M Q(q) */
+static void
+_cf_mat_push(_cf_mat_t M, const fmpz_t q)
+{
+    _cf_mat_fit_length(M, M->len + 1);
+    fmpz_set(M->q + M->len, q);
+    M->len++;
+
+    fmpz_addmul(M->m12, q, M->m11);
+    fmpz_swap(M->m11, M->m12);
+    fmpz_addmul(M->m22, q, M->m21);
+    fmpz_swap(M->m21, M->m22);
+    M->sign = -M->sign;
+}
+
+/* M = M Q(q)^(-1), where q is the last quotient, which is returned */
+static void
+_cf_mat_pop(fmpz_t q, _cf_mat_t M)
+{
+    M->len--;
+    fmpz_swap(q, M->q + M->len);
+
+    fmpz_submul(M->m11, q, M->m12);
+    fmpz_swap(M->m11, M->m12);
+    fmpz_submul(M->m21, q, M->m22);
+    fmpz_swap(M->m21, M->m22);
+    M->sign = -M->sign;
+}
+
+/* M = M N, appending the quotients of N */
+static void
+_cf_mat_mul(_cf_mat_t M, const _cf_mat_t N, fmpz_t t)
+{
+    slong i;
+
+    fmpz_mul(t, M->m11, N->m12);
+    fmpz_addmul(t, M->m12, N->m22);
+    fmpz_mul(M->m11, M->m11, N->m11);
+    fmpz_addmul(M->m11, M->m12, N->m21);
+    fmpz_swap(M->m12, t);
+
+    fmpz_mul(t, M->m21, N->m12);
+    fmpz_addmul(t, M->m22, N->m22);
+    fmpz_mul(M->m21, M->m21, N->m11);
+    fmpz_addmul(M->m21, M->m22, N->m21);
+    fmpz_swap(M->m22, t);
+
+    M->sign *= N->sign;
+
+    _cf_mat_fit_length(M, M->len + N->len);
+    for (i = 0; i < N->len; i++)
+        fmpz_set(M->q + M->len + i, N->q + i);
+    M->len += N->len;
+}
+
+/*
+   Given a > b > N >= 0, runs the Euclidean algorithm on (a, b) until the
+   second remainder of the pair is at most N, multiplying M on the right
+   by the matrices of the steps. The quotients for the leading bits are
+   found recursively from the top 2d + 2 bits of a and b, which determine
+   about d of them, and checked against the full remainders; steps past
+   the first wrong quotient are undone.
+*/
+static void
+_fmpq_reconstruct_hgcd_reduce(_cf_mat_t M, fmpz_t a, fmpz_t b,
+                                                           const fmpz_t N)
+{
+    _cf_mat_t M1;
+    fmpz_t a1, b1, N1, q, t;
+    mp_bitcnt_t n, g, d, p;
+
+    fmpz_init(a1);
+    fmpz_init(b1);
+    fmpz_init(N1);
+    fmpz_init(q);
+    fmpz_init(t);
+
+    while (fmpz_cmp(b, N) > 0)
+    {
+        n = fmpz_bits(a);
+        g = n - fmpz_bits(N);
+
+        if (n < FMPQ_RECONSTRUCT_HGCD_CUTOFF || g < FLINT_BITS)
+        {
+            do
+            {
+                fmpz_fdiv_qr(q, t, a, b);
+                _cf_mat_push(M, q);
+                fmpz_swap(a, b);
+                fmpz_swap(b, t);
+            } while (fmpz_cmp(b, N) > 0);
+
+            break;
+        }
+
+        d = (FLINT_MIN(g, n / 2) + 1) / 2;
+        p = n - 2 * d - 2;
+
+        fmpz_fdiv_q_2exp(a1, a, p);
+        fmpz_fdiv_q_2exp(b1, b, p);
+        fmpz_one(N1);
+        fmpz_mul_2exp(N1, N1, d + 2);
+
+        _cf_mat_init(M1);
+
+        if (fmpz_cmp(a1, b1) > 0 && fmpz_cmp(b1, N1) > 0)
+            _fmpq_reconstruct_hgcd_reduce(M1, a1, b1, N1);
+
+        /* (a1, b1) = M1^(-1) (a, b) */
+        fmpz_mul(a1, M1->m22, a);
+        fmpz_submul(a1, M1->m12, b);
+        fmpz_mul(b1, M1->m11, b);
+        fmpz_submul(b1, M1->m21, a);
+        if (M1->sign < 0)
+        {
+            fmpz_neg(a1, a1);
+            fmpz_neg(b1, b1);
+        }
+
+        while (M1->len > 0 &&
+               (fmpz_cmp(a1, b1) <= 0 || fmpz_cmp(b1, N) <= 0))
+        {
+            _cf_mat_pop(q, M1);
+            fmpz_addmul(b1, q, a1);
+            fmpz_swap(a1, b1);
+        }
+
+        if (M1->len == 0)
+        {
+            /* no quotient could be found from the top bits */
+            fmpz_fdiv_qr(q, t, a, b);
+            _cf_mat_push(M, q);
+            fmpz_swap(a, b);
+            fmpz_swap(b, t);
+        }
+        else
+        {
+            _cf_mat_mul(M, M1, t);
+            fmpz_swap(a, a1);
+            fmpz_swap(b, b1);
+        }
+
+        _cf_mat_clear(M1);
+    }
+
+    fmpz_clear(a1);
+    fmpz_clear(b1);
+    fmpz_clear(N1);
+    fmpz_clear(q);
+    fmpz_clear(t);
+}
+
+int
+_fmpq_reconstruct_fmpz_2_hgcd(fmpz_t n, fmpz_t d,
+    const fmpz_t a, const fmpz_t m, const fmpz_t N, const fmpz_t D)
+{
+    _cf_mat_t M;
+    fmpz_t r0, r1;
+    int success = 0;
+
+    if (fmpz_cmp(a, N) <= 0)
+    {
+        fmpz_set(n, a);
+        fmpz_one(d);
+        return 1;
+    }
+
+    fmpz_init_set(r0, m);
+    fmpz_init_set(r1, a);
+    _cf_mat_init(M);
+
+    _fmpq_reconstruct_hgcd_reduce(M, r0, r1, N);
+
+    /* r1 = sign (m11 a - m21 m), so that r1 = sign m11 a mod m */
+    if (M->sign < 0)
+        fmpz_neg(d, M->m11);
+    else
+        fmpz_set(d, M->m11);
+    fmpz_set(n, r1);
+
+    if (fmpz_sgn(d) < 0)
+    {
+        fmpz_neg(n, n);
+        fmpz_neg(d, d);
+    }
+
+    if (fmpz_cmp(d, D) <= 0)
+    {
+        fmpz_gcd(r0, n, d);
+        success = fmpz_is_one(r0);
+    }
+
+    _cf_mat_clear(M);
+    fmpz_clear(r0);
+    fmpz_clear(r1);
+
+    return success;
+}
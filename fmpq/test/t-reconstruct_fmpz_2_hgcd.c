@@ -0,0 +1,124 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpq.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("reconstruct_fmpz_2_hgcd....");
+    fflush(stdout);
+
+    for (i = 0; i < 300 * flint_test_multiplier(); i++)
+    {
+        int result1, result2;
+        fmpq_t x;
+        fmpz_t mod, res, N, D, n1, d1, n2, d2;
+        mp_bitcnt_t bits;
+
+        fmpq_init(x);
+        fmpz_init(mod);
+        fmpz_init(res);
+        fmpz_init(N);
+        fmpz_init(D);
+        fmpz_init(n1);
+        fmpz_init(d1);
+        fmpz_init(n2);
+        fmpz_init(d2);
+
+        bits = n_randint(state, 3) ? n_randint(state, 3000) + 2
+                                   : n_randint(state, 12000) + 2;
+
+        /* a random modulus and bounds with 2ND < m */
+        fmpz_randtest_unsigned(mod, state, bits);
+        fmpz_add_ui(mod, mod, 3);
+        fmpz_fdiv_q_2exp(N, mod, n_randint(state, fmpz_bits(mod) - 1) + 2);
+        fmpz_add_ui(N, N, 1);
+        fmpz_mul_2exp(n1, N, 1);
+        if (fmpz_cmp(n1, mod) >= 0)
+            fmpz_one(N);
+        fmpz_sub_ui(D, mod, 1);
+        fmpz_mul_2exp(n1, N, 1);
+        fmpz_fdiv_q(D, D, n1);
+        if (n_randint(state, 3) == 0)
+            fmpz_fdiv_q_2exp(D, D, n_randint(state, fmpz_bits(D)));
+        if (fmpz_is_zero(D))
+            fmpz_one(D);
+
+        /* either a random residue or the image of a small fraction */
+        if (n_randint(state, 2))
+        {
+            fmpz_randm(res, state, mod);
+        }
+        else
+        {
+            fmpz_randm(fmpq_numref(x), state, N);
+            if (n_randint(state, 2))
+                fmpz_neg(fmpq_numref(x), fmpq_numref(x));
+            fmpz_randm(fmpq_denref(x), state, D);
+            fmpz_add_ui(fmpq_denref(x), fmpq_denref(x), 1);
+            fmpq_canonicalise(x);
+            if (!fmpq_mod_fmpz(res, x, mod))
+                fmpz_randm(res, state, mod);
+        }
+
+        result1 = _fmpq_reconstruct_fmpz_2_naive(n1, d1, res, mod, N, D);
+        result2 = _fmpq_reconstruct_fmpz_2_hgcd(n2, d2, res, mod, N, D);
+
+        if (result1 != result2 || (result1 &&
+                (!fmpz_equal(n1, n2) || !fmpz_equal(d1, d2))))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("modulus = "); fmpz_print(mod); flint_printf("\n");
+            flint_printf("residue = "); fmpz_print(res); flint_printf("\n");
+            flint_printf("N = "); fmpz_print(N); flint_printf("\n");
+            flint_printf("D = "); fmpz_print(D); flint_printf("\n");
+            flint_printf("naive: %d ", result1);
+            fmpz_print(n1); flint_printf(" / "); fmpz_print(d1);
+            flint_printf("\nhgcd: %d ", result2);
+            fmpz_print(n2); flint_printf(" / "); fmpz_print(d2);
+            flint_printf("\n");
+            abort();
+        }
+
+        fmpq_clear(x);
+        fmpz_clear(mod);
+        fmpz_clear(res);
+        fmpz_clear(N);
+        fmpz_clear(D);
+        fmpz_clear(n1);
+        fmpz_clear(d1);
+        fmpz_clear(n2);
+        fmpz_clear(d2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
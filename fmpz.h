@@ -67,6 +67,44 @@ typedef struct
 
 typedef fmpz_preinvn_struct fmpz_preinvn_t[1];
 
+typedef struct
+{
+   fmpz m;           /* the modulus, odd and greater than one */
+   mp_ptr n;         /* limbs of the modulus */
+   mp_ptr r2;        /* R^2 mod n, where R = 2^(size*FLINT_BITS) */
+   mp_ptr one;       /* R mod n, the Montgomery form of 1 */
+   mp_ptr t;         /* 2*size limbs of scratch for products */
+   mp_ptr w;         /* scratch for the table of _fmpz_mont_powm */
+   mp_size_t size;
+   mp_limb_t ninv;   /* -1/n mod 2^FLINT_BITS */
+} fmpz_mont_struct;
+
+typedef fmpz_mont_struct fmpz_mont_t[1];
+
+/* Largest window used by _fmpz_mont_powm, which needs a table of
+   2^(FMPZ_MONT_MAX_WINDOW - 1) odd powers */
+#define FMPZ_MONT_MAX_WINDOW 5
+
+/* Largest modulus, in limbs, for which fmpz_lucas_chain works in
+   Montgomery form rather than dividing after each product */
+#define FMPZ_LUCAS_CHAIN_MONT_CUTOFF 64
+
+typedef struct
+{
+   ulong allocated;    /* mpz structs allocated from the heap */
+   ulong reused;       /* mpz structs taken from the pool */
+   ulong released;     /* mpz structs returned to the pool */
+   ulong shrunk;       /* released mpz structs whose limbs were freed */
+   ulong cached;       /* mpz structs currently held by the pool */
+   ulong cached_limbs; /* limbs currently held by the pool */
+} fmpz_pool_stats_struct;
+
+typedef fmpz_pool_stats_struct fmpz_pool_stats_t[1];
+
+/* Default policy of the mpz pool, see fmpz_pool_set_policy */
+#define FMPZ_POOL_MAX_LIMBS 1024
+#define FMPZ_POOL_MAX_TOTAL_LIMBS (UWORD(1) << 20)
+
 /* maximum positive value a small coefficient can have */
 #define COEFF_MAX ((WORD(1) << (FLINT_BITS - 2)) - WORD(1))
 
@@ -83,6 +121,19 @@ FLINT_DLL void _fmpz_cleanup_mpz_content(void);
 
 FLINT_DLL void _fmpz_cleanup(void);
 
+FLINT_DLL void fmpz_pool_set_policy(ulong max_limbs, ulong max_total_limbs);
+
+FLINT_DLL void fmpz_pool_get_policy(ulong * max_limbs,
+                                                    ulong * max_total_limbs);
+
+FLINT_DLL void fmpz_pool_get_stats(fmpz_pool_stats_t stats);
+
+FLINT_DLL void fmpz_pool_reset_stats(void);
+
+FLINT_DLL void fmpz_pool_reserve(ulong num, ulong limbs);
+
+FLINT_DLL void fmpz_pool_trim(ulong max_total_limbs);
+
 __mpz_struct * _fmpz_promote(fmpz_t f);
 
 __mpz_struct * _fmpz_promote_val(fmpz_t f);
@@ -437,6 +488,10 @@ FLINT_DLL void fmpz_mul_si(fmpz_t f, const fmpz_t g, slong x);
 
 FLINT_DLL void fmpz_mul(fmpz_t f, const fmpz_t g, const fmpz_t h);
 
+/* Limbs in each operand from which fmpz_mul uses the threaded FFT when
+   more than one thread is available */
+#define FMPZ_MUL_FFT_THREADED_CUTOFF 32768
+
 FLINT_DLL void fmpz_mul_2exp(fmpz_t f, const fmpz_t g, ulong exp);
 
 FLINT_DLL void fmpz_add_ui(fmpz_t f, const fmpz_t g, ulong x);
@@ -578,6 +633,29 @@ FLINT_DLL void fmpz_preinvn_init(fmpz_preinvn_t inv, fmpz_t f);
 
 FLINT_DLL void fmpz_preinvn_clear(fmpz_preinvn_t inv);
 
+FLINT_DLL void fmpz_mont_init(fmpz_mont_t ctx, const fmpz_t n);
+
+FLINT_DLL void fmpz_mont_clear(fmpz_mont_t ctx);
+
+FLINT_DLL void _fmpz_mont_redc(mp_ptr r, mp_ptr t, const fmpz_mont_t ctx);
+
+FLINT_DLL void _fmpz_mont_mul(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                                                         fmpz_mont_t ctx);
+
+FLINT_DLL void _fmpz_mont_set_fmpz(mp_ptr r, const fmpz_t a,
+                                                         fmpz_mont_t ctx);
+
+FLINT_DLL void _fmpz_mont_get_fmpz(fmpz_t f, mp_srcptr a, fmpz_mont_t ctx);
+
+FLINT_DLL void _fmpz_mont_powm(mp_ptr r, mp_srcptr a, mp_srcptr e,
+                                        mp_size_t elen, fmpz_mont_t ctx);
+
+FLINT_DLL void fmpz_powm_mont(fmpz_t f, const fmpz_t g, const fmpz_t e,
+                                                         fmpz_mont_t ctx);
+
+FLINT_DLL void _fmpz_mont_lucas_chain(mp_ptr Vm, mp_ptr Vm1, mp_srcptr A,
+                                       const fmpz_t m, fmpz_mont_t ctx);
+
 FLINT_DLL double fmpz_get_d_2exp(slong * exp, const fmpz_t f);
 
 FMPZ_INLINE void
@@ -731,6 +809,9 @@ FLINT_DLL int fmpz_is_probabprime_lucas(const fmpz_t n);
 
 FLINT_DLL int fmpz_is_probabprime_BPSW(const fmpz_t n);
 
+FLINT_DLL void fmpz_is_probabprime_BPSW_vec(int * res, const fmpz * vec,
+                                                                 slong len);
+
 FLINT_DLL int fmpz_is_strong_probabprime(const fmpz_t n, const fmpz_t a);
 
 FLINT_DLL int fmpz_is_probabprime(const fmpz_t p);
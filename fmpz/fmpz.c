@@ -0,0 +1,284 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2009 William Hart
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+/*
+   Released mpz's are cached in size classes, class i holding those with
+   between 2^i and 2^(i + 1) - 1 allocated limbs (class 0 also holds
+   those with no limbs allocated).
+*/
+#define FMPZ_POOL_CLASSES (FLINT_BITS / 2)
+
+typedef struct
+{
+    __mpz_struct ** arr;
+    ulong num;
+    ulong alloc;
+} mpz_pool_class_struct;
+
+/* The policy is shared by all threads */
+static ulong mpz_pool_max_limbs = FMPZ_POOL_MAX_LIMBS;
+static ulong mpz_pool_max_total_limbs = FMPZ_POOL_MAX_TOTAL_LIMBS;
+
+FLINT_TLS_PREFIX mpz_pool_class_struct mpz_pool[FMPZ_POOL_CLASSES];
+FLINT_TLS_PREFIX ulong mpz_pool_mask = 0; /* bit i set if class i nonempty */
+FLINT_TLS_PREFIX fmpz_pool_stats_struct mpz_pool_stats;
+
+static void _fmpz_pool_push(__mpz_struct * z)
+{
+    mpz_pool_class_struct * c;
+    slong i;
+
+    i = FLINT_BIT_COUNT((ulong) z->_mp_alloc | UWORD(1)) - 1;
+    c = mpz_pool + i;
+
+    if (c->num == c->alloc)
+    {
+        c->alloc = FLINT_MAX(64, c->alloc * 2);
+        c->arr = flint_realloc(c->arr, c->alloc * sizeof(__mpz_struct *));
+    }
+
+    c->arr[c->num++] = z;
+    mpz_pool_mask |= (UWORD(1) << i);
+
+    mpz_pool_stats.cached++;
+    mpz_pool_stats.cached_limbs += z->_mp_alloc;
+}
+
+static __mpz_struct * _fmpz_pool_pop(slong i)
+{
+    mpz_pool_class_struct * c = mpz_pool + i;
+    __mpz_struct * z = c->arr[--c->num];
+
+    if (c->num == 0)
+        mpz_pool_mask &= ~(UWORD(1) << i);
+
+    mpz_pool_stats.cached--;
+    mpz_pool_stats.cached_limbs -= z->_mp_alloc;
+
+    return z;
+}
+
+__mpz_struct * _fmpz_new_mpz(void)
+{
+    if (mpz_pool_mask != 0)
+    {
+        /* values tend to grow once promoted, so take the largest */
+        mpz_pool_stats.reused++;
+        return _fmpz_pool_pop(FLINT_BIT_COUNT(mpz_pool_mask) - 1);
+    }
+    else
+    {
+        __mpz_struct * z = flint_malloc(sizeof(__mpz_struct));
+        mpz_init(z);
+        mpz_pool_stats.allocated++;
+        return z;
+    }
+}
+
+void _fmpz_clear_mpz(fmpz f)
+{
+    __mpz_struct * ptr = COEFF_TO_PTR(f);
+    ulong alloc = ptr->_mp_alloc;
+
+    /* free the limbs of mpz's the policy does not allow us to keep */
+    if (alloc > 1 && (alloc > mpz_pool_max_limbs ||
+            mpz_pool_stats.cached_limbs + alloc > mpz_pool_max_total_limbs))
+    {
+        mpz_realloc2(ptr, 1);
+        mpz_pool_stats.shrunk++;
+    }
+
+    mpz_pool_stats.released++;
+    _fmpz_pool_push(ptr);
+}
+
+void _fmpz_cleanup_mpz_content(void)
+{
+    slong i;
+    ulong j;
+
+    for (i = 0; i < FMPZ_POOL_CLASSES; i++)
+    {
+        for (j = 0; j < mpz_pool[i].num; j++)
+        {
+            mpz_clear(mpz_pool[i].arr[j]);
+            flint_free(mpz_pool[i].arr[j]);
+        }
+
+        mpz_pool[i].num = 0;
+    }
+
+    mpz_pool_mask = 0;
+    mpz_pool_stats.cached = 0;
+    mpz_pool_stats.cached_limbs = 0;
+}
+
+void _fmpz_cleanup(void)
+{
+    slong i;
+
+    _fmpz_cleanup_mpz_content();
+
+    for (i = 0; i < FMPZ_POOL_CLASSES; i++)
+    {
+        flint_free(mpz_pool[i].arr);
+        mpz_pool[i].arr = NULL;
+        mpz_pool[i].alloc = 0;
+    }
+}
+
+void fmpz_pool_set_policy(ulong max_limbs, ulong max_total_limbs)
+{
+    mpz_pool_max_limbs = max_limbs;
+    mpz_pool_max_total_limbs = max_total_limbs;
+}
+
+void fmpz_pool_get_policy(ulong * max_limbs, ulong * max_total_limbs)
+{
+    *max_limbs = mpz_pool_max_limbs;
+    *max_total_limbs = mpz_pool_max_total_limbs;
+}
+
+void fmpz_pool_get_stats(fmpz_pool_stats_t stats)
+{
+    *stats = mpz_pool_stats;
+}
+
+void fmpz_pool_reset_stats(void)
+{
+    mpz_pool_stats.allocated = 0;
+    mpz_pool_stats.reused = 0;
+    mpz_pool_stats.released = 0;
+    mpz_pool_stats.shrunk = 0;
+}
+
+void fmpz_pool_reserve(ulong num, ulong limbs)
+{
+    __mpz_struct * z;
+    ulong i;
+
+    limbs = FLINT_MAX(limbs, 1);
+
+    for (i = 0; i < num; i++)
+    {
+        if (limbs > mpz_pool_max_limbs || mpz_pool_stats.cached_limbs
+                                    + limbs > mpz_pool_max_total_limbs)
+            break;
+
+        z = flint_malloc(sizeof(__mpz_struct));
+        mpz_init2(z, limbs * FLINT_BITS);
+        mpz_pool_stats.allocated++;
+        _fmpz_pool_push(z);
+    }
+}
+
+void fmpz_pool_trim(ulong max_total_limbs)
+{
+    __mpz_struct * z;
+
+    /* release the largest first */
+    while (mpz_pool_mask != 0 && (max_total_limbs == 0 ||
+                        mpz_pool_stats.cached_limbs > max_total_limbs))
+    {
+        z = _fmpz_pool_pop(FLINT_BIT_COUNT(mpz_pool_mask) - 1);
+        mpz_clear(z);
+        flint_free(z);
+    }
+}
+
+__mpz_struct * _fmpz_promote(fmpz_t f)
+{
+    if (!COEFF_IS_MPZ(*f)) /* f is small so promote it first */
+    {
+        __mpz_struct * mpz_ptr = _fmpz_new_mpz();
+        (*f) = PTR_TO_COEFF(mpz_ptr);
+        return mpz_ptr;
+    }
+    else /* f is large already, just return the pointer */
+        return COEFF_TO_PTR(*f);
+}
+
+__mpz_struct * _fmpz_promote_val(fmpz_t f)
+{
+    fmpz c = (*f);
+    if (!COEFF_IS_MPZ(c)) /* f is small so promote it */
+    {
+        __mpz_struct * mpz_ptr = _fmpz_new_mpz();
+        (*f) = PTR_TO_COEFF(mpz_ptr);
+        flint_mpz_set_si(mpz_ptr, c);
+        return mpz_ptr;
+    }
+    else /* f is large already, just return the pointer */
+        return COEFF_TO_PTR(c);
+}
+
+void _fmpz_demote_val(fmpz_t f)
+{
+    __mpz_struct * mpz_ptr = COEFF_TO_PTR(*f);
+    int size = mpz_ptr->_mp_size;
+
+    if (size == 1 || size == -1)
+    {
+        ulong uval = mpz_ptr->_mp_d[0];
+
+        if (uval <= (ulong) COEFF_MAX)
+        {
+            _fmpz_clear_mpz(*f);
+            *f = size * (fmpz) uval;
+        }
+    }
+    else if (size == 0)  /* value is 0 */
+    {
+        _fmpz_clear_mpz(*f);
+        *f = 0;
+    }
+
+    /* don't do anything if value has to be multi precision */
+}
+
+void _fmpz_init_readonly_mpz(fmpz_t f, const mpz_t z)
+{
+   __mpz_struct *ptr;
+   *f = WORD(0);
+   ptr = _fmpz_promote(f);
+
+   mpz_clear(ptr);
+   *ptr = *z;
+}
+
+void _fmpz_clear_readonly_mpz(mpz_t z)
+{
+    if (((z->_mp_size == 1 || z->_mp_size == -1) && (z->_mp_d[0] <= COEFF_MAX))
+        || (z->_mp_size == 0))
+    {
+        mpz_clear(z);
+    }
+
+}
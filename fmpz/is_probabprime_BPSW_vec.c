@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "thread_pool.h"
+#include "fmpz.h"
+
+typedef struct
+{
+   int * res;
+   const fmpz * vec;
+   slong start;
+   slong stop;
+} fmpz_bpsw_arg_t;
+
+static void
+_fmpz_is_probabprime_BPSW_range(fmpz_bpsw_arg_t * arg)
+{
+   slong i;
+
+   for (i = arg->start; i < arg->stop; i++)
+      arg->res[i] = fmpz_is_probabprime_BPSW(arg->vec + i);
+}
+
+static void
+_fmpz_is_probabprime_BPSW_worker(void * arg_ptr)
+{
+   _fmpz_is_probabprime_BPSW_range((fmpz_bpsw_arg_t *) arg_ptr);
+}
+
+void fmpz_is_probabprime_BPSW_vec(int * res, const fmpz * vec, slong len)
+{
+   slong i, num_threads, num_workers;
+   int max_threads = flint_get_num_threads();
+   fmpz_bpsw_arg_t * args;
+   thread_pool_handle * threads;
+
+   num_workers = flint_request_threads(&threads, len);
+   num_threads = num_workers + 1;
+
+   if (num_threads <= 1)
+   {
+      flint_give_back_threads(threads, num_workers);
+
+      for (i = 0; i < len; i++)
+         res[i] = fmpz_is_probabprime_BPSW(vec + i);
+      return;
+   }
+
+   args = flint_malloc(num_threads*sizeof(fmpz_bpsw_arg_t));
+
+   for (i = 0; i < num_threads; i++)
+   {
+      args[i].res = res;
+      args[i].vec = vec;
+      args[i].start = (i*len)/num_threads;
+      args[i].stop = ((i + 1)*len)/num_threads;
+   }
+
+   for (i = 1; i < num_threads; i++)
+      thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                       _fmpz_is_probabprime_BPSW_worker, &args[i]);
+
+   /* Do the first range in this thread, without nested threads */
+   _flint_set_num_workers(0);
+   _fmpz_is_probabprime_BPSW_range(args);
+   _flint_set_num_workers(max_threads - 1);
+
+   for (i = 1; i < num_threads; i++)
+      thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+   flint_give_back_threads(threads, num_workers);
+
+   flint_free(args);
+}
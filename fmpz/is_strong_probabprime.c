@@ -64,7 +64,7 @@ int fmpz_is_strong_probabprime(const fmpz_t n, const fmpz_t base)
 
       fmpz_init(y);
 
-      while (!fmpz_tstbit(n, s))
+      while (!fmpz_tstbit(nm1, s))
          s++;
 
       fmpz_tdiv_q_2exp(t, t, s);
@@ -49,6 +49,48 @@ void _fmpz_cleanup(void)
 {
 }
 
+/*
+   There is no mpz pool in reentrant mode. The pool policy is recorded
+   but has no effect, the statistics stay zero and reserving or trimming
+   does nothing.
+*/
+static ulong mpz_pool_max_limbs = FMPZ_POOL_MAX_LIMBS;
+static ulong mpz_pool_max_total_limbs = FMPZ_POOL_MAX_TOTAL_LIMBS;
+
+void fmpz_pool_set_policy(ulong max_limbs, ulong max_total_limbs)
+{
+    mpz_pool_max_limbs = max_limbs;
+    mpz_pool_max_total_limbs = max_total_limbs;
+}
+
+void fmpz_pool_get_policy(ulong * max_limbs, ulong * max_total_limbs)
+{
+    *max_limbs = mpz_pool_max_limbs;
+    *max_total_limbs = mpz_pool_max_total_limbs;
+}
+
+void fmpz_pool_get_stats(fmpz_pool_stats_t stats)
+{
+    stats->allocated = 0;
+    stats->reused = 0;
+    stats->released = 0;
+    stats->shrunk = 0;
+    stats->cached = 0;
+    stats->cached_limbs = 0;
+}
+
+void fmpz_pool_reset_stats(void)
+{
+}
+
+void fmpz_pool_reserve(ulong num, ulong limbs)
+{
+}
+
+void fmpz_pool_trim(ulong max_total_limbs)
+{
+}
+
 __mpz_struct * _fmpz_promote(fmpz_t f)
 {
     if (!COEFF_IS_MPZ(*f))  /* f is small so promote it first */
@@ -28,26 +28,76 @@
 #include "flint.h"
 #include "fmpz.h"
 
-/* Always free larger mpz's to avoid wasting too much heap space */
-#define FLINT_MPZ_MAX_CACHE_LIMBS 64
+/*
+   Released mpz's are cached in size classes, class i holding those with
+   between 2^i and 2^(i + 1) - 1 allocated limbs (class 0 also holds
+   those with no limbs allocated).
+*/
+#define FMPZ_POOL_CLASSES (FLINT_BITS / 2)
 
-/* The number of new mpz's allocated at a time */
-#define MPZ_BLOCK 64 
+typedef struct
+{
+    __mpz_struct ** arr;
+    ulong num;
+    ulong alloc;
+} mpz_pool_class_struct;
+
+/* The policy is shared by all threads */
+static ulong mpz_pool_max_limbs = FMPZ_POOL_MAX_LIMBS;
+static ulong mpz_pool_max_total_limbs = FMPZ_POOL_MAX_TOTAL_LIMBS;
+
+FLINT_TLS_PREFIX mpz_pool_class_struct mpz_pool[FMPZ_POOL_CLASSES];
+FLINT_TLS_PREFIX ulong mpz_pool_mask = 0; /* bit i set if class i nonempty */
+FLINT_TLS_PREFIX fmpz_pool_stats_struct mpz_pool_stats;
+
+static void _fmpz_pool_push(__mpz_struct * z)
+{
+    mpz_pool_class_struct * c;
+    slong i;
+
+    i = FLINT_BIT_COUNT((ulong) z->_mp_alloc | UWORD(1)) - 1;
+    c = mpz_pool + i;
+
+    if (c->num == c->alloc)
+    {
+        c->alloc = FLINT_MAX(64, c->alloc * 2);
+        c->arr = flint_realloc(c->arr, c->alloc * sizeof(__mpz_struct *));
+    }
+
+    c->arr[c->num++] = z;
+    mpz_pool_mask |= (UWORD(1) << i);
+
+    mpz_pool_stats.cached++;
+    mpz_pool_stats.cached_limbs += z->_mp_alloc;
+}
+
+static __mpz_struct * _fmpz_pool_pop(slong i)
+{
+    mpz_pool_class_struct * c = mpz_pool + i;
+    __mpz_struct * z = c->arr[--c->num];
 
-FLINT_TLS_PREFIX __mpz_struct ** mpz_free_arr = NULL;
-FLINT_TLS_PREFIX ulong mpz_free_num = 0;
-FLINT_TLS_PREFIX ulong mpz_free_alloc = 0;
+    if (c->num == 0)
+        mpz_pool_mask &= ~(UWORD(1) << i);
+
+    mpz_pool_stats.cached--;
+    mpz_pool_stats.cached_limbs -= z->_mp_alloc;
+
+    return z;
+}
 
 __mpz_struct * _fmpz_new_mpz(void)
 {
-    if (mpz_free_num != 0)
+    if (mpz_pool_mask != 0)
     {
-        return mpz_free_arr[--mpz_free_num];
+        /* values tend to grow once promoted, so take the largest */
+        mpz_pool_stats.reused++;
+        return _fmpz_pool_pop(FLINT_BIT_COUNT(mpz_pool_mask) - 1);
     }
     else
     {
         __mpz_struct * z = flint_malloc(sizeof(__mpz_struct));
         mpz_init(z);
+        mpz_pool_stats.allocated++;
         return z;
     }
 }
@@ -55,37 +105,112 @@ __mpz_struct * _fmpz_new_mpz(void)
 void _fmpz_clear_mpz(fmpz f)
 {
     __mpz_struct * ptr = COEFF_TO_PTR(f);
+    ulong alloc = ptr->_mp_alloc;
 
-    if (ptr->_mp_alloc > FLINT_MPZ_MAX_CACHE_LIMBS)
-        mpz_realloc2(ptr, 1);
-
-    if (mpz_free_num == mpz_free_alloc)
+    /* free the limbs of mpz's the policy does not allow us to keep */
+    if (alloc > 1 && (alloc > mpz_pool_max_limbs ||
+            mpz_pool_stats.cached_limbs + alloc > mpz_pool_max_total_limbs))
     {
-        mpz_free_alloc = FLINT_MAX(64, mpz_free_alloc * 2);
-        mpz_free_arr = flint_realloc(mpz_free_arr, mpz_free_alloc * sizeof(__mpz_struct *));
+        mpz_realloc2(ptr, 1);
+        mpz_pool_stats.shrunk++;
     }
 
-    mpz_free_arr[mpz_free_num++] = ptr;
+    mpz_pool_stats.released++;
+    _fmpz_pool_push(ptr);
 }
 
 void _fmpz_cleanup_mpz_content(void)
 {
-    ulong i;
+    slong i;
+    ulong j;
 
-    for (i = 0; i < mpz_free_num; i++)
+    for (i = 0; i < FMPZ_POOL_CLASSES; i++)
     {
-        mpz_clear(mpz_free_arr[i]);
-        flint_free(mpz_free_arr[i]);
+        for (j = 0; j < mpz_pool[i].num; j++)
+        {
+            mpz_clear(mpz_pool[i].arr[j]);
+            flint_free(mpz_pool[i].arr[j]);
+        }
+
+        mpz_pool[i].num = 0;
     }
 
-    mpz_free_num = mpz_free_alloc = 0;
+    mpz_pool_mask = 0;
+    mpz_pool_stats.cached = 0;
+    mpz_pool_stats.cached_limbs = 0;
 }
 
 void _fmpz_cleanup(void)
 {
+    slong i;
+
     _fmpz_cleanup_mpz_content();
-    flint_free(mpz_free_arr);
-    mpz_free_arr = NULL;
+
+    for (i = 0; i < FMPZ_POOL_CLASSES; i++)
+    {
+        flint_free(mpz_pool[i].arr);
+        mpz_pool[i].arr = NULL;
+        mpz_pool[i].alloc = 0;
+    }
+}
+
+void fmpz_pool_set_policy(ulong max_limbs, ulong max_total_limbs)
+{
+    mpz_pool_max_limbs = max_limbs;
+    mpz_pool_max_total_limbs = max_total_limbs;
+}
+
+void fmpz_pool_get_policy(ulong * max_limbs, ulong * max_total_limbs)
+{
+    *max_limbs = mpz_pool_max_limbs;
+    *max_total_limbs = mpz_pool_max_total_limbs;
+}
+
+void fmpz_pool_get_stats(fmpz_pool_stats_t stats)
+{
+    *stats = mpz_pool_stats;
+}
+
+void fmpz_pool_reset_stats(void)
+{
+    mpz_pool_stats.allocated = 0;
+    mpz_pool_stats.reused = 0;
+    mpz_pool_stats.released = 0;
+    mpz_pool_stats.shrunk = 0;
+}
+
+void fmpz_pool_reserve(ulong num, ulong limbs)
+{
+    __mpz_struct * z;
+    ulong i;
+
+    limbs = FLINT_MAX(limbs, 1);
+
+    for (i = 0; i < num; i++)
+    {
+        if (limbs > mpz_pool_max_limbs || mpz_pool_stats.cached_limbs
+                                    + limbs > mpz_pool_max_total_limbs)
+            break;
+
+        z = flint_malloc(sizeof(__mpz_struct));
+        mpz_init2(z, limbs * FLINT_BITS);
+        mpz_pool_stats.allocated++;
+        _fmpz_pool_push(z);
+    }
+}
+
+void fmpz_pool_trim(ulong max_total_limbs)
+{
+    __mpz_struct * z;
+
+    /* release the largest first */
+    while (mpz_pool_mask != 0 && (max_total_limbs == 0 ||
+                        mpz_pool_stats.cached_limbs > max_total_limbs))
+    {
+        z = _fmpz_pool_pop(FLINT_BIT_COUNT(mpz_pool_mask) - 1);
+        mpz_clear(z);
+        flint_free(z);
+    }
 }
 
 __mpz_struct * _fmpz_promote(fmpz_t f)
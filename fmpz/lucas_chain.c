@@ -41,6 +41,30 @@ void fmpz_lucas_chain(fmpz_t Vm, fmpz_t Vm1, const fmpz_t A,
     fmpz_t t;
     slong i, B = fmpz_sizeinbase(m, 2);
 
+    if (COEFF_IS_MPZ(*n) && fmpz_sgn(n) > 0 && fmpz_is_odd(n)
+          && COEFF_TO_PTR(*n)->_mp_size <= FMPZ_LUCAS_CHAIN_MONT_CUTOFF)
+    {
+       fmpz_mont_t ctx;
+       mp_ptr a, v;
+       TMP_INIT;
+
+       fmpz_mont_init(ctx, n);
+
+       TMP_START;
+       a = TMP_ALLOC(3*ctx->size*sizeof(mp_limb_t));
+       v = a + ctx->size;
+
+       _fmpz_mont_set_fmpz(a, A, ctx);
+       _fmpz_mont_lucas_chain(v, v + ctx->size, a, m, ctx);
+       _fmpz_mont_get_fmpz(Vm, v, ctx);
+       _fmpz_mont_get_fmpz(Vm1, v + ctx->size, ctx);
+
+       TMP_END;
+       fmpz_mont_clear(ctx);
+
+       return;
+    }
+
     fmpz_init(t);
     fmpz_set_ui(Vm, 2);
     fmpz_set(Vm1, A);
@@ -0,0 +1,49 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+void _fmpz_mont_get_fmpz(fmpz_t f, mp_srcptr a, fmpz_mont_t ctx)
+{
+   mp_size_t len, size = ctx->size;
+   mp_ptr r = ctx->t + size;
+   __mpz_struct * mpz_ptr;
+
+   flint_mpn_copyi(ctx->t, a, size);
+   flint_mpn_zero(r, size);
+   _fmpz_mont_redc(r, ctx->t, ctx);
+
+   len = size;
+   while (len > 0 && r[len - 1] == 0)
+      len--;
+
+   if (len <= 1)
+      fmpz_set_ui(f, len == 0 ? 0 : r[0]);
+   else
+   {
+      mpz_ptr = _fmpz_promote(f);
+      if (mpz_ptr->_mp_alloc < len)
+         mpz_realloc2(mpz_ptr, len*FLINT_BITS);
+      flint_mpn_copyi(mpz_ptr->_mp_d, r, len);
+      mpz_ptr->_mp_size = len;
+   }
+}
@@ -0,0 +1,77 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+void fmpz_mont_init(fmpz_mont_t ctx, const fmpz_t n)
+{
+   mp_size_t size, i;
+   mp_limb_t inv;
+   mp_ptr num, q;
+   TMP_INIT;
+
+   if (fmpz_cmp_ui(n, 1) <= 0 || fmpz_is_even(n))
+   {
+      flint_printf("Exception (fmpz_mont_init). "
+                   "Modulus must be odd and greater than one.\n");
+      abort();
+   }
+
+   size = COEFF_IS_MPZ(*n) ? COEFF_TO_PTR(*n)->_mp_size : 1;
+
+   ctx->size = size;
+   ctx->n = flint_malloc((6 + (WORD(1) << (FMPZ_MONT_MAX_WINDOW - 1)))
+                                                 * size * sizeof(mp_limb_t));
+   ctx->r2 = ctx->n + size;
+   ctx->one = ctx->r2 + size;
+   ctx->t = ctx->one + size;
+   ctx->w = ctx->t + 2*size;
+
+   fmpz_init_set(&ctx->m, n);
+
+   if (COEFF_IS_MPZ(*n))
+      flint_mpn_copyi(ctx->n, COEFF_TO_PTR(*n)->_mp_d, size);
+   else
+      ctx->n[0] = *n;
+
+   /* n*n = 1 mod 8, and each Newton step doubles the number of bits */
+   inv = ctx->n[0];
+   for (i = 0; i < 5; i++)
+      inv *= 2 - ctx->n[0]*inv;
+   ctx->ninv = -inv;
+
+   TMP_START;
+   num = TMP_ALLOC((3*size + 3)*sizeof(mp_limb_t));
+   q = num + 2*size + 1;
+
+   flint_mpn_zero(num, 2*size);
+   num[2*size] = 1;
+   mpn_tdiv_qr(q, ctx->r2, 0, num, 2*size + 1, ctx->n, size);
+
+   /* R = R^2/R mod n */
+   flint_mpn_copyi(ctx->t, ctx->r2, size);
+   flint_mpn_zero(ctx->t + size, size);
+   _fmpz_mont_redc(ctx->one, ctx->t, ctx);
+
+   TMP_END;
+}
@@ -0,0 +1,65 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+/* r = a - b mod n for reduced a and b */
+static __inline__ void
+_fmpz_mont_sub(mp_ptr r, mp_srcptr a, mp_srcptr b, const fmpz_mont_t ctx)
+{
+   if (mpn_sub_n(r, a, b, ctx->size))
+      mpn_add_n(r, r, ctx->n, ctx->size);
+}
+
+void _fmpz_mont_lucas_chain(mp_ptr Vm, mp_ptr Vm1, mp_srcptr A,
+                                       const fmpz_t m, fmpz_mont_t ctx)
+{
+   mp_size_t size = ctx->size;
+   mp_ptr two = ctx->w;
+   slong i, B = fmpz_sizeinbase(m, 2);
+
+   if (mpn_add_n(two, ctx->one, ctx->one, size)
+         || mpn_cmp(two, ctx->n, size) >= 0)
+      mpn_sub_n(two, two, ctx->n, size);
+
+   flint_mpn_copyi(Vm1, A, size);
+   flint_mpn_copyi(Vm, two, size);
+
+   for (i = B - 1; i >= 0; i--)
+   {
+      if (fmpz_tstbit(m, i)) /* 1 in binary repn */
+      {
+         _fmpz_mont_mul(Vm, Vm, Vm1, ctx);
+         _fmpz_mont_sub(Vm, Vm, A, ctx);
+
+         _fmpz_mont_mul(Vm1, Vm1, Vm1, ctx);
+         _fmpz_mont_sub(Vm1, Vm1, two, ctx);
+      } else /* 0 in binary repn */
+      {
+         _fmpz_mont_mul(Vm1, Vm, Vm1, ctx);
+         _fmpz_mont_sub(Vm1, Vm1, A, ctx);
+
+         _fmpz_mont_mul(Vm, Vm, Vm, ctx);
+         _fmpz_mont_sub(Vm, Vm, two, ctx);
+      }
+   }
+}
@@ -0,0 +1,144 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+#define BIT(e, i) (((e)[(i) / FLINT_BITS] >> ((i) % FLINT_BITS)) & 1)
+
+/* Window size minimising the number of multiplications for an exponent
+   of the given number of bits */
+static int
+_fmpz_mont_window(mp_bitcnt_t bits)
+{
+   int k;
+
+   if (bits <= 8)
+      k = 1;
+   else if (bits <= 24)
+      k = 2;
+   else if (bits <= 80)
+      k = 3;
+   else if (bits <= 240)
+      k = 4;
+   else
+      k = 5;
+
+   return FLINT_MIN(k, FMPZ_MONT_MAX_WINDOW);
+}
+
+void _fmpz_mont_powm(mp_ptr r, mp_srcptr a, mp_srcptr e, mp_size_t elen,
+                                                         fmpz_mont_t ctx)
+{
+   mp_size_t size = ctx->size;
+   mp_ptr sqr = ctx->w, table = ctx->w + size;
+   slong i, j, l, bits;
+   mp_limb_t val;
+   int k, started = 0;
+
+   while (elen > 0 && e[elen - 1] == 0)
+      elen--;
+
+   if (elen == 0)
+   {
+      flint_mpn_copyi(r, ctx->one, size);
+      return;
+   }
+
+   count_leading_zeros(val, e[elen - 1]);
+   bits = elen*FLINT_BITS - val;
+   k = _fmpz_mont_window(bits);
+
+   /* table of a, a^3, ..., a^(2^k - 1) */
+   flint_mpn_copyi(table, a, size);
+   if (k > 1)
+   {
+      _fmpz_mont_mul(sqr, a, a, ctx);
+      for (l = 1; l < (WORD(1) << (k - 1)); l++)
+         _fmpz_mont_mul(table + l*size, table + (l - 1)*size, sqr, ctx);
+   }
+
+   for (i = bits - 1; i >= 0; )
+   {
+      if (!BIT(e, i))
+      {
+         _fmpz_mont_mul(r, r, r, ctx);
+         i--;
+         continue;
+      }
+
+      /* longest window ending in a one bit */
+      j = FLINT_MAX(i - k + 1, 0);
+      while (!BIT(e, j))
+         j++;
+
+      val = 0;
+      for (l = i; l >= j; l--)
+         val = 2*val + BIT(e, l);
+
+      if (started)
+      {
+         for (l = i; l >= j; l--)
+            _fmpz_mont_mul(r, r, r, ctx);
+
+         _fmpz_mont_mul(r, r, table + (val/2)*size, ctx);
+      } else
+      {
+         flint_mpn_copyi(r, table + (val/2)*size, size);
+         started = 1;
+      }
+
+      i = j - 1;
+   }
+}
+
+void fmpz_powm_mont(fmpz_t f, const fmpz_t g, const fmpz_t e,
+                                                         fmpz_mont_t ctx)
+{
+   mp_ptr x;
+   mp_limb_t e1;
+   TMP_INIT;
+
+   if (fmpz_sgn(e) < 0)
+   {
+      flint_printf("Exception (fmpz_powm_mont). Negative exponent.\n");
+      abort();
+   }
+
+   TMP_START;
+   x = TMP_ALLOC(ctx->size*sizeof(mp_limb_t));
+
+   _fmpz_mont_set_fmpz(x, g, ctx);
+
+   if (COEFF_IS_MPZ(*e))
+      _fmpz_mont_powm(x, x, COEFF_TO_PTR(*e)->_mp_d,
+                                       COEFF_TO_PTR(*e)->_mp_size, ctx);
+   else
+   {
+      e1 = *e;
+      _fmpz_mont_powm(x, x, &e1, 1, ctx);
+   }
+
+   _fmpz_mont_get_fmpz(f, x, ctx);
+
+   TMP_END;
+}
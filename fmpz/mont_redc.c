@@ -0,0 +1,39 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+void _fmpz_mont_redc(mp_ptr r, mp_ptr t, const fmpz_mont_t ctx)
+{
+   mp_size_t i, size = ctx->size;
+   mp_limb_t cy;
+
+   /* Each step clears the low limb of t, whose carry out is kept there
+      and added in at the end */
+   for (i = 0; i < size; i++)
+      t[i] = mpn_addmul_1(t + i, ctx->n, size, t[i]*ctx->ninv);
+
+   cy = mpn_add_n(r, t + size, t, size);
+
+   if (cy || mpn_cmp(r, ctx->n, size) >= 0)
+      mpn_sub_n(r, r, ctx->n, size);
+}
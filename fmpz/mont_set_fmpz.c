@@ -0,0 +1,48 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+void _fmpz_mont_set_fmpz(mp_ptr r, const fmpz_t a, fmpz_mont_t ctx)
+{
+   fmpz_t b;
+   mp_size_t len;
+
+   fmpz_init(b);
+   fmpz_mod(b, a, &ctx->m);
+
+   if (COEFF_IS_MPZ(*b))
+   {
+      len = COEFF_TO_PTR(*b)->_mp_size;
+      flint_mpn_copyi(r, COEFF_TO_PTR(*b)->_mp_d, len);
+   } else
+   {
+      r[0] = *b;
+      len = 1;
+   }
+
+   flint_mpn_zero(r + len, ctx->size - len);
+
+   _fmpz_mont_mul(r, r, ctx->r2, ctx);
+
+   fmpz_clear(b);
+}
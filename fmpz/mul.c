@@ -27,6 +27,35 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fmpz.h"
+#include "fft.h"
+
+/*
+   Sets r to the product of the nonzero a and b using the FLINT FFT,
+   whose matrix Fourier algorithm splits its passes over the threads.
+   Any of r, a, b may be aliased.
+*/
+static void
+_fmpz_mul_mpz_fft(__mpz_struct * r, const __mpz_struct * a,
+                                    const __mpz_struct * b)
+{
+    mp_size_t an = FLINT_ABS(a->_mp_size), bn = FLINT_ABS(b->_mp_size);
+    mp_size_t rn = an + bn;
+    mp_ptr t = flint_malloc(rn * sizeof(mp_limb_t));
+
+    if (an >= bn)
+        flint_mpn_mul_fft_main(t, a->_mp_d, an, b->_mp_d, bn);
+    else
+        flint_mpn_mul_fft_main(t, b->_mp_d, bn, a->_mp_d, an);
+
+    if (r->_mp_alloc < rn)
+        mpz_realloc2(r, rn * FLINT_BITS);
+
+    rn -= (t[rn - 1] == 0);
+    flint_mpn_copyi(r->_mp_d, t, rn);
+    r->_mp_size = ((a->_mp_size ^ b->_mp_size) < 0) ? -rn : rn;
+
+    flint_free(t);
+}
 
 void
 fmpz_mul(fmpz_t f, const fmpz_t g, const fmpz_t h)
@@ -54,6 +83,11 @@ fmpz_mul(fmpz_t f, const fmpz_t g, const fmpz_t h)
 
     if (!COEFF_IS_MPZ(c2))      /* g is large, h is small */
         flint_mpz_mul_si(mpz_ptr, COEFF_TO_PTR(c1), c2);
+    else if (flint_get_num_threads() > 1 &&
+        FLINT_MIN(FLINT_ABS(COEFF_TO_PTR(c1)->_mp_size),
+                  FLINT_ABS(COEFF_TO_PTR(c2)->_mp_size))
+                                        >= FMPZ_MUL_FFT_THREADED_CUTOFF)
+        _fmpz_mul_mpz_fft(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
     else                        /* c1 and c2 are large */
         mpz_mul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
 }
@@ -0,0 +1,87 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("is_probabprime_BPSW_vec....");
+    fflush(stdout);
+
+    /* Compare with fmpz_is_probabprime_BPSW */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz * vec;
+        int * res;
+        slong j, len;
+
+        len = n_randint(state, 50);
+        vec = _fmpz_vec_init(len);
+        res = flint_malloc((len + 1)*sizeof(int));
+
+        for (j = 0; j < len; j++)
+        {
+            fmpz_randtest_unsigned(vec + j, state,
+                                         n_randint(state, 200) + 1);
+
+            /* make primes reasonably frequent */
+            if (n_randint(state, 2))
+            {
+                do {
+                    fmpz_add_ui(vec + j, vec + j, 1);
+                } while (!fmpz_is_probabprime(vec + j));
+            }
+        }
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        fmpz_is_probabprime_BPSW_vec(res, vec, len);
+
+        for (j = 0; j < len; j++)
+        {
+            result = (res[j] == fmpz_is_probabprime_BPSW(vec + j));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                fmpz_print(vec + j); flint_printf("\n");
+                flint_printf("res = %d\n", res[j]);
+                abort();
+            }
+        }
+
+        _fmpz_vec_clear(vec, len);
+        flint_free(res);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
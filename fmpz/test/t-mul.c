@@ -206,6 +206,70 @@ main(void)
         mpz_clear(g);
     }
 
+    /* Test the threaded FFT for large operands, with aliasing */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b, c;
+        mpz_t d, e, f, g;
+        int alias = n_randint(state, 3);
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+
+        mpz_init(d);
+        mpz_init(e);
+        mpz_init(f);
+        mpz_init(g);
+
+        flint_set_num_threads(n_randint(state, 3) + 2);
+
+        fmpz_randbits(a, state, FLINT_BITS * (FMPZ_MUL_FFT_THREADED_CUTOFF
+                                     + n_randint(state, 20000)));
+        fmpz_randbits(b, state, FLINT_BITS * (FMPZ_MUL_FFT_THREADED_CUTOFF
+                                     + n_randint(state, 20000)));
+
+        fmpz_get_mpz(d, a);
+        fmpz_get_mpz(e, b);
+
+        if (alias == 0)
+        {
+            fmpz_mul(c, a, b);
+            mpz_mul(f, d, e);
+        }
+        else if (alias == 1)
+        {
+            fmpz_mul(c, a, a);
+            mpz_mul(f, d, d);
+        }
+        else
+        {
+            fmpz_mul(b, a, b);
+            fmpz_set(c, b);
+            mpz_mul(f, d, e);
+        }
+
+        fmpz_get_mpz(g, c);
+
+        result = (mpz_cmp(f, g) == 0);
+        if (!result)
+        {
+            flint_printf("FAIL (threaded FFT):\n");
+            abort();
+        }
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+
+        mpz_clear(d);
+        mpz_clear(e);
+        mpz_clear(f);
+        mpz_clear(g);
+    }
+
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
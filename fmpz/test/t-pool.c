@@ -0,0 +1,162 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    ulong max_limbs, max_total_limbs;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("pool....");
+    fflush(stdout);
+
+    fmpz_pool_get_policy(&max_limbs, &max_total_limbs);
+
+    if (max_limbs != FMPZ_POOL_MAX_LIMBS
+        || max_total_limbs != FMPZ_POOL_MAX_TOTAL_LIMBS)
+    {
+        flint_printf("FAIL: default policy\n");
+        abort();
+    }
+
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        fmpz_pool_stats_t s1, s2;
+        fmpz * A, * B, * C;
+        ulong lim, total, num, limbs;
+        slong i, n, big;
+        mpz_t t, u;
+
+        lim = n_randint(state, 2000);
+        total = n_randint(state, 100000);
+        fmpz_pool_set_policy(lim, total);
+
+        n = n_randint(state, 50);
+        A = _fmpz_vec_init(n);
+        B = _fmpz_vec_init(n);
+        C = _fmpz_vec_init(n);
+
+        for (i = 0; i < n; i++)
+        {
+            fmpz_randtest(A + i, state, 1 + n_randint(state, 5000));
+            fmpz_randtest(B + i, state, 1 + n_randint(state, 5000));
+        }
+
+        fmpz_pool_get_stats(s1);
+
+        /* values built from recycled mpz's must be correct */
+        mpz_init(t);
+        mpz_init(u);
+
+        for (i = 0; i < n; i++)
+        {
+            fmpz_mul(C + i, A + i, B + i);
+
+            fmpz_get_mpz(t, A + i);
+            fmpz_get_mpz(u, B + i);
+            mpz_mul(t, t, u);
+            fmpz_get_mpz(u, C + i);
+
+            if (mpz_cmp(t, u) != 0)
+            {
+                flint_printf("FAIL: wrong product\n");
+                abort();
+            }
+        }
+
+        mpz_clear(t);
+        mpz_clear(u);
+
+        big = 0;
+        for (i = 0; i < n; i++)
+            big += COEFF_IS_MPZ(C[i]);
+
+        _fmpz_vec_clear(C, n);
+
+        fmpz_pool_get_stats(s2);
+
+#if !HAVE_GC && !FLINT_REENTRANT
+        if (s2->released - s1->released != big
+            || s2->cached != s1->cached + big - (s2->reused - s1->reused))
+        {
+            flint_printf("FAIL: counts of released mpz's\n");
+            abort();
+        }
+
+        if (s2->cached_limbs > FLINT_MAX(total, s1->cached_limbs) + s2->cached)
+        {
+            flint_printf("FAIL: pool exceeds policy\n");
+            abort();
+        }
+#endif
+
+        /* reserve */
+        num = n_randint(state, 20);
+        limbs = n_randint(state, 300);
+        fmpz_pool_reserve(num, limbs);
+
+        fmpz_pool_get_stats(s1);
+
+#if !HAVE_GC && !FLINT_REENTRANT
+        if (s1->cached > s2->cached + num
+            || (s1->cached < s2->cached + num && FLINT_MAX(limbs, 1) <= lim
+                && s1->cached_limbs + FLINT_MAX(limbs, 1) <= total))
+        {
+            flint_printf("FAIL: reserve\n");
+            abort();
+        }
+#endif
+
+        /* trim */
+        limbs = n_randint(state, 2) ? 0 : n_randint(state, 10000);
+        fmpz_pool_trim(limbs);
+
+        fmpz_pool_get_stats(s2);
+
+#if !HAVE_GC && !FLINT_REENTRANT
+        if ((limbs == 0 && (s2->cached != 0 || s2->cached_limbs != 0))
+            || s2->cached_limbs > limbs)
+        {
+            flint_printf("FAIL: trim\n");
+            abort();
+        }
+#endif
+
+        _fmpz_vec_clear(A, n);
+        _fmpz_vec_clear(B, n);
+    }
+
+    fmpz_pool_set_policy(max_limbs, max_total_limbs);
+    fmpz_pool_reset_stats();
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("powm_mont....");
+    fflush(stdout);
+
+    /* Compare with fmpz_powm */
+    for (i = 0; i < 2000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b, c, e, m;
+        fmpz_mont_t ctx;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+        fmpz_init(e);
+        fmpz_init(m);
+
+        do {
+           fmpz_randtest_unsigned(m, state, n_randint(state, 600) + 2);
+        } while (fmpz_is_even(m) || fmpz_is_one(m));
+
+        fmpz_randtest(a, state, 700);
+        fmpz_randtest_unsigned(e, state, n_randint(state, 800) + 1);
+
+        fmpz_mont_init(ctx, m);
+
+        fmpz_powm_mont(b, a, e, ctx);
+        fmpz_powm(c, a, e, m);
+
+        result = fmpz_equal(b, c);
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("a = "), fmpz_print(a), flint_printf("\n");
+            flint_printf("e = "), fmpz_print(e), flint_printf("\n");
+            flint_printf("m = "), fmpz_print(m), flint_printf("\n");
+            flint_printf("b = "), fmpz_print(b), flint_printf("\n");
+            flint_printf("c = "), fmpz_print(c), flint_printf("\n");
+            abort();
+        }
+
+        /* Check aliasing of the result and the base */
+        fmpz_powm_mont(a, a, e, ctx);
+
+        result = fmpz_equal(a, c);
+        if (!result)
+        {
+            flint_printf("FAIL (alias a and b):\n");
+            flint_printf("a = "), fmpz_print(a), flint_printf("\n");
+            flint_printf("c = "), fmpz_print(c), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_mont_clear(ctx);
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+        fmpz_clear(e);
+        fmpz_clear(m);
+    }
+
+    /* Check the Lucas chain against fmpz_lucas_chain_full with B = 1 */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t A, B, k, m, V1, V2, W1, W2;
+        fmpz_mont_t ctx;
+        mp_ptr a, v;
+
+        fmpz_init(A);
+        fmpz_init(B);
+        fmpz_init(k);
+        fmpz_init(m);
+        fmpz_init(V1);
+        fmpz_init(V2);
+        fmpz_init(W1);
+        fmpz_init(W2);
+
+        do {
+           fmpz_randtest_unsigned(m, state, n_randint(state, 400) + 2);
+        } while (fmpz_is_even(m) || fmpz_is_one(m));
+
+        fmpz_randtest_mod(A, state, m);
+        fmpz_randtest_unsigned(k, state, n_randint(state, 400) + 1);
+        fmpz_one(B);
+
+        fmpz_mont_init(ctx, m);
+        a = flint_malloc(3*ctx->size*sizeof(mp_limb_t));
+        v = a + ctx->size;
+
+        _fmpz_mont_set_fmpz(a, A, ctx);
+        _fmpz_mont_lucas_chain(v, v + ctx->size, a, k, ctx);
+        _fmpz_mont_get_fmpz(V1, v, ctx);
+        _fmpz_mont_get_fmpz(V2, v + ctx->size, ctx);
+
+        fmpz_lucas_chain_full(W1, W2, A, B, k, m);
+
+        result = (fmpz_equal(V1, W1) && fmpz_equal(V2, W2));
+        if (!result)
+        {
+            flint_printf("FAIL (lucas chain):\n");
+            flint_printf("A = "), fmpz_print(A), flint_printf("\n");
+            flint_printf("k = "), fmpz_print(k), flint_printf("\n");
+            flint_printf("m = "), fmpz_print(m), flint_printf("\n");
+            flint_printf("V1 = "), fmpz_print(V1), flint_printf("\n");
+            flint_printf("W1 = "), fmpz_print(W1), flint_printf("\n");
+            abort();
+        }
+
+        flint_free(a);
+        fmpz_mont_clear(ctx);
+
+        fmpz_clear(A);
+        fmpz_clear(B);
+        fmpz_clear(k);
+        fmpz_clear(m);
+        fmpz_clear(V1);
+        fmpz_clear(V2);
+        fmpz_clear(W1);
+        fmpz_clear(W2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -44,6 +44,34 @@ typedef struct
 
 typedef fmpz_factor_struct fmpz_factor_t[1];
 
+/*
+   A factoring stage tries to find a nontrivial factor f of a composite n
+   which is not a perfect power and has no small factors. The round counts
+   up from zero on successive calls with the same n and may be used to
+   increase the effort. Returns 1 and sets f if a factor is found.
+*/
+typedef int (*fmpz_factor_stage_func_t)(fmpz_t f, const fmpz_t n,
+                                             ulong round, flint_rand_t state);
+
+typedef struct
+{
+    mp_bitcnt_t max_bits; /* largest n accepted by the stage, 0 if no limit */
+    ulong max_rounds;     /* number of rounds the stage is run for */
+    fmpz_factor_stage_func_t func;
+} fmpz_factor_stage_struct;
+
+/* Number of primes used for trial division, per bit of the input */
+#define FMPZ_FACTOR_TRIAL_PRIMES_PER_BIT 8
+
+/* Upper bound on the number of primes used for unsuccessful trial division */
+#define FMPZ_FACTOR_TRIAL_PRIMES_MAX 3000
+
+/* Stage 1 bound of p + 1 in the first round, doubled every round */
+#define FMPZ_FACTOR_PP1_B1 2000
+
+/* Number of rounds of p + 1, keeping the final stage 1 bound below 2^31 */
+#define FMPZ_FACTOR_PP1_MAX_ROUNDS 20
+
 
 /* Utility functions *********************************************************/
 
@@ -61,6 +89,8 @@ FLINT_DLL void _fmpz_factor_append(fmpz_factor_t factor, fmpz_t p, ulong exp);
 
 FLINT_DLL void _fmpz_factor_set_length(fmpz_factor_t factor, slong newlen);
 
+FLINT_DLL void _fmpz_factor_sort(fmpz_factor_t factor);
+
 /* Factoring *****************************************************************/
 
 FLINT_DLL void _fmpz_factor_extend_factor_ui(fmpz_factor_t factor, mp_limb_t n);
@@ -70,6 +100,22 @@ FLINT_DLL int fmpz_factor_trial_range(fmpz_factor_t factor, const fmpz_t n,
 
 FLINT_DLL void fmpz_factor(fmpz_factor_t factor, const fmpz_t n);
 
+FLINT_DLL int fmpz_factor_limited(fmpz_factor_t factor, const fmpz_t n,
+                                                            ulong max_rounds);
+
+FLINT_DLL int _fmpz_factor_no_trial(fmpz_factor_t factor, const fmpz_t n,
+                 ulong exp, const fmpz_factor_stage_struct * stages,
+                                         slong num_stages, ulong max_rounds);
+
+FLINT_DLL int fmpz_factor_stage_qsieve(fmpz_t f, const fmpz_t n,
+                                             ulong round, flint_rand_t state);
+
+FLINT_DLL int fmpz_factor_stage_pp1(fmpz_t f, const fmpz_t n,
+                                             ulong round, flint_rand_t state);
+
+FLINT_DLL int fmpz_factor_stage_trial(fmpz_t f, const fmpz_t n,
+                                             ulong round, flint_rand_t state);
+
 FLINT_DLL void fmpz_factor_si(fmpz_factor_t factor, slong n);
 
 FLINT_DLL int fmpz_factor_pp1(fmpz_t factor, const fmpz_t n, 
@@ -0,0 +1,287 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "thread_pool.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    const fmpz_factor_stage_struct * stages;
+    slong num_stages;
+    ulong max_rounds;
+    slong threads_free; /* number of further threads we may start */
+    pthread_mutex_t mutex;
+} _fmpz_factor_ctx_struct;
+
+typedef struct
+{
+    fmpz_factor_struct * res;
+    fmpz * n;
+    ulong exp;
+    _fmpz_factor_ctx_struct * ctx;
+    int complete;
+} _fmpz_factor_split_arg_t;
+
+static int _fmpz_factor_split(fmpz_factor_t res, fmpz_t n, ulong exp,
+                         _fmpz_factor_ctx_struct * ctx, flint_rand_t state);
+
+/*
+   Deals with n if it is 1, fits in a limb or is a probable prime, in which
+   case 1 is returned. Otherwise n is composite and 0 is returned.
+*/
+static int
+_fmpz_factor_base_case(fmpz_factor_t res, fmpz_t n, ulong exp)
+{
+    if (fmpz_abs_fits_ui(n))
+    {
+        n_factor_t fac;
+        slong i;
+
+        n_factor_init(&fac);
+        n_factor(&fac, fmpz_get_ui(n), 0);
+
+        for (i = 0; i < fac.num; i++)
+            _fmpz_factor_append_ui(res, fac.p[i], fac.exp[i] * exp);
+
+        return 1;
+    }
+
+    if (fmpz_is_probabprime(n))
+    {
+        _fmpz_factor_append(res, n, exp);
+        return 1;
+    }
+
+    return 0;
+}
+
+/* If n = r^k for a prime k, sets r and returns k, otherwise returns 1 */
+static ulong
+_fmpz_factor_perfect_power(fmpz_t r, const fmpz_t n)
+{
+    mp_bitcnt_t bits;
+    ulong k;
+    fmpz_t t;
+
+    if (!mpz_perfect_power_p(COEFF_TO_PTR(*n)))
+        return 1;
+
+    bits = fmpz_bits(n);
+    fmpz_init(t);
+
+    for (k = 2; k <= bits; k = n_nextprime(k, 0))
+    {
+        fmpz_root(r, n, k);
+        fmpz_pow_ui(t, r, k);
+
+        if (fmpz_equal(t, n))
+            break;
+    }
+
+    fmpz_clear(t);
+
+    return k <= bits ? k : 1;
+}
+
+static void
+_fmpz_factor_split_worker(void * arg_ptr)
+{
+    _fmpz_factor_split_arg_t * arg = (_fmpz_factor_split_arg_t *) arg_ptr;
+    flint_rand_t state;
+
+    flint_randinit(state);
+    arg->complete = _fmpz_factor_split(arg->res, arg->n, arg->exp,
+                                                            arg->ctx, state);
+    flint_randclear(state);
+}
+
+/*
+   Reserves a thread of the global pool if the factorisation may still
+   use one, the threads of the pool being shared with other callers.
+*/
+static int
+_fmpz_factor_reserve_thread(_fmpz_factor_ctx_struct * ctx,
+                                               thread_pool_handle * handle)
+{
+    int ok;
+
+    pthread_mutex_lock(&ctx->mutex);
+    ok = (ctx->threads_free > 0 && global_thread_pool_initialized &&
+                     thread_pool_request(global_thread_pool, handle, 1) == 1);
+    if (ok)
+        ctx->threads_free--;
+    pthread_mutex_unlock(&ctx->mutex);
+
+    return ok;
+}
+
+static void
+_fmpz_factor_release_thread(_fmpz_factor_ctx_struct * ctx,
+                                                   thread_pool_handle handle)
+{
+    thread_pool_give_back(global_thread_pool, handle);
+
+    pthread_mutex_lock(&ctx->mutex);
+    ctx->threads_free++;
+    pthread_mutex_unlock(&ctx->mutex);
+}
+
+/*
+   Factors the composite n, which is not a single limb, appending the
+   factors raised to the power exp to res. Returns 1 if all the factors
+   appended are probable primes.
+*/
+static int
+_fmpz_factor_split(fmpz_factor_t res, fmpz_t n, ulong exp,
+                          _fmpz_factor_ctx_struct * ctx, flint_rand_t state)
+{
+    fmpz_t f, g;
+    ulong k, round;
+    slong i;
+    int fcomp, gcomp, complete = 1, found = 0, tried = 1;
+    thread_pool_handle handle;
+
+    fmpz_init(f);
+    fmpz_init(g);
+
+    k = _fmpz_factor_perfect_power(f, n);
+    if (k != 1)
+    {
+        if (!_fmpz_factor_base_case(res, f, exp * k))
+            complete = _fmpz_factor_split(res, f, exp * k, ctx, state);
+
+        fmpz_clear(f);
+        fmpz_clear(g);
+        return complete;
+    }
+
+    /* Find a nontrivial factor f using the first stage that succeeds */
+    for (round = 0; !found && tried &&
+                (ctx->max_rounds == 0 || round < ctx->max_rounds); round++)
+    {
+        tried = 0;
+
+        for (i = 0; !found && i < ctx->num_stages; i++)
+        {
+            if (ctx->stages[i].max_bits != 0 &&
+                fmpz_bits(n) > ctx->stages[i].max_bits)
+                continue;
+
+            if (round >= ctx->stages[i].max_rounds)
+                continue;
+
+            tried = 1;
+
+            if (ctx->stages[i].func(f, n, round, state) &&
+                fmpz_cmp_ui(f, 1) > 0 && fmpz_cmp(f, n) < 0)
+                found = fmpz_divisible(n, f);
+        }
+    }
+
+    if (!found)
+    {
+        /* Effort exhausted, leave the cofactor unfactored */
+        _fmpz_factor_append(res, n, exp);
+
+        fmpz_clear(f);
+        fmpz_clear(g);
+        return 0;
+    }
+
+    fmpz_divexact(g, n, f);
+
+    fcomp = !_fmpz_factor_base_case(res, f, exp);
+    gcomp = !_fmpz_factor_base_case(res, g, exp);
+
+    if (fcomp && gcomp && _fmpz_factor_reserve_thread(ctx, &handle))
+    {
+        /* Split the independent cofactors concurrently */
+        _fmpz_factor_split_arg_t arg;
+        fmpz_factor_t gres;
+
+        fmpz_factor_init(gres);
+
+        arg.res = gres;
+        arg.n = g;
+        arg.exp = exp;
+        arg.ctx = ctx;
+
+        thread_pool_wake(global_thread_pool, handle, 0,
+                                             _fmpz_factor_split_worker, &arg);
+        complete = _fmpz_factor_split(res, f, exp, ctx, state);
+        thread_pool_wait(global_thread_pool, handle);
+
+        _fmpz_factor_release_thread(ctx, handle);
+
+        for (i = 0; i < gres->num; i++)
+            _fmpz_factor_append(res, gres->p + i, gres->exp[i]);
+        complete &= arg.complete;
+
+        fmpz_factor_clear(gres);
+    }
+    else
+    {
+        if (fcomp)
+            complete &= _fmpz_factor_split(res, f, exp, ctx, state);
+        if (gcomp)
+            complete &= _fmpz_factor_split(res, g, exp, ctx, state);
+    }
+
+    fmpz_clear(f);
+    fmpz_clear(g);
+
+    return complete;
+}
+
+int
+_fmpz_factor_no_trial(fmpz_factor_t factor, const fmpz_t n, ulong exp,
+                      const fmpz_factor_stage_struct * stages,
+                      slong num_stages, ulong max_rounds)
+{
+    _fmpz_factor_ctx_struct ctx;
+    flint_rand_t state;
+    fmpz_t t;
+    int complete = 1;
+
+    fmpz_init(t);
+    fmpz_abs(t, n);
+
+    if (!_fmpz_factor_base_case(factor, t, exp))
+    {
+        ctx.stages = stages;
+        ctx.num_stages = num_stages;
+        ctx.max_rounds = max_rounds;
+        ctx.threads_free = flint_get_num_threads() - 1;
+        pthread_mutex_init(&ctx.mutex, NULL);
+
+        flint_randinit(state);
+        complete = _fmpz_factor_split(factor, t, exp, &ctx, state);
+        flint_randclear(state);
+
+        pthread_mutex_destroy(&ctx.mutex);
+    }
+
+    fmpz_clear(t);
+
+    return complete;
+}
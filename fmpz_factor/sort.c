@@ -0,0 +1,58 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+void
+_fmpz_factor_sort(fmpz_factor_t factor)
+{
+    slong i, j, k;
+
+    /* Insertion sort on the bases, there are only a few of them */
+    for (i = 1; i < factor->num; i++)
+    {
+        for (j = i; j > 0 &&
+                    fmpz_cmp(factor->p + j - 1, factor->p + j) > 0; j--)
+        {
+            ulong e = factor->exp[j];
+
+            fmpz_swap(factor->p + j - 1, factor->p + j);
+            factor->exp[j] = factor->exp[j - 1];
+            factor->exp[j - 1] = e;
+        }
+    }
+
+    /* Merge equal bases */
+    for (i = 0, k = 0; i < factor->num; i++)
+    {
+        if (k > 0 && fmpz_equal(factor->p + k - 1, factor->p + i))
+            factor->exp[k - 1] += factor->exp[i];
+        else
+        {
+            fmpz_swap(factor->p + k, factor->p + i);
+            factor->exp[k] = factor->exp[i];
+            k++;
+        }
+    }
+
+    _fmpz_factor_set_length(factor, k);
+}
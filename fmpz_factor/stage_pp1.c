@@ -0,0 +1,48 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+
+int
+fmpz_factor_stage_pp1(fmpz_t f, const fmpz_t n,
+                                              ulong round, flint_rand_t state)
+{
+    ulong B1, B2sqrt, c;
+
+    if (round >= FMPZ_FACTOR_PP1_MAX_ROUNDS)
+        return 0;
+
+    B1 = (ulong) FMPZ_FACTOR_PP1_B1 << round;
+    B2sqrt = FLINT_MIN(B1 / 16, UWORD(1) << 20);
+
+    do
+    {
+        c = n_randlimb(state);
+    } while (c <= UWORD(2));
+
+    if (fmpz_size(n) == 1)
+        c = c % (fmpz_get_ui(n) - 3) + 3;
+
+    return fmpz_factor_pp1(f, n, B1, B2sqrt, c)
+        && fmpz_cmp_ui(f, 1) > 0 && fmpz_cmp(f, n) < 0;
+}
@@ -0,0 +1,45 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "qsieve.h"
+
+int
+fmpz_factor_stage_qsieve(fmpz_t f, const fmpz_t n,
+                                              ulong round, flint_rand_t state)
+{
+    __mpz_struct * m;
+    mp_limb_t fac;
+
+    /* The sieve is deterministic, so there is no point trying again */
+    if (round != 0 || fmpz_size(n) != 2)
+        return 0;
+
+    m = COEFF_TO_PTR(*n);
+    fac = qsieve_ll_factor(m->_mp_d[1], m->_mp_d[0]);
+
+    if (fac <= 1)
+        return 0;
+
+    fmpz_set_ui(f, fac);
+    return 1;
+}
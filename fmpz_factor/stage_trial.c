@@ -0,0 +1,44 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "mpn_extras.h"
+#include "ulong_extras.h"
+
+int
+fmpz_factor_stage_trial(fmpz_t f, const fmpz_t n,
+                                              ulong round, flint_rand_t state)
+{
+    __mpz_struct * m = COEFF_TO_PTR(*n);
+    slong start, found;
+
+    /* Each round tries the next thousand odd primes */
+    start = 1 + 1000 * (slong) round;
+    found = flint_mpn_factor_trial(m->_mp_d, m->_mp_size,
+                                                       start, start + 1000);
+
+    if (!found)
+        return 0;
+
+    fmpz_set_ui(f, n_primes_arr_readonly(found + 1)[found]);
+    return 1;
+}
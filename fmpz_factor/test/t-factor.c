@@ -64,7 +64,8 @@ void check(fmpz_t n)
 
     for (i = 0; i < factor->num; i++)
     {
-        if (!fmpz_is_probabprime(factor->p + i))
+        if (!fmpz_is_probabprime(factor->p + i) ||
+            fmpz_is_prime(factor->p + i) != 1)
         {
             flint_printf("ERROR: factor is not prime!\n");
 
@@ -156,6 +157,88 @@ int main(void)
         check(x);
     }
 
+    /* Products of primes which are too large for trial division */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong k = n_randint(state, 4) + 2;
+
+        fmpz_init(p);
+        fmpz_one(x);
+
+        for (j = 0; j < k; j++)
+        {
+            fmpz_set_ui(p, n_randprime(state, n_randint(state, 11) + 16, 0));
+            fmpz_mul(x, x, p);
+        }
+
+        /* Throw in a perfect power or a large prime */
+        if (n_randint(state, 2))
+            fmpz_pow_ui(x, x, n_randint(state, 3) + 1);
+        else
+        {
+            do
+            {
+                fmpz_randbits(p, state, n_randint(state, 100) + 65);
+                fmpz_abs(p, p);
+            } while (!fmpz_is_probabprime(p));
+            fmpz_mul(x, x, p);
+        }
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+        check(x);
+        flint_set_num_threads(1);
+
+        fmpz_clear(p);
+    }
+
+    /* Cofactors left to the trial division fallback of fmpz_factor */
+    for (i = 0; i < flint_test_multiplier(); i++)
+    {
+        const fmpz_factor_stage_struct stage[] =
+            { { 0, UWORD_MAX, fmpz_factor_stage_trial } };
+        fmpz_factor_t factor;
+        fmpz_t p, m;
+        slong k;
+
+        fmpz_factor_init(factor);
+        factor->sign = 1;
+        fmpz_init(p);
+        fmpz_init(m);
+
+        fmpz_set_ui(x, n_randprime(state, n_randint(state, 8) + 12, 0));
+        do
+        {
+            fmpz_randbits(p, state, n_randint(state, 100) + 129);
+            fmpz_abs(p, p);
+        } while (!fmpz_is_probabprime(p));
+        fmpz_mul(x, x, p);
+        fmpz_mul_ui(x, x, n_randprime(state, n_randint(state, 8) + 12, 0));
+
+        _fmpz_factor_no_trial(factor, x, 1, stage, 1, 0);
+        _fmpz_factor_sort(factor);
+        fmpz_factor_expand(m, factor);
+
+        for (k = 0; k < factor->num; k++)
+        {
+            if (fmpz_is_prime(factor->p + k) != 1)
+                fmpz_zero(m);
+        }
+
+        if (!fmpz_equal(m, x) || factor->num < 2)
+        {
+            flint_printf("ERROR: trial division stage failed!\n");
+            flint_printf("input: "), fmpz_print(x), flint_printf("\n");
+            flint_printf("computed factors: "), fmpz_factor_print(factor);
+            flint_printf("\n");
+            abort();
+        }
+
+        fmpz_factor_clear(factor);
+        fmpz_clear(p);
+        fmpz_clear(m);
+    }
+
     /* Large negative integers */
     fmpz_set_ui(x, 10);
     fmpz_pow_ui(x, x, 100);
@@ -0,0 +1,98 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("factor_limited....");
+    fflush(stdout);
+
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        fmpz_factor_t fac;
+        fmpz_t n, m, p;
+        slong k;
+        int complete;
+
+        fmpz_factor_init(fac);
+        fmpz_init(n);
+        fmpz_init(m);
+        fmpz_init(p);
+
+        /* A small cofactor times a product of two large primes */
+        fmpz_set_ui(n, n_randtest_not_zero(state));
+        for (j = 0; j < 2; j++)
+        {
+            do
+            {
+                fmpz_randbits(p, state, 120);
+                fmpz_abs(p, p);
+            } while (!fmpz_is_probabprime(p));
+            fmpz_mul(n, n, p);
+        }
+
+        if (n_randint(state, 2))
+            fmpz_neg(n, n);
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+        complete = fmpz_factor_limited(fac, n, 1);
+        flint_set_num_threads(1);
+
+        fmpz_factor_expand(m, fac);
+
+        result = fmpz_equal(m, n);
+        for (k = 0; k < fac->num; k++)
+        {
+            result &= (fmpz_sgn(fac->p + k) > 0 && fac->exp[k] > 0);
+            if (k > 0)
+                result &= (fmpz_cmp(fac->p + k - 1, fac->p + k) < 0);
+            if (complete)
+                result &= fmpz_is_probabprime(fac->p + k);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = "), fmpz_print(n), flint_printf("\n");
+            flint_printf("factors: "), fmpz_factor_print(fac);
+            flint_printf("\ncomplete = %d\n", complete);
+            abort();
+        }
+
+        fmpz_factor_clear(fac);
+        fmpz_clear(n);
+        fmpz_clear(m);
+        fmpz_clear(p);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
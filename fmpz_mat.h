@@ -212,6 +212,22 @@ FLINT_DLL void fmpz_mat_mul_classical_inline(fmpz_mat_t C, const fmpz_mat_t A,
 FLINT_DLL void _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A,
     const fmpz_mat_t B, mp_bitcnt_t bits);
 
+FLINT_DLL void _fmpz_mat_mul_multi_mod_chunked(fmpz_mat_t C,
+    const fmpz_mat_t A, const fmpz_mat_t B, mp_bitcnt_t bits, slong chunk);
+
+/* Bound on the words of modular images held at once by multi-modular
+   multiplication */
+#define FMPZ_MAT_MUL_MULTI_MOD_MAX_WORDS (WORD(1) << 24)
+
+/* Smallest dimension at which fmpz_mat_mul leaves classical multiplication */
+#define FMPZ_MAT_MUL_CLASSICAL_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FMPZ_MAT_MUL_CLASSICAL)
+
+/* Smallest dimension at which entries wider than a word are multiplied
+   multi-modularly */
+#define FMPZ_MAT_MUL_MULTI_MOD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FMPZ_MAT_MUL_MULTI_MOD)
+
 FLINT_DLL void fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A,
     const fmpz_mat_t B);
 
@@ -23,6 +23,7 @@
 
 ******************************************************************************/
 
+#include "thread_pool.h"
 #include "fmpz_mat.h"
 
 /* Enable to exercise corner cases */
@@ -43,15 +44,98 @@ next_good_prime(const fmpz_t d, mp_limb_t p)
     return p;
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * A;
+    const fmpz * d;
+    mp_srcptr primes;
+    mp_ptr residues;
+    slong i0;
+    slong i1;
+} _fmpz_mat_det_modular_arg_t;
+
+/* Sets residues i0 to i1 - 1 to det(A) / d modulo the corresponding primes */
+static void
+_fmpz_mat_det_modular_range(_fmpz_mat_det_modular_arg_t * arg)
+{
+    nmod_mat_t Amod;
+    mp_limb_t p, xmod;
+    slong i, n = arg->A->r;
+
+    nmod_mat_init(Amod, n, n, 2);
+
+    for (i = arg->i0; i < arg->i1; i++)
+    {
+        p = arg->primes[i];
+        _nmod_mat_set_mod(Amod, p);
+        fmpz_mat_get_nmod_mat(Amod, arg->A);
+
+        xmod = _nmod_mat_det(Amod);
+        arg->residues[i] = n_mulmod2_preinv(xmod,
+            n_invmod(fmpz_fdiv_ui(arg->d, p), p), Amod->mod.n, Amod->mod.ninv);
+    }
+
+    nmod_mat_clear(Amod);
+}
+
+static void
+_fmpz_mat_det_modular_worker(void * arg_ptr)
+{
+    _fmpz_mat_det_modular_range((_fmpz_mat_det_modular_arg_t *) arg_ptr);
+}
+
+/* Computes the residues for num primes, split over the available threads */
+static void
+_fmpz_mat_det_modular_threaded(mp_ptr residues, const fmpz_mat_t A,
+    const fmpz_t d, mp_srcptr primes, slong num)
+{
+    _fmpz_mat_det_modular_arg_t * args;
+    thread_pool_handle * threads;
+    slong i, num_threads, num_workers;
+    int max_threads = flint_get_num_threads();
+
+    num_workers = flint_request_threads(&threads, num);
+    num_threads = num_workers + 1;
+
+    args = flint_malloc(sizeof(_fmpz_mat_det_modular_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].A = A;
+        args[i].d = d;
+        args[i].primes = primes;
+        args[i].residues = residues;
+        args[i].i0 = (num * i) / num_threads;
+        args[i].i1 = (num * (i + 1)) / num_threads;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                                      _fmpz_mat_det_modular_worker, &args[i]);
+
+    /* The determinants themselves are computed with a single thread */
+    _flint_set_num_workers(0);
+    _fmpz_mat_det_modular_range(&args[0]);
+    _flint_set_num_workers(max_threads - 1);
+
+    for (i = 1; i < num_threads; i++)
+        thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+    flint_give_back_threads(threads, num_workers);
+
+    flint_free(args);
+}
 
 void
 fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     const fmpz_t d, int proved)
 {
-    fmpz_t bound, prod, stable_prod, x, xnew;
-    mp_limb_t p, xmod;
-    nmod_mat_t Amod;
-    slong n = A->r;
+    fmpz_t bound, prod, stable_prod, x, xnew, y, M, t;
+    fmpz_comb_t comb;
+    fmpz_comb_temp_t comb_temp;
+    mp_ptr primes, residues;
+    mp_limb_t p;
+    slong n = A->r, num, batch, alloc;
 
     if (n == 0)
     {
@@ -70,16 +154,27 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     fmpz_init(stable_prod);
     fmpz_init(x);
     fmpz_init(xnew);
+    fmpz_init(y);
+    fmpz_init(M);
+    fmpz_init(t);
 
     /* Bound x = det(A) / d */
     fmpz_mat_det_bound(bound, A);
     fmpz_mul_ui(bound, bound, UWORD(2));  /* accomodate sign */
     fmpz_cdiv_q(bound, bound, d);
 
-    nmod_mat_init(Amod, n, n, 2);
     fmpz_zero(x);
     fmpz_one(prod);
 
+    /*
+       With proved = 1 all the primes needed for the bound are taken as a
+       single batch. Otherwise each batch has one prime per thread, so that
+       the computation can stop as soon as the result has stabilised.
+    */
+    batch = proved ? WORD_MAX : flint_get_num_threads();
+    alloc = 0;
+    primes = residues = NULL;
+
 #if DEBUG_USE_SMALL_PRIMES
     p = UWORD(1);
 #else
@@ -89,39 +184,73 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     /* Compute x = det(A) / d */
     while (fmpz_cmp(prod, bound) <= 0)
     {
-        p = next_good_prime(d, p);
-        _nmod_mat_set_mod(Amod, p);
-        fmpz_mat_get_nmod_mat(Amod, A);
+        /* Take primes until the batch is full or the bound is reached */
+        fmpz_one(M);
 
-        /* Compute x = det(A) / d mod p */
-        xmod = _nmod_mat_det(Amod);
-        xmod = n_mulmod2_preinv(xmod,
-            n_invmod(fmpz_fdiv_ui(d, p), p), Amod->mod.n, Amod->mod.ninv);
+        for (num = 0; num < batch; num++)
+        {
+            if (num == alloc)
+            {
+                alloc = FLINT_MAX(2 * alloc, 16);
+                primes = flint_realloc(primes, sizeof(mp_limb_t) * alloc);
+            }
+
+            p = next_good_prime(d, p);
+            primes[num] = p;
+            fmpz_mul_ui(M, M, p);
+
+            fmpz_mul(t, prod, M);
+            if (fmpz_cmp(t, bound) > 0)
+            {
+                num++;
+                break;
+            }
+        }
+
+        residues = flint_realloc(residues, sizeof(mp_limb_t) * alloc);
 
-        fmpz_CRT_ui(xnew, x, prod, xmod, p, 1);
+        _fmpz_mat_det_modular_threaded(residues, A, d, primes, num);
+
+        /* Combine the residues of the batch by a subproduct tree */
+        if (num == 1)
+            fmpz_set_ui(y, residues[0]);
+        else
+        {
+            fmpz_comb_init(comb, primes, num);
+            fmpz_comb_temp_init(comb_temp, comb);
+            fmpz_multi_CRT_ui(y, residues, comb, comb_temp, 0);
+            fmpz_comb_temp_clear(comb_temp);
+            fmpz_comb_clear(comb);
+        }
+
+        fmpz_CRT(xnew, x, prod, y, M, 1);
 
         if (fmpz_equal(xnew, x))
         {
-            fmpz_mul_ui(stable_prod, stable_prod, p);
+            fmpz_mul(stable_prod, stable_prod, M);
             if (!proved && fmpz_bits(stable_prod) > 100)
                 break;
         }
         else
         {
-            fmpz_set_ui(stable_prod, p);
+            fmpz_set_ui(stable_prod, primes[num - 1]);
         }
 
-        fmpz_mul_ui(prod, prod, p);
+        fmpz_mul(prod, prod, M);
         fmpz_set(x, xnew);
     }
 
     /* det(A) = x * d */
     fmpz_mul(det, x, d);
 
-    nmod_mat_clear(Amod);
+    flint_free(primes);
+    flint_free(residues);
     fmpz_clear(bound);
     fmpz_clear(prod);
     fmpz_clear(stable_prod);
     fmpz_clear(x);
     fmpz_clear(xnew);
+    fmpz_clear(y);
+    fmpz_clear(M);
+    fmpz_clear(t);
 }
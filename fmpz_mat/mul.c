@@ -46,13 +46,15 @@ fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
 
     dim = FLINT_MIN(FLINT_MIN(m, n), k);
 
-    if (dim < 12)
+    if (dim < FMPZ_MAT_MUL_CLASSICAL_CUTOFF)
     {
         /* The inline version only benefits from large n */
         if (n <= 2)
-            fmpz_mat_mul_classical(C, A, B);
+            FLINT_STATS_CALL(FLINT_STATS_FMPZ_MAT_MUL_CLASSICAL, dim, 0,
+                fmpz_mat_mul_classical(C, A, B));
         else
-            fmpz_mat_mul_classical_inline(C, A, B);
+            FLINT_STATS_CALL(FLINT_STATS_FMPZ_MAT_MUL_CLASSICAL_INLINE, dim,
+                0, fmpz_mat_mul_classical_inline(C, A, B));
     }
     else
     {
@@ -66,13 +68,16 @@ fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
 
         bits = ab + bb + FLINT_BIT_COUNT(n) + 1;
 
-        if (5*(ab + bb) > dim * dim || (bits > FLINT_BITS - 3 && dim < 60))
+        if (5*(ab + bb) > dim * dim || (bits > FLINT_BITS - 3 &&
+                                   dim < FMPZ_MAT_MUL_MULTI_MOD_CUTOFF))
         {
-            fmpz_mat_mul_classical_inline(C, A, B);
+            FLINT_STATS_CALL(FLINT_STATS_FMPZ_MAT_MUL_CLASSICAL_INLINE, dim,
+                FLINT_MAX(ab, bb), fmpz_mat_mul_classical_inline(C, A, B));
         }
         else
         {
-            _fmpz_mat_mul_multi_mod(C, A, B, bits);
+            FLINT_STATS_CALL(FLINT_STATS_FMPZ_MAT_MUL_MULTI_MOD, dim,
+                FLINT_MAX(ab, bb), _fmpz_mat_mul_multi_mod(C, A, B, bits));
         }
     }
 }
@@ -23,25 +23,220 @@
 
 ******************************************************************************/
 
+#include "thread_pool.h"
 #include "fmpz_mat.h"
 
-void
-_fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
-    mp_bitcnt_t bits)
+typedef struct
 {
-    slong i, j, k;
+    fmpz ** rows;
+    slong r0;
+    slong r1;
+    slong c;
+    nmod_mat_struct * mod;      /* images modulo the primes of the chunk */
+    const fmpz_comb_struct * comb;
+    int crt;                    /* reduce if 0, lift if 1 */
+    int sign;                   /* lift to the symmetric range */
+    const fmpz * M;             /* product of earlier primes, or NULL */
+    const fmpz * Minv;          /* M^-1 modulo P */
+    const fmpz * P;             /* product of the primes of the chunk */
+    const fmpz * MP;            /* M * P */
+} _fmpz_mat_multi_mod_arg_t;
 
-    fmpz_comb_t comb;
-    fmpz_comb_temp_t comb_temp;
+/*
+   Reduces rows r0 to r1 - 1 modulo the primes of the chunk, or lifts
+   them from their images. When M is not NULL, the rows already hold
+   values modulo M which are combined with the new images.
+*/
+static void
+_fmpz_mat_multi_mod_rows(_fmpz_mat_multi_mod_arg_t * arg)
+{
+    slong i, j, k, num_primes = arg->comb->num_primes;
+    fmpz_comb_temp_t temp;
+    mp_ptr residues;
+    fmpz_t t;
+    fmpz * e;
+
+    residues = flint_malloc(sizeof(mp_limb_t) * num_primes);
+    fmpz_comb_temp_init(temp, arg->comb);
+    fmpz_init(t);
+
+    for (i = arg->r0; i < arg->r1; i++)
+    {
+        for (j = 0; j < arg->c; j++)
+        {
+            e = arg->rows[i] + j;
+
+            if (!arg->crt)
+            {
+                fmpz_multi_mod_ui(residues, e, arg->comb, temp);
+                for (k = 0; k < num_primes; k++)
+                    arg->mod[k].rows[i][j] = residues[k];
+            }
+            else
+            {
+                for (k = 0; k < num_primes; k++)
+                    residues[k] = arg->mod[k].rows[i][j];
+
+                if (arg->M == NULL)
+                {
+                    fmpz_multi_CRT_ui(e, residues, arg->comb, temp,
+                                                                arg->sign);
+                }
+                else
+                {
+                    fmpz_multi_CRT_ui(t, residues, arg->comb, temp, 0);
+                    fmpz_sub(t, t, e);
+                    fmpz_mul(t, t, arg->Minv);
+                    fmpz_mod(t, t, arg->P);
+                    fmpz_addmul(e, t, arg->M);
+
+                    if (arg->sign)
+                    {
+                        fmpz_mul_2exp(t, e, 1);
+                        if (fmpz_cmp(t, arg->MP) > 0)
+                            fmpz_sub(e, e, arg->MP);
+                    }
+                }
+            }
+        }
+    }
+
+    fmpz_clear(t);
+    fmpz_comb_temp_clear(temp);
+    flint_free(residues);
+}
+
+static void
+_fmpz_mat_multi_mod_worker(void * arg_ptr)
+{
+    _fmpz_mat_multi_mod_rows((_fmpz_mat_multi_mod_arg_t *) arg_ptr);
+}
+
+/* Splits the r rows described by arg over the available threads */
+static void
+_fmpz_mat_multi_mod_threaded(_fmpz_mat_multi_mod_arg_t * arg, slong r)
+{
+    _fmpz_mat_multi_mod_arg_t * args;
+    thread_pool_handle * threads;
+    slong i, num_threads, num_workers;
+
+    num_workers = flint_request_threads(&threads, r);
+    num_threads = num_workers + 1;
+
+    if (num_threads <= 1)
+    {
+        flint_give_back_threads(threads, num_workers);
+        arg->r0 = 0;
+        arg->r1 = r;
+        _fmpz_mat_multi_mod_rows(arg);
+        return;
+    }
+
+    args = flint_malloc(sizeof(_fmpz_mat_multi_mod_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i] = *arg;
+        args[i].r0 = (r * i) / num_threads;
+        args[i].r1 = (r * (i + 1)) / num_threads;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                                        _fmpz_mat_multi_mod_worker, &args[i]);
+
+    _fmpz_mat_multi_mod_rows(&args[0]);
+
+    for (i = 1; i < num_threads; i++)
+        thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+    flint_give_back_threads(threads, num_workers);
+
+    flint_free(args);
+}
+
+typedef struct
+{
+    nmod_mat_struct * C;
+    nmod_mat_struct * A;
+    nmod_mat_struct * B;
+    slong p0;
+    slong p1;
+    slong num_threads;
+} _fmpz_mat_mul_mod_arg_t;
+
+/* Multiplies modulo primes p0 to p1 - 1 */
+static void
+_fmpz_mat_mul_mod_primes(_fmpz_mat_mul_mod_arg_t * arg)
+{
+    slong i;
+
+    for (i = arg->p0; i < arg->p1; i++)
+        nmod_mat_mul(arg->C + i, arg->A + i, arg->B + i);
+}
+
+static void
+_fmpz_mat_mul_mod_worker(void * arg_ptr)
+{
+    _fmpz_mat_mul_mod_primes((_fmpz_mat_mul_mod_arg_t *) arg_ptr);
+}
+
+/*
+   Computes the num_primes modular products, spreading the primes over
+   the threads, each prime getting a share of any spare threads.
+*/
+static void
+_fmpz_mat_mul_mod_threaded(nmod_mat_struct * C, nmod_mat_struct * A,
+                                  nmod_mat_struct * B, slong num_primes)
+{
+    _fmpz_mat_mul_mod_arg_t * args;
+    thread_pool_handle * threads;
+    slong i, num_threads, num_workers;
+    int total_threads = flint_get_num_threads();
 
-    slong num_primes;
+    num_workers = flint_request_threads(&threads, num_primes);
+    num_threads = num_workers + 1;
+
+    args = flint_malloc(sizeof(_fmpz_mat_mul_mod_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].C = C;
+        args[i].A = A;
+        args[i].B = B;
+        args[i].p0 = (num_primes * i) / num_threads;
+        args[i].p1 = (num_primes * (i + 1)) / num_threads;
+        args[i].num_threads = total_threads / num_threads
+                                    + (i < total_threads % num_threads);
+    }
+
+    for (i = 1; i < num_threads; i++)
+        thread_pool_wake(global_thread_pool, threads[i - 1],
+              args[i].num_threads - 1, _fmpz_mat_mul_mod_worker, &args[i]);
+
+    _flint_set_num_workers(args[0].num_threads - 1);
+    _fmpz_mat_mul_mod_primes(&args[0]);
+    _flint_set_num_workers(total_threads - 1);
+
+    for (i = 1; i < num_threads; i++)
+        thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+    flint_give_back_threads(threads, num_workers);
+
+    flint_free(args);
+}
+
+void
+_fmpz_mat_mul_multi_mod_chunked(fmpz_mat_t C, const fmpz_mat_t A,
+                      const fmpz_mat_t B, mp_bitcnt_t bits, slong chunk)
+{
+    slong i, c0, len, num_primes, num_chunks;
     mp_bitcnt_t primes_bits;
     mp_limb_t * primes;
-    mp_limb_t * residues;
-
-    nmod_mat_t * mod_C;
-    nmod_mat_t * mod_A;
-    nmod_mat_t * mod_B;
+    nmod_mat_struct * mod_A, * mod_B, * mod_C;
+    fmpz_comb_t comb;
+    fmpz_t M, Minv, P, MP;
+    _fmpz_mat_multi_mod_arg_t arg;
 
     primes_bits = NMOD_MAT_OPTIMAL_MODULUS_BITS;
 
@@ -56,77 +251,131 @@ _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
         num_primes = (bits + primes_bits - 1) / primes_bits;
     }
 
-    /* Initialize */
+    /* Balance the chunks */
+    chunk = FLINT_MAX(chunk, 1);
+    num_chunks = (num_primes + chunk - 1) / chunk;
+    chunk = (num_primes + num_chunks - 1) / num_chunks;
+
+    /* Later chunks need A and B after C has been written */
+    if (num_chunks > 1 && (C == A || C == B))
+    {
+        fmpz_mat_t T;
+        fmpz_mat_init(T, A->r, B->c);
+        _fmpz_mat_mul_multi_mod_chunked(T, A, B, bits, chunk);
+        fmpz_mat_swap(C, T);
+        fmpz_mat_clear(T);
+        return;
+    }
+
     primes = flint_malloc(sizeof(mp_limb_t) * num_primes);
     primes[0] = n_nextprime(UWORD(1) << primes_bits, 0);
     for (i = 1; i < num_primes; i++)
         primes[i] = n_nextprime(primes[i-1], 0);
 
-    residues = flint_malloc(sizeof(mp_limb_t) * num_primes);
+    mod_A = flint_malloc(sizeof(nmod_mat_struct) * chunk);
+    mod_B = flint_malloc(sizeof(nmod_mat_struct) * chunk);
+    mod_C = flint_malloc(sizeof(nmod_mat_struct) * chunk);
+
+    fmpz_init(M);
+    fmpz_init(Minv);
+    fmpz_init(P);
+    fmpz_init(MP);
 
-    mod_A = flint_malloc(sizeof(nmod_mat_t) * num_primes);
-    mod_B = flint_malloc(sizeof(nmod_mat_t) * num_primes);
-    mod_C = flint_malloc(sizeof(nmod_mat_t) * num_primes);
-    for (i = 0; i < num_primes; i++)
+    for (c0 = 0; c0 < num_primes; c0 += len)
     {
-        nmod_mat_init(mod_A[i], A->r, A->c, primes[i]);
-        nmod_mat_init(mod_B[i], B->r, B->c, primes[i]);
-        nmod_mat_init(mod_C[i], C->r, C->c, primes[i]);
-    }
+        len = FLINT_MIN(chunk, num_primes - c0);
+
+        for (i = 0; i < len; i++)
+        {
+            nmod_mat_init(mod_A + i, A->r, A->c, primes[c0 + i]);
+            nmod_mat_init(mod_B + i, B->r, B->c, primes[c0 + i]);
+            nmod_mat_init(mod_C + i, C->r, C->c, primes[c0 + i]);
+        }
 
-    fmpz_comb_init(comb, primes, num_primes);
-    fmpz_comb_temp_init(comb_temp, comb);
+        fmpz_comb_init(comb, primes + c0, len);
 
-    /* Calculate residues of A */
-    for (i = 0; i < A->r; i++)
-    {   for (j = 0; j < A->c; j++)
-        {   fmpz_multi_mod_ui(residues, &(A->rows[i][j]), comb, comb_temp);
-            for (k = 0; k < num_primes; k++)
-                mod_A[k]->rows[i][j] = residues[k];
+        arg.comb = comb;
+        arg.crt = 0;
+
+        /* Calculate residues of A and B */
+        arg.rows = A->rows;
+        arg.c = A->c;
+        arg.mod = mod_A;
+        _fmpz_mat_multi_mod_threaded(&arg, A->r);
+
+        arg.rows = B->rows;
+        arg.c = B->c;
+        arg.mod = mod_B;
+        _fmpz_mat_multi_mod_threaded(&arg, B->r);
+
+        /* Multiply */
+        _fmpz_mat_mul_mod_threaded(mod_C, mod_A, mod_B, len);
+
+        /* Chinese remaindering, combining with earlier chunks */
+        arg.rows = C->rows;
+        arg.c = C->c;
+        arg.mod = mod_C;
+        arg.crt = 1;
+        arg.sign = (c0 + len == num_primes);
+
+        fmpz_one(P);
+        for (i = 0; i < len; i++)
+            fmpz_mul_ui(P, P, primes[c0 + i]);
+
+        if (c0 == 0)
+        {
+            arg.M = NULL;
+            fmpz_set(M, P);
         }
-    }
+        else
+        {
+            fmpz_invmod(Minv, M, P);
+            fmpz_mul(MP, M, P);
 
-    /* Calculate residues of B */
-    for (i = 0; i < B->r; i++)
-    {   for (j = 0; j < B->c; j++)
-        {   fmpz_multi_mod_ui(residues, &B->rows[i][j], comb, comb_temp);
-            for (k = 0; k < num_primes; k++)
-                mod_B[k]->rows[i][j] = residues[k];
+            arg.M = M;
+            arg.Minv = Minv;
+            arg.P = P;
+            arg.MP = MP;
         }
-    }
 
-    /* Multiply */
-    for (i = 0; i < num_primes; i++)
-    {
-        nmod_mat_mul(mod_C[i], mod_A[i], mod_B[i]);
-    }
+        _fmpz_mat_multi_mod_threaded(&arg, C->r);
+
+        if (c0 != 0)
+            fmpz_swap(M, MP);
+
+        fmpz_comb_clear(comb);
 
-    /* Chinese remaindering */
-    for (i = 0; i < C->r; i++)
-    {   for (j = 0; j < C->c; j++)
-        {   for (k = 0; k < num_primes; k++)
-                residues[k] = mod_C[k]->rows[i][j];
-            fmpz_multi_CRT_ui(&C->rows[i][j], residues, comb, comb_temp, 1);
+        for (i = 0; i < len; i++)
+        {
+            nmod_mat_clear(mod_A + i);
+            nmod_mat_clear(mod_B + i);
+            nmod_mat_clear(mod_C + i);
         }
     }
 
-    /* Cleanup */
-    for (i = 0; i < num_primes; i++)
-    {
-        nmod_mat_clear(mod_A[i]);
-        nmod_mat_clear(mod_B[i]);
-        nmod_mat_clear(mod_C[i]);
-    }
+    fmpz_clear(M);
+    fmpz_clear(Minv);
+    fmpz_clear(P);
+    fmpz_clear(MP);
 
     flint_free(mod_A);
     flint_free(mod_B);
     flint_free(mod_C);
+    flint_free(primes);
+}
 
-    fmpz_comb_temp_clear(comb_temp);
-    fmpz_comb_clear(comb);
+void
+_fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
+    mp_bitcnt_t bits)
+{
+    slong words;
 
-    flint_free(residues);
-    flint_free(primes);
+    /* Words held by the images of A, B and C modulo one prime */
+    words = A->r * A->c + B->r * B->c + C->r * C->c;
+    words = FLINT_MAX(words, 1);
+
+    _fmpz_mat_mul_multi_mod_chunked(C, A, B, bits,
+                             FMPZ_MAT_MUL_MULTI_MOD_MAX_WORDS / words);
 }
 
 void
@@ -23,29 +23,44 @@
 
 ******************************************************************************/
 
+#include "fmpz_vec.h"
 #include "fmpz_mat.h"
 
+/*
+   As in fmpz_mat_multi_mod_ui_precomp, all entries are reconstructed in
+   one call if none of the matrices is a window.
+*/
 void
 fmpz_mat_multi_CRT_ui_precomp(fmpz_mat_t mat,
     nmod_mat_t * const residues, slong nres,
     const fmpz_comb_t comb, fmpz_comb_temp_t temp, int sign)
 {
-    slong i, j, k;
-    mp_ptr r;
+    slong i, k, r = fmpz_mat_nrows(mat), c = fmpz_mat_ncols(mat);
+    mp_ptr * in;
+    int whole = 1;
 
-    r = _nmod_vec_init(nres);
+    if (r == 0 || c == 0)
+        return;
 
-    for (i = 0; i < fmpz_mat_nrows(mat); i++)
+    for (i = 1; i < r && whole; i++)
     {
-        for (j = 0; j < fmpz_mat_ncols(mat); j++)
-        {
-            for (k = 0; k < nres; k++)
-                r[k] = nmod_mat_entry(residues[k], i, j);
-            fmpz_multi_CRT_ui(fmpz_mat_entry(mat, i, j), r, comb, temp, sign);
-        }
+        whole = (mat->rows[i] == mat->rows[0] + i * c);
+        for (k = 0; k < nres && whole; k++)
+            whole = (residues[k]->rows[i] == residues[k]->rows[0] + i * c);
     }
 
-    _nmod_vec_clear(r);
+    in = flint_malloc(sizeof(mp_ptr) * nres);
+
+    for (i = 0; i < (whole ? 1 : r); i++)
+    {
+        for (k = 0; k < nres; k++)
+            in[k] = residues[k]->rows[i];
+
+        _fmpz_vec_multi_CRT_ui(mat->rows[i], in, whole ? r * c : c,
+                               comb, temp, sign);
+    }
+
+    flint_free(in);
 }
 
 void
@@ -23,28 +23,44 @@
 
 ******************************************************************************/
 
+#include "fmpz_vec.h"
 #include "fmpz_mat.h"
 
+/*
+   The rows are reduced one at a time, unless the entries of mat and of
+   the residue matrices are stored consecutively, in which case they are
+   all reduced in one call.
+*/
 void
 fmpz_mat_multi_mod_ui_precomp(nmod_mat_t * residues, slong nres, 
     const fmpz_mat_t mat, const fmpz_comb_t comb, fmpz_comb_temp_t temp)
 {
-    slong i, j, k;
-    mp_ptr r;
+    slong i, k, r = fmpz_mat_nrows(mat), c = fmpz_mat_ncols(mat);
+    mp_ptr * out;
+    int whole = 1;
 
-    r = _nmod_vec_init(nres);
+    if (r == 0 || c == 0)
+        return;
 
-    for (i = 0; i < fmpz_mat_nrows(mat); i++)
+    for (i = 1; i < r && whole; i++)
     {
-        for (j = 0; j < fmpz_mat_ncols(mat); j++)
-        {
-            fmpz_multi_mod_ui(r, fmpz_mat_entry(mat, i, j), comb, temp);
-            for (k = 0; k < nres; k++)
-                nmod_mat_entry(residues[k], i, j) = r[k];
-        }
+        whole = (mat->rows[i] == mat->rows[0] + i * c);
+        for (k = 0; k < nres && whole; k++)
+            whole = (residues[k]->rows[i] == residues[k]->rows[0] + i * c);
     }
 
-    _nmod_vec_clear(r);
+    out = flint_malloc(sizeof(mp_ptr) * nres);
+
+    for (i = 0; i < (whole ? 1 : r); i++)
+    {
+        for (k = 0; k < nres; k++)
+            out[k] = residues[k]->rows[i];
+
+        _fmpz_vec_multi_mod_ui(out, mat->rows[i], whole ? r * c : c,
+                               comb, temp);
+    }
+
+    flint_free(out);
 }
 
 void
@@ -49,6 +49,8 @@ main(void)
     for (i = 0; i < 1000 * flint_test_multiplier(); i++)
     {
         int proved = n_randlimb(state) % 2;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
         m = n_randint(state, 10);
 
         fmpz_mat_init(A, m, m);
@@ -79,6 +81,8 @@ main(void)
     for (i = 0; i < 10000; i++)
     {
         int proved = n_randlimb(state) % 2;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
         m = 2 + n_randint(state, 10);
         fmpz_mat_init(A, m, m);
         fmpz_init(det2);
@@ -100,6 +104,8 @@ main(void)
         fmpz_clear(det2);
     }
 
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -45,7 +45,8 @@ int main(void)
 
     for (i = 0; i < 100 * flint_test_multiplier(); i++)
     {
-        slong m, n, k;
+        slong m, n, k, chunk;
+        mp_bitcnt_t bits;
 
         m = n_randint(state, 50);
         n = n_randint(state, 50);
@@ -71,6 +72,32 @@ int main(void)
             abort();
         }
 
+        /* Threads and chunks of primes, aliasing the output with A */
+        bits = FLINT_ABS(fmpz_mat_max_bits(A))
+             + FLINT_ABS(fmpz_mat_max_bits(B)) + FLINT_BIT_COUNT(n) + 1;
+        chunk = n_randint(state, 4) + 1;
+
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
+        if (n == k && n_randint(state, 2))
+        {
+            fmpz_mat_set(D, A);
+            _fmpz_mat_mul_multi_mod_chunked(D, D, B, bits, chunk);
+        }
+        else
+        {
+            fmpz_mat_randtest(D, state, n_randint(state, 200) + 1);
+            _fmpz_mat_mul_multi_mod_chunked(D, A, B, bits, chunk);
+        }
+
+        flint_set_num_threads(1);
+
+        if (!fmpz_mat_equal(C, D))
+        {
+            flint_printf("FAIL: results not equal (chunk = %wd)\n", chunk);
+            abort();
+        }
+
         fmpz_mat_clear(A);
         fmpz_mat_clear(B);
         fmpz_mat_clear(C);
@@ -49,8 +49,13 @@
  extern "C" {
 #endif
 
-#define FMPZ_MOD_POLY_HGCD_CUTOFF  128      /* HGCD: Basecase -> Recursion      */
-#define FMPZ_MOD_POLY_GCD_CUTOFF  256       /* GCD:  Euclidean -> HGCD          */
+/* HGCD: Basecase -> Recursion */
+#define FMPZ_MOD_POLY_HGCD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FMPZ_MOD_POLY_HGCD)
+
+/* GCD:  Euclidean -> HGCD */
+#define FMPZ_MOD_POLY_GCD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FMPZ_MOD_POLY_GCD)
 
 #define FMPZ_MOD_POLY_INV_NEWTON_CUTOFF  64 /* Inv series newton: Basecase -> Newton */
 
@@ -970,7 +975,7 @@ FLINT_DLL void _fmpz_mod_poly_precompute_matrix (fmpz_mat_t A, const fmpz * poly
                           const fmpz * poly2, slong len2, const fmpz * poly2inv,
                           slong len2inv, const fmpz_t p);
 
-FLINT_DLL void * _fmpz_mod_poly_precompute_matrix_worker(void * arg_ptr);
+FLINT_DLL void _fmpz_mod_poly_precompute_matrix_worker(void * arg_ptr);
 
 FLINT_DLL void fmpz_mod_poly_precompute_matrix(fmpz_mat_t A, const fmpz_mod_poly_t poly1,
                    const fmpz_mod_poly_t poly2, const fmpz_mod_poly_t poly2inv);
@@ -979,7 +984,7 @@ FLINT_DLL void _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv(fmpz * res,
          const fmpz * poly1, slong len1, const fmpz_mat_t A, const fmpz * poly3,
          slong len3, const fmpz * poly3inv, slong len3inv, const fmpz_t p);
 
-FLINT_DLL void * _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr);
+FLINT_DLL void _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr);
 
 FLINT_DLL void fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv(fmpz_mod_poly_t res,
                    const fmpz_mod_poly_t poly1, const fmpz_mat_t A,
@@ -60,7 +60,7 @@ _fmpz_mod_poly_reduce_matrix_mod_poly (fmpz_mat_t A, const fmpz_mat_t B,
     fmpz_clear(invf);
 }
 
-void *
+void
 _fmpz_mod_poly_precompute_matrix_worker (void * arg_ptr)
 {
     fmpz_mod_poly_matrix_precompute_arg_t arg =
@@ -79,8 +79,6 @@ _fmpz_mod_poly_precompute_matrix_worker (void * arg_ptr)
                                      arg.poly1.coeffs, n, arg.poly2.coeffs,
                                      n + 1, arg.poly2inv.coeffs, n + 1,
                                      &arg.poly2.p);
-    flint_cleanup();
-    return NULL;
 }
 
 void
@@ -157,7 +155,7 @@ fmpz_mod_poly_precompute_matrix(fmpz_mat_t A, const fmpz_mod_poly_t poly1,
     _fmpz_vec_clear(ptr, vec_len);
 }
 
-void *
+void
 _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr)
 {
     fmpz_mod_poly_compose_mod_precomp_preinv_arg_t arg=
@@ -170,14 +168,12 @@ _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr)
 
     if (arg.poly3.length == 1)
     {
-        flint_cleanup();
-        return NULL;
+        return;
     }
     if (arg.poly1.length == 1)
     {
         fmpz_set(arg.res.coeffs, arg.poly1.coeffs);
-        flint_cleanup();
-        return NULL;
+        return;
     }
 
     if (arg.poly3.length == 2)
@@ -185,8 +181,7 @@ _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr)
         _fmpz_mod_poly_evaluate_fmpz(arg.res.coeffs, arg.poly1.coeffs,
                                      arg.poly1.length, arg.A.rows[1],
                                      &arg.poly3.p);
-        flint_cleanup();
-        return NULL;
+        return;
     }
 
     m = n_sqrt(n) + 1;
@@ -229,8 +224,6 @@ _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr)
 
     fmpz_mat_clear(B);
     fmpz_mat_clear(C);
-    flint_cleanup();
-    return NULL;
 }
 
 void
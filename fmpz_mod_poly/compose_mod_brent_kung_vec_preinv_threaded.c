@@ -26,7 +26,7 @@
 ******************************************************************************/
 
 #include <gmp.h>
-#include <pthread.h>
+#include "thread_pool.h"
 #include "flint.h"
 #include "fmpz_vec.h"
 #include "fmpz_mod_poly.h"
@@ -50,7 +50,7 @@ typedef struct
 }
 compose_vec_arg_t;
 
-void *
+void
 _fmpz_mod_poly_compose_mod_brent_kung_vec_preinv_worker(void * arg_ptr)
 {
     compose_vec_arg_t arg= *((compose_vec_arg_t *) arg_ptr);
@@ -70,9 +70,6 @@ _fmpz_mod_poly_compose_mod_brent_kung_vec_preinv_worker(void * arg_ptr)
     }
 
     _fmpz_vec_clear(t, n);
-
-    flint_cleanup();
-    return NULL;
 }
 
 void
@@ -85,9 +82,9 @@ _fmpz_mod_poly_compose_mod_brent_kung_vec_preinv_threaded(fmpz_mod_poly_struct *
                                                  slong leninv, const fmpz_t p)
 {
     fmpz_mat_t A, B, C;
-    slong i, j, n, m, k, len2 = l, len1, num_threads, c;
+    slong i, j, n, m, k, len2 = l, len1, num_threads, num_workers, c;
     fmpz *h;
-    pthread_t *threads;
+    thread_pool_handle * threads;
     compose_vec_arg_t * args;
 
     n = len - 1;
@@ -131,9 +128,9 @@ _fmpz_mod_poly_compose_mod_brent_kung_vec_preinv_threaded(fmpz_mod_poly_struct *
     _fmpz_mod_poly_mulmod_preinv(h, A->rows[m - 1], n, A->rows[1], n, poly,
                                  len, polyinv, leninv, p);
 
-    num_threads = flint_get_num_threads();
+    num_workers = flint_request_threads(&threads, len2);
+    num_threads = num_workers + 1;
 
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
     args = flint_malloc(sizeof(compose_vec_arg_t) * num_threads);
 
     for (j = 0; j < len2 / num_threads + 1; j++)
@@ -156,17 +153,22 @@ _fmpz_mod_poly_compose_mod_brent_kung_vec_preinv_threaded(fmpz_mod_poly_struct *
                 args[i].polyinv = (fmpz *) polyinv;
                 args[i].leninv  = leninv;
                 args[i].p       = *p;
-
-                pthread_create(&threads[i], NULL,
-                        _fmpz_mod_poly_compose_mod_brent_kung_vec_preinv_worker,
-                        &args[i]);
             }
         }
-        for (i = 0; i < c; i++)
-            pthread_join(threads[i], NULL);
+
+        for (i = 1; i < c; i++)
+            thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                    _fmpz_mod_poly_compose_mod_brent_kung_vec_preinv_worker,
+                    &args[i]);
+
+        if (c > 0)
+            _fmpz_mod_poly_compose_mod_brent_kung_vec_preinv_worker(&args[0]);
+
+        for (i = 1; i < c; i++)
+            thread_pool_wait(global_thread_pool, threads[i - 1]);
     }
 
-    flint_free(threads);
+    flint_give_back_threads(threads, num_workers);
     flint_free(args);
 
     _fmpz_vec_clear(h, n);
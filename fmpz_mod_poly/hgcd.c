@@ -418,7 +418,7 @@ slong _fmpz_mod_poly_hgcd_recursive(fmpz **M, slong *lenM,
            res->off += m;
         }
 
-        if (lena0 < NMOD_POLY_HGCD_CUTOFF)
+        if (lena0 < FMPZ_MOD_POLY_HGCD_CUTOFF)
             sgnR = _fmpz_mod_poly_hgcd_recursive_iter(R, lenR, &a3, &lena3, &b3, &lenb3, 
                                             a0, lena0, b0, lenb0, 
                                             q, &T0, &T1, mod, res);
@@ -551,7 +551,7 @@ slong _fmpz_mod_poly_hgcd_recursive(fmpz **M, slong *lenM,
                res->off += k;
             } 
             
-            if (lenc0 < NMOD_POLY_HGCD_CUTOFF)
+            if (lenc0 < FMPZ_MOD_POLY_HGCD_CUTOFF)
                 sgnS = _fmpz_mod_poly_hgcd_recursive_iter(S, lenS, &a3, &lena3, &b3, &lenb3, 
                                                 c0, lenc0, d0, lend0, 
                                                 a2, &T0, &T1, mod, res); /* a2 as temp */
@@ -34,11 +34,11 @@
 #undef ulong
 
 #include <gmp.h>
-#include <pthread.h>
 
 #define ulong mp_limb_t
 
 #include "flint.h"
+#include "thread_pool.h"
 #include "fmpz_mod_poly.h"
 #include "ulong_extras.h"
 
@@ -57,15 +57,15 @@ main(void)
         fmpz_mod_poly_t a, b, c, cinv, * tmp;
         fmpz_t p;
         fmpz_mat_t B, *C;
-        slong j, num_threads;
+        slong j, num_threads, num_workers;
         fmpz_mod_poly_matrix_precompute_arg_t * args1;
-        pthread_t *threads;
+        thread_pool_handle * threads;
 
         flint_set_num_threads(1 + n_randint(state, 3));
 
         num_threads = flint_get_num_threads();
 
-        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        num_workers = flint_request_threads(&threads, num_threads);
         tmp = flint_malloc(sizeof(fmpz_mod_poly_t) * num_threads);
 
         fmpz_init(p);
@@ -112,11 +112,14 @@ main(void)
             args1[j].poly2    = *c;
             args1[j].poly2inv = *cinv;
 
-            pthread_create(&threads[j], NULL,
-                           _fmpz_mod_poly_precompute_matrix_worker, &args1[j]);
+            if (j < num_workers)
+                thread_pool_wake(global_thread_pool, threads[j], 0,
+                                 _fmpz_mod_poly_precompute_matrix_worker, &args1[j]);
+            else
+                _fmpz_mod_poly_precompute_matrix_worker(&args1[j]);
         }
-        for (j = 0; j < num_threads; j++)
-            pthread_join(threads[j], NULL);
+        for (j = 0; j < num_workers; j++)
+            thread_pool_wait(global_thread_pool, threads[j]);
 
         for (j = 0; j < num_threads; j++)
         {
@@ -146,7 +149,7 @@ main(void)
         flint_free(C);
         flint_free(tmp);
         flint_free(args1);
-        flint_free(threads);
+        flint_give_back_threads(threads, num_workers);
     }
 
     /* check composition */
@@ -155,15 +158,15 @@ main(void)
         fmpz_mod_poly_t a, b, c, cinv, d, *res;
         fmpz_t p;
         fmpz_mat_t B;
-        slong j, num_threads;
+        slong j, num_threads, num_workers;
         fmpz_mod_poly_compose_mod_precomp_preinv_arg_t * args1;
-        pthread_t *threads;
+        thread_pool_handle * threads;
 
         flint_set_num_threads(1 + n_randint(state, 3));
 
         num_threads = flint_get_num_threads();
 
-        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        num_workers = flint_request_threads(&threads, num_threads);
         res = flint_malloc(sizeof(fmpz_mod_poly_t) * num_threads);
 
         fmpz_init(p);
@@ -206,12 +209,16 @@ main(void)
             args1[j].poly3    = *c;
             args1[j].poly3inv = *cinv;
 
-            pthread_create(&threads[j], NULL,
-                           _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker, &args1[j]);
+            if (j < num_workers)
+                thread_pool_wake(global_thread_pool, threads[j], 0,
+                                 _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker, &args1[j]);
+            else
+                _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker(&args1[j]);
         }
         for (j = 0; j < num_threads; j++)
         {
-            pthread_join(threads[j], NULL);
+            if (j < num_workers)
+                thread_pool_wait(global_thread_pool, threads[j]);
             _fmpz_mod_poly_normalise(res[j]);
         }
 
@@ -240,7 +247,7 @@ main(void)
             fmpz_mod_poly_clear(res[j]);
         flint_free(res);
         flint_free(args1);
-        flint_free(threads);
+        flint_give_back_threads(threads, num_workers);
     }
 
     FLINT_TEST_CLEANUP(state);
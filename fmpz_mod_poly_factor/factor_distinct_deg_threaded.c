@@ -28,7 +28,6 @@
 #define ulong ulongxx/* interferes with system includes */
 
 #include <math.h>
-#include <pthread.h>
 
 #undef ulong
 
@@ -36,9 +35,10 @@
 
 #define ulong mp_limb_t
 
+#include "thread_pool.h"
 #include "fmpz_mod_poly.h"
 
-void *
+void
 _fmpz_mod_poly_interval_poly_worker(void* arg_ptr)
 {
     fmpz_mod_poly_interval_poly_arg_t arg =
@@ -74,8 +74,6 @@ _fmpz_mod_poly_interval_poly_worker(void* arg_ptr)
 
     _fmpz_vec_clear(tmp, arg.v.length - 1);
     fmpz_clear(invV);
-    flint_cleanup();
-    return NULL;
 }
 
 void
@@ -85,11 +83,11 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
     fmpz_mod_poly_t f, g, v, vinv, tmp, II;
     fmpz_mod_poly_t *h, *H, *I, *scratch;
     slong i, j, k, l, m, n, index, d, c1 = 1, c2;
-    slong num_threads = flint_get_num_threads();
+    slong num_threads, num_workers;
     fmpz_t p;
     fmpz_mat_t * HH;
     double beta;
-    pthread_t *threads;
+    thread_pool_handle * threads;
     fmpz_mod_poly_matrix_precompute_arg_t * args1;
     fmpz_mod_poly_compose_mod_precomp_preinv_arg_t * args2;
     fmpz_mod_poly_interval_poly_arg_t * args3;
@@ -119,6 +117,9 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
     fmpz_mod_poly_init(tmp, p);
     fmpz_mod_poly_init(II, p);
 
+    num_workers = flint_request_threads(&threads, flint_get_num_threads());
+    num_threads = num_workers + 1;
+
     if (!(h = flint_malloc((2 * m + l + 1+ num_threads)
                            * sizeof(fmpz_mod_poly_struct))))
     {
@@ -140,7 +141,6 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
         fmpz_mod_poly_init(scratch[i], p);
 
     HH      = flint_malloc(sizeof(fmpz_mat_t) * (num_threads + 1));
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
     args1   = flint_malloc(num_threads *
                            sizeof(fmpz_mod_poly_matrix_precompute_arg_t));
     args2   = flint_malloc(num_threads *
@@ -262,11 +262,11 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
                 args1[i].poly2    = *v;
                 args1[i].poly2inv = *vinv;
 
-                pthread_create(&threads[i], NULL,
+                thread_pool_wake(global_thread_pool, threads[i - 1], 0,
                             _fmpz_mod_poly_precompute_matrix_worker, &args1[i]);
             }
             for (i = 1; i < c1; i++)
-                pthread_join(threads[i], NULL);
+                thread_pool_wait(global_thread_pool, threads[i - 1]);
 
             fmpz_mod_poly_rem(tmp, H[num_threads - 1], v);
             for (i = 0; i < c1; i++)
@@ -279,12 +279,17 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
                 args2[i].poly3    = *v;
                 args2[i].poly3inv = *vinv;
 
-                pthread_create(&threads[i], NULL,
+                if (i > 0)
+                    thread_pool_wake(global_thread_pool, threads[i - 1], 0,
         _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker, &args2[i]);
             }
+
+            _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker(
+                                                                  &args2[0]);
             for (i = 0; i < c1; i++)
             {
-                pthread_join(threads[i], NULL);
+                if (i > 0)
+                    thread_pool_wait(global_thread_pool, threads[i - 1]);
                 _fmpz_mod_poly_normalise(H[num_threads + i]);
             }
 
@@ -300,13 +305,17 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
                 args3[i].v    = *v;
                 args3[i].vinv = *vinv;
 
-                pthread_create(&threads[i], NULL,
+                if (i > 0)
+                    thread_pool_wake(global_thread_pool, threads[i - 1], 0,
                                _fmpz_mod_poly_interval_poly_worker, &args3[i]);
             }
 
+            _fmpz_mod_poly_interval_poly_worker(&args3[0]);
+
             for (i = 0; i < c1; i++)
             {
-                pthread_join(threads[i], NULL);
+                if (i > 0)
+                    thread_pool_wait(global_thread_pool, threads[i - 1]);
                 _fmpz_mod_poly_normalise(I[num_threads + i]);
             }
 
@@ -366,12 +375,17 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
                 args2[i].poly3    = *v;
                 args2[i].poly3inv = *vinv;
 
-                pthread_create(&threads[i], NULL,
+                if (i > 0)
+                    thread_pool_wake(global_thread_pool, threads[i - 1], 0,
         _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker, &args2[i]);
             }
+
+            _fmpz_mod_poly_compose_mod_brent_kung_precomp_preinv_worker(
+                                                                  &args2[0]);
             for (i = 0; i < c2; i++)
             {
-                pthread_join(threads[i], NULL);
+                if (i > 0)
+                    thread_pool_wait(global_thread_pool, threads[i - 1]);
                 _fmpz_mod_poly_normalise(H[j * num_threads + i]);
             }
 
@@ -388,13 +402,17 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
                 args3[i].v    = *v;
                 args3[i].vinv = *vinv;
 
-                pthread_create(&threads[i], NULL,
+                if (i > 0)
+                    thread_pool_wake(global_thread_pool, threads[i - 1], 0,
                                _fmpz_mod_poly_interval_poly_worker, &args3[i]);
             }
 
+            _fmpz_mod_poly_interval_poly_worker(&args3[0]);
+
             for (i = 0; i < c2; i++)
             {
-                pthread_join(threads[i], NULL);
+                if (i > 0)
+                    thread_pool_wait(global_thread_pool, threads[i - 1]);
                 _fmpz_mod_poly_normalise(I[j * num_threads + i]);
             }
 
@@ -489,5 +507,5 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
     flint_free(args1);
     flint_free(args2);
     flint_free(args3);
-    flint_free(threads);
+    flint_give_back_threads(threads, num_workers);
 }
@@ -55,6 +55,9 @@
 
 #define FMPZ_POLY_INV_NEWTON_CUTOFF 32
 
+/* Smallest length of a factor whose subtree is Hensel lifted in a thread */
+#define FMPZ_POLY_HENSEL_LIFT_TREE_THREADED_CUTOFF 64
+
 /*  Type definitions *********************************************************/
 
 typedef struct
@@ -74,6 +77,20 @@ typedef struct
 
 typedef fmpz_poly_powers_precomp_struct fmpz_poly_powers_precomp_t[1];
 
+typedef struct
+{
+    mp_limb_t ** jj;   /* forward transform of poly2 */
+    slong n;
+    slong len1;        /* bounds on the length and bits of the other */
+    slong bits1;       /* operand for which jj can be used */
+    slong len2;
+    slong loglen;
+    slong limbs;
+    fmpz_poly_t poly2;
+} fmpz_poly_mul_precache_struct;
+
+typedef fmpz_poly_mul_precache_struct fmpz_poly_mul_precache_t[1];
+
 typedef struct {
     fmpz c;
     fmpz_poly_struct *p;
@@ -455,6 +472,37 @@ FLINT_DLL void _fmpz_poly_mullow_SS(fmpz * output, const fmpz * input1, slong le
 FLINT_DLL void fmpz_poly_mullow_SS(fmpz_poly_t res,
                   const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n);
 
+FLINT_DLL void fmpz_poly_mul_SS_precache_init(fmpz_poly_mul_precache_t pre,
+                          slong len1, slong bits1, const fmpz_poly_t poly2);
+
+FLINT_DLL void fmpz_poly_mul_precache_clear(fmpz_poly_mul_precache_t pre);
+
+FLINT_DLL void _fmpz_poly_mullow_SS_precache(fmpz * output, 
+     const fmpz * input1, slong len1, fmpz_poly_mul_precache_t pre, slong n);
+
+FLINT_DLL void fmpz_poly_mullow_SS_precache(fmpz_poly_t res, 
+            const fmpz_poly_t poly1, fmpz_poly_mul_precache_t pre, slong n);
+
+FLINT_DLL void fmpz_poly_mul_SS_precache(fmpz_poly_t res, 
+                     const fmpz_poly_t poly1, fmpz_poly_mul_precache_t pre);
+
+/*
+   Whether multiplication of polynomials of the given lengths and bit
+   sizes is done by Schoenhage-Strassen, so that precaching the transform
+   of one operand is worthwhile
+*/
+static __inline__ int
+_fmpz_poly_mul_precache_worthwhile(slong len1, slong bits1, 
+                                                 slong len2, slong bits2)
+{
+    slong limbs = (FLINT_ABS(bits1) + FLINT_BITS - 1) / FLINT_BITS
+                + (FLINT_ABS(bits2) + FLINT_BITS - 1) / FLINT_BITS;
+
+    return len1 >= 16 && len2 >= 16 && limbs > 8 
+        && limbs / 2048 <= len1 + len2 
+        && limbs * FLINT_BITS * 4 >= len1 + len2;
+}
+
 FLINT_DLL void _fmpz_poly_mul(fmpz * res, const fmpz * poly1, 
                                   slong len1, const fmpz * poly2, slong len2);
 
@@ -36,28 +36,88 @@ _fmpz_poly_div_preinv(fmpz * Q, const fmpz * A, slong len1_in,
    slong n = len1 - len2 + 1;
    fmpz * A_rev;
    fmpz * a;
+   fmpz_poly_mul_precache_t pre_inv, pre_B;
+   int precache = 0;
    
    if (n > len2)
    {
+      slong bits1 = _fmpz_vec_max_bits(A, len1_in);
+      slong bits2 = _fmpz_vec_max_bits(B_inv, len2);
+
       a = _fmpz_vec_init(len1_in);
       _fmpz_vec_set(a, A, len1_in);
-      
-      do {
-         slong start = n - len2;
-         _fmpz_poly_divrem_preinv(Q + start, a + start, len1 - start, 
+
+      /*
+         Every block of the quotient is a product by B_inv and every
+         update of the dividend a product by B, so with at least two
+         blocks the transforms of B_inv and B are computed only once
+      */
+      if (n > 2*len2 && 
+          _fmpz_poly_mul_precache_worthwhile(len2, bits1, len2 - 1, bits2))
+      {
+         fmpz_poly_struct P[1];
+         fmpz * W = _fmpz_vec_init(len2);
+
+         P->coeffs = (fmpz *) B_inv;
+         P->length = P->alloc = len2;
+         fmpz_poly_mul_SS_precache_init(pre_inv, len2, bits1, P);
+
+         do {
+            slong start = n - len2;
+
+            _fmpz_poly_reverse(W, a + start + len2 - 1, len2, len2);
+            _fmpz_poly_mullow_SS_precache(Q + start, W, len2, pre_inv, len2);
+            _fmpz_poly_reverse(Q + start, Q + start, len2, len2);
+
+            /* The size of the first block of the quotient is a better 
+               bound than can be derived from A and B_inv */
+            if (!precache)
+            {
+               P->coeffs = (fmpz *) B;
+               P->length = P->alloc = len2 - 1;
+               fmpz_poly_mul_SS_precache_init(pre_B, len2, 
+                                 _fmpz_vec_max_bits(Q + start, len2), P);
+               precache = 1;
+            }
+
+            _fmpz_poly_mullow_SS_precache(W, Q + start, len2, pre_B, 
+                                                                 len2 - 1);
+            _fmpz_poly_sub(a + start, a + start, len2 - 1, W, len2 - 1);
+
+            n -= len2;
+            len1 -= len2;
+         } while (n > len2);
+
+         fmpz_poly_mul_precache_clear(pre_B);
+         _fmpz_vec_clear(W, len2);
+      }
+      else
+      {
+         do {
+            slong start = n - len2;
+            _fmpz_poly_divrem_preinv(Q + start, a + start, len1 - start, 
                                                                B, B_inv, len2);
-         n -= len2;
-         len1 -= len2;
-      } while (n > len2);
+            n -= len2;
+            len1 -= len2;
+         } while (n > len2);
+      }
    } else
       a = (fmpz *) A;
 
    A_rev = _fmpz_vec_init(len1);
    
    _fmpz_poly_reverse(A_rev, a, len1, len1);
-   _fmpz_poly_mullow(Q, A_rev, len1, B_inv, len2, n);
+
+   /* A short last block is cheaper with a truncated product */
+   if (precache && FLINT_CLOG2(2*n - 1) == pre_inv->loglen)
+      _fmpz_poly_mullow_SS_precache(Q, A_rev, FLINT_MIN(len1, n), pre_inv, n);
+   else
+      _fmpz_poly_mullow(Q, A_rev, len1, B_inv, len2, n);
    _fmpz_poly_reverse(Q, Q, n, n);
 
+   if (precache)
+      fmpz_poly_mul_precache_clear(pre_inv);
+
    if (a != A)
       _fmpz_vec_clear(a, len1_in);
    _fmpz_vec_clear(A_rev, len1);
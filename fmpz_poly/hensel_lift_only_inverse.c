@@ -36,7 +36,8 @@
 
     Assumes that {C, lenC} contains the inner part {(1 - aG - bH)/p} mod p1, 
     where lenC = max(lenA + lenG - 1, lenB + lenH - 1).  Requires temporary 
-    space M, D, E.  We really only need 
+    space M, D, E, and if pre is not NULL, uses it for the product 
+    by b.  We really only need 
         lenM = max(lenG, lenH)
         lenE = max(lenG + lenB - 2, lenH + lenA - 2)
         lenD = max(lenC, lenE)
@@ -46,11 +47,18 @@
     it suffices to have g modulo p, there is no harm in supplying 
     {g, lenG} only reduced modulo p p1.
  */
-#define liftinv(B, b, lenB, g, lenG)                                  \
+#define liftinv(B, b, lenB, g, lenG, pre)                             \
 do {                                                                  \
     _fmpz_vec_scalar_mod_fmpz(M, g, lenG, p1);                        \
     _fmpz_mod_poly_rem(D, C, lenC, M, lenG, one, p1);                 \
-    _fmpz_mod_poly_mul(E, D, lenG - 1, b, lenB, p1);                  \
+    if (pre != NULL)                                                  \
+    {                                                                 \
+        _fmpz_poly_mullow_SS_precache(E, D, lenG - 1, pre,            \
+                                             lenG + lenB - 2);        \
+        _fmpz_vec_scalar_mod_fmpz(E, E, lenG + lenB - 2, p1);         \
+    }                                                                 \
+    else                                                              \
+        _fmpz_mod_poly_mul(E, D, lenG - 1, b, lenB, p1);              \
     if (lenB > 1)                                                     \
     {                                                                 \
         _fmpz_mod_poly_rem(D, E, lenG + lenB - 2, M, lenG, one, p1);  \
@@ -75,16 +83,55 @@ void _fmpz_poly_hensel_lift_only_inverse(fmpz *A, fmpz *B,
     const slong lenD = FLINT_MAX(lenC, lenE);
     fmpz *C, *D, *E, *M;
 
+    fmpz_poly_mul_precache_t pre_a, pre_b;
+    fmpz_poly_mul_precache_struct * pa = NULL, * pb = NULL;
+    fmpz_poly_struct P[1];
+    slong bits;
+    int use_a, use_b;
+
     C = _fmpz_vec_init(lenC + lenD + lenD + lenM);
     D = C + lenC;
     E = D + lenD;
     M = E + lenE;
 
-    if (lenG >= lenA)
+    /*
+       The cofactors a and b are each multiplied by a factor and then by
+       a residue modulo p1 of the same length, so their transforms are
+       shared between the two products when these go through FFTs
+    */
+    bits = FLINT_MAX(FLINT_ABS(_fmpz_vec_max_bits(G, lenG)),
+                     FLINT_ABS(_fmpz_vec_max_bits(H, lenH)));
+    bits = FLINT_MAX(bits, fmpz_bits(p1));
+
+    use_a = _fmpz_poly_mul_precache_worthwhile(FLINT_MAX(lenG, lenH - 1), 
+                                  bits, lenA, _fmpz_vec_max_bits(a, lenA));
+    use_b = _fmpz_poly_mul_precache_worthwhile(FLINT_MAX(lenH, lenG - 1), 
+                                  bits, lenB, _fmpz_vec_max_bits(b, lenB));
+
+    if (use_a)
+    {
+        P->coeffs = (fmpz *) a;
+        P->length = P->alloc = lenA;
+        fmpz_poly_mul_SS_precache_init(pre_a, 
+                                      FLINT_MAX(lenG, lenH - 1), bits, P);
+        pa = pre_a;
+        _fmpz_poly_mullow_SS_precache(C, G, lenG, pre_a, lenG + lenA - 1);
+    }
+    else if (lenG >= lenA)
         _fmpz_poly_mul(C, G, lenG, a, lenA);
     else
         _fmpz_poly_mul(C, a, lenA, G, lenG);
-    if (lenH >= lenB)
+
+    if (use_b)
+    {
+        P->coeffs = (fmpz *) b;
+        P->length = P->alloc = lenB;
+        fmpz_poly_mul_SS_precache_init(pre_b, 
+                                      FLINT_MAX(lenH, lenG - 1), bits, P);
+        pb = pre_b;
+        _fmpz_poly_mullow_SS_precache(D, H, lenH, pre_b, lenH + lenB - 1);
+    }
+    else if (lenH >= lenB)
         _fmpz_poly_mul(D, H, lenH, b, lenB);
     else
         _fmpz_poly_mul(D, b, lenB, H, lenH);
@@ -94,8 +141,13 @@ void _fmpz_poly_hensel_lift_only_inverse(fmpz *A, fmpz *B,
     _fmpz_vec_scalar_divexact_fmpz(D, C, lenC, p);
     _fmpz_vec_scalar_mod_fmpz(C, D, lenC, p1);
 
-    liftinv(B, b, lenB, G, lenG);
-    liftinv(A, a, lenA, H, lenH);
+    liftinv(B, b, lenB, G, lenG, pb);
+    liftinv(A, a, lenA, H, lenH, pa);
+
+    if (use_a)
+        fmpz_poly_mul_precache_clear(pre_a);
+    if (use_b)
+        fmpz_poly_mul_precache_clear(pre_b);
 
     _fmpz_vec_clear(C, lenC + lenD + lenD + lenM);
 }
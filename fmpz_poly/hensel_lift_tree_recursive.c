@@ -26,15 +26,41 @@
 
 #include <gmp.h>
 #include "flint.h"
+#include "thread_pool.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
 
+typedef struct
+{
+    slong * link;
+    fmpz_poly_t * v;
+    fmpz_poly_t * w;
+    slong j;
+    slong inv;
+    const fmpz * p0;
+    const fmpz * p1;
+}
+hensel_lift_tree_arg_t;
+
+static void
+_fmpz_poly_hensel_lift_tree_worker(void * arg_ptr)
+{
+    hensel_lift_tree_arg_t * arg = (hensel_lift_tree_arg_t *) arg_ptr;
+
+    fmpz_poly_hensel_lift_tree_recursive(arg->link, arg->v, arg->w, 
+        arg->v[arg->j], arg->link[arg->j], arg->inv, arg->p0, arg->p1);
+}
+
 void fmpz_poly_hensel_lift_tree_recursive(slong *link, 
     fmpz_poly_t *v, fmpz_poly_t *w, fmpz_poly_t f, slong j, slong inv, 
     const fmpz_t p0, const fmpz_t p1)
 {
     if (j >= 0)
     {
+        int num_threads = flint_get_num_threads();
+        thread_pool_handle * threads = NULL;
+        slong num_workers = 0;
+
         if (inv == 1)
             fmpz_poly_hensel_lift(v[j], v[j + 1], w[j], w[j + 1], f, 
                                   v[j], v[j + 1], w[j], w[j + 1], 
@@ -47,10 +73,46 @@ void fmpz_poly_hensel_lift_tree_recursive(slong *link,
                                                   v[j], v[j+1], w[j], w[j+1], 
                                                   p0, p1);
 
-        fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j], link[j], 
-            inv, p0, p1);
-        fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j+1], link[j+1], 
-            inv, p0, p1);
+        /* 
+           The two subtrees involve disjoint entries of v and w, so the
+           second can be lifted in another thread with half of the threads
+        */
+        if (num_threads > 1 && link[j] >= 0 && link[j + 1] >= 0 && 
+            FLINT_MIN(v[j]->length, v[j + 1]->length) 
+                                >= FMPZ_POLY_HENSEL_LIFT_TREE_THREADED_CUTOFF)
+            num_workers = flint_request_threads(&threads, 2);
+
+        if (num_workers != 0)
+        {
+            hensel_lift_tree_arg_t arg;
+
+            arg.link = link;
+            arg.v = v;
+            arg.w = w;
+            arg.j = j + 1;
+            arg.inv = inv;
+            arg.p0 = p0;
+            arg.p1 = p1;
+
+            thread_pool_wake(global_thread_pool, threads[0],
+               num_threads / 2 - 1, _fmpz_poly_hensel_lift_tree_worker, &arg);
+
+            _flint_set_num_workers(num_threads - num_threads / 2 - 1);
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j], link[j], 
+                inv, p0, p1);
+            _flint_set_num_workers(num_threads - 1);
+
+            thread_pool_wait(global_thread_pool, threads[0]);
+            flint_give_back_threads(threads, num_workers);
+        }
+        else
+        {
+            flint_give_back_threads(threads, num_workers);
+
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j], link[j], 
+                inv, p0, p1);
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j+1], 
+                link[j+1], inv, p0, p1);
+        }
     }
 }
-
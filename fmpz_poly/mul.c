@@ -138,19 +138,25 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
 
         if (rbits <= FLINT_BITS - 2)
         {
-            _fmpz_poly_mul_tiny1(res, poly1, len1, poly2, len2);
+            FLINT_STATS_CALL(FLINT_STATS_FMPZ_POLY_MUL_TINY,
+                len1, FLINT_MAX(bits1, bits2),
+                _fmpz_poly_mul_tiny1(res, poly1, len1, poly2, len2));
             return;
         }
         else if (rbits <= 2 * FLINT_BITS - 1)
         {
-            _fmpz_poly_mul_tiny2(res, poly1, len1, poly2, len2);
+            FLINT_STATS_CALL(FLINT_STATS_FMPZ_POLY_MUL_TINY,
+                len1, FLINT_MAX(bits1, bits2),
+                _fmpz_poly_mul_tiny2(res, poly1, len1, poly2, len2));
             return;
         }
     }
 
     if (len2 < 7)
     {
-        _fmpz_poly_mul_classical(res, poly1, len1, poly2, len2);
+        FLINT_STATS_CALL(FLINT_STATS_FMPZ_POLY_MUL_CLASSICAL,
+            len1, FLINT_MAX(bits1, bits2),
+            _fmpz_poly_mul_classical(res, poly1, len1, poly2, len2));
         return;
     }
 
@@ -158,15 +164,18 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
     limbs2 = (bits2 + FLINT_BITS - 1) / FLINT_BITS;
 
     if (len1 < 16 && (limbs1 > 12 || limbs2 > 12))
-        _fmpz_poly_mul_karatsuba(res, poly1, len1, poly2, len2);
-    else if (limbs1 + limbs2 <= 8)
-        _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
-    else if ((limbs1+limbs2)/2048 > len1 + len2)
-        _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
-    else if ((limbs1 + limbs2)*FLINT_BITS*4 < len1 + len2)
-       _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
+        FLINT_STATS_CALL(FLINT_STATS_FMPZ_POLY_MUL_KARATSUBA,
+            len1, FLINT_MAX(bits1, bits2),
+            _fmpz_poly_mul_karatsuba(res, poly1, len1, poly2, len2));
+    else if (limbs1 + limbs2 <= 8 || (limbs1+limbs2)/2048 > len1 + len2 ||
+             (limbs1 + limbs2)*FLINT_BITS*4 < len1 + len2)
+        FLINT_STATS_CALL(FLINT_STATS_FMPZ_POLY_MUL_KS,
+            len1, FLINT_MAX(bits1, bits2),
+            _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2));
     else
-       _fmpz_poly_mul_SS(res, poly1, len1, poly2, len2);
+        FLINT_STATS_CALL(FLINT_STATS_FMPZ_POLY_MUL_SS,
+            len1, FLINT_MAX(bits1, bits2),
+            _fmpz_poly_mul_SS(res, poly1, len1, poly2, len2));
 }
 
 void
@@ -0,0 +1,88 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include "fmpz_poly.h"
+#include "fft.h"
+
+void
+fmpz_poly_mul_SS_precache_init(fmpz_poly_mul_precache_t pre,
+                           slong len1, slong bits1, const fmpz_poly_t poly2)
+{
+    slong len2 = poly2->length, len_out, loglen2, output_bits, bits2;
+    slong i, size;
+    mp_limb_t * ptr, * t1, * t2, * s1;
+
+    if (len1 < 2 || len2 < 2)
+    {
+        flint_printf("Exception (fmpz_poly_mul_SS_precache_init). "
+                     "Operands must have length at least 2.\n");
+        abort();
+    }
+
+    len_out = len1 + len2 - 1;
+
+    pre->len1 = len1;
+    pre->len2 = len2;
+    pre->bits1 = FLINT_ABS(bits1);
+    pre->loglen = FLINT_CLOG2(len_out);
+    pre->n = (WORD(1) << (pre->loglen - 2));
+
+    bits2 = _fmpz_vec_max_bits(poly2->coeffs, len2);
+    bits2 = FLINT_ABS(bits2);
+    loglen2 = FLINT_CLOG2(FLINT_MIN(len1, len2));
+
+    /* Room for the sign of the output, which is not known in advance */
+    output_bits = pre->bits1 + bits2 + loglen2 + 1;
+
+    /* round up output bits for sqrt2 */
+    output_bits = (((output_bits - 1) >> (pre->loglen - 2)) + 1) 
+                                                     << (pre->loglen - 2);
+
+    pre->limbs = (output_bits - 1) / FLINT_BITS + 1;
+    pre->limbs = fft_adjust_limbs(pre->limbs); /* round up for Nussbaumer */
+    size = pre->limbs + 1;
+
+    /* The rounding leaves room for larger operands at no cost */
+    pre->bits1 = pre->limbs * FLINT_BITS - bits2 - loglen2 - 1;
+
+    /* 
+       The temporary space is kept with the transform, as the butterflies
+       swap it with the coefficients
+    */
+    pre->jj = flint_malloc((4*(pre->n + pre->n*size) + 3*size)
+                                                       *sizeof(mp_limb_t));
+    for (i = 0, ptr = (mp_limb_t *) pre->jj + 4*pre->n; 
+                                         i < 4*pre->n; i++, ptr += size) 
+        pre->jj[i] = ptr;
+    t1 = ptr;
+    t2 = t1 + size;
+    s1 = t2 + size;
+
+    _fmpz_vec_get_fft(pre->jj, poly2->coeffs, pre->limbs, len2);
+    for (i = len2; i < 4*pre->n; i++)
+        flint_mpn_zero(pre->jj[i], size);
+
+    fft_precache(pre->jj, pre->loglen - 2, pre->limbs, len_out, 
+                                                         &t1, &t2, &s1);
+
+    fmpz_poly_init(pre->poly2);
+    fmpz_poly_set(pre->poly2, poly2);
+}
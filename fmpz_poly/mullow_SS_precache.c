@@ -0,0 +1,100 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include "fmpz_poly.h"
+#include "fft.h"
+
+void _fmpz_poly_mullow_SS_precache(fmpz * output, const fmpz * input1, 
+                    slong len1, fmpz_poly_mul_precache_t pre, slong trunc)
+{
+    slong i, n = pre->n, limbs = pre->limbs, size = limbs + 1, bits1;
+    mp_limb_t * ptr, * t1, * t2, * tt, * s1, ** ii;
+
+    bits1 = _fmpz_vec_max_bits(input1, len1);
+    bits1 = FLINT_ABS(bits1);
+
+    /* Recompute the transform if it is too small for this operand */
+    if (len1 > pre->len1 || bits1 > pre->bits1)
+    {
+        fmpz_poly_mul_precache_t t;
+
+        fmpz_poly_mul_SS_precache_init(t, FLINT_MAX(len1, pre->len1),
+                                 FLINT_MAX(bits1, pre->bits1), pre->poly2);
+        fmpz_poly_mul_precache_clear(pre);
+        *pre = *t;
+
+        n = pre->n;
+        limbs = pre->limbs;
+        size = limbs + 1;
+    }
+
+    ii = flint_malloc((4*(n + n*size) + 5*size)*sizeof(mp_limb_t));
+    for (i = 0, ptr = (mp_limb_t *) ii + 4*n; i < 4*n; i++, ptr += size) 
+        ii[i] = ptr;
+    t1 = ptr;
+    t2 = t1 + size;
+    s1 = t2 + size;
+    tt = s1 + size;
+
+    _fmpz_vec_get_fft(ii, input1, limbs, len1);
+    for (i = len1; i < 4*n; i++)
+        flint_mpn_zero(ii[i], size);
+
+    fft_convolution_precache(ii, pre->jj, pre->loglen - 2, limbs, 
+                          pre->len1 + pre->len2 - 1, &t1, &t2, &s1, tt); 
+
+    _fmpz_vec_set_fft(output, trunc, ii, limbs, 1); /* write output */
+
+    flint_free(ii); 
+}
+
+void
+fmpz_poly_mullow_SS_precache(fmpz_poly_t res, 
+              const fmpz_poly_t poly1, fmpz_poly_mul_precache_t pre, slong n)
+{
+    const slong len1 = poly1->length;
+
+    if (len1 == 0 || n == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    n = FLINT_MIN(n, len1 + pre->len2 - 1);
+
+    if (res == poly1)
+    {
+        fmpz_poly_t t;
+        fmpz_poly_init2(t, n);
+        _fmpz_poly_mullow_SS_precache(t->coeffs, poly1->coeffs, len1, pre, n);
+        fmpz_poly_swap(res, t);
+        fmpz_poly_clear(t);
+    }
+    else
+    {
+        fmpz_poly_fit_length(res, n);
+        _fmpz_poly_mullow_SS_precache(res->coeffs, poly1->coeffs, len1, 
+                                                                   pre, n);
+    }
+
+    _fmpz_poly_set_length(res, n);
+    _fmpz_poly_normalise(res);
+}
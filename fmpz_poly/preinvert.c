@@ -70,11 +70,43 @@ _fmpz_poly_preinvert(fmpz * Binv, const fmpz * B, slong len)
         
         for (i--; i >= 0; i--)
         {
+            slong bitsT, bitsB, bitsW;
+
             m = n;
             n = a[i];
 
-            _fmpz_poly_mullow(W, T, n, Binv, m, n);
-            _fmpz_poly_mullow(Binv + m, Binv, m, W + m, n - m, n - m);
+            bitsT = _fmpz_vec_max_bits(T, n);
+            bitsT = FLINT_ABS(bitsT);
+            bitsB = _fmpz_vec_max_bits(Binv, m);
+            bitsB = FLINT_ABS(bitsB);
+            bitsW = bitsT + bitsB + FLINT_CLOG2(m) + 1;
+
+            /*
+               Both products are by Binv, so its transform can be shared,
+               but it must then be large enough for the second one. This
+               only pays off when Binv is smaller than T.
+            */
+            if (bitsB < bitsT && 
+                _fmpz_poly_mul_precache_worthwhile(n, bitsW, m, bitsB))
+            {
+                fmpz_poly_mul_precache_t pre;
+                fmpz_poly_struct P[1];
+
+                P->coeffs = Binv;
+                P->length = P->alloc = m;
+                fmpz_poly_mul_SS_precache_init(pre, n, bitsW, P);
+
+                _fmpz_poly_mullow_SS_precache(W, T, n, pre, n);
+                _fmpz_poly_mullow_SS_precache(Binv + m, W + m, n - m, 
+                                                                pre, n - m);
+
+                fmpz_poly_mul_precache_clear(pre);
+            }
+            else
+            {
+                _fmpz_poly_mullow(W, T, n, Binv, m, n);
+                _fmpz_poly_mullow(Binv + m, Binv, m, W + m, n - m, n - m);
+            }
             _fmpz_vec_neg(Binv + m, Binv + m, n - m);
         }
 
@@ -23,95 +23,13 @@
 
 ******************************************************************************/
 
-#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
+#include "thread_pool.h"
 #include "fmpz.h"
+#include "fmpz_vec.h"
 #include "fmpz_poly.h"
 
-typedef struct
-{
-    fmpz * vec;
-    mp_ptr * residues;
-    slong n0;
-    slong n1;
-    mp_srcptr primes;
-    slong num_primes;
-    int crt;  /* reduce if 0, lift if 1 */
-}
-mod_ui_arg_t;
-
-void *
-_fmpz_vec_multi_mod_ui_worker(void * arg_ptr)
-{
-    mod_ui_arg_t arg = *((mod_ui_arg_t *) arg_ptr);
-    mp_ptr tmp;
-    slong i, j;
-
-    fmpz_comb_t comb;
-    fmpz_comb_temp_t comb_temp;
-
-    tmp = flint_malloc(sizeof(mp_limb_t) * arg.num_primes);
-    fmpz_comb_init(comb, arg.primes, arg.num_primes);
-    fmpz_comb_temp_init(comb_temp, comb);
-
-    for (i = arg.n0; i < arg.n1; i++)
-    {
-        if (arg.crt)
-        {
-            for (j = 0; j < arg.num_primes; j++)
-                tmp[j] = arg.residues[j][i];
-            fmpz_multi_CRT_ui(arg.vec + i, tmp, comb, comb_temp, 1);
-        }
-        else
-        {
-            fmpz_multi_mod_ui(tmp, arg.vec + i, comb, comb_temp);
-            for (j = 0; j < arg.num_primes; j++)
-                arg.residues[j][i] = tmp[j];
-        }
-    }
-
-    flint_free(tmp);
-    fmpz_comb_clear(comb);
-    fmpz_comb_temp_clear(comb_temp);
-
-    flint_cleanup();
-    return NULL;
-}
-
-void
-_fmpz_vec_multi_mod_ui_threaded(mp_ptr * residues, fmpz * vec, slong len,
-    mp_srcptr primes, slong num_primes, int crt)
-{
-    pthread_t * threads;
-    mod_ui_arg_t * args;
-    slong i, num_threads;
-
-    num_threads = flint_get_num_threads();
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
-    args = flint_malloc(sizeof(mod_ui_arg_t) * num_threads);
-
-    for (i = 0; i < num_threads; i++)
-    {
-        args[i].vec = vec;
-        args[i].residues = residues;
-        args[i].n0 = (len * i) / num_threads;
-        args[i].n1 = (len * (i + 1)) / num_threads;
-        args[i].primes = (mp_ptr) primes;
-        args[i].num_primes = num_primes;
-        args[i].crt = crt;
-
-        pthread_create(&threads[i], NULL,
-            _fmpz_vec_multi_mod_ui_worker, &args[i]);
-    }
-
-    for (i = 0; i < num_threads; i++)
-        pthread_join(threads[i], NULL);
-
-    flint_free(threads);
-    flint_free(args);
-}
-
 typedef struct
 {
     mp_ptr * residues;
@@ -124,7 +42,7 @@ typedef struct
 }
 taylor_shift_arg_t;
 
-void *
+void
 _fmpz_poly_multi_taylor_shift_worker(void * arg_ptr)
 {
     taylor_shift_arg_t arg = *((taylor_shift_arg_t *) arg_ptr);
@@ -140,21 +58,18 @@ _fmpz_poly_multi_taylor_shift_worker(void * arg_ptr)
         cm = fmpz_fdiv_ui(arg.c, p);
         _nmod_poly_taylor_shift(arg.residues[i], cm, arg.len, mod);
     }
-
-    flint_cleanup();
-    return NULL;
 }
 
 void
 _fmpz_poly_multi_taylor_shift_threaded(mp_ptr * residues, slong len,
     const fmpz_t c, mp_srcptr primes, slong num_primes)
 {
-    pthread_t * threads;
+    thread_pool_handle * threads;
     taylor_shift_arg_t * args;
-    slong i, num_threads;
+    slong i, num_threads, num_workers;
 
-    num_threads = flint_get_num_threads();
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    num_workers = flint_request_threads(&threads, num_primes);
+    num_threads = num_workers + 1;
     args = flint_malloc(sizeof(taylor_shift_arg_t) * num_threads);
 
     for (i = 0; i < num_threads; i++)
@@ -166,15 +81,19 @@ _fmpz_poly_multi_taylor_shift_threaded(mp_ptr * residues, slong len,
         args[i].primes = (mp_ptr) primes;
         args[i].num_primes = num_primes;
         args[i].c = (fmpz *) c;
+    }
 
-        pthread_create(&threads[i], NULL,
+    for (i = 1; i < num_threads; i++)
+        thread_pool_wake(global_thread_pool, threads[i - 1], 0,
             _fmpz_poly_multi_taylor_shift_worker, &args[i]);
-    }
 
-    for (i = 0; i < num_threads; i++)
-        pthread_join(threads[i], NULL);
+    _fmpz_poly_multi_taylor_shift_worker(&args[0]);
+
+    for (i = 1; i < num_threads; i++)
+        thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+    flint_give_back_threads(threads, num_workers);
 
-    flint_free(threads);
     flint_free(args);
 }
 
@@ -184,6 +103,8 @@ _fmpz_poly_taylor_shift_multi_mod(fmpz * poly, const fmpz_t c, slong len)
     slong xbits, ybits, num_primes, i;
     mp_ptr primes;
     mp_ptr * residues;
+    fmpz_comb_t comb;
+    fmpz_comb_temp_t comb_temp;
 
     if (len <= 1 || fmpz_is_zero(c))
         return;
@@ -219,9 +140,15 @@ _fmpz_poly_taylor_shift_multi_mod(fmpz * poly, const fmpz_t c, slong len)
     for (i = 0; i < num_primes; i++)
         residues[i] = flint_malloc(sizeof(mp_limb_t) * len);
 
-    _fmpz_vec_multi_mod_ui_threaded(residues, poly, len, primes, num_primes, 0);
+    fmpz_comb_init(comb, primes, num_primes);
+    fmpz_comb_temp_init(comb_temp, comb);
+
+    _fmpz_vec_multi_mod_ui(residues, poly, len, comb, comb_temp);
     _fmpz_poly_multi_taylor_shift_threaded(residues, len, c, primes, num_primes);
-    _fmpz_vec_multi_mod_ui_threaded(residues, poly, len, primes, num_primes, 1);
+    _fmpz_vec_multi_CRT_ui(poly, residues, len, comb, comb_temp, 1);
+
+    fmpz_comb_temp_clear(comb_temp);
+    fmpz_comb_clear(comb);
 
     for (i = 0; i < num_primes; i++)
         flint_free(residues[i]);
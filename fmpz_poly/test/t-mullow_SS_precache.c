@@ -0,0 +1,114 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mullow_SS_precache....");
+    fflush(stdout);
+
+    /* Compare with mul_KS, with several products by the same operand */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c, d;
+        fmpz_poly_mul_precache_t pre;
+        slong len, len1, bits1, trunc;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_init(d);
+
+        /* Long enough at times for the matrix Fourier algorithm */
+        len = (i % 10 == 0) ? 400 : 50;
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        fmpz_poly_randtest(c, state, n_randint(state, len) + 2, 200);
+        if (c->length < 2)
+            fmpz_poly_set_coeff_ui(c, 1, 1);
+
+        len1 = n_randint(state, len) + 2;
+        bits1 = n_randint(state, 300) + 1;
+        fmpz_poly_mul_SS_precache_init(pre, len1, bits1, c);
+
+        for (j = 0; j < 4; j++)
+        {
+            /* Sometimes larger than the bounds given for the transform */
+            if (n_randint(state, 4) == 0)
+                fmpz_poly_randtest(b, state, n_randint(state, 2*len1) + 1,
+                                                                 2*bits1);
+            else
+                fmpz_poly_randtest(b, state, n_randint(state, len1) + 1,
+                                                                   bits1);
+
+            len = b->length + c->length - 1;
+            trunc = (b->length == 0) ? 0 : n_randint(state, len + 1);
+
+            fmpz_poly_mul_KS(a, b, c);
+            fmpz_poly_truncate(a, trunc);
+
+            if (n_randint(state, 2))
+            {
+                fmpz_poly_mullow_SS_precache(d, b, pre, trunc);
+            }
+            else
+            {
+                fmpz_poly_set(d, b);
+                fmpz_poly_mullow_SS_precache(d, d, pre, trunc);
+            }
+
+            result = (fmpz_poly_equal(a, d));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("len1 = %wd, bits1 = %wd, trunc = %wd\n", 
+                                                      len1, bits1, trunc);
+                fmpz_poly_print(a), flint_printf("\n\n");
+                fmpz_poly_print(d), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        fmpz_poly_mul_precache_clear(pre);
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+        fmpz_poly_clear(d);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -26,103 +26,274 @@
 ******************************************************************************/
 
 #include <stdlib.h>
+#include "thread_pool.h"
 #include "fmpz_poly.h"
 
 #define TRACE 0
 
+/* Number of candidate subsets tested per thread before synchronising */
+#define ZASSENHAUS_BATCH 16
+
+typedef struct
+{
+    const fmpz_poly_factor_struct * lifted_fac;
+    const fmpz_poly_struct * f;
+    const fmpz * leadF;
+    const fmpz * c;       /* leadF times the constant coefficient of f */
+    const fmpz * P;
+    const slong * subsets;
+    slong k;
+    slong start;
+    slong stop;
+    slong step;
+    slong * found;        /* smallest index of a factor found so far */
+    pthread_mutex_t * mutex;
+    fmpz_poly_struct * tryme;
+    fmpz_poly_struct * Q;
+    fmpz_poly_struct * R;
+    fmpz * t;
+    slong idx;            /* index of the factor found, or -1 */
+}
+zassenhaus_arg_t;
+
+/*
+   Sets tryme to the candidate factor of f formed from the k local factors
+   indexed by sub and returns 1 with the cofactor in Q if it divides f.
+   A true factor g with cofactor h is lc(h) g, so its constant coefficient
+   divides c = lc(f) f(0), which rules out most candidates cheaply.
+*/
+static int
+_zassenhaus_test(zassenhaus_arg_t * arg, const slong * sub)
+{
+    const fmpz_poly_struct * p = arg->lifted_fac->p;
+    slong l;
+
+    if (!fmpz_is_zero(arg->c))
+    {
+        fmpz_set(arg->t, arg->leadF);
+        for (l = 0; l < arg->k; l++)
+        {
+            fmpz_mul(arg->t, arg->t, (p + sub[l])->coeffs);
+            fmpz_mod(arg->t, arg->t, arg->P);
+        }
+        _fmpz_vec_scalar_smod_fmpz(arg->t, arg->t, 1, arg->P);
+        fmpz_abs(arg->t, arg->t);
+
+        if (fmpz_is_zero(arg->t) || !fmpz_divisible(arg->c, arg->t))
+            return 0;
+    }
+
+    fmpz_poly_set_fmpz(arg->tryme, arg->leadF);
+
+    for (l = 0; l < arg->k; l++)
+        fmpz_poly_mul(arg->tryme, arg->tryme, p + sub[l]);
+
+    fmpz_poly_scalar_smod_fmpz(arg->tryme, arg->tryme, arg->P);
+    fmpz_poly_primitive_part(arg->tryme, arg->tryme);
+
+    if (fmpz_poly_is_zero(arg->tryme))
+        return 0;
+
+    fmpz_poly_divrem(arg->Q, arg->R, arg->f, arg->tryme);
+
+#if TRACE == 1
+    fmpz_poly_print(arg->tryme); flint_printf(" is tryme\n");
+    fmpz_poly_print(arg->R); flint_printf(" is R\n");
+#endif
+
+    return fmpz_poly_is_zero(arg->R);
+}
+
+/*
+   Tests the candidates start, start + step, ... below stop, stopping
+   early once a factor has been found at a smaller index by any thread
+*/
+static void
+_zassenhaus_range(zassenhaus_arg_t * arg)
+{
+    slong i, found;
+
+    arg->idx = -1;
+
+    for (i = arg->start; i < arg->stop; i += arg->step)
+    {
+        pthread_mutex_lock(arg->mutex);
+        found = *arg->found;
+        pthread_mutex_unlock(arg->mutex);
+
+        if (found < i)
+            break;
+
+        if (_zassenhaus_test(arg, arg->subsets + i*arg->k))
+        {
+            pthread_mutex_lock(arg->mutex);
+            if (i < *arg->found)
+                *arg->found = i;
+            pthread_mutex_unlock(arg->mutex);
+
+            arg->idx = i;
+            break;
+        }
+    }
+}
+
+static void
+_zassenhaus_worker(void * arg_ptr)
+{
+    _zassenhaus_range((zassenhaus_arg_t *) arg_ptr);
+}
+
+/* Steps sub to the next k-subset of {0, ..., r - 1} in lexicographic order */
+static int
+_zassenhaus_next_subset(slong * sub, slong k, slong r)
+{
+    slong i = k - 1, l;
+
+    while (i >= 0 && sub[i] == r - k + i)
+        i--;
+
+    if (i < 0)
+        return 0;
+
+    sub[i]++;
+    for (l = i + 1; l < k; l++)
+        sub[l] = sub[l - 1] + 1;
+
+    return 1;
+}
+
 void fmpz_poly_factor_zassenhaus_recombination(fmpz_poly_factor_t final_fac, 
 	const fmpz_poly_factor_t lifted_fac, 
     const fmpz_poly_t F, const fmpz_t P, slong exp)
 {
     const slong r = lifted_fac->num;
 
-    slong k, *used_arr, *sub_arr;
-    fmpz_poly_t f, Q, R, tryme;
-    fmpz *leadF;
+    slong i, k, l, num, found, batch, num_threads, num_workers;
+    slong *used_arr, *sub_arr, *subsets;
+    int max_threads;
+    zassenhaus_arg_t * args;
+    thread_pool_handle * threads;
+    pthread_mutex_t mutex;
+    fmpz_poly_struct * polys;
+    fmpz * t;
+    fmpz_poly_t f;
+    fmpz_t c;
+    int more;
+
+    max_threads = flint_get_num_threads();
+    batch = ZASSENHAUS_BATCH * max_threads;
 
     used_arr = flint_calloc(2 * r, sizeof(slong));
     sub_arr  = used_arr + r;
+    subsets  = flint_malloc(batch * r * sizeof(slong));
+
+    args = flint_malloc(max_threads * sizeof(zassenhaus_arg_t));
+    polys = flint_malloc(3 * max_threads * sizeof(fmpz_poly_struct));
+    t = _fmpz_vec_init(max_threads);
+    pthread_mutex_init(&mutex, NULL);
 
     fmpz_poly_init(f);
-    fmpz_poly_init(Q);
-    fmpz_poly_init(R);
-    fmpz_poly_init(tryme);
+    fmpz_init(c);
     fmpz_poly_set(f, F);
 
 #if TRACE == 1
     fmpz_poly_factor_print(lifted_fac); flint_printf(" lifted_fac\n");
 #endif
 
-    leadF = fmpz_poly_lead(F);
+    fmpz_mul(c, fmpz_poly_lead(f), f->coeffs);
 
-    for (k = 1; k < r; k++)
+    for (i = 0; i < max_threads; i++)
     {
-        slong count = 0, indx = k - 1, l;
+        fmpz_poly_init(polys + 3*i);
+        fmpz_poly_init(polys + 3*i + 1);
+        fmpz_poly_init(polys + 3*i + 2);
+
+        args[i].lifted_fac = lifted_fac;
+        args[i].f = f;
+        args[i].c = c;
+        args[i].P = P;
+        args[i].subsets = subsets;
+        args[i].found = &found;
+        args[i].mutex = &mutex;
+        args[i].tryme = polys + 3*i;
+        args[i].Q = polys + 3*i + 1;
+        args[i].R = polys + 3*i + 2;
+        args[i].t = t + i;
+    }
 
-        for(l = 0; l < k; l++)
+    for (k = 1; k < r; k++)
+    {
+        for (l = 0; l < k; l++)
             sub_arr[l] = l;
 
-        sub_arr[indx]--;
-        while ((indx >= 0))
-        {
-            sub_arr[indx] = sub_arr[indx] + 1;
-
-            for (l = indx + 1; l < k; l++)
-                sub_arr[l] = sub_arr[l - 1] + 1;
+        more = 1;
 
-            if (sub_arr[k - 1] > r - 1)
-                indx--;
-            else
+        while (more)
+        {
+            /* Collect a batch of candidates which avoid the used factors */
+            for (num = 0; num < batch && more; )
             {
-                for(l = 0; l < k; l++)
+                for (l = 0; l < k && used_arr[sub_arr[l]] == 0; l++) ;
+
+                if (l == k)
                 {
-                    if (used_arr[sub_arr[l]] == 1)
-                        break;
+                    for (l = 0; l < k; l++)
+                        subsets[num*k + l] = sub_arr[l];
+                    num++;
                 }
 
-             /* Need to involve leadF, perhaps set coeff 0 to leadF and do 
-                leadF * rest and check if under M_bits... here I'm using a 
-                trial division... */
-                fmpz_poly_set_fmpz(tryme, leadF);
+                more = _zassenhaus_next_subset(sub_arr, k, r);
+            }
 
-                for(l = 0; l < k; l++)
-                    fmpz_poly_mul(tryme, tryme, lifted_fac->p + (sub_arr[l]));
+            if (num == 0)
+                break;
 
-                fmpz_poly_scalar_smod_fmpz(tryme, tryme, P);
-                fmpz_poly_primitive_part(tryme, tryme);
-                fmpz_poly_divrem(Q, R, f, tryme);
+            num_workers = flint_request_threads(&threads, num);
+            num_threads = num_workers + 1;
+            found = num;
 
-#if TRACE == 1
-                fmpz_poly_print(tryme); flint_printf(" is tryme\n");
-                fmpz_poly_print(R); flint_printf(" is R\n");
-#endif
+            for (i = 0; i < num_threads; i++)
+            {
+                args[i].leadF = fmpz_poly_lead(f);
+                args[i].k = k;
+                args[i].start = i;
+                args[i].stop = num;
+                args[i].step = num_threads;
+            }
 
-                if (fmpz_poly_is_zero(R))
-                {
-                    fmpz_poly_factor_insert(final_fac, tryme, exp);
-
-                    for(l = 0; l < k; l++)
-                    {
-                        used_arr[sub_arr[l]] = 1;
-                        count++;
-                    }
-
-                    fmpz_poly_set(f, Q);
-                    leadF = fmpz_poly_lead(f);
-                 /* If r - count = k then the rest are irreducible.  
-                    TODO: Add a test for that case */
-                }
+            for (i = 1; i < num_threads; i++)
+                thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                                             _zassenhaus_worker, &args[i]);
+
+            _flint_set_num_workers(0);
+            _zassenhaus_range(args);
+            _flint_set_num_workers(max_threads - 1);
+
+            for (i = 1; i < num_threads; i++)
+                thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+            flint_give_back_threads(threads, num_workers);
+
+            if (found == num)
+                continue;
 
-                indx = k - 1;
+            /* Take the first factor, as found by a serial search */
+            for (i = 0; args[i].idx != found; i++) ;
+
+            fmpz_poly_factor_insert(final_fac, args[i].tryme, exp);
+
+            for (l = 0; l < k; l++)
+            {
+                sub_arr[l] = subsets[found*k + l];
+                used_arr[sub_arr[l]] = 1;
             }
-        }
 
-     /* This is where we switch to the next loop for k.  So we will have 
-        found all factors using <= k local factors.  We should/could update 
-        f to be the rest divided away (or multiply the remaining), could 
-        also adjust r.  It is the number of remaining factors so if you 
-        update then test if r = k or k+1 in which case the remaining f is 
-        irreducible. */
+            fmpz_poly_swap(f, args[i].Q);
+            fmpz_mul(c, fmpz_poly_lead(f), f->coeffs);
+
+            /* Continue with the subsets after the one found */
+            more = _zassenhaus_next_subset(sub_arr, k, r);
+        }
     }
 
     {
@@ -135,12 +306,17 @@ void fmpz_poly_factor_zassenhaus_recombination(fmpz_poly_factor_t final_fac,
             fmpz_poly_factor_insert(final_fac, f, exp);
     }
 
+    for (i = 0; i < 3 * max_threads; i++)
+        fmpz_poly_clear(polys + i);
+
     fmpz_poly_clear(f);
-    fmpz_poly_clear(tryme);
-    fmpz_poly_clear(Q);
-    fmpz_poly_clear(R);
+    fmpz_clear(c);
+    _fmpz_vec_clear(t, max_threads);
+    pthread_mutex_destroy(&mutex);
+    flint_free(polys);
+    flint_free(args);
+    flint_free(subsets);
     flint_free(used_arr);
 }
 
 #undef TRACE
-
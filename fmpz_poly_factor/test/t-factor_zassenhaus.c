@@ -95,6 +95,64 @@ main(void)
         fmpz_poly_factor_clear(fac);
     }
 
+    /* Threaded recombination and lifting against the serial result */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t f, g;
+        fmpz_poly_factor_t fac1, fac2;
+        slong j, n = n_randint(state, 4);
+
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_factor_init(fac1);
+        fmpz_poly_factor_init(fac2);
+
+        /* Swinnerton-Dyer polynomials have many local factors */
+        fmpz_poly_swinnerton_dyer(f, n_randint(state, 4) + 1);
+
+        for (j = 0; j < n; j++)
+        {
+            fmpz_poly_randtest(g, state, n_randint(state, 100) + 2, 
+                                                      n_randint(state, 20));
+            fmpz_poly_primitive_part(g, g);
+            fmpz_poly_mul(g, g, f);
+
+            if (!fmpz_is_zero(g->coeffs) && fmpz_poly_is_squarefree(g))
+                fmpz_poly_swap(f, g);
+        }
+
+        if (fmpz_sgn(fmpz_poly_lead(f)) < 0)
+            fmpz_poly_neg(f, f);
+
+        flint_set_num_threads(1);
+        _fmpz_poly_factor_zassenhaus(fac1, 1, f, WORD_MAX);
+
+        flint_set_num_threads(n_randint(state, 4) + 2);
+        _fmpz_poly_factor_zassenhaus(fac2, 1, f, WORD_MAX);
+
+        result = (fac1->num == fac2->num);
+        for (j = 0; result && j < fac1->num; j++)
+            result = fmpz_poly_equal(fac1->p + j, fac2->p + j);
+
+        if (!result)
+        {
+            flint_printf("FAIL (threads):\n");
+            flint_printf("f = "), fmpz_poly_print(f), flint_printf("\n\n");
+            flint_printf("fac1 = "), fmpz_poly_factor_print(fac1), 
+                                                         flint_printf("\n\n");
+            flint_printf("fac2 = "), fmpz_poly_factor_print(fac2), 
+                                                         flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_factor_clear(fac1);
+        fmpz_poly_factor_clear(fac2);
+    }
+
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -224,6 +224,20 @@ FLINT_DLL void _fmpz_vec_scalar_mod_fmpz(fmpz *res, const fmpz *vec, slong len,
 
 FLINT_DLL void _fmpz_vec_scalar_smod_fmpz(fmpz *res, const fmpz *vec, slong len, const fmpz_t p);
 
+/*  Multimodular reduction and reconstruction  *******************************/
+
+/* Number of residues below which the functions below use a single thread */
+#define FMPZ_VEC_MULTI_MOD_THREAD_CUTOFF 4096
+
+/* Number of entries taken through the subproduct tree together */
+#define FMPZ_VEC_MULTI_MOD_BATCH 16
+
+FLINT_DLL void _fmpz_vec_multi_mod_ui(mp_ptr * out, const fmpz * in,
+           slong len, const fmpz_comb_t comb, fmpz_comb_temp_t temp);
+
+FLINT_DLL void _fmpz_vec_multi_CRT_ui(fmpz * out, mp_ptr const * residues,
+       slong len, const fmpz_comb_t comb, fmpz_comb_temp_t temp, int sign);
+
 /*  Gaussian content  ********************************************************/
 
 FLINT_DLL void _fmpz_vec_content(fmpz_t res, const fmpz * vec, slong len);
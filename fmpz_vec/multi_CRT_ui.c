@@ -0,0 +1,229 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "thread_pool.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "nmod_vec.h"
+
+typedef struct
+{
+    fmpz * out;
+    mp_ptr const * residues;
+    slong start;
+    slong stop;
+    const fmpz_comb_struct * comb;
+    int sign;
+}
+_multi_CRT_arg_t;
+
+/*
+   Reconstructs the num entries from position start on, going up the
+   subproduct tree one level at a time. Each product of the tree is
+   applied to all of them before moving on to the next one, so that it
+   stays in cache. The arrays x and y have room for num values at each
+   node of the bottom level.
+*/
+static void
+_fmpz_vec_multi_CRT_ui_batch(fmpz * out, mp_ptr const * residues,
+              slong start, slong num, fmpz * x, fmpz * y,
+              const fmpz_comb_t comb, fmpz_comb_temp_t temp, int sign)
+{
+    slong i, j, k, nodes, level, num_primes = comb->num_primes;
+    fmpz * t, * c;
+    mp_limb_t a, b, u, hi, lo;
+
+    /* First level, each pair of primes fits in two limbs */
+    for (i = 0, j = 0; i + 2 <= num_primes; i += 2, j++)
+    {
+        const nmod_t mod = comb->mod[i + 1];
+        mp_limb_t p = comb->primes[i];
+        mp_limb_t r = fmpz_get_ui(comb->res[0] + j);
+
+        for (k = 0; k < num; k++)
+        {
+            a = residues[i][start + k];
+            b = residues[i + 1][start + k];
+
+            NMOD_RED(u, a, mod);
+            NMOD_RED(b, b, mod);
+            u = nmod_mul(nmod_sub(b, u, mod), r, mod);
+            umul_ppmm(hi, lo, u, p);
+            add_ssaaaa(hi, lo, hi, lo, UWORD(0), a);
+            fmpz_set_uiui(x + j * num + k, hi, lo);
+        }
+    }
+
+    if (i < num_primes)
+    {
+        for (k = 0; k < num; k++)
+            fmpz_set_ui(x + j * num + k, residues[i][start + k]);
+    }
+
+    /* Other levels, the products beyond the last prime are one */
+    nodes = WORD(1) << (comb->n - 1);
+
+    for (level = 1; level < comb->n; level++)
+    {
+        c = comb->comb[level - 1];
+
+        for (i = 0, j = 0; i < nodes; i += 2, j++)
+        {
+            if (fmpz_is_one(c + i + 1))
+            {
+                if (!fmpz_is_one(c + i))
+                    _fmpz_vec_set(y + j * num, x + i * num, num);
+            }
+            else
+            {
+                for (k = 0; k < num; k++)
+                {
+                    fmpz_mod(temp->temp2, x + i * num + k, c + i + 1);
+                    fmpz_sub(temp->temp, x + (i + 1) * num + k,
+                                                             temp->temp2);
+                    fmpz_mul(temp->temp2, temp->temp, comb->res[level] + j);
+                    fmpz_mod(temp->temp, temp->temp2, c + i + 1);
+                    fmpz_mul(temp->temp2, temp->temp, c + i);
+                    fmpz_add(y + j * num + k, temp->temp2, x + i * num + k);
+                }
+            }
+        }
+
+        t = x, x = y, y = t;
+        nodes /= 2;
+    }
+
+    /* Write out the output, as in fmpz_multi_CRT_ui */
+    for (k = 0; k < num; k++)
+    {
+        if (sign)
+        {
+            fmpz_sub(temp->temp, x + k, comb->comb[comb->n - 1]);
+
+            if (fmpz_cmpabs(temp->temp, x + k) <= 0)
+                fmpz_swap(out + start + k, temp->temp);
+            else
+                fmpz_swap(out + start + k, x + k);
+        }
+        else
+            fmpz_swap(out + start + k, x + k);
+    }
+}
+
+static void
+_fmpz_vec_multi_CRT_ui_block(fmpz * out, mp_ptr const * residues,
+                        slong start, slong stop, const fmpz_comb_t comb,
+                                            fmpz_comb_temp_t temp, int sign)
+{
+    slong i, j, size, num_primes = comb->num_primes;
+    fmpz * x;
+    mp_ptr r;
+
+    /* a single prime leaves nothing to share */
+    if (num_primes == 1)
+    {
+        r = _nmod_vec_init(num_primes);
+
+        for (i = start; i < stop; i++)
+        {
+            for (j = 0; j < num_primes; j++)
+                r[j] = residues[j][i];
+
+            fmpz_multi_CRT_ui(out + i, r, comb, temp, sign);
+        }
+
+        _nmod_vec_clear(r);
+        return;
+    }
+
+    size = FMPZ_VEC_MULTI_MOD_BATCH << (comb->n - 1);
+    x = _fmpz_vec_init(2 * size);
+
+    for (i = start; i < stop; i += FMPZ_VEC_MULTI_MOD_BATCH)
+        _fmpz_vec_multi_CRT_ui_batch(out, residues, i,
+                  FLINT_MIN(FMPZ_VEC_MULTI_MOD_BATCH, stop - i),
+                  x, x + size, comb, temp, sign);
+
+    _fmpz_vec_clear(x, 2 * size);
+}
+
+static void
+_fmpz_vec_multi_CRT_ui_worker(void * arg_ptr)
+{
+    _multi_CRT_arg_t * arg = (_multi_CRT_arg_t *) arg_ptr;
+    fmpz_comb_temp_t temp;
+
+    fmpz_comb_temp_init(temp, arg->comb);
+    _fmpz_vec_multi_CRT_ui_block(arg->out, arg->residues, arg->start,
+                                 arg->stop, arg->comb, temp, arg->sign);
+    fmpz_comb_temp_clear(temp);
+}
+
+void
+_fmpz_vec_multi_CRT_ui(fmpz * out, mp_ptr const * residues, slong len,
+                 const fmpz_comb_t comb, fmpz_comb_temp_t temp, int sign)
+{
+    thread_pool_handle * threads = NULL;
+    _multi_CRT_arg_t * args;
+    slong i, limit, num_threads, num_workers = 0;
+
+    limit = (len * comb->num_primes) / FMPZ_VEC_MULTI_MOD_THREAD_CUTOFF;
+    limit = FLINT_MIN(limit, len);
+
+    if (limit > 1)
+        num_workers = flint_request_threads(&threads, limit);
+
+    if (num_workers == 0)
+    {
+        flint_give_back_threads(threads, num_workers);
+        _fmpz_vec_multi_CRT_ui_block(out, residues, 0, len, comb, temp, sign);
+        return;
+    }
+
+    num_threads = num_workers + 1;
+    args = flint_malloc(sizeof(_multi_CRT_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].out = out;
+        args[i].residues = residues;
+        args[i].start = (len * i) / num_threads;
+        args[i].stop = (len * (i + 1)) / num_threads;
+        args[i].comb = comb;
+        args[i].sign = sign;
+
+        if (i > 0)
+            thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                             _fmpz_vec_multi_CRT_ui_worker, &args[i]);
+    }
+
+    _fmpz_vec_multi_CRT_ui_block(out, residues, args[0].start, args[0].stop,
+                                 comb, temp, sign);
+
+    for (i = 1; i < num_threads; i++)
+        thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+    flint_give_back_threads(threads, num_workers);
+
+    flint_free(args);
+}
@@ -0,0 +1,243 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "thread_pool.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "nmod_vec.h"
+
+typedef struct
+{
+    mp_ptr * out;
+    const fmpz * in;
+    slong start;
+    slong stop;
+    const fmpz_comb_struct * comb;
+}
+_multi_mod_arg_t;
+
+/* Level of the tree from which fmpz_multi_mod_ui would reduce x */
+static slong
+_fmpz_multi_mod_level(const fmpz_t x, const fmpz_comb_t comb)
+{
+    slong level = 0;
+
+    if (fmpz_sgn(x) < 0)
+    {
+        while (fmpz_bits(x) >= fmpz_bits(comb->comb[level]) - 1
+                && level < comb->n - 1)
+            level++;
+    }
+    else
+    {
+        while (fmpz_cmpabs(x, comb->comb[level]) >= 0
+                && level < comb->n - 1)
+            level++;
+    }
+
+    return level;
+}
+
+/*
+   Reduces the num integers r, the entries at positions pos of the input,
+   modulo the primes below node i of the given level of the tree. Each
+   product of the tree is applied to all of them before moving on to the
+   next one, so that it stays in cache. The array s has room for num
+   residues at each level below.
+*/
+static void
+_fmpz_vec_multi_mod_ui_tree(mp_ptr * out, const slong * pos, slong num,
+                            const fmpz * r, fmpz * s, slong level, slong i,
+                            const fmpz_comb_t comb)
+{
+    slong j, k, stop;
+
+    if (level <= FLINT_FMPZ_LOG_MULTI_MOD_CUTOFF + 1)
+    {
+        stop = FLINT_MIN((i + 1) << (level + 1), comb->num_primes);
+
+        for (j = i << (level + 1); j < stop; j++)
+            for (k = 0; k < num; k++)
+                out[j][pos[k]] = fmpz_fdiv_ui(r + k, comb->primes[j]);
+
+        return;
+    }
+
+    /* the products beyond the last prime are one */
+    for (j = 2 * i; j <= 2 * i + 1 && (j << level) < comb->num_primes; j++)
+    {
+        for (k = 0; k < num; k++)
+            fmpz_mod(s + k, r + k, comb->comb[level - 1] + j);
+
+        _fmpz_vec_multi_mod_ui_tree(out, pos, num, s, s + num,
+                                                       level - 1, j, comb);
+    }
+}
+
+static void
+_fmpz_vec_multi_mod_ui_batch(mp_ptr * out, const fmpz * in,
+        const slong * pos, slong num, fmpz * r, fmpz * s,
+        const fmpz_comb_t comb, fmpz_comb_temp_t temp, mp_ptr t)
+{
+    slong i, j, level = 0;
+
+    /* a single entry gains nothing from sharing the descent */
+    if (num == 1)
+    {
+        fmpz_multi_mod_ui(t, in + pos[0], comb, temp);
+
+        for (j = 0; j < comb->num_primes; j++)
+            out[j][pos[0]] = t[j];
+
+        return;
+    }
+
+    for (i = 0; i < num; i++)
+    {
+        fmpz_set(r + i, in + pos[i]);
+        level = FLINT_MAX(level, _fmpz_multi_mod_level(r + i, comb));
+    }
+
+    for (i = 0; (i << (level + 1)) < comb->num_primes; i++)
+        _fmpz_vec_multi_mod_ui_tree(out, pos, num, r, s, level, i, comb);
+}
+
+static void
+_fmpz_vec_multi_mod_ui_block(mp_ptr * out, const fmpz * in, slong start,
+             slong stop, const fmpz_comb_t comb, fmpz_comb_temp_t temp)
+{
+    slong i, j, num, num_primes = comb->num_primes;
+    slong pos[FMPZ_VEC_MULTI_MOD_BATCH];
+    fmpz * r = NULL;
+    mp_ptr t = NULL;
+    mp_limb_t u;
+    fmpz c;
+
+    if (num_primes == 0)
+        return;
+
+    /* Small entries, one prime at a time over consecutive entries */
+    for (j = 0; j < num_primes; j++)
+    {
+        const nmod_t mod = comb->mod[j];
+        mp_ptr o = out[j];
+
+        for (i = start; i < stop; i++)
+        {
+            c = in[i];
+
+            if (!COEFF_IS_MPZ(c))
+            {
+                NMOD_RED(u, FLINT_ABS(c), mod);
+                o[i] = (c < 0) ? nmod_neg(u, mod) : u;
+            }
+        }
+    }
+
+    /* Large entries go down the subproduct tree in batches */
+    for (i = start, num = 0; i < stop; i++)
+    {
+        if (COEFF_IS_MPZ(in[i]))
+            pos[num++] = i;
+
+        if (num == FMPZ_VEC_MULTI_MOD_BATCH || (i == stop - 1 && num > 0))
+        {
+            if (r == NULL)
+            {
+                r = _fmpz_vec_init(FMPZ_VEC_MULTI_MOD_BATCH
+                                                    * (comb->n + 1));
+                t = _nmod_vec_init(num_primes);
+            }
+
+            _fmpz_vec_multi_mod_ui_batch(out, in, pos, num, r,
+                          r + FMPZ_VEC_MULTI_MOD_BATCH, comb, temp, t);
+            num = 0;
+        }
+    }
+
+    if (r != NULL)
+    {
+        _fmpz_vec_clear(r, FMPZ_VEC_MULTI_MOD_BATCH * (comb->n + 1));
+        _nmod_vec_clear(t);
+    }
+}
+
+static void
+_fmpz_vec_multi_mod_ui_worker(void * arg_ptr)
+{
+    _multi_mod_arg_t * arg = (_multi_mod_arg_t *) arg_ptr;
+    fmpz_comb_temp_t temp;
+
+    fmpz_comb_temp_init(temp, arg->comb);
+    _fmpz_vec_multi_mod_ui_block(arg->out, arg->in, arg->start, arg->stop,
+                                 arg->comb, temp);
+    fmpz_comb_temp_clear(temp);
+}
+
+void
+_fmpz_vec_multi_mod_ui(mp_ptr * out, const fmpz * in, slong len,
+                       const fmpz_comb_t comb, fmpz_comb_temp_t temp)
+{
+    thread_pool_handle * threads = NULL;
+    _multi_mod_arg_t * args;
+    slong i, limit, num_threads, num_workers = 0;
+
+    limit = (len * comb->num_primes) / FMPZ_VEC_MULTI_MOD_THREAD_CUTOFF;
+    limit = FLINT_MIN(limit, len);
+
+    if (limit > 1)
+        num_workers = flint_request_threads(&threads, limit);
+
+    if (num_workers == 0)
+    {
+        flint_give_back_threads(threads, num_workers);
+        _fmpz_vec_multi_mod_ui_block(out, in, 0, len, comb, temp);
+        return;
+    }
+
+    num_threads = num_workers + 1;
+    args = flint_malloc(sizeof(_multi_mod_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].out = out;
+        args[i].in = in;
+        args[i].start = (len * i) / num_threads;
+        args[i].stop = (len * (i + 1)) / num_threads;
+        args[i].comb = comb;
+
+        if (i > 0)
+            thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                             _fmpz_vec_multi_mod_ui_worker, &args[i]);
+    }
+
+    _fmpz_vec_multi_mod_ui_block(out, in, args[0].start, args[0].stop,
+                                 comb, temp);
+
+    for (i = 1; i < num_threads; i++)
+        thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+    flint_give_back_threads(threads, num_workers);
+
+    flint_free(args);
+}
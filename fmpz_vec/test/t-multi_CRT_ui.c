@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "nmod_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("multi_CRT_ui....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_comb_t comb;
+        fmpz_comb_temp_t temp;
+        fmpz * a, * b;
+        mp_ptr primes, * residues;
+        slong j, len, num_primes, pbits;
+        int sign;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        len = n_randint(state, 10) ? n_randint(state, 50)
+                                   : n_randint(state, 2000);
+        num_primes = 1 + n_randint(state, 20);
+        pbits = n_randint(state, FLINT_BITS - 10) + 9;
+        sign = n_randint(state, 2);
+
+        primes = _nmod_vec_init(num_primes);
+        primes[0] = n_nextprime(UWORD(1) << (pbits - 1), 1);
+        for (j = 1; j < num_primes; j++)
+            primes[j] = n_nextprime(primes[j - 1], 1);
+
+        residues = flint_malloc(num_primes * sizeof(mp_ptr));
+        for (j = 0; j < num_primes; j++)
+            residues[j] = _nmod_vec_init(len);
+
+        /* the product of the primes exceeds 2^((pbits - 1) num_primes) */
+        a = _fmpz_vec_init(len);
+        b = _fmpz_vec_init(len);
+        if (sign)
+            _fmpz_vec_randtest(a, state, len, (pbits - 1) * num_primes - 1);
+        else
+            _fmpz_vec_randtest_unsigned(a, state, len,
+                                        (pbits - 1) * num_primes);
+
+        fmpz_comb_init(comb, primes, num_primes);
+        fmpz_comb_temp_init(temp, comb);
+
+        _fmpz_vec_multi_mod_ui(residues, a, len, comb, temp);
+        _fmpz_vec_multi_CRT_ui(b, residues, len, comb, temp, sign);
+
+        if (!_fmpz_vec_equal(a, b, len))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("len = %wd, num_primes = %wd, sign = %d\n",
+                         len, num_primes, sign);
+            _fmpz_vec_print(a, len), flint_printf("\n\n");
+            _fmpz_vec_print(b, len), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_comb_temp_clear(temp);
+        fmpz_comb_clear(comb);
+
+        _fmpz_vec_clear(a, len);
+        _fmpz_vec_clear(b, len);
+        for (j = 0; j < num_primes; j++)
+            _nmod_vec_clear(residues[j]);
+        flint_free(residues);
+        _nmod_vec_clear(primes);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
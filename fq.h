@@ -170,30 +170,7 @@ void _fq_sparse_reduce(fmpz *R, slong lenR, const fq_ctx_t ctx)
     _fmpz_vec_scalar_mod_fmpz(R, R, FLINT_MIN(d, lenR), fq_ctx_prime(ctx));
 }
 
-FQ_INLINE void _fq_dense_reduce(fmpz* R, slong lenR, const fq_ctx_t ctx)
-{
-    fmpz  *q, *r;
-
-    if (lenR < ctx->modulus->length)
-    {
-        _fmpz_vec_scalar_mod_fmpz(R, R, lenR, fq_ctx_prime(ctx));
-        return;
-    }
-    
-    q = _fmpz_vec_init(lenR - ctx->modulus->length + 1);
-    r = _fmpz_vec_init(ctx->modulus->length - 1);
-
-    _fmpz_mod_poly_divrem_newton_n_preinv(q, r, R, lenR, 
-                                        ctx->modulus->coeffs, ctx->modulus->length,
-                                        ctx->inv->coeffs, ctx->inv->length,
-                                        fq_ctx_prime(ctx));
-
-    _fmpz_vec_set(R, r, ctx->modulus->length - 1);
-    _fmpz_vec_clear(q, lenR - ctx->modulus->length + 1);
-    _fmpz_vec_clear(r, ctx->modulus->length - 1);
-
-}
-
+FLINT_DLL void _fq_dense_reduce(fmpz * R, slong lenR, const fq_ctx_t ctx);
 
 FQ_INLINE void _fq_reduce(fmpz* R, slong lenR, const fq_ctx_t ctx)
 {
@@ -0,0 +1,66 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq.h"
+
+/*
+   Only the remainder is wanted, so the quotient is formed in scratch space
+   on the stack and Q f is subtracted from the low coefficients in place.
+*/
+void _fq_dense_reduce(fmpz * R, slong lenR, const fq_ctx_t ctx)
+{
+    const slong lenf = ctx->modulus->length, d = lenf - 1;
+    slong i, lenQ, len;
+    fmpz * q, * t;
+    TMP_INIT;
+
+    if (lenR < lenf)
+    {
+        _fmpz_vec_scalar_mod_fmpz(R, R, lenR, fq_ctx_prime(ctx));
+        return;
+    }
+
+    lenQ = lenR - d;
+    len = lenQ + FLINT_MAX(lenQ, d);
+
+    TMP_START;
+    q = TMP_ALLOC(len * sizeof(fmpz));
+    t = q + lenQ;
+    for (i = 0; i < len; i++)
+        fmpz_init(q + i);
+
+    _fmpz_poly_reverse(t, R + d, lenQ, lenQ);
+    _fmpz_poly_mullow(q, t, lenQ, ctx->inv->coeffs,
+                               FLINT_MIN(lenQ, ctx->inv->length), lenQ);
+    _fmpz_vec_scalar_mod_fmpz(q, q, lenQ, fq_ctx_prime(ctx));
+    _fmpz_poly_reverse(q, q, lenQ, lenQ);
+
+    if (d >= lenQ)
+        _fmpz_poly_mullow(t, ctx->modulus->coeffs, d, q, lenQ, d);
+    else
+        _fmpz_poly_mullow(t, q, lenQ, ctx->modulus->coeffs, d, d);
+
+    _fmpz_vec_sub(R, R, t, d);
+    _fmpz_vec_scalar_mod_fmpz(R, R, d, fq_ctx_prime(ctx));
+
+    for (i = 0; i < len; i++)
+        fmpz_clear(q + i);
+    TMP_END;
+}
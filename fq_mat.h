@@ -44,10 +44,34 @@ static __inline__ int FQ_MAT_MUL_KS_CUTOFF(slong r, slong c, const fq_ctx_t ctx)
         return 0;
 }
 
+/* Evaluation needs 2d - 1 points in a word size prime field */
+static __inline__ int FQ_MAT_MUL_EVAL_CUTOFF(slong r, slong c, const fq_ctx_t ctx)
+{
+    const slong d = fq_ctx_degree(ctx);
+
+    if (fmpz_abs_fits_ui(fq_ctx_prime(ctx))
+        && fmpz_cmp_ui(fq_ctx_prime(ctx), 2 * d - 1) >= 0
+        && FLINT_MIN(r, c) >= 16 && 2 * FLINT_MIN(r, c) >= d)
+        return 1;
+    else
+        return 0;
+}
+
 #define T fq
 #define CAP_T FQ
 #include "fq_mat_templates.h"
 #undef CAP_T
 #undef T
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+FLINT_DLL void fq_mat_mul_eval(fq_mat_t C, const fq_mat_t A,
+                                   const fq_mat_t B, const fq_ctx_t ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
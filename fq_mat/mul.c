@@ -25,12 +25,14 @@
 
 #include "fq_mat.h"
 
-#ifdef T
-#undef T
-#endif
-
-#define T fq
-#define CAP_T FQ
-#include "fq_mat_templates/mul.c"
-#undef CAP_T
-#undef T
+void
+fq_mat_mul(fq_mat_t C, const fq_mat_t A, const fq_mat_t B,
+                                                      const fq_ctx_t ctx)
+{
+    if (FQ_MAT_MUL_EVAL_CUTOFF(A->r, B->c, ctx))
+        fq_mat_mul_eval(C, A, B, ctx);
+    else if (FQ_MAT_MUL_KS_CUTOFF(A->r, B->c, ctx))
+        fq_mat_mul_KS(C, A, B, ctx);
+    else
+        fq_mat_mul_classical(C, A, B, ctx);
+}
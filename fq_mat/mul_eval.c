@@ -0,0 +1,113 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_mat.h"
+#include "fq_nmod_mat.h"
+
+/*
+   The characteristic fits in a word, so the product is computed over the
+   isomorphic fq_nmod field with the same defining polynomial.
+*/
+void
+fq_mat_mul_eval(fq_mat_t C, const fq_mat_t A, const fq_mat_t B,
+                                                         const fq_ctx_t ctx)
+{
+    const slong d = fq_ctx_degree(ctx);
+    fq_nmod_ctx_t nctx;
+    fq_nmod_mat_t nA, nB, nC;
+    nmod_poly_t f;
+    fq_struct * c;
+    fq_nmod_struct * e;
+    slong i, j, l;
+
+    if (B->r == 0)
+    {
+        fq_mat_zero(C, ctx);
+        return;
+    }
+
+    if (A->r == 0 || B->c == 0)
+        return;
+
+    if (!fmpz_abs_fits_ui(fq_ctx_prime(ctx)))
+    {
+        flint_printf("Exception (fq_mat_mul_eval). "
+                     "Characteristic does not fit in a word.\n");
+        abort();
+    }
+
+    nmod_poly_init(f, fmpz_get_ui(fq_ctx_prime(ctx)));
+    nmod_poly_fit_length(f, d + 1);
+    for (l = 0; l <= d; l++)
+        f->coeffs[l] = fmpz_get_ui(ctx->modulus->coeffs + l);
+    f->length = d + 1;
+    fq_nmod_ctx_init_modulus(nctx, f, "a");
+    nmod_poly_clear(f);
+
+    fq_nmod_mat_init(nA, A->r, A->c, nctx);
+    fq_nmod_mat_init(nB, B->r, B->c, nctx);
+    fq_nmod_mat_init(nC, A->r, B->c, nctx);
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < A->c; j++)
+        {
+            c = fq_mat_entry(A, i, j);
+            e = fq_nmod_mat_entry(nA, i, j);
+            nmod_poly_fit_length(e, c->length);
+            for (l = 0; l < c->length; l++)
+                e->coeffs[l] = fmpz_get_ui(c->coeffs + l);
+            e->length = c->length;
+        }
+    }
+
+    for (i = 0; i < B->r; i++)
+    {
+        for (j = 0; j < B->c; j++)
+        {
+            c = fq_mat_entry(B, i, j);
+            e = fq_nmod_mat_entry(nB, i, j);
+            nmod_poly_fit_length(e, c->length);
+            for (l = 0; l < c->length; l++)
+                e->coeffs[l] = fmpz_get_ui(c->coeffs + l);
+            e->length = c->length;
+        }
+    }
+
+    fq_nmod_mat_mul_eval(nC, nA, nB, nctx);
+
+    for (i = 0; i < C->r; i++)
+    {
+        for (j = 0; j < C->c; j++)
+        {
+            c = fq_mat_entry(C, i, j);
+            e = fq_nmod_mat_entry(nC, i, j);
+            fmpz_poly_fit_length(c, e->length);
+            for (l = 0; l < e->length; l++)
+                fmpz_set_ui(c->coeffs + l, e->coeffs[l]);
+            _fmpz_poly_set_length(c, e->length);
+        }
+    }
+
+    fq_nmod_mat_clear(nA, nctx);
+    fq_nmod_mat_clear(nB, nctx);
+    fq_nmod_mat_clear(nC, nctx);
+    fq_nmod_ctx_clear(nctx);
+}
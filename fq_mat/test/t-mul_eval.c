@@ -0,0 +1,318 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fq_mat.h"
+#include "fq_nmod_mat.h"
+#include "ulong_extras.h"
+
+/*
+   Sets up a field of degree d whose characteristic is a word size prime
+   of at least 2d - 1. The characteristic sometimes takes up the whole
+   word and the modulus is sometimes not monic.
+*/
+static void
+_fq_ctx_randtest_eval(fq_ctx_t ctx, flint_rand_t state, slong d)
+{
+    fmpz_mod_poly_t f;
+    fmpz_t p;
+    mp_limb_t q;
+
+    if (n_randint(state, 4) == 0)
+        q = n_randprime(state, FLINT_BITS, 1);
+    else
+        q = n_randprime(state, 2 + n_randint(state, FLINT_BITS - 2), 1);
+    while (q < 2 * d - 1)
+        q = n_nextprime(q, 1);
+    fmpz_init_set_ui(p, q);
+
+    if (n_randint(state, 2))
+    {
+        fq_ctx_init(ctx, p, d, "a");
+    }
+    else
+    {
+        fmpz_mod_poly_init(f, p);
+        do {
+            fmpz_mod_poly_randtest_irreducible(f, state, d + 1);
+        } while (fmpz_mod_poly_degree(f) != d);
+
+        if (fmpz_is_one(fmpz_mod_poly_lead(f)) && q > 2)
+        {
+            fmpz_set_ui(p, 2 + n_randint(state, q - 2));
+            fmpz_mod_poly_scalar_mul_fmpz(f, f, p);
+        }
+
+        fq_ctx_init_modulus(ctx, f, "a");
+        fmpz_mod_poly_clear(f);
+    }
+
+    fmpz_clear(p);
+}
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_eval....");
+    fflush(stdout);
+
+    /* Compare with classical multiplication */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fq_ctx_t ctx;
+        fq_mat_t A, B, C, D;
+        slong d, m, n, k;
+
+        d = n_randint(state, 12) + 1;
+        _fq_ctx_randtest_eval(ctx, state, d);
+
+        m = n_randint(state, 20);
+        n = n_randint(state, 20);
+        k = n_randint(state, 20);
+
+        fq_mat_init(A, m, n, ctx);
+        fq_mat_init(B, n, k, ctx);
+        fq_mat_init(C, m, k, ctx);
+        fq_mat_init(D, m, k, ctx);
+
+        fq_mat_randtest(A, state, ctx);
+        fq_mat_randtest(B, state, ctx);
+        fq_mat_randtest(C, state, ctx);
+
+        fq_mat_mul_eval(C, A, B, ctx);
+        fq_mat_mul_classical(D, A, B, ctx);
+
+        result = fq_mat_equal(C, D, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m, n, k, d = %wd, %wd, %wd, %wd\n", m, n, k, d);
+            fq_ctx_print(ctx);
+            fq_mat_print_pretty(A, ctx);
+            fq_mat_print_pretty(B, ctx);
+            fq_mat_print_pretty(C, ctx);
+            fq_mat_print_pretty(D, ctx);
+            abort();
+        }
+
+        fq_mat_clear(A, ctx);
+        fq_mat_clear(B, ctx);
+        fq_mat_clear(C, ctx);
+        fq_mat_clear(D, ctx);
+
+        fq_ctx_clear(ctx);
+    }
+
+    /* Compare with the product over the fq_nmod field of the same modulus */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fq_ctx_t ctx;
+        fq_nmod_ctx_t nctx;
+        fq_mat_t A, B, C, D;
+        fq_nmod_mat_t nA, nB, nC;
+        nmod_poly_t f;
+        fq_struct * c;
+        fq_nmod_struct * e;
+        slong d, m, n, k, r, s, l;
+
+        d = n_randint(state, 12) + 1;
+        _fq_ctx_randtest_eval(ctx, state, d);
+
+        nmod_poly_init(f, fmpz_get_ui(fq_ctx_prime(ctx)));
+        for (l = 0; l <= d; l++)
+            nmod_poly_set_coeff_ui(f, l,
+                                   fmpz_get_ui(ctx->modulus->coeffs + l));
+        fq_nmod_ctx_init_modulus(nctx, f, "a");
+        nmod_poly_clear(f);
+
+        m = n_randint(state, 20);
+        n = n_randint(state, 20);
+        k = n_randint(state, 20);
+
+        fq_mat_init(A, m, n, ctx);
+        fq_mat_init(B, n, k, ctx);
+        fq_mat_init(C, m, k, ctx);
+        fq_mat_init(D, m, k, ctx);
+        fq_nmod_mat_init(nA, m, n, nctx);
+        fq_nmod_mat_init(nB, n, k, nctx);
+        fq_nmod_mat_init(nC, m, k, nctx);
+
+        fq_mat_randtest(A, state, ctx);
+        fq_mat_randtest(B, state, ctx);
+
+        for (r = 0; r < m; r++)
+        {
+            for (s = 0; s < n; s++)
+            {
+                c = fq_mat_entry(A, r, s);
+                e = fq_nmod_mat_entry(nA, r, s);
+                for (l = 0; l < c->length; l++)
+                    nmod_poly_set_coeff_ui(e, l, fmpz_get_ui(c->coeffs + l));
+            }
+        }
+
+        for (r = 0; r < n; r++)
+        {
+            for (s = 0; s < k; s++)
+            {
+                c = fq_mat_entry(B, r, s);
+                e = fq_nmod_mat_entry(nB, r, s);
+                for (l = 0; l < c->length; l++)
+                    nmod_poly_set_coeff_ui(e, l, fmpz_get_ui(c->coeffs + l));
+            }
+        }
+
+        fq_mat_mul_eval(C, A, B, ctx);
+        fq_nmod_mat_mul_classical(nC, nA, nB, nctx);
+
+        for (r = 0; r < m; r++)
+        {
+            for (s = 0; s < k; s++)
+            {
+                c = fq_mat_entry(D, r, s);
+                e = fq_nmod_mat_entry(nC, r, s);
+                fmpz_poly_zero(c);
+                for (l = 0; l < e->length; l++)
+                    fmpz_poly_set_coeff_ui(c, l, e->coeffs[l]);
+            }
+        }
+
+        result = fq_mat_equal(C, D, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL (fq_nmod):\n");
+            flint_printf("m, n, k, d = %wd, %wd, %wd, %wd\n", m, n, k, d);
+            fq_ctx_print(ctx);
+            fq_mat_print_pretty(C, ctx);
+            fq_mat_print_pretty(D, ctx);
+            abort();
+        }
+
+        fq_mat_clear(A, ctx);
+        fq_mat_clear(B, ctx);
+        fq_mat_clear(C, ctx);
+        fq_mat_clear(D, ctx);
+        fq_nmod_mat_clear(nA, nctx);
+        fq_nmod_mat_clear(nB, nctx);
+        fq_nmod_mat_clear(nC, nctx);
+
+        fq_nmod_ctx_clear(nctx);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Check aliasing of C and A */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fq_ctx_t ctx;
+        fq_mat_t A, B, D;
+        slong d, m, n;
+
+        d = n_randint(state, 12) + 1;
+        _fq_ctx_randtest_eval(ctx, state, d);
+
+        m = n_randint(state, 20);
+        n = n_randint(state, 20);
+
+        fq_mat_init(A, m, n, ctx);
+        fq_mat_init(B, n, n, ctx);
+        fq_mat_init(D, m, n, ctx);
+
+        fq_mat_randtest(A, state, ctx);
+        fq_mat_randtest(B, state, ctx);
+
+        fq_mat_mul_classical(D, A, B, ctx);
+        fq_mat_mul_eval(A, A, B, ctx);
+
+        result = fq_mat_equal(A, D, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing):\n");
+            flint_printf("m, n, d = %wd, %wd, %wd\n", m, n, d);
+            fq_mat_print_pretty(A, ctx);
+            fq_mat_print_pretty(D, ctx);
+            abort();
+        }
+
+        fq_mat_clear(A, ctx);
+        fq_mat_clear(B, ctx);
+        fq_mat_clear(D, ctx);
+
+        fq_ctx_clear(ctx);
+    }
+
+    /* Check that fq_mat_mul gets here above the cutoff */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        fq_ctx_t ctx;
+        fq_mat_t A, B, C, D;
+        slong d, m, n, k;
+
+        d = n_randint(state, 12) + 1;
+        _fq_ctx_randtest_eval(ctx, state, d);
+
+        m = 16 + n_randint(state, 10);
+        n = n_randint(state, 30);
+        k = 16 + n_randint(state, 10);
+
+        if (!FQ_MAT_MUL_EVAL_CUTOFF(m, k, ctx))
+        {
+            flint_printf("FAIL (cutoff):\n");
+            flint_printf("m, k, d = %wd, %wd, %wd\n", m, k, d);
+            fq_ctx_print(ctx);
+            abort();
+        }
+
+        fq_mat_init(A, m, n, ctx);
+        fq_mat_init(B, n, k, ctx);
+        fq_mat_init(C, m, k, ctx);
+        fq_mat_init(D, m, k, ctx);
+
+        fq_mat_randtest(A, state, ctx);
+        fq_mat_randtest(B, state, ctx);
+
+        fq_mat_mul(C, A, B, ctx);
+        fq_mat_mul_classical(D, A, B, ctx);
+
+        result = fq_mat_equal(C, D, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL (fq_mat_mul):\n");
+            flint_printf("m, n, k, d = %wd, %wd, %wd, %wd\n", m, n, k, d);
+            fq_mat_print_pretty(C, ctx);
+            fq_mat_print_pretty(D, ctx);
+            abort();
+        }
+
+        fq_mat_clear(A, ctx);
+        fq_mat_clear(B, ctx);
+        fq_mat_clear(C, ctx);
+        fq_mat_clear(D, ctx);
+
+        fq_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
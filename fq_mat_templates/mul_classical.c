@@ -36,8 +36,7 @@ TEMPLATE(T, mat_mul_classical) (TEMPLATE(T, mat_t) C,
                                 const TEMPLATE(T, ctx_t) ctx)
 {
     slong ar, bc, br;
-    slong i, j, k;
-    TEMPLATE(T, t) t;
+    slong i, j;
 
     ar = A->r;
     br = B->r;
@@ -59,29 +58,14 @@ TEMPLATE(T, mat_mul_classical) (TEMPLATE(T, mat_t) C,
         return;
     }
 
-    TEMPLATE(T, init) (t, ctx);
-
     for (i = 0; i < ar; i++)
     {
         for (j = 0; j < bc; j++)
         {
-            TEMPLATE(T, mul) (TEMPLATE(T, mat_entry) (C, i, j),
-                              TEMPLATE(T, mat_entry) (A, i, 0),
-                              TEMPLATE(T, mat_entry) (B, 0, j), ctx);
-
-            for (k = 1; k < br; k++)
-            {
-                TEMPLATE(T, mul) (t,
-                                  TEMPLATE(T, mat_entry) (A, i, k),
-                                  TEMPLATE(T, mat_entry) (B, k, j), ctx);
-
-                TEMPLATE(T, add) (TEMPLATE(T, mat_entry) (C, i, j),
-                                  TEMPLATE(T, mat_entry) (C, i, j), t, ctx);
-            }
+            _TEMPLATE(T, vec_dot_ptr) (TEMPLATE(T, mat_entry) (C, i, j),
+                                       A->rows[i], B->rows, j, br, ctx);
         }
     }
-
-    TEMPLATE(T, clear) (t, ctx);
 }
 
 
@@ -45,6 +45,9 @@ extern "C" {
 typedef nmod_poly_t fq_nmod_t;
 typedef nmod_poly_struct fq_nmod_struct;
 
+/* Largest degree for which products are reduced with a precomputed table */
+#define FQ_NMOD_SMALL_DEGREE 8
+
 typedef struct
 {
     fmpz p;
@@ -59,6 +62,10 @@ typedef struct
     nmod_poly_t modulus;
     nmod_poly_t inv;
 
+    /* x^(d + i) mod f for 0 <= i < d - 1 by columns, NULL for large d */
+    mp_limb_t *small_red;
+    int small_nlimbs;
+
     char *var;
 }
 fq_nmod_ctx_struct;
@@ -200,33 +207,20 @@ void _fq_nmod_sparse_reduce(mp_limb_t *R, slong lenR, const fq_nmod_ctx_t ctx)
     }
 }
 
-FQ_NMOD_INLINE void _fq_nmod_dense_reduce(mp_limb_t* R, slong lenR, const fq_nmod_ctx_t ctx)
-{
-    mp_limb_t  *q, *r;
+FLINT_DLL void _fq_nmod_dense_reduce(mp_ptr R, slong lenR,
+                                                   const fq_nmod_ctx_t ctx);
 
-    if (lenR < ctx->modulus->length)
-    {
-        _nmod_vec_reduce(R, R, lenR, ctx->mod);
-        return;
-    }
-    
-    q = _nmod_vec_init(lenR - ctx->modulus->length + 1);
-    r = _nmod_vec_init(ctx->modulus->length - 1);
+FLINT_DLL void _fq_nmod_mul_small(mp_ptr rop, mp_srcptr op1, slong len1,
+                      mp_srcptr op2, slong len2, const fq_nmod_ctx_t ctx);
 
-    _nmod_poly_divrem_newton_n_preinv(q, r, R, lenR, 
-                                      ctx->modulus->coeffs, ctx->modulus->length,
-                                      ctx->inv->coeffs, ctx->inv->length,
-                                      ctx->mod);
-
-    _nmod_vec_set(R, r, ctx->modulus->length - 1);
-    _nmod_vec_clear(q);
-    _nmod_vec_clear(r);
-
-}
+FLINT_DLL void _fq_nmod_reduce_small(mp_ptr R, slong lenR,
+                                                  const fq_nmod_ctx_t ctx);
 
 FQ_NMOD_INLINE void _fq_nmod_reduce(mp_limb_t* R, slong lenR, const fq_nmod_ctx_t ctx)
 {
-    if (ctx->sparse_modulus)
+    if (ctx->small_red != NULL && lenR < 2 * ctx->modulus->length - 2)
+        _fq_nmod_reduce_small(R, lenR, ctx);
+    else if (ctx->sparse_modulus)
         _fq_nmod_sparse_reduce(R, lenR, ctx);
     else
         _fq_nmod_dense_reduce(R, lenR, ctx);    
@@ -239,6 +233,34 @@ FQ_NMOD_INLINE void fq_nmod_reduce(fq_nmod_t rop, const fq_nmod_ctx_t ctx)
     _nmod_poly_normalise(rop);
 }
 
+/*
+   Adds the product of (op1, len1) and (op2, len2) to the unreduced
+   accumulator acc, which holds three limbs per coefficient
+*/
+FQ_NMOD_INLINE
+void _fq_nmod_addmul_lazy(mp_ptr acc, mp_srcptr op1, slong len1,
+                                                mp_srcptr op2, slong len2)
+{
+    slong i, j;
+    mp_limb_t t1, t0;
+    mp_ptr s;
+
+    for (i = 0; i < len1; i++)
+    {
+        s = acc + 3 * i;
+
+        for (j = 0; j < len2; j++, s += 3)
+        {
+            umul_ppmm(t1, t0, op1[i], op2[j]);
+            add_sssaaaaaa(s[2], s[1], s[0], s[2], s[1], s[0],
+                                                        UWORD(0), t1, t0);
+        }
+    }
+}
+
+FLINT_DLL void _fq_nmod_reduce_lazy(fq_nmod_t rop, mp_ptr acc, slong len,
+                                                  const fq_nmod_ctx_t ctx);
+
 /* Basic arithmetic **********************************************************/
 
 FLINT_DLL void fq_nmod_add(fq_nmod_t rop, const fq_nmod_t op1, const fq_nmod_t op2, const fq_nmod_ctx_t ctx);
@@ -34,5 +34,7 @@ void fq_nmod_ctx_clear(fq_nmod_ctx_t ctx)
     fmpz_clear(fq_nmod_ctx_prime(ctx));
     _nmod_vec_clear(ctx->a);
     flint_free(ctx->j);
+    if (ctx->small_red != NULL)
+        _nmod_vec_clear(ctx->small_red);
     flint_free(ctx->var);
 }
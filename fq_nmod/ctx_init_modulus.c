@@ -32,7 +32,7 @@ void
 fq_nmod_ctx_init_modulus(fq_nmod_ctx_t ctx, const nmod_poly_t modulus,
                          const char *var)
 {
-    slong nz;
+    slong nz, d;
     int i, j;
     mp_limb_t inv;
 
@@ -88,4 +88,36 @@ fq_nmod_ctx_init_modulus(fq_nmod_ctx_t ctx, const nmod_poly_t modulus,
     nmod_poly_init(ctx->inv, ctx->mod.n);
     nmod_poly_reverse(ctx->inv, ctx->modulus, ctx->modulus->length);
     nmod_poly_inv_series_newton(ctx->inv, ctx->inv, ctx->modulus->length);
+
+    /* Tabulate x^d, ..., x^(2d - 2) mod f for the small degree kernels */
+    d = modulus->length - 1;
+    ctx->small_red = NULL;
+    ctx->small_nlimbs = _nmod_vec_dot_bound_limbs(d, ctx->mod);
+
+    if (d <= FQ_NMOD_SMALL_DEGREE)
+    {
+        mp_limb_t r[FQ_NMOD_SMALL_DEGREE], c;
+        slong k;
+
+        ctx->small_red = _nmod_vec_init(FLINT_MAX(d - 1, 1) * d);
+
+        _nmod_vec_zero(r, d);
+        for (k = 0; k < ctx->len - 1; k++)
+            r[ctx->j[k]] = nmod_neg(ctx->a[k], ctx->mod);
+
+        for (i = 0; i < d - 1; i++)
+        {
+            for (j = 0; j < d; j++)
+                ctx->small_red[j * (d - 1) + i] = r[j];
+
+            c = r[d - 1];
+            for (j = d - 1; j > 0; j--)
+                r[j] = r[j - 1];
+            r[0] = 0;
+
+            for (k = 0; k < ctx->len - 1; k++)
+                r[ctx->j[k]] = nmod_sub(r[ctx->j[k]],
+                                   nmod_mul(c, ctx->a[k], ctx->mod), ctx->mod);
+        }
+    }
 }
@@ -0,0 +1,59 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod.h"
+
+/*
+   Only the remainder is wanted, so the quotient is formed in scratch space
+   on the stack and Q f is subtracted from the low coefficients in place.
+*/
+void _fq_nmod_dense_reduce(mp_ptr R, slong lenR, const fq_nmod_ctx_t ctx)
+{
+    const slong lenf = ctx->modulus->length, d = lenf - 1;
+    slong lenQ;
+    mp_ptr q, t;
+    TMP_INIT;
+
+    if (lenR < lenf)
+    {
+        _nmod_vec_reduce(R, R, lenR, ctx->mod);
+        return;
+    }
+
+    lenQ = lenR - d;
+
+    TMP_START;
+    q = TMP_ALLOC((lenQ + FLINT_MAX(lenQ, d)) * sizeof(mp_limb_t));
+    t = q + lenQ;
+
+    _nmod_poly_reverse(t, R + d, lenQ, lenQ);
+    _nmod_poly_mullow(q, t, lenQ, ctx->inv->coeffs,
+                      FLINT_MIN(lenQ, ctx->inv->length), lenQ, ctx->mod);
+    _nmod_poly_reverse(q, q, lenQ, lenQ);
+
+    if (d >= lenQ)
+        _nmod_poly_mullow(t, ctx->modulus->coeffs, d, q, lenQ, d, ctx->mod);
+    else
+        _nmod_poly_mullow(t, q, lenQ, ctx->modulus->coeffs, d, d, ctx->mod);
+
+    _nmod_vec_sub(R, R, t, d, ctx->mod);
+
+    TMP_END;
+}
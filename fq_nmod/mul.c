@@ -29,6 +29,24 @@
 
 void fq_nmod_mul(fq_nmod_t rop, const fq_nmod_t op1, const fq_nmod_t op2, const fq_nmod_ctx_t ctx)
 {
+    const slong d = fq_nmod_ctx_degree(ctx);
+
+    if (ctx->small_red != NULL && op1->length <= d && op2->length <= d)
+    {
+        if (op1->length == 0 || op2->length == 0)
+        {
+            nmod_poly_zero(rop);
+            return;
+        }
+
+        nmod_poly_fit_length(rop, d);
+        _fq_nmod_mul_small(rop->coeffs, op1->coeffs, op1->length,
+                                        op2->coeffs, op2->length, ctx);
+        rop->length = d;
+        _nmod_poly_normalise(rop);
+        return;
+    }
+
     nmod_poly_mul(rop, op1, op2);
 
     fq_nmod_reduce(rop, ctx);
@@ -0,0 +1,36 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod.h"
+#include "fq_nmod_packed.h"
+
+void _fq_nmod_mul_small(mp_ptr rop, mp_srcptr op1, slong len1,
+                       mp_srcptr op2, slong len2, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    mp_limb_t a[FQ_NMOD_SMALL_DEGREE], b[FQ_NMOD_SMALL_DEGREE];
+
+    _nmod_vec_set(a, op1, len1);
+    _nmod_vec_zero(a + len1, d - len1);
+    _nmod_vec_set(b, op2, len2);
+    _nmod_vec_zero(b + len2, d - len2);
+
+    _fq_nmod_packed_mul(rop, a, b, ctx);
+}
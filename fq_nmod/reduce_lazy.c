@@ -0,0 +1,47 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod.h"
+
+void _fq_nmod_reduce_lazy(fq_nmod_t rop, mp_ptr acc, slong len,
+                                                   const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    mp_limb_t s0, s1, s2;
+    slong k;
+
+    /* Coefficient k only reads limbs 3k to 3k + 2, so this can be in place */
+    for (k = 0; k < len; k++)
+    {
+        s0 = acc[3 * k];
+        s1 = acc[3 * k + 1];
+        s2 = acc[3 * k + 2];
+        NMOD_RED(s2, s2, ctx->mod);
+        NMOD_RED3(acc[k], s2, s1, s0, ctx->mod);
+    }
+
+    _fq_nmod_reduce(acc, len, ctx);
+
+    len = FLINT_MIN(len, d);
+    nmod_poly_fit_length(rop, len);
+    _nmod_vec_set(rop->coeffs, acc, len);
+    rop->length = len;
+    _nmod_poly_normalise(rop);
+}
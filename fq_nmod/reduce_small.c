@@ -0,0 +1,43 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod.h"
+
+void _fq_nmod_reduce_small(mp_ptr R, slong lenR, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    const mp_limb_t * T = ctx->small_red;
+    slong i, k, len;
+    mp_limb_t s;
+
+    if (lenR <= d)
+        return;
+
+    len = lenR - d;
+
+    for (k = 0; k < d; k++)
+    {
+        NMOD_VEC_DOT(s, i, len, R[d + i], T[k * (d - 1) + i],
+                                             ctx->mod, ctx->small_nlimbs);
+        R[k] = nmod_add(R[k], s, ctx->mod);
+    }
+
+    _nmod_vec_zero(R + d, len);
+}
@@ -27,6 +27,24 @@
 
 void fq_nmod_sqr(fq_nmod_t rop, const fq_nmod_t op, const fq_nmod_ctx_t ctx)
 {
+    const slong d = fq_nmod_ctx_degree(ctx);
+
+    if (ctx->small_red != NULL && op->length <= d)
+    {
+        if (op->length == 0)
+        {
+            nmod_poly_zero(rop);
+            return;
+        }
+
+        nmod_poly_fit_length(rop, d);
+        _fq_nmod_mul_small(rop->coeffs, op->coeffs, op->length,
+                                        op->coeffs, op->length, ctx);
+        rop->length = d;
+        _nmod_poly_normalise(rop);
+        return;
+    }
+
     nmod_poly_mul(rop, op, op);
 
     fq_nmod_reduce(rop, ctx);
@@ -0,0 +1,109 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fq_nmod.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_small....");
+    fflush(stdout);
+
+    /* Compare with multiplication and remainder in F_p[X] */
+    for (i = 0; i < 2000 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_t a, b, c;
+        nmod_poly_t f, r, s;
+        mp_limb_t p;
+        slong d;
+
+        p = n_randtest_prime(state, 0);
+        d = n_randint(state, FQ_NMOD_SMALL_DEGREE) + 1;
+
+        nmod_poly_init(f, p);
+        nmod_poly_init(r, p);
+        nmod_poly_init(s, p);
+
+        /* Random, not necessarily irreducible or monic, moduli */
+        do {
+            nmod_poly_randtest(f, state, d + 1);
+        } while (nmod_poly_degree(f) != d);
+
+        fq_nmod_ctx_init_modulus(ctx, f, "a");
+
+        fq_nmod_init(a, ctx);
+        fq_nmod_init(b, ctx);
+        fq_nmod_init(c, ctx);
+
+        fq_nmod_randtest(a, state, ctx);
+        fq_nmod_randtest(b, state, ctx);
+
+        if (n_randint(state, 2))
+        {
+            fq_nmod_mul(c, a, b, ctx);
+            nmod_poly_mul(r, a, b);
+        }
+        else
+        {
+            fq_nmod_sqr(c, a, ctx);
+            nmod_poly_mul(r, a, a);
+        }
+
+        /* Reduce a copy of the product through _fq_nmod_reduce */
+        nmod_poly_set(s, r);
+        fq_nmod_reduce(s, ctx);
+
+        nmod_poly_rem(r, r, f);
+
+        result = (nmod_poly_equal(c, r) && nmod_poly_equal(s, r));
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            flint_printf("p = %wu, d = %wd\n", p, d);
+            flint_printf("f = "), nmod_poly_print(f), flint_printf("\n");
+            flint_printf("a = "), nmod_poly_print(a), flint_printf("\n");
+            flint_printf("b = "), nmod_poly_print(b), flint_printf("\n");
+            flint_printf("c = "), nmod_poly_print(c), flint_printf("\n");
+            flint_printf("r = "), nmod_poly_print(r), flint_printf("\n");
+            flint_printf("s = "), nmod_poly_print(s), flint_printf("\n");
+            abort();
+        }
+
+        fq_nmod_clear(a, ctx);
+        fq_nmod_clear(b, ctx);
+        fq_nmod_clear(c, ctx);
+        fq_nmod_ctx_clear(ctx);
+
+        nmod_poly_clear(f);
+        nmod_poly_clear(r);
+        nmod_poly_clear(s);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -44,10 +44,48 @@ static __inline__ int FQ_NMOD_MAT_MUL_KS_CUTOFF(slong r, slong c, const fq_nmod_
         return 0;
 }
 
+/* Evaluation needs 2d - 1 points in the prime field */
+static __inline__ int FQ_NMOD_MAT_MUL_EVAL_CUTOFF(slong r, slong c, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+
+    if (ctx->mod.n >= (mp_limb_t) (2 * d - 1)
+        && FLINT_MIN(r, c) >= 16 && 2 * FLINT_MIN(r, c) >= d)
+        return 1;
+    else
+        return 0;
+}
+
+/* Packed products beat Kronecker substitution below the evaluation range */
+static __inline__ int FQ_NMOD_MAT_MUL_PACKED_CUTOFF(slong r, slong c, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+
+    if (ctx->small_red != NULL && ctx->mod.n >= (mp_limb_t) (2 * d - 1)
+        && FLINT_MIN(r, c) > 4)
+        return 1;
+    else
+        return 0;
+}
+
 #define T fq_nmod
 #define CAP_T FQ_NMOD
 #include "fq_mat_templates.h"
 #undef CAP_T
 #undef T
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+FLINT_DLL void fq_nmod_mat_mul_eval(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                         const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_mat_mul_packed(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                         const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
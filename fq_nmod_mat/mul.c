@@ -25,12 +25,16 @@
 
 #include "fq_nmod_mat.h"
 
-#ifdef T
-#undef T
-#endif
-
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_mat_templates/mul.c"
-#undef CAP_T
-#undef T
+void
+fq_nmod_mat_mul(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                             const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    if (FQ_NMOD_MAT_MUL_EVAL_CUTOFF(A->r, B->c, ctx))
+        fq_nmod_mat_mul_eval(C, A, B, ctx);
+    else if (FQ_NMOD_MAT_MUL_PACKED_CUTOFF(A->r, B->c, ctx))
+        fq_nmod_mat_mul_packed(C, A, B, ctx);
+    else if (FQ_NMOD_MAT_MUL_KS_CUTOFF(A->r, B->c, ctx))
+        fq_nmod_mat_mul_KS(C, A, B, ctx);
+    else
+        fq_nmod_mat_mul_classical(C, A, B, ctx);
+}
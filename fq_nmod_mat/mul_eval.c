@@ -0,0 +1,190 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod_mat.h"
+#include "nmod_mat.h"
+
+/*
+   Sets the rows of R, an m x d matrix, to x^k mod f for 0 <= k < m.
+*/
+static void
+_fq_nmod_mat_powers_mod(nmod_mat_t R, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    slong i, k;
+    mp_limb_t c;
+
+    nmod_mat_zero(R);
+
+    for (i = 0; i < FLINT_MIN(d, R->r); i++)
+        nmod_mat_entry(R, i, i) = UWORD(1);
+
+    for (i = d; i < R->r; i++)
+    {
+        c = nmod_mat_entry(R, i - 1, d - 1);
+
+        for (k = d - 1; k > 0; k--)
+            nmod_mat_entry(R, i, k) = nmod_mat_entry(R, i - 1, k - 1);
+
+        for (k = 0; k < ctx->len - 1; k++)
+            nmod_mat_entry(R, i, ctx->j[k]) = nmod_sub(
+                nmod_mat_entry(R, i, ctx->j[k]),
+                nmod_mul(c, ctx->a[k], ctx->mod), ctx->mod);
+    }
+}
+
+/*
+   Writes the coefficients of the entries of A into the columns of a
+   d x (A->r A->c) matrix X, one row per power of the generator.
+*/
+static void
+_fq_nmod_mat_get_coeffs(nmod_mat_t X, const fq_nmod_mat_t A)
+{
+    slong i, j, l;
+    const fq_nmod_struct * a;
+
+    nmod_mat_zero(X);
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < A->c; j++)
+        {
+            a = fq_nmod_mat_entry(A, i, j);
+
+            for (l = 0; l < a->length; l++)
+                nmod_mat_entry(X, l, i * A->c + j) = a->coeffs[l];
+        }
+    }
+}
+
+void
+fq_nmod_mat_mul_eval(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                             const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx), m = 2 * d - 1;
+    const mp_limb_t p = ctx->mod.n;
+    slong ar, br, bc, i, j, l, t;
+    nmod_mat_t V, R, W, E, X, Y, Z, At, Bt, Ct;
+    fq_nmod_struct * c;
+
+    ar = A->r;
+    br = B->r;
+    bc = B->c;
+
+    if (br == 0)
+    {
+        fq_nmod_mat_zero(C, ctx);
+        return;
+    }
+
+    if (ar == 0 || bc == 0)
+        return;
+
+    if (p < (mp_limb_t) m)
+    {
+        flint_printf("Exception (fq_nmod_mat_mul_eval). "
+                     "Characteristic too small.\n");
+        abort();
+    }
+
+    /* Evaluation at 0, ..., m - 1 is V[k][t] = t^k */
+    nmod_mat_init(V, m, m, p);
+    for (t = 0; t < m; t++)
+    {
+        nmod_mat_entry(V, 0, t) = UWORD(1);
+        for (l = 1; l < m; l++)
+            nmod_mat_entry(V, l, t) = nmod_mul(nmod_mat_entry(V, l - 1, t),
+                                                                 t, ctx->mod);
+    }
+
+    /* Interpolation followed by reduction mod f is W = V^(-1) R */
+    nmod_mat_init(R, m, d, p);
+    nmod_mat_init(W, m, d, p);
+    _fq_nmod_mat_powers_mod(R, ctx);
+    nmod_mat_solve(W, V, R);
+    nmod_mat_clear(R);
+
+    /* The first d rows of V evaluate the entries of A and B */
+    nmod_mat_init(E, m, d, p);
+    for (t = 0; t < m; t++)
+        for (l = 0; l < d; l++)
+            nmod_mat_entry(E, t, l) = nmod_mat_entry(V, l, t);
+    nmod_mat_clear(V);
+
+    /* Row t of Y holds A evaluated at t, of Z holds B evaluated at t */
+    nmod_mat_init(X, d, ar * br, p);
+    nmod_mat_init(Y, m, ar * br, p);
+    _fq_nmod_mat_get_coeffs(X, A);
+    nmod_mat_mul(Y, E, X);
+    nmod_mat_clear(X);
+
+    nmod_mat_init(X, d, br * bc, p);
+    nmod_mat_init(Z, m, br * bc, p);
+    _fq_nmod_mat_get_coeffs(X, B);
+    nmod_mat_mul(Z, E, X);
+    nmod_mat_clear(X);
+    nmod_mat_clear(E);
+
+    /* Multiply the m pairs of evaluated matrices over F_p */
+    nmod_mat_init(At, ar, br, p);
+    nmod_mat_init(Bt, br, bc, p);
+    nmod_mat_init(Ct, ar, bc, p);
+    nmod_mat_init(X, ar * bc, m, p);
+
+    for (t = 0; t < m; t++)
+    {
+        for (i = 0; i < ar; i++)
+            _nmod_vec_set(At->rows[i], Y->rows[t] + i * br, br);
+        for (i = 0; i < br; i++)
+            _nmod_vec_set(Bt->rows[i], Z->rows[t] + i * bc, bc);
+
+        nmod_mat_mul(Ct, At, Bt);
+
+        for (i = 0; i < ar; i++)
+            for (j = 0; j < bc; j++)
+                nmod_mat_entry(X, i * bc + j, t) = nmod_mat_entry(Ct, i, j);
+    }
+
+    nmod_mat_clear(At);
+    nmod_mat_clear(Bt);
+    nmod_mat_clear(Ct);
+    nmod_mat_clear(Y);
+    nmod_mat_clear(Z);
+
+    /* Interpolate and reduce all entries with a single product */
+    nmod_mat_init(Y, ar * bc, d, p);
+    nmod_mat_mul(Y, X, W);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            c = fq_nmod_mat_entry(C, i, j);
+            nmod_poly_fit_length(c, d);
+            _nmod_vec_set(c->coeffs, Y->rows[i * bc + j], d);
+            c->length = d;
+            _nmod_poly_normalise(c);
+        }
+    }
+
+    nmod_mat_clear(X);
+    nmod_mat_clear(Y);
+    nmod_mat_clear(W);
+}
@@ -0,0 +1,42 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod_mat.h"
+#include "fq_nmod_packed.h"
+
+void
+fq_nmod_mat_mul_packed(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                             const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    fq_nmod_packed_mat_t X, Y, Z;
+
+    fq_nmod_packed_mat_init(X, A->r, A->c, ctx);
+    fq_nmod_packed_mat_init(Y, B->r, B->c, ctx);
+    fq_nmod_packed_mat_init(Z, A->r, B->c, ctx);
+
+    fq_nmod_packed_mat_set_fq_nmod_mat(X, A, ctx);
+    fq_nmod_packed_mat_set_fq_nmod_mat(Y, B, ctx);
+    fq_nmod_packed_mat_mul(Z, X, Y, ctx);
+    fq_nmod_packed_mat_get_fq_nmod_mat(C, Z, ctx);
+
+    fq_nmod_packed_mat_clear(X, ctx);
+    fq_nmod_packed_mat_clear(Y, ctx);
+    fq_nmod_packed_mat_clear(Z, ctx);
+}
@@ -0,0 +1,196 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fq_nmod_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_eval....");
+    fflush(stdout);
+
+    /* Compare with classical multiplication */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_mat_t A, B, C, D;
+        fmpz_t p;
+        mp_limb_t q;
+        slong d, m, n, k;
+
+        d = n_randint(state, 12) + 1;
+        q = n_randprime(state, 2 + n_randint(state, FLINT_BITS - 2), 1);
+        while (q < 2 * d - 1)
+            q = n_nextprime(q, 1);
+        fmpz_init_set_ui(p, q);
+        fq_nmod_ctx_init(ctx, p, d, "a");
+        fmpz_clear(p);
+
+        m = n_randint(state, 20);
+        n = n_randint(state, 20);
+        k = n_randint(state, 20);
+
+        fq_nmod_mat_init(A, m, n, ctx);
+        fq_nmod_mat_init(B, n, k, ctx);
+        fq_nmod_mat_init(C, m, k, ctx);
+        fq_nmod_mat_init(D, m, k, ctx);
+
+        fq_nmod_mat_randtest(A, state, ctx);
+        fq_nmod_mat_randtest(B, state, ctx);
+        fq_nmod_mat_randtest(C, state, ctx);
+
+        fq_nmod_mat_mul_eval(C, A, B, ctx);
+        fq_nmod_mat_mul_classical(D, A, B, ctx);
+
+        result = fq_nmod_mat_equal(C, D, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m, n, k, d = %wd, %wd, %wd, %wd\n", m, n, k, d);
+            fq_nmod_mat_print_pretty(A, ctx);
+            fq_nmod_mat_print_pretty(B, ctx);
+            fq_nmod_mat_print_pretty(C, ctx);
+            fq_nmod_mat_print_pretty(D, ctx);
+            abort();
+        }
+
+        fq_nmod_mat_clear(A, ctx);
+        fq_nmod_mat_clear(B, ctx);
+        fq_nmod_mat_clear(C, ctx);
+        fq_nmod_mat_clear(D, ctx);
+
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    /* Check aliasing of C and A */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_mat_t A, B, D;
+        fmpz_t p;
+        mp_limb_t q;
+        slong d, m, n;
+
+        d = n_randint(state, 12) + 1;
+        q = n_randprime(state, 2 + n_randint(state, FLINT_BITS - 2), 1);
+        while (q < 2 * d - 1)
+            q = n_nextprime(q, 1);
+        fmpz_init_set_ui(p, q);
+        fq_nmod_ctx_init(ctx, p, d, "a");
+        fmpz_clear(p);
+
+        m = n_randint(state, 20);
+        n = n_randint(state, 20);
+
+        fq_nmod_mat_init(A, m, n, ctx);
+        fq_nmod_mat_init(B, n, n, ctx);
+        fq_nmod_mat_init(D, m, n, ctx);
+
+        fq_nmod_mat_randtest(A, state, ctx);
+        fq_nmod_mat_randtest(B, state, ctx);
+
+        fq_nmod_mat_mul_classical(D, A, B, ctx);
+        fq_nmod_mat_mul_eval(A, A, B, ctx);
+
+        result = fq_nmod_mat_equal(A, D, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing):\n");
+            flint_printf("m, n, d = %wd, %wd, %wd\n", m, n, d);
+            fq_nmod_mat_print_pretty(A, ctx);
+            fq_nmod_mat_print_pretty(D, ctx);
+            abort();
+        }
+
+        fq_nmod_mat_clear(A, ctx);
+        fq_nmod_mat_clear(B, ctx);
+        fq_nmod_mat_clear(D, ctx);
+
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    /* Check that fq_nmod_mat_mul gets here above the cutoff */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_mat_t A, B, C, D;
+        fmpz_t p;
+        mp_limb_t q;
+        slong d, m, n, k;
+
+        d = n_randint(state, 12) + 1;
+        q = n_randprime(state, 2 + n_randint(state, FLINT_BITS - 2), 1);
+        while (q < 2 * d - 1)
+            q = n_nextprime(q, 1);
+        fmpz_init_set_ui(p, q);
+        fq_nmod_ctx_init(ctx, p, d, "a");
+        fmpz_clear(p);
+
+        m = 16 + n_randint(state, 10);
+        n = n_randint(state, 30);
+        k = 16 + n_randint(state, 10);
+
+        if (!FQ_NMOD_MAT_MUL_EVAL_CUTOFF(m, k, ctx))
+        {
+            flint_printf("FAIL (cutoff):\n");
+            flint_printf("m, k, d = %wd, %wd, %wd\n", m, k, d);
+            fq_nmod_ctx_print(ctx);
+            abort();
+        }
+
+        fq_nmod_mat_init(A, m, n, ctx);
+        fq_nmod_mat_init(B, n, k, ctx);
+        fq_nmod_mat_init(C, m, k, ctx);
+        fq_nmod_mat_init(D, m, k, ctx);
+
+        fq_nmod_mat_randtest(A, state, ctx);
+        fq_nmod_mat_randtest(B, state, ctx);
+
+        fq_nmod_mat_mul(C, A, B, ctx);
+        fq_nmod_mat_mul_classical(D, A, B, ctx);
+
+        result = fq_nmod_mat_equal(C, D, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL (fq_nmod_mat_mul):\n");
+            flint_printf("m, n, k, d = %wd, %wd, %wd, %wd\n", m, n, k, d);
+            fq_nmod_mat_print_pretty(C, ctx);
+            fq_nmod_mat_print_pretty(D, ctx);
+            abort();
+        }
+
+        fq_nmod_mat_clear(A, ctx);
+        fq_nmod_mat_clear(B, ctx);
+        fq_nmod_mat_clear(C, ctx);
+        fq_nmod_mat_clear(D, ctx);
+
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
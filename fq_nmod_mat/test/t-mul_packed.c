@@ -0,0 +1,108 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fq_nmod_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_packed....");
+    fflush(stdout);
+
+    /* Compare with classical multiplication, with and without aliasing,
+       and through fq_nmod_mat_mul in the packed range */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_mat_t A, B, C, D;
+        nmod_poly_t f;
+        slong d, m, k, n;
+        int alias;
+
+        d = n_randint(state, FQ_NMOD_SMALL_DEGREE) + 1;
+        m = n_randint(state, 16);
+        k = n_randint(state, 16);
+        n = n_randint(state, 16);
+
+        alias = n_randint(state, 4);
+        if (alias == 1 || alias == 2)
+            k = n = m;
+
+        nmod_poly_init(f, n_randtest_prime(state, 0));
+        do {
+            nmod_poly_randtest(f, state, d + 1);
+        } while (nmod_poly_degree(f) != d);
+
+        fq_nmod_ctx_init_modulus(ctx, f, "a");
+
+        fq_nmod_mat_init(A, m, k, ctx);
+        fq_nmod_mat_init(B, k, n, ctx);
+        fq_nmod_mat_init(C, m, n, ctx);
+        fq_nmod_mat_init(D, m, n, ctx);
+
+        fq_nmod_mat_randtest(A, state, ctx);
+        fq_nmod_mat_randtest(B, state, ctx);
+        fq_nmod_mat_randtest(D, state, ctx);
+
+        fq_nmod_mat_mul_classical(C, A, B, ctx);
+
+        if (alias == 1)
+        {
+            fq_nmod_mat_mul_packed(A, A, B, ctx);
+            fq_nmod_mat_set(D, A, ctx);
+        }
+        else if (alias == 2)
+        {
+            fq_nmod_mat_mul_packed(B, A, B, ctx);
+            fq_nmod_mat_set(D, B, ctx);
+        }
+        else if (alias == 3)
+            fq_nmod_mat_mul(D, A, B, ctx);
+        else
+            fq_nmod_mat_mul_packed(D, A, B, ctx);
+
+        result = fq_nmod_mat_equal(C, D, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            flint_printf("d = %wd, m = %wd, k = %wd, n = %wd, alias = %d\n",
+                                                          d, m, k, n, alias);
+            flint_printf("f = "), nmod_poly_print(f), flint_printf("\n");
+            abort();
+        }
+
+        fq_nmod_mat_clear(A, ctx);
+        fq_nmod_mat_clear(B, ctx);
+        fq_nmod_mat_clear(C, ctx);
+        fq_nmod_mat_clear(D, ctx);
+        fq_nmod_ctx_clear(ctx);
+        nmod_poly_clear(f);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#ifndef FQ_NMOD_PACKED_H
+#define FQ_NMOD_PACKED_H
+
+#include "fq_nmod.h"
+#include "fq_nmod_mat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+   Elements of GF(p^d) with d <= FQ_NMOD_SMALL_DEGREE, each stored as its
+   d reduced coefficients, zero padded, one after the other in a single
+   array. Element i of a vector is coeffs + i * d.
+*/
+typedef struct
+{
+    mp_ptr coeffs;
+    slong length;
+    slong degree;
+}
+fq_nmod_packed_vec_struct;
+
+typedef fq_nmod_packed_vec_struct fq_nmod_packed_vec_t[1];
+
+/* Matrix entries are stored row by row, rows[i] pointing to row i */
+typedef struct
+{
+    mp_ptr entries;
+    slong r;
+    slong c;
+    slong degree;
+    mp_ptr * rows;
+}
+fq_nmod_packed_mat_struct;
+
+typedef fq_nmod_packed_mat_struct fq_nmod_packed_mat_t[1];
+
+#define fq_nmod_packed_vec_entry(vec, i) ((vec)->coeffs + (i) * (vec)->degree)
+
+#define fq_nmod_packed_mat_entry(mat, i, j) \
+    ((mat)->rows[i] + (j) * (mat)->degree)
+
+/* Element kernels ***********************************************************/
+
+FLINT_DLL void _fq_nmod_packed_mul(mp_ptr rop, mp_srcptr op1,
+                                 mp_srcptr op2, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void _fq_nmod_packed_dot(mp_ptr res, mp_srcptr vec1, slong stride1,
+                              mp_srcptr vec2, slong stride2, slong len,
+                                                 const fq_nmod_ctx_t ctx);
+
+/* Vectors *******************************************************************/
+
+FLINT_DLL void fq_nmod_packed_vec_init(fq_nmod_packed_vec_t vec, slong len,
+                                                 const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_packed_vec_clear(fq_nmod_packed_vec_t vec,
+                                                 const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_packed_vec_set_fq_nmod_vec(fq_nmod_packed_vec_t vec,
+                     const fq_nmod_struct * x, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_packed_vec_get_fq_nmod_vec(fq_nmod_struct * x,
+                   const fq_nmod_packed_vec_t vec, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_packed_vec_add(fq_nmod_packed_vec_t res,
+                               const fq_nmod_packed_vec_t vec1,
+              const fq_nmod_packed_vec_t vec2, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_packed_vec_sub(fq_nmod_packed_vec_t res,
+                               const fq_nmod_packed_vec_t vec1,
+              const fq_nmod_packed_vec_t vec2, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_packed_vec_scalar_addmul_fq_nmod(
+                    fq_nmod_packed_vec_t res, const fq_nmod_packed_vec_t vec,
+                           const fq_nmod_t c, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_packed_vec_dot(fq_nmod_t res,
+                               const fq_nmod_packed_vec_t vec1,
+              const fq_nmod_packed_vec_t vec2, const fq_nmod_ctx_t ctx);
+
+/* Matrices ******************************************************************/
+
+FLINT_DLL void fq_nmod_packed_mat_init(fq_nmod_packed_mat_t mat,
+                          slong rows, slong cols, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_packed_mat_clear(fq_nmod_packed_mat_t mat,
+                                                 const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_packed_mat_set_fq_nmod_mat(fq_nmod_packed_mat_t mat,
+                      const fq_nmod_mat_t A, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_packed_mat_get_fq_nmod_mat(fq_nmod_mat_t A,
+                   const fq_nmod_packed_mat_t mat, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_packed_mat_mul(fq_nmod_packed_mat_t C,
+                        const fq_nmod_packed_mat_t A,
+                 const fq_nmod_packed_mat_t B, const fq_nmod_ctx_t ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,138 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod_packed.h"
+
+/*
+   Sums the unreduced products in as many limbs per coefficient as the
+   bound on len * d products of reduced coefficients needs, and reduces
+   the 2d - 1 coefficients once at the end. With d a constant the
+   accumulation is unrolled.
+*/
+static __inline__ void
+__fq_nmod_packed_dot(mp_ptr res, mp_srcptr vec1, slong stride1,
+                     mp_srcptr vec2, slong stride2, slong len,
+                     const slong d, const fq_nmod_ctx_t ctx)
+{
+    mp_limb_t acc[3 * (2 * FQ_NMOD_SMALL_DEGREE - 1)];
+    mp_limb_t P[2 * FQ_NMOD_SMALL_DEGREE - 1], t1, t0;
+    mp_srcptr a, b;
+    slong i, j, k;
+    int nlimbs = _nmod_vec_dot_bound_limbs(len * d, ctx->mod);
+
+    if (nlimbs <= 1)
+    {
+        flint_mpn_zero(P, 2 * d - 1);
+
+        for (i = 0; i < len; i++)
+        {
+            a = vec1 + i * stride1;
+            b = vec2 + i * stride2;
+
+            for (j = 0; j < d; j++)
+                for (k = 0; k < d; k++)
+                    P[j + k] += a[j] * b[k];
+        }
+
+        for (k = 0; k < 2 * d - 1; k++)
+            NMOD_RED(P[k], P[k], ctx->mod);
+    }
+    else if (nlimbs == 2)
+    {
+        flint_mpn_zero(acc, 2 * (2 * d - 1));
+
+        for (i = 0; i < len; i++)
+        {
+            a = vec1 + i * stride1;
+            b = vec2 + i * stride2;
+
+            for (j = 0; j < d; j++)
+            {
+                for (k = 0; k < d; k++)
+                {
+                    umul_ppmm(t1, t0, a[j], b[k]);
+                    add_ssaaaa(acc[2 * (j + k) + 1], acc[2 * (j + k)],
+                       acc[2 * (j + k) + 1], acc[2 * (j + k)], t1, t0);
+                }
+            }
+        }
+
+        for (k = 0; k < 2 * d - 1; k++)
+            NMOD2_RED2(P[k], acc[2 * k + 1], acc[2 * k], ctx->mod);
+    }
+    else
+    {
+        flint_mpn_zero(acc, 3 * (2 * d - 1));
+
+        for (i = 0; i < len; i++)
+            _fq_nmod_addmul_lazy(acc, vec1 + i * stride1, d,
+                                                  vec2 + i * stride2, d);
+
+        for (k = 0; k < 2 * d - 1; k++)
+        {
+            NMOD_RED(t0, acc[3 * k + 2], ctx->mod);
+            NMOD_RED3(P[k], t0, acc[3 * k + 1], acc[3 * k], ctx->mod);
+        }
+    }
+
+    _fq_nmod_reduce_small(P, 2 * d - 1, ctx);
+    _nmod_vec_set(res, P, d);
+}
+
+void _fq_nmod_packed_dot(mp_ptr res, mp_srcptr vec1, slong stride1,
+                         mp_srcptr vec2, slong stride2, slong len,
+                                                   const fq_nmod_ctx_t ctx)
+{
+    switch (fq_nmod_ctx_degree(ctx))
+    {
+        case 1:
+            __fq_nmod_packed_dot(res, vec1, stride1, vec2, stride2, len,
+                                                                   1, ctx);
+            break;
+        case 2:
+            __fq_nmod_packed_dot(res, vec1, stride1, vec2, stride2, len,
+                                                                   2, ctx);
+            break;
+        case 3:
+            __fq_nmod_packed_dot(res, vec1, stride1, vec2, stride2, len,
+                                                                   3, ctx);
+            break;
+        case 4:
+            __fq_nmod_packed_dot(res, vec1, stride1, vec2, stride2, len,
+                                                                   4, ctx);
+            break;
+        case 5:
+            __fq_nmod_packed_dot(res, vec1, stride1, vec2, stride2, len,
+                                                                   5, ctx);
+            break;
+        case 6:
+            __fq_nmod_packed_dot(res, vec1, stride1, vec2, stride2, len,
+                                                                   6, ctx);
+            break;
+        case 7:
+            __fq_nmod_packed_dot(res, vec1, stride1, vec2, stride2, len,
+                                                                   7, ctx);
+            break;
+        case 8:
+            __fq_nmod_packed_dot(res, vec1, stride1, vec2, stride2, len,
+                                                                   8, ctx);
+            break;
+    }
+}
@@ -0,0 +1,41 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod_packed.h"
+
+void fq_nmod_packed_mat_get_fq_nmod_mat(fq_nmod_mat_t A,
+                     const fq_nmod_packed_mat_t mat, const fq_nmod_ctx_t ctx)
+{
+    const slong d = mat->degree;
+    fq_nmod_struct * x;
+    slong i, j;
+
+    for (i = 0; i < mat->r; i++)
+    {
+        for (j = 0; j < mat->c; j++)
+        {
+            x = fq_nmod_mat_entry(A, i, j);
+            nmod_poly_fit_length(x, d);
+            _nmod_vec_set(x->coeffs, fq_nmod_packed_mat_entry(mat, i, j), d);
+            x->length = d;
+            _nmod_poly_normalise(x);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include "fq_nmod_packed.h"
+
+void fq_nmod_packed_mat_init(fq_nmod_packed_mat_t mat, slong rows,
+                                       slong cols, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    slong i;
+
+    if (d > FQ_NMOD_SMALL_DEGREE)
+    {
+        flint_printf("Exception (fq_nmod_packed_mat_init).  Degree %wd "
+                     "exceeds FQ_NMOD_SMALL_DEGREE.\n", d);
+        abort();
+    }
+
+    if (rows != 0 && cols != 0)
+        mat->entries = flint_calloc(rows * cols * d, sizeof(mp_limb_t));
+    else
+        mat->entries = NULL;
+
+    mat->rows = (rows != 0) ? flint_malloc(rows * sizeof(mp_ptr)) : NULL;
+
+    for (i = 0; i < rows; i++)
+        mat->rows[i] = (cols != 0) ? mat->entries + i * cols * d : NULL;
+
+    mat->r = rows;
+    mat->c = cols;
+    mat->degree = d;
+}
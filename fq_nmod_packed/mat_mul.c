@@ -0,0 +1,71 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod_packed.h"
+
+void fq_nmod_packed_mat_mul(fq_nmod_packed_mat_t C,
+                            const fq_nmod_packed_mat_t A,
+                   const fq_nmod_packed_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    const slong d = A->degree;
+    slong m = A->r, k = A->c, n = B->c, i, j;
+    mp_ptr BT;
+
+    if (m == 0 || n == 0)
+        return;
+
+    if (k == 0)
+    {
+        for (i = 0; i < m; i++)
+            _nmod_vec_zero(C->rows[i], n * d);
+        return;
+    }
+
+    if (C == A || C == B)
+    {
+        fq_nmod_packed_mat_t T;
+        fq_nmod_packed_mat_struct t;
+
+        fq_nmod_packed_mat_init(T, m, n, ctx);
+        fq_nmod_packed_mat_mul(T, A, B, ctx);
+
+        t = *C;
+        *C = *T;
+        *T = t;
+
+        fq_nmod_packed_mat_clear(T, ctx);
+        return;
+    }
+
+    /* Transpose B so that the columns are contiguous */
+    BT = _nmod_vec_init(n * k * d);
+
+    for (i = 0; i < k; i++)
+        for (j = 0; j < n; j++)
+            _nmod_vec_set(BT + (j * k + i) * d,
+                                   fq_nmod_packed_mat_entry(B, i, j), d);
+
+    for (i = 0; i < m; i++)
+        for (j = 0; j < n; j++)
+            _fq_nmod_packed_dot(fq_nmod_packed_mat_entry(C, i, j),
+                                  A->rows[i], d, BT + j * k * d, d, k, ctx);
+
+    _nmod_vec_clear(BT);
+}
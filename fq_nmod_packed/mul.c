@@ -0,0 +1,84 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod_packed.h"
+
+/*
+   The product of two padded elements of degree less than d is formed with
+   one reduction per coefficient, then the top d - 1 coefficients are folded
+   back with the table of x^(d + i) mod f, again reducing once per output
+   coefficient. With d a constant the compiler unrolls both loops.
+*/
+static __inline__ void
+__fq_nmod_packed_mul(mp_ptr rop, mp_srcptr a, mp_srcptr b, const slong d,
+                              mp_srcptr T, nmod_t mod, int nlimbs)
+{
+    mp_limb_t P[2 * FQ_NMOD_SMALL_DEGREE - 1], s;
+    slong i, k, lo;
+
+    for (k = 0; k < 2 * d - 1; k++)
+    {
+        lo = FLINT_MAX(0, k - d + 1);
+        NMOD_VEC_DOT(P[k], i, FLINT_MIN(k, d - 1) - lo + 1,
+                            a[lo + i], b[k - lo - i], mod, nlimbs);
+    }
+
+    for (k = 0; k < d; k++)
+    {
+        NMOD_VEC_DOT(s, i, d - 1, P[d + i], T[k * (d - 1) + i],
+                                                           mod, nlimbs);
+        rop[k] = nmod_add(P[k], s, mod);
+    }
+}
+
+void _fq_nmod_packed_mul(mp_ptr rop, mp_srcptr op1, mp_srcptr op2,
+                                                    const fq_nmod_ctx_t ctx)
+{
+    const mp_limb_t * T = ctx->small_red;
+    const int nlimbs = ctx->small_nlimbs;
+
+    switch (fq_nmod_ctx_degree(ctx))
+    {
+        case 1:
+            rop[0] = nmod_mul(op1[0], op2[0], ctx->mod);
+            break;
+        case 2:
+            __fq_nmod_packed_mul(rop, op1, op2, 2, T, ctx->mod, nlimbs);
+            break;
+        case 3:
+            __fq_nmod_packed_mul(rop, op1, op2, 3, T, ctx->mod, nlimbs);
+            break;
+        case 4:
+            __fq_nmod_packed_mul(rop, op1, op2, 4, T, ctx->mod, nlimbs);
+            break;
+        case 5:
+            __fq_nmod_packed_mul(rop, op1, op2, 5, T, ctx->mod, nlimbs);
+            break;
+        case 6:
+            __fq_nmod_packed_mul(rop, op1, op2, 6, T, ctx->mod, nlimbs);
+            break;
+        case 7:
+            __fq_nmod_packed_mul(rop, op1, op2, 7, T, ctx->mod, nlimbs);
+            break;
+        case 8:
+            __fq_nmod_packed_mul(rop, op1, op2, 8, T, ctx->mod, nlimbs);
+            break;
+    }
+}
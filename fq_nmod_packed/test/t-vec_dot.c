@@ -0,0 +1,97 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fq_nmod_packed.h"
+#include "fq_nmod_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("vec_dot....");
+    fflush(stdout);
+
+    /* Compare with _fq_nmod_vec_dot */
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_struct * a, * b;
+        fq_nmod_packed_vec_t x, y;
+        fq_nmod_t r, s;
+        nmod_poly_t f;
+        slong d, len;
+
+        d = n_randint(state, FQ_NMOD_SMALL_DEGREE) + 1;
+        len = n_randint(state, 50);
+
+        nmod_poly_init(f, n_randtest_prime(state, 0));
+        do {
+            nmod_poly_randtest(f, state, d + 1);
+        } while (nmod_poly_degree(f) != d);
+
+        fq_nmod_ctx_init_modulus(ctx, f, "a");
+
+        a = _fq_nmod_vec_init(len, ctx);
+        b = _fq_nmod_vec_init(len, ctx);
+        fq_nmod_init(r, ctx);
+        fq_nmod_init(s, ctx);
+        fq_nmod_packed_vec_init(x, len, ctx);
+        fq_nmod_packed_vec_init(y, len, ctx);
+
+        _fq_nmod_vec_randtest(a, state, len, ctx);
+        _fq_nmod_vec_randtest(b, state, len, ctx);
+        fq_nmod_packed_vec_set_fq_nmod_vec(x, a, ctx);
+        fq_nmod_packed_vec_set_fq_nmod_vec(y, b, ctx);
+
+        _fq_nmod_vec_dot(r, a, b, len, ctx);
+        fq_nmod_randtest(s, state, ctx);
+        fq_nmod_packed_vec_dot(s, x, y, ctx);
+
+        result = fq_nmod_equal(r, s, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            flint_printf("d = %wd, len = %wd\n", d, len);
+            flint_printf("f = "), nmod_poly_print(f), flint_printf("\n");
+            flint_printf("r = "), fq_nmod_print_pretty(r, ctx);
+            flint_printf("\ns = "), fq_nmod_print_pretty(s, ctx);
+            flint_printf("\n");
+            abort();
+        }
+
+        _fq_nmod_vec_clear(a, len, ctx);
+        _fq_nmod_vec_clear(b, len, ctx);
+        fq_nmod_clear(r, ctx);
+        fq_nmod_clear(s, ctx);
+        fq_nmod_packed_vec_clear(x, ctx);
+        fq_nmod_packed_vec_clear(y, ctx);
+        fq_nmod_ctx_clear(ctx);
+        nmod_poly_clear(f);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
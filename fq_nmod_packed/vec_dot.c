@@ -0,0 +1,33 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod_packed.h"
+
+void fq_nmod_packed_vec_dot(fq_nmod_t res, const fq_nmod_packed_vec_t vec1,
+                 const fq_nmod_packed_vec_t vec2, const fq_nmod_ctx_t ctx)
+{
+    const slong d = vec1->degree;
+
+    nmod_poly_fit_length(res, d);
+    _fq_nmod_packed_dot(res->coeffs, vec1->coeffs, d, vec2->coeffs, d,
+                                                       vec1->length, ctx);
+    res->length = d;
+    _nmod_poly_normalise(res);
+}
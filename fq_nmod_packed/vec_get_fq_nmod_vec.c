@@ -0,0 +1,36 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod_packed.h"
+
+void fq_nmod_packed_vec_get_fq_nmod_vec(fq_nmod_struct * x,
+                     const fq_nmod_packed_vec_t vec, const fq_nmod_ctx_t ctx)
+{
+    const slong d = vec->degree;
+    slong i;
+
+    for (i = 0; i < vec->length; i++)
+    {
+        nmod_poly_fit_length(x + i, d);
+        _nmod_vec_set(x[i].coeffs, fq_nmod_packed_vec_entry(vec, i), d);
+        x[i].length = d;
+        _nmod_poly_normalise(x + i);
+    }
+}
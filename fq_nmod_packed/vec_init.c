@@ -0,0 +1,39 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include "fq_nmod_packed.h"
+
+void fq_nmod_packed_vec_init(fq_nmod_packed_vec_t vec, slong len,
+                                                   const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+
+    if (d > FQ_NMOD_SMALL_DEGREE)
+    {
+        flint_printf("Exception (fq_nmod_packed_vec_init).  Degree %wd "
+                     "exceeds FQ_NMOD_SMALL_DEGREE.\n", d);
+        abort();
+    }
+
+    vec->coeffs = (len != 0) ? flint_calloc(len * d, sizeof(mp_limb_t)) : NULL;
+    vec->length = len;
+    vec->degree = d;
+}
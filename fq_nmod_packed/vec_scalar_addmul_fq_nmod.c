@@ -0,0 +1,44 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod_packed.h"
+
+void fq_nmod_packed_vec_scalar_addmul_fq_nmod(fq_nmod_packed_vec_t res,
+                         const fq_nmod_packed_vec_t vec, const fq_nmod_t c,
+                                                   const fq_nmod_ctx_t ctx)
+{
+    const slong d = vec->degree;
+    mp_limb_t x[FQ_NMOD_SMALL_DEGREE], t[FQ_NMOD_SMALL_DEGREE];
+    mp_ptr r;
+    slong i;
+
+    if (fq_nmod_is_zero(c, ctx))
+        return;
+
+    _nmod_vec_set(x, c->coeffs, c->length);
+    _nmod_vec_zero(x + c->length, d - c->length);
+
+    for (i = 0; i < vec->length; i++)
+    {
+        r = fq_nmod_packed_vec_entry(res, i);
+        _fq_nmod_packed_mul(t, fq_nmod_packed_vec_entry(vec, i), x, ctx);
+        _nmod_vec_add(r, r, t, d, ctx->mod);
+    }
+}
@@ -0,0 +1,29 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "fq_nmod_packed.h"
+
+void fq_nmod_packed_vec_sub(fq_nmod_packed_vec_t res,
+                            const fq_nmod_packed_vec_t vec1,
+                const fq_nmod_packed_vec_t vec2, const fq_nmod_ctx_t ctx)
+{
+    _nmod_vec_sub(res->coeffs, vec1->coeffs, vec2->coeffs,
+                                  vec1->length * vec1->degree, ctx->mod);
+}
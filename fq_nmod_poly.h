@@ -40,13 +40,17 @@
 #define FQ_NMOD_POLY_DIVREM_DIVCONQUER_CUTOFF  16
 #define FQ_NMOD_COMPOSE_MOD_LENH_CUTOFF 6
 #define FQ_NMOD_COMPOSE_MOD_PREINV_LENH_CUTOFF 6
-#define FQ_NMOD_MUL_CLASSICAL_CUTOFF 6
+#define FQ_NMOD_MUL_CLASSICAL_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FQ_NMOD_MUL_CLASSICAL)
 #define FQ_NMOD_SQR_CLASSICAL_CUTOFF 6
 #define FQ_NMOD_MULLOW_CLASSICAL_CUTOFF 6
 
-#define FQ_NMOD_POLY_HGCD_CUTOFF 25
-#define FQ_NMOD_POLY_SMALL_GCD_CUTOFF 110
-#define FQ_NMOD_POLY_GCD_CUTOFF 120
+#define FQ_NMOD_POLY_HGCD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FQ_NMOD_POLY_HGCD)
+#define FQ_NMOD_POLY_SMALL_GCD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FQ_NMOD_POLY_SMALL_GCD)
+#define FQ_NMOD_POLY_GCD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FQ_NMOD_POLY_GCD)
 
 
 #ifdef T
@@ -25,12 +25,71 @@
 
 #include "fq_nmod_poly.h"
 
-#ifdef T
-#undef T
-#endif
-
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_poly_templates/mul_classical.c"
-#undef CAP_T
-#undef T
+void
+_fq_nmod_poly_mul_classical(fq_nmod_struct * rop,
+                            const fq_nmod_struct * op1, slong len1,
+                            const fq_nmod_struct * op2, slong len2,
+                            const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    slong i, k, len;
+    mp_ptr acc;
+    TMP_INIT;
+
+    /* Each output coefficient is a dot product, reduced once */
+    TMP_START;
+    acc = TMP_ALLOC(3 * (2 * d - 1) * sizeof(mp_limb_t));
+
+    for (k = 0; k < len1 + len2 - 1; k++)
+    {
+        flint_mpn_zero(acc, 3 * (2 * d - 1));
+        len = 0;
+
+        for (i = FLINT_MAX(0, k - len2 + 1); i <= FLINT_MIN(k, len1 - 1); i++)
+        {
+            if (op1[i].length != 0 && op2[k - i].length != 0)
+            {
+                _fq_nmod_addmul_lazy(acc, op1[i].coeffs, op1[i].length,
+                                    op2[k - i].coeffs, op2[k - i].length);
+                len = FLINT_MAX(len,
+                                op1[i].length + op2[k - i].length - 1);
+            }
+        }
+
+        _fq_nmod_reduce_lazy(rop + k, acc, len, ctx);
+    }
+
+    TMP_END;
+}
+
+void
+fq_nmod_poly_mul_classical(fq_nmod_poly_t rop, const fq_nmod_poly_t op1,
+                           const fq_nmod_poly_t op2, const fq_nmod_ctx_t ctx)
+{
+    const slong len = op1->length + op2->length - 1;
+
+    if (op1->length == 0 || op2->length == 0)
+    {
+        fq_nmod_poly_zero(rop, ctx);
+        return;
+    }
+
+    if (rop == op1 || rop == op2)
+    {
+        fq_nmod_poly_t t;
+
+        fq_nmod_poly_init2(t, len, ctx);
+        _fq_nmod_poly_mul_classical(t->coeffs, op1->coeffs, op1->length,
+                                    op2->coeffs, op2->length, ctx);
+        fq_nmod_poly_swap(rop, t, ctx);
+        fq_nmod_poly_clear(t, ctx);
+    }
+    else
+    {
+        fq_nmod_poly_fit_length(rop, len, ctx);
+        _fq_nmod_poly_mul_classical(rop->coeffs, op1->coeffs, op1->length,
+                                    op2->coeffs, op2->length, ctx);
+    }
+
+    _fq_nmod_poly_set_length(rop, len, ctx);
+}
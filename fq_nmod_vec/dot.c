@@ -25,12 +25,56 @@
 
 #include "fq_nmod_vec.h"
 
-#ifdef T
-#undef T
-#endif
-
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_vec_templates/dot.c"
-#undef CAP_T
-#undef T
+/*
+   Sums the unreduced products of the entries of vec1 and those of the
+   second vector, given either as vec2 or as vec2ptr[i] + offset, and
+   reduces once at the end
+*/
+static void
+_fq_nmod_vec_dot_lazy(fq_nmod_t res, const fq_nmod_struct * vec1,
+                      const fq_nmod_struct * vec2,
+                      fq_nmod_struct * const * vec2ptr, slong offset,
+                      slong len2, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    slong i, len = 0;
+    const fq_nmod_struct * x;
+    mp_ptr acc;
+    TMP_INIT;
+
+    TMP_START;
+    acc = TMP_ALLOC(3 * (2 * d - 1) * sizeof(mp_limb_t));
+    flint_mpn_zero(acc, 3 * (2 * d - 1));
+
+    for (i = 0; i < len2; i++)
+    {
+        x = (vec2 != NULL) ? vec2 + i : vec2ptr[i] + offset;
+
+        if (vec1[i].length != 0 && x->length != 0)
+        {
+            _fq_nmod_addmul_lazy(acc, vec1[i].coeffs, vec1[i].length,
+                                                    x->coeffs, x->length);
+            len = FLINT_MAX(len, vec1[i].length + x->length - 1);
+        }
+    }
+
+    _fq_nmod_reduce_lazy(res, acc, len, ctx);
+
+    TMP_END;
+}
+
+void
+_fq_nmod_vec_dot(fq_nmod_t res, const fq_nmod_struct * vec1,
+                 const fq_nmod_struct * vec2, slong len2,
+                 const fq_nmod_ctx_t ctx)
+{
+    _fq_nmod_vec_dot_lazy(res, vec1, vec2, NULL, 0, len2, ctx);
+}
+
+void
+_fq_nmod_vec_dot_ptr(fq_nmod_t res, const fq_nmod_struct * vec1,
+                     fq_nmod_struct * const * vec2, slong offset,
+                     slong len2, const fq_nmod_ctx_t ctx)
+{
+    _fq_nmod_vec_dot_lazy(res, vec1, NULL, vec2, offset, len2, ctx);
+}
@@ -40,13 +40,17 @@
 #define FQ_POLY_DIVREM_DIVCONQUER_CUTOFF  16
 #define FQ_COMPOSE_MOD_LENH_CUTOFF 6
 #define FQ_COMPOSE_MOD_PREINV_LENH_CUTOFF 6
-#define FQ_MUL_CLASSICAL_CUTOFF 6
+#define FQ_MUL_CLASSICAL_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FQ_MUL_CLASSICAL)
 #define FQ_MULLOW_CLASSICAL_CUTOFF 6
 #define FQ_SQR_CLASSICAL_CUTOFF 6
 
-#define FQ_POLY_HGCD_CUTOFF 30
-#define FQ_POLY_SMALL_GCD_CUTOFF 80
-#define FQ_POLY_GCD_CUTOFF 90
+#define FQ_POLY_HGCD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FQ_POLY_HGCD)
+#define FQ_POLY_SMALL_GCD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FQ_POLY_SMALL_GCD)
+#define FQ_POLY_GCD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FQ_POLY_GCD)
 
 #ifdef T
 #undef T
@@ -25,12 +25,72 @@
 
 #include "fq_vec.h"
 
-#ifdef T
-#undef T
-#endif
-
-#define T fq
-#define CAP_T FQ
-#include "fq_vec_templates/dot.c"
-#undef CAP_T
-#undef T
+/*
+   Sums the products over Z of the entries of vec1 and those of the second
+   vector, given either as vec2 or as vec2ptr[i] + offset, and reduces
+   once at the end. The scratch space is on the stack, as the function
+   is called once per entry by matrix multiplication.
+*/
+static void
+_fq_vec_dot_lazy(fq_t res, const fq_struct * vec1, const fq_struct * vec2,
+                 fq_struct * const * vec2ptr, slong offset,
+                 slong len2, const fq_ctx_t ctx)
+{
+    const slong d = fq_ctx_degree(ctx);
+    slong i, len = 0;
+    const fq_struct * x;
+    fmpz * acc, * t;
+    TMP_INIT;
+
+    TMP_START;
+    acc = TMP_ALLOC(2 * (2 * d - 1) * sizeof(fmpz));
+    t = acc + 2 * d - 1;
+    for (i = 0; i < 2 * (2 * d - 1); i++)
+        fmpz_init(acc + i);
+
+    for (i = 0; i < len2; i++)
+    {
+        x = (vec2 != NULL) ? vec2 + i : vec2ptr[i] + offset;
+
+        if (vec1[i].length != 0 && x->length != 0)
+        {
+            if (vec1[i].length >= x->length)
+                _fmpz_poly_mul(t, vec1[i].coeffs, vec1[i].length,
+                                                    x->coeffs, x->length);
+            else
+                _fmpz_poly_mul(t, x->coeffs, x->length,
+                                          vec1[i].coeffs, vec1[i].length);
+
+            _fmpz_vec_add(acc, acc, t, vec1[i].length + x->length - 1);
+            len = FLINT_MAX(len, vec1[i].length + x->length - 1);
+        }
+    }
+
+    _fmpz_vec_scalar_mod_fmpz(acc, acc, len, fq_ctx_prime(ctx));
+    _fq_reduce(acc, len, ctx);
+
+    len = FLINT_MIN(len, d);
+    fmpz_poly_fit_length(res, len);
+    _fmpz_vec_set(res->coeffs, acc, len);
+    _fmpz_poly_set_length(res, len);
+    _fmpz_poly_normalise(res);
+
+    for (i = 0; i < 2 * (2 * d - 1); i++)
+        fmpz_clear(acc + i);
+    TMP_END;
+}
+
+void
+_fq_vec_dot(fq_t res, const fq_struct * vec1, const fq_struct * vec2,
+                                            slong len2, const fq_ctx_t ctx)
+{
+    _fq_vec_dot_lazy(res, vec1, vec2, NULL, 0, len2, ctx);
+}
+
+void
+_fq_vec_dot_ptr(fq_t res, const fq_struct * vec1,
+                fq_struct * const * vec2, slong offset,
+                slong len2, const fq_ctx_t ctx)
+{
+    _fq_vec_dot_lazy(res, vec1, NULL, vec2, offset, len2, ctx);
+}
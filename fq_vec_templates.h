@@ -129,6 +129,12 @@ FLINT_DLL void _TEMPLATE(T, vec_dot)(TEMPLATE(T, t) res,
                       slong len2,
                       const TEMPLATE(T, ctx_t) ctx);
 
+FLINT_DLL void _TEMPLATE(T, vec_dot_ptr)(TEMPLATE(T, t) res,
+                      const TEMPLATE(T, struct) * vec1,
+                      TEMPLATE(T, struct) * const * vec2, slong offset,
+                      slong len2,
+                      const TEMPLATE(T, ctx_t) ctx);
+
 #ifdef __cplusplus
  }
 #endif
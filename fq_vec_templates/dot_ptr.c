@@ -0,0 +1,46 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#ifdef T
+
+#include "templates.h"
+
+void
+_TEMPLATE(T, vec_dot_ptr) (TEMPLATE(T, t) res,
+                           const TEMPLATE(T, struct) * vec1,
+                           TEMPLATE(T, struct) * const * vec2, slong offset,
+                           slong len2, const TEMPLATE(T, ctx_t) ctx)
+{
+    slong i;
+    TEMPLATE(T, t) x;
+    TEMPLATE(T, init) (x, ctx);
+
+    TEMPLATE(T, zero) (res, ctx);
+
+    for (i = 0; i < len2; i++)
+    {
+        TEMPLATE(T, mul) (x, vec1 + i, vec2[i] + offset, ctx);
+        TEMPLATE(T, add) (res, res, x, ctx);
+    }
+
+    TEMPLATE(T, clear) (x, ctx);
+}
+
+#endif
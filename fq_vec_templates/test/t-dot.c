@@ -0,0 +1,98 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#ifdef T
+
+#include "templates.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    printf("dot....");
+    fflush(stdout);
+
+    /* Compare with products and sums, and dot with dot_ptr */
+    for (i = 0; i < 500; i++)
+    {
+        TEMPLATE(T, ctx_t) ctx;
+
+        TEMPLATE(T, struct) * a, * b, ** p;
+        TEMPLATE(T, t) x, y, z;
+        slong j, len = n_randint(state, 50), offset = n_randint(state, 3);
+
+        TEMPLATE(T, ctx_randtest) (ctx, state);
+
+        a = _TEMPLATE(T, vec_init) (len, ctx);
+        b = _TEMPLATE(T, vec_init) (len + offset, ctx);
+        p = flint_malloc((len + 1) * sizeof(TEMPLATE(T, struct) *));
+        _TEMPLATE(T, vec_randtest) (a, state, len, ctx);
+        _TEMPLATE(T, vec_randtest) (b, state, len + offset, ctx);
+
+        TEMPLATE(T, init) (x, ctx);
+        TEMPLATE(T, init) (y, ctx);
+        TEMPLATE(T, init) (z, ctx);
+
+        for (j = 0; j < len; j++)
+        {
+            TEMPLATE(T, mul) (z, a + j, b + j + offset, ctx);
+            TEMPLATE(T, add) (x, x, z, ctx);
+            p[j] = b + j;
+        }
+
+        _TEMPLATE(T, vec_dot) (y, a, b + offset, len, ctx);
+        _TEMPLATE(T, vec_dot_ptr) (z, a, p, offset, len, ctx);
+
+        result = (TEMPLATE(T, equal) (x, y, ctx)
+               && TEMPLATE(T, equal) (x, z, ctx));
+        if (!result)
+        {
+            printf("FAIL:\n");
+            _TEMPLATE(T, vec_print) (a, len, ctx), printf("\n\n");
+            _TEMPLATE(T, vec_print) (b, len + offset, ctx), printf("\n\n");
+            TEMPLATE(T, print_pretty) (x, ctx), printf("\n\n");
+            TEMPLATE(T, print_pretty) (y, ctx), printf("\n\n");
+            TEMPLATE(T, print_pretty) (z, ctx), printf("\n\n");
+            abort();
+        }
+
+        TEMPLATE(T, clear) (x, ctx);
+        TEMPLATE(T, clear) (y, ctx);
+        TEMPLATE(T, clear) (z, ctx);
+
+        _TEMPLATE(T, vec_clear) (a, len, ctx);
+        _TEMPLATE(T, vec_clear) (b, len + offset, ctx);
+        flint_free(p);
+
+        TEMPLATE(T, ctx_clear) (ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    printf("PASS\n");
+    return 0;
+}
+
+#endif
@@ -39,12 +39,16 @@
 #define FQ_ZECH_COMPOSE_MOD_LENH_CUTOFF 6
 #define FQ_ZECH_COMPOSE_MOD_PREINV_LENH_CUTOFF 6
 #define FQ_ZECH_SQR_CLASSICAL_CUTOFF 100
-#define FQ_ZECH_MUL_CLASSICAL_CUTOFF 90
+#define FQ_ZECH_MUL_CLASSICAL_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FQ_ZECH_MUL_CLASSICAL)
 #define FQ_ZECH_MULLOW_CLASSICAL_CUTOFF 90
 
-#define FQ_ZECH_POLY_HGCD_CUTOFF 35
-#define FQ_ZECH_POLY_GCD_CUTOFF 96
-#define FQ_ZECH_POLY_SMALL_GCD_CUTOFF 96
+#define FQ_ZECH_POLY_HGCD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FQ_ZECH_POLY_HGCD)
+#define FQ_ZECH_POLY_GCD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FQ_ZECH_POLY_GCD)
+#define FQ_ZECH_POLY_SMALL_GCD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_FQ_ZECH_POLY_SMALL_GCD)
 
 #ifdef T
 #undef T
@@ -130,10 +130,18 @@ FLINT_DLL void nmod_mat_scalar_mul(nmod_mat_t B, const nmod_mat_t A, mp_limb_t c
 FLINT_DLL void nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
 FLINT_DLL void nmod_mat_mul_classical(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
 FLINT_DLL void nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
+FLINT_DLL void nmod_mat_mul_threaded(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
+
+FLINT_DLL void _nmod_mat_mul_threaded(nmod_mat_t D, const nmod_mat_t C,
+                                const nmod_mat_t A, const nmod_mat_t B, int op);
 
 FLINT_DLL void _nmod_mat_mul_classical(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B, int op);
 
+FLINT_DLL void _nmod_mat_addmul_double(mp_ptr * D, const mp_ptr * C,
+                     const mp_ptr * A, const mp_ptr * B, slong M, slong N,
+                                                 slong K, int op, nmod_t mod);
+
 FLINT_DLL void nmod_mat_addmul(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B);
 
@@ -203,7 +211,17 @@ FLINT_DLL slong nmod_mat_nullspace(nmod_mat_t X, const nmod_mat_t A);
 #define NMOD_MAT_MUL_TRANSPOSE_CUTOFF 20
 
 /* Strassen multiplication */
-#define NMOD_MAT_MUL_STRASSEN_CUTOFF 256
+#define NMOD_MAT_MUL_STRASSEN_CUTOFF \
+    flint_tune_get(FLINT_TUNE_NMOD_MAT_MUL_STRASSEN)
+
+/* Smallest dimension at which multiplication is split over threads */
+#define NMOD_MAT_MUL_THREADED_CUTOFF 64
+
+/* Largest modulus bits for which classical multiplication can use doubles */
+#define NMOD_MAT_MUL_DOUBLE_BITS 26
+
+/* Smallest dimension at which the double precision kernel is used */
+#define NMOD_MAT_MUL_DOUBLE_CUTOFF 16
 
 /* Cutoff between classical and recursive triangular solving */
 #define NMOD_MAT_SOLVE_TRI_ROWS_CUTOFF 64
@@ -39,7 +39,14 @@ nmod_mat_addmul(nmod_mat_t D, const nmod_mat_t C,
     k = A->c;
     n = B->c;
 
-    if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
+    if (flint_get_num_threads() > 1 &&
+        m >= NMOD_MAT_MUL_THREADED_CUTOFF &&
+        n >= NMOD_MAT_MUL_THREADED_CUTOFF &&
+        k >= NMOD_MAT_MUL_THREADED_CUTOFF)
+    {
+        _nmod_mat_mul_threaded(D, C, A, B, 1);
+    }
+    else if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
         n < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
         k < NMOD_MAT_MUL_STRASSEN_CUTOFF)
     {
@@ -0,0 +1,245 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_vec.h"
+
+#if HAVE_BLAS
+#include <cblas.h>
+#endif
+
+/* Rows of A and columns of B handled by one pass of the inner kernel */
+#define NMOD_MAT_DOUBLE_ROWS 4
+#define NMOD_MAT_DOUBLE_COLS 8
+
+/* Largest number of terms accumulated between reductions, for locality */
+#define NMOD_MAT_DOUBLE_BLOCK_TERMS 256
+
+/*
+   Reduces the len entries of the double array x, which are integers
+   below 2^53 in absolute value, modulo the modulus p.
+*/
+static void
+_nmod_mat_double_reduce(double * x, slong len, double p, double pinv)
+{
+    slong i;
+    double q, r;
+
+    for (i = 0; i < len; i++)
+    {
+        q = floor(x[i] * pinv);
+        r = x[i] - q * p;
+        if (r < 0)
+            r += p;
+        else if (r >= p)
+            r -= p;
+        x[i] = r;
+    }
+}
+
+/* Converts a reduced residue to the symmetric range (-p/2, p/2] */
+#define DOUBLE_SYMMETRIC(a, mod)                                  \
+    ((a) > (mod).n / 2 ? -(double) ((mod).n - (a)) : (double) (a))
+
+#if !HAVE_BLAS
+
+#define DOUBLE_ROW_ADDMUL(c, x)                                   \
+    c[0] += x * b[0]; c[1] += x * b[1];                           \
+    c[2] += x * b[2]; c[3] += x * b[3];                           \
+    c[4] += x * b[4]; c[5] += x * b[5];                           \
+    c[6] += x * b[6]; c[7] += x * b[7];
+
+/*
+   Adds to the 4 x 8 block of D with rows of length K the product of the
+   4 x klen block of A with rows of length N and the packed klen x 8
+   panel b. The sums are kept in registers, the compiler being free to
+   use vector instructions for the rows of the block.
+*/
+static void
+_nmod_mat_double_kernel(double * D, slong K, const double * A, slong N,
+                                                const double * b, slong klen)
+{
+    double c0[8] = {0}, c1[8] = {0}, c2[8] = {0}, c3[8] = {0};
+    double x0, x1, x2, x3;
+    slong l;
+
+    for (l = 0; l < klen; l++, b += NMOD_MAT_DOUBLE_COLS)
+    {
+        x0 = A[l];
+        x1 = A[N + l];
+        x2 = A[2 * N + l];
+        x3 = A[3 * N + l];
+
+        DOUBLE_ROW_ADDMUL(c0, x0)
+        DOUBLE_ROW_ADDMUL(c1, x1)
+        DOUBLE_ROW_ADDMUL(c2, x2)
+        DOUBLE_ROW_ADDMUL(c3, x3)
+    }
+
+    for (l = 0; l < NMOD_MAT_DOUBLE_COLS; l++)
+    {
+        D[l] += c0[l];
+        D[K + l] += c1[l];
+        D[2 * K + l] += c2[l];
+        D[3 * K + l] += c3[l];
+    }
+}
+
+#endif
+
+/*
+   Converts B to symmetric doubles in Bd, with the number of columns K padded with
+   zeros to a multiple of NMOD_MAT_DOUBLE_COLS. Without BLAS, Bd is stored
+   as consecutive N x NMOD_MAT_DOUBLE_COLS panels, each by rows.
+*/
+static void
+_nmod_mat_double_pack(double * Bd, const mp_ptr * B, slong N, slong K,
+                                                     slong Kpad, nmod_t mod)
+{
+    slong j, l;
+
+    for (l = 0; l < N; l++)
+    {
+        for (j = 0; j < Kpad; j++)
+        {
+#if HAVE_BLAS
+            Bd[l * Kpad + j] = (j < K) ? DOUBLE_SYMMETRIC(B[l][j], mod) : 0.0;
+#else
+            Bd[(j - j % NMOD_MAT_DOUBLE_COLS) * N
+                + l * NMOD_MAT_DOUBLE_COLS + j % NMOD_MAT_DOUBLE_COLS]
+                = (j < K) ? DOUBLE_SYMMETRIC(B[l][j], mod) : 0.0;
+#endif
+        }
+    }
+}
+
+/*
+   Adds to the Mpad x Kpad matrix Dd the product of columns kk to
+   kk + klen - 1 of the Mpad x N matrix Ad and rows kk to kk + klen - 1
+   of the N x Kpad matrix Bd, stored as by _nmod_mat_double_pack.
+*/
+static void
+_nmod_mat_double_addmul_block(double * Dd, const double * Ad,
+                 const double * Bd, slong Mpad, slong N, slong Kpad,
+                 slong kk, slong klen)
+{
+#if HAVE_BLAS
+    /* Partial sums are bounded by the sum of the absolute values of the
+       terms, so the result is exact whatever the order of summation */
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, Mpad, Kpad, klen,
+                1.0, Ad + kk, N, Bd + kk * Kpad, Kpad, 1.0, Dd, Kpad);
+#else
+    slong i, j;
+
+    for (i = 0; i < Mpad; i += NMOD_MAT_DOUBLE_ROWS)
+        for (j = 0; j < Kpad; j += NMOD_MAT_DOUBLE_COLS)
+            _nmod_mat_double_kernel(Dd + i * Kpad + j, Kpad,
+                Ad + i * N + kk, N,
+                Bd + j * N + kk * NMOD_MAT_DOUBLE_COLS, klen);
+#endif
+}
+
+/*
+   Classical multiplication in double precision for moduli of at most
+   NMOD_MAT_MUL_DOUBLE_BITS bits, with the same conventions as the other
+   kernels of _nmod_mat_mul_classical (M x N times N x K, and op = 0, 1, -1
+   for D = A*B, D = C + A*B, D = C - A*B).
+
+   Entries are converted to the symmetric range (-p/2, p/2], so that
+   products are bounded by p^2/4 and a block of terms can be summed
+   exactly in double precision as long as the sum stays below 2^53 in
+   absolute value. The sums are reduced only once per such block.
+*/
+void
+_nmod_mat_addmul_double(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
+    const mp_ptr * B, slong M, slong N, slong K, int op, nmod_t mod)
+{
+    slong i, j, l, kk, klen, block, max_terms, terms, Mpad, Kpad;
+    double * Ad, * Bd, * Dd;
+    double p, pinv, t;
+    mp_limb_t c;
+
+    p = (double) mod.n;
+    pinv = 1.0 / p;
+
+    /* Number of products which can be added to a reduced entry */
+    t = (double) (mod.n / 2);
+    t = (t == 0) ? N : (9007199254740992.0 - p) / (t * t);
+    max_terms = (t >= N) ? N : (slong) t;
+    block = FLINT_MIN(max_terms, NMOD_MAT_DOUBLE_BLOCK_TERMS);
+
+    /* Pad to whole blocks of the inner kernel */
+    Mpad = ((M + NMOD_MAT_DOUBLE_ROWS - 1) / NMOD_MAT_DOUBLE_ROWS)
+                                                * NMOD_MAT_DOUBLE_ROWS;
+    Kpad = ((K + NMOD_MAT_DOUBLE_COLS - 1) / NMOD_MAT_DOUBLE_COLS)
+                                                * NMOD_MAT_DOUBLE_COLS;
+
+    Ad = flint_calloc(Mpad * N, sizeof(double));
+    Bd = flint_malloc(sizeof(double) * N * Kpad);
+    Dd = flint_calloc(Mpad * Kpad, sizeof(double));
+
+    for (i = 0; i < M; i++)
+        for (l = 0; l < N; l++)
+            Ad[i * N + l] = DOUBLE_SYMMETRIC(A[i][l], mod);
+
+    _nmod_mat_double_pack(Bd, B, N, K, Kpad, mod);
+
+    terms = 0;
+
+    for (kk = 0; kk < N; kk += klen)
+    {
+        klen = FLINT_MIN(block, N - kk);
+
+        _nmod_mat_double_addmul_block(Dd, Ad, Bd, Mpad, N, Kpad, kk, klen);
+
+        terms += klen;
+
+        /* Reduce when another block could overflow, and at the end */
+        if (kk + klen == N ||
+            terms + FLINT_MIN(block, N - kk - klen) > max_terms)
+        {
+            _nmod_mat_double_reduce(Dd, Mpad * Kpad, p, pinv);
+            terms = 0;
+        }
+    }
+
+    for (i = 0; i < M; i++)
+    {
+        for (j = 0; j < K; j++)
+        {
+            c = (mp_limb_t) Dd[i * Kpad + j];
+
+            if (op == 1)
+                c = nmod_add(C[i][j], c, mod);
+            else if (op == -1)
+                c = nmod_sub(C[i][j], c, mod);
+
+            D[i][j] = c;
+        }
+    }
+
+    flint_free(Ad);
+    flint_free(Bd);
+    flint_free(Dd);
+}
@@ -38,14 +38,27 @@ nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
     k = A->c;
     n = B->c;
 
-    if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
+    if (flint_get_num_threads() > 1 &&
+        m >= NMOD_MAT_MUL_THREADED_CUTOFF &&
+        n >= NMOD_MAT_MUL_THREADED_CUTOFF &&
+        k >= NMOD_MAT_MUL_THREADED_CUTOFF)
+    {
+        FLINT_STATS_CALL(FLINT_STATS_NMOD_MAT_MUL_THREADED,
+            FLINT_MIN(FLINT_MIN(m, n), k), FLINT_BIT_COUNT(C->mod.n),
+            _nmod_mat_mul_threaded(C, NULL, A, B, 0));
+    }
+    else if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
         n < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
         k < NMOD_MAT_MUL_STRASSEN_CUTOFF)
     {
-        nmod_mat_mul_classical(C, A, B);
+        FLINT_STATS_CALL(FLINT_STATS_NMOD_MAT_MUL_CLASSICAL,
+            FLINT_MIN(FLINT_MIN(m, n), k), FLINT_BIT_COUNT(C->mod.n),
+            nmod_mat_mul_classical(C, A, B));
     }
     else
     {
-        nmod_mat_mul_strassen(C, A, B);
+        FLINT_STATS_CALL(FLINT_STATS_NMOD_MAT_MUL_STRASSEN,
+            FLINT_MIN(FLINT_MIN(m, n), k), FLINT_BIT_COUNT(C->mod.n),
+            nmod_mat_mul_strassen(C, A, B));
     }
 }
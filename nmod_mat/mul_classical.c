@@ -177,7 +177,7 @@ _nmod_mat_mul_classical(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B, int op)
 {
     slong m, k, n;
-    int nlimbs;
+    int nlimbs, pack2;
     nmod_t mod;
 
     mod = A->mod;
@@ -196,7 +196,19 @@ _nmod_mat_mul_classical(nmod_mat_t D, const nmod_mat_t C,
 
     nlimbs = _nmod_vec_dot_bound_limbs(k, mod);
 
-    if (nlimbs == 1 && m > 10 && k > 10 && n > 10)
+    /* whether the packed kernel fits at least two entries per limb */
+    pack2 = (nlimbs == 1 && FLINT_BIT_COUNT(k * (mod.n - 1) * (mod.n - 1))
+                                                        <= FLINT_BITS / 2);
+
+    if (!pack2 && FLINT_BIT_COUNT(mod.n) <= NMOD_MAT_MUL_DOUBLE_BITS
+        && m >= NMOD_MAT_MUL_DOUBLE_CUTOFF
+        && k >= NMOD_MAT_MUL_DOUBLE_CUTOFF
+        && n >= NMOD_MAT_MUL_DOUBLE_CUTOFF)
+    {
+        _nmod_mat_addmul_double(D->rows, (op == 0) ? NULL : C->rows,
+            A->rows, B->rows, m, k, n, op, D->mod);
+    }
+    else if (nlimbs == 1 && m > 10 && k > 10 && n > 10)
     {
         _nmod_mat_addmul_packed(D->rows, (op == 0) ? NULL : C->rows,
             A->rows, B->rows, m, k, n, op, D->mod, nlimbs);
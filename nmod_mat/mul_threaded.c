@@ -0,0 +1,166 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "thread_pool.h"
+#include "nmod_mat.h"
+#include "nmod_vec.h"
+
+typedef struct
+{
+    nmod_mat_struct * D;
+    nmod_mat_struct * C;
+    nmod_mat_struct * A;
+    nmod_mat_struct * B;
+    int op;
+} nmod_mat_mul_block_arg_t;
+
+static void
+_nmod_mat_mul_block(nmod_mat_mul_block_arg_t * arg)
+{
+    if (arg->op == 0)
+        nmod_mat_mul(arg->D, arg->A, arg->B);
+    else if (arg->op == 1)
+        nmod_mat_addmul(arg->D, arg->C, arg->A, arg->B);
+    else
+        nmod_mat_submul(arg->D, arg->C, arg->A, arg->B);
+}
+
+/* Workers are woken with no threads of their own, so compute serially */
+static void
+_nmod_mat_mul_block_worker(void * arg_ptr)
+{
+    _nmod_mat_mul_block((nmod_mat_mul_block_arg_t *) arg_ptr);
+}
+
+void
+_nmod_mat_mul_threaded(nmod_mat_t D, const nmod_mat_t C,
+                                const nmod_mat_t A, const nmod_mat_t B, int op)
+{
+    slong m, k, n, i, j, p, q, t, num_threads, num_workers = 0;
+    int max_threads = flint_get_num_threads();
+    nmod_mat_struct * win;
+    nmod_mat_mul_block_arg_t * args;
+    thread_pool_handle * threads = NULL;
+
+    m = A->r;
+    k = A->c;
+    n = B->c;
+
+    if (m != 0 && n != 0 && k != 0)
+        num_workers = flint_request_threads(&threads, max_threads);
+
+    num_threads = num_workers + 1;
+
+    if (num_threads <= 1)
+    {
+        nmod_mat_mul_block_arg_t arg;
+
+        flint_give_back_threads(threads, num_workers);
+
+        arg.D = (nmod_mat_struct *) D;
+        arg.C = (nmod_mat_struct *) C;
+        arg.A = (nmod_mat_struct *) A;
+        arg.B = (nmod_mat_struct *) B;
+        arg.op = op;
+
+        /* Do not come back here if no thread of the pool is free */
+        _flint_set_num_workers(0);
+        _nmod_mat_mul_block(&arg);
+        _flint_set_num_workers(max_threads - 1);
+        return;
+    }
+
+    /* Split D into a p x q grid of blocks, one per thread */
+    q = n_sqrt(num_threads);
+    while (num_threads % q != 0)
+        q--;
+    p = num_threads / q;
+
+    if (m < n)
+    {
+        t = p;
+        p = q;
+        q = t;
+    }
+
+    p = FLINT_MIN(p, m);
+    q = FLINT_MIN(q, n);
+    t = p * q;
+
+    win = flint_malloc(sizeof(nmod_mat_struct) * 4 * t);
+    args = flint_malloc(sizeof(nmod_mat_mul_block_arg_t) * t);
+
+    for (i = 0; i < p; i++)
+    {
+        slong r1 = (i * m) / p, r2 = ((i + 1) * m) / p;
+
+        for (j = 0; j < q; j++)
+        {
+            slong c1 = (j * n) / q, c2 = ((j + 1) * n) / q;
+            nmod_mat_mul_block_arg_t * arg = args + i * q + j;
+
+            arg->D = win + 4 * (i * q + j);
+            arg->C = arg->D + 1;
+            arg->A = arg->D + 2;
+            arg->B = arg->D + 3;
+            arg->op = op;
+
+            nmod_mat_window_init(arg->D, D, r1, c1, r2, c2);
+            if (op != 0)
+                nmod_mat_window_init(arg->C, C, r1, c1, r2, c2);
+            nmod_mat_window_init(arg->A, A, r1, 0, r2, k);
+            nmod_mat_window_init(arg->B, B, 0, c1, k, c2);
+        }
+    }
+
+    for (i = 1; i < t; i++)
+        thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                                        _nmod_mat_mul_block_worker, &args[i]);
+
+    /* Compute the first block in this thread, without nested threads */
+    _flint_set_num_workers(0);
+    _nmod_mat_mul_block(&args[0]);
+    _flint_set_num_workers(max_threads - 1);
+
+    for (i = 1; i < t; i++)
+        thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+    flint_give_back_threads(threads, num_workers);
+
+    for (i = 0; i < t; i++)
+    {
+        nmod_mat_window_clear(args[i].D);
+        if (op != 0)
+            nmod_mat_window_clear(args[i].C);
+        nmod_mat_window_clear(args[i].A);
+        nmod_mat_window_clear(args[i].B);
+    }
+
+    flint_free(win);
+    flint_free(args);
+}
+
+void
+nmod_mat_mul_threaded(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
+{
+    _nmod_mat_mul_threaded(C, NULL, A, B, 0);
+}
@@ -0,0 +1,125 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i, r, c;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("addmul_double....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B, C, D, E;
+        fmpz_mat_t AA, BB, CC;
+        mp_limb_t mod;
+        slong m, k, n;
+        int op;
+
+        m = n_randint(state, 50);
+        k = n_randint(state, 50);
+        n = n_randint(state, 50);
+
+        if (n_randint(state, 10) == 0)
+            k = n_randint(state, 500);
+
+        mod = n_randtest_bits(state,
+                              n_randint(state, NMOD_MAT_MUL_DOUBLE_BITS) + 1);
+        op = n_randint(state, 3) - 1;
+
+        nmod_mat_init(A, m, k, mod);
+        nmod_mat_init(B, k, n, mod);
+        nmod_mat_init(C, m, n, mod);
+        nmod_mat_init(D, m, n, mod);
+        nmod_mat_init(E, m, n, mod);
+
+        if (n_randint(state, 4) == 0)
+        {
+            /* entries of largest absolute value in the symmetric range */
+            for (r = 0; r < m; r++)
+                for (c = 0; c < k; c++)
+                    A->rows[r][c] = mod / 2;
+            for (r = 0; r < k; r++)
+                for (c = 0; c < n; c++)
+                    B->rows[r][c] = mod / 2;
+        }
+        else
+        {
+            nmod_mat_randtest(A, state);
+            nmod_mat_randtest(B, state);
+        }
+
+        nmod_mat_randtest(C, state);
+
+        _nmod_mat_addmul_double(D->rows, (op == 0) ? NULL : C->rows,
+            A->rows, B->rows, m, k, n, op, D->mod);
+
+        /* reference product over the integers */
+        fmpz_mat_init(AA, m, k);
+        fmpz_mat_init(BB, k, n);
+        fmpz_mat_init(CC, m, n);
+
+        fmpz_mat_set_nmod_mat_unsigned(AA, A);
+        fmpz_mat_set_nmod_mat_unsigned(BB, B);
+        fmpz_mat_mul_classical(CC, AA, BB);
+        fmpz_mat_get_nmod_mat(E, CC);
+
+        if (op == 1)
+            nmod_mat_add(E, C, E);
+        else if (op == -1)
+            nmod_mat_sub(E, C, E);
+
+        if (!nmod_mat_equal(D, E))
+        {
+            flint_printf("FAIL: results not equal (op = %d)\n", op);
+            flint_printf("mod = %wu\n", mod);
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(B);
+            nmod_mat_print_pretty(D);
+            nmod_mat_print_pretty(E);
+            abort();
+        }
+
+        fmpz_mat_clear(AA);
+        fmpz_mat_clear(BB);
+        fmpz_mat_clear(CC);
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(D);
+        nmod_mat_clear(E);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i, j;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_threaded....");
+    fflush(stdout);
+
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B, C, D, E;
+        mp_limb_t mod;
+        slong m, k, n, rank1, rank2, * P1, * P2;
+        int op;
+
+        m = n_randint(state, 150);
+        k = n_randint(state, 150);
+        n = n_randint(state, 150);
+
+        mod = n_randtest_prime(state, 0);
+        op = n_randint(state, 3) - 1;
+
+        nmod_mat_init(A, m, k, mod);
+        nmod_mat_init(B, k, n, mod);
+        nmod_mat_init(C, m, n, mod);
+        nmod_mat_init(D, m, n, mod);
+        nmod_mat_init(E, m, n, mod);
+
+        nmod_mat_randtest(A, state);
+        nmod_mat_randtest(B, state);
+        nmod_mat_randtest(C, state);
+        nmod_mat_randtest(D, state);
+
+        if (op == 0)
+            nmod_mat_mul_classical(E, A, B);
+        else
+            _nmod_mat_mul_classical(E, C, A, B, op);
+
+        flint_set_num_threads(n_randint(state, 5) + 1);
+        _nmod_mat_mul_threaded(D, C, A, B, op);
+
+        if (!nmod_mat_equal(D, E))
+        {
+            flint_printf("FAIL: results not equal (op = %d)\n", op);
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(B);
+            nmod_mat_print_pretty(D);
+            nmod_mat_print_pretty(E);
+            abort();
+        }
+
+        /* LU decomposition must agree with the serial version */
+        nmod_mat_clear(D);
+        nmod_mat_clear(E);
+        nmod_mat_init(D, m, k, mod);
+        nmod_mat_init(E, m, k, mod);
+        nmod_mat_randrank(D, state, n_randint(state, FLINT_MIN(m, k) + 1));
+        if (n_randint(state, 2))
+            nmod_mat_randops(D, n_randint(state, 1 + m * m), state);
+        nmod_mat_set(E, D);
+
+        P1 = flint_malloc(sizeof(slong) * m);
+        P2 = flint_malloc(sizeof(slong) * m);
+
+        rank1 = nmod_mat_lu(P1, D, 0);
+        flint_set_num_threads(1);
+        rank2 = nmod_mat_lu(P2, E, 0);
+
+        if (rank1 != rank2 || !nmod_mat_equal(D, E))
+        {
+            flint_printf("FAIL: LU decompositions not equal\n");
+            abort();
+        }
+
+        for (j = 0; j < m; j++)
+        {
+            if (P1[j] != P2[j])
+            {
+                flint_printf("FAIL: permutations not equal\n");
+                abort();
+            }
+        }
+
+        flint_free(P1);
+        flint_free(P2);
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(D);
+        nmod_mat_clear(E);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
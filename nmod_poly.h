@@ -50,9 +50,23 @@
 #define NMOD_DIVREM_DIVCONQUER_CUTOFF  300
 #define NMOD_DIV_DIVCONQUER_CUTOFF     300 /* Must be <= NMOD_DIVREM_DIVCONQUER_CUTOFF */
 
-#define NMOD_POLY_HGCD_CUTOFF  100      /* HGCD: Basecase -> Recursion      */
-#define NMOD_POLY_GCD_CUTOFF  340       /* GCD:  Euclidean -> HGCD          */
-#define NMOD_POLY_SMALL_GCD_CUTOFF 200  /* GCD (small n): Euclidean -> HGCD */
+/* Multiplication: Kronecker substitution -> NTT, for full word moduli */
+#define NMOD_POLY_MUL_NTT_CUTOFF \
+    flint_tune_get(FLINT_TUNE_NMOD_POLY_MUL_NTT)
+/* Kronecker substitution packs small moduli well, so they switch later */
+#define NMOD_POLY_MUL_USE_NTT(len2, bits) \
+    ((len2) >= (NMOD_POLY_MUL_NTT_CUTOFF \
+                      << (2 * (bits) <= FLINT_BITS ? 4 : 0)))
+/* Modulus contexts reuse two of the transforms, so they switch earlier */
+#define NMOD_POLY_MODULUS_USE_NTT(lenf, bits) \
+    NMOD_POLY_MUL_USE_NTT(4 * ((lenf) - 1), bits)
+/* HGCD: Basecase -> Recursion */
+#define NMOD_POLY_HGCD_CUTOFF flint_tune_get(FLINT_TUNE_NMOD_POLY_HGCD)
+/* GCD:  Euclidean -> HGCD */
+#define NMOD_POLY_GCD_CUTOFF flint_tune_get(FLINT_TUNE_NMOD_POLY_GCD)
+/* GCD (small n): Euclidean -> HGCD */
+#define NMOD_POLY_SMALL_GCD_CUTOFF \
+    flint_tune_get(FLINT_TUNE_NMOD_POLY_SMALL_GCD)
 
 static __inline__
 slong NMOD_DIVREM_BC_ITCH(slong lenA, slong lenB, nmod_t mod)
@@ -138,6 +152,61 @@ typedef struct
 }
 nmod_poly_compose_mod_precomp_preinv_arg_t;
 
+/*
+   Number theoretic transforms modulo the i-th of NMOD_POLY_NTT_NUM_PRIMES
+   word size primes, of length up to 2^depth. The level tab[k] holds the
+   powers w^j, 0 <= j < 2^k, of a root w of order 2^(k+1), each followed
+   by its precomputed quotient for n_mulmod_shoup, with entries step[k]
+   words apart. Levels below NMOD_POLY_NTT_CACHE_DEPTH are shared by all
+   transforms of a thread, the others are read from top.
+*/
+#define NMOD_POLY_NTT_NUM_PRIMES 3
+
+#if FLINT64
+#define NMOD_POLY_NTT_MAX_DEPTH 54
+#else
+#define NMOD_POLY_NTT_MAX_DEPTH 23
+#endif
+
+#define NMOD_POLY_NTT_CACHE_DEPTH 16
+
+typedef struct
+{
+    mp_limb_t p;
+    mp_limb_t pinv;
+    slong depth;
+    mp_srcptr tab[NMOD_POLY_NTT_MAX_DEPTH];
+    slong step[NMOD_POLY_NTT_MAX_DEPTH];
+    mp_ptr top;
+}
+nmod_poly_ntt_struct;
+
+typedef nmod_poly_ntt_struct nmod_poly_ntt_t[1];
+
+/*
+   A modulus f with the inverse finv of its reverse, for repeated
+   reduction modulo f. If num_primes is nonzero, fhat holds for each
+   prime the transform of finv of length 2^depth followed by that of f
+   modulo x^(2^(depth - 1)) - 1, and operands transformed with
+   _nmod_poly_modulus_fft take fft_len words.
+*/
+typedef struct
+{
+    mp_ptr f;
+    mp_ptr finv;
+    slong lenf;
+    slong lenfinv;
+    nmod_t mod;
+    slong num_primes;
+    slong depth;
+    slong fft_len;
+    nmod_poly_ntt_struct ntt[NMOD_POLY_NTT_NUM_PRIMES];
+    mp_ptr fhat;
+}
+nmod_poly_modulus_struct;
+
+typedef nmod_poly_modulus_struct nmod_poly_modulus_t[1];
+
 /* zn_poly helper functions  ************************************************
 
 Copyright (C) 2007, 2008 David Harvey
@@ -558,6 +627,12 @@ FLINT_DLL void _nmod_poly_mulhigh(mp_ptr res, mp_srcptr poly1, slong len1,
 FLINT_DLL void nmod_poly_mulhigh(nmod_poly_t res, const nmod_poly_t poly1, 
                                               const nmod_poly_t poly2, slong n);
 
+FLINT_DLL void _nmod_poly_mulmid(mp_ptr res, mp_srcptr poly1, slong len1,
+                                       mp_srcptr poly2, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mulmid(nmod_poly_t res, const nmod_poly_t poly1,
+                                                      const nmod_poly_t poly2);
+
 FLINT_DLL void _nmod_poly_mulmod(mp_ptr res, mp_srcptr poly1, slong len1, 
                              mp_srcptr poly2, slong len2, mp_srcptr f,
                             slong lenf, nmod_t mod);
@@ -580,6 +655,68 @@ FLINT_DLL int _nmod_poly_invmod(mp_limb_t *A,
 FLINT_DLL int nmod_poly_invmod(nmod_poly_t A, 
                      const nmod_poly_t B, const nmod_poly_t P);
 
+/* Number theoretic transforms  **********************************************/
+
+FLINT_DLL void nmod_poly_ntt_init(nmod_poly_ntt_t ntt, slong i, slong depth);
+
+FLINT_DLL void nmod_poly_ntt_clear(nmod_poly_ntt_t ntt);
+
+FLINT_DLL slong _nmod_poly_ntt_num_primes(slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_poly_ntt_fft(mp_ptr a, slong len,
+                                   slong depth, const nmod_poly_ntt_t ntt);
+
+FLINT_DLL void _nmod_poly_ntt_ifft(mp_ptr a, slong depth,
+                                                const nmod_poly_ntt_t ntt);
+
+FLINT_DLL void _nmod_poly_ntt_mul(mp_ptr a, mp_srcptr b, slong len,
+                                                const nmod_poly_ntt_t ntt);
+
+FLINT_DLL void _nmod_poly_ntt_set(mp_ptr a, mp_srcptr poly, slong len,
+                                     const nmod_poly_ntt_t ntt, nmod_t mod);
+
+FLINT_DLL void _nmod_poly_ntt_crt(mp_ptr res, mp_ptr const * r, slong len,
+                    const nmod_poly_ntt_struct * ntt, slong num_primes,
+                                                  slong depth, nmod_t mod);
+
+FLINT_DLL void _nmod_poly_mul_NTT(mp_ptr res, mp_srcptr poly1, slong len1,
+                                       mp_srcptr poly2, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mul_NTT(nmod_poly_t res,
+                             const nmod_poly_t poly1, const nmod_poly_t poly2);
+
+FLINT_DLL void _nmod_poly_mulmid_NTT(mp_ptr res, mp_srcptr poly1, slong len1,
+                                       mp_srcptr poly2, slong len2, nmod_t mod);
+
+/* Modulus contexts  *********************************************************/
+
+FLINT_DLL void _nmod_poly_modulus_init(nmod_poly_modulus_t M, mp_srcptr f,
+                  slong lenf, mp_srcptr finv, slong lenfinv, nmod_t mod);
+
+FLINT_DLL void nmod_poly_modulus_init(nmod_poly_modulus_t M,
+                                const nmod_poly_t f, const nmod_poly_t finv);
+
+FLINT_DLL void nmod_poly_modulus_clear(nmod_poly_modulus_t M);
+
+FLINT_DLL void _nmod_poly_modulus_fft(mp_ptr bhat, mp_srcptr b, slong lenb,
+                                              const nmod_poly_modulus_t M);
+
+FLINT_DLL void _nmod_poly_divrem_modulus(mp_ptr Q, mp_ptr R, mp_srcptr A,
+                                 slong lenA, const nmod_poly_modulus_t M);
+
+FLINT_DLL void nmod_poly_divrem_modulus(nmod_poly_t Q, nmod_poly_t R,
+                        const nmod_poly_t A, const nmod_poly_modulus_t M);
+
+FLINT_DLL void _nmod_poly_mulmod_modulus(mp_ptr res, mp_srcptr a,
+               slong lena, mp_srcptr b, slong lenb,
+                                              const nmod_poly_modulus_t M);
+
+FLINT_DLL void _nmod_poly_mulmod_modulus_fft(mp_ptr res, mp_srcptr a,
+               slong lena, mp_srcptr bhat, const nmod_poly_modulus_t M);
+
+FLINT_DLL void nmod_poly_mulmod_modulus(nmod_poly_t res,
+    const nmod_poly_t a, const nmod_poly_t b, const nmod_poly_modulus_t M);
+
 /* Powering  *****************************************************************/
 
 FLINT_DLL void _nmod_poly_pow_binexp(mp_ptr res, 
@@ -906,7 +1043,7 @@ FLINT_DLL void _nmod_poly_reduce_matrix_mod_poly (nmod_mat_t A, const nmod_mat_t
 FLINT_DLL void _nmod_poly_precompute_matrix (nmod_mat_t A, mp_srcptr poly1, mp_srcptr poly2,
                slong len2, mp_srcptr poly2inv, slong len2inv, nmod_t mod);
 
-FLINT_DLL void * _nmod_poly_precompute_matrix_worker (void * arg_ptr);
+FLINT_DLL void _nmod_poly_precompute_matrix_worker (void * arg_ptr);
 
 FLINT_DLL void nmod_poly_precompute_matrix (nmod_mat_t A, const nmod_poly_t poly1,
                           const nmod_poly_t poly2, const nmod_poly_t poly2inv);
@@ -916,7 +1053,7 @@ FLINT_DLL void _nmod_poly_compose_mod_brent_kung_precomp_preinv(mp_ptr res, mp_s
                             slong len3, mp_srcptr poly3inv, slong len3inv,
                             nmod_t mod);
 
-FLINT_DLL void * _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr);
+FLINT_DLL void _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr);
 
 FLINT_DLL void nmod_poly_compose_mod_brent_kung_precomp_preinv(nmod_poly_t res,
                     const nmod_poly_t poly1, const nmod_mat_t A,
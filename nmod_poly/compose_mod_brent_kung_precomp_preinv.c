@@ -50,26 +50,33 @@ _nmod_poly_reduce_matrix_mod_poly (nmod_mat_t A, const nmod_mat_t B,
     _nmod_vec_clear (tmp1);
 }
 
-void *
+void
 _nmod_poly_precompute_matrix_worker (void * arg_ptr)
 {
     nmod_poly_matrix_precompute_arg_t arg =
                            *((nmod_poly_matrix_precompute_arg_t *) arg_ptr);
     /* Set rows of A to powers of poly1 */
+    nmod_poly_modulus_t M;
+    mp_ptr phat;
     slong i, n, m;
 
     n = arg.poly2.length - 1;
 
     m = n_sqrt(n) + 1;
 
+    _nmod_poly_modulus_init(M, arg.poly2.coeffs, n + 1,
+                                arg.poly2inv.coeffs, n + 1, arg.poly2.mod);
+    phat = flint_malloc(M->fft_len * sizeof(mp_limb_t));
+    _nmod_poly_modulus_fft(phat, arg.poly1.coeffs, n, M);
+
     arg.A.rows[0][0] = UWORD(1);
     _nmod_vec_set(arg.A.rows[1], arg.poly1.coeffs, n);
     for (i = 2; i < m; i++)
-        _nmod_poly_mulmod_preinv(arg.A.rows[i], arg.A.rows[i - 1], n,
-                                 arg.poly1.coeffs, n, arg.poly2.coeffs, n + 1,
-                                 arg.poly2inv.coeffs, n + 1, arg.poly2.mod);
-    flint_cleanup();
-    return NULL;
+        _nmod_poly_mulmod_modulus_fft(arg.A.rows[i], arg.A.rows[i - 1], n,
+                                                                  phat, M);
+
+    flint_free(phat);
+    nmod_poly_modulus_clear(M);
 }
 
 void
@@ -78,17 +85,25 @@ _nmod_poly_precompute_matrix (nmod_mat_t A, mp_srcptr poly1, mp_srcptr poly2,
                               nmod_t mod)
 {
     /* Set rows of A to powers of poly1 */
+    nmod_poly_modulus_t M;
+    mp_ptr phat;
     slong i, n, m;
 
     n = len2 - 1;
 
     m = n_sqrt(n) + 1;
 
+    _nmod_poly_modulus_init(M, poly2, len2, poly2inv, len2inv, mod);
+    phat = flint_malloc(M->fft_len * sizeof(mp_limb_t));
+    _nmod_poly_modulus_fft(phat, poly1, n, M);
+
     A->rows[0][0] = UWORD(1);
     _nmod_vec_set(A->rows[1], poly1, n);
     for (i = 2; i < m; i++)
-        _nmod_poly_mulmod_preinv(A->rows[i], A->rows[i - 1],
-            n, poly1, n, poly2, len2, poly2inv, len2inv, mod);
+        _nmod_poly_mulmod_modulus_fft(A->rows[i], A->rows[i - 1], n, phat, M);
+
+    flint_free(phat);
+    nmod_poly_modulus_clear(M);
 }
 
 void
@@ -139,27 +154,26 @@ nmod_poly_precompute_matrix (nmod_mat_t A, const nmod_poly_t poly1,
     _nmod_vec_clear (ptr1);
 }
 
-void *
+void
 _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr)
 {
     nmod_poly_compose_mod_precomp_preinv_arg_t arg=
                    *((nmod_poly_compose_mod_precomp_preinv_arg_t*) arg_ptr);
+    nmod_poly_modulus_t M;
     nmod_mat_t B, C;
-    mp_ptr t, h;
+    mp_ptr t, h, hhat;
     slong i, n, m;
 
     n = arg.poly3.length - 1;
 
     if (arg.poly3.length == 1)
     {
-        flint_cleanup();
-        return NULL;
+        return;
     }
     if (arg.poly1.length == 1)
     {
         arg.res.coeffs[0] = arg.poly1.coeffs[0];
-        flint_cleanup();
-        return NULL;
+        return;
     }
 
     if (arg.poly3.length == 2)
@@ -167,8 +181,7 @@ _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr)
         arg.res.coeffs[0] = _nmod_poly_evaluate_nmod(arg.poly1.coeffs,
                                              arg.poly1.length, arg.A.rows[1][0],
                                              arg.poly3.mod);
-        flint_cleanup();
-        return NULL;
+        return;
     }
 
     m = n_sqrt(n) + 1;
@@ -188,27 +201,27 @@ _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker(void * arg_ptr)
     nmod_mat_mul(C, B, &arg.A);
 
     /* Evaluate block composition using the Horner scheme */
+    _nmod_poly_modulus_init(M, arg.poly3.coeffs, arg.poly3.length,
+                     arg.poly3inv.coeffs, arg.poly3inv.length, arg.poly3.mod);
+    hhat = flint_malloc(M->fft_len * sizeof(mp_limb_t));
+
     _nmod_vec_set(arg.res.coeffs, C->rows[m - 1], n);
-    _nmod_poly_mulmod_preinv(h, arg.A.rows[m - 1], n, arg.A.rows[1], n,
-                             arg.poly3.coeffs, arg.poly3.length,
-                             arg.poly3inv.coeffs, arg.poly3inv.length,
-                             arg.poly3.mod);
+    _nmod_poly_mulmod_modulus(h, arg.A.rows[m - 1], n, arg.A.rows[1], n, M);
+    _nmod_poly_modulus_fft(hhat, h, n, M);
 
     for (i = m - 2; i >= 0; i--)
     {
-        _nmod_poly_mulmod_preinv(t, arg.res.coeffs, n, h, n, arg.poly3.coeffs,
-                                 arg.poly3.length, arg.poly3inv.coeffs,
-                                 arg.poly3.length, arg.poly3.mod);
+        _nmod_poly_mulmod_modulus_fft(t, arg.res.coeffs, n, hhat, M);
         _nmod_poly_add(arg.res.coeffs, t, n, C->rows[i], n, arg.poly3.mod);
     }
 
+    flint_free(hhat);
+    nmod_poly_modulus_clear(M);
     _nmod_vec_clear(h);
     _nmod_vec_clear(t);
 
     nmod_mat_clear(B);
     nmod_mat_clear(C);
-    flint_cleanup();
-    return NULL;
 }
 
 void
@@ -217,8 +230,9 @@ _nmod_poly_compose_mod_brent_kung_precomp_preinv
                             const nmod_mat_t A, mp_srcptr poly3, slong len3,
                             mp_srcptr poly3inv, slong len3inv, nmod_t mod)
 {
+    nmod_poly_modulus_t M;
     nmod_mat_t B, C;
-    mp_ptr t, h;
+    mp_ptr t, h, hhat;
     slong i, n, m;
 
     n = len3 - 1;
@@ -257,17 +271,21 @@ _nmod_poly_compose_mod_brent_kung_precomp_preinv
     nmod_mat_mul(C, B, A);
 
     /* Evaluate block composition using the Horner scheme */
+    _nmod_poly_modulus_init(M, poly3, len3, poly3inv, len3inv, mod);
+    hhat = flint_malloc(M->fft_len * sizeof(mp_limb_t));
+
     _nmod_vec_set(res, C->rows[m - 1], n);
-    _nmod_poly_mulmod_preinv(h, A->rows[m - 1], n, A->rows[1], n,
-                             poly3, len3, poly3inv, len3inv,mod);
+    _nmod_poly_mulmod_modulus(h, A->rows[m - 1], n, A->rows[1], n, M);
+    _nmod_poly_modulus_fft(hhat, h, n, M);
 
     for (i = m - 2; i >= 0; i--)
     {
-        _nmod_poly_mulmod_preinv(t, res, n, h, n, poly3, len3,
-                                 poly3inv, len3inv, mod);
+        _nmod_poly_mulmod_modulus_fft(t, res, n, hhat, M);
         _nmod_poly_add(res, t, n, C->rows[i], n, mod);
     }
 
+    flint_free(hhat);
+    nmod_poly_modulus_clear(M);
     _nmod_vec_clear(h);
     _nmod_vec_clear(t);
 
@@ -25,7 +25,7 @@
 ******************************************************************************/
 
 #include <gmp.h>
-#include <pthread.h>
+#include "thread_pool.h"
 #include "flint.h"
 #include "nmod_vec.h"
 #include "nmod_poly.h"
@@ -49,7 +49,7 @@ typedef struct
 }
 compose_vec_arg_t;
 
-void *
+void
 _nmod_poly_compose_mod_brent_kung_vec_preinv_worker(void * arg_ptr)
 {
     compose_vec_arg_t arg= *((compose_vec_arg_t *) arg_ptr);
@@ -69,9 +69,6 @@ _nmod_poly_compose_mod_brent_kung_vec_preinv_worker(void * arg_ptr)
     }
 
     _nmod_vec_clear(t);
-
-    flint_cleanup();
-    return NULL;
 }
 
 void
@@ -83,9 +80,9 @@ _nmod_poly_compose_mod_brent_kung_vec_preinv_threaded(nmod_poly_struct * res,
                                              nmod_t mod)
 {
     nmod_mat_t A, B, C;
-    slong i, j, n, m, k, len2 = l, len1, num_threads, c;
+    slong i, j, n, m, k, len2 = l, len1, num_threads, num_workers, c;
     mp_ptr h;
-    pthread_t *threads;
+    thread_pool_handle * threads;
     compose_vec_arg_t * args;
 
     n = len - 1;
@@ -126,9 +123,9 @@ _nmod_poly_compose_mod_brent_kung_vec_preinv_threaded(nmod_poly_struct * res,
     _nmod_poly_mulmod_preinv(h, A->rows[m - 1], n, A->rows[1], n, poly,
                              len, polyinv, leninv, mod);
 
-    num_threads = flint_get_num_threads();
+    num_workers = flint_request_threads(&threads, len2);
+    num_threads = num_workers + 1;
 
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
     args = flint_malloc(sizeof(compose_vec_arg_t) * num_threads);
 
     for (j = 0; j < len2 / num_threads + 1; j++)
@@ -151,17 +148,22 @@ _nmod_poly_compose_mod_brent_kung_vec_preinv_threaded(nmod_poly_struct * res,
                 args[i].polyinv = polyinv;
                 args[i].leninv  = leninv;
                 args[i].p       = mod;
-
-                pthread_create(&threads[i], NULL,
-                        _nmod_poly_compose_mod_brent_kung_vec_preinv_worker,
-                        &args[i]);
             }
         }
-        for (i = 0; i < c; i++)
-            pthread_join(threads[i], NULL);
+
+        for (i = 1; i < c; i++)
+            thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                    _nmod_poly_compose_mod_brent_kung_vec_preinv_worker,
+                    &args[i]);
+
+        if (c > 0)
+            _nmod_poly_compose_mod_brent_kung_vec_preinv_worker(&args[0]);
+
+        for (i = 1; i < c; i++)
+            thread_pool_wait(global_thread_pool, threads[i - 1]);
     }
 
-    flint_free(threads);
+    flint_give_back_threads(threads, num_workers);
     flint_free(args);
 
     _nmod_vec_clear(h);
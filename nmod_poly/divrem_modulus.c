@@ -0,0 +1,129 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+   The reversed quotient is the low part of the reversed top of A times
+   finv, a product which fits in the transform length 2^depth. As the
+   remainder has length less than 2^(depth - 1), it is A - Q f modulo
+   x^(2^(depth - 1)) - 1, which needs transforms of half the length.
+*/
+void _nmod_poly_divrem_modulus(mp_ptr Q, mp_ptr R, mp_srcptr A, slong lenA,
+                                               const nmod_poly_modulus_t M)
+{
+    const slong lenf = M->lenf, lenQ = lenA - lenf + 1;
+    const slong depth = M->depth, n = WORD(1) << depth, n2 = n / 2;
+    const nmod_t mod = M->mod;
+    mp_ptr r[NMOD_POLY_NTT_NUM_PRIMES], fhat;
+    mp_limb_t t;
+    slong i, j;
+
+    if (M->num_primes == 0)
+    {
+        _nmod_poly_divrem_newton_n_preinv(Q, R, A, lenA, M->f, lenf,
+                                               M->finv, M->lenfinv, mod);
+        return;
+    }
+
+    for (i = 0; i < M->num_primes; i++)
+        r[i] = flint_malloc(n * sizeof(mp_limb_t));
+
+    _nmod_poly_reverse(Q, A + lenf - 1, lenQ, lenQ);
+
+    for (i = 0; i < M->num_primes; i++)
+    {
+        fhat = M->fhat + i * (n + n2);
+
+        _nmod_poly_ntt_set(r[i], Q, lenQ, M->ntt + i, mod);
+        _nmod_poly_ntt_fft(r[i], lenQ, depth, M->ntt + i);
+        _nmod_poly_ntt_mul(r[i], fhat, n, M->ntt + i);
+        _nmod_poly_ntt_ifft(r[i], depth, M->ntt + i);
+    }
+
+    _nmod_poly_ntt_crt(Q, r, lenQ, M->ntt, M->num_primes, depth, mod);
+    _nmod_poly_reverse(Q, Q, lenQ, lenQ);
+
+    for (i = 0; i < M->num_primes; i++)
+    {
+        fhat = M->fhat + i * (n + n2) + n;
+
+        _nmod_poly_ntt_set(r[i], Q, lenQ, M->ntt + i, mod);
+        _nmod_poly_ntt_fft(r[i], lenQ, depth - 1, M->ntt + i);
+        _nmod_poly_ntt_mul(r[i], fhat, n2, M->ntt + i);
+        _nmod_poly_ntt_ifft(r[i], depth - 1, M->ntt + i);
+    }
+
+    _nmod_poly_ntt_crt(R, r, lenf - 1, M->ntt, M->num_primes,
+                                                          depth - 1, mod);
+
+    for (j = 0; j < lenf - 1; j++)
+    {
+        t = A[j];
+        if (j + n2 < lenA)
+            t = nmod_add(t, A[j + n2], mod);
+        R[j] = nmod_sub(t, R[j], mod);
+    }
+
+    for (i = 0; i < M->num_primes; i++)
+        flint_free(r[i]);
+}
+
+void nmod_poly_divrem_modulus(nmod_poly_t Q, nmod_poly_t R,
+                         const nmod_poly_t A, const nmod_poly_modulus_t M)
+{
+    const slong lenA = A->length, lenf = M->lenf;
+    mp_ptr q, r;
+
+    if (lenA < lenf)
+    {
+        nmod_poly_set(R, A);
+        nmod_poly_zero(Q);
+        return;
+    }
+
+    if (lenA > 2 * lenf - 2)
+    {
+        flint_printf("Exception (nmod_poly_divrem_modulus). "
+                     "Input too long.\n");
+        abort();
+    }
+
+    q = _nmod_vec_init(lenA - lenf + 1);
+    r = _nmod_vec_init(lenf - 1);
+
+    _nmod_poly_divrem_modulus(q, r, A->coeffs, lenA, M);
+
+    _nmod_vec_clear(Q->coeffs);
+    Q->coeffs = q;
+    Q->alloc = lenA - lenf + 1;
+    Q->length = lenA - lenf + 1;
+
+    _nmod_vec_clear(R->coeffs);
+    R->coeffs = r;
+    R->alloc = lenf - 1;
+    R->length = lenf - 1;
+
+    _nmod_poly_normalise(R);
+}
@@ -30,11 +30,18 @@ slong _nmod_poly_gcd(mp_ptr G, mp_srcptr A, slong lenA,
 {
     const slong cutoff = FLINT_BIT_COUNT(mod.n) <= 8 ? 
                         NMOD_POLY_SMALL_GCD_CUTOFF : NMOD_POLY_GCD_CUTOFF;
+    slong lenG;
 
     if (lenA < cutoff)
-        return _nmod_poly_gcd_euclidean(G, A, lenA, B, lenB, mod);
+        FLINT_STATS_CALL(FLINT_STATS_NMOD_POLY_GCD_EUCLIDEAN, lenA,
+            FLINT_BIT_COUNT(mod.n),
+            lenG = _nmod_poly_gcd_euclidean(G, A, lenA, B, lenB, mod));
     else
-        return _nmod_poly_gcd_hgcd(G, A, lenA, B, lenB, mod);
+        FLINT_STATS_CALL(FLINT_STATS_NMOD_POLY_GCD_HGCD, lenA,
+            FLINT_BIT_COUNT(mod.n),
+            lenG = _nmod_poly_gcd_hgcd(G, A, lenA, B, lenB, mod));
+
+    return lenG;
 }
 
 void nmod_poly_gcd(nmod_poly_t G, 
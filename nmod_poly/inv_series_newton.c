@@ -62,8 +62,9 @@ _nmod_poly_inv_series_newton(mp_ptr Qinv, mp_srcptr Q, slong n, nmod_t mod)
             m = n;
             n = a[i];
 
-            _nmod_poly_mullow(W, Q, n, Qinv, m, n, mod);
-            _nmod_poly_mullow(Qinv + m, Qinv, m, W + m, n - m, n - m, mod);
+            /* Q Qinv = 1 + O(x^m), only coefficients m - 1 to n - 1 */
+            _nmod_poly_mulmid(W, Q, n, Qinv, m, mod);
+            _nmod_poly_mullow(Qinv + m, Qinv, m, W + 1, n - m, n - m, mod);
             _nmod_vec_neg(Qinv + m, Qinv + m, n - m, mod);
         }
 
@@ -0,0 +1,43 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_modulus_fft(mp_ptr bhat, mp_srcptr b, slong lenb,
+                                               const nmod_poly_modulus_t M)
+{
+    slong i, n = WORD(1) << M->depth;
+
+    if (M->num_primes == 0)
+    {
+        _nmod_vec_set(bhat, b, lenb);
+        _nmod_vec_zero(bhat + lenb, M->fft_len - lenb);
+        return;
+    }
+
+    for (i = 0; i < M->num_primes; i++)
+    {
+        _nmod_poly_ntt_set(bhat + i * n, b, lenb, M->ntt + i, M->mod);
+        _nmod_poly_ntt_fft(bhat + i * n, lenb, M->depth, M->ntt + i);
+    }
+}
@@ -0,0 +1,100 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_modulus_init(nmod_poly_modulus_t M, mp_srcptr f, slong lenf,
+                               mp_srcptr finv, slong lenfinv, nmod_t mod)
+{
+    slong i, j, n, n2, bits = FLINT_BITS - (slong) mod.norm;
+    mp_ptr a, b;
+
+    lenfinv = FLINT_MIN(lenfinv, lenf);
+
+    M->f = _nmod_vec_init(lenf);
+    M->finv = _nmod_vec_init(lenfinv);
+    _nmod_vec_set(M->f, f, lenf);
+    _nmod_vec_set(M->finv, finv, lenfinv);
+    M->lenf = lenf;
+    M->lenfinv = lenfinv;
+    M->mod = mod;
+
+    M->num_primes = 0;
+    M->depth = 0;
+    M->fft_len = FLINT_MAX(lenf - 1, 1);
+    M->fhat = NULL;
+
+    /* products of reduced polynomials have length at most 2 lenf - 3 */
+    if (lenf >= 3 && NMOD_POLY_MODULUS_USE_NTT(lenf, bits))
+    {
+        M->depth = FLINT_CLOG2(2 * lenf - 3);
+        M->num_primes = _nmod_poly_ntt_num_primes(lenf - 1, mod);
+
+        if (M->depth > NMOD_POLY_NTT_MAX_DEPTH)
+            M->num_primes = 0;
+    }
+
+    if (M->num_primes == 0)
+        return;
+
+    n = WORD(1) << M->depth;
+    n2 = n / 2;
+    lenfinv = FLINT_MIN(lenfinv, lenf - 1);
+
+    M->fft_len = M->num_primes * n;
+    M->fhat = flint_malloc(M->num_primes * (n + n2) * sizeof(mp_limb_t));
+
+    for (i = 0; i < M->num_primes; i++)
+    {
+        nmod_poly_ntt_init(M->ntt + i, i, M->depth);
+
+        a = M->fhat + i * (n + n2);
+        _nmod_poly_ntt_set(a, finv, lenfinv, M->ntt + i, mod);
+        _nmod_poly_ntt_fft(a, lenfinv, M->depth, M->ntt + i);
+
+        /* f modulo x^n2 - 1, as lenf <= n2 + 1 */
+        b = a + n;
+        _nmod_vec_set(b, f, FLINT_MIN(lenf, n2));
+        if (lenf < n2)
+            _nmod_vec_zero(b + lenf, n2 - lenf);
+        for (j = n2; j < lenf; j++)
+            b[j - n2] = nmod_add(b[j - n2], f[j], mod);
+
+        _nmod_poly_ntt_set(b, b, n2, M->ntt + i, mod);
+        _nmod_poly_ntt_fft(b, n2, M->depth - 1, M->ntt + i);
+    }
+}
+
+void nmod_poly_modulus_init(nmod_poly_modulus_t M,
+                                 const nmod_poly_t f, const nmod_poly_t finv)
+{
+    if (f->length == 0)
+    {
+        flint_printf("Exception (nmod_poly_modulus_init). Division by zero.\n");
+        abort();
+    }
+
+    _nmod_poly_modulus_init(M, f->coeffs, f->length,
+                                  finv->coeffs, finv->length, f->mod);
+}
@@ -0,0 +1,162 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+   A product whose length exceeds a power of two 2^k by at most
+   2^k / NTT_WRAP_RATIO is computed modulo x^(2^k) - 1, and the
+   coefficients which wrap around are recovered from its low part.
+*/
+#define NTT_WRAP_RATIO 4
+
+void _nmod_poly_mul_NTT(mp_ptr res, mp_srcptr poly1, slong len1,
+                                     mp_srcptr poly2, slong len2, nmod_t mod)
+{
+    nmod_poly_ntt_struct ntt[NMOD_POLY_NTT_NUM_PRIMES];
+    mp_ptr r[NMOD_POLY_NTT_NUM_PRIMES], t = NULL;
+    slong i, lenr, n, wrap, depth, num_primes;
+    int squaring;
+
+    lenr = len1 + len2 - 1;
+    depth = FLINT_CLOG2(lenr);
+    num_primes = _nmod_poly_ntt_num_primes(len2, mod);
+
+    if (num_primes == 0 || depth > NMOD_POLY_NTT_MAX_DEPTH)
+    {
+        _nmod_poly_mul_KS4(res, poly1, len1, poly2, len2, mod);
+        return;
+    }
+
+    wrap = 0;
+    if (depth > 0)
+    {
+        n = WORD(1) << (depth - 1);
+
+        if (len1 <= n && lenr - n <= n / NTT_WRAP_RATIO)
+        {
+            wrap = lenr - n;
+            depth--;
+        }
+    }
+
+    n = WORD(1) << depth;
+    squaring = (poly1 == poly2 && len1 == len2);
+
+    for (i = 0; i < num_primes; i++)
+        r[i] = flint_malloc(n * sizeof(mp_limb_t));
+    if (!squaring)
+        t = flint_malloc(n * sizeof(mp_limb_t));
+
+    for (i = 0; i < num_primes; i++)
+    {
+        nmod_poly_ntt_init(ntt + i, i, depth);
+
+        _nmod_poly_ntt_set(r[i], poly1, len1, ntt + i, mod);
+        _nmod_poly_ntt_fft(r[i], len1, depth, ntt + i);
+
+        if (squaring)
+            _nmod_poly_ntt_mul(r[i], r[i], n, ntt + i);
+        else
+        {
+            _nmod_poly_ntt_set(t, poly2, len2, ntt + i, mod);
+            _nmod_poly_ntt_fft(t, len2, depth, ntt + i);
+            _nmod_poly_ntt_mul(r[i], t, n, ntt + i);
+        }
+
+        _nmod_poly_ntt_ifft(r[i], depth, ntt + i);
+    }
+
+    _nmod_poly_ntt_crt(res, r, FLINT_MIN(n, lenr), ntt, num_primes,
+                                                                 depth, mod);
+
+    for (i = 0; i < num_primes; i++)
+    {
+        nmod_poly_ntt_clear(ntt + i);
+        flint_free(r[i]);
+    }
+    if (!squaring)
+        flint_free(t);
+
+    /* res holds c_i + c_(n + i) for i < wrap */
+    if (wrap > 0)
+    {
+        mp_ptr low = _nmod_vec_init(wrap);
+
+        _nmod_poly_mullow(low, poly1, FLINT_MIN(len1, wrap),
+                               poly2, FLINT_MIN(len2, wrap), wrap, mod);
+
+        for (i = 0; i < wrap; i++)
+        {
+            res[n + i] = nmod_sub(res[i], low[i], mod);
+            res[i] = low[i];
+        }
+
+        _nmod_vec_clear(low);
+    }
+}
+
+void nmod_poly_mul_NTT(nmod_poly_t res,
+                            const nmod_poly_t poly1, const nmod_poly_t poly2)
+{
+    slong len_out;
+
+    if ((poly1->length == 0) || (poly2->length == 0))
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    len_out = poly1->length + poly2->length - 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        nmod_poly_t temp;
+        nmod_poly_init2_preinv(temp, poly1->mod.n, poly1->mod.ninv, len_out);
+        if (poly1->length >= poly2->length)
+            _nmod_poly_mul_NTT(temp->coeffs, poly1->coeffs, poly1->length,
+                              poly2->coeffs, poly2->length,
+                              poly1->mod);
+        else
+            _nmod_poly_mul_NTT(temp->coeffs, poly2->coeffs, poly2->length,
+                              poly1->coeffs, poly1->length,
+                              poly1->mod);
+        nmod_poly_swap(res, temp);
+        nmod_poly_clear(temp);
+    }
+    else
+    {
+        nmod_poly_fit_length(res, len_out);
+        if (poly1->length >= poly2->length)
+            _nmod_poly_mul_NTT(res->coeffs, poly1->coeffs, poly1->length,
+                              poly2->coeffs, poly2->length,
+                              poly1->mod);
+        else
+            _nmod_poly_mul_NTT(res->coeffs, poly2->coeffs, poly2->length,
+                              poly1->coeffs, poly1->length,
+                              poly1->mod);
+    }
+
+    res->length = len_out;
+    _nmod_poly_normalise(res);
+}
@@ -45,6 +45,8 @@ void _nmod_poly_mulhigh(mp_ptr res, mp_srcptr poly1, slong len1,
 
     if (2 * bits + bits2 <= FLINT_BITS && len1 + len2 < 16)
         _nmod_poly_mulhigh_classical(res, poly1, len1, poly2, len2, n, mod);
+    else if (NMOD_POLY_MUL_USE_NTT(len2, bits))
+        _nmod_poly_mul_NTT(res, poly1, len1, poly2, len2, mod);
     else
         _nmod_poly_mul_KS(res, poly1, len1, poly2, len2, 0, mod);
 }
@@ -48,6 +48,21 @@ void _nmod_poly_mullow(mp_ptr res, mp_srcptr poly1, slong len1,
 
     if (2 * bits + bits2 <= FLINT_BITS && len1 + len2 < 16)
         _nmod_poly_mullow_classical(res, poly1, len1, poly2, len2, n, mod);
+    else if (NMOD_POLY_MUL_USE_NTT(FLINT_MIN(len1, len2), bits))
+    {
+        mp_ptr t;
+
+        if (len1 + len2 - 1 <= n)
+        {
+            _nmod_poly_mul_NTT(res, poly1, len1, poly2, len2, mod);
+            return;
+        }
+
+        t = _nmod_vec_init(len1 + len2 - 1);
+        _nmod_poly_mul_NTT(t, poly1, len1, poly2, len2, mod);
+        _nmod_vec_set(res, t, n);
+        _nmod_vec_clear(t);
+    }
     else
         _nmod_poly_mullow_KS(res, poly1, len1, poly2, len2, 0, n, mod);
 }
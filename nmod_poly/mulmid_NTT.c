@@ -0,0 +1,78 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+   Modulo x^n - 1 with n >= len1, the coefficients len2 - 1 to len1 - 1
+   of the product receive nothing from coefficients which wrap around,
+   so a transform of the length of the longer factor suffices.
+*/
+void _nmod_poly_mulmid_NTT(mp_ptr res, mp_srcptr poly1, slong len1,
+                                     mp_srcptr poly2, slong len2, nmod_t mod)
+{
+    nmod_poly_ntt_struct ntt[NMOD_POLY_NTT_NUM_PRIMES];
+    mp_ptr r[NMOD_POLY_NTT_NUM_PRIMES], s[NMOD_POLY_NTT_NUM_PRIMES], t;
+    slong i, n, depth, num_primes;
+
+    depth = FLINT_CLOG2(len1);
+    num_primes = _nmod_poly_ntt_num_primes(len2, mod);
+
+    if (num_primes == 0 || depth > NMOD_POLY_NTT_MAX_DEPTH)
+    {
+        t = _nmod_vec_init(len1 + len2 - 1);
+        _nmod_poly_mul_KS4(t, poly1, len1, poly2, len2, mod);
+        _nmod_vec_set(res, t + len2 - 1, len1 - len2 + 1);
+        _nmod_vec_clear(t);
+        return;
+    }
+
+    n = WORD(1) << depth;
+
+    for (i = 0; i < num_primes; i++)
+        r[i] = flint_malloc(n * sizeof(mp_limb_t));
+    t = flint_malloc(n * sizeof(mp_limb_t));
+
+    for (i = 0; i < num_primes; i++)
+    {
+        nmod_poly_ntt_init(ntt + i, i, depth);
+
+        _nmod_poly_ntt_set(r[i], poly1, len1, ntt + i, mod);
+        _nmod_poly_ntt_fft(r[i], len1, depth, ntt + i);
+        _nmod_poly_ntt_set(t, poly2, len2, ntt + i, mod);
+        _nmod_poly_ntt_fft(t, len2, depth, ntt + i);
+        _nmod_poly_ntt_mul(r[i], t, n, ntt + i);
+        _nmod_poly_ntt_ifft(r[i], depth, ntt + i);
+
+        s[i] = r[i] + len2 - 1;
+    }
+
+    _nmod_poly_ntt_crt(res, s, len1 - len2 + 1, ntt, num_primes, depth, mod);
+
+    for (i = 0; i < num_primes; i++)
+    {
+        nmod_poly_ntt_clear(ntt + i);
+        flint_free(r[i]);
+    }
+    flint_free(t);
+}
@@ -0,0 +1,118 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_mulmod_modulus(mp_ptr res, mp_srcptr a, slong lena,
+                  mp_srcptr b, slong lenb, const nmod_poly_modulus_t M)
+{
+    const slong lenf = M->lenf, lenT = lena + lenb - 1;
+    const slong depth = M->depth, n = WORD(1) << depth;
+    mp_ptr r[NMOD_POLY_NTT_NUM_PRIMES], T;
+    slong i;
+
+    if (lenT < lenf || M->num_primes == 0)
+    {
+        T = _nmod_vec_init(lenT + FLINT_MAX(lenT - lenf + 1, 0));
+
+        if (lena >= lenb)
+            _nmod_poly_mul(T, a, lena, b, lenb, M->mod);
+        else
+            _nmod_poly_mul(T, b, lenb, a, lena, M->mod);
+
+        if (lenT < lenf)
+        {
+            _nmod_vec_set(res, T, lenT);
+            _nmod_vec_zero(res + lenT, lenf - 1 - lenT);
+        }
+        else
+            _nmod_poly_divrem_modulus(T + lenT, res, T, lenT, M);
+
+        _nmod_vec_clear(T);
+        return;
+    }
+
+    if (a != b || lena != lenb)
+    {
+        mp_ptr bhat = flint_malloc(M->fft_len * sizeof(mp_limb_t));
+
+        _nmod_poly_modulus_fft(bhat, b, lenb, M);
+        _nmod_poly_mulmod_modulus_fft(res, a, lena, bhat, M);
+
+        flint_free(bhat);
+        return;
+    }
+
+    /* squaring needs a single forward transform */
+    T = _nmod_vec_init(2 * lenT - lenf + 1);
+
+    for (i = 0; i < M->num_primes; i++)
+    {
+        r[i] = flint_malloc(n * sizeof(mp_limb_t));
+
+        _nmod_poly_ntt_set(r[i], a, lena, M->ntt + i, M->mod);
+        _nmod_poly_ntt_fft(r[i], lena, depth, M->ntt + i);
+        _nmod_poly_ntt_mul(r[i], r[i], n, M->ntt + i);
+        _nmod_poly_ntt_ifft(r[i], depth, M->ntt + i);
+    }
+
+    _nmod_poly_ntt_crt(T, r, lenT, M->ntt, M->num_primes, depth, M->mod);
+    _nmod_poly_divrem_modulus(T + lenT, res, T, lenT, M);
+
+    for (i = 0; i < M->num_primes; i++)
+        flint_free(r[i]);
+    _nmod_vec_clear(T);
+}
+
+void nmod_poly_mulmod_modulus(nmod_poly_t res, const nmod_poly_t a,
+                          const nmod_poly_t b, const nmod_poly_modulus_t M)
+{
+    const slong lenf = M->lenf;
+    mp_ptr r;
+
+    if (a->length >= lenf || b->length >= lenf)
+    {
+        flint_printf("Exception (nmod_poly_mulmod_modulus). "
+                     "Input larger than modulus.\n");
+        abort();
+    }
+
+    if (a->length == 0 || b->length == 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    r = _nmod_vec_init(lenf - 1);
+
+    _nmod_poly_mulmod_modulus(r, a->coeffs, a->length,
+                                 b->coeffs, b->length, M);
+
+    _nmod_vec_clear(res->coeffs);
+    res->coeffs = r;
+    res->alloc = lenf - 1;
+    res->length = lenf - 1;
+
+    _nmod_poly_normalise(res);
+}
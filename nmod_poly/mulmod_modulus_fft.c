@@ -0,0 +1,72 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_mulmod_modulus_fft(mp_ptr res, mp_srcptr a, slong lena,
+                               mp_srcptr bhat, const nmod_poly_modulus_t M)
+{
+    const slong lenf = M->lenf, lenT = lena + lenf - 2;
+    const slong depth = M->depth, n = WORD(1) << depth;
+    mp_ptr r[NMOD_POLY_NTT_NUM_PRIMES], T;
+    slong i;
+
+    if (lena == 0)
+    {
+        _nmod_vec_zero(res, lenf - 1);
+        return;
+    }
+
+    if (M->num_primes == 0)
+    {
+        _nmod_poly_mulmod_modulus(res, a, lena, bhat, lenf - 1, M);
+        return;
+    }
+
+    T = _nmod_vec_init(lenT + FLINT_MAX(lenT - lenf + 1, 0));
+
+    for (i = 0; i < M->num_primes; i++)
+    {
+        r[i] = flint_malloc(n * sizeof(mp_limb_t));
+
+        _nmod_poly_ntt_set(r[i], a, lena, M->ntt + i, M->mod);
+        _nmod_poly_ntt_fft(r[i], lena, depth, M->ntt + i);
+        _nmod_poly_ntt_mul(r[i], bhat + i * n, n, M->ntt + i);
+        _nmod_poly_ntt_ifft(r[i], depth, M->ntt + i);
+    }
+
+    _nmod_poly_ntt_crt(T, r, lenT, M->ntt, M->num_primes, depth, M->mod);
+
+    if (lenT < lenf)
+    {
+        _nmod_vec_set(res, T, lenT);
+        _nmod_vec_zero(res + lenT, lenf - 1 - lenT);
+    }
+    else
+        _nmod_poly_divrem_modulus(T + lenT, res, T, lenT, M);
+
+    for (i = 0; i < M->num_primes; i++)
+        flint_free(r[i]);
+    _nmod_vec_clear(T);
+}
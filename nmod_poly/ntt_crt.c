@@ -0,0 +1,109 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+   Garner's algorithm: the value with residues a1, a2, a3 is a1 + p1 t2
+   + p1 p2 t3 with t2 = (a2 - a1) / p1 mod p2 and t3 = (a3 - a1) / (p1 p2)
+   - t2 / p2 mod p3, which is reduced modulo n directly. The factor
+   2^-depth of the inverse transforms is folded into the residues.
+*/
+void _nmod_poly_ntt_crt(mp_ptr res, mp_ptr const * r, slong len,
+                    const nmod_poly_ntt_struct * ntt, slong num_primes,
+                                                   slong depth, nmod_t mod)
+{
+    mp_limb_t p1, p2, p3, l1, l1pre, k2, k2pre, c2, c2pre, k3, k3pre;
+    mp_limb_t c3, c3pre, e3, e3pre, n1, n12, a1, t2, t3, u, v, hi, lo;
+    slong i;
+
+    p1 = ntt[0].p;
+    l1 = p1 - ((p1 - 1) >> depth);
+    l1pre = n_mulmod_precomp_shoup(l1, p1);
+
+    if (num_primes == 1)
+    {
+        for (i = 0; i < len; i++)
+        {
+            a1 = n_mulmod_shoup(l1, r[0][i], l1pre, p1);
+            NMOD_RED(res[i], a1, mod);
+        }
+
+        return;
+    }
+
+    p2 = ntt[1].p;
+    c2 = n_invmod(p1 % p2, p2);
+    k2 = n_mulmod2_preinv(p2 - ((p2 - 1) >> depth), c2, p2, ntt[1].pinv);
+    c2pre = n_mulmod_precomp_shoup(c2, p2);
+    k2pre = n_mulmod_precomp_shoup(k2, p2);
+    n1 = n_mod2_preinv(p1, mod.n, mod.ninv);
+
+    if (num_primes == 2)
+    {
+        for (i = 0; i < len; i++)
+        {
+            a1 = n_mulmod_shoup(l1, r[0][i], l1pre, p1);
+            u = n_mulmod_shoup(k2, r[1][i], k2pre, p2);
+            v = n_mulmod_shoup(c2, a1, c2pre, p2);
+            t2 = (u >= v) ? u - v : u - v + p2;
+
+            umul_ppmm(hi, lo, n1, t2);
+            add_ssaaaa(hi, lo, hi, lo, UWORD(0), a1);
+            NMOD2_RED2(res[i], hi, lo, mod);
+        }
+
+        return;
+    }
+
+    p3 = ntt[2].p;
+    c3 = n_invmod(n_mulmod2_preinv(p1 % p3, p2 % p3, p3, ntt[2].pinv), p3);
+    e3 = n_invmod(p2 % p3, p3);
+    k3 = n_mulmod2_preinv(p3 - ((p3 - 1) >> depth), c3, p3, ntt[2].pinv);
+    c3pre = n_mulmod_precomp_shoup(c3, p3);
+    e3pre = n_mulmod_precomp_shoup(e3, p3);
+    k3pre = n_mulmod_precomp_shoup(k3, p3);
+    n12 = n_mulmod2_preinv(n1, n_mod2_preinv(p2, mod.n, mod.ninv),
+                                                          mod.n, mod.ninv);
+
+    for (i = 0; i < len; i++)
+    {
+        a1 = n_mulmod_shoup(l1, r[0][i], l1pre, p1);
+        u = n_mulmod_shoup(k2, r[1][i], k2pre, p2);
+        v = n_mulmod_shoup(c2, a1, c2pre, p2);
+        t2 = (u >= v) ? u - v : u - v + p2;
+
+        u = n_mulmod_shoup(k3, r[2][i], k3pre, p3);
+        v = n_mulmod_shoup(c3, a1, c3pre, p3);
+        t3 = (u >= v) ? u - v : u - v + p3;
+        v = n_mulmod_shoup(e3, t2, e3pre, p3);
+        t3 = (t3 >= v) ? t3 - v : t3 - v + p3;
+
+        umul_ppmm(hi, lo, n1, t2);
+        add_ssaaaa(hi, lo, hi, lo, UWORD(0), a1);
+        umul_ppmm(u, v, n12, t3);
+        add_ssaaaa(hi, lo, hi, lo, u, v);
+        NMOD2_RED2(res[i], hi, lo, mod);
+    }
+}
@@ -0,0 +1,188 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+
+/*
+   Transforms of length at most 2^NTT_FFT_BASE_DEPTH are done one layer
+   at a time, larger ones recursively so that the blocks fit in cache.
+*/
+#define NTT_FFT_BASE_DEPTH 10
+
+/*
+   Decimation in frequency, with natural order input and bit reversed
+   output. Values are kept in [0, 2p), following Harvey, "Faster
+   arithmetic for number-theoretic transforms".
+*/
+
+/* w t mod p in [0, 2p) for any t */
+static __inline__ mp_limb_t
+_ntt_mul(mp_limb_t t, mp_srcptr w, mp_limb_t p)
+{
+    mp_limb_t q, lo;
+
+    umul_ppmm(q, lo, w[1], t);
+
+    return w[0] * t - q * p;
+}
+
+static __inline__ mp_limb_t
+_ntt_red(mp_limb_t a, mp_limb_t p2)
+{
+    return (a >= p2) ? a - p2 : a;
+}
+
+/* (x, y) -> (x + y, (x - y) w^j) for the block of length 2^(k + 1) */
+static void
+_ntt_fft_radix2(mp_ptr a, slong k, const nmod_poly_ntt_t ntt)
+{
+    const mp_limb_t p = ntt->p, p2 = 2 * ntt->p;
+    mp_srcptr w = ntt->tab[k];
+    const slong s = ntt->step[k], m = WORD(1) << k;
+    mp_limb_t x, y;
+    slong j;
+
+    for (j = 0; j < m; j++, w += s)
+    {
+        x = a[j];
+        y = a[j + m];
+        a[j] = _ntt_red(x + y, p2);
+        a[j + m] = _ntt_mul(x - y + p2, w, p);
+    }
+}
+
+/* Two layers at once for the block of length 2^(k + 2) */
+static void
+_ntt_fft_radix4(mp_ptr a, slong k, const nmod_poly_ntt_t ntt)
+{
+    const mp_limb_t p = ntt->p, p2 = 2 * ntt->p;
+    mp_srcptr w1 = ntt->tab[k + 1], w2 = ntt->tab[k];
+    const slong s1 = ntt->step[k + 1], s2 = ntt->step[k];
+    const slong m = WORD(1) << k;
+    mp_srcptr w3 = w1 + m * s1;
+    mp_limb_t x0, x1, x2, x3, y0, y1, y2, y3;
+    slong j;
+
+    for (j = 0; j < m; j++, w1 += s1, w2 += s2, w3 += s1)
+    {
+        x0 = a[j];
+        x1 = a[j + m];
+        x2 = a[j + 2*m];
+        x3 = a[j + 3*m];
+
+        y0 = _ntt_red(x0 + x2, p2);
+        y2 = _ntt_mul(x0 - x2 + p2, w1, p);
+        y1 = _ntt_red(x1 + x3, p2);
+        y3 = _ntt_mul(x1 - x3 + p2, w3, p);
+
+        a[j] = _ntt_red(y0 + y1, p2);
+        a[j + m] = _ntt_mul(y0 - y1 + p2, w2, p);
+        a[j + 2*m] = _ntt_red(y2 + y3, p2);
+        a[j + 3*m] = _ntt_mul(y2 - y3 + p2, w2, p);
+    }
+}
+
+static void
+_ntt_fft_basecase(mp_ptr a, slong depth, const nmod_poly_ntt_t ntt)
+{
+    slong i, k = depth;
+
+    if (k & 1)
+    {
+        _ntt_fft_radix2(a, k - 1, ntt);
+        k--;
+    }
+
+    for ( ; k >= 2; k -= 2)
+        for (i = 0; i < (WORD(1) << depth); i += (WORD(1) << k))
+            _ntt_fft_radix4(a + i, k - 2, ntt);
+}
+
+static void
+_ntt_fft_recursive(mp_ptr a, slong depth, const nmod_poly_ntt_t ntt)
+{
+    slong i;
+
+    if (depth <= NTT_FFT_BASE_DEPTH)
+    {
+        _ntt_fft_basecase(a, depth, ntt);
+    }
+    else if (depth & 1)
+    {
+        _ntt_fft_radix2(a, depth - 1, ntt);
+
+        for (i = 0; i < 2; i++)
+            _ntt_fft_recursive(a + (i << (depth - 1)), depth - 1, ntt);
+    }
+    else
+    {
+        _ntt_fft_radix4(a, depth - 2, ntt);
+
+        for (i = 0; i < 4; i++)
+            _ntt_fft_recursive(a + (i << (depth - 2)), depth - 2, ntt);
+    }
+}
+
+void _nmod_poly_ntt_fft(mp_ptr a, slong len,
+                                     slong depth, const nmod_poly_ntt_t ntt)
+{
+    const mp_limb_t p = ntt->p, p2 = 2 * ntt->p;
+    slong j, m;
+    mp_srcptr w;
+
+    if (len >= (WORD(1) << depth))
+    {
+        _ntt_fft_recursive(a, depth, ntt);
+        return;
+    }
+
+    /* the inputs a[j], len <= j < 2m are zero and are not read */
+    m = WORD(1) << (depth - 1);
+    w = ntt->tab[depth - 1];
+
+    if (len <= m)
+    {
+        for (j = 0; j < len; j++, w += ntt->step[depth - 1])
+            a[j + m] = _ntt_mul(a[j], w, p);
+
+        _nmod_poly_ntt_fft(a, len, depth - 1, ntt);
+        _nmod_poly_ntt_fft(a + m, len, depth - 1, ntt);
+    }
+    else
+    {
+        mp_limb_t x, y;
+
+        for (j = 0; j < len - m; j++, w += ntt->step[depth - 1])
+        {
+            x = a[j];
+            y = a[j + m];
+            a[j] = _ntt_red(x + y, p2);
+            a[j + m] = _ntt_mul(x - y + p2, w, p);
+        }
+
+        for ( ; j < m; j++, w += ntt->step[depth - 1])
+            a[j + m] = _ntt_mul(a[j], w, p);
+
+        _ntt_fft_recursive(a, depth - 1, ntt);
+        _ntt_fft_recursive(a + m, depth - 1, ntt);
+    }
+}
@@ -0,0 +1,173 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+
+#define NTT_IFFT_BASE_DEPTH 10
+
+/*
+   Decimation in time, with bit reversed input and natural order output,
+   undoing _nmod_poly_ntt_fft up to a factor 2^depth. The inverse of the
+   twiddle w^j, 0 < j < m, where w has order 2m, is -w^(m - j), so the
+   tables of the forward transform are used. Values are kept in [0, 2p).
+*/
+
+static __inline__ mp_limb_t
+_ntt_mul(mp_limb_t t, mp_srcptr w, mp_limb_t p)
+{
+    mp_limb_t q, lo;
+
+    umul_ppmm(q, lo, w[1], t);
+
+    return w[0] * t - q * p;
+}
+
+static __inline__ mp_limb_t
+_ntt_red(mp_limb_t a, mp_limb_t p2)
+{
+    return (a >= p2) ? a - p2 : a;
+}
+
+/* (x, y) -> (x + y w^-j, x - y w^-j) for the block of length 2^(k + 1) */
+static void
+_ntt_ifft_radix2(mp_ptr a, slong k, const nmod_poly_ntt_t ntt)
+{
+    const mp_limb_t p = ntt->p, p2 = 2 * ntt->p;
+    const slong s = ntt->step[k], m = WORD(1) << k;
+    mp_srcptr w = ntt->tab[k] + m * s;
+    mp_limb_t x, y, t;
+    slong j;
+
+    x = a[0];
+    y = a[m];
+    a[0] = _ntt_red(x + y, p2);
+    a[m] = _ntt_red(x - y + p2, p2);
+
+    for (j = 1; j < m; j++)
+    {
+        w -= s;
+        x = a[j];
+        t = _ntt_mul(a[j + m], w, p);
+        a[j] = _ntt_red(x - t + p2, p2);
+        a[j + m] = _ntt_red(x + t, p2);
+    }
+}
+
+/* Two layers at once for the block of length 2^(k + 2) */
+static void
+_ntt_ifft_radix4(mp_ptr a, slong k, const nmod_poly_ntt_t ntt)
+{
+    const mp_limb_t p = ntt->p, p2 = 2 * ntt->p;
+    const slong s1 = ntt->step[k + 1], s2 = ntt->step[k];
+    const slong m = WORD(1) << k;
+    mp_srcptr w1 = ntt->tab[k + 1] + 2 * m * s1;
+    mp_srcptr w3 = ntt->tab[k + 1] + m * s1;
+    mp_srcptr w2 = ntt->tab[k] + m * s2;
+    mp_limb_t x0, x1, x2, x3, y0, y1, y2, y3, t;
+    slong j;
+
+    /* j = 0, where w1 = w2 = 1 */
+    x0 = a[0];
+    x1 = a[m];
+    x2 = a[2*m];
+    x3 = a[3*m];
+
+    y0 = _ntt_red(x0 + x1, p2);
+    y1 = _ntt_red(x0 - x1 + p2, p2);
+    y2 = _ntt_red(x2 + x3, p2);
+    y3 = _ntt_red(x2 - x3 + p2, p2);
+
+    t = _ntt_mul(y3, w3, p);
+    a[0] = _ntt_red(y0 + y2, p2);
+    a[2*m] = _ntt_red(y0 - y2 + p2, p2);
+    a[m] = _ntt_red(y1 - t + p2, p2);
+    a[3*m] = _ntt_red(y1 + t, p2);
+
+    for (j = 1; j < m; j++)
+    {
+        w1 -= s1;
+        w2 -= s2;
+        w3 -= s1;
+
+        x0 = a[j];
+        x1 = a[j + m];
+        x2 = a[j + 2*m];
+        x3 = a[j + 3*m];
+
+        t = _ntt_mul(x1, w2, p);
+        y0 = _ntt_red(x0 - t + p2, p2);
+        y1 = _ntt_red(x0 + t, p2);
+        t = _ntt_mul(x3, w2, p);
+        y2 = _ntt_red(x2 - t + p2, p2);
+        y3 = _ntt_red(x2 + t, p2);
+
+        t = _ntt_mul(y2, w1, p);
+        a[j] = _ntt_red(y0 - t + p2, p2);
+        a[j + 2*m] = _ntt_red(y0 + t, p2);
+        t = _ntt_mul(y3, w3, p);
+        a[j + m] = _ntt_red(y1 - t + p2, p2);
+        a[j + 3*m] = _ntt_red(y1 + t, p2);
+    }
+}
+
+static void
+_ntt_ifft_basecase(mp_ptr a, slong depth, const nmod_poly_ntt_t ntt)
+{
+    slong i, k;
+
+    for (k = 2; k <= depth; k += 2)
+        for (i = 0; i < (WORD(1) << depth); i += (WORD(1) << k))
+            _ntt_ifft_radix4(a + i, k - 2, ntt);
+
+    if (depth & 1)
+        _ntt_ifft_radix2(a, depth - 1, ntt);
+}
+
+static void
+_ntt_ifft_recursive(mp_ptr a, slong depth, const nmod_poly_ntt_t ntt)
+{
+    slong i;
+
+    if (depth <= NTT_IFFT_BASE_DEPTH)
+    {
+        _ntt_ifft_basecase(a, depth, ntt);
+    }
+    else if (depth & 1)
+    {
+        for (i = 0; i < 2; i++)
+            _ntt_ifft_recursive(a + (i << (depth - 1)), depth - 1, ntt);
+
+        _ntt_ifft_radix2(a, depth - 1, ntt);
+    }
+    else
+    {
+        for (i = 0; i < 4; i++)
+            _ntt_ifft_recursive(a + (i << (depth - 2)), depth - 2, ntt);
+
+        _ntt_ifft_radix4(a, depth - 2, ntt);
+    }
+}
+
+void _nmod_poly_ntt_ifft(mp_ptr a, slong depth, const nmod_poly_ntt_t ntt)
+{
+    _ntt_ifft_recursive(a, depth, ntt);
+}
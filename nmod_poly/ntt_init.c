@@ -0,0 +1,180 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_poly.h"
+
+#if FLINT_REENTRANT && !HAVE_TLS
+#include <pthread.h>
+
+static pthread_once_t ntt_initialised = PTHREAD_ONCE_INIT;
+static pthread_mutex_t ntt_lock;
+#endif
+
+/*
+   Primes p = c 2^k + 1 between 2^(FLINT_BITS - 3) and 2^(FLINT_BITS - 2),
+   with k >= NMOD_POLY_NTT_MAX_DEPTH, and for each a root of unity of
+   order 2^NMOD_POLY_NTT_MAX_DEPTH.
+*/
+#if FLINT64
+static const mp_limb_t _ntt_primes[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(0x3a00000000000001), UWORD(0x2c40000000000001),
+    UWORD(0x2280000000000001)
+};
+
+static const mp_limb_t _ntt_roots[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(0x0fc262fd21039b12), UWORD(0x2a671570b78e304e),
+    UWORD(0x15e5793067f742e7)
+};
+#else
+static const mp_limb_t _ntt_primes[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(0x2d000001), UWORD(0x3b800001), UWORD(0x35800001)
+};
+
+static const mp_limb_t _ntt_roots[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(0x15a54e13), UWORD(0x00e9a248), UWORD(0x340422f0)
+};
+#endif
+
+/* _ntt_cache[i][k] holds level k of the twiddles for the i-th prime */
+static FLINT_TLS_PREFIX mp_ptr _ntt_cache[NMOD_POLY_NTT_NUM_PRIMES]
+                                             [NMOD_POLY_NTT_CACHE_DEPTH];
+static FLINT_TLS_PREFIX slong _ntt_cache_depth = 0;
+
+/* Sets tab to the len powers of w modulo p, with their Shoup quotients */
+static void
+_ntt_fill_tab(mp_ptr tab, slong len, mp_limb_t w, mp_limb_t p)
+{
+    mp_limb_t x, wpre;
+    slong j;
+
+    wpre = n_mulmod_precomp_shoup(w, p);
+
+    x = 1;
+    for (j = 0; j < len; j++)
+    {
+        tab[2*j] = x;
+        tab[2*j + 1] = n_mulmod_precomp_shoup(x, p);
+        x = n_mulmod_shoup(w, x, wpre, p);
+    }
+}
+
+/* Root of unity of order 2^k modulo the i-th prime */
+static mp_limb_t
+_ntt_root(slong i, slong k)
+{
+    mp_limb_t w = _ntt_roots[i];
+    mp_limb_t p = _ntt_primes[i];
+    mp_limb_t pinv = n_preinvert_limb(p);
+    slong j;
+
+    for (j = k; j < NMOD_POLY_NTT_MAX_DEPTH; j++)
+        w = n_mulmod2_preinv(w, w, p, pinv);
+
+    return w;
+}
+
+static void
+_ntt_cleanup(void)
+{
+    slong i, k;
+
+    for (i = 0; i < NMOD_POLY_NTT_NUM_PRIMES; i++)
+        for (k = 0; k < _ntt_cache_depth; k++)
+            flint_free(_ntt_cache[i][k]);
+
+    _ntt_cache_depth = 0;
+}
+
+#if FLINT_REENTRANT && !HAVE_TLS
+static void _ntt_lock_init(void)
+{
+    pthread_mutex_init(&ntt_lock, NULL);
+}
+#endif
+
+void nmod_poly_ntt_init(nmod_poly_ntt_t ntt, slong i, slong depth)
+{
+    slong k, cached = FLINT_MIN(depth, NMOD_POLY_NTT_CACHE_DEPTH);
+
+    if (depth > NMOD_POLY_NTT_MAX_DEPTH)
+    {
+        flint_printf("Exception (nmod_poly_ntt_init). Depth too large.\n");
+        abort();
+    }
+
+    ntt->p = _ntt_primes[i];
+    ntt->pinv = n_preinvert_limb(ntt->p);
+    ntt->depth = depth;
+
+#if FLINT_REENTRANT && !HAVE_TLS
+    pthread_once(&ntt_initialised, _ntt_lock_init);
+    pthread_mutex_lock(&ntt_lock);
+#endif
+
+    if (_ntt_cache_depth == 0 && cached > 0)
+        flint_register_cleanup_function(_ntt_cleanup);
+
+    for ( ; _ntt_cache_depth < cached; _ntt_cache_depth++)
+    {
+        slong j;
+
+        k = _ntt_cache_depth;
+
+        for (j = 0; j < NMOD_POLY_NTT_NUM_PRIMES; j++)
+        {
+            _ntt_cache[j][k] = flint_malloc(sizeof(mp_limb_t) << (k + 1));
+            _ntt_fill_tab(_ntt_cache[j][k], WORD(1) << k,
+                                         _ntt_root(j, k + 1), _ntt_primes[j]);
+        }
+    }
+
+    for (k = 0; k < cached; k++)
+    {
+        ntt->tab[k] = _ntt_cache[i][k];
+        ntt->step[k] = 2;
+    }
+
+#if FLINT_REENTRANT && !HAVE_TLS
+    pthread_mutex_unlock(&ntt_lock);
+#endif
+
+    if (depth > NMOD_POLY_NTT_CACHE_DEPTH)
+    {
+        ntt->top = flint_malloc(sizeof(mp_limb_t) << depth);
+        _ntt_fill_tab(ntt->top, WORD(1) << (depth - 1),
+                                             _ntt_root(i, depth), ntt->p);
+
+        for ( ; k < depth; k++)
+        {
+            ntt->tab[k] = ntt->top;
+            ntt->step[k] = WORD(2) << (depth - 1 - k);
+        }
+    }
+    else
+        ntt->top = NULL;
+}
@@ -0,0 +1,47 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_ntt_mul(mp_ptr a, mp_srcptr b, slong len,
+                                                 const nmod_poly_ntt_t ntt)
+{
+    const mp_limb_t p = ntt->p;
+    mp_limb_t x, y, hi, lo;
+    nmod_t mod;
+    slong i;
+
+    mod.n = p;
+    mod.ninv = ntt->pinv;
+    count_leading_zeros(mod.norm, p);
+
+    for (i = 0; i < len; i++)
+    {
+        x = a[i];
+        y = b[i];
+        x = (x >= p) ? x - p : x;
+        y = (y >= p) ? y - p : y;
+        umul_ppmm(hi, lo, x, y);
+        NMOD_RED2(a[i], hi, lo, mod);
+    }
+}
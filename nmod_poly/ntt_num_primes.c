@@ -0,0 +1,34 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+
+slong _nmod_poly_ntt_num_primes(slong len, nmod_t mod)
+{
+    slong bits;
+
+    /* the coefficients of the product are less than len (n - 1)^2 */
+    bits = 2 * FLINT_BIT_COUNT(mod.n - 1) + FLINT_BIT_COUNT(len);
+    bits = (bits + FLINT_BITS - 4) / (FLINT_BITS - 3);
+
+    return (bits <= NMOD_POLY_NTT_NUM_PRIMES) ? FLINT_MAX(bits, 1) : 0;
+}
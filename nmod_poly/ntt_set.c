@@ -0,0 +1,43 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_ntt_set(mp_ptr a, mp_srcptr poly, slong len,
+                                     const nmod_poly_ntt_t ntt, nmod_t mod)
+{
+    const mp_limb_t p2 = 2 * ntt->p, p4 = 4 * ntt->p;
+    mp_limb_t x;
+    slong i;
+
+    if (mod.n <= p2)
+        flint_mpn_copyi(a, poly, len);
+    else
+    {
+        for (i = 0; i < len; i++)
+        {
+            x = poly[i];
+            x = (x >= p4) ? x - p4 : x;
+            a[i] = (x >= p2) ? x - p2 : x;
+        }
+    }
+}
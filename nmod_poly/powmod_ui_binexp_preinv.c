@@ -47,8 +47,8 @@ _nmod_poly_powmod_ui_binexp_preinv (mp_ptr res, mp_srcptr poly,
                                     ulong e, mp_srcptr f, slong lenf,
                                     mp_srcptr finv, slong lenfinv, nmod_t mod)
 {
-    mp_ptr T, Q;
-    slong lenT, lenQ;
+    nmod_poly_modulus_t M;
+    mp_ptr phat;
     int i;
 
     if (lenf == 2)
@@ -57,29 +57,22 @@ _nmod_poly_powmod_ui_binexp_preinv (mp_ptr res, mp_srcptr poly,
         return;
     }
 
-    lenT = 2 * lenf - 3;
-    lenQ = FLINT_MAX(lenT - lenf + 1, 1);
-
-    T = _nmod_vec_init(lenT + lenQ);
-    Q = T + lenT;
+    _nmod_poly_modulus_init(M, f, lenf, finv, lenfinv, mod);
+    phat = flint_malloc(M->fft_len * sizeof(mp_limb_t));
+    _nmod_poly_modulus_fft(phat, poly, lenf - 1, M);
 
     _nmod_vec_set(res, poly, lenf - 1);
 
     for (i = ((int) FLINT_BIT_COUNT(e) - 2); i >= 0; i--)
     {
-        _nmod_poly_mul(T, res, lenf - 1, res, lenf - 1, mod);
-        _nmod_poly_divrem_newton_n_preinv(Q, res, T, 2 * lenf - 3, f,
-                                          lenf, finv, lenfinv, mod);
+        _nmod_poly_mulmod_modulus(res, res, lenf - 1, res, lenf - 1, M);
 
         if (e & (UWORD(1) << i))
-        {
-            _nmod_poly_mul(T, res, lenf - 1, poly, lenf - 1, mod);
-            _nmod_poly_divrem_newton_n_preinv(Q, res, T, 2 * lenf - 3, f,
-                                              lenf, finv, lenfinv, mod);
-        }
+            _nmod_poly_mulmod_modulus_fft(res, res, lenf - 1, phat, M);
     }
 
-    _nmod_vec_clear(T);
+    flint_free(phat);
+    nmod_poly_modulus_clear(M);
 }
 
 
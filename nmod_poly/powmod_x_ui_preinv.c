@@ -47,6 +47,7 @@ void
 _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
                                mp_srcptr finv, slong lenfinv, nmod_t mod)
 {
+    nmod_poly_modulus_t M;
     mp_ptr T, Q;
     slong lenT, lenQ, window;
     int i, l, c;
@@ -57,6 +58,8 @@ _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
     T = _nmod_vec_init(lenT + lenQ);
     Q = T + lenT;
 
+    _nmod_poly_modulus_init(M, f, lenf, finv, lenfinv, mod);
+
     flint_mpn_zero (res, lenf - 1);
     res[0] = WORD(1);
 
@@ -76,17 +79,14 @@ _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
     if (c == 0)
     {
         _nmod_poly_shift_left(T, res, lenf - 1, window);
-        _nmod_poly_divrem_newton_n_preinv(Q, res, T, lenf - 1 + window, f,
-                                          lenf, finv, lenfinv, mod);
+        _nmod_poly_divrem_modulus(Q, res, T, lenf - 1 + window, M);
         c = l + 1;
         window= WORD(0);
     }
 
     for (; i >= 0; i--)
     {
-        _nmod_poly_mul(T, res, lenf - 1, res, lenf - 1, mod);
-        _nmod_poly_divrem_newton_n_preinv(Q, res, T, 2 * lenf - 3, f,
-                                          lenf, finv, lenfinv, mod);
+        _nmod_poly_mulmod_modulus(res, res, lenf - 1, res, lenf - 1, M);
 
         c--;
         if (e & (UWORD(1) << i))
@@ -101,14 +101,14 @@ _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
         if (c == 0)
         {
             _nmod_poly_shift_left(T, res, lenf - 1, window);
-            _nmod_poly_divrem_newton_n_preinv(Q, res, T, lenf - 1 + window, f,
-                                              lenf, finv, lenfinv, mod);
+            _nmod_poly_divrem_modulus(Q, res, T, lenf - 1 + window, M);
 
             c= l + 1;
             window= WORD(0);
         }
     }
 
+    nmod_poly_modulus_clear(M);
     _nmod_vec_clear(T);
 }
 
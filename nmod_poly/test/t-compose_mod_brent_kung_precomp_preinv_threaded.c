@@ -33,11 +33,11 @@
 #undef ulong
 
 #include <gmp.h>
-#include <pthread.h>
 
 #define ulong mp_limb_t
 
 #include "flint.h"
+#include "thread_pool.h"
 #include "nmod_poly.h"
 #include "ulong_extras.h"
 
@@ -56,15 +56,15 @@ main(void)
         nmod_poly_t a, b, c, cinv, *tmp;
         nmod_mat_t B, *C;
         mp_limb_t m = n_randtest_prime(state, 0);
-        slong j, num_threads;
+        slong j, num_threads, num_workers;
         nmod_poly_matrix_precompute_arg_t * args1;
-        pthread_t *threads;
+        thread_pool_handle * threads;
 
         flint_set_num_threads(1 + n_randint(state, 3));
 
         num_threads = flint_get_num_threads();
 
-        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        num_workers = flint_request_threads(&threads, num_threads);
         tmp = flint_malloc(sizeof(nmod_poly_t) * num_threads);
 
         nmod_poly_init(a, m);
@@ -108,11 +108,14 @@ main(void)
             args1[j].poly2    = *c;
             args1[j].poly2inv = *cinv;
 
-            pthread_create(&threads[j], NULL,
-                           _nmod_poly_precompute_matrix_worker, &args1[j]);
+            if (j < num_workers)
+                thread_pool_wake(global_thread_pool, threads[j], 0,
+                                 _nmod_poly_precompute_matrix_worker, &args1[j]);
+            else
+                _nmod_poly_precompute_matrix_worker(&args1[j]);
         }
-        for (j = 0; j < num_threads; j++)
-            pthread_join(threads[j], NULL);
+        for (j = 0; j < num_workers; j++)
+            thread_pool_wait(global_thread_pool, threads[j]);
 
         for (j = 0; j < num_threads; j++)
         {
@@ -141,7 +144,7 @@ main(void)
         flint_free(C);
         flint_free(tmp);
         flint_free(args1);
-        flint_free(threads);
+        flint_give_back_threads(threads, num_workers);
     }
 
     /* check composition */
@@ -150,15 +153,15 @@ main(void)
         nmod_poly_t a, b, c, cinv, d, *res;
         nmod_mat_t B;
         mp_limb_t m = n_randtest_prime(state, 0);
-        slong j, num_threads;
+        slong j, num_threads, num_workers;
         nmod_poly_compose_mod_precomp_preinv_arg_t * args1;
-        pthread_t *threads;
+        thread_pool_handle * threads;
 
         flint_set_num_threads(1 + n_randint(state, 3));
 
         num_threads = flint_get_num_threads();
 
-        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        num_workers = flint_request_threads(&threads, num_threads);
         res = flint_malloc(sizeof(nmod_poly_t) * num_threads);
 
         nmod_poly_init(a, m);
@@ -199,12 +202,16 @@ main(void)
             args1[j].poly3    = *c;
             args1[j].poly3inv = *cinv;
 
-            pthread_create(&threads[j], NULL,
-                           _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker, &args1[j]);
+            if (j < num_workers)
+                thread_pool_wake(global_thread_pool, threads[j], 0,
+                                 _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker, &args1[j]);
+            else
+                _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker(&args1[j]);
         }
         for (j = 0; j < num_threads; j++)
         {
-            pthread_join(threads[j], NULL);
+            if (j < num_workers)
+                thread_pool_wait(global_thread_pool, threads[j]);
             _nmod_poly_normalise(res[j]);
         }
 
@@ -232,7 +239,7 @@ main(void)
             nmod_poly_clear(res[j]);
         flint_free(res);
         flint_free(args1);
-        flint_free(threads);
+        flint_give_back_threads(threads, num_workers);
     }
 
     FLINT_TEST_CLEANUP(state);
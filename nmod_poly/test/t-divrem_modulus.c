@@ -0,0 +1,116 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("divrem_modulus....");
+    fflush(stdout);
+
+    /* Compare with divrem, with transforms from small lengths on */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, f, finv, q1, r1, q2, r2;
+        nmod_poly_modulus_t M;
+        mp_limb_t n = n_randtest_prime(state, 0);
+        slong lenf;
+
+        flint_tune_set(FLINT_TUNE_NMOD_POLY_MUL_NTT, (i % 2) ? 0
+                       : flint_tune_default(FLINT_TUNE_NMOD_POLY_MUL_NTT));
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(f, n);
+        nmod_poly_init(finv, n);
+        nmod_poly_init(q1, n);
+        nmod_poly_init(r1, n);
+        nmod_poly_init(q2, n);
+        nmod_poly_init(r2, n);
+
+        lenf = 2 + n_randint(state, 600);
+        do {
+            nmod_poly_randtest(f, state, lenf);
+        } while (f->length < 2);
+
+        nmod_poly_randtest(a, state,
+                           n_randint(state, 2 * f->length - 1));
+
+        nmod_poly_reverse(finv, f, f->length);
+        nmod_poly_inv_series(finv, finv, f->length);
+
+        nmod_poly_modulus_init(M, f, finv);
+
+        nmod_poly_divrem(q1, r1, a, f);
+        nmod_poly_divrem_modulus(q2, r2, a, M);
+
+        result = (nmod_poly_equal(q1, q2) && nmod_poly_equal(r1, r2));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("a:\n"); nmod_poly_print(a), flint_printf("\n\n");
+            flint_printf("f:\n"); nmod_poly_print(f), flint_printf("\n\n");
+            flint_printf("q1:\n"); nmod_poly_print(q1), flint_printf("\n\n");
+            flint_printf("r1:\n"); nmod_poly_print(r1), flint_printf("\n\n");
+            flint_printf("q2:\n"); nmod_poly_print(q2), flint_printf("\n\n");
+            flint_printf("r2:\n"); nmod_poly_print(r2), flint_printf("\n\n");
+            abort();
+        }
+
+        /* Aliasing of the quotient and the input */
+        nmod_poly_divrem_modulus(a, r2, a, M);
+
+        result = (nmod_poly_equal(q1, a) && nmod_poly_equal(r1, r2));
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing):\n");
+            flint_printf("f:\n"); nmod_poly_print(f), flint_printf("\n\n");
+            flint_printf("q1:\n"); nmod_poly_print(q1), flint_printf("\n\n");
+            flint_printf("a:\n"); nmod_poly_print(a), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_modulus_clear(M);
+        nmod_poly_clear(a);
+        nmod_poly_clear(f);
+        nmod_poly_clear(finv);
+        nmod_poly_clear(q1);
+        nmod_poly_clear(r1);
+        nmod_poly_clear(q2);
+        nmod_poly_clear(r2);
+    }
+
+    flint_tune_set(FLINT_TUNE_NMOD_POLY_MUL_NTT,
+                   flint_tune_default(FLINT_TUNE_NMOD_POLY_MUL_NTT));
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mulmid....");
+    fflush(stdout);
+
+    /* Compare with the full product */
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c, d;
+        mp_limb_t n = n_randtest_not_zero(state);
+        slong len1, len2;
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_init(d, n);
+
+        len2 = 1 + n_randint(state, 1000);
+        len1 = len2 + n_randint(state, 1000);
+
+        nmod_poly_randtest(a, state, len1);
+        nmod_poly_randtest(b, state, len2);
+        a->length = len1;
+        b->length = len2;
+        a->coeffs[len1 - 1] = b->coeffs[len2 - 1] = 1 % n;
+
+        nmod_poly_mul(c, a, b);
+        nmod_poly_shift_right(c, c, len2 - 1);
+        nmod_poly_truncate(c, len1 - len2 + 1);
+
+        if (n_randint(state, 2))
+            nmod_poly_mulmid(d, a, b);
+        else
+        {
+            nmod_poly_fit_length(d, len1 - len2 + 1);
+            _nmod_poly_mulmid_NTT(d->coeffs, a->coeffs, len1,
+                                             b->coeffs, len2, a->mod);
+            d->length = len1 - len2 + 1;
+            _nmod_poly_normalise(d);
+        }
+
+        result = (nmod_poly_equal(c, d));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("a:\n"); nmod_poly_print(a), flint_printf("\n\n");
+            flint_printf("b:\n"); nmod_poly_print(b), flint_printf("\n\n");
+            flint_printf("c:\n"); nmod_poly_print(c), flint_printf("\n\n");
+            flint_printf("d:\n"); nmod_poly_print(d), flint_printf("\n\n");
+            abort();
+        }
+
+        /* Aliasing */
+        nmod_poly_mulmid(a, a, b);
+
+        result = (nmod_poly_equal(a, d));
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing):\n");
+            flint_printf("a:\n"); nmod_poly_print(a), flint_printf("\n\n");
+            flint_printf("d:\n"); nmod_poly_print(d), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+        nmod_poly_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,206 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mulmod_modulus....");
+    fflush(stdout);
+
+    /* Compare with mulmod, with transforms from small lengths on */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c, d, f, finv;
+        nmod_poly_modulus_t M;
+        mp_limb_t n = n_randtest_prime(state, 0);
+        slong lenf;
+
+        flint_tune_set(FLINT_TUNE_NMOD_POLY_MUL_NTT, (i % 2) ? 0
+                       : flint_tune_default(FLINT_TUNE_NMOD_POLY_MUL_NTT));
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_init(d, n);
+        nmod_poly_init(f, n);
+        nmod_poly_init(finv, n);
+
+        lenf = 2 + n_randint(state, 600);
+        do {
+            nmod_poly_randtest(f, state, lenf);
+        } while (f->length < 2);
+
+        nmod_poly_randtest(a, state, n_randint(state, f->length));
+        nmod_poly_randtest(b, state, n_randint(state, f->length));
+        if (n_randint(state, 4) == 0)
+            nmod_poly_set(b, a);
+
+        nmod_poly_reverse(finv, f, f->length);
+        nmod_poly_inv_series(finv, finv, f->length);
+
+        nmod_poly_modulus_init(M, f, finv);
+
+        nmod_poly_mulmod(c, a, b, f);
+        nmod_poly_mulmod_modulus(d, a, b, M);
+
+        result = (nmod_poly_equal(c, d));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("a:\n"); nmod_poly_print(a), flint_printf("\n\n");
+            flint_printf("b:\n"); nmod_poly_print(b), flint_printf("\n\n");
+            flint_printf("f:\n"); nmod_poly_print(f), flint_printf("\n\n");
+            flint_printf("c:\n"); nmod_poly_print(c), flint_printf("\n\n");
+            flint_printf("d:\n"); nmod_poly_print(d), flint_printf("\n\n");
+            abort();
+        }
+
+        /* with a transformed second factor, aliasing a */
+        if (a->length != 0)
+        {
+            mp_ptr bhat, bb;
+
+            bhat = flint_malloc(M->fft_len * sizeof(mp_limb_t));
+            bb = _nmod_vec_init(f->length - 1);
+            _nmod_vec_zero(bb, f->length - 1);
+            _nmod_vec_set(bb, b->coeffs, b->length);
+            _nmod_poly_modulus_fft(bhat, bb, f->length - 1, M);
+
+            nmod_poly_fit_length(a, f->length - 1);
+            _nmod_poly_mulmod_modulus_fft(a->coeffs, a->coeffs, a->length,
+                                                                  bhat, M);
+            a->length = f->length - 1;
+            _nmod_poly_normalise(a);
+
+            result = (nmod_poly_equal(a, c));
+            if (!result)
+            {
+                flint_printf("FAIL (transformed):\n");
+                flint_printf("a:\n"); nmod_poly_print(a), flint_printf("\n\n");
+                flint_printf("b:\n"); nmod_poly_print(b), flint_printf("\n\n");
+                flint_printf("f:\n"); nmod_poly_print(f), flint_printf("\n\n");
+                flint_printf("c:\n"); nmod_poly_print(c), flint_printf("\n\n");
+                abort();
+            }
+
+            flint_free(bhat);
+            _nmod_vec_clear(bb);
+        }
+
+        nmod_poly_modulus_clear(M);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+        nmod_poly_clear(d);
+        nmod_poly_clear(f);
+        nmod_poly_clear(finv);
+    }
+
+    /* Very short first factor, the output filled with garbage first */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c, f, finv;
+        nmod_poly_modulus_t M;
+        mp_limb_t n = n_randtest_prime(state, 0);
+        mp_ptr bhat, bb, res;
+        slong j, lenf;
+
+        flint_tune_set(FLINT_TUNE_NMOD_POLY_MUL_NTT, 0);
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_init(f, n);
+        nmod_poly_init(finv, n);
+
+        lenf = 2 + n_randint(state, 100);
+        do {
+            nmod_poly_randtest(f, state, lenf);
+        } while (f->length < 2);
+
+        nmod_poly_randtest(a, state, FLINT_MIN(n_randint(state, 3),
+                                                        f->length - 1));
+        nmod_poly_randtest(b, state, n_randint(state, f->length));
+
+        nmod_poly_reverse(finv, f, f->length);
+        nmod_poly_inv_series(finv, finv, f->length);
+
+        nmod_poly_modulus_init(M, f, finv);
+
+        nmod_poly_mulmod(c, a, b, f);
+
+        bhat = flint_malloc(M->fft_len * sizeof(mp_limb_t));
+        bb = _nmod_vec_init(f->length - 1);
+        res = _nmod_vec_init(f->length - 1);
+        _nmod_vec_zero(bb, f->length - 1);
+        _nmod_vec_set(bb, b->coeffs, b->length);
+        for (j = 0; j < f->length - 1; j++)
+            res[j] = n_randint(state, n);
+
+        _nmod_poly_modulus_fft(bhat, bb, f->length - 1, M);
+        _nmod_poly_mulmod_modulus_fft(res, a->coeffs, a->length, bhat, M);
+
+        nmod_poly_fit_length(a, f->length - 1);
+        _nmod_vec_set(a->coeffs, res, f->length - 1);
+        a->length = f->length - 1;
+        _nmod_poly_normalise(a);
+
+        result = (nmod_poly_equal(a, c));
+        if (!result)
+        {
+            flint_printf("FAIL (short):\n");
+            flint_printf("a:\n"); nmod_poly_print(a), flint_printf("\n\n");
+            flint_printf("b:\n"); nmod_poly_print(b), flint_printf("\n\n");
+            flint_printf("f:\n"); nmod_poly_print(f), flint_printf("\n\n");
+            flint_printf("c:\n"); nmod_poly_print(c), flint_printf("\n\n");
+            abort();
+        }
+
+        flint_free(bhat);
+        _nmod_vec_clear(bb);
+        _nmod_vec_clear(res);
+
+        nmod_poly_modulus_clear(M);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+        nmod_poly_clear(f);
+        nmod_poly_clear(finv);
+    }
+
+    flint_tune_set(FLINT_TUNE_NMOD_POLY_MUL_NTT,
+                   flint_tune_default(FLINT_TUNE_NMOD_POLY_MUL_NTT));
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
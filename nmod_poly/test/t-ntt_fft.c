@@ -0,0 +1,160 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("ntt_fft....");
+    fflush(stdout);
+
+    /* Check the inverse transform and transforms of truncated input */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_ntt_t ntt;
+        mp_ptr a, b, c;
+        mp_limb_t p, s;
+        slong j, len, depth, k = n_randint(state, NMOD_POLY_NTT_NUM_PRIMES);
+
+        if (n_randint(state, 20) == 0)
+            depth = NMOD_POLY_NTT_CACHE_DEPTH + 1;
+        else
+            depth = n_randint(state, 13);
+
+        len = n_randint(state, WORD(1) << depth) + 1;
+
+        nmod_poly_ntt_init(ntt, k, depth);
+        p = ntt->p;
+
+        a = _nmod_vec_init(WORD(1) << depth);
+        b = _nmod_vec_init(WORD(1) << depth);
+        c = _nmod_vec_init(WORD(1) << depth);
+
+        for (j = 0; j < len; j++)
+            a[j] = n_randint(state, 2 * p);
+        for (j = len; j < (WORD(1) << depth); j++)
+            a[j] = 0;
+
+        _nmod_vec_set(b, a, WORD(1) << depth);
+        _nmod_vec_set(c, a, len);
+
+        _nmod_poly_ntt_fft(b, WORD(1) << depth, depth, ntt);
+        _nmod_poly_ntt_fft(c, len, depth, ntt);
+        _nmod_poly_ntt_ifft(c, depth, ntt);
+        _nmod_poly_ntt_ifft(b, depth, ntt);
+
+        s = n_powmod2_preinv(2, depth, p, ntt->pinv);
+
+        result = 1;
+        for (j = 0; j < (WORD(1) << depth) && result; j++)
+        {
+            result = (b[j] < 2 * p) && (c[j] < 2 * p)
+                && (b[j] % p == c[j] % p)
+                && (b[j] % p == n_mulmod2_preinv(a[j], s, p, ntt->pinv));
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("p = %wu, depth = %wd, len = %wd, j = %wd\n",
+                                                      p, depth, len, j - 1);
+            abort();
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(c);
+
+        nmod_poly_ntt_clear(ntt);
+    }
+
+    /* Check that the transform evaluates at roots of unity */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_ntt_t ntt;
+        mp_ptr a, b;
+        mp_limb_t p, w, x, y;
+        slong j, len, depth, k = n_randint(state, NMOD_POLY_NTT_NUM_PRIMES);
+
+        depth = n_randint(state, 7);
+        len = n_randint(state, WORD(1) << depth) + 1;
+
+        nmod_poly_ntt_init(ntt, k, depth);
+        p = ntt->p;
+
+        a = _nmod_vec_init(WORD(1) << depth);
+        b = _nmod_vec_init(WORD(1) << depth);
+
+        for (j = 0; j < len; j++)
+            a[j] = n_randint(state, p);
+
+        _nmod_vec_set(b, a, len);
+        _nmod_poly_ntt_fft(b, len, depth, ntt);
+
+        /* the value at w^j is in position j with its bits reversed */
+        if (depth == 0)
+            w = 1;
+        else if (depth == 1)
+            w = p - 1;
+        else
+            w = ntt->tab[depth - 1][ntt->step[depth - 1]];
+
+        result = 1;
+        for (x = 1, j = 0; j < (WORD(1) << depth) && result; j++)
+        {
+            slong l;
+
+            y = 0;
+            for (l = len - 1; l >= 0; l--)
+                y = n_addmod(n_mulmod2_preinv(y, x, p, ntt->pinv), a[l], p);
+
+            result = (b[n_revbin(j, depth)] % p == y);
+            x = n_mulmod2_preinv(x, w, p, ntt->pinv);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL (evaluation):\n");
+            flint_printf("p = %wu, depth = %wd, len = %wd, j = %wd\n",
+                                                      p, depth, len, j - 1);
+            abort();
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+
+        nmod_poly_ntt_clear(ntt);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -28,7 +28,6 @@
 #define ulong ulongxx/* interferes with system includes */
 
 #include <math.h>
-#include <pthread.h>
 
 #undef ulong
 
@@ -36,9 +35,10 @@
 
 #define ulong mp_limb_t
 
+#include "thread_pool.h"
 #include "nmod_poly.h"
 
-void *
+void
 _nmod_poly_interval_poly_worker(void* arg_ptr)
 {
     nmod_poly_interval_poly_arg_t arg =
@@ -68,8 +68,6 @@ _nmod_poly_interval_poly_worker(void* arg_ptr)
     }
 
     _nmod_vec_clear(tmp);
-    flint_cleanup();
-    return NULL;
 }
 
 void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
@@ -78,10 +76,10 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
     nmod_poly_t f, g, v, vinv, tmp, II;
     nmod_poly_t *h, *H, *I, *scratch;
     slong i, j, k, l, m, n, index, d, c1 = 1, c2;
-    slong num_threads = flint_get_num_threads();
+    slong num_threads, num_workers;
     nmod_mat_t * HH;
     double beta;
-    pthread_t *threads;
+    thread_pool_handle * threads;
     nmod_poly_matrix_precompute_arg_t * args1;
     nmod_poly_compose_mod_precomp_preinv_arg_t * args2;
     nmod_poly_interval_poly_arg_t * args3;
@@ -108,6 +106,9 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
     nmod_poly_init_preinv(tmp, poly->mod.n, poly->mod.ninv);
     nmod_poly_init_preinv(II, poly->mod.n, poly->mod.ninv);
 
+    num_workers = flint_request_threads(&threads, flint_get_num_threads());
+    num_threads = num_workers + 1;
+
     if (!(h = flint_malloc((2 * m + l + 1 + num_threads) *
                            sizeof(nmod_poly_struct))))
     {
@@ -129,7 +130,6 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
         nmod_poly_init_preinv(scratch[i], poly->mod.n, poly->mod.ninv);
 
     HH      = flint_malloc(sizeof(nmod_mat_t) * (num_threads + 1));
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
     args1   = flint_malloc(num_threads *
                            sizeof(nmod_poly_matrix_precompute_arg_t));
     args2   = flint_malloc(num_threads *
@@ -248,11 +248,11 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
                 args1[i].poly2    = *v;
                 args1[i].poly2inv = *vinv;
 
-                pthread_create(&threads[i], NULL,
+                thread_pool_wake(global_thread_pool, threads[i - 1], 0,
                             _nmod_poly_precompute_matrix_worker, &args1[i]);
             }
             for (i = 1; i < c1; i++)
-                pthread_join(threads[i], NULL);
+                thread_pool_wait(global_thread_pool, threads[i - 1]);
 
             nmod_poly_rem(tmp, H[num_threads - 1], v);
             for (i = 0; i < c1; i++)
@@ -266,12 +266,16 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
                 args2[i].poly3    = *v;
                 args2[i].poly3inv = *vinv;
 
-                pthread_create(&threads[i], NULL,
+                if (i > 0)
+                    thread_pool_wake(global_thread_pool, threads[i - 1], 0,
         _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker, &args2[i]);
             }
+
+            _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker(&args2[0]);
             for (i = 0; i < c1; i++)
             {
-                pthread_join(threads[i], NULL);
+                if (i > 0)
+                    thread_pool_wait(global_thread_pool, threads[i - 1]);
                 _nmod_poly_normalise(H[num_threads + i]);
             }
 
@@ -287,13 +291,17 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
                 args3[i].v    = *v;
                 args3[i].vinv = *vinv;
 
-                pthread_create(&threads[i], NULL,
+                if (i > 0)
+                    thread_pool_wake(global_thread_pool, threads[i - 1], 0,
                                _nmod_poly_interval_poly_worker, &args3[i]);
             }
 
+            _nmod_poly_interval_poly_worker(&args3[0]);
+
             for (i = 0; i < c1; i++)
             {
-                pthread_join(threads[i], NULL);
+                if (i > 0)
+                    thread_pool_wait(global_thread_pool, threads[i - 1]);
                 _nmod_poly_normalise(I[num_threads + i]);
             }
 
@@ -354,12 +362,16 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
                 args2[i].poly3    = *v;
                 args2[i].poly3inv = *vinv;
 
-                pthread_create(&threads[i], NULL,
+                if (i > 0)
+                    thread_pool_wake(global_thread_pool, threads[i - 1], 0,
         _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker, &args2[i]);
             }
+
+            _nmod_poly_compose_mod_brent_kung_precomp_preinv_worker(&args2[0]);
             for (i = 0; i < c2; i++)
             {
-                pthread_join(threads[i], NULL);
+                if (i > 0)
+                    thread_pool_wait(global_thread_pool, threads[i - 1]);
                 _nmod_poly_normalise(H[j * num_threads + i]);
             }
 
@@ -376,13 +388,17 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
                 args3[i].v    = *v;
                 args3[i].vinv = *vinv;
 
-                pthread_create(&threads[i], NULL,
+                if (i > 0)
+                    thread_pool_wake(global_thread_pool, threads[i - 1], 0,
                                _nmod_poly_interval_poly_worker, &args3[i]);
             }
 
+            _nmod_poly_interval_poly_worker(&args3[0]);
+
             for (i = 0; i < c2; i++)
             {
-                pthread_join(threads[i], NULL);
+                if (i > 0)
+                    thread_pool_wait(global_thread_pool, threads[i - 1]);
                 _nmod_poly_normalise(I[j * num_threads + i]);
             }
 
@@ -477,5 +493,5 @@ void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
     flint_free(args1);
     flint_free(args2);
     flint_free(args3);
-    flint_free(threads);
+    flint_give_back_threads(threads, num_workers);
 }
@@ -28,7 +28,6 @@
 
 #include <stdlib.h>
 #include <stdio.h>
-#include <pthread.h>
 
 #undef ulong
 
@@ -36,6 +35,7 @@
 
 #define ulong mp_limb_t
 
+#include "thread_pool.h"
 #include "nmod_poly.h"
 #include "ulong_extras.h"
 
@@ -53,16 +53,16 @@ main(void)
     {
         nmod_poly_t a, b, c, cinv, d, *e, * tmp;
         mp_limb_t modulus;
-        slong j, num_threads, l;
+        slong j, num_threads, num_workers, l;
         nmod_poly_interval_poly_arg_t * args1;
-        pthread_t *threads;
+        thread_pool_handle * threads;
 
         flint_set_num_threads(1 + n_randint(state, 3));
 
         num_threads = flint_get_num_threads();
 
         l = n_randint(state, 20) + 1;
-        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        num_workers = flint_request_threads(&threads, num_threads);
         e = flint_malloc(sizeof(nmod_poly_struct) * num_threads);
         tmp = flint_malloc(sizeof(nmod_poly_struct) * l);
         args1 = flint_malloc(num_threads *
@@ -115,10 +115,14 @@ main(void)
             args1[j].vinv = *cinv;
             args1[j].m = l;
 
-            pthread_create(&threads[j], NULL, _nmod_poly_interval_poly_worker, &args1[j]);
+            if (j < num_workers)
+                thread_pool_wake(global_thread_pool, threads[j], 0,
+                                 _nmod_poly_interval_poly_worker, &args1[j]);
+            else
+                _nmod_poly_interval_poly_worker(&args1[j]);
         }
-        for (j = 0; j < num_threads; j++)
-            pthread_join(threads[j], NULL);
+        for (j = 0; j < num_workers; j++)
+            thread_pool_wait(global_thread_pool, threads[j]);
         for (j = 0; j < num_threads; j++)
             _nmod_poly_normalise(e[j]);
 
@@ -147,7 +151,7 @@ main(void)
         flint_free(e);
         flint_free(tmp);
         flint_free(args1);
-        flint_free(threads);
+        flint_give_back_threads(threads, num_workers);
     }
 
     FLINT_TEST_CLEANUP(state);
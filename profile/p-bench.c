@@ -0,0 +1,942 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+/*
+   Benchmark driver covering the main multiplication, division, gcd,
+   factoring and linear algebra functions, for catching performance
+   regressions between versions.
+
+   Each kernel is timed with prof_repeat_stats over a sweep of sizes n
+   (length, dimension or bits, depending on the kernel), bits (of the
+   coefficients or of the modulus) and, for kernels which use threads,
+   numbers of threads. The results are written as CSV or JSON.
+
+   Usage: p-bench [-f csv|json] [-o file] [-k pattern] [-t trials]
+                  [-j threads] [-b baseline.csv] [-q] [-l]
+
+      -f   output format, csv by default
+      -o   output file, standard output by default
+      -k   only kernels whose name or group contains pattern
+      -t   number of timings of each case, 5 by default
+      -j   time threaded kernels with 1, 2, 4, ... up to threads threads
+      -b   compare against the median times of an earlier CSV run
+      -q   quick run, only the two smallest sizes of each sweep
+      -l   list the kernels and exit
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gmp.h>
+#include "flint.h"
+#include "profiler.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_factor.h"
+#include "fmpz_poly.h"
+#include "fmpz_poly_factor.h"
+#include "fmpz_mat.h"
+#include "nmod_poly.h"
+#include "nmod_poly_factor.h"
+#include "nmod_mat.h"
+#include "fq_nmod_poly.h"
+
+#define BENCH_MAX_SIZES 8
+
+/* Degree of the finite fields used by the fq_nmod kernels */
+#define BENCH_FQ_DEGREE 5
+
+typedef struct
+{
+    slong n;
+    slong bits;
+} bench_arg_t;
+
+typedef struct
+{
+    const char * name;
+    const char * group;
+    profile_target_t sample;
+    int threaded;
+    slong n[BENCH_MAX_SIZES];       /* zero terminated */
+    slong bits[BENCH_MAX_SIZES];    /* zero terminated, may be empty */
+} bench_kernel;
+
+typedef struct
+{
+    char kernel[64];
+    slong n, bits;
+    int threads;
+    double median;
+} bench_baseline;
+
+static mp_limb_t
+bench_prime(slong bits)
+{
+    return n_nextprime(UWORD(1) << (bits - 1), 1);
+}
+
+/* Random polynomial of exactly the given length */
+static void
+bench_fmpz_poly_rand(fmpz_poly_t f, flint_rand_t state, slong len,
+                                                                 slong bits)
+{
+    fmpz_poly_randtest(f, state, len, bits);
+
+    if (fmpz_poly_length(f) < len)
+        fmpz_poly_set_coeff_ui(f, len - 1, 1);
+}
+
+/* Multiplication ************************************************************/
+
+static void
+sample_fmpz_mul(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fmpz_t a, b, c;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_init(a);
+    fmpz_init(b);
+    fmpz_init(c);
+    fmpz_randbits(a, state, params->n);
+    fmpz_randbits(b, state, params->n);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_mul(c, a, b);
+    prof_stop();
+
+    fmpz_clear(a);
+    fmpz_clear(b);
+    fmpz_clear(c);
+    flint_randclear(state);
+}
+
+static void
+sample_fmpz_poly_mul(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fmpz_poly_t a, b, c;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_poly_init(a);
+    fmpz_poly_init(b);
+    fmpz_poly_init(c);
+    bench_fmpz_poly_rand(a, state, params->n, params->bits);
+    bench_fmpz_poly_rand(b, state, params->n, params->bits);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_poly_mul(c, a, b);
+    prof_stop();
+
+    fmpz_poly_clear(a);
+    fmpz_poly_clear(b);
+    fmpz_poly_clear(c);
+    flint_randclear(state);
+}
+
+static void
+sample_nmod_poly_mul(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    nmod_poly_t a, b, c;
+    mp_limb_t p = bench_prime(params->bits);
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    nmod_poly_init(a, p);
+    nmod_poly_init(b, p);
+    nmod_poly_init(c, p);
+    nmod_poly_randtest(a, state, params->n);
+    nmod_poly_randtest(b, state, params->n);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        nmod_poly_mul(c, a, b);
+    prof_stop();
+
+    nmod_poly_clear(a);
+    nmod_poly_clear(b);
+    nmod_poly_clear(c);
+    flint_randclear(state);
+}
+
+static void
+sample_fq_nmod_poly_mul(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fq_nmod_ctx_t ctx;
+    fq_nmod_poly_t a, b, c;
+    fmpz_t p;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_init_set_ui(p, bench_prime(params->bits));
+    fq_nmod_ctx_init(ctx, p, BENCH_FQ_DEGREE, "a");
+    fq_nmod_poly_init(a, ctx);
+    fq_nmod_poly_init(b, ctx);
+    fq_nmod_poly_init(c, ctx);
+    fq_nmod_poly_randtest(a, state, params->n, ctx);
+    fq_nmod_poly_randtest(b, state, params->n, ctx);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fq_nmod_poly_mul(c, a, b, ctx);
+    prof_stop();
+
+    fq_nmod_poly_clear(a, ctx);
+    fq_nmod_poly_clear(b, ctx);
+    fq_nmod_poly_clear(c, ctx);
+    fq_nmod_ctx_clear(ctx);
+    fmpz_clear(p);
+    flint_randclear(state);
+}
+
+static void
+sample_fmpz_mat_mul(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fmpz_mat_t A, B, C;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_mat_init(A, params->n, params->n);
+    fmpz_mat_init(B, params->n, params->n);
+    fmpz_mat_init(C, params->n, params->n);
+    fmpz_mat_randbits(A, state, params->bits);
+    fmpz_mat_randbits(B, state, params->bits);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_mat_mul(C, A, B);
+    prof_stop();
+
+    fmpz_mat_clear(A);
+    fmpz_mat_clear(B);
+    fmpz_mat_clear(C);
+    flint_randclear(state);
+}
+
+static void
+sample_nmod_mat_mul(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    mp_limb_t p = bench_prime(params->bits);
+    nmod_mat_t A, B, C;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    nmod_mat_init(A, params->n, params->n, p);
+    nmod_mat_init(B, params->n, params->n, p);
+    nmod_mat_init(C, params->n, params->n, p);
+    nmod_mat_randfull(A, state);
+    nmod_mat_randfull(B, state);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        nmod_mat_mul(C, A, B);
+    prof_stop();
+
+    nmod_mat_clear(A);
+    nmod_mat_clear(B);
+    nmod_mat_clear(C);
+    flint_randclear(state);
+}
+
+/* Division ******************************************************************/
+
+static void
+sample_fmpz_tdiv_q(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fmpz_t a, b, q;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_init(a);
+    fmpz_init(b);
+    fmpz_init(q);
+    fmpz_randbits(a, state, params->n);
+    do {
+        fmpz_randbits(b, state, params->n / 2);
+    } while (fmpz_is_zero(b));
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_tdiv_q(q, a, b);
+    prof_stop();
+
+    fmpz_clear(a);
+    fmpz_clear(b);
+    fmpz_clear(q);
+    flint_randclear(state);
+}
+
+/* Division by a monic polynomial with a quotient of the same size */
+static void
+sample_fmpz_poly_divrem(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fmpz_poly_t a, b, q, r;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_poly_init(a);
+    fmpz_poly_init(b);
+    fmpz_poly_init(q);
+    fmpz_poly_init(r);
+    bench_fmpz_poly_rand(b, state, params->n, params->bits);
+    fmpz_poly_set_coeff_ui(b, params->n, 1);
+    bench_fmpz_poly_rand(q, state, params->n, params->bits);
+    bench_fmpz_poly_rand(r, state, params->n, params->bits);
+    fmpz_poly_mul(a, b, q);
+    fmpz_poly_add(a, a, r);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_poly_divrem(q, r, a, b);
+    prof_stop();
+
+    fmpz_poly_clear(a);
+    fmpz_poly_clear(b);
+    fmpz_poly_clear(q);
+    fmpz_poly_clear(r);
+    flint_randclear(state);
+}
+
+static void
+sample_nmod_poly_divrem(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    mp_limb_t p = bench_prime(params->bits);
+    nmod_poly_t a, b, q, r;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    nmod_poly_init(a, p);
+    nmod_poly_init(b, p);
+    nmod_poly_init(q, p);
+    nmod_poly_init(r, p);
+    nmod_poly_randtest(a, state, 2 * params->n);
+    nmod_poly_randtest_monic(b, state, params->n);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        nmod_poly_divrem(q, r, a, b);
+    prof_stop();
+
+    nmod_poly_clear(a);
+    nmod_poly_clear(b);
+    nmod_poly_clear(q);
+    nmod_poly_clear(r);
+    flint_randclear(state);
+}
+
+/* GCD ***********************************************************************/
+
+static void
+sample_fmpz_gcd(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fmpz_t a, b, g;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_init(a);
+    fmpz_init(b);
+    fmpz_init(g);
+    fmpz_randbits(a, state, params->n);
+    fmpz_randbits(b, state, params->n);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_gcd(g, a, b);
+    prof_stop();
+
+    fmpz_clear(a);
+    fmpz_clear(b);
+    fmpz_clear(g);
+    flint_randclear(state);
+}
+
+static void
+sample_fmpz_poly_gcd(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fmpz_poly_t a, b, c, g;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_poly_init(a);
+    fmpz_poly_init(b);
+    fmpz_poly_init(c);
+    fmpz_poly_init(g);
+    bench_fmpz_poly_rand(a, state, params->n, params->bits);
+    bench_fmpz_poly_rand(b, state, params->n, params->bits);
+    bench_fmpz_poly_rand(c, state, params->n / 4 + 1, params->bits);
+    fmpz_poly_mul(a, a, c);
+    fmpz_poly_mul(b, b, c);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_poly_gcd(g, a, b);
+    prof_stop();
+
+    fmpz_poly_clear(a);
+    fmpz_poly_clear(b);
+    fmpz_poly_clear(c);
+    fmpz_poly_clear(g);
+    flint_randclear(state);
+}
+
+static void
+sample_nmod_poly_gcd(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    mp_limb_t p = bench_prime(params->bits);
+    nmod_poly_t a, b, g;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    nmod_poly_init(a, p);
+    nmod_poly_init(b, p);
+    nmod_poly_init(g, p);
+    nmod_poly_randtest(a, state, params->n);
+    nmod_poly_randtest(b, state, params->n);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        nmod_poly_gcd(g, a, b);
+    prof_stop();
+
+    nmod_poly_clear(a);
+    nmod_poly_clear(b);
+    nmod_poly_clear(g);
+    flint_randclear(state);
+}
+
+static void
+sample_fq_nmod_poly_gcd(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fq_nmod_ctx_t ctx;
+    fq_nmod_poly_t a, b, g;
+    fmpz_t p;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_init_set_ui(p, bench_prime(params->bits));
+    fq_nmod_ctx_init(ctx, p, BENCH_FQ_DEGREE, "a");
+    fq_nmod_poly_init(a, ctx);
+    fq_nmod_poly_init(b, ctx);
+    fq_nmod_poly_init(g, ctx);
+    fq_nmod_poly_randtest(a, state, params->n, ctx);
+    fq_nmod_poly_randtest(b, state, params->n, ctx);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fq_nmod_poly_gcd(g, a, b, ctx);
+    prof_stop();
+
+    fq_nmod_poly_clear(a, ctx);
+    fq_nmod_poly_clear(b, ctx);
+    fq_nmod_poly_clear(g, ctx);
+    fq_nmod_ctx_clear(ctx);
+    fmpz_clear(p);
+    flint_randclear(state);
+}
+
+/* Factoring *****************************************************************/
+
+/* Products of two primes of n/2 bits, the hardest case */
+static void
+sample_n_factor(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    mp_limb_t x;
+    n_factor_t fac;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    x = n_randprime(state, params->n / 2, 0)
+      * n_randprime(state, params->n - params->n / 2, 0);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+    {
+        n_factor_init(&fac);
+        n_factor(&fac, x, 0);
+    }
+    prof_stop();
+
+    flint_randclear(state);
+}
+
+static void
+sample_fmpz_factor(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fmpz_factor_t fac;
+    fmpz_t x;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_init(x);
+    fmpz_set_ui(x, n_randprime(state, params->n / 2, 0));
+    fmpz_mul_ui(x, x, n_randprime(state, params->n - params->n / 2, 0));
+
+    prof_start();
+    for (i = 0; i < count; i++)
+    {
+        fmpz_factor_init(fac);
+        fmpz_factor(fac, x);
+        fmpz_factor_clear(fac);
+    }
+    prof_stop();
+
+    fmpz_clear(x);
+    flint_randclear(state);
+}
+
+static void
+sample_nmod_poly_factor(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    mp_limb_t p = bench_prime(params->bits);
+    nmod_poly_factor_t fac;
+    nmod_poly_t a;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    nmod_poly_init(a, p);
+    nmod_poly_randtest_monic(a, state, params->n);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+    {
+        nmod_poly_factor_init(fac);
+        nmod_poly_factor(fac, a);
+        nmod_poly_factor_clear(fac);
+    }
+    prof_stop();
+
+    nmod_poly_clear(a);
+    flint_randclear(state);
+}
+
+/* Products of two random polynomials of length n/2 */
+static void
+sample_fmpz_poly_factor(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fmpz_poly_factor_t fac;
+    fmpz_poly_t a, b;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_poly_init(a);
+    fmpz_poly_init(b);
+    bench_fmpz_poly_rand(a, state, params->n / 2, params->bits);
+    bench_fmpz_poly_rand(b, state, params->n - params->n / 2, params->bits);
+    fmpz_poly_mul(a, a, b);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+    {
+        fmpz_poly_factor_init(fac);
+        fmpz_poly_factor_zassenhaus(fac, a);
+        fmpz_poly_factor_clear(fac);
+    }
+    prof_stop();
+
+    fmpz_poly_clear(a);
+    fmpz_poly_clear(b);
+    flint_randclear(state);
+}
+
+/* Linear algebra ************************************************************/
+
+static void
+sample_fmpz_mat_det(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fmpz_mat_t A;
+    fmpz_t d;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_mat_init(A, params->n, params->n);
+    fmpz_init(d);
+    fmpz_mat_randbits(A, state, params->bits);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_mat_det(d, A);
+    prof_stop();
+
+    fmpz_mat_clear(A);
+    fmpz_clear(d);
+    flint_randclear(state);
+}
+
+static void
+sample_fmpz_mat_solve(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    fmpz_mat_t A, B, X;
+    fmpz_t den;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    fmpz_mat_init(A, params->n, params->n);
+    fmpz_mat_init(B, params->n, 1);
+    fmpz_mat_init(X, params->n, 1);
+    fmpz_init(den);
+    fmpz_mat_randbits(A, state, params->bits);
+    fmpz_mat_randbits(B, state, params->bits);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_mat_solve(X, den, A, B);
+    prof_stop();
+
+    fmpz_mat_clear(A);
+    fmpz_mat_clear(B);
+    fmpz_mat_clear(X);
+    fmpz_clear(den);
+    flint_randclear(state);
+}
+
+static void
+sample_nmod_mat_det(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    mp_limb_t p = bench_prime(params->bits);
+    nmod_mat_t A;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    nmod_mat_init(A, params->n, params->n, p);
+    nmod_mat_randfull(A, state);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        nmod_mat_det(A);
+    prof_stop();
+
+    nmod_mat_clear(A);
+    flint_randclear(state);
+}
+
+static void
+sample_nmod_mat_solve(void * arg, ulong count)
+{
+    bench_arg_t * params = (bench_arg_t *) arg;
+    mp_limb_t p = bench_prime(params->bits);
+    nmod_mat_t A, B, X;
+    ulong i;
+    FLINT_TEST_INIT(state);
+
+    nmod_mat_init(A, params->n, params->n, p);
+    nmod_mat_init(B, params->n, params->n, p);
+    nmod_mat_init(X, params->n, params->n, p);
+    nmod_mat_randfull(A, state);
+    nmod_mat_randfull(B, state);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        nmod_mat_solve(X, A, B);
+    prof_stop();
+
+    nmod_mat_clear(A);
+    nmod_mat_clear(B);
+    nmod_mat_clear(X);
+    flint_randclear(state);
+}
+
+/* Registry ******************************************************************/
+
+static const bench_kernel kernels[] =
+{
+    { "fmpz_mul", "mul", sample_fmpz_mul, 1,
+        { 64, 1024, 16384, 262144, 4194304 }, { 0 } },
+    { "fmpz_poly_mul", "mul", sample_fmpz_poly_mul, 0,
+        { 16, 128, 1024, 8192 }, { 64, 1024 } },
+    { "nmod_poly_mul", "mul", sample_nmod_poly_mul, 0,
+        { 16, 256, 4096, 65536 }, { 16, FLINT_BITS - 1 } },
+    { "fq_nmod_poly_mul", "mul", sample_fq_nmod_poly_mul, 0,
+        { 16, 128, 1024 }, { 8, FLINT_BITS - 1 } },
+    { "fmpz_mat_mul", "mul", sample_fmpz_mat_mul, 1,
+        { 16, 64, 256 }, { 10, 100 } },
+    { "nmod_mat_mul", "mul", sample_nmod_mat_mul, 1,
+        { 64, 256, 1024 }, { 20, FLINT_BITS - 4 } },
+    { "fmpz_tdiv_q", "div", sample_fmpz_tdiv_q, 0,
+        { 128, 2048, 65536, 1048576 }, { 0 } },
+    { "fmpz_poly_divrem", "div", sample_fmpz_poly_divrem, 0,
+        { 16, 256, 2048 }, { 64 } },
+    { "nmod_poly_divrem", "div", sample_nmod_poly_divrem, 0,
+        { 64, 1024, 16384 }, { FLINT_BITS - 1 } },
+    { "fmpz_gcd", "gcd", sample_fmpz_gcd, 0,
+        { 64, 1024, 16384, 262144 }, { 0 } },
+    { "fmpz_poly_gcd", "gcd", sample_fmpz_poly_gcd, 0,
+        { 16, 128, 512 }, { 64 } },
+    { "nmod_poly_gcd", "gcd", sample_nmod_poly_gcd, 0,
+        { 64, 512, 4096 }, { 8, FLINT_BITS - 1 } },
+    { "fq_nmod_poly_gcd", "gcd", sample_fq_nmod_poly_gcd, 0,
+        { 32, 256, 1024 }, { 8, FLINT_BITS - 1 } },
+    { "n_factor", "factor", sample_n_factor, 0,
+        { 32, 48, FLINT_BITS - 2 }, { 0 } },
+    { "fmpz_factor", "factor", sample_fmpz_factor, 1,
+        { 48, 80, 100 }, { 0 } },
+    { "nmod_poly_factor", "factor", sample_nmod_poly_factor, 1,
+        { 16, 64, 256 }, { FLINT_BITS - 1 } },
+    { "fmpz_poly_factor", "factor", sample_fmpz_poly_factor, 1,
+        { 8, 16, 32 }, { 8 } },
+    { "fmpz_mat_det", "linalg", sample_fmpz_mat_det, 1,
+        { 16, 64, 128 }, { 10, 100 } },
+    { "fmpz_mat_solve", "linalg", sample_fmpz_mat_solve, 0,
+        { 16, 64 }, { 10 } },
+    { "nmod_mat_det", "linalg", sample_nmod_mat_det, 0,
+        { 64, 256, 512 }, { FLINT_BITS - 1 } },
+    { "nmod_mat_solve", "linalg", sample_nmod_mat_solve, 1,
+        { 64, 256 }, { FLINT_BITS - 1 } }
+};
+
+#define NUM_KERNELS ((slong) (sizeof(kernels) / sizeof(bench_kernel)))
+
+/* Driver ********************************************************************/
+
+static slong
+bench_load_baseline(bench_baseline ** base, const char * filename)
+{
+    char line[256];
+    slong num = 0, alloc = 0;
+    long n, bits;
+    FILE * file;
+    bench_baseline b;
+
+    if ((file = fopen(filename, "r")) == NULL)
+    {
+        flint_printf("Could not read %s\n", filename);
+        abort();
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if (sscanf(line, "%63[^,],%*[^,],%ld,%ld,%d,%*d,%*u,%*f,%lf",
+                   b.kernel, &n, &bits, &b.threads, &b.median) != 5)
+            continue;
+
+        b.n = n;
+        b.bits = bits;
+
+        if (num == alloc)
+        {
+            alloc = FLINT_MAX(16, 2 * alloc);
+            *base = flint_realloc(*base, alloc * sizeof(bench_baseline));
+        }
+
+        (*base)[num++] = b;
+    }
+
+    fclose(file);
+
+    return num;
+}
+
+static double
+bench_lookup_baseline(const bench_baseline * base, slong num,
+                      const char * kernel, slong n, slong bits, int threads)
+{
+    slong i;
+
+    for (i = 0; i < num; i++)
+        if (strcmp(base[i].kernel, kernel) == 0 && base[i].n == n
+              && base[i].bits == bits && base[i].threads == threads)
+            return base[i].median;
+
+    return 0.0;
+}
+
+static void
+bench_write(FILE * out, int json, int first, const bench_kernel * k,
+            slong n, slong bits, int threads, const prof_stats_t stats,
+            int compare, double base)
+{
+    if (json)
+    {
+        flint_fprintf(out, "%s\n    {\"kernel\": \"%s\", \"group\": \"%s\", "
+            "\"n\": %wd, \"bits\": %wd, \"threads\": %d, ",
+            first ? "" : ",", k->name, k->group, n, bits, threads);
+        flint_fprintf(out, "\"trials\": %wd, \"count\": %wu, "
+            "\"min_us\": %.3f, \"median_us\": %.3f, \"mean_us\": %.3f, "
+            "\"max_us\": %.3f, \"stddev_us\": %.3f",
+            stats->trials, stats->count, stats->min, stats->median,
+            stats->mean, stats->max, stats->stddev);
+        if (compare)
+            flint_fprintf(out, ", \"baseline_us\": %.3f, \"ratio\": %.3f",
+                base, base > 0.0 ? stats->median / base : 0.0);
+        flint_fprintf(out, "}");
+    }
+    else
+    {
+        flint_fprintf(out, "%s,%s,%wd,%wd,%d,%wd,%wu,%.3f,%.3f,%.3f,%.3f,%.3f",
+            k->name, k->group, n, bits, threads, stats->trials, stats->count,
+            stats->min, stats->median, stats->mean, stats->max,
+            stats->stddev);
+        if (compare)
+            flint_fprintf(out, ",%.3f,%.3f",
+                base, base > 0.0 ? stats->median / base : 0.0);
+        flint_fprintf(out, "\n");
+    }
+
+    fflush(out);
+}
+
+int
+main(int argc, char * argv[])
+{
+    const char * format = "csv", * outname = NULL, * pattern = NULL;
+    const char * basename = NULL;
+    slong i, j, l, trials = 5, num_base = 0, sizes;
+    int max_threads = 1, quick = 0, json, first = 1, threads;
+    bench_baseline * base = NULL;
+    bench_arg_t params;
+    prof_stats_t stats;
+    FILE * out = stdout;
+    double b;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-l") == 0)
+        {
+            for (j = 0; j < NUM_KERNELS; j++)
+                flint_printf("%s (%s)\n", kernels[j].name, kernels[j].group);
+            return 0;
+        }
+        else if (strcmp(argv[i], "-q") == 0)
+            quick = 1;
+        else if (i + 1 < argc && strcmp(argv[i], "-f") == 0)
+            format = argv[++i];
+        else if (i + 1 < argc && strcmp(argv[i], "-o") == 0)
+            outname = argv[++i];
+        else if (i + 1 < argc && strcmp(argv[i], "-k") == 0)
+            pattern = argv[++i];
+        else if (i + 1 < argc && strcmp(argv[i], "-t") == 0)
+            trials = atol(argv[++i]);
+        else if (i + 1 < argc && strcmp(argv[i], "-j") == 0)
+            max_threads = atoi(argv[++i]);
+        else if (i + 1 < argc && strcmp(argv[i], "-b") == 0)
+            basename = argv[++i];
+        else
+        {
+            flint_printf("Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    json = (strcmp(format, "json") == 0);
+    max_threads = FLINT_MAX(max_threads, 1);
+
+    if (!json && strcmp(format, "csv") != 0)
+    {
+        flint_printf("Unknown format %s\n", format);
+        return 1;
+    }
+
+    if (basename != NULL)
+        num_base = bench_load_baseline(&base, basename);
+
+    if (outname != NULL && (out = fopen(outname, "w")) == NULL)
+    {
+        flint_printf("Could not write %s\n", outname);
+        return 1;
+    }
+
+    if (json)
+        flint_fprintf(out, "{\n  \"flint_version\": \"%s\",\n"
+                           "  \"results\": [", version);
+    else
+        flint_fprintf(out, "kernel,group,n,bits,threads,trials,count,"
+            "min_us,median_us,mean_us,max_us,stddev_us%s\n",
+            basename != NULL ? ",baseline_us,ratio" : "");
+
+    for (i = 0; i < NUM_KERNELS; i++)
+    {
+        const bench_kernel * k = kernels + i;
+
+        if (pattern != NULL && strstr(k->name, pattern) == NULL
+                            && strstr(k->group, pattern) == NULL)
+            continue;
+
+        for (sizes = 0; sizes < BENCH_MAX_SIZES && k->n[sizes] != 0; sizes++)
+            ;
+
+        if (quick)
+            sizes = FLINT_MIN(sizes, 2);
+
+        for (j = 0; j < sizes; j++)
+        {
+            /* An empty list of bits is a single case with bits zero */
+            for (l = 0; l == 0 || (l < BENCH_MAX_SIZES && k->bits[l] != 0);
+                                                                       l++)
+            {
+                for (threads = 1; threads <= (k->threaded ? max_threads : 1);
+                       threads = (threads == max_threads) ? threads + 1 :
+                                 FLINT_MIN(2 * threads, max_threads))
+                {
+                    params.n = k->n[j];
+                    params.bits = k->bits[l];
+
+                    flint_set_num_threads(threads);
+                    prof_repeat_stats(stats, k->sample, &params, trials);
+                    flint_set_num_threads(1);
+
+                    b = bench_lookup_baseline(base, num_base, k->name,
+                                              params.n, params.bits, threads);
+
+                    bench_write(out, json, first, k, params.n, params.bits,
+                                threads, stats, basename != NULL, b);
+                    first = 0;
+
+                    if (out != stdout)
+                        flint_printf("%s n = %wd bits = %wd threads = %d: "
+                            "%.3f us\n", k->name, params.n, params.bits,
+                            threads, stats->median);
+                }
+            }
+        }
+    }
+
+    if (json)
+        flint_fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+
+    flint_free(base);
+    flint_cleanup();
+
+    return 0;
+}
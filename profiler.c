@@ -111,6 +111,74 @@ prof_repeat(double *min, double *max, profile_target_t target, void *arg)
         *max = max_time;
 }
 
+static int
+prof_cmp_double(const void * a, const void * b)
+{
+    double x = *((const double *) a), y = *((const double *) b);
+
+    return (x > y) - (x < y);
+}
+
+void
+prof_repeat_stats(prof_stats_t stats, profile_target_t target, void * arg,
+                                                               slong trials)
+{
+    double * t, last_time, sum = 0.0, sum2 = 0.0;
+    ulong count = 1;
+    slong i;
+
+    trials = FLINT_MAX(trials, 1);
+    t = flint_malloc(trials * sizeof(double));
+
+    /*
+       Find a number of calls per trial taking at least DURATION_THRESHOLD
+       microseconds, the last timing being the first trial
+     */
+    while (1)
+    {
+        init_clock(0);
+        target(arg, count);
+        last_time = get_clock(0);
+
+        if (last_time >= DURATION_THRESHOLD)
+            break;
+
+        if (last_time < 0.0001)
+            count *= 16;
+        else
+            count = (ulong) ceil(count * DURATION_TARGET / last_time);
+    }
+
+    t[0] = last_time / count;
+
+    for (i = 1; i < trials; i++)
+    {
+        init_clock(0);
+        target(arg, count);
+        t[i] = get_clock(0) / count;
+    }
+
+    for (i = 0; i < trials; i++)
+    {
+        sum += t[i];
+        sum2 += t[i] * t[i];
+    }
+
+    qsort(t, trials, sizeof(double), prof_cmp_double);
+
+    stats->trials = trials;
+    stats->count = count;
+    stats->min = t[0];
+    stats->max = t[trials - 1];
+    stats->mean = sum / trials;
+    stats->median = (trials % 2) ? t[trials / 2]
+                                 : (t[trials / 2 - 1] + t[trials / 2]) / 2;
+    stats->stddev = (trials == 1) ? 0.0 :
+        sqrt(FLINT_MAX(0.0, (sum2 - sum * sum / trials) / (trials - 1)));
+
+    flint_free(t);
+}
+
 void get_memory_usage(meminfo_t meminfo)
 {
     FILE * file = fopen("/proc/self/status", "r");
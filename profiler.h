@@ -189,6 +189,22 @@ typedef void (*profile_target_t)(void* arg, ulong count);
 
 FLINT_DLL void prof_repeat(double* min, double* max, profile_target_t target, void* arg);
 
+typedef struct
+{
+    double min;
+    double max;
+    double mean;
+    double median;
+    double stddev;
+    slong trials;
+    ulong count;
+} prof_stats_struct;
+
+typedef prof_stats_struct prof_stats_t[1];
+
+FLINT_DLL void prof_repeat_stats(prof_stats_t stats, profile_target_t target,
+                                                   void * arg, slong trials);
+
 #define DURATION_THRESHOLD 5000.0
 
 #define DURATION_TARGET 10000.0
@@ -0,0 +1,264 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "flint.h"
+
+#if HAVE_PTHREAD
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+#endif
+
+#define FLINT_STATS_LIST(X)                                         \
+   X(FMPZ_POLY_MUL_TINY,               "_fmpz_poly_mul_tiny")       \
+   X(FMPZ_POLY_MUL_CLASSICAL,          "_fmpz_poly_mul_classical")  \
+   X(FMPZ_POLY_MUL_KARATSUBA,          "_fmpz_poly_mul_karatsuba")  \
+   X(FMPZ_POLY_MUL_KS,                 "_fmpz_poly_mul_KS")         \
+   X(FMPZ_POLY_MUL_SS,                 "_fmpz_poly_mul_SS")         \
+   X(NMOD_POLY_MUL_CLASSICAL,          "_nmod_poly_mul_classical")  \
+   X(NMOD_POLY_MUL_KS,                 "_nmod_poly_mul_KS")         \
+   X(NMOD_POLY_MUL_KS2,                "_nmod_poly_mul_KS2")        \
+   X(NMOD_POLY_MUL_KS4,                "_nmod_poly_mul_KS4")        \
+   X(NMOD_POLY_MUL_NTT,                "_nmod_poly_mul_NTT")        \
+   X(NMOD_POLY_GCD_EUCLIDEAN,          "_nmod_poly_gcd_euclidean")  \
+   X(NMOD_POLY_GCD_HGCD,               "_nmod_poly_gcd_hgcd")       \
+   X(FMPZ_MAT_MUL_CLASSICAL,           "fmpz_mat_mul_classical")    \
+   X(FMPZ_MAT_MUL_CLASSICAL_INLINE,    "fmpz_mat_mul_classical_inline") \
+   X(FMPZ_MAT_MUL_MULTI_MOD,           "_fmpz_mat_mul_multi_mod")   \
+   X(NMOD_MAT_MUL_CLASSICAL,           "nmod_mat_mul_classical")    \
+   X(NMOD_MAT_MUL_STRASSEN,            "nmod_mat_mul_strassen")     \
+   X(NMOD_MAT_MUL_THREADED,            "_nmod_mat_mul_threaded")
+
+#define STATS_NAME(algo, name) name,
+
+static const char * flint_stats_names[FLINT_STATS_NUM] =
+   { FLINT_STATS_LIST(STATS_NAME) };
+
+/*
+   Each thread records into its own table, which is allocated on the
+   first record. When the thread calls flint_cleanup, or a thread of a
+   pool finishes a job, its table is added to the shared table, which
+   is protected by a lock.
+*/
+static FLINT_TLS_PREFIX flint_stats_struct * flint_stats_local = NULL;
+
+/*
+   Ticks of the instrumented calls made so far by this thread, nested
+   calls included once. A call subtracts the growth of this count while
+   it runs from its own ticks, so that only its self time is recorded.
+*/
+static FLINT_TLS_PREFIX ulong flint_stats_nested = 0;
+
+static flint_stats_struct flint_stats_total[FLINT_STATS_NUM];
+
+#if HAVE_PTHREAD
+static pthread_mutex_t flint_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static void _flint_stats_add(flint_stats_struct * res,
+                                              const flint_stats_struct * a)
+{
+   slong i;
+
+   res->calls += a->calls;
+   res->ticks += a->ticks;
+
+   for (i = 0; i <= FLINT_BITS; i++)
+   {
+      res->len_hist[i] += a->len_hist[i];
+      res->bits_hist[i] += a->bits_hist[i];
+   }
+}
+
+void _flint_stats_flush(void)
+{
+   slong i;
+
+   if (flint_stats_local == NULL)
+      return;
+
+#if HAVE_PTHREAD
+   pthread_mutex_lock(&flint_stats_lock);
+#endif
+
+   for (i = 0; i < FLINT_STATS_NUM; i++)
+      _flint_stats_add(flint_stats_total + i, flint_stats_local + i);
+
+#if HAVE_PTHREAD
+   pthread_mutex_unlock(&flint_stats_lock);
+#endif
+
+   memset(flint_stats_local, 0, FLINT_STATS_NUM * sizeof(flint_stats_struct));
+}
+
+static void _flint_stats_cleanup(void)
+{
+   _flint_stats_flush();
+
+   flint_free(flint_stats_local);
+   flint_stats_local = NULL;
+}
+
+ulong _flint_stats_ticks(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+   unsigned int hi, lo;
+
+   __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+
+#if FLINT64
+   return (((ulong) hi) << 32) | lo;
+#else
+   return lo;
+#endif
+#else
+   return (ulong) clock();
+#endif
+}
+
+ulong _flint_stats_nested_ticks(void)
+{
+   return flint_stats_nested;
+}
+
+void _flint_stats_record(flint_stats_algo algo, ulong len,
+                                  ulong bits, ulong ticks, ulong nested0)
+{
+   flint_stats_struct * s;
+   ulong self = ticks - (flint_stats_nested - nested0);
+
+   flint_stats_nested = nested0 + ticks;
+
+   if (flint_stats_local == NULL)
+   {
+      flint_stats_local = flint_calloc(FLINT_STATS_NUM,
+                                                sizeof(flint_stats_struct));
+      flint_register_cleanup_function(_flint_stats_cleanup);
+   }
+
+   s = flint_stats_local + algo;
+
+   s->calls++;
+   s->ticks += self;
+   s->len_hist[FLINT_BIT_COUNT(len)]++;
+   s->bits_hist[FLINT_BIT_COUNT(bits)]++;
+}
+
+void flint_stats_get(flint_stats_t stats, flint_stats_algo algo)
+{
+   memset(stats, 0, sizeof(flint_stats_struct));
+
+#if HAVE_PTHREAD
+   pthread_mutex_lock(&flint_stats_lock);
+#endif
+
+   _flint_stats_add(stats, flint_stats_total + algo);
+
+#if HAVE_PTHREAD
+   pthread_mutex_unlock(&flint_stats_lock);
+#endif
+
+   if (flint_stats_local != NULL)
+      _flint_stats_add(stats, flint_stats_local + algo);
+}
+
+void flint_stats_reset(void)
+{
+#if HAVE_PTHREAD
+   pthread_mutex_lock(&flint_stats_lock);
+#endif
+
+   memset(flint_stats_total, 0, sizeof(flint_stats_total));
+
+#if HAVE_PTHREAD
+   pthread_mutex_unlock(&flint_stats_lock);
+#endif
+
+   if (flint_stats_local != NULL)
+      memset(flint_stats_local, 0,
+                              FLINT_STATS_NUM * sizeof(flint_stats_struct));
+}
+
+const char * flint_stats_name(flint_stats_algo algo)
+{
+   return flint_stats_names[algo];
+}
+
+static void _flint_stats_fprint_hist(FILE * file, const char * label,
+                                                         const ulong * hist)
+{
+   slong i;
+
+   fprintf(file, "    %-6s", label);
+
+   for (i = 0; i <= FLINT_BITS; i++)
+   {
+      if (hist[i] == 0)
+         continue;
+
+      if (i == 0)
+         fprintf(file, " 0:" WORD_FMT "u", hist[i]);
+      else
+         fprintf(file, " 2^" WORD_FMT "d:" WORD_FMT "u", i - 1, hist[i]);
+   }
+
+   fprintf(file, "\n");
+}
+
+/*
+   Prints the calls and ticks of each algorithm which was used, with
+   its share of the ticks of all algorithms, and the histograms of the
+   lengths and entry sizes, where 2^k:c means c calls with a value in
+   [2^k, 2^(k+1)).
+*/
+void flint_stats_fprint(FILE * file)
+{
+   flint_stats_t stats;
+   double total = 0;
+   slong i;
+
+   for (i = 0; i < FLINT_STATS_NUM; i++)
+   {
+      flint_stats_get(stats, i);
+      total += stats->ticks;
+   }
+
+   for (i = 0; i < FLINT_STATS_NUM; i++)
+   {
+      flint_stats_get(stats, i);
+
+      if (stats->calls == 0)
+         continue;
+
+      fprintf(file, "%s: " WORD_FMT "u calls, " WORD_FMT "u ticks (%.1f%%)\n",
+              flint_stats_names[i], stats->calls, stats->ticks,
+              total == 0 ? 0.0 : 100.0 * stats->ticks / total);
+
+      _flint_stats_fprint_hist(file, "length", stats->len_hist);
+      _flint_stats_fprint_hist(file, "bits", stats->bits_hist);
+   }
+}
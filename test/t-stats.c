@@ -0,0 +1,287 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_poly.h"
+#include "fmpz_poly.h"
+#include "fmpz_mat.h"
+#include "nmod_mat.h"
+
+#if HAVE_PTHREAD
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+#endif
+
+/* Sum of the calls of all algorithms and check of the histograms */
+static ulong
+stats_calls(void)
+{
+   flint_stats_t stats;
+   ulong calls = 0, len, bits;
+   slong i, j;
+
+   for (i = 0; i < FLINT_STATS_NUM; i++)
+   {
+      flint_stats_get(stats, i);
+
+      len = bits = 0;
+      for (j = 0; j <= FLINT_BITS; j++)
+      {
+         len += stats->len_hist[j];
+         bits += stats->bits_hist[j];
+      }
+
+      if (len != stats->calls || bits != stats->calls)
+      {
+         flint_printf("FAIL (histogram):\n");
+         flint_printf("%s\n", flint_stats_name(i));
+         abort();
+      }
+
+      calls += stats->calls;
+   }
+
+   return calls;
+}
+
+static void *
+stats_worker(void * arg)
+{
+   nmod_poly_t a, b, c;
+
+   nmod_poly_init(a, 17);
+   nmod_poly_init(b, 17);
+   nmod_poly_init(c, 17);
+   nmod_poly_set_coeff_ui(a, 19, 1);
+   nmod_poly_set_coeff_ui(b, 19, 1);
+   nmod_poly_mul(c, a, b);
+   nmod_poly_clear(a);
+   nmod_poly_clear(b);
+   nmod_poly_clear(c);
+
+   flint_cleanup();
+   return NULL;
+}
+
+int main(void)
+{
+   int i;
+   ulong calls;
+   flint_stats_t stats;
+   FLINT_TEST_INIT(state);
+
+   flint_printf("stats....");
+   fflush(stdout);
+
+   flint_stats_reset();
+
+   if (stats_calls() != 0)
+   {
+      flint_printf("FAIL (reset)\n");
+      abort();
+   }
+
+   for (i = 0; i < 100; i++)
+   {
+      fmpz_poly_t a, b, c;
+      nmod_poly_t f, g, h;
+      fmpz_mat_t A, B, C;
+      slong m, n, k;
+      mp_limb_t p;
+
+      fmpz_poly_init(a);
+      fmpz_poly_init(b);
+      fmpz_poly_init(c);
+      fmpz_poly_randtest(a, state, n_randint(state, 100) + 2, 200);
+      fmpz_poly_randtest(b, state, n_randint(state, 100) + 2, 200);
+      fmpz_poly_mul(c, a, b);
+      fmpz_poly_clear(a);
+      fmpz_poly_clear(b);
+      fmpz_poly_clear(c);
+
+      p = n_randtest_prime(state, 0);
+      nmod_poly_init(f, p);
+      nmod_poly_init(g, p);
+      nmod_poly_init(h, p);
+      nmod_poly_randtest(f, state, n_randint(state, 400) + 1);
+      nmod_poly_randtest(g, state, n_randint(state, 400) + 1);
+      nmod_poly_gcd(h, f, g);
+      nmod_poly_clear(f);
+      nmod_poly_clear(g);
+      nmod_poly_clear(h);
+
+      m = n_randint(state, 30) + 1;
+      n = n_randint(state, 30) + 1;
+      k = n_randint(state, 30) + 1;
+      fmpz_mat_init(A, m, n);
+      fmpz_mat_init(B, n, k);
+      fmpz_mat_init(C, m, k);
+      fmpz_mat_randtest(A, state, n_randint(state, 100) + 1);
+      fmpz_mat_randtest(B, state, n_randint(state, 100) + 1);
+      fmpz_mat_mul(C, A, B);
+      fmpz_mat_clear(A);
+      fmpz_mat_clear(B);
+      fmpz_mat_clear(C);
+   }
+
+   calls = stats_calls();
+
+#if WANT_STATS
+   if (calls < 300)
+   {
+      flint_printf("FAIL (calls):\n");
+      flint_printf("calls = %wu\n", calls);
+      abort();
+   }
+#else
+   if (calls != 0)
+   {
+      flint_printf("FAIL (disabled):\n");
+      flint_printf("calls = %wu\n", calls);
+      abort();
+   }
+#endif
+
+   /* the stats of a thread are kept once it calls flint_cleanup */
+#if HAVE_PTHREAD
+   {
+      pthread_t thread;
+
+      flint_stats_get(stats, FLINT_STATS_NMOD_POLY_MUL_KS);
+      calls = stats->calls;
+
+      pthread_create(&thread, NULL, stats_worker, NULL);
+      pthread_join(thread, NULL);
+
+      flint_stats_get(stats, FLINT_STATS_NMOD_POLY_MUL_KS);
+
+      if (stats->calls != calls + WANT_STATS)
+      {
+         flint_printf("FAIL (thread):\n");
+         flint_printf("calls = %wu, %wu\n", calls, stats->calls);
+         abort();
+      }
+   }
+#endif
+
+   /* the threads of the global pool hand over their stats after a job */
+   {
+      nmod_mat_t A, B, C;
+      ulong calls2;
+      slong n = NMOD_MAT_MUL_THREADED_CUTOFF;
+
+      nmod_mat_init(A, n, n, 17);
+      nmod_mat_init(B, n, n, 17);
+      nmod_mat_init(C, n, n, 17);
+      nmod_mat_randtest(A, state);
+      nmod_mat_randtest(B, state);
+
+      flint_stats_get(stats, FLINT_STATS_NMOD_MAT_MUL_CLASSICAL);
+      calls = stats->calls;
+      flint_stats_get(stats, FLINT_STATS_NMOD_MAT_MUL_THREADED);
+      calls2 = stats->calls;
+
+      /* four blocks, one computed here and three by the pool */
+      flint_set_num_threads(4);
+      nmod_mat_mul(C, A, B);
+      flint_set_num_threads(1);
+
+      flint_stats_get(stats, FLINT_STATS_NMOD_MAT_MUL_THREADED);
+      calls2 = stats->calls - calls2;
+      flint_stats_get(stats, FLINT_STATS_NMOD_MAT_MUL_CLASSICAL);
+      calls = stats->calls - calls;
+
+      if (calls2 != WANT_STATS || calls != 4 * WANT_STATS)
+      {
+         flint_printf("FAIL (thread pool):\n");
+         flint_printf("calls = %wu, %wu\n", calls, calls2);
+         abort();
+      }
+
+      nmod_mat_clear(A);
+      nmod_mat_clear(B);
+      nmod_mat_clear(C);
+   }
+
+   /* nested calls only count towards the innermost algorithm, so the
+      ticks of all algorithms cannot exceed the elapsed ticks */
+#if WANT_STATS
+   {
+      fmpz_mat_t A, B, C;
+      ulong t0, t1, ticks = 0;
+
+      fmpz_mat_init(A, 40, 40);
+      fmpz_mat_init(B, 40, 40);
+      fmpz_mat_init(C, 40, 40);
+      fmpz_mat_randbits(A, state, 20);
+      fmpz_mat_randbits(B, state, 20);
+
+      flint_stats_reset();
+
+      t0 = _flint_stats_ticks();
+      fmpz_mat_mul(C, A, B);
+      t1 = _flint_stats_ticks();
+
+      for (i = 0; i < FLINT_STATS_NUM; i++)
+      {
+         flint_stats_get(stats, i);
+         ticks += stats->ticks;
+      }
+
+      flint_stats_get(stats, FLINT_STATS_FMPZ_MAT_MUL_MULTI_MOD);
+      calls = stats->calls;
+      flint_stats_get(stats, FLINT_STATS_NMOD_MAT_MUL_CLASSICAL);
+      calls += stats->calls;
+
+      if (calls != 2 || ticks > t1 - t0)
+      {
+         flint_printf("FAIL (nested):\n");
+         flint_printf("calls = %wu, ticks = %wu, elapsed = %wu\n",
+                                                  calls, ticks, t1 - t0);
+         abort();
+      }
+
+      fmpz_mat_clear(A);
+      fmpz_mat_clear(B);
+      fmpz_mat_clear(C);
+   }
+#endif
+
+   flint_stats_reset();
+
+   if (stats_calls() != 0)
+   {
+      flint_printf("FAIL (reset)\n");
+      abort();
+   }
+
+   FLINT_TEST_CLEANUP(state);
+
+   flint_printf("PASS\n");
+   return 0;
+}
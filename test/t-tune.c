@@ -0,0 +1,238 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "fmpz_mat.h"
+#include "fq_nmod_poly.h"
+
+int main(void)
+{
+   int i, j, result;
+   char filename[64];
+   slong tab[FLINT_TUNE_NUM];
+   FILE * file;
+   FLINT_TEST_INIT(state);
+
+   flint_printf("tune....");
+   fflush(stdout);
+
+   /* names, defaults and lookup */
+   for (j = 0; j < FLINT_TUNE_NUM; j++)
+   {
+      result = (flint_tune_lookup(flint_tune_name(j)) == j &&
+                flint_tune_get(j) == flint_tune_default(j) &&
+                flint_tune_default(j) >= flint_tune_min(j));
+      if (!result)
+      {
+         flint_printf("FAIL (defaults):\n");
+         flint_printf("%s\n", flint_tune_name(j));
+         abort();
+      }
+   }
+
+   if (flint_tune_lookup("NO_SUCH_CUTOFF") != -1)
+   {
+      flint_printf("FAIL (lookup)\n");
+      abort();
+   }
+
+   /* values below the minimum are raised to it */
+   for (j = 0; j < FLINT_TUNE_NUM; j++)
+   {
+      flint_tune_set(j, -1);
+      if (flint_tune_get(j) != flint_tune_min(j))
+      {
+         flint_printf("FAIL (minimum):\n");
+         flint_printf("%s\n", flint_tune_name(j));
+         abort();
+      }
+   }
+
+   flint_sprintf(filename, "t-tune-%wu.txt", n_randlimb(state) % 1000000);
+
+   /* saving and loading gives back the same values */
+   for (i = 0; i < 100; i++)
+   {
+      for (j = 0; j < FLINT_TUNE_NUM; j++)
+      {
+         flint_tune_set(j, flint_tune_min(j) + n_randint(state, 1000));
+         tab[j] = flint_tune_get(j);
+      }
+
+      if (!flint_tune_save(filename))
+      {
+         flint_printf("FAIL (save)\n");
+         abort();
+      }
+
+      flint_tune_reset();
+
+      result = flint_tune_load(filename);
+      for (j = 0; j < FLINT_TUNE_NUM; j++)
+         result = result && (flint_tune_get(j) == tab[j]);
+
+      if (!result)
+      {
+         flint_printf("FAIL (load):\n");
+         flint_printf("i = %d\n", i);
+         abort();
+      }
+   }
+
+   /* comments and unknown names are skipped, bad lines are rejected */
+   flint_tune_reset();
+   file = fopen(filename, "w");
+   fprintf(file, "# comment\n\nNO_SUCH_CUTOFF 5\nNMOD_POLY_GCD_CUTOFF 77\n");
+   fclose(file);
+
+   if (!flint_tune_load(filename) ||
+       flint_tune_get(FLINT_TUNE_NMOD_POLY_GCD) != 77)
+   {
+      flint_printf("FAIL (comments)\n");
+      abort();
+   }
+
+   file = fopen(filename, "w");
+   fprintf(file, "NMOD_POLY_HGCD_CUTOFF 50\nNMOD_POLY_GCD_CUTOFF\n");
+   fclose(file);
+
+   if (flint_tune_load(filename) ||
+       flint_tune_get(FLINT_TUNE_NMOD_POLY_HGCD) != 100)
+   {
+      flint_printf("FAIL (bad line)\n");
+      abort();
+   }
+
+   remove(filename);
+
+   if (flint_tune_load(filename))
+   {
+      flint_printf("FAIL (missing file)\n");
+      abort();
+   }
+
+   /* results do not depend on the crossover points */
+   for (i = 0; i < 100; i++)
+   {
+      nmod_mat_t A, B, C, D;
+      nmod_poly_t a, b, g, h;
+      fmpz_mat_t E, F, G, H;
+      fq_nmod_ctx_t ctx;
+      fq_nmod_poly_t r, s, u, v;
+      mp_limb_t p;
+      fmpz_t q;
+      slong m, n, k;
+
+      for (j = 0; j < FLINT_TUNE_NUM; j++)
+         flint_tune_set(j, n_randint(state, 2 * flint_tune_default(j) + 2));
+
+      p = n_randtest_prime(state, 0);
+
+      m = n_randint(state, 80);
+      n = n_randint(state, 80);
+      k = n_randint(state, 80);
+
+      nmod_mat_init(A, m, n, p);
+      nmod_mat_init(B, n, k, p);
+      nmod_mat_init(C, m, k, p);
+      nmod_mat_init(D, m, k, p);
+      nmod_mat_randtest(A, state);
+      nmod_mat_randtest(B, state);
+      nmod_mat_mul(C, A, B);
+      nmod_mat_mul_classical(D, A, B);
+      result = nmod_mat_equal(C, D);
+
+      nmod_poly_init(a, p);
+      nmod_poly_init(b, p);
+      nmod_poly_init(g, p);
+      nmod_poly_init(h, p);
+      nmod_poly_randtest(a, state, n_randint(state, 600));
+      nmod_poly_randtest(b, state, n_randint(state, 600));
+      nmod_poly_gcd(g, a, b);
+      nmod_poly_gcd_euclidean(h, a, b);
+      result = result && nmod_poly_equal(g, h);
+
+      fmpz_mat_init(E, m, n);
+      fmpz_mat_init(F, n, k);
+      fmpz_mat_init(G, m, k);
+      fmpz_mat_init(H, m, k);
+      fmpz_mat_randtest(E, state, n_randint(state, 100) + 1);
+      fmpz_mat_randtest(F, state, n_randint(state, 100) + 1);
+      fmpz_mat_mul(G, E, F);
+      fmpz_mat_mul_classical(H, E, F);
+      result = result && fmpz_mat_equal(G, H);
+
+      fmpz_init(q);
+      fmpz_set_ui(q, n_randtest_prime(state, 0));
+      fq_nmod_ctx_init(ctx, q, n_randint(state, 4) + 1, "a");
+      fq_nmod_poly_init(r, ctx);
+      fq_nmod_poly_init(s, ctx);
+      fq_nmod_poly_init(u, ctx);
+      fq_nmod_poly_init(v, ctx);
+      fq_nmod_poly_randtest(r, state, n_randint(state, 200), ctx);
+      fq_nmod_poly_randtest(s, state, n_randint(state, 200), ctx);
+      fq_nmod_poly_gcd(u, r, s, ctx);
+      fq_nmod_poly_gcd_euclidean(v, r, s, ctx);
+      result = result && fq_nmod_poly_equal(u, v, ctx);
+      fq_nmod_poly_mul(u, r, s, ctx);
+      fq_nmod_poly_mul_classical(v, r, s, ctx);
+      result = result && fq_nmod_poly_equal(u, v, ctx);
+
+      if (!result)
+      {
+         flint_printf("FAIL (results):\n");
+         for (j = 0; j < FLINT_TUNE_NUM; j++)
+            flint_printf("%s %wd\n", flint_tune_name(j), flint_tune_get(j));
+         abort();
+      }
+
+      nmod_mat_clear(A);
+      nmod_mat_clear(B);
+      nmod_mat_clear(C);
+      nmod_mat_clear(D);
+      nmod_poly_clear(a);
+      nmod_poly_clear(b);
+      nmod_poly_clear(g);
+      nmod_poly_clear(h);
+      fmpz_mat_clear(E);
+      fmpz_mat_clear(F);
+      fmpz_mat_clear(G);
+      fmpz_mat_clear(H);
+      fq_nmod_poly_clear(r, ctx);
+      fq_nmod_poly_clear(s, ctx);
+      fq_nmod_poly_clear(u, ctx);
+      fq_nmod_poly_clear(v, ctx);
+      fq_nmod_ctx_clear(ctx);
+      fmpz_clear(q);
+   }
+
+   flint_tune_reset();
+
+   FLINT_TEST_CLEANUP(state);
+
+   flint_printf("PASS\n");
+   return 0;
+}
@@ -0,0 +1,119 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+typedef struct
+{
+    pthread_t pth;
+    pthread_mutex_t mutex;
+    pthread_cond_t sleep1;  /* signalled when work is given */
+    pthread_cond_t sleep2;  /* signalled when the work is done */
+    volatile int available; /* not reserved by any thread */
+    volatile int working;
+    volatile int exit;
+    int max_workers;
+    void (* fxn)(void *);
+    void * fxnarg;
+}
+thread_pool_entry_struct;
+
+typedef thread_pool_entry_struct thread_pool_entry_t[1];
+
+/*
+   The entries are allocated in blocks which never move as the pool is
+   resized, block k holding the 2^k entries from 2^k - 1 on, so that the
+   threads and the handles held by callers stay valid.
+*/
+typedef struct
+{
+    pthread_mutex_t mutex;
+    slong length;
+    thread_pool_entry_struct * tdata[FLINT_BITS];
+}
+thread_pool_struct;
+
+typedef thread_pool_struct thread_pool_t[1];
+
+typedef slong thread_pool_handle;
+
+static __inline__ thread_pool_entry_struct *
+_thread_pool_entry(thread_pool_t T, thread_pool_handle i)
+{
+    slong k = FLINT_BIT_COUNT(i + 1) - 1;
+
+    return T->tdata[k] + (i + 1 - (WORD(1) << k));
+}
+
+/* Global pool, sized by flint_set_num_threads *******************************/
+
+FLINT_DLL extern int global_thread_pool_initialized;
+
+FLINT_DLL extern thread_pool_t global_thread_pool;
+
+FLINT_DLL slong flint_request_threads(thread_pool_handle ** handles,
+                                                         slong thread_limit);
+
+FLINT_DLL void flint_give_back_threads(thread_pool_handle * handles,
+                                                          slong num_handles);
+
+/* Pools *********************************************************************/
+
+FLINT_DLL void thread_pool_init(thread_pool_t T, slong size);
+
+FLINT_DLL void thread_pool_clear(thread_pool_t T);
+
+FLINT_DLL slong thread_pool_get_size(thread_pool_t T);
+
+FLINT_DLL int thread_pool_set_size(thread_pool_t T, slong new_size);
+
+FLINT_DLL slong thread_pool_request(thread_pool_t T,
+                                  thread_pool_handle * out, slong requested);
+
+FLINT_DLL void thread_pool_wake(thread_pool_t T, thread_pool_handle i,
+                          int max_workers, void (* f)(void *), void * a);
+
+FLINT_DLL void thread_pool_wait(thread_pool_t T, thread_pool_handle i);
+
+FLINT_DLL void thread_pool_give_back(thread_pool_t T, thread_pool_handle i);
+
+FLINT_DLL void * _thread_pool_idle_loop(void * varg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,63 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "thread_pool.h"
+
+/*
+   Body of the threads of a pool. A thread sleeps until it is given a
+   function, runs it with a thread limit of max_workers + 1 so that
+   nested parallel code can request that many threads, and signals
+   that it is done, having added its statistics to the shared table
+   so that they are seen once thread_pool_wait returns. Its caches are
+   freed when it exits.
+*/
+void * _thread_pool_idle_loop(void * varg)
+{
+    thread_pool_entry_struct * D = (thread_pool_entry_struct *) varg;
+
+    pthread_mutex_lock(&D->mutex);
+
+    while (1)
+    {
+        while (!D->working && !D->exit)
+            pthread_cond_wait(&D->sleep1, &D->mutex);
+
+        if (!D->working)
+            break;
+
+        pthread_mutex_unlock(&D->mutex);
+
+        _flint_set_num_workers(D->max_workers);
+        D->fxn(D->fxnarg);
+
+        /* The thread never exits, so hand over its statistics now */
+        _flint_stats_flush();
+
+        pthread_mutex_lock(&D->mutex);
+        D->working = 0;
+        pthread_cond_signal(&D->sleep2);
+    }
+
+    pthread_mutex_unlock(&D->mutex);
+
+    flint_cleanup();
+
+    return NULL;
+}
@@ -0,0 +1,96 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include "thread_pool.h"
+
+/*
+   Threads are started or stopped at the end of the pool, in place, so
+   that the other threads keep running and may be reserved and used by
+   other callers meanwhile. Only available threads can be stopped. They
+   are marked unavailable and joined while the mutex of the pool is held,
+   so that no caller can reserve them.
+*/
+int thread_pool_set_size(thread_pool_t T, slong new_size)
+{
+    thread_pool_entry_struct * D;
+    slong i, k;
+    int res = 1;
+
+    new_size = FLINT_MAX(new_size, 0);
+
+    pthread_mutex_lock(&T->mutex);
+
+    for (i = new_size; i < T->length && res; i++)
+        res = _thread_pool_entry(T, i)->available;
+
+    while (res && T->length > new_size)
+    {
+        D = _thread_pool_entry(T, T->length - 1);
+
+        pthread_mutex_lock(&D->mutex);
+        D->available = 0;
+        D->exit = 1;
+        pthread_cond_signal(&D->sleep1);
+        pthread_mutex_unlock(&D->mutex);
+
+        pthread_join(D->pth, NULL);
+
+        pthread_mutex_destroy(&D->mutex);
+        pthread_cond_destroy(&D->sleep1);
+        pthread_cond_destroy(&D->sleep2);
+
+        T->length--;
+    }
+
+    while (res && T->length < new_size)
+    {
+        k = FLINT_BIT_COUNT(T->length + 1) - 1;
+
+        if (T->tdata[k] == NULL)
+            T->tdata[k] = (thread_pool_entry_struct *) flint_malloc(
+                           (WORD(1) << k)*sizeof(thread_pool_entry_struct));
+
+        D = _thread_pool_entry(T, T->length);
+
+        pthread_mutex_init(&D->mutex, NULL);
+        pthread_cond_init(&D->sleep1, NULL);
+        pthread_cond_init(&D->sleep2, NULL);
+        D->available = 1;
+        D->working = 0;
+        D->exit = 0;
+        D->max_workers = 0;
+        D->fxn = NULL;
+        D->fxnarg = NULL;
+
+        if (pthread_create(&D->pth, NULL, _thread_pool_idle_loop, D) != 0)
+        {
+            pthread_mutex_destroy(&D->mutex);
+            pthread_cond_destroy(&D->sleep1);
+            pthread_cond_destroy(&D->sleep2);
+            res = 0;
+        }
+        else
+            T->length++;
+    }
+
+    pthread_mutex_unlock(&T->mutex);
+
+    return res;
+}
@@ -0,0 +1,242 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "thread_pool.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    ulong * data;
+    slong len;
+    ulong sum;
+    slong limit;
+    slong nested;
+}
+sum_arg_struct;
+
+static void
+sum_worker(void * arg_ptr)
+{
+    sum_arg_struct * arg = (sum_arg_struct *) arg_ptr;
+    thread_pool_handle * threads;
+    slong i;
+
+    arg->sum = 0;
+    for (i = 0; i < arg->len; i++)
+        arg->sum += arg->data[i];
+
+    arg->limit = flint_get_num_threads();
+
+    /* nested requests must stay within the share of this thread */
+    arg->nested = flint_request_threads(&threads, WORD(100));
+    flint_give_back_threads(threads, arg->nested);
+}
+
+/* Resizes the global pool while other threads of the program use it */
+static void *
+caller_thread(void * arg_ptr)
+{
+    flint_rand_t state;
+    thread_pool_handle * threads;
+    sum_arg_struct * args;
+    ulong data[10];
+    slong i, j, num_workers;
+
+    flint_randinit(state);
+
+    /* give each caller its own sequence of sizes */
+    for (i = 0; i < *(slong *) arg_ptr; i++)
+        n_randlimb(state);
+
+    for (j = 0; j < 10 * flint_test_multiplier(); j++)
+    {
+        flint_set_num_threads(1 + n_randint(state, 6));
+
+        num_workers = flint_request_threads(&threads, WORD(100));
+        args = flint_malloc((num_workers + 1) * sizeof(sum_arg_struct));
+
+        for (i = 0; i <= num_workers; i++)
+        {
+            data[i] = i;
+            args[i].data = data + i;
+            args[i].len = 1;
+
+            if (i > 0)
+                thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                                                      sum_worker, &args[i]);
+        }
+
+        for (i = 1; i <= num_workers; i++)
+        {
+            thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+            if (args[i].sum != (ulong) i)
+            {
+                flint_printf("FAIL (concurrent callers):\n");
+                flint_printf("i = %wd, sum = %wu\n", i, args[i].sum);
+                abort();
+            }
+        }
+
+        flint_give_back_threads(threads, num_workers);
+        flint_free(args);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+
+    return NULL;
+}
+
+int
+main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("request....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        thread_pool_handle * threads;
+        sum_arg_struct * args;
+        ulong * data, sum;
+        slong i, n, limit, num_workers, len, max_workers;
+
+        n = 1 + n_randint(state, 5);
+        flint_set_num_threads(n);
+
+        limit = 1 + n_randint(state, 6);
+        num_workers = flint_request_threads(&threads, limit);
+
+        if (num_workers != FLINT_MIN(limit, n) - 1)
+        {
+            flint_printf("FAIL (number of threads):\n");
+            flint_printf("n = %wd, limit = %wd, num_workers = %wd\n",
+                         n, limit, num_workers);
+            abort();
+        }
+
+        len = n_randint(state, 1000);
+        data = flint_malloc((len + 1) * sizeof(ulong));
+        args = flint_malloc((num_workers + 1) * sizeof(sum_arg_struct));
+
+        sum = 0;
+        for (i = 0; i < len; i++)
+        {
+            data[i] = n_randtest(state);
+            sum += data[i];
+        }
+
+        max_workers = n_randint(state, 3);
+
+        for (i = 0; i <= num_workers; i++)
+        {
+            args[i].data = data + (i * len) / (num_workers + 1);
+            args[i].len = ((i + 1) * len) / (num_workers + 1)
+                        - (i * len) / (num_workers + 1);
+
+            if (i > 0)
+                thread_pool_wake(global_thread_pool, threads[i - 1],
+                                 max_workers, sum_worker, &args[i]);
+        }
+
+        _flint_set_num_workers(0);
+        sum_worker(&args[0]);
+        _flint_set_num_workers(n - 1);
+
+        for (i = 1; i <= num_workers; i++)
+            thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+        for (i = 0; i <= num_workers; i++)
+            sum -= args[i].sum;
+
+        if (sum != 0)
+        {
+            flint_printf("FAIL (sum):\n");
+            flint_printf("n = %wd, num_workers = %wd\n", n, num_workers);
+            abort();
+        }
+
+        for (i = 1; i <= num_workers; i++)
+        {
+            if (args[i].limit != max_workers + 1 ||
+                args[i].nested > max_workers ||
+                args[i].nested >
+                    thread_pool_get_size(global_thread_pool) - num_workers)
+            {
+                flint_printf("FAIL (nested limit):\n");
+                flint_printf("n = %wd, max_workers = %wd, limit = %wd, "
+                             "nested = %wd\n", n, max_workers,
+                             args[i].limit, args[i].nested);
+                abort();
+            }
+        }
+
+        if (args[0].limit != 1 || args[0].nested != 0)
+        {
+            flint_printf("FAIL (caller limit):\n");
+            flint_printf("limit = %wd, nested = %wd\n",
+                         args[0].limit, args[0].nested);
+            abort();
+        }
+
+        flint_give_back_threads(threads, num_workers);
+
+        /* all the threads are available again */
+        num_workers = flint_request_threads(&threads, n);
+        if (num_workers != n - 1)
+        {
+            flint_printf("FAIL (give back):\n");
+            flint_printf("n = %wd, num_workers = %wd\n", n, num_workers);
+            abort();
+        }
+        flint_give_back_threads(threads, num_workers);
+
+        flint_free(data);
+        flint_free(args);
+    }
+
+    {
+        pthread_t callers[4];
+        slong i, seeds[4];
+
+        for (i = 0; i < 4; i++)
+        {
+            seeds[i] = i;
+            pthread_create(callers + i, NULL, caller_thread, seeds + i);
+        }
+
+        for (i = 0; i < 4; i++)
+            pthread_join(callers[i], NULL);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
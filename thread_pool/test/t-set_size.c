@@ -0,0 +1,158 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "thread_pool.h"
+#include "ulong_extras.h"
+
+static void
+square_worker(void * arg_ptr)
+{
+    ulong * x = (ulong *) arg_ptr;
+
+    *x = (*x) * (*x);
+}
+
+int
+main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_size....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 50 * flint_test_multiplier(); iter++)
+    {
+        thread_pool_t T;
+        thread_pool_handle * threads;
+        ulong * x;
+        slong i, j, size, new_size, num;
+
+        size = n_randint(state, 5);
+        thread_pool_init(T, size);
+
+        if (thread_pool_get_size(T) != size)
+        {
+            flint_printf("FAIL (init):\n");
+            flint_printf("size = %wd, get_size = %wd\n",
+                         size, thread_pool_get_size(T));
+            abort();
+        }
+
+        new_size = n_randint(state, 5);
+        threads = flint_malloc((size + new_size + 1)
+                                * sizeof(thread_pool_handle));
+        x = flint_malloc((size + new_size + 1) * sizeof(ulong));
+
+        num = thread_pool_request(T, threads, size + 1);
+        if (num != size)
+        {
+            flint_printf("FAIL (request):\n");
+            flint_printf("size = %wd, num = %wd\n", size, num);
+            abort();
+        }
+
+        /* reserved threads cannot be stopped, but the pool can grow */
+        if (thread_pool_set_size(T, new_size) != (new_size >= size) ||
+            thread_pool_get_size(T) != FLINT_MAX(size, new_size))
+        {
+            flint_printf("FAIL (set_size while reserved):\n");
+            flint_printf("size = %wd, new_size = %wd\n", size, new_size);
+            abort();
+        }
+
+        /* the reserved threads keep working */
+        for (i = 0; i < num; i++)
+        {
+            x[i] = i + 2;
+            thread_pool_wake(T, threads[i], 0, square_worker, x + i);
+        }
+
+        for (i = 0; i < num; i++)
+        {
+            thread_pool_wait(T, threads[i]);
+
+            if (x[i] != (i + 2) * (i + 2))
+            {
+                flint_printf("FAIL (wake while resizing):\n");
+                flint_printf("i = %wd, x = %wu\n", i, x[i]);
+                abort();
+            }
+        }
+
+        for (i = 0; i < num; i++)
+            thread_pool_give_back(T, threads[i]);
+
+        if (!thread_pool_set_size(T, new_size) ||
+            thread_pool_get_size(T) != new_size)
+        {
+            flint_printf("FAIL (set_size):\n");
+            flint_printf("size = %wd, new_size = %wd\n", size, new_size);
+            abort();
+        }
+
+        num = thread_pool_request(T, threads, new_size);
+        if (num != new_size)
+        {
+            flint_printf("FAIL (request after set_size):\n");
+            flint_printf("new_size = %wd, num = %wd\n", new_size, num);
+            abort();
+        }
+
+        /* wake each thread a few times */
+        for (j = 0; j < 3; j++)
+        {
+            for (i = 0; i < num; i++)
+            {
+                x[i] = i + j;
+                thread_pool_wake(T, threads[i], 0, square_worker, x + i);
+            }
+
+            for (i = 0; i < num; i++)
+            {
+                thread_pool_wait(T, threads[i]);
+
+                if (x[i] != (i + j) * (i + j))
+                {
+                    flint_printf("FAIL (wake):\n");
+                    flint_printf("i = %wd, j = %wd, x = %wu\n", i, j, x[i]);
+                    abort();
+                }
+            }
+        }
+
+        for (i = 0; i < num; i++)
+            thread_pool_give_back(T, threads[i]);
+
+        thread_pool_clear(T);
+
+        flint_free(threads);
+        flint_free(x);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
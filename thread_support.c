@@ -24,16 +24,94 @@
 ******************************************************************************/
 
 #include "flint.h"
+#include "thread_pool.h"
 
 FLINT_TLS_PREFIX int _flint_num_threads = 1;
 
+int global_thread_pool_initialized = 0;
+
+thread_pool_t global_thread_pool;
+
+static pthread_mutex_t global_thread_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+
 int flint_get_num_threads()
 {
     return _flint_num_threads;
 }
 
+void _flint_set_num_workers(int num_workers)
+{
+    _flint_num_threads = num_workers + 1;
+}
+
+/*
+   Besides the limit of the current thread, makes sure the global pool,
+   which all threads share, has at least num_threads - 1 threads. The
+   pool is created once and only ever grown in place, so that threads
+   reserved by other callers are unaffected; each thread uses no more of
+   it than its own limit. If the pool cannot be grown that far, the limit
+   is lowered to what the pool offers.
+*/
 void flint_set_num_threads(int num_threads)
 {
+    slong size;
+
+    if (num_threads > 1)
+    {
+        pthread_mutex_lock(&global_thread_pool_lock);
+
+        if (!global_thread_pool_initialized)
+        {
+            thread_pool_init(global_thread_pool, 0);
+            global_thread_pool_initialized = 1;
+        }
+
+        size = thread_pool_get_size(global_thread_pool);
+
+        if (size < num_threads - 1 &&
+            !thread_pool_set_size(global_thread_pool, num_threads - 1))
+        {
+            size = thread_pool_get_size(global_thread_pool);
+            num_threads = size + 1;
+        }
+
+        pthread_mutex_unlock(&global_thread_pool_lock);
+    }
+
     _flint_num_threads = num_threads;
 }
 
+slong flint_request_threads(thread_pool_handle ** handles, slong thread_limit)
+{
+    slong num_handles = 0;
+
+    thread_limit = FLINT_MIN(thread_limit, flint_get_num_threads());
+
+    *handles = NULL;
+
+    /*
+       A limit above one was set by flint_set_num_threads, in this thread
+       or in the one which woke it, after the pool was created
+    */
+    if (thread_limit > 1 && global_thread_pool_initialized)
+    {
+        *handles = (thread_pool_handle *) flint_malloc(
+                               (thread_limit - 1)*sizeof(thread_pool_handle));
+        num_handles = thread_pool_request(global_thread_pool, *handles,
+                                                             thread_limit - 1);
+    }
+
+    return num_handles;
+}
+
+void flint_give_back_threads(thread_pool_handle * handles, slong num_handles)
+{
+    slong i;
+
+    for (i = 0; i < num_handles; i++)
+        thread_pool_give_back(global_thread_pool, handles[i]);
+
+    if (handles != NULL)
+        flint_free(handles);
+}
+
@@ -0,0 +1,476 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+/*
+   Measures the crossover points of flint_tune_param on this machine and
+   writes them to a tuning file, by default flint_tuning.txt. Each value
+   is chosen from a range of candidates by timing the dispatching
+   function at a range of sizes with every candidate set, and keeping
+   the candidate with the smallest total time relative to the best time
+   at each size. Parameters are tuned in order, so later ones are timed
+   with the values found for earlier ones.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <gmp.h>
+#include "flint.h"
+#include "profiler.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "fmpz_mod_poly.h"
+#include "fq_poly.h"
+#include "fq_nmod_poly.h"
+#include "fq_zech_poly.h"
+
+/* Largest number of candidates for one parameter */
+#define TUNE_MAX_POINTS 16
+
+/* Ratio between consecutive candidates */
+#define TUNE_RATIO 1.4142
+
+/* Minimum duration of a timing in microseconds, and number of timings */
+#define TUNE_MIN_TIME 2000.0
+#define TUNE_REPEATS 3
+
+typedef enum
+{
+   TUNE_NMOD_MAT_MUL,
+   TUNE_FMPZ_MAT_MUL,
+   TUNE_NMOD_POLY_MUL,
+   TUNE_NMOD_POLY_GCD,
+   TUNE_NMOD_POLY_GCD_HGCD,
+   TUNE_FMPZ_MOD_POLY_GCD,
+   TUNE_FMPZ_MOD_POLY_GCD_HGCD,
+   TUNE_FQ_POLY_MUL,
+   TUNE_FQ_POLY_GCD,
+   TUNE_FQ_POLY_GCD_HGCD,
+   TUNE_FQ_NMOD_POLY_MUL,
+   TUNE_FQ_NMOD_POLY_GCD,
+   TUNE_FQ_NMOD_POLY_GCD_HGCD,
+   TUNE_FQ_ZECH_POLY_MUL,
+   TUNE_FQ_ZECH_POLY_GCD,
+   TUNE_FQ_ZECH_POLY_GCD_HGCD
+} tune_kind;
+
+typedef struct
+{
+   flint_tune_param param;
+   tune_kind kind;
+   slong bits;    /* bits of the characteristic, or of matrix entries */
+   slong deg;     /* degree of finite fields */
+   slong lo, hi;  /* range of candidate values */
+   slong scale;   /* the sizes timed are the candidates times scale */
+} tune_case;
+
+/*
+   Recursion cutoffs are timed at sizes well above the candidates, so
+   that every level of the recursion is exercised.
+*/
+static const tune_case tune_cases[FLINT_TUNE_NUM] =
+{
+   { FLINT_TUNE_NMOD_MAT_MUL_STRASSEN, TUNE_NMOD_MAT_MUL,
+                       NMOD_MAT_OPTIMAL_MODULUS_BITS, 0, 64, 512, 1 },
+   { FLINT_TUNE_FMPZ_MAT_MUL_CLASSICAL, TUNE_FMPZ_MAT_MUL,
+                                                    16, 0, 4, 48, 1 },
+   { FLINT_TUNE_FMPZ_MAT_MUL_MULTI_MOD, TUNE_FMPZ_MAT_MUL,
+                                       FLINT_BITS / 2, 0, 16, 192, 1 },
+   { FLINT_TUNE_NMOD_POLY_MUL_NTT, TUNE_NMOD_POLY_MUL,
+                                       FLINT_BITS - 1, 0, 256, 8192, 1 },
+   { FLINT_TUNE_NMOD_POLY_HGCD, TUNE_NMOD_POLY_GCD_HGCD,
+                                       FLINT_BITS - 4, 0, 25, 400, 4 },
+   { FLINT_TUNE_NMOD_POLY_GCD, TUNE_NMOD_POLY_GCD,
+                                       FLINT_BITS - 4, 0, 64, 1024, 1 },
+   { FLINT_TUNE_NMOD_POLY_SMALL_GCD, TUNE_NMOD_POLY_GCD,
+                                                     8, 0, 64, 1024, 1 },
+   { FLINT_TUNE_FMPZ_MOD_POLY_HGCD, TUNE_FMPZ_MOD_POLY_GCD_HGCD,
+                                       2 * FLINT_BITS, 0, 32, 512, 4 },
+   { FLINT_TUNE_FMPZ_MOD_POLY_GCD, TUNE_FMPZ_MOD_POLY_GCD,
+                                       2 * FLINT_BITS, 0, 64, 1024, 1 },
+   { FLINT_TUNE_FQ_MUL_CLASSICAL, TUNE_FQ_POLY_MUL,
+                                       FLINT_BITS - 4, 4, 2, 64, 1 },
+   { FLINT_TUNE_FQ_POLY_HGCD, TUNE_FQ_POLY_GCD_HGCD,
+                                       FLINT_BITS - 4, 4, 16, 128, 4 },
+   { FLINT_TUNE_FQ_POLY_GCD, TUNE_FQ_POLY_GCD,
+                                       FLINT_BITS - 4, 4, 32, 256, 1 },
+   { FLINT_TUNE_FQ_POLY_SMALL_GCD, TUNE_FQ_POLY_GCD,
+                                                     3, 8, 32, 256, 1 },
+   { FLINT_TUNE_FQ_NMOD_MUL_CLASSICAL, TUNE_FQ_NMOD_POLY_MUL,
+                                       FLINT_BITS - 4, 4, 2, 64, 1 },
+   { FLINT_TUNE_FQ_NMOD_POLY_HGCD, TUNE_FQ_NMOD_POLY_GCD_HGCD,
+                                       FLINT_BITS - 4, 4, 16, 128, 4 },
+   { FLINT_TUNE_FQ_NMOD_POLY_GCD, TUNE_FQ_NMOD_POLY_GCD,
+                                       FLINT_BITS - 4, 4, 32, 256, 1 },
+   { FLINT_TUNE_FQ_NMOD_POLY_SMALL_GCD, TUNE_FQ_NMOD_POLY_GCD,
+                                                     3, 8, 32, 256, 1 },
+   { FLINT_TUNE_FQ_ZECH_MUL_CLASSICAL, TUNE_FQ_ZECH_POLY_MUL,
+                                                    10, 2, 8, 256, 1 },
+   { FLINT_TUNE_FQ_ZECH_POLY_HGCD, TUNE_FQ_ZECH_POLY_GCD_HGCD,
+                                                    10, 2, 16, 128, 4 },
+   { FLINT_TUNE_FQ_ZECH_POLY_GCD, TUNE_FQ_ZECH_POLY_GCD,
+                                                    10, 2, 32, 256, 1 },
+   { FLINT_TUNE_FQ_ZECH_POLY_SMALL_GCD, TUNE_FQ_ZECH_POLY_GCD,
+                                                     3, 8, 32, 256, 1 }
+};
+
+typedef struct
+{
+   const tune_case * c;
+   slong n;
+   flint_rand_s * state;
+} tune_arg_struct;
+
+static void
+tune_prime(fmpz_t p, slong bits)
+{
+   fmpz_zero(p);
+   fmpz_setbit(p, bits - 1);
+
+   while (!fmpz_is_probabprime(p))
+      fmpz_add_ui(p, p, 1);
+}
+
+static void
+tune_nmod_mat_mul(void * arg_ptr, ulong count)
+{
+   tune_arg_struct * arg = (tune_arg_struct *) arg_ptr;
+   mp_limb_t p = n_nextprime(UWORD(1) << (arg->c->bits - 1), 1);
+   nmod_mat_t A, B, C;
+   ulong i;
+
+   nmod_mat_init(A, arg->n, arg->n, p);
+   nmod_mat_init(B, arg->n, arg->n, p);
+   nmod_mat_init(C, arg->n, arg->n, p);
+   nmod_mat_randfull(A, arg->state);
+   nmod_mat_randfull(B, arg->state);
+
+   prof_start();
+   for (i = 0; i < count; i++)
+      nmod_mat_mul(C, A, B);
+   prof_stop();
+
+   nmod_mat_clear(A);
+   nmod_mat_clear(B);
+   nmod_mat_clear(C);
+}
+
+static void
+tune_fmpz_mat_mul(void * arg_ptr, ulong count)
+{
+   tune_arg_struct * arg = (tune_arg_struct *) arg_ptr;
+   fmpz_mat_t A, B, C;
+   ulong i;
+
+   fmpz_mat_init(A, arg->n, arg->n);
+   fmpz_mat_init(B, arg->n, arg->n);
+   fmpz_mat_init(C, arg->n, arg->n);
+   fmpz_mat_randbits(A, arg->state, arg->c->bits);
+   fmpz_mat_randbits(B, arg->state, arg->c->bits);
+
+   prof_start();
+   for (i = 0; i < count; i++)
+      fmpz_mat_mul(C, A, B);
+   prof_stop();
+
+   fmpz_mat_clear(A);
+   fmpz_mat_clear(B);
+   fmpz_mat_clear(C);
+}
+
+static void
+tune_nmod_poly_mul(void * arg_ptr, ulong count)
+{
+   tune_arg_struct * arg = (tune_arg_struct *) arg_ptr;
+   mp_limb_t p = n_nextprime(UWORD(1) << (arg->c->bits - 1), 1);
+   nmod_poly_t A, B, C;
+   ulong i;
+
+   nmod_poly_init(A, p);
+   nmod_poly_init(B, p);
+   nmod_poly_init(C, p);
+   nmod_poly_randtest(A, arg->state, arg->n);
+   nmod_poly_randtest(B, arg->state, arg->n);
+
+   prof_start();
+   for (i = 0; i < count; i++)
+      nmod_poly_mul(C, A, B);
+   prof_stop();
+
+   nmod_poly_clear(A);
+   nmod_poly_clear(B);
+   nmod_poly_clear(C);
+}
+
+static void
+tune_nmod_poly_gcd(void * arg_ptr, ulong count)
+{
+   tune_arg_struct * arg = (tune_arg_struct *) arg_ptr;
+   mp_limb_t p = n_nextprime(UWORD(1) << (arg->c->bits - 1), 1);
+   nmod_poly_t A, B, G;
+   ulong i;
+
+   nmod_poly_init(A, p);
+   nmod_poly_init(B, p);
+   nmod_poly_init(G, p);
+   nmod_poly_randtest(A, arg->state, arg->n);
+   nmod_poly_randtest(B, arg->state, arg->n - 1);
+
+   prof_start();
+   for (i = 0; i < count; i++)
+   {
+      if (arg->c->kind == TUNE_NMOD_POLY_GCD_HGCD)
+         nmod_poly_gcd_hgcd(G, A, B);
+      else
+         nmod_poly_gcd(G, A, B);
+   }
+   prof_stop();
+
+   nmod_poly_clear(A);
+   nmod_poly_clear(B);
+   nmod_poly_clear(G);
+}
+
+static void
+tune_fmpz_mod_poly_gcd(void * arg_ptr, ulong count)
+{
+   tune_arg_struct * arg = (tune_arg_struct *) arg_ptr;
+   fmpz_mod_poly_t A, B, G;
+   fmpz_t p;
+   ulong i;
+
+   fmpz_init(p);
+   tune_prime(p, arg->c->bits);
+
+   fmpz_mod_poly_init(A, p);
+   fmpz_mod_poly_init(B, p);
+   fmpz_mod_poly_init(G, p);
+   fmpz_mod_poly_randtest(A, arg->state, arg->n);
+   fmpz_mod_poly_randtest(B, arg->state, arg->n - 1);
+
+   prof_start();
+   for (i = 0; i < count; i++)
+   {
+      if (arg->c->kind == TUNE_FMPZ_MOD_POLY_GCD_HGCD)
+         fmpz_mod_poly_gcd_hgcd(G, A, B);
+      else
+         fmpz_mod_poly_gcd(G, A, B);
+   }
+   prof_stop();
+
+   fmpz_mod_poly_clear(A);
+   fmpz_mod_poly_clear(B);
+   fmpz_mod_poly_clear(G);
+   fmpz_clear(p);
+}
+
+/*
+   Multiplication, gcd and half gcd gcd of polynomials over the finite
+   field of characteristic the first prime of the given bits and degree
+   deg, for each of the three implementations of finite fields.
+*/
+#define TUNE_FQ_POLY(T, KIND)                                             \
+static void                                                               \
+tune_##T##_poly(void * arg_ptr, ulong count)                              \
+{                                                                         \
+   tune_arg_struct * arg = (tune_arg_struct *) arg_ptr;                   \
+   T##_ctx_t ctx;                                                         \
+   T##_poly_t A, B, G;                                                    \
+   fmpz_t p;                                                              \
+   ulong i;                                                               \
+                                                                          \
+   fmpz_init(p);                                                          \
+   tune_prime(p, arg->c->bits);                                           \
+   T##_ctx_init(ctx, p, arg->c->deg, "a");                                \
+                                                                          \
+   T##_poly_init(A, ctx);                                                 \
+   T##_poly_init(B, ctx);                                                 \
+   T##_poly_init(G, ctx);                                                 \
+   T##_poly_randtest(A, arg->state, arg->n, ctx);                        \
+   T##_poly_randtest(B, arg->state, arg->n - 1, ctx);                    \
+                                                                          \
+   prof_start();                                                          \
+   for (i = 0; i < count; i++)                                            \
+   {                                                                      \
+      if (arg->c->kind == KIND##_POLY_MUL)                                \
+         T##_poly_mul(G, A, B, ctx);                                      \
+      else if (arg->c->kind == KIND##_POLY_GCD_HGCD)                      \
+         T##_poly_gcd_hgcd(G, A, B, ctx);                                 \
+      else                                                                \
+         T##_poly_gcd(G, A, B, ctx);                                      \
+   }                                                                      \
+   prof_stop();                                                           \
+                                                                          \
+   T##_poly_clear(A, ctx);                                                \
+   T##_poly_clear(B, ctx);                                                \
+   T##_poly_clear(G, ctx);                                                \
+   T##_ctx_clear(ctx);                                                    \
+   fmpz_clear(p);                                                         \
+}
+
+TUNE_FQ_POLY(fq, TUNE_FQ)
+TUNE_FQ_POLY(fq_nmod, TUNE_FQ_NMOD)
+TUNE_FQ_POLY(fq_zech, TUNE_FQ_ZECH)
+
+static profile_target_t
+tune_target(tune_kind kind)
+{
+   switch (kind)
+   {
+      case TUNE_NMOD_MAT_MUL:
+         return tune_nmod_mat_mul;
+      case TUNE_FMPZ_MAT_MUL:
+         return tune_fmpz_mat_mul;
+      case TUNE_NMOD_POLY_MUL:
+         return tune_nmod_poly_mul;
+      case TUNE_NMOD_POLY_GCD:
+      case TUNE_NMOD_POLY_GCD_HGCD:
+         return tune_nmod_poly_gcd;
+      case TUNE_FMPZ_MOD_POLY_GCD:
+      case TUNE_FMPZ_MOD_POLY_GCD_HGCD:
+         return tune_fmpz_mod_poly_gcd;
+      case TUNE_FQ_POLY_MUL:
+      case TUNE_FQ_POLY_GCD:
+      case TUNE_FQ_POLY_GCD_HGCD:
+         return tune_fq_poly;
+      case TUNE_FQ_NMOD_POLY_MUL:
+      case TUNE_FQ_NMOD_POLY_GCD:
+      case TUNE_FQ_NMOD_POLY_GCD_HGCD:
+         return tune_fq_nmod_poly;
+      default:
+         return tune_fq_zech_poly;
+   }
+}
+
+/* Time per call of target in microseconds, the best of TUNE_REPEATS */
+static double
+tune_time(profile_target_t target, void * arg)
+{
+   double t, best = DBL_MAX;
+   ulong count = 1;
+   int i = 0;
+
+   while (i < TUNE_REPEATS)
+   {
+      init_clock(0);
+      target(arg, count);
+      t = get_clock(0);
+
+      if (t < TUNE_MIN_TIME)
+         count *= 2;
+      else
+      {
+         best = FLINT_MIN(best, t / count);
+         i++;
+      }
+   }
+
+   return best;
+}
+
+static slong
+tune_param(const tune_case * c, flint_rand_t state)
+{
+   double t[TUNE_MAX_POINTS][TUNE_MAX_POINTS];
+   double score, best_score = DBL_MAX, best_t;
+   slong cand[TUNE_MAX_POINTS];
+   slong i, j, k, l, best = 0;
+   tune_arg_struct arg;
+
+   cand[0] = c->lo;
+   for (k = 1; k < TUNE_MAX_POINTS && cand[k - 1] < c->hi; k++)
+      cand[k] = FLINT_MIN(c->hi, FLINT_MAX(cand[k - 1] + 1,
+                                  (slong) (cand[k - 1] * TUNE_RATIO + 0.5)));
+
+   arg.c = c;
+   arg.state = state;
+
+   for (j = 0; j < k; j++)
+   {
+      arg.n = cand[j] * c->scale;
+
+      for (i = 0; i < k; i++)
+      {
+         flint_tune_set(c->param, cand[i]);
+         t[i][j] = tune_time(tune_target(c->kind), &arg);
+      }
+   }
+
+   for (i = 0; i < k; i++)
+   {
+      score = 0.0;
+
+      for (j = 0; j < k; j++)
+      {
+         best_t = DBL_MAX;
+         for (l = 0; l < k; l++)
+            best_t = FLINT_MIN(best_t, t[l][j]);
+
+         score += t[i][j] / best_t;
+      }
+
+      if (score < best_score)
+      {
+         best_score = score;
+         best = i;
+      }
+   }
+
+   return cand[best];
+}
+
+int
+main(int argc, char * argv[])
+{
+   const char * filename = (argc > 1) ? argv[1] : "flint_tuning.txt";
+   slong i, value;
+
+   FLINT_TEST_INIT(state);
+
+   /* Start from the defaults, not from a file named by FLINT_TUNE_FILE */
+   flint_tune_reset();
+
+   for (i = 0; i < FLINT_TUNE_NUM; i++)
+   {
+      flint_printf("%s...", flint_tune_name(tune_cases[i].param));
+      fflush(stdout);
+
+      value = tune_param(tune_cases + i, state);
+      flint_tune_set(tune_cases[i].param, value);
+
+      flint_printf("%wd (default %wd)\n", value,
+                                    flint_tune_default(tune_cases[i].param));
+   }
+
+   if (!flint_tune_save(filename))
+   {
+      flint_printf("Could not write %s\n", filename);
+      abort();
+   }
+
+   flint_printf("Written to %s\n", filename);
+
+   FLINT_TEST_CLEANUP(state);
+
+   return 0;
+}
@@ -0,0 +1,182 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "flint.h"
+
+/*
+   Default values and smallest allowed values of the crossover points,
+   in the order of flint_tune_param. The names, with _CUTOFF appended,
+   are those of the macros in the module headers and of tuning files.
+*/
+#define FLINT_TUNE_LIST(X)                      \
+   X(NMOD_MAT_MUL_STRASSEN,      256, 16)       \
+   X(FMPZ_MAT_MUL_CLASSICAL,      12,  1)       \
+   X(FMPZ_MAT_MUL_MULTI_MOD,      60,  0)       \
+   X(NMOD_POLY_MUL_NTT,         1024, 16)       \
+   X(NMOD_POLY_HGCD,             100, 16)       \
+   X(NMOD_POLY_GCD,              340, 16)       \
+   X(NMOD_POLY_SMALL_GCD,        200, 16)       \
+   X(FMPZ_MOD_POLY_HGCD,         128, 16)       \
+   X(FMPZ_MOD_POLY_GCD,          256, 16)       \
+   X(FQ_MUL_CLASSICAL,             6,  1)       \
+   X(FQ_POLY_HGCD,                30, 16)       \
+   X(FQ_POLY_GCD,                 90, 16)       \
+   X(FQ_POLY_SMALL_GCD,           80, 16)       \
+   X(FQ_NMOD_MUL_CLASSICAL,        6,  1)       \
+   X(FQ_NMOD_POLY_HGCD,           25, 16)       \
+   X(FQ_NMOD_POLY_GCD,           120, 16)       \
+   X(FQ_NMOD_POLY_SMALL_GCD,     110, 16)       \
+   X(FQ_ZECH_MUL_CLASSICAL,       90,  1)       \
+   X(FQ_ZECH_POLY_HGCD,           35, 16)       \
+   X(FQ_ZECH_POLY_GCD,            96, 16)       \
+   X(FQ_ZECH_POLY_SMALL_GCD,      96, 16)
+
+#define TUNE_NAME(name, value, min) #name "_CUTOFF",
+#define TUNE_VALUE(name, value, min) value,
+#define TUNE_MIN(name, value, min) min,
+
+static const char * flint_tune_names[FLINT_TUNE_NUM] =
+   { FLINT_TUNE_LIST(TUNE_NAME) };
+
+static const slong flint_tune_defaults[FLINT_TUNE_NUM] =
+   { FLINT_TUNE_LIST(TUNE_VALUE) };
+
+static const slong flint_tune_mins[FLINT_TUNE_NUM] =
+   { FLINT_TUNE_LIST(TUNE_MIN) };
+
+/*
+   Shared by all threads: the crossover points are a property of the
+   host, and are meant to be set before any computation is started.
+*/
+slong flint_tune_tab[FLINT_TUNE_NUM] = { FLINT_TUNE_LIST(TUNE_VALUE) };
+
+void flint_tune_set(flint_tune_param param, slong value)
+{
+   flint_tune_tab[param] = FLINT_MAX(value, flint_tune_mins[param]);
+}
+
+slong flint_tune_default(flint_tune_param param)
+{
+   return flint_tune_defaults[param];
+}
+
+slong flint_tune_min(flint_tune_param param)
+{
+   return flint_tune_mins[param];
+}
+
+const char * flint_tune_name(flint_tune_param param)
+{
+   return flint_tune_names[param];
+}
+
+int flint_tune_lookup(const char * name)
+{
+   int i;
+
+   for (i = 0; i < FLINT_TUNE_NUM; i++)
+      if (strcmp(name, flint_tune_names[i]) == 0)
+         return i;
+
+   return -1;
+}
+
+void flint_tune_reset(void)
+{
+   int i;
+
+   for (i = 0; i < FLINT_TUNE_NUM; i++)
+      flint_tune_tab[i] = flint_tune_defaults[i];
+}
+
+/*
+   Reads lines "NAME value" from the given file, or from the file named
+   by the environment variable FLINT_TUNE_FILE if filename is NULL.
+   Empty lines and lines starting with # are skipped, as are unknown
+   names so that files written by other versions can be read. Nothing
+   is changed unless the whole file can be parsed.
+*/
+int flint_tune_load(const char * filename)
+{
+   slong tab[FLINT_TUNE_NUM];
+   char line[256], name[64];
+   FILE * file;
+   slong value;
+   int i, n, res = 1;
+
+   if (filename == NULL)
+      filename = getenv("FLINT_TUNE_FILE");
+
+   if (filename == NULL || (file = fopen(filename, "r")) == NULL)
+      return 0;
+
+   for (i = 0; i < FLINT_TUNE_NUM; i++)
+      tab[i] = flint_tune_tab[i];
+
+   while (res && fgets(line, sizeof(line), file) != NULL)
+   {
+      if (sscanf(line, "%63s%n", name, &n) != 1 || name[0] == '#')
+         continue;
+
+      if (flint_sscanf(line + n, "%wd", &value) != 1)
+         res = 0;
+      else if ((i = flint_tune_lookup(name)) >= 0)
+         tab[i] = FLINT_MAX(value, flint_tune_mins[i]);
+   }
+
+   fclose(file);
+
+   if (res)
+      for (i = 0; i < FLINT_TUNE_NUM; i++)
+         flint_tune_tab[i] = tab[i];
+
+   return res;
+}
+
+int flint_tune_save(const char * filename)
+{
+   FILE * file;
+   int i, res;
+
+   if ((file = fopen(filename, "w")) == NULL)
+      return 0;
+
+   res = (flint_fprintf(file, "# FLINT tuning file\n") > 0);
+
+   for (i = 0; i < FLINT_TUNE_NUM && res; i++)
+      res = (flint_fprintf(file, "%s %wd\n", flint_tune_names[i],
+                                                   flint_tune_tab[i]) > 0);
+
+   return (fclose(file) == 0) && res;
+}
+
+#if defined(__GNUC__)
+
+/* Picks up FLINT_TUNE_FILE before main is entered */
+static void __attribute__((constructor)) _flint_tune_init(void)
+{
+   if (getenv("FLINT_TUNE_FILE") != NULL)
+      flint_tune_load(NULL);
+}
+
+#endif
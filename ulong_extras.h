@@ -65,9 +65,22 @@ typedef struct {
 #define FLINT_FACTOR_ONE_LINE_MAX (UWORD(1)<<39)
 #define FLINT_FACTOR_ONE_LINE_ITERS 40000
 
+/* Number of independent Montgomery chains interleaved by n_is_prime_vec */
+#define FLINT_IS_PRIME_VEC_LANES 8
+
+/* Number of integers trial divided together by n_factor_vec */
+#define FLINT_FACTOR_VEC_BLOCK 256
+
 #define FLINT_PRIME_PI_ODD_LOOKUP_CUTOFF 311
 
-#define FLINT_SIEVE_SIZE 65536
+/* Above this, primes are counted without tabulating them */
+#define FLINT_PRIME_PI_TABLE_CUTOFF UWORD(1000000)
+
+/* Bytes of the mod 30 wheel sieve per block, sized for the L1 cache */
+#define FLINT_SIEVE_WHEEL_BYTES 16384
+
+/* Largest range of integers sieved at once, in blocks of the above */
+#define FLINT_SIEVE_SIZE (30 * 16 * FLINT_SIEVE_WHEEL_BYTES)
 
 #if FLINT64
 #define UWORD_MAX_PRIME UWORD(18446744073709551557)
@@ -85,7 +98,7 @@ typedef struct
     mp_limb_t sieve_b;
     slong sieve_i;
     slong sieve_num;
-    char * sieve;
+    unsigned char * sieve;
 }
 n_primes_struct;
 
@@ -99,19 +112,52 @@ FLINT_DLL void n_primes_extend_small(n_primes_t iter, mp_limb_t bound);
 
 FLINT_DLL void n_primes_sieve_range(n_primes_t iter, mp_limb_t a, mp_limb_t b);
 
+FLINT_DLL void n_sieve_wheel(unsigned char * sieve, slong bytes, mp_limb_t a,
+                       const unsigned int * sieve_primes, mp_limb_t bound);
+
+FLINT_DLL slong n_sieve_wheel_primes(mp_ptr res, const unsigned char * sieve,
+                  slong bytes, mp_limb_t a, mp_limb_t lo, mp_limb_t hi);
+
+typedef int (*n_primes_range_func)(const mp_limb_t * primes,
+                                                   slong num, void * arg);
+
+FLINT_DLL void n_primes_range_threaded(mp_limb_t a, mp_limb_t b,
+                                     n_primes_range_func func, void * arg);
+
 FLINT_DLL void n_primes_jump_after(n_primes_t iter, mp_limb_t n);
 
+extern const unsigned char flint_sieve_wheel[];
+
 static __inline__ mp_limb_t
 n_primes_next(n_primes_t iter)
 {
+    slong i;
+    mp_limb_t j, t;
+
     if (iter->small_i < iter->small_num)
         return iter->small_primes[(iter->small_i)++];
 
     for (;;)
     {
+        /* sieve_i is the next bit of the wheel sieve to look at */
         while (iter->sieve_i < iter->sieve_num)
-            if (iter->sieve[iter->sieve_i++] != 0)
-                return iter->sieve_a + 2 * (iter->sieve_i - 1);
+        {
+            i = iter->sieve_i;
+            t = iter->sieve[i / 8] >> (i % 8);
+
+            if (t == 0)
+            {
+                iter->sieve_i = (i | 7) + 1;
+                continue;
+            }
+
+            count_trailing_zeros(j, t);
+            i += j;
+            iter->sieve_i = i + 1;
+
+            return iter->sieve_a + 30 * (mp_limb_t) (i / 8)
+                                 + flint_sieve_wheel[i % 8];
+        }
 
         if (iter->sieve_b == 0)
             n_primes_jump_after(iter, iter->small_primes[iter->small_num-1]);
@@ -196,6 +242,20 @@ FLINT_DLL mp_limb_t n_mulmod2_preinv(mp_limb_t a, mp_limb_t b,
 FLINT_DLL mp_limb_t n_mulmod_preinv(mp_limb_t a, mp_limb_t b, 
                             mp_limb_t n, mp_limb_t ninv, ulong norm);
 
+FLINT_DLL mp_limb_t n_mulmod_precomp_shoup(mp_limb_t w, mp_limb_t n);
+
+static __inline__
+mp_limb_t n_mulmod_shoup(mp_limb_t w, mp_limb_t t,
+                                           mp_limb_t w_precomp, mp_limb_t n)
+{
+   mp_limb_t q, r, p_lo;
+
+   umul_ppmm(q, p_lo, w_precomp, t);
+   r = w * t - q * n;
+
+   return (r >= n) ? r - n : r;
+}
+
 FLINT_DLL mp_limb_t n_powmod_ui_precomp(mp_limb_t a, mp_limb_t exp, mp_limb_t n, double npre);
 
 FLINT_DLL mp_limb_t n_powmod_precomp(mp_limb_t a, 
@@ -303,12 +363,16 @@ FLINT_DLL int n_is_prime_pocklington(mp_limb_t n, ulong iterations);
 
 FLINT_DLL int n_is_prime(mp_limb_t n);
 
+FLINT_DLL void n_is_prime_vec(int * res, mp_srcptr n, slong len);
+
 FLINT_DLL mp_limb_t n_nth_prime(ulong n);
 
 FLINT_DLL void n_nth_prime_bounds(mp_limb_t *lo, mp_limb_t *hi, ulong n);
 
 FLINT_DLL ulong n_prime_pi(mp_limb_t n);
 
+FLINT_DLL ulong n_prime_pi_lmo(mp_limb_t x);
+
 FLINT_DLL void n_prime_pi_bounds(ulong *lo, ulong *hi, mp_limb_t n);
 
 FLINT_DLL int n_remove(mp_limb_t * n, mp_limb_t p);
@@ -345,6 +409,12 @@ FLINT_DLL mp_limb_t n_factor_SQUFOF(mp_limb_t n, ulong iters);
 
 FLINT_DLL void n_factor(n_factor_t * factors, mp_limb_t n, int proved);
 
+FLINT_DLL void _n_factor_composite(n_factor_t * factors, mp_limb_t n,
+                                                               int proved);
+
+FLINT_DLL void n_factor_vec(n_factor_t * factors, mp_srcptr n, slong len,
+                                                               int proved);
+
 FLINT_DLL mp_limb_t n_factor_pp1(mp_limb_t n, ulong B1, ulong c);
 
 FLINT_DLL int n_is_squarefree(mp_limb_t n);
@@ -63,6 +63,34 @@ FLINT_TLS_PREFIX mp_limb_t * _flint_primes[FLINT_BITS];
 FLINT_TLS_PREFIX double * _flint_prime_inverses[FLINT_BITS];
 FLINT_TLS_PREFIX int _flint_primes_used = 0;
 
+typedef struct
+{
+    mp_limb_t * primes;
+    double * inverses;
+    ulong num;
+    ulong len;
+}
+compute_primes_arg_t;
+
+static int
+_n_compute_primes_func(const mp_limb_t * primes, slong num, void * arg_ptr)
+{
+    compute_primes_arg_t * arg = (compute_primes_arg_t *) arg_ptr;
+    slong i;
+
+    num = FLINT_MIN(num, arg->len - arg->num);
+
+    for (i = 0; i < num; i++)
+    {
+        arg->primes[arg->num + i] = primes[i];
+        arg->inverses[arg->num + i] = n_precompute_inverse(primes[i]);
+    }
+
+    arg->num += num;
+
+    return arg->num == arg->len;
+}
+
 #if FLINT_REENTRANT && !HAVE_TLS
 void n_compute_primes_init()
 {
@@ -88,19 +116,25 @@ n_compute_primes(ulong num_primes)
 
     if (m >= _flint_primes_used)
     {
-        n_primes_t iter;
+        compute_primes_arg_t arg;
+        mp_limb_t lo, hi;
 
         num_computed = UWORD(1) << m;
         _flint_primes[m] = flint_malloc(sizeof(mp_limb_t) * num_computed);
         _flint_prime_inverses[m] = flint_malloc(sizeof(double) * num_computed);
 
-        n_primes_init(iter);
-        for (i = 0; i < num_computed; i++)
-        {
-            _flint_primes[m][i] = n_primes_next(iter);
-            _flint_prime_inverses[m][i] = n_precompute_inverse(_flint_primes[m][i]);
-        }
-        n_primes_clear(iter);
+        /* Sieve up to a bound for the last prime, in segments over threads */
+        if (num_computed < 16)
+            hi = 47;
+        else
+            n_nth_prime_bounds(&lo, &hi, num_computed);
+
+        arg.primes = _flint_primes[m];
+        arg.inverses = _flint_prime_inverses[m];
+        arg.num = 0;
+        arg.len = num_computed;
+
+        n_primes_range_threaded(2, hi, _n_compute_primes_func, &arg);
 
         /* copy to lower power-of-two slots */
         for (i = m - 1; i >= _flint_primes_used; i--)
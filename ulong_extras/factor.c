@@ -37,7 +37,11 @@ static int is_prime(mp_limb_t n, int proved)
     return proved ? n_is_prime(n) : n_is_probabprime(n);
 }
 
-void n_factor(n_factor_t * factors, mp_limb_t n, int proved)
+/*
+   Adds to factors the factorisation of n, which has no factor among the
+   first FLINT_FACTOR_TRIAL_PRIMES primes and is not prime.
+*/
+void _n_factor_composite(n_factor_t * factors, mp_limb_t n, int proved)
 {
    ulong factor_arr[FLINT_MAX_FACTORS_IN_LIMB];
    ulong exp_arr[FLINT_MAX_FACTORS_IN_LIMB];
@@ -45,15 +49,7 @@ void n_factor(n_factor_t * factors, mp_limb_t n, int proved)
    ulong exp;
    mp_limb_t cofactor, factor, cutoff;
 
-   cofactor = n_factor_trial(factors, n, FLINT_FACTOR_TRIAL_PRIMES);
-   if (cofactor == UWORD(1)) return;
-   if (is_prime(cofactor, proved)) 
-   {
-      n_factor_insert(factors, cofactor, UWORD(1));
-      return;
-   }
-
-   factor_arr[0] = cofactor;
+   factor_arr[0] = n;
    factors_left = 1;
    exp_arr[0] = 1;
 
@@ -101,3 +97,18 @@ void n_factor(n_factor_t * factors, mp_limb_t n, int proved)
       }
    } 
 }
+
+void n_factor(n_factor_t * factors, mp_limb_t n, int proved)
+{
+   mp_limb_t cofactor;
+
+   cofactor = n_factor_trial(factors, n, FLINT_FACTOR_TRIAL_PRIMES);
+   if (cofactor == UWORD(1)) return;
+   if (is_prime(cofactor, proved)) 
+   {
+      n_factor_insert(factors, cofactor, UWORD(1));
+      return;
+   }
+
+   _n_factor_composite(factors, cofactor, proved);
+}
@@ -0,0 +1,148 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   Trial divides the len cofactors c by the odd primes among the first
+   FLINT_FACTOR_TRIAL_PRIMES, stopping for each once p^2 exceeds it, as
+   n_factor_trial does. An odd p divides c exactly when c/p, computed as
+   c p^-1 mod 2^FLINT_BITS, is at most (2^FLINT_BITS - 1)/p. The primes
+   are taken in the outer loop so that the tests for the whole block are
+   independent of each other.
+*/
+static void
+_n_factor_trial_block(n_factor_t * factors, mp_ptr c, slong len,
+           const mp_limb_t * primes, const mp_limb_t * pinv,
+           const mp_limb_t * plim, ulong num_primes)
+{
+    mp_limb_t p, q, cmax;
+    ulong i;
+    slong j;
+    int exp;
+
+    cmax = 0;
+    for (j = 0; j < len; j++)
+        cmax = FLINT_MAX(cmax, c[j]);
+
+    for (i = 1; i < num_primes; i++)
+    {
+        p = primes[i];
+
+        if ((i % 32) == 0)
+        {
+            cmax = 0;
+            for (j = 0; j < len; j++)
+                cmax = FLINT_MAX(cmax, c[j]);
+        }
+
+        if (p*p > cmax)
+            break;
+
+        for (j = 0; j < len; j++)
+        {
+            q = c[j]*pinv[i];
+
+            if (q <= plim[i] && p*p <= c[j])
+            {
+                exp = 0;
+                do {
+                    c[j] = q;
+                    exp++;
+                    q = c[j]*pinv[i];
+                } while (q <= plim[i]);
+
+                n_factor_insert(factors + j, p, exp);
+            }
+        }
+    }
+}
+
+void n_factor_vec(n_factor_t * factors, mp_srcptr n, slong len, int proved)
+{
+    const mp_limb_t * primes;
+    mp_ptr pinv, plim, c;
+    mp_limb_t inv, p;
+    ulong i, num_primes = FLINT_FACTOR_TRIAL_PRIMES;
+    slong j, k, block;
+    unsigned int exp;
+    int * res;
+
+    primes = n_primes_arr_readonly(num_primes);
+
+    pinv = flint_malloc(2*num_primes*sizeof(mp_limb_t));
+    plim = pinv + num_primes;
+    c = flint_malloc(FLINT_FACTOR_VEC_BLOCK*sizeof(mp_limb_t));
+    res = flint_malloc(FLINT_FACTOR_VEC_BLOCK*sizeof(int));
+
+    for (i = 1; i < num_primes; i++)
+    {
+        p = primes[i];
+
+        /* p*p = 1 mod 8, and each Newton step doubles the number of bits */
+        inv = p;
+        for (k = 0; k < 5; k++)
+            inv *= 2 - p*inv;
+
+        pinv[i] = inv;
+        plim[i] = UWORD_MAX/p;
+    }
+
+    for (k = 0; k < len; k += FLINT_FACTOR_VEC_BLOCK)
+    {
+        block = FLINT_MIN(FLINT_FACTOR_VEC_BLOCK, len - k);
+
+        for (j = 0; j < block; j++)
+        {
+            n_factor_init(factors + k + j);
+            c[j] = n[k + j];
+
+            if (c[j] >= 4 && (c[j] & 1) == 0)
+            {
+                count_trailing_zeros(exp, c[j]);
+                c[j] >>= exp;
+                n_factor_insert(factors + k + j, 2, exp);
+            }
+        }
+
+        _n_factor_trial_block(factors + k, c, block,
+                                             primes, pinv, plim, num_primes);
+
+        n_is_prime_vec(res, c, block);
+
+        for (j = 0; j < block; j++)
+        {
+            if (n[k + j] <= 1)
+                n_factor(factors + k + j, n[k + j], proved);
+            else if (c[j] == 1)
+                continue;
+            else if (res[j])
+                n_factor_insert(factors + k + j, c[j], 1);
+            else
+                _n_factor_composite(factors + k + j, c[j], proved);
+        }
+    }
+
+    flint_free(pinv);
+    flint_free(c);
+    flint_free(res);
+}
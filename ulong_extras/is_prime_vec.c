@@ -0,0 +1,289 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/* Below this n_is_prime uses tables or a few Miller-Rabin bases */
+#define N_IS_PRIME_VEC_CUTOFF UWORD(1050535501)
+
+#define LANES FLINT_IS_PRIME_VEC_LANES
+
+/* ab/2^FLINT_BITS mod n, where ninv = 1/n mod 2^FLINT_BITS */
+static __inline__ mp_limb_t
+_n_mulredc(mp_limb_t a, mp_limb_t b, mp_limb_t n, mp_limb_t ninv)
+{
+    mp_limb_t hi, lo, mh, ml;
+
+    umul_ppmm(hi, lo, a, b);
+    umul_ppmm(mh, ml, lo*ninv, n);
+
+    return (hi < mh) ? hi - mh + n : hi - mh;
+}
+
+/*
+   Lucas probable prime test with Selfridge's parameters for odd n with no
+   small factors, as per fmpz_is_probabprime_lucas. Returns 0 if n is
+   found composite during the choice of the parameters, otherwise sets
+   a to Q^-1 - 2 mod n in Montgomery form and returns 1.
+*/
+static int
+_n_lucas_setup(mp_limb_t * a, mp_limb_t n, mp_limb_t one)
+{
+    slong D, Q;
+    mp_limb_t q;
+    int j;
+
+    if (n_is_square(n))
+        return 0;
+
+    for (D = 5; ; D = (D > 0) ? -D - 2 : -D + 2)
+    {
+        j = n_jacobi(D, n);
+
+        if (j == 0) /* |D| < n shares a factor with n */
+            return 0;
+        if (j == -1)
+            break;
+    }
+
+    Q = (1 - D)/4;
+    q = (Q < 0) ? n - (mp_limb_t) (-Q) : (mp_limb_t) Q;
+
+    if (n_gcd(q, n) != 1)
+        return 0;
+
+    q = n_submod(n_invmod(q, n), 2, n);
+    *a = n_mulmod2_preinv(q, one, n, n_preinvert_limb(n));
+
+    return 1;
+}
+
+/* Montgomery setup for the lanes: ninv = 1/n and one = 2^FLINT_BITS mod n */
+static void
+_n_mont_lanes(mp_limb_t * ninv, mp_limb_t * one, const mp_limb_t * n,
+                                                                   int len)
+{
+    mp_limb_t inv;
+    int i, j;
+
+    for (j = 0; j < len; j++)
+    {
+        /* n*n = 1 mod 8, and each Newton step doubles the number of bits */
+        inv = n[j];
+        for (i = 0; i < 5; i++)
+            inv *= 2 - n[j]*inv;
+        ninv[j] = inv;
+
+        one[j] = (-n[j]) % n[j];
+    }
+}
+
+/*
+   Sets res[j] to whether n[j] is a strong probable prime to base 2, for
+   odd n[j] and j < len <= LANES. The exponentiations of all the lanes
+   are run together, so that their independent products overlap.
+*/
+static void
+_n_sprp2_lanes(int * res, const mp_limb_t * n, int len)
+{
+    mp_limb_t ninv[LANES], one[LANES], y[LANES], d[LANES], t;
+    unsigned int s[LANES];
+    slong b, bits = 0;
+    int j, i;
+
+    _n_mont_lanes(ninv, one, n, len);
+
+    for (j = 0; j < len; j++)
+    {
+        d[j] = n[j] - 1;
+        count_trailing_zeros(s[j], d[j]);
+        d[j] >>= s[j];
+
+        y[j] = one[j];
+        bits = FLINT_MAX(bits, FLINT_BIT_COUNT(d[j]));
+    }
+
+    /* 2^d, doubling rather than multiplying for the one bits */
+    for (b = bits - 1; b >= 0; b--)
+    {
+        for (j = 0; j < len; j++)
+        {
+            y[j] = _n_mulredc(y[j], y[j], n[j], ninv[j]);
+            t = n_addmod(y[j], y[j], n[j]);
+            y[j] = ((d[j] >> b) & 1) ? t : y[j];
+        }
+    }
+
+    for (j = 0; j < len; j++)
+    {
+        res[j] = (y[j] == one[j]);
+
+        for (i = s[j]; i > 0 && !res[j]; i--)
+        {
+            if (y[j] == n[j] - one[j])
+                res[j] = 1;
+            else
+                y[j] = _n_mulredc(y[j], y[j], n[j], ninv[j]);
+        }
+    }
+}
+
+/*
+   Sets res[j] to the result of the Lucas test of the odd n[j] with no
+   small factors, for j < len <= LANES, running the chains together.
+*/
+static void
+_n_lucas_lanes(int * res, const mp_limb_t * n, int len)
+{
+    mp_limb_t ninv[LANES], one[LANES], m[LANES];
+    mp_limb_t A[LANES], two[LANES], V0[LANES], V1[LANES];
+    mp_limb_t xy, sq, bit;
+    slong b, bits = 0;
+    int j;
+
+    _n_mont_lanes(ninv, one, n, len);
+
+    for (j = 0; j < len; j++)
+    {
+        res[j] = _n_lucas_setup(A + j, n[j], one[j]);
+
+        if (!res[j]) /* run a dummy chain for lanes already decided */
+            A[j] = 0;
+
+        two[j] = n_addmod(one[j], one[j], n[j]);
+        V0[j] = two[j];
+        V1[j] = A[j];
+
+        m[j] = n[j]/2 + 1; /* (n + 1)/2 */
+        bits = FLINT_MAX(bits, FLINT_BIT_COUNT(m[j]));
+    }
+
+    /* V_m, V_{m + 1} with V_{2k} = V_k^2 - 2 and V_{2k+1} = V_k V_{k+1} - A */
+    for (b = bits - 1; b >= 0; b--)
+    {
+        for (j = 0; j < len; j++)
+        {
+            bit = (m[j] >> b) & 1;
+
+            xy = n_submod(_n_mulredc(V0[j], V1[j], n[j], ninv[j]),
+                                                             A[j], n[j]);
+            sq = bit ? V1[j] : V0[j];
+            sq = n_submod(_n_mulredc(sq, sq, n[j], ninv[j]), two[j], n[j]);
+
+            V0[j] = bit ? xy : sq;
+            V1[j] = bit ? sq : xy;
+        }
+    }
+
+    /* V_m A - 2 V_{m + 1} = 0 mod n */
+    for (j = 0; j < len; j++)
+    {
+        if (res[j])
+            res[j] = (_n_mulredc(V0[j], A[j], n[j], ninv[j])
+                                        == n_addmod(V1[j], V1[j], n[j]));
+    }
+}
+
+/* Runs the Lucas test on the queue of candidates l with indices lidx */
+static void
+_n_is_prime_lucas_queue(int * res, const mp_limb_t * l, const slong * lidx,
+                                                                   int len)
+{
+    int r[LANES];
+    int j;
+
+    _n_lucas_lanes(r, l, len);
+
+    for (j = 0; j < len; j++)
+        res[lidx[j]] = r[j];
+}
+
+/*
+   Runs the base 2 test on the queue of candidates q with indices qidx.
+   Those passing are moved to the queue l for the Lucas test, which is
+   run whenever it fills.
+*/
+static void
+_n_is_prime_sprp2_queue(int * res, const mp_limb_t * q, const slong * qidx,
+                     int qlen, mp_limb_t * l, slong * lidx, int * llen)
+{
+    int r[LANES];
+    int j;
+
+    _n_sprp2_lanes(r, q, qlen);
+
+    for (j = 0; j < qlen; j++)
+    {
+        if (!r[j])
+        {
+            res[qidx[j]] = 0;
+            continue;
+        }
+
+        lidx[*llen] = qidx[j];
+        l[(*llen)++] = q[j];
+
+        if (*llen == LANES)
+        {
+            _n_is_prime_lucas_queue(res, l, lidx, *llen);
+            *llen = 0;
+        }
+    }
+}
+
+void n_is_prime_vec(int * res, mp_srcptr n, slong len)
+{
+    mp_limb_t q[LANES], l[LANES];
+    slong qidx[LANES], lidx[LANES];
+    slong i;
+    int qlen = 0, llen = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        mp_limb_t m = n[i];
+
+        if (m < N_IS_PRIME_VEC_CUTOFF)
+            res[i] = n_is_prime(m);
+        else if (!(m%2) || !(m%3) || !(m%5) || !(m%7) ||
+                 !(m%11) || !(m%13) || !(m%17) || !(m%19) ||
+                 !(m%23) || !(m%29) || !(m%31) || !(m%37) ||
+                 !(m%41) || !(m%43) || !(m%47) || !(m%53))
+            res[i] = 0;
+        else
+        {
+            qidx[qlen] = i;
+            q[qlen++] = m;
+
+            if (qlen == LANES)
+            {
+                _n_is_prime_sprp2_queue(res, q, qidx, qlen, l, lidx, &llen);
+                qlen = 0;
+            }
+        }
+    }
+
+    if (qlen != 0)
+        _n_is_prime_sprp2_queue(res, q, qidx, qlen, l, lidx, &llen);
+
+    if (llen != 0)
+        _n_is_prime_lucas_queue(res, l, lidx, llen);
+}
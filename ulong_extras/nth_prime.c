@@ -26,19 +26,93 @@
 #define ulong ulongxx /* interferes with system includes */
 #include <stdlib.h>
 #include <stdio.h>
+#include <math.h>
 #undef ulong
 #define ulong mp_limb_t
 #include "flint.h"
 #include "ulong_extras.h"
 
+/* Logarithmic integral, by the series of Ramanujan */
+static double
+_li(double x)
+{
+    double l = log(x), s = 0.0, term = 1.0, inner = 0.0;
+    slong k;
+
+    for (k = 1; k < 200; k++)
+    {
+        term *= -l / k;
+        if (k % 2 == 1)
+            inner += 1.0 / k;
+        s -= term * inner / ldexp(1.0, k - 1);
+        if (fabs(term * inner) < 1e-17 * fabs(s) * ldexp(1.0, k - 1))
+            break;
+    }
+
+    return 0.5772156649015329 + log(l) + sqrt(x) * s;
+}
+
+/* Solves li(x) = n by Newton iteration */
+static double
+_li_inverse(double n)
+{
+    double x = n * log(n), dx;
+    slong i;
+
+    for (i = 0; i < 100; i++)
+    {
+        dx = (_li(x) - n) * log(x);
+        x -= dx;
+        if (fabs(dx) < 1.0)
+            break;
+    }
+
+    return x;
+}
+
 mp_limb_t n_nth_prime(ulong n)
 {
+    mp_limb_t lo, hi, x, p;
+    ulong count;
+    n_primes_t iter;
+
     if (n == 0)
     {
         flint_printf("Exception (n_nth_prime). n_nth_prime(0) is undefined.\n");
         abort();
     }
 
-    return n_primes_arr_readonly(n)[n-1];
-}
+    if (n < 16)
+        return n_primes_arr_readonly(n)[n-1];
+
+    n_nth_prime_bounds(&lo, &hi, n);
 
+    if (hi < FLINT_PRIME_PI_TABLE_CUTOFF)
+        return n_primes_arr_readonly(n)[n-1];
+
+    /*
+       As pi(x) < li(x) in the range of a limb, p_n is a little above
+       li^(-1)(n). Count the primes up to just below this estimate, or up
+       to the lower bound if rounding got it wrong, then sieve forward.
+    */
+    x = (mp_limb_t) _li_inverse((double) n);
+    x -= n_sqrt(x);
+    x = FLINT_MAX(lo, FLINT_MIN(x, hi)) - 1;
+
+    count = n_prime_pi(x);
+    if (count >= n)
+    {
+        x = lo - 1;
+        count = n_prime_pi(x);
+    }
+
+    n_primes_init(iter);
+    n_primes_jump_after(iter, x);
+
+    for (p = x; count < n; count++)
+        p = n_primes_next(iter);
+
+    n_primes_clear(iter);
+
+    return p;
+}
@@ -0,0 +1,390 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#undef ulong
+#define ulong mp_limb_t
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   Number of primes c removed by the table of phi(n, c), their product
+   and the number of residues coprime to it
+*/
+#define LMO_C 6
+#define LMO_PRIMORIAL 30030
+#define LMO_TOTIENT 5760
+
+static int
+_lmo_popcount(mp_limb_t x)
+{
+#if defined(__GNUC__) && !defined(_WIN64)
+    return __builtin_popcountl(x);
+#else
+    int c = 0;
+
+    while (x != 0)
+    {
+        x &= x - 1;
+        c++;
+    }
+
+    return c;
+#endif
+}
+
+/*
+   The sieve of a segment is kept as a bit array with one bit for each
+   integer which has not been crossed out yet, together with a Fenwick
+   tree over the number of bits set in each word, so that crossing out
+   an integer and counting the integers left up to a point both take
+   logarithmic time.
+*/
+typedef struct
+{
+    mp_limb_t * bits;
+    ulong * tree;
+    slong words;
+}
+lmo_segment_struct;
+
+typedef lmo_segment_struct lmo_segment_t[1];
+
+static void
+_lmo_segment_build(lmo_segment_t seg)
+{
+    slong i, j;
+
+    for (i = 1; i <= seg->words; i++)
+        seg->tree[i] = _lmo_popcount(seg->bits[i - 1]);
+
+    for (i = 1; i <= seg->words; i++)
+    {
+        j = i + (i & -i);
+        if (j <= seg->words)
+            seg->tree[j] += seg->tree[i];
+    }
+}
+
+/* Number of integers left among the first k words */
+static ulong
+_lmo_segment_prefix(const lmo_segment_t seg, slong k)
+{
+    ulong s = 0;
+
+    for ( ; k > 0; k &= k - 1)
+        s += seg->tree[k];
+
+    return s;
+}
+
+/* Number of integers left at the positions 0 to i inclusive */
+static ulong
+_lmo_segment_count(const lmo_segment_t seg, ulong i)
+{
+    ulong w = i / FLINT_BITS, r = i % FLINT_BITS;
+    mp_limb_t mask;
+
+    mask = (r == FLINT_BITS - 1) ? ~UWORD(0) : (UWORD(1) << (r + 1)) - 1;
+
+    return _lmo_segment_prefix(seg, w) + _lmo_popcount(seg->bits[w] & mask);
+}
+
+/* Crosses out the multiples of p in [low, low + len) */
+static void
+_lmo_segment_cross(lmo_segment_t seg, mp_limb_t low, mp_limb_t len,
+                                                      mp_limb_t p, int tree)
+{
+    mp_limb_t i, bit;
+    slong j;
+
+    for (i = ((low + p - 1) / p) * p - low; i < len; i += p)
+    {
+        bit = UWORD(1) << (i % FLINT_BITS);
+
+        if (seg->bits[i / FLINT_BITS] & bit)
+        {
+            seg->bits[i / FLINT_BITS] &= ~bit;
+
+            if (tree)
+                for (j = i / FLINT_BITS + 1; j <= seg->words; j += j & -j)
+                    seg->tree[j]--;
+        }
+    }
+}
+
+/* Index of the largest of the num primes which is at most m, or -1 */
+static slong
+_lmo_primes_search(const mp_limb_t * primes, slong num, mp_limb_t m)
+{
+    slong lo = 0, hi = num, mid;
+
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (primes[mid] <= m)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo - 1;
+}
+
+/*
+   Sets s[i] to 1 if lo + i has no prime factor among the given primes
+   and to 0 otherwise, for 0 <= i < len, where lo exceeds all the primes
+*/
+static void
+_lmo_sieve_chunk(unsigned char * s, mp_limb_t lo, mp_limb_t len,
+                                      const mp_limb_t * primes, slong num)
+{
+    mp_limb_t i, p;
+    slong j;
+
+    memset(s, 1, len);
+
+    for (j = 0; j < num; j++)
+    {
+        p = primes[j];
+
+        if (p * p >= lo + len)
+            break;
+
+        for (i = ((lo + p - 1) / p) * p - lo; i < len; i += p)
+            s[i] = 0;
+    }
+}
+
+/*
+   Computes pi(x) as phi(x, a) + a - 1 - P2(x, a) where a = pi(y) for
+   some y >= x^(1/3), following Lagarias, Miller and Odlyzko with the
+   segmented sieve of Deleglise and Rivat.
+
+   The function phi(x, a) is split into the ordinary leaves
+   mu(n) phi(x/n, c) with n <= y, which use a table of phi(n, c), and the
+   special leaves -mu(m) phi(x/(p_b m), b - 1) with m <= y < p_b m. The
+   latter are all below x/y and are counted while sieving [1, x/y] by
+   segments of length about y, one prime at a time. Once all the primes
+   up to y are crossed out, the segment holds the primes up to x/y,
+   which also gives the values pi(x/p) needed for P2(x, a).
+
+   The memory used is O(y) and the time O(x^(2/3)) up to logarithmic
+   factors. Sums are taken modulo 2^FLINT_BITS, which is harmless since
+   the result fits in a limb.
+*/
+ulong n_prime_pi_lmo(mp_limb_t x)
+{
+    mp_limb_t y, z, sqrtx, low, high, len, slen, p, m, mlo, mhi, v;
+    mp_limb_t clo, chi, pcur, plo, phi_x, s1, s2, p2, t;
+    slong a, b, i, j, num_p2;
+    unsigned int * lpf, * phi_tab;
+    signed char * mu;
+    mp_limb_t * primes;
+    ulong * phi;
+    unsigned char * chunk;
+    lmo_segment_t seg;
+
+    /* y = floor(x^(1/3)) scaled by a small factor to balance the leaves */
+    y = (mp_limb_t) pow((double) x, 1.0 / 3.0);
+    while (y > 1 && y > x / y / y)
+        y--;
+    while ((y + 1) <= x / (y + 1) / (y + 1))
+        y++;
+
+    y = FLINT_MIN(y * FLINT_MAX(1, FLINT_BIT_COUNT(x) / 10), n_sqrt(x));
+    z = x / y;
+    sqrtx = n_sqrt(x);
+
+    /* Linear sieve for the least prime factor and Moebius function */
+    lpf = flint_calloc(y + 1, sizeof(unsigned int));
+    mu = flint_malloc((y + 1) * sizeof(signed char));
+    primes = flint_malloc((y + 1) * sizeof(mp_limb_t));
+
+    a = 0;
+    lpf[1] = UINT_MAX;
+    mu[1] = 1;
+    for (m = 2; m <= y; m++)
+    {
+        if (lpf[m] == 0)
+        {
+            lpf[m] = m;
+            mu[m] = -1;
+            primes[a++] = m;
+        }
+
+        for (i = 0; i < a && primes[i] <= lpf[m] && primes[i] <= y / m; i++)
+        {
+            lpf[m * primes[i]] = primes[i];
+            mu[m * primes[i]] = (primes[i] == lpf[m]) ? 0 : -mu[m];
+        }
+    }
+
+    if (a <= LMO_C)
+    {
+        flint_printf("Exception (n_prime_pi_lmo). x too small.\n");
+        abort();
+    }
+
+    /* phi(n, c) = (n / P) phi(P) + phi_tab[n mod P] */
+    phi_tab = flint_malloc(LMO_PRIMORIAL * sizeof(unsigned int));
+    phi_tab[0] = 0;
+    for (m = 1; m < LMO_PRIMORIAL; m++)
+    {
+        for (i = 0; i < LMO_C && m % primes[i] != 0; i++) ;
+        phi_tab[m] = phi_tab[m - 1] + (i == LMO_C);
+    }
+
+#define PHI_C(n) (((n) / LMO_PRIMORIAL) * LMO_TOTIENT \
+                  + phi_tab[(n) % LMO_PRIMORIAL])
+
+    /* Ordinary leaves */
+    s1 = 0;
+    for (m = 1; m <= y; m++)
+    {
+        if (mu[m] != 0 && lpf[m] > primes[LMO_C - 1])
+        {
+            if (mu[m] > 0)
+                s1 += PHI_C(x / m);
+            else
+                s1 -= PHI_C(x / m);
+        }
+    }
+
+    /* Special leaves and P2 while sieving [1, z] */
+    len = ((y + FLINT_BITS - 1) / FLINT_BITS) * FLINT_BITS;
+    len = FLINT_MAX(len, 8 * FLINT_BITS);
+
+    seg->words = len / FLINT_BITS;
+    seg->bits = flint_malloc(seg->words * sizeof(mp_limb_t));
+    seg->tree = flint_malloc((seg->words + 1) * sizeof(ulong));
+    phi = flint_calloc(a + 1, sizeof(ulong));
+    chunk = flint_malloc(len);
+
+    s2 = 0;
+    p2 = 0;
+    num_p2 = 0;
+    pcur = sqrtx;
+    clo = chi = sqrtx + 1;
+
+    for (low = 1; low <= z; low += len)
+    {
+        high = FLINT_MIN(low + len - 1, z) + 1;
+        slen = high - low;
+
+        seg->words = (slen + FLINT_BITS - 1) / FLINT_BITS;
+        for (j = 0; j < seg->words; j++)
+            seg->bits[j] = ~UWORD(0);
+        if (slen % FLINT_BITS != 0)
+            seg->bits[seg->words - 1] =
+                (UWORD(1) << (slen % FLINT_BITS)) - 1;
+
+        for (b = 0; b < LMO_C; b++)
+            _lmo_segment_cross(seg, low, slen, primes[b], 0);
+
+        _lmo_segment_build(seg);
+
+        for (b = LMO_C; b < a; b++)
+        {
+            /* Leaves -mu(m) phi(x/(p m), b) with x/(p m) in the segment */
+            p = primes[b];
+            mlo = FLINT_MAX(y / p, x / p / high);
+            mhi = FLINT_MIN(y, x / p / low);
+
+            if (p <= y / p)
+            {
+                for (m = mhi; m > mlo; m--)
+                {
+                    if (mu[m] != 0 && lpf[m] > p)
+                    {
+                        v = x / p / m;
+                        t = phi[b] + _lmo_segment_count(seg, v - low);
+
+                        if (mu[m] > 0)
+                            s2 -= t;
+                        else
+                            s2 += t;
+                    }
+                }
+            }
+            else if (mhi > mlo)
+            {
+                /* Here m < p^2, so m must be a prime q > p */
+                mlo = FLINT_MAX(mlo, p);
+                i = _lmo_primes_search(primes, a, mhi);
+
+                for ( ; i >= 0 && primes[i] > mlo; i--)
+                {
+                    v = x / p / primes[i];
+                    s2 += phi[b] + _lmo_segment_count(seg, v - low);
+                }
+            }
+
+            phi[b] += _lmo_segment_prefix(seg, seg->words);
+            _lmo_segment_cross(seg, low, slen, p, 1);
+        }
+
+        /* pi(x/p) for the primes y < p <= sqrt(x) with x/p in the segment */
+        plo = FLINT_MAX(y, x / high);
+
+        for ( ; pcur > plo; pcur--)
+        {
+            if (pcur < clo)
+            {
+                chi = pcur + 1;
+                clo = FLINT_MAX(y + 1, chi - FLINT_MIN(chi, len));
+                _lmo_sieve_chunk(chunk, clo, chi - clo, primes, a);
+            }
+
+            if (chunk[pcur - clo])
+            {
+                v = x / pcur;
+                p2 += a - 1 + phi[a] + _lmo_segment_count(seg, v - low);
+                num_p2++;
+            }
+        }
+
+        phi[a] += _lmo_segment_prefix(seg, seg->words);
+    }
+
+#undef PHI_C
+
+    /* P2 = sum over a < k <= a + num_p2 of pi(x/p_k) - (k - 1) */
+    t = a + num_p2;
+    p2 -= (t * (t - 1)) / 2 - (((mp_limb_t) a) * (a - 1)) / 2;
+
+    phi_x = s1 + s2;
+
+    flint_free(lpf);
+    flint_free(mu);
+    flint_free(primes);
+    flint_free(phi_tab);
+    flint_free(seg->bits);
+    flint_free(seg->tree);
+    flint_free(phi);
+    flint_free(chunk);
+
+    return phi_x + a - 1 - p2;
+}
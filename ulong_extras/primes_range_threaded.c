@@ -0,0 +1,138 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "thread_pool.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    unsigned char * sieve;
+    mp_limb_t start;
+    slong bytes;
+    const unsigned int * sieve_primes;
+    mp_limb_t bound;
+}
+primes_range_arg_t;
+
+static void
+_n_primes_range_worker(void * arg_ptr)
+{
+    primes_range_arg_t * arg = (primes_range_arg_t *) arg_ptr;
+
+    n_sieve_wheel(arg->sieve, arg->bytes, arg->start,
+                                  arg->sieve_primes, arg->bound);
+}
+
+/*
+   Each thread sieves a segment of FLINT_SIEVE_SIZE integers at a time.
+   The calling thread then reads off the primes of each segment, one
+   block of FLINT_SIEVE_WHEEL_BYTES at a time, and hands them to func
+   in increasing order. The memory used is thus bounded independently
+   of the range.
+*/
+void
+n_primes_range_threaded(mp_limb_t a, mp_limb_t b,
+                                      n_primes_range_func func, void * arg)
+{
+    slong i, k, num, num_threads, num_workers, active;
+    slong seg = FLINT_SIEVE_SIZE / 30, blk = FLINT_SIEVE_WHEEL_BYTES;
+    mp_limb_t start, rem, bound;
+    primes_range_arg_t * args;
+    thread_pool_handle * threads;
+    unsigned char * sieve;
+    mp_ptr primes;
+    n_primes_t iter;
+    int stop;
+
+    if (b < a)
+        return;
+
+    bound = n_sqrt(b) + 1;
+
+    n_primes_init(iter);
+    n_primes_extend_small(iter, bound);
+
+    /* Segments of seg bytes cover [start, start + 30 rem) */
+    start = a - a % 30;
+    rem = (b - start) / 30 + 1;
+
+    num_workers = flint_request_threads(&threads, (rem + seg - 1) / seg);
+    num_threads = num_workers + 1;
+
+    args = flint_malloc(num_threads * sizeof(primes_range_arg_t));
+    sieve = flint_malloc(num_threads * seg * sizeof(unsigned char));
+    primes = flint_malloc((8 * blk + 3) * sizeof(mp_limb_t));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].sieve = sieve + i * seg;
+        args[i].sieve_primes = iter->small_primes;
+        args[i].bound = bound;
+    }
+
+    stop = 0;
+
+    while (!stop && rem != 0)
+    {
+        for (active = 0; active < num_threads && rem != 0; active++)
+        {
+            args[active].start = start;
+            args[active].bytes = FLINT_MIN(rem, seg);
+
+            rem -= args[active].bytes;
+            if (rem != 0)
+                start += 30 * (mp_limb_t) args[active].bytes;
+        }
+
+        for (i = 1; i < active; i++)
+            thread_pool_wake(global_thread_pool, threads[i - 1], 0,
+                                           _n_primes_range_worker, &args[i]);
+
+        /* Do the first segment in this thread */
+        n_sieve_wheel(args[0].sieve, args[0].bytes, args[0].start,
+                                             iter->small_primes, bound);
+
+        for (i = 1; i < active; i++)
+            thread_pool_wait(global_thread_pool, threads[i - 1]);
+
+        for (i = 0; i < active && !stop; i++)
+        {
+            for (k = 0; k < args[i].bytes && !stop; k += blk)
+            {
+                num = n_sieve_wheel_primes(primes, args[i].sieve + k,
+                    FLINT_MIN(blk, args[i].bytes - k),
+                    args[i].start + 30 * (mp_limb_t) k, a, b);
+
+                if (num != 0)
+                    stop = func(primes, num, arg);
+            }
+        }
+    }
+
+    flint_give_back_threads(threads, num_workers);
+
+    flint_free(args);
+    flint_free(sieve);
+    flint_free(primes);
+
+    n_primes_clear(iter);
+}
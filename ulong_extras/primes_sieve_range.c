@@ -28,80 +28,43 @@
 #include "flint.h"
 #include "ulong_extras.h"
 
-static void
-mark(char * sieve, mp_limb_t a, slong len, mp_limb_t p)
-{
-    mp_limb_t t;
-
-    t = p * p;
-    if (t >= a)
-    {
-        t = (t - a) / 2;
-    }
-    else
-    {
-        t = p - ((a - p) / 2) % p;
-        if (t == p)
-            t = 0;
-    }
-
-    while (t < len)
-    {
-        sieve[t] = 0;
-        t += p;
-    }
-}
-
-void
-n_sieve_odd(char * sieve, ulong n, mp_limb_t a,
-    unsigned int * sieve_primes, mp_limb_t bound)
-{
-    slong i;
-    mp_limb_t p;
-
-    for (i = 0; i < n / 2; i++)
-        sieve[i] = 1;
-
-    i = 0;
-    while (1)
-    {
-        i++;
-        p = sieve_primes[i];
-        if (p > bound)
-            break;
-        mark(sieve, a, n / 2, p);
-    }
-}
-
 void
 n_primes_sieve_range(n_primes_t iter, mp_limb_t a, mp_limb_t b)
 {
-    mp_limb_t bound;
-    ulong len, odd_len;
+    mp_limb_t bound, a30;
+    slong bytes;
+    int i;
 
-    /* a and b must be odd */
-    a += (a % 2 == 0);
-    b -= (b % 2 == 0);
-
-    len = b - a + 2;
-    odd_len = len / 2;
-
-    if (a < 3 || b < a || len > FLINT_SIEVE_SIZE)
+    if (a < 7 || b < a || b - a >= FLINT_SIEVE_SIZE)
     {
         flint_printf("invalid sieve range %wu,%wu!\n", a, b);
         abort();
     }
 
+    /* The wheel sieve starts at a multiple of 30 */
+    a30 = a - a % 30;
+    bytes = (b - a30) / 30 + 1;
+
     bound = n_sqrt(b) + 1;
 
     if (iter->sieve == NULL)
-        iter->sieve = flint_malloc(FLINT_SIEVE_SIZE / 2 * sizeof(char));
+        iter->sieve = flint_malloc((FLINT_SIEVE_SIZE / 30 + 1)
+                                                 * sizeof(unsigned char));
 
     n_primes_extend_small(iter, bound);
-    n_sieve_odd(iter->sieve, len, a, iter->small_primes, bound);
+    n_sieve_wheel(iter->sieve, bytes, a30, iter->small_primes, bound);
+
+    /* Drop the integers of the first and last bytes outside [a, b] */
+    for (i = 0; i < 8; i++)
+    {
+        if (a30 + flint_sieve_wheel[i] < a)
+            iter->sieve[0] &= ~(1 << i);
+        if (b - a30 - 30 * (mp_limb_t) (bytes - 1) < flint_sieve_wheel[i])
+            iter->sieve[bytes - 1] &= ~(1 << i);
+    }
 
     iter->sieve_i = 0;
-    iter->sieve_num = odd_len;
-    iter->sieve_a = a;
+    iter->sieve_num = 8 * bytes;
+    iter->sieve_a = a30;
     iter->sieve_b = b;
 }
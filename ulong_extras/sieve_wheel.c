@@ -0,0 +1,256 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <string.h>
+#include <gmp.h>
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+
+const unsigned char flint_sieve_wheel[8] = { 1, 7, 11, 13, 17, 19, 23, 29 };
+
+/* Bit of a byte of the wheel sieve for each residue modulo 30, or 8 */
+static const unsigned char wheel_bit[30] =
+{
+    8, 0, 8, 8, 8, 8, 8, 1, 8, 8, 8, 2, 8, 3, 8, 8, 8, 4, 8, 5,
+    8, 8, 8, 6, 8, 8, 8, 8, 8, 7
+};
+
+/* Bytes of the period of the multiples of 7, 11 and 13 */
+#define WHEEL_PRESIEVE_BYTES 1001
+
+/*
+   The multiples p m with m >= mmin of p in the sieve starting at a, of
+   which last is the last integer, fall in 8 classes, one for each residue
+   of m modulo 30, and consecutive ones in a class are p bytes apart.
+   Sets d[k] to the byte of the first multiple in class k, or to bytes if
+   there is none, and mask[k] to the mask clearing its bit.
+*/
+static void
+_wheel_start(slong * d, unsigned char * mask, slong bytes, mp_limb_t a,
+                              mp_limb_t last, mp_limb_t p, mp_limb_t mmin)
+{
+    mp_limb_t m0, m, mmax, n;
+    slong k;
+
+    m0 = FLINT_MAX(mmin, a / p + (a % p != 0));
+    mmax = last / p;
+
+    for (k = 0; k < 8; k++)
+    {
+        m = m0 + (flint_sieve_wheel[k] + 30 - m0 % 30) % 30;
+        n = p * FLINT_MIN(m, mmax);
+
+        d[k] = (m > mmax) ? bytes : (slong) ((n - a) / 30);
+        mask[k] = ~(1 << wheel_bit[n % 30]);
+    }
+}
+
+/*
+   Crosses out the multiples of p from the bytes d[k] up to end, and moves
+   the d[k] past end. While all 8 classes have a multiple in the next p
+   bytes, they are crossed out together.
+*/
+static void
+_wheel_cross(unsigned char * sieve, slong end, mp_limb_t p,
+                                      slong * d, const unsigned char * mask)
+{
+    slong i, k, dmin, dmax, r[8];
+    unsigned char * q, * stop;
+
+    dmin = dmax = d[0];
+    for (k = 1; k < 8; k++)
+    {
+        dmin = FLINT_MIN(dmin, d[k]);
+        dmax = FLINT_MAX(dmax, d[k]);
+    }
+
+    if (dmax < end)
+    {
+        for (k = 0; k < 8; k++)
+            r[k] = d[k] - dmin;
+
+        q = sieve + dmin;
+        stop = sieve + end - (dmax - dmin);
+
+        for ( ; q < stop; q += p)
+        {
+            q[r[0]] &= mask[0]; q[r[1]] &= mask[1];
+            q[r[2]] &= mask[2]; q[r[3]] &= mask[3];
+            q[r[4]] &= mask[4]; q[r[5]] &= mask[5];
+            q[r[6]] &= mask[6]; q[r[7]] &= mask[7];
+        }
+
+        for (k = 0; k < 8; k++)
+            d[k] = (q - sieve) + r[k];
+    }
+
+    for (k = 0; k < 8; k++)
+    {
+        for (i = d[k]; i < end; i += p)
+            sieve[i] &= mask[k];
+
+        d[k] = i;
+    }
+}
+
+void
+n_sieve_wheel(unsigned char * sieve, slong bytes, mp_limb_t a,
+                         const unsigned int * sieve_primes, mp_limb_t bound)
+{
+    mp_limb_t p, last;
+    slong i, j, num, start = 3, blk, end;
+    slong d[8], * dd;
+    unsigned char mask[8], * mm;
+
+    /* The last integer covered, if it does not overflow */
+    last = a + 30 * (mp_limb_t) bytes - 1;
+    if (last < a)
+        last = UWORD_MAX;
+
+    if (bytes >= 2 * WHEEL_PRESIEVE_BYTES)
+    {
+        /* Copy the periodic pattern of the multiples of 7, 11 and 13 */
+        memset(sieve, 0xff, WHEEL_PRESIEVE_BYTES);
+
+        for ( ; start < 6; start++)
+        {
+            _wheel_start(d, mask, WHEEL_PRESIEVE_BYTES, a,
+                a + 30 * WHEEL_PRESIEVE_BYTES - 1, sieve_primes[start], 1);
+            _wheel_cross(sieve, WHEEL_PRESIEVE_BYTES, sieve_primes[start],
+                                                                  d, mask);
+        }
+
+        for (i = WHEEL_PRESIEVE_BYTES; i < bytes; i *= 2)
+            memcpy(sieve + i, sieve, FLINT_MIN(i, bytes - i));
+
+        /* The pattern crossed out the primes themselves */
+        if (a == 0)
+            sieve[0] |= 0x0e;
+    }
+    else
+        memset(sieve, 0xff, bytes);
+
+    if (bytes <= FLINT_SIEVE_WHEEL_BYTES)
+    {
+        for (j = start; (p = sieve_primes[j]) <= bound; j++)
+        {
+            _wheel_start(d, mask, bytes, a, last, p, p);
+            _wheel_cross(sieve, bytes, p, d, mask);
+        }
+
+        return;
+    }
+
+    /*
+       Sieve blocks of FLINT_SIEVE_WHEEL_BYTES in turn by the primes with
+       many multiples in a block, keeping for each the next multiple of
+       each class from one block to the next. Larger primes have few
+       multiples in a block and are better done over the whole sieve.
+    */
+    for (num = 0; sieve_primes[start + num] <= bound
+               && sieve_primes[start + num] < FLINT_SIEVE_WHEEL_BYTES / 8;
+                                                                num++) ;
+
+    dd = flint_malloc(8 * num * sizeof(slong));
+    mm = flint_malloc(8 * num * sizeof(unsigned char));
+
+    for (j = 0; j < num; j++)
+    {
+        p = sieve_primes[start + j];
+        _wheel_start(dd + 8 * j, mm + 8 * j, bytes, a, last, p, p);
+    }
+
+    for (blk = 0; blk < bytes; blk += FLINT_SIEVE_WHEEL_BYTES)
+    {
+        end = FLINT_MIN(blk + FLINT_SIEVE_WHEEL_BYTES, bytes);
+
+        for (j = 0; j < num; j++)
+            _wheel_cross(sieve, end, sieve_primes[start + j],
+                                               dd + 8 * j, mm + 8 * j);
+    }
+
+    flint_free(dd);
+    flint_free(mm);
+
+    for (j = start + num; (p = sieve_primes[j]) <= bound; j++)
+    {
+        _wheel_start(d, mask, bytes, a, last, p, p);
+        _wheel_cross(sieve, bytes, p, d, mask);
+    }
+}
+
+slong
+n_sieve_wheel_primes(mp_ptr res, const unsigned char * sieve, slong bytes,
+                                 mp_limb_t a, mp_limb_t lo, mp_limb_t hi)
+{
+    slong i, i0, i1, k, num = 0;
+    mp_limb_t n, t, base;
+    unsigned char m0 = 0, m1 = 0;
+
+    if (a == 0)
+    {
+        /* The primes below 7 are not in the wheel, and 1 is not prime */
+        for (n = 2; n <= 5; n += (n == 2) ? 1 : 2)
+            if (n >= lo && n <= hi)
+                res[num++] = n;
+
+        lo = FLINT_MAX(lo, 7);
+    }
+
+    if (hi < a || bytes == 0 || (lo > a && (lo - a) / 30 >= bytes))
+        return num;
+
+    /* Bytes i0 to i1 meet [lo, hi], the first and last only in part */
+    i0 = (lo > a) ? (lo - a) / 30 : 0;
+    i1 = ((hi - a) / 30 >= bytes) ? bytes - 1 : (hi - a) / 30;
+
+    for (k = 0; k < 8; k++)
+    {
+        n = a + 30 * (mp_limb_t) i0 + flint_sieve_wheel[k];
+        m0 |= (n >= lo) << k;
+        n = a + 30 * (mp_limb_t) i1 + flint_sieve_wheel[k];
+        m1 |= (n <= hi) << k;
+    }
+
+    for (i = i0; i <= i1; i++)
+    {
+        t = sieve[i];
+
+        if (i == i0)
+            t &= m0;
+        if (i == i1)
+            t &= m1;
+
+        base = a + 30 * (mp_limb_t) i;
+
+        /* Store every candidate, keeping those whose bit is set */
+        res[num] = base + 1;  num += t & 1;
+        res[num] = base + 7;  num += (t >> 1) & 1;
+        res[num] = base + 11; num += (t >> 2) & 1;
+        res[num] = base + 13; num += (t >> 3) & 1;
+        res[num] = base + 17; num += (t >> 4) & 1;
+        res[num] = base + 19; num += (t >> 5) & 1;
+        res[num] = base + 23; num += (t >> 6) & 1;
+        res[num] = base + 29; num += (t >> 7) & 1;
+    }
+
+    return num;
+}
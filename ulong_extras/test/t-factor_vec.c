@@ -0,0 +1,90 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("factor_vec....");
+    fflush(stdout);
+
+    /* Compare with n_factor */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        n_factor_t * factors, fac;
+        mp_ptr n;
+        slong j, k, len;
+        int proved = n_randint(state, 2);
+
+        len = n_randint(state, 200);
+        n = flint_malloc((len + 1)*sizeof(mp_limb_t));
+        factors = flint_malloc((len + 1)*sizeof(n_factor_t));
+
+        for (j = 0; j < len; j++)
+        {
+            switch (n_randint(state, 3))
+            {
+                case 0:
+                    n[j] = n_randtest(state);
+                    break;
+                case 1:
+                    n[j] = n_randint(state, 1000);
+                    break;
+                default:
+                    n[j] = n_randbits(state, n_randint(state, 40) + 1);
+            }
+        }
+
+        n_factor_vec(factors, n, len, proved);
+
+        for (j = 0; j < len; j++)
+        {
+            n_factor_init(&fac);
+            n_factor(&fac, n[j], proved);
+
+            result = (fac.num == factors[j].num);
+            for (k = 0; k < fac.num && result; k++)
+                result = (fac.p[k] == factors[j].p[k]
+                            && fac.exp[k] == factors[j].exp[k]);
+
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = %wu\n", n[j]);
+                abort();
+            }
+        }
+
+        flint_free(n);
+        flint_free(factors);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("is_prime_vec....");
+    fflush(stdout);
+
+    /* Compare with n_is_prime */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        mp_ptr n;
+        int * res;
+        slong j, len;
+
+        len = n_randint(state, 100);
+        n = flint_malloc((len + 1)*sizeof(mp_limb_t));
+        res = flint_malloc((len + 1)*sizeof(int));
+
+        for (j = 0; j < len; j++)
+        {
+            switch (n_randint(state, 4))
+            {
+                case 0:
+                    n[j] = n_randtest(state);
+                    break;
+                case 1:
+                    n[j] = n_randprime(state,
+                                  n_randint(state, FLINT_BITS - 1) + 2, 0);
+                    break;
+                case 2: /* semiprimes, which pass the small checks */
+                    n[j] = n_randprime(state, FLINT_BITS/2, 0)
+                         * n_randprime(state, FLINT_BITS/2, 0);
+                    break;
+                default:
+                    n[j] = n_randbits(state, FLINT_BITS) | 1;
+            }
+        }
+
+        n_is_prime_vec(res, n, len);
+
+        for (j = 0; j < len; j++)
+        {
+            result = (res[j] == n_is_prime(n[j]));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = %wu, res = %d\n", n[j], res[j]);
+                abort();
+            }
+        }
+
+        flint_free(n);
+        flint_free(res);
+    }
+
+    /* Strong pseudoprimes to base 2 */
+    {
+        mp_limb_t n[] = {UWORD(2047), UWORD(3277), UWORD(4033),
+                         UWORD(1194649), UWORD(3215031751),
+                         UWORD(4294967291)};
+        int res[6];
+        slong j;
+
+        n_is_prime_vec(res, n, 6);
+
+        for (j = 0; j < 6; j++)
+        {
+            result = (res[j] == n_is_prime(n[j]));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = %wu, res = %d\n", n[j], res[j]);
+                abort();
+            }
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
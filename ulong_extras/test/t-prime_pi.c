@@ -57,6 +57,70 @@ int main(void)
         }
     }
 
+    /* Values above the table cutoff, using both ways of counting */
+    for (n = 0; n < 100 * FLINT_MIN(10, flint_test_multiplier()); n++)
+    {
+        ulong k = 70000 + n_randint(state, 1000000);
+        mp_limb_t p = n_nth_prime(k);
+
+        if (p != n_primes_arr_readonly(k)[k - 1] ||
+            n_prime_pi(p) != k || n_prime_pi(p - 1) != k - 1)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("k = %wu, p = %wu\n", k, p);
+            abort();
+        }
+    }
+
+    /* Some known values */
+    {
+        mp_limb_t x[] = { UWORD(1000000), UWORD(10000000),
+                          UWORD(100000000), UWORD(1000000000),
+#if FLINT64
+                          UWORD(10000000000), UWORD(100000000000),
+#endif
+                        };
+        ulong pi[] = { UWORD(78498), UWORD(664579), UWORD(5761455),
+                       UWORD(50847534),
+#if FLINT64
+                       UWORD(455052511), UWORD(4118054813),
+#endif
+                     };
+        ulong k[] = { UWORD(1000000), UWORD(10000000), UWORD(100000000),
+#if FLINT64
+                      UWORD(1000000000), UWORD(10000000000),
+#endif
+                    };
+        mp_limb_t p[] = { UWORD(15485863), UWORD(179424673),
+                          UWORD(2038074743),
+#if FLINT64
+                          UWORD(22801763489), UWORD(252097800623),
+#endif
+                        };
+
+        for (n = 0; n < sizeof(x) / sizeof(mp_limb_t); n++)
+        {
+            if (n_prime_pi(x[n]) != pi[n])
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("pi(%wu) = %wu, expected %wu\n",
+                    x[n], n_prime_pi(x[n]), pi[n]);
+                abort();
+            }
+        }
+
+        for (n = 0; n < sizeof(k) / sizeof(ulong); n++)
+        {
+            if (n_nth_prime(k[n]) != p[n])
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("prime(%wu) = %wu, expected %wu\n",
+                    k[n], n_nth_prime(k[n]), p[n]);
+                abort();
+            }
+        }
+    }
+
     FLINT_TEST_CLEANUP(state);
     flint_printf("PASS\n");
     return 0;
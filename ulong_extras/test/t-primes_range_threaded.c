@@ -0,0 +1,120 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    n_primes_t iter;
+    mp_limb_t last;
+    slong num;
+    slong max;
+    int ok;
+}
+check_arg_t;
+
+/*
+   Checks that the primes continue the sequence of the iterator, stopping
+   after max of them
+*/
+static int
+check(const mp_limb_t * primes, slong num, void * arg_ptr)
+{
+    check_arg_t * arg = (check_arg_t *) arg_ptr;
+    slong i;
+
+    for (i = 0; i < num && arg->num < arg->max; i++)
+    {
+        if (primes[i] != n_primes_next(arg->iter))
+            arg->ok = 0;
+
+        arg->last = primes[i];
+        arg->num++;
+    }
+
+    return arg->num == arg->max;
+}
+
+int main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("primes_range_threaded....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        mp_limb_t a, b;
+        check_arg_t arg;
+
+        a = n_randtest_bits(state, 1 + n_randint(state, FLINT_MIN(40,
+                                                          FLINT_BITS - 2)));
+        if (n_randint(state, 4) == 0)
+            a = n_randint(state, 10);
+
+        /* Sometimes over several segments */
+        b = a + n_randint(state, n_randint(state, 10) ? 100000 :
+                                                   2 * FLINT_SIEVE_SIZE);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        n_primes_init(arg.iter);
+        if (a > 0)
+            n_primes_jump_after(arg.iter, a - 1);
+
+        arg.last = (a == 0) ? 0 : a - 1;
+        arg.num = 0;
+        arg.max = n_randint(state, 2) ? WORD_MAX : n_randint(state, 1000);
+        arg.ok = 1;
+
+        n_primes_range_threaded(a, b, check, &arg);
+
+        /* The sequence must also stop at the right place */
+        if (arg.ok && arg.num < arg.max)
+            arg.ok = (n_primes_next(arg.iter) > b);
+
+        /* Compare with n_nextprime near the start of the range */
+        if (arg.ok && arg.num != 0)
+        {
+            mp_limb_t p = n_nextprime((a == 0) ? 0 : a - 1, 0);
+
+            n_primes_jump_after(arg.iter, (a == 0) ? 0 : a - 1);
+            arg.ok = (p == n_primes_next(arg.iter));
+        }
+
+        n_primes_clear(arg.iter);
+
+        if (!arg.ok)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("a = %wu, b = %wu, num = %wd\n", a, b, arg.num);
+            abort();
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}